@@ -0,0 +1,73 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace protoc_js_gen_plugin {
+
+// Append-only text buffer behind the generators' `output_ << ...` chains.
+// Unlike std::ostringstream there is no locale or sentry per insertion:
+// text is appended straight to one growable string presized by the caller,
+// integers are formatted with std::to_chars, and the finished text is moved
+// out instead of copied.
+class CodeWriter {
+public:
+    // Spaces per indentation level
+    static constexpr size_t kIndentWidth = 4;
+
+    // Drop the text written so far and reserve room for the next output
+    void Reset(size_t size_hint);
+
+    // Move the written text out, leaving the writer empty
+    std::string Release();
+
+    size_t size() const { return buffer_.size(); }
+
+    // Inlined so the length of a string literal folds to a constant. Arrays
+    // are measured rather than taken at their size: char buffers are
+    // streamed too.
+    CodeWriter& operator<<(const char* text) {
+        buffer_.append(text, std::char_traits<char>::length(text));
+        return *this;
+    }
+
+    CodeWriter& operator<<(const std::string& text) {
+        buffer_.append(text);
+        return *this;
+    }
+
+    CodeWriter& operator<<(std::string_view text) {
+        buffer_.append(text.data(), text.size());
+        return *this;
+    }
+
+    CodeWriter& operator<<(char c) {
+        buffer_.push_back(c);
+        return *this;
+    }
+
+    template <typename T, typename = std::enable_if_t<
+        std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>>>
+    CodeWriter& operator<<(T value) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer_.append(digits, static_cast<size_t>(result.ptr - digits));
+        return *this;
+    }
+
+    // Indentation of a nesting depth; the strings are built once and shared
+    static const std::string& Indent(size_t depth);
+
+    // Indentation one level deeper than indent
+    static const std::string& Deeper(const std::string& indent) {
+        return Indent(indent.size() / kIndentWidth + 1);
+    }
+
+private:
+    std::string buffer_;
+};
+
+}  // namespace protoc_js_gen_plugin
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "google/protobuf/descriptor.pb.h"
+
+namespace protoc_js_gen_plugin {
+
+// Fixed record layout of a message in the flat binary blob format.
+//
+// Every message is stored as a fixed-size little-endian record:
+//   - scalars inline (bool 1 byte, 32-bit 4 bytes, 64-bit 8 bytes)
+//   - string/bytes as (uint32 offset, uint32 byte length) into the blob
+//   - singular messages as a uint32 record offset, 0 when absent
+//   - repeated fields as (uint32 offset, uint32 count) of an element array;
+//     message elements are uint32 record offsets, map entries are inline records
+//   - well-known types inline: Timestamp/Duration as float64 milliseconds,
+//     wrappers as their primitive, JSON-like types as JSON text strings
+//   - presence bits of scalar fields with explicit presence in uint32 words
+//   - one uint32 case slot per oneof, holding the active field number
+// Slots are ordered by size (8, 4, 1) so they stay naturally aligned, and
+// records are padded to a multiple of 8 bytes.
+struct FlatFieldLayout {
+    const google::protobuf::FieldDescriptorProto* field = nullptr;
+    uint32_t offset = 0;        // slot offset within the record
+    uint32_t size = 0;          // slot size in bytes
+    uint32_t stride = 0;        // element size of repeated fields, 0 otherwise
+    int presence_bit = -1;      // bit index in the presence words, -1 if none
+    int32_t oneof_offset = -1;  // offset of the oneof case slot, -1 if none
+};
+
+struct FlatLayout {
+    uint32_t size = 0;
+    uint32_t presence_offset = 0;
+    std::vector<FlatFieldLayout> fields;  // declaration order
+    uint32_t hash = 0;                    // fingerprint of the layout
+
+    // Compute the layout of a message. presence_fields lists the fields with
+    // explicit presence; message fields among them need no presence bit.
+    static FlatLayout Compute(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::vector<const google::protobuf::FieldDescriptorProto*>& presence_fields);
+
+    // Type a field's values are stored as (well-known types map to scalars)
+    static google::protobuf::FieldDescriptorProto::Type GetStorageType(
+        const google::protobuf::FieldDescriptorProto& field);
+
+    // Element size of a single value of the field's type
+    static uint32_t GetElementSize(const google::protobuf::FieldDescriptorProto& field);
+
+    // Name of the generated module-level reader function for the field's type
+    static std::string GetReaderName(const google::protobuf::FieldDescriptorProto& field);
+};
+
+}  // namespace protoc_js_gen_plugin
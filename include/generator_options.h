@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+
+namespace protoc_js_gen_plugin {
+
+// JavaScript representation of 64-bit integer fields
+enum class Int64Mode {
+    kNumber,  // number, imprecise above 2^53
+    kBigInt,  // bigint
+    kString,  // decimal string
+    kHybrid,  // number while a safe integer, bigint otherwise
+};
+
+// Options passed to the plugin through protoc's --js-mjs_opt=... parameter.
+// The parameter is a comma separated list of flags or key=value pairs.
+struct GeneratorOptions {
+    // Inline enum member references as numeric literals
+    bool enum_inline = false;
+
+    // Generate static acquire()/release() backed by a free list
+    bool pool = false;
+
+    // Maximum number of free instances kept per message class
+    int pool_size = 64;
+
+    // Track dirty fields and generate encodeDelta()/applyDelta()/commit();
+    // decoded, cleared and delta-applied messages start committed
+    bool dirty_tracking = false;
+
+    // Generate static validate()/validateAndDecode() for untrusted JSON
+    bool validate = false;
+
+    // Generate zero-copy View accessor classes over the flat binary blob format
+    bool flat = false;
+
+    // Generate struct-of-arrays Columns classes with scan/aggregate helpers
+    bool columnar = false;
+
+    // Intern every string field on decode, not only fields marked (intern)
+    bool intern_strings = false;
+
+    // Represent google.protobuf.Timestamp as epoch milliseconds instead of Date
+    // (timestamp=number, default timestamp=date)
+    bool timestamp_number = false;
+
+    // Representation of int64/uint64/sint64/fixed64/sfixed64 fields
+    // (int64=number|bigint|string|hybrid, default number)
+    Int64Mode int64 = Int64Mode::kNumber;
+
+    // Embed the serialized FileDescriptorProto for runtime reflection
+    bool embed_descriptors = false;
+
+    // Emit a request-wide registry module resolving full names to lazily
+    // imported classes (registry[=file], default type_registry.mjs)
+    bool registry = false;
+    std::string registry_file = "type_registry.mjs";
+
+    // Add the (message_id) option and its module's (module_id) to message
+    // descriptors as moduleId/messageId, for the framed stream runtime
+    bool framing = false;
+
+    // Generate a client stub per module pairing *_REQUEST/*_RESPONSE message
+    // ids, for the pipelining RPC runtime (implies framing)
+    bool client = false;
+
+    // Emit a JSON manifest of the generated files with their SHA-256 and
+    // proto dependency closure, plus a Make/Ninja depfile next to it
+    // (manifest[=file.json], default manifest.json; depfile manifest.d)
+    bool manifest = false;
+    std::string manifest_file = "manifest.json";
+
+    // Directory prefixed to the proto files listed in the depfile, normally
+    // the proto_path they were found on, so that Make/Ninja see paths on disk
+    // (manifest_root=dir); without it they are import names relative to it
+    std::string manifest_root;
+
+    // Directory prefixed to the outputs the depfile names as targets, normally
+    // protoc's output directory as seen from where Make/Ninja run
+    // (output_root=dir); without it they are relative to that directory
+    std::string output_root;
+
+    // Keep the JSON of sub-message and repeated sub-message fields on decode
+    // and decode it on first access through the field's getter
+    bool lazy = false;
+
+    // Keep the JSON (and source text) a message was decoded from and write it
+    // back verbatim while the message and its decoded sub-messages are
+    // unmodified; unknown keys survive re-encoding of modified messages. Plain
+    // fields become accessors so that assignments drop the retained JSON
+    bool passthrough = false;
+
+    // Generate the files of a request concurrently
+    bool parallel = false;
+
+    // Parse a CodeGeneratorRequest parameter string
+    // Returns false and fills error for unknown or malformed options
+    static bool Parse(
+        const std::string& parameter,
+        GeneratorOptions* options,
+        std::string* error);
+};
+
+}  // namespace protoc_js_gen_plugin
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace protoc_js_gen_plugin {
+
+// Plans import specifiers and namespace aliases between generated modules.
+//
+// Paths are treated purely lexically: they are split into segments once and
+// never resolved against the filesystem, so planning makes no system calls
+// and does not depend on protoc's working directory. Results are memoized for
+// the lifetime of the planner, which is one request.
+class ImportPlanner {
+public:
+    // Import specifier of the module generated for proto file `to`, relative
+    // to module or proto file `from`, e.g. "../math/comm_math.mjs"
+    const std::string& GetImportPath(const std::string& from, const std::string& to);
+
+    // Namespace alias of the module generated for a proto file, e.g.
+    // "__PokeworldMathComm_math"; unique among all files of the planner
+    const std::string& GetAlias(const std::string& proto_file);
+
+private:
+    // Normalized path segments: separators unified, "." dropped, ".." folded
+    const std::vector<std::string>& GetSegments(const std::string& path);
+
+    std::unordered_map<std::string, std::vector<std::string>> segments_;
+    std::map<std::pair<std::string, std::string>, std::string> import_paths_;
+    std::unordered_map<std::string, std::string> aliases_;
+    std::unordered_set<std::string> used_aliases_;
+};
+
+}  // namespace protoc_js_gen_plugin
@@ -1,77 +1,214 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
-#include <sstream>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
+#include "code_writer.h"
+#include "generator_options.h"
 #include "google/protobuf/descriptor.pb.h"
 
 namespace protoc_js_gen_plugin {
 
 class TypeResolver;
+struct FileSchema;
 
 class JsCodeGenerator {
 public:
     JsCodeGenerator(
-        const google::protobuf::FileDescriptorProto& proto_file,
-        const TypeResolver& type_resolver);
+        const FileSchema& file,
+        const TypeResolver& type_resolver,
+        const GeneratorOptions& options);
 
     // Generate JavaScript code for the proto file
     std::string Generate();
 
 private:
-    // Helper types
-    using ImportAliasMap = std::unordered_map<std::string, std::string>;
-
-    // Collection methods
-    void CollectExternalTypeReferences();
-    void CollectMessageTypeReferences(
-        const google::protobuf::DescriptorProto& message_type);
-    void RecordTypeReference(const std::string& type_name);
-
     // Import generation
     void GenerateImports();
-    std::string GetImportPath(const std::string& proto_file_path) const;
-    std::string GenerateImportAlias(const std::string& proto_file_path) const;
 
-    // Type name transformation
-    std::string TransformTypeName(
-        const std::string& type_name,
-        const google::protobuf::FileDescriptorProto& proto_file);
+    // Module-private helpers shared by the generated value methods
+    void GenerateValueHelpers();
 
-    // Code generation methods
-    void GenerateEnum(const google::protobuf::EnumDescriptorProto& enum_type);
-    void GenerateMessage(
-        const google::protobuf::DescriptorProto& message_type,
-        const std::string& indent,
+    // Module-private codecs of the google.protobuf well-known types
+    void GenerateWellKnownTypeHelpers();
+    void GenerateInt64Helpers();
+
+    // Module-private checks shared by the generated validators
+    void GenerateValidationHelpers();
+
+    // Module-private helper copying unknown keys of retained JSON (passthrough option)
+    void GeneratePassthroughHelpers();
+
+    // Module-private readers shared by the generated flat blob views
+    void GenerateFlatHelpers();
+
+    // Base class shared by the generated columnar tables
+    void GenerateColumnHelpers();
+
+    // Module-level serialized FileDescriptorProto for runtime reflection
+    void GenerateFileDescriptor();
+
+    // Generate the client stub pairing *_REQUEST/*_RESPONSE message ids (client option)
+    void GenerateClient();
+
+    // Code generation methods; nested types are emitted as module-level
+    // definitions under their independent name, like top-level ones
+    void GenerateEnum(
+        const google::protobuf::EnumDescriptorProto& enum_type,
         const std::string& parent_full_name);
-    std::string GenerateNestedMessageClass(
+    // Returns the name of the emitted class
+    std::string GenerateMessage(
         const google::protobuf::DescriptorProto& message_type,
         const std::string& parent_full_name);
-    void GenerateNestedEnum(
-        const google::protobuf::EnumDescriptorProto& enum_type,
-        const std::string& indent,
-        const std::string& parent_full_name = "");
+    void GenerateEnumValueIndex(const google::protobuf::EnumDescriptorProto& enum_type);
     void GenerateFieldMethods(
+        const google::protobuf::DescriptorProto& message_type,
+        const google::protobuf::FieldDescriptorProto& field,
+        const std::string& indent,
+        const std::string& class_name);
+    void GeneratePresenceSlots(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent);
+    void GenerateOneofMembers(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+    void GenerateClearMethod(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+    void GeneratePoolMethods(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+    void GenerateDeltaMethods(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+    void GenerateValueMethods(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+    void GenerateToJson(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+    void GenerateValidationMethods(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+    void GenerateLazyMaterialize(
+        const google::protobuf::DescriptorProto& message_type,
+        const google::protobuf::FieldDescriptorProto& field,
+        const std::string& indent,
+        const std::string& class_name);
+    void GenerateLazyMethods(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent);
+    void GeneratePassthroughMethods(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent);
+    void GenerateMapPristineCheck(
+        const google::protobuf::DescriptorProto& message_type,
         const google::protobuf::FieldDescriptorProto& field,
+        const std::string& indent);
+    void GenerateFlatView(
+        const google::protobuf::DescriptorProto& message_type,
         const std::string& indent,
         const std::string& class_name);
+    void GenerateColumns(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent,
+        const std::string& class_name);
+
+    // JSDoc type of a field, honoring the Timestamp representation
+    std::string GetFieldJsType(const google::protobuf::FieldDescriptorProto& field) const;
 
-    // Helper to get JavaScript class reference for a field
+    // JavaScript reference to the class or enum of a message/enum field,
+    // resolved through the file's schema
     std::string GetFieldClassRef(
+        const google::protobuf::FieldDescriptorProto& field) const;
+
+    // Presence tracking: fields with explicit presence get one bit each
+    std::vector<const google::protobuf::FieldDescriptorProto*> GetPresenceFields(
+        const google::protobuf::DescriptorProto& message_type) const;
+    int GetPresenceBit(const google::protobuf::FieldDescriptorProto& field) const;
+
+    // 64-bit integer fields in a representation other than number, decoded
+    // by __decodeInt64 (not map values, which stay plain JSON)
+    bool IsInt64Field(const google::protobuf::FieldDescriptorProto& field) const;
+
+    // Generated decoder turning a field's JSON value into its representation,
+    // empty when the JSON value is used as is
+    std::string GetValueDecoder(const google::protobuf::FieldDescriptorProto& field) const;
+
+    // JavaScript expression converting a field value to its JSON form, for
+    // representations JSON.stringify cannot write (bigint)
+    std::string GetJsonValue(
+        const google::protobuf::FieldDescriptorProto& field,
+        const std::string& value) const;
+    bool HasJsonEncodedFields(const google::protobuf::DescriptorProto& message_type) const;
+
+    // Lazy decoding: sub-message and repeated sub-message fields outside
+    // oneofs, kept as raw JSON until first accessed
+    bool IsLazyField(const google::protobuf::FieldDescriptorProto& field) const;
+    bool HasLazyFields(const google::protobuf::DescriptorProto& message_type) const;
+
+    // Dirty tracking: statement marking a field as changed, empty when disabled
+    std::string GetDirtyMark(
+        const google::protobuf::DescriptorProto& message_type,
+        const google::protobuf::FieldDescriptorProto& field) const;
+
+    // Emit the statements recording a change of field: its dirty mark and,
+    // with the passthrough option, dropping the retained source JSON
+    void GenerateMutationMarks(
+        const google::protobuf::DescriptorProto& message_type,
+        const google::protobuf::FieldDescriptorProto& field,
+        const std::string& indent);
+
+    // JavaScript expression checking value against the field's type
+    std::string GetValidationCheck(
+        const google::protobuf::FieldDescriptorProto& field,
+        const std::string& value);
+
+    // Columnar storage of a field: a TypedArray name, "string" for
+    // dictionary-encoded strings or "Array" for values kept as is
+    std::string GetColumnKind(const google::protobuf::FieldDescriptorProto& field) const;
+
+    // String fields deduplicated through the runtime intern table, either
+    // globally (intern_strings) or per field with the (intern) field option
+    bool IsInternField(const google::protobuf::FieldDescriptorProto& field) const;
+
+    // Frame header ids of a message with a (message_id) option: the option
+    // value and the (module_id) option of its MessageId enum, 0 if unset
+    bool GetFrameIds(
+        const google::protobuf::DescriptorProto& message_type,
+        uint64_t* module_id,
+        uint64_t* message_id,
+        const google::protobuf::EnumDescriptorProto** message_id_enum = nullptr) const;
+
+    // Emit the moduleId/messageId descriptor entries (framing option)
+    void GenerateFrameIds(
+        const google::protobuf::DescriptorProto& message_type,
+        const std::string& indent);
+
+    // Helper to get JavaScript default value expression for a field
+    std::string GetFieldDefaultValue(
         const google::protobuf::FieldDescriptorProto& field);
 
     // Member variables
+    const FileSchema& file_;
     const google::protobuf::FileDescriptorProto& proto_file_;
     const TypeResolver& type_resolver_;
-    std::ostringstream output_;
-    std::unordered_set<std::string> generated_nested_classes_;
-    std::unordered_set<std::string> referenced_external_types_;
-    ImportAliasMap import_aliases_;
+    const GeneratorOptions& options_;
+    int intern_extension_number_;
+    std::vector<const google::protobuf::FieldDescriptorProto*> message_id_extensions_;
+    int module_id_extension_number_;
+    CodeWriter output_;
 };
 
 }  // namespace protoc_js_gen_plugin
\ No newline at end of file
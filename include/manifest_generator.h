@@ -0,0 +1,57 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "code_writer.h"
+#include "generator_options.h"
+#include "google/protobuf/compiler/plugin.pb.h"
+
+namespace protoc_js_gen_plugin {
+
+class Schema;
+
+// Generates the manifest of a response: every output file with its SHA-256,
+// size and the closure of proto files it was generated from, as JSON and as
+// a Make/Ninja depfile. Build systems compare the hashes to skip downstream
+// steps for outputs whose bytes did not change.
+//
+// Output paths are relative to protoc's output directory and proto paths
+// to the proto path they were found on, as protoc reports them. With the
+// manifest_root option the depfile prefixes the proto paths with it so that
+// they name files on disk, and leaves out the google/protobuf files bundled
+// with protoc, which live on another proto path. output_root does the same
+// for the targets, so that both resolve from the build directory.
+class ManifestGenerator {
+public:
+    // The response must already hold every other output file
+    ManifestGenerator(
+        const Schema& schema,
+        const google::protobuf::compiler::CodeGeneratorResponse& response,
+        const GeneratorOptions& options);
+
+    // Generate the JSON manifest
+    std::string GenerateManifest();
+
+    // Generate the depfile, one rule per output file
+    std::string GenerateDepfile();
+
+    // Depfile name next to the manifest, e.g. "manifest.d"
+    static std::string GetDepfileName(const std::string& manifest_file);
+
+private:
+    // Proto files an output was generated from
+    std::set<std::string> GetDependencies(const std::string& output_name) const;
+
+    // Proto file and its transitive imports
+    void CollectDependencies(const std::string& proto_file, std::set<std::string>* closure) const;
+
+    const Schema& schema_;
+    const google::protobuf::compiler::CodeGeneratorResponse& response_;
+    const GeneratorOptions& options_;
+    std::map<std::string, const google::protobuf::FileDescriptorProto*> proto_files_;
+    CodeWriter output_;
+};
+
+}  // namespace protoc_js_gen_plugin
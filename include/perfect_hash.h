@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace protoc_js_gen_plugin {
+
+// Minimal perfect hash over a fixed set of distinct keys (hash and displace).
+//
+// A key first hashes with seed 0 into one of seeds.size() buckets. A bucket
+// holding a single key stores -(slot + 1) directly; otherwise it stores the
+// seed that sends each of its keys to a distinct free slot:
+//   seed = seeds[Hash(0, key) % n]
+//   slot = seed < 0 ? -seed - 1 : Hash(seed, key) % n
+// Keys outside the set land on an arbitrary slot, so callers compare the key
+// stored there. Hash is 32-bit FNV-1a over the key bytes, which the generated
+// JavaScript reproduces with Math.imul over char codes (names are ASCII).
+struct PerfectHash {
+    std::vector<int32_t> seeds;  // one entry per bucket
+    std::vector<int> slots;      // index into the input keys of each slot
+
+    static uint32_t Hash(uint32_t seed, const std::string& key);
+
+    static PerfectHash Build(const std::vector<std::string>& keys);
+};
+
+}  // namespace protoc_js_gen_plugin
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "code_writer.h"
+#include "generator_options.h"
+
+namespace protoc_js_gen_plugin {
+
+class Schema;
+class TypeResolver;
+
+// Generates the request-wide type registry module: every message and enum of
+// the generated files, looked up by full name through a perfect hash computed
+// here, with one lazy import() loader per module.
+class RegistryGenerator {
+public:
+    RegistryGenerator(const Schema& schema, const GeneratorOptions& options);
+
+    // Generate JavaScript code for the registry module
+    std::string Generate();
+
+private:
+    std::vector<std::string> generated_files_;
+    const TypeResolver& type_resolver_;
+    const GeneratorOptions& options_;
+    CodeWriter output_;
+};
+
+}  // namespace protoc_js_gen_plugin
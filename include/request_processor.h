@@ -2,10 +2,14 @@
 
 #include <string>
 
+#include "generator_options.h"
 #include "google/protobuf/compiler/plugin.pb.h"
 
 namespace protoc_js_gen_plugin {
 
+class Schema;
+struct FileSchema;
+
 class RequestProcessor {
 public:
     // Process a CodeGeneratorRequest and return a CodeGeneratorResponse
@@ -15,10 +19,11 @@ public:
     // Get output filename for a proto file
     static std::string GetOutputFileName(const std::string& proto_file_name);
 
-    // Generate file content for a proto file
+    // Generate file content for a resolved proto file
     static std::string GenerateFileContent(
-        const google::protobuf::FileDescriptorProto& proto_file,
-        const std::vector<const google::protobuf::FileDescriptorProto*>& all_proto_files);
+        const FileSchema& file,
+        const Schema& schema,
+        const GeneratorOptions& options);
 
 private:
     // Helper to change file extension
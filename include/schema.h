@@ -0,0 +1,90 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "google/protobuf/compiler/plugin.pb.h"
+#include "google/protobuf/descriptor.pb.h"
+#include "type_resolver.h"
+
+namespace protoc_js_gen_plugin {
+
+// Resolved intermediate representation of one CodeGeneratorRequest.
+//
+// Names, referenced types and import edges are resolved once per request;
+// emitters read it concurrently and never modify it. Pointers between the
+// structures stay valid for the lifetime of the Schema.
+
+// Module of another generated file imported by a file
+struct ImportSchema {
+    std::string proto_file;   // imported proto file
+    std::string module_path;  // import specifier relative to the importing module
+    std::string alias;        // namespace identifier, unique within the request
+};
+
+// Field with its naming variants and referenced type resolved
+struct FieldSchema {
+    const google::protobuf::FieldDescriptorProto* proto = nullptr;
+    std::string camel_name;       // e.g. "walkSpeed"
+    std::string pascal_name;      // e.g. "WalkSpeed"
+    std::string well_known_type;  // e.g. "Timestamp", empty for other fields
+    int presence_bit = -1;        // bit in the message's presence bitmask, -1 if untracked
+
+    // Declared message or enum type, nullptr for scalars and well-known types
+    const TypeResolver::Symbol* type = nullptr;
+
+    // Import of the file declaring the type, nullptr when it is declared in
+    // the same file (or the field has no type reference)
+    const ImportSchema* import = nullptr;
+};
+
+struct MessageSchema {
+    const google::protobuf::DescriptorProto* proto = nullptr;
+    std::string full_name;                    // without leading dot
+    std::string path;                         // from the package, e.g. "GetPlayersResponse.Result"
+    std::vector<FieldSchema> fields;          // declaration order
+    std::vector<MessageSchema> nested_types;  // declaration order
+};
+
+struct FileSchema {
+    const google::protobuf::FileDescriptorProto* proto = nullptr;
+    std::string output_name;              // e.g. "pokeworld/actor/cfg_actor.mjs"
+    std::vector<ImportSchema> imports;    // sorted by proto file
+    std::vector<MessageSchema> messages;  // declaration order
+    bool uses_well_known_types = false;
+    bool uses_int64 = false;              // any 64-bit integer field
+
+    // Resolved form of a field declared in this file, nullptr for fields
+    // that are not part of the file (e.g. synthesized copies)
+    const FieldSchema* FindField(const google::protobuf::FieldDescriptorProto& field) const;
+
+    std::unordered_map<const google::protobuf::FieldDescriptorProto*, const FieldSchema*> fields_by_proto;
+};
+
+class Schema {
+public:
+    // Resolve every file to generate; the request must outlive the Schema
+    explicit Schema(const google::protobuf::compiler::CodeGeneratorRequest& request);
+
+    Schema(const Schema&) = delete;
+    Schema& operator=(const Schema&) = delete;
+
+    // All proto files of the request, including dependencies
+    const std::vector<const google::protobuf::FileDescriptorProto*>& all_proto_files() const {
+        return all_proto_files_;
+    }
+
+    // Request-wide symbol table over all proto files, including dependencies
+    const TypeResolver& type_resolver() const { return type_resolver_; }
+
+    // Files to generate, sorted by proto file name
+    const std::vector<FileSchema>& files() const { return files_; }
+
+private:
+    std::vector<const google::protobuf::FileDescriptorProto*> all_proto_files_;
+    TypeResolver type_resolver_;
+    std::vector<FileSchema> files_;
+};
+
+}  // namespace protoc_js_gen_plugin
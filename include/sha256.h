@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace protoc_js_gen_plugin {
+
+// SHA-256 digest of data as 64 lowercase hex characters (FIPS 180-4)
+std::string Sha256Hex(const std::string& data);
+
+}  // namespace protoc_js_gen_plugin
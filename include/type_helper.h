@@ -1,6 +1,5 @@
 #pragma once
 
-#include <functional>
 #include <string>
 
 #include "google/protobuf/descriptor.pb.h"
@@ -9,17 +8,6 @@ namespace protoc_js_gen_plugin {
 
 class TypeHelper {
 public:
-    // Type name transformer function type
-    using TypeNameTransformer = std::function<std::string(
-        const std::string& type_name,
-        const google::protobuf::FileDescriptorProto& proto_file)>;
-
-    // Set the type name transformer
-    static void SetTypeNameTransformer(TypeNameTransformer transformer);
-
-    // Get the current type name transformer
-    static TypeNameTransformer GetTypeNameTransformer();
-
     // Get JavaScript type for a field
     static std::string GetJsType(
         const google::protobuf::FieldDescriptorProto& field,
@@ -30,9 +18,35 @@ public:
         const google::protobuf::FieldDescriptorProto& field,
         const google::protobuf::FileDescriptorProto& proto_file);
 
+    // Get the google.protobuf well-known type of a message field
+    // (e.g. "Timestamp"), empty for any other field
+    static std::string GetWellKnownType(
+        const google::protobuf::FieldDescriptorProto& field);
+
+    // Get the primitive type boxed by a wrapper type (e.g. TYPE_INT32 for
+    // "Int32Value"), TYPE_MESSAGE for well-known types that are not wrappers
+    static google::protobuf::FieldDescriptorProto::Type GetWrappedType(
+        const std::string& well_known_type);
+
+    // Check for the 64-bit integer types (int64, uint64, sint64, fixed64, sfixed64)
+    static bool IsInt64Type(google::protobuf::FieldDescriptorProto::Type type);
+
+    // Check if a field has explicit presence tracked by a presence bit:
+    // singular fields of proto2, proto3 `optional` fields and sub-messages.
+    // Oneof members are tracked by their case field instead.
+    static bool HasPresenceBit(
+        const google::protobuf::FieldDescriptorProto& field,
+        const google::protobuf::FileDescriptorProto& proto_file);
+
     // Check if a field is a map field
     static bool IsMapField(const google::protobuf::FieldDescriptorProto& field);
 
+    // Get the map entry type of a map field, declared as a nested type of
+    // message_type; nullptr if it is not found
+    static const google::protobuf::DescriptorProto* FindMapEntry(
+        const google::protobuf::DescriptorProto& message_type,
+        const google::protobuf::FieldDescriptorProto& field);
+
     // Get key and value types for a map field
     static std::pair<std::string, std::string> GetMapKeyValueTypes(
         const google::protobuf::FieldDescriptorProto& field);
@@ -55,9 +69,6 @@ public:
     static std::string GetJsDefaultValue(
         const google::protobuf::FieldDescriptorProto& field,
         const google::protobuf::FileDescriptorProto& proto_file);
-
-private:
-    static TypeNameTransformer type_name_transformer_;
 };
 
 }  // namespace protoc_js_gen_plugin
\ No newline at end of file
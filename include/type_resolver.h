@@ -1,30 +1,45 @@
 #pragma once
 
-#include <memory>
 #include <string>
 #include <unordered_map>
-#include <utility>
 #include <vector>
 
 #include "google/protobuf/descriptor.pb.h"
 
 namespace protoc_js_gen_plugin {
 
+// Symbol table of every message and enum declared in the proto files of a
+// request, including dependencies that are not generated.
 class TypeResolver {
 public:
-    using TypeInfo = std::pair<std::string, std::string>;  // (proto_file, simple_name)
+    // A message or enum declared in one of the proto files
+    struct Symbol {
+        std::string full_name;   // without leading dot, e.g. "pokeworld.player.cs.GetPlayersResponse.Result"
+        std::string proto_file;  // declaring proto file
+        std::string path;        // property path from the module exports, e.g. "GetPlayersResponse.Result"
+    };
 
-    TypeResolver(
-        const google::protobuf::FileDescriptorProto& current_file,
+    explicit TypeResolver(
         const std::vector<const google::protobuf::FileDescriptorProto*>& all_proto_files);
 
-    // Get type information for external types
-    // Returns (proto_file, simple_name) if external, nullptr otherwise
-    std::unique_ptr<TypeInfo> GetExternalTypeInfo(const std::string& type_name) const;
+    // Find a message or enum by full type name (with or without leading dot),
+    // nullptr if not declared
+    const Symbol* FindSymbol(const std::string& type_name) const;
 
-    // Get required imports for referenced types
-    std::vector<TypeInfo> GetRequiredImports(
-        const std::vector<std::string>& referenced_type_names) const;
+    // Find enum definition by full type name, nullptr if not found
+    const google::protobuf::EnumDescriptorProto* FindEnum(const std::string& type_name) const;
+
+    // Find the field number of an extension by extendee and simple name,
+    // e.g. (".google.protobuf.FieldOptions", "intern"); 0 if not declared
+    int FindExtensionNumber(const std::string& extendee, const std::string& name) const;
+
+    // All extensions of an extendee with a simple name, e.g. the per-module
+    // (".google.protobuf.MessageOptions", "message_id") declarations
+    std::vector<const google::protobuf::FieldDescriptorProto*> FindExtensions(
+        const std::string& extendee, const std::string& name) const;
+
+    // All declared messages and enums, sorted by full name
+    const std::vector<Symbol>& GetSymbols() const;
 
 private:
     void BuildTypeMap();
@@ -41,9 +56,10 @@ private:
         const std::string& package,
         const std::string& parent_full_name);
 
-    std::unordered_map<std::string, TypeInfo> type_map_;
-    const google::protobuf::FileDescriptorProto& current_file_;
+    std::unordered_map<std::string, size_t> symbol_map_;  // dotted full name -> index in symbols_
+    std::unordered_map<std::string, const google::protobuf::EnumDescriptorProto*> enum_map_;
+    std::vector<Symbol> symbols_;
     std::vector<const google::protobuf::FileDescriptorProto*> all_proto_files_;
 };
 
-}  // namespace protoc_js_gen_plugin
\ No newline at end of file
+}  // namespace protoc_js_gen_plugin
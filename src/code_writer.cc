@@ -0,0 +1,38 @@
+#include "code_writer.h"
+
+#include <array>
+#include <string>
+#include <utility>
+
+namespace protoc_js_gen_plugin {
+
+namespace {
+
+// Deeper than any generated code nests; class bodies stay within a few levels
+constexpr size_t kMaxIndentDepth = 32;
+
+}  // namespace
+
+void CodeWriter::Reset(size_t size_hint) {
+    buffer_.clear();
+    buffer_.reserve(size_hint);
+}
+
+std::string CodeWriter::Release() {
+    std::string text = std::move(buffer_);
+    buffer_.clear();
+    return text;
+}
+
+const std::string& CodeWriter::Indent(size_t depth) {
+    static const std::array<std::string, kMaxIndentDepth> indents = [] {
+        std::array<std::string, kMaxIndentDepth> result;
+        for (size_t i = 0; i < kMaxIndentDepth; ++i) {
+            result[i] = std::string(i * kIndentWidth, ' ');
+        }
+        return result;
+    }();
+    return indents[depth < kMaxIndentDepth ? depth : kMaxIndentDepth - 1];
+}
+
+}  // namespace protoc_js_gen_plugin
@@ -0,0 +1,179 @@
+#include "flat_layout.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "type_helper.h"
+
+namespace protoc_js_gen_plugin {
+
+namespace {
+
+using google::protobuf::DescriptorProto;
+using google::protobuf::FieldDescriptorProto;
+
+// FNV-1a over the textual form of the layout
+uint32_t HashLayout(const std::string& text) {
+    uint32_t hash = 2166136261u;
+    for (char c : text) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t AlignTo(uint32_t value, uint32_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+FieldDescriptorProto::Type FlatLayout::GetStorageType(const FieldDescriptorProto& field) {
+    std::string well_known_type = TypeHelper::GetWellKnownType(field);
+    if (well_known_type.empty()) {
+        return field.type();
+    }
+    if (well_known_type == "Timestamp" || well_known_type == "Duration") {
+        return FieldDescriptorProto::TYPE_DOUBLE;
+    }
+    FieldDescriptorProto::Type wrapped_type = TypeHelper::GetWrappedType(well_known_type);
+    return wrapped_type == FieldDescriptorProto::TYPE_MESSAGE ? FieldDescriptorProto::TYPE_STRING : wrapped_type;
+}
+
+uint32_t FlatLayout::GetElementSize(const FieldDescriptorProto& field) {
+    switch (GetStorageType(field)) {
+        case FieldDescriptorProto::TYPE_BOOL:
+            return 1;
+        case FieldDescriptorProto::TYPE_INT64:
+        case FieldDescriptorProto::TYPE_UINT64:
+        case FieldDescriptorProto::TYPE_SINT64:
+        case FieldDescriptorProto::TYPE_FIXED64:
+        case FieldDescriptorProto::TYPE_SFIXED64:
+        case FieldDescriptorProto::TYPE_DOUBLE:
+        case FieldDescriptorProto::TYPE_STRING:
+        case FieldDescriptorProto::TYPE_BYTES:
+            return 8;
+        default:
+            // 32-bit scalars, enums and message record offsets
+            return 4;
+    }
+}
+
+std::string FlatLayout::GetReaderName(const FieldDescriptorProto& field) {
+    std::string well_known_type = TypeHelper::GetWellKnownType(field);
+    if (well_known_type == "Timestamp") {
+        return "__flatTimestamp";
+    }
+    if (!well_known_type.empty() && well_known_type != "Duration" &&
+        TypeHelper::GetWrappedType(well_known_type) == FieldDescriptorProto::TYPE_MESSAGE) {
+        // Struct, Value, ListValue, Any, Empty and FieldMask are stored as JSON text
+        return "__flatJson";
+    }
+    switch (GetStorageType(field)) {
+        case FieldDescriptorProto::TYPE_BOOL:
+            return "__flatBool";
+        case FieldDescriptorProto::TYPE_UINT32:
+        case FieldDescriptorProto::TYPE_FIXED32:
+            return "__flatUint32";
+        case FieldDescriptorProto::TYPE_FLOAT:
+            return "__flatFloat";
+        case FieldDescriptorProto::TYPE_DOUBLE:
+            return "__flatDouble";
+        case FieldDescriptorProto::TYPE_INT64:
+        case FieldDescriptorProto::TYPE_SINT64:
+        case FieldDescriptorProto::TYPE_SFIXED64:
+            return "__flatInt64";
+        case FieldDescriptorProto::TYPE_UINT64:
+        case FieldDescriptorProto::TYPE_FIXED64:
+            return "__flatUint64";
+        case FieldDescriptorProto::TYPE_STRING:
+            return "__flatString";
+        case FieldDescriptorProto::TYPE_BYTES:
+            return "__flatBytes";
+        case FieldDescriptorProto::TYPE_MESSAGE:
+        case FieldDescriptorProto::TYPE_GROUP:
+            return "__flatMessage";
+        default:
+            return "__flatInt32";
+    }
+}
+
+FlatLayout FlatLayout::Compute(
+    const DescriptorProto& message_type,
+    const std::vector<const FieldDescriptorProto*>& presence_fields) {
+
+    FlatLayout layout;
+    layout.fields.resize(message_type.field_size());
+
+    // Slot sizes, strides and presence bits
+    int presence_count = 0;
+    for (int i = 0; i < message_type.field_size(); ++i) {
+        const FieldDescriptorProto& field = message_type.field(i);
+        FlatFieldLayout& slot = layout.fields[i];
+        slot.field = &field;
+
+        if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            slot.size = 8;
+            const DescriptorProto* entry = GetStorageType(field) == FieldDescriptorProto::TYPE_MESSAGE ?
+                TypeHelper::FindMapEntry(message_type, field) : nullptr;
+            slot.stride = entry ? Compute(*entry, {}).size : GetElementSize(field);
+        } else {
+            slot.size = GetElementSize(field);
+        }
+
+        if (GetStorageType(field) != FieldDescriptorProto::TYPE_MESSAGE &&
+            std::find(presence_fields.begin(), presence_fields.end(), &field) != presence_fields.end()) {
+            slot.presence_bit = presence_count++;
+        }
+    }
+
+    // Largest slots first so every slot stays naturally aligned
+    uint32_t offset = 0;
+    for (FlatFieldLayout& slot : layout.fields) {
+        if (slot.size == 8) {
+            slot.offset = offset;
+            offset += 8;
+        }
+    }
+
+    layout.presence_offset = offset;
+    offset += static_cast<uint32_t>((presence_count + 31) / 32) * 4;
+
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        bool has_slot = false;
+        for (FlatFieldLayout& slot : layout.fields) {
+            const FieldDescriptorProto& field = *slot.field;
+            if (field.has_oneof_index() && field.oneof_index() == oneof_index && !field.proto3_optional()) {
+                slot.oneof_offset = static_cast<int32_t>(offset);
+                has_slot = true;
+            }
+        }
+        if (has_slot) offset += 4;
+    }
+
+    for (uint32_t size : {4u, 1u}) {
+        for (FlatFieldLayout& slot : layout.fields) {
+            if (slot.size == size) {
+                slot.offset = offset;
+                offset += size;
+            }
+        }
+    }
+    layout.size = AlignTo(offset, 8);
+
+    // Fingerprint shared by the generated readers and the packer
+    std::string text = message_type.name() + ":" + std::to_string(layout.size);
+    for (const FlatFieldLayout& slot : layout.fields) {
+        const FieldDescriptorProto& field = *slot.field;
+        text += ";" + field.name() + ":" + std::to_string(field.type()) + ":" +
+            std::to_string(field.label()) + ":" + field.type_name() + ":" +
+            std::to_string(slot.offset) + ":" + std::to_string(slot.stride) + ":" +
+            std::to_string(slot.presence_bit) + ":" + std::to_string(slot.oneof_offset);
+    }
+    layout.hash = HashLayout(text);
+    return layout;
+}
+
+}  // namespace protoc_js_gen_plugin
@@ -0,0 +1,150 @@
+#include "generator_options.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace protoc_js_gen_plugin {
+
+namespace {
+
+// Split parameter into (key, value) pairs, value is empty for flags
+std::vector<std::pair<std::string, std::string>> SplitParameter(const std::string& parameter) {
+    std::vector<std::pair<std::string, std::string>> result;
+    size_t start = 0;
+    while (start <= parameter.size()) {
+        size_t end = parameter.find(',', start);
+        if (end == std::string::npos) end = parameter.size();
+
+        std::string item = parameter.substr(start, end - start);
+        if (!item.empty()) {
+            size_t eq_pos = item.find('=');
+            if (eq_pos == std::string::npos) {
+                result.emplace_back(item, "");
+            } else {
+                result.emplace_back(item.substr(0, eq_pos), item.substr(eq_pos + 1));
+            }
+        }
+        start = end + 1;
+    }
+    return result;
+}
+
+// Parse a strictly positive decimal integer
+bool ParsePositiveInt(const std::string& text, int* result) {
+    if (text.empty() || text.size() > 9) return false;
+    int value = 0;
+    for (char c : text) {
+        if (c < '0' || c > '9') return false;
+        value = value * 10 + (c - '0');
+    }
+    if (value <= 0) return false;
+    *result = value;
+    return true;
+}
+
+// Parse a directory prefix, which gets a trailing separator
+bool ParseDirectory(const std::string& text, std::string* result) {
+    if (text.empty()) return false;
+    *result = text;
+    if (text.back() != '/' && text.back() != '\\') {
+        *result += '/';
+    }
+    return true;
+}
+
+}  // namespace
+
+bool GeneratorOptions::Parse(
+    const std::string& parameter,
+    GeneratorOptions* options,
+    std::string* error) {
+
+    for (const auto& [key, value] : SplitParameter(parameter)) {
+        if (key == "enum_inline") {
+            options->enum_inline = true;
+        } else if (key == "dirty_tracking") {
+            options->dirty_tracking = true;
+        } else if (key == "intern_strings") {
+            options->intern_strings = true;
+        } else if (key == "columnar") {
+            options->columnar = true;
+        } else if (key == "validate") {
+            options->validate = true;
+        } else if (key == "embed_descriptors") {
+            options->embed_descriptors = true;
+        } else if (key == "registry") {
+            options->registry = true;
+            if (!value.empty()) {
+                if (value.size() < 5 || value.compare(value.size() - 4, 4, ".mjs") != 0) {
+                    *error = "Invalid registry file name: " + value;
+                    return false;
+                }
+                options->registry_file = value;
+            }
+        } else if (key == "framing") {
+            options->framing = true;
+        } else if (key == "client") {
+            options->client = true;
+            options->framing = true;
+        } else if (key == "manifest") {
+            options->manifest = true;
+            if (!value.empty()) {
+                if (value.size() < 6 || value.compare(value.size() - 5, 5, ".json") != 0) {
+                    *error = "Invalid manifest file name: " + value;
+                    return false;
+                }
+                options->manifest_file = value;
+            }
+        } else if (key == "manifest_root") {
+            if (!ParseDirectory(value, &options->manifest_root)) {
+                *error = "Missing manifest_root directory";
+                return false;
+            }
+        } else if (key == "output_root") {
+            if (!ParseDirectory(value, &options->output_root)) {
+                *error = "Missing output_root directory";
+                return false;
+            }
+        } else if (key == "lazy") {
+            options->lazy = true;
+        } else if (key == "passthrough") {
+            options->passthrough = true;
+        } else if (key == "parallel") {
+            options->parallel = true;
+        } else if (key == "flat") {
+            options->flat = true;
+        } else if (key == "timestamp") {
+            if (value != "date" && value != "number") {
+                *error = "Invalid timestamp representation: " + value;
+                return false;
+            }
+            options->timestamp_number = value == "number";
+        } else if (key == "int64") {
+            if (value == "number") {
+                options->int64 = Int64Mode::kNumber;
+            } else if (value == "bigint") {
+                options->int64 = Int64Mode::kBigInt;
+            } else if (value == "string") {
+                options->int64 = Int64Mode::kString;
+            } else if (value == "hybrid") {
+                options->int64 = Int64Mode::kHybrid;
+            } else {
+                *error = "Invalid int64 representation: " + value;
+                return false;
+            }
+        } else if (key == "pool") {
+            options->pool = true;
+            if (!value.empty() && !ParsePositiveInt(value, &options->pool_size)) {
+                *error = "Invalid pool size: " + value;
+                return false;
+            }
+        } else {
+            *error = "Unknown option: " + key;
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace protoc_js_gen_plugin
@@ -0,0 +1,123 @@
+#include "import_planner.h"
+
+#include <cctype>
+#include <string>
+#include <vector>
+
+namespace protoc_js_gen_plugin {
+
+namespace {
+
+// Path segment without its extension
+std::string StripExtension(const std::string& segment) {
+    size_t dot_pos = segment.find_last_of('.');
+    return dot_pos == std::string::npos ? segment : segment.substr(0, dot_pos);
+}
+
+// Path segment as an identifier part: invalid characters replaced by '_',
+// first letter uppercased
+std::string ToAliasPart(const std::string& segment) {
+    std::string part;
+    part.reserve(segment.size());
+    for (char c : segment) {
+        part += std::isalnum(static_cast<unsigned char>(c)) || c == '_' ? c : '_';
+    }
+    if (!part.empty() && std::islower(static_cast<unsigned char>(part[0]))) {
+        part[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(part[0])));
+    }
+    return part;
+}
+
+}  // namespace
+
+const std::vector<std::string>& ImportPlanner::GetSegments(const std::string& path) {
+    auto it = segments_.find(path);
+    if (it != segments_.end()) {
+        return it->second;
+    }
+
+    std::vector<std::string> segments;
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find_first_of("/\\", start);
+        if (end == std::string::npos) end = path.size();
+        std::string segment = path.substr(start, end - start);
+        if (segment == "..") {
+            if (!segments.empty() && segments.back() != "..") {
+                segments.pop_back();
+            } else {
+                segments.push_back(segment);
+            }
+        } else if (!segment.empty() && segment != ".") {
+            segments.push_back(std::move(segment));
+        }
+        start = end + 1;
+    }
+    return segments_.emplace(path, std::move(segments)).first->second;
+}
+
+const std::string& ImportPlanner::GetImportPath(const std::string& from, const std::string& to) {
+    auto key = std::make_pair(from, to);
+    auto it = import_paths_.find(key);
+    if (it != import_paths_.end()) {
+        return it->second;
+    }
+
+    const std::vector<std::string>& from_segments = GetSegments(from);
+    const std::vector<std::string>& to_segments = GetSegments(to);
+
+    // Directory of the importing module against the imported module
+    size_t from_dir_size = from_segments.empty() ? 0 : from_segments.size() - 1;
+    size_t to_dir_size = to_segments.empty() ? 0 : to_segments.size() - 1;
+    size_t common = 0;
+    while (common < from_dir_size && common < to_dir_size &&
+           from_segments[common] == to_segments[common]) {
+        ++common;
+    }
+
+    std::string import_path;
+    if (common == from_dir_size) {
+        import_path = "./";
+    }
+    for (size_t i = common; i < from_dir_size; ++i) {
+        import_path += "../";
+    }
+    for (size_t i = common; i < to_dir_size; ++i) {
+        import_path += to_segments[i] + "/";
+    }
+    if (!to_segments.empty()) {
+        import_path += StripExtension(to_segments.back()) + ".mjs";
+    }
+    return import_paths_.emplace(std::move(key), std::move(import_path)).first->second;
+}
+
+const std::string& ImportPlanner::GetAlias(const std::string& proto_file) {
+    auto it = aliases_.find(proto_file);
+    if (it != aliases_.end()) {
+        return it->second;
+    }
+
+    // PascalCase segments of the path without extension, parent references skipped
+    const std::vector<std::string>& segments = GetSegments(proto_file);
+    std::string alias;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (segments[i] == "..") continue;
+        alias += ToAliasPart(i + 1 == segments.size() ? StripExtension(segments[i]) : segments[i]);
+    }
+
+    // Ensure alias starts with a letter
+    if (alias.empty() || !std::isalpha(static_cast<unsigned char>(alias[0]))) {
+        alias = "Import" + alias;
+    }
+    alias = "__" + alias;
+
+    // Ensure alias is unique across the request
+    std::string unique_alias = alias;
+    for (int counter = 1; used_aliases_.count(unique_alias) != 0; ++counter) {
+        unique_alias = alias + std::to_string(counter);
+    }
+    used_aliases_.insert(unique_alias);
+    return aliases_.emplace(proto_file, std::move(unique_alias)).first->second;
+}
+
+}  // namespace protoc_js_gen_plugin
@@ -1,17 +1,20 @@
 #include "js_code_generator.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cctype>
+#include <cstdio>
 #include <functional>
 #include <memory>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
-#include <filesystem>
 
+#include "flat_layout.h"
 #include "google/protobuf/descriptor.pb.h"
+#include "google/protobuf/unknown_field_set.h"
+#include "schema.h"
 #include "type_helper.h"
 #include "type_resolver.h"
 #include "string_extensions.h"
@@ -24,289 +27,348 @@ using google::protobuf::EnumDescriptorProto;
 using google::protobuf::FieldDescriptorProto;
 using google::protobuf::FileDescriptorProto;
 
-// Helper to replace extension
-std::string ChangeExtension(const std::string& path, const std::string& new_ext) {
-    size_t dot_pos = path.find_last_of('.');
-    if (dot_pos == std::string::npos) return path + new_ext;
-    return path.substr(0, dot_pos) + new_ext;
+// Helper to check if a field belongs to a real (non-synthetic) oneof
+bool IsRealOneofField(const FieldDescriptorProto& field) {
+    return field.has_oneof_index() && field.oneof_index() >= 0 && !field.proto3_optional();
 }
 
-// Helper to get filename without extension
-std::string GetFileNameWithoutExtension(const std::string& path) {
-    size_t slash_pos = path.find_last_of("/\\");
-    size_t dot_pos = path.find_last_of('.');
-
-    std::string filename = (slash_pos == std::string::npos) ?
-        path : path.substr(slash_pos + 1);
-
-    if (dot_pos != std::string::npos && dot_pos > (slash_pos == std::string::npos ? 0 : slash_pos + 1)) {
-        filename = filename.substr(0, dot_pos - (slash_pos == std::string::npos ? 0 : slash_pos + 1));
+// Helper to check if a message declares any real oneof
+bool HasRealOneof(const DescriptorProto& message_type) {
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsRealOneofField(field)) return true;
     }
-
-    return filename;
+    return false;
 }
 
-// Helper to compute relative path from current file to target file
-std::string GetRelativePath(const std::string& from, const std::string& to) {
-    // Use std::filesystem
-    std::filesystem::path from_path(from);
-    std::filesystem::path to_path(to);
-    std::filesystem::path relative = std::filesystem::relative(to_path, from_path.parent_path());
-    return relative.generic_string();
+// Helper to check if a oneof has real (non-synthetic) members
+bool HasRealOneofMembers(const DescriptorProto& message_type, int oneof_index) {
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsRealOneofField(field) && field.oneof_index() == oneof_index) return true;
+    }
+    return false;
 }
 
-}  // namespace
-
-JsCodeGenerator::JsCodeGenerator(
-    const FileDescriptorProto& proto_file,
-    const TypeResolver& type_resolver)
-    : proto_file_(proto_file),
-    type_resolver_(type_resolver) {
+// Helper to get the UPPER_SNAKE_CASE constant name of a field
+std::string GetCaseConstantName(const std::string& field_name) {
+    std::string result;
+    for (size_t i = 0; i < field_name.size(); ++i) {
+        char c = field_name[i];
+        if (std::isupper(static_cast<unsigned char>(c)) && i > 0 &&
+            std::islower(static_cast<unsigned char>(field_name[i - 1]))) {
+            result += '_';
+        }
+        result += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return result;
 }
 
-std::string JsCodeGenerator::Generate() {
-    // Clear state for multiple calls
-    output_.str("");
-    output_.clear();
-    generated_nested_classes_.clear();
-    referenced_external_types_.clear();
-    import_aliases_.clear();
-
-    // Collect all external type references
-    CollectExternalTypeReferences();
+// Helper to get presence slot property name for a bit index
+std::string GetPresenceSlotName(int bit) {
+    return "__has" + std::to_string(bit / 32);
+}
 
-    // Generate file header
-    output_ << "// Generated by protoc-gen-js-mjs\n";
-    output_ << "// Source: " << proto_file_.name() << "\n\n";
+// Helper to get the int32 mask literal for a bit index within its slot
+std::string GetBitMask(int bit) {
+    return std::to_string(static_cast<int32_t>(static_cast<uint32_t>(1) << (bit % 32)));
+}
 
-    if (!proto_file_.package().empty()) {
-        output_ << "// Package: " << proto_file_.package() << "\n\n";
+// Helper to encode binary data as standard base64
+std::string Base64Encode(const std::string& data) {
+    static const char kAlphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string result;
+    result.reserve((data.size() + 2) / 3 * 4);
+    size_t i = 0;
+    for (; i + 2 < data.size(); i += 3) {
+        uint32_t chunk = (static_cast<uint8_t>(data[i]) << 16) |
+            (static_cast<uint8_t>(data[i + 1]) << 8) | static_cast<uint8_t>(data[i + 2]);
+        result += kAlphabet[(chunk >> 18) & 63];
+        result += kAlphabet[(chunk >> 12) & 63];
+        result += kAlphabet[(chunk >> 6) & 63];
+        result += kAlphabet[chunk & 63];
     }
+    if (i < data.size()) {
+        uint32_t chunk = static_cast<uint8_t>(data[i]) << 16;
+        if (i + 1 < data.size()) chunk |= static_cast<uint8_t>(data[i + 1]) << 8;
+        result += kAlphabet[(chunk >> 18) & 63];
+        result += kAlphabet[(chunk >> 12) & 63];
+        result += i + 1 < data.size() ? kAlphabet[(chunk >> 6) & 63] : '=';
+        result += '=';
+    }
+    return result;
+}
 
-    // Generate import statements
-    GenerateImports();
-
-    // Set up type name transformer
-    TypeHelper::TypeNameTransformer old_transformer = TypeHelper::GetTypeNameTransformer();
-    TypeHelper::SetTypeNameTransformer([this](const std::string& type_name,
-        const FileDescriptorProto& file) {
-            return this->TransformTypeName(type_name, file);
-        });
-
-    try {
-        // Generate enums
-        for (const EnumDescriptorProto& enum_type : proto_file_.enum_type()) {
-            GenerateEnum(enum_type);
-        }
-
-        // Generate messages
-        for (const DescriptorProto& message_type : proto_file_.message_type()) {
-            GenerateMessage(message_type, "", proto_file_.package());
+// Helper to read a varint option set through an extension the plugin
+// was not compiled with (it is kept in the options' unknown fields)
+bool GetUnknownVarint(const google::protobuf::Message& options, int number, uint64_t* value) {
+    const google::protobuf::UnknownFieldSet& unknown_fields =
+        options.GetReflection()->GetUnknownFields(options);
+    for (int i = 0; i < unknown_fields.field_count(); ++i) {
+        const google::protobuf::UnknownField& field = unknown_fields.field(i);
+        if (field.number() == number && field.type() == google::protobuf::UnknownField::TYPE_VARINT) {
+            *value = field.varint();
+            return true;
         }
     }
-    catch (...) {
-        // Restore transformer on exception
-        TypeHelper::SetTypeNameTransformer(old_transformer);
-        throw;
+    return false;
+}
+
+// Helper to get the index of a field in its message's field list, which is
+// also its index in the descriptor's fields array
+int GetFieldIndex(const DescriptorProto& message_type, const FieldDescriptorProto& field) {
+    int index = 0;
+    while (index < message_type.field_size() && &message_type.field(index) != &field) {
+        ++index;
     }
+    return index;
+}
 
-    // Restore transformer
-    TypeHelper::SetTypeNameTransformer(old_transformer);
+// Helper to check for fields holding generated message instances; the
+// well-known types are decoded to plain JavaScript values instead
+bool IsMessageField(const FieldDescriptorProto& field) {
+    return field.type() == FieldDescriptorProto::TYPE_MESSAGE &&
+        TypeHelper::GetWellKnownType(field).empty();
+}
 
-    return output_.str();
+// Helper to get the generated decoder of a well-known type's JSON form,
+// empty when the JSON value is used as is
+std::string GetWellKnownDecoder(const FieldDescriptorProto& field) {
+    std::string well_known_type = TypeHelper::GetWellKnownType(field);
+    if (well_known_type == "Timestamp" || well_known_type == "Duration" || well_known_type == "FieldMask") {
+        return "__decode" + well_known_type;
+    }
+    return "";
 }
 
-void JsCodeGenerator::CollectExternalTypeReferences() {
-    // Collect type references from messages
-    for (const DescriptorProto& message_type : proto_file_.message_type()) {
-        CollectMessageTypeReferences(message_type);
+// Helper to get the name of a 64-bit integer representation, as given to
+// the int64 option and written to field descriptors
+const char* GetInt64ModeName(Int64Mode mode) {
+    switch (mode) {
+        case Int64Mode::kBigInt: return "bigint";
+        case Int64Mode::kString: return "string";
+        case Int64Mode::kHybrid: return "hybrid";
+        case Int64Mode::kNumber: break;
     }
+    return "number";
 }
 
-void JsCodeGenerator::CollectMessageTypeReferences(
-    const DescriptorProto& message_type) {
+// Value helper kinds used by clone/equals/hashCode
+struct ValueHelpers {
+    std::string equals;  // empty for strict equality
+    std::string hash;
+    std::string clone;   // empty for plain assignment
+};
+
+ValueHelpers GetValueHelpers(const FieldDescriptorProto& field, const GeneratorOptions& options) {
+    // Well-known types compare as the plain values they are decoded to
+    std::string well_known_type = TypeHelper::GetWellKnownType(field);
+    FieldDescriptorProto::Type type = field.type();
+    if (well_known_type == "Timestamp" && !options.timestamp_number) {
+        return {"__equalsDate", "__hashDate", "__cloneDate"};
+    } else if (well_known_type == "Timestamp" || well_known_type == "Duration") {
+        type = FieldDescriptorProto::TYPE_DOUBLE;
+    } else if (!well_known_type.empty()) {
+        type = TypeHelper::GetWrappedType(well_known_type);
+        if (type == FieldDescriptorProto::TYPE_MESSAGE) {
+            return {"__equalsJson", "__hashJson", "__cloneJson"};
+        }
+    }
 
-    // Process fields
-    for (const FieldDescriptorProto& field : message_type.field()) {
-        if (field.type() == FieldDescriptorProto::TYPE_MESSAGE ||
-            field.type() == FieldDescriptorProto::TYPE_ENUM) {
-            RecordTypeReference(field.type_name());
+    // 64-bit integers hash by their representation, equal values share one
+    if (well_known_type.empty() && TypeHelper::IsInt64Type(type)) {
+        switch (options.int64) {
+            case Int64Mode::kBigInt:
+                return {"", "__hashBigInt", ""};
+            case Int64Mode::kString:
+                return {"", "__hashString", ""};
+            case Int64Mode::kHybrid:
+                return {"", "__hashInt64", ""};
+            case Int64Mode::kNumber:
+                break;
         }
     }
 
-    // Recursively process nested messages
-    for (const DescriptorProto& nested_message : message_type.nested_type()) {
-        CollectMessageTypeReferences(nested_message);
+    switch (type) {
+        case FieldDescriptorProto::TYPE_MESSAGE:
+            return {"__equalsMessage", "__hashMessage", "__cloneMessage"};
+        case FieldDescriptorProto::TYPE_BYTES:
+            return {"__equalsBytes", "__hashBytes", "__cloneBytes"};
+        case FieldDescriptorProto::TYPE_STRING:
+            return {"", "__hashString", ""};
+        case FieldDescriptorProto::TYPE_BOOL:
+            return {"", "__hashBool", ""};
+        default:
+            return {"", "__hashNumber", ""};
     }
 }
 
-void JsCodeGenerator::GenerateImports() {
-    std::vector<std::string> referenced_types(
-        referenced_external_types_.begin(), referenced_external_types_.end());
+// Presizing hint for the output buffer from the number of messages, fields
+// and enum values; each option that adds per-type code raises the weights.
+// Measured on test/proto, the writer still grows past it when needed.
+struct OutputSizeWeights {
+    size_t per_message;
+    size_t per_field;
+};
 
-    auto imports = type_resolver_.GetRequiredImports(referenced_types);
-    if (imports.empty()) return;
+size_t EstimateEnumSize(const EnumDescriptorProto& enum_type) {
+    return 512 + 96 * static_cast<size_t>(enum_type.value_size());
+}
 
-    // Group imports by proto file
-    std::unordered_map<std::string, std::vector<std::string>> imports_by_file;
-    for (const auto& import : imports) {
-        imports_by_file[import.first].push_back(import.second);
+size_t EstimateMessageSize(const DescriptorProto& message_type, const OutputSizeWeights& weights) {
+    size_t size = weights.per_message + weights.per_field * static_cast<size_t>(message_type.field_size());
+    for (const DescriptorProto& nested_message : message_type.nested_type()) {
+        size += EstimateMessageSize(nested_message, weights);
     }
-
-    // Remove duplicates within each file
-    for (auto& entry : imports_by_file) {
-        std::sort(entry.second.begin(), entry.second.end());
-        entry.second.erase(std::unique(entry.second.begin(), entry.second.end()),
-            entry.second.end());
+    for (const EnumDescriptorProto& nested_enum : message_type.enum_type()) {
+        size += EstimateEnumSize(nested_enum);
     }
+    return size;
+}
 
-    // Generate import statements
-    ImportAliasMap import_aliases;
-    for (const auto& entry : imports_by_file) {
-        const std::string& proto_file = entry.first;
-        const std::vector<std::string>& type_names = entry.second;
-
-        std::string import_path = GetImportPath(proto_file);
-        std::string alias = GenerateImportAlias(proto_file);
-
-        // Ensure alias is unique
-        int counter = 1;
-        std::string original_alias = alias;
-        while (import_aliases.find(alias) != import_aliases.end()) {
-            alias = original_alias + std::to_string(counter);
-            ++counter;
-        }
-
-        import_aliases[proto_file] = alias;
-
-        // Generate import * as statement
-        output_ << "import * as " << alias << " from '" << import_path << "';\n";
+size_t EstimateOutputSize(const FileDescriptorProto& proto_file, const GeneratorOptions& options) {
+    size_t enabled = 0;
+    for (bool option : {options.pool, options.dirty_tracking, options.validate,
+                        options.flat, options.columnar, options.lazy}) {
+        enabled += option ? 1 : 0;
     }
+    OutputSizeWeights weights = {2048 + 640 * enabled, 640 + 160 * enabled};
 
-    output_ << "\n";
-    import_aliases_ = std::move(import_aliases);
-}
-
-std::string JsCodeGenerator::GetImportPath(const std::string& proto_file_path) const {
-    // Get current proto file path
-    std::string current_file = proto_file_.name();
-    // Compute relative path from current file's directory to target file
-    std::string relative_path = GetRelativePath(current_file, proto_file_path);
-    // Change .proto extension to .mjs
-    std::string mjs_path = ChangeExtension(relative_path, ".mjs");
-    // Ensure forward slashes (already done by generic_string)
-    // Add "./" prefix if not already a relative path starting with "./" or "../"
-    if (mjs_path.find("./") != 0 && mjs_path.find("../") != 0) {
-        mjs_path = "./" + mjs_path;
+    size_t size = 1024;
+    if (proto_file.message_type_size() > 0) {
+        // Module-private helpers
+        size += 4096 + 2048 * enabled;
+    }
+    for (const DescriptorProto& message_type : proto_file.message_type()) {
+        size += EstimateMessageSize(message_type, weights);
     }
-    return mjs_path;
+    for (const EnumDescriptorProto& enum_type : proto_file.enum_type()) {
+        size += EstimateEnumSize(enum_type);
+    }
+    return size;
 }
 
-std::string JsCodeGenerator::GenerateImportAlias(const std::string& proto_file_path) const {
-    // Remove extension
-    std::string file_name = GetFileNameWithoutExtension(proto_file_path);
+}  // namespace
 
-    // Remove leading "./" or "../"
-    std::string path = proto_file_path;
-    std::replace(path.begin(), path.end(), '\\', '/');
+JsCodeGenerator::JsCodeGenerator(
+    const FileSchema& file,
+    const TypeResolver& type_resolver,
+    const GeneratorOptions& options)
+    : file_(file),
+    proto_file_(*file.proto),
+    type_resolver_(type_resolver),
+    options_(options),
+    intern_extension_number_(
+        type_resolver.FindExtensionNumber(".google.protobuf.FieldOptions", "intern")),
+    message_id_extensions_(
+        type_resolver.FindExtensions(".google.protobuf.MessageOptions", "message_id")),
+    module_id_extension_number_(
+        type_resolver.FindExtensionNumber(".google.protobuf.EnumOptions", "module_id")) {
+}
 
-    if (path.find("./") == 0) {
-        path = path.substr(2);
-    }
-    else if (path.find("../") == 0) {
-        path = path.substr(3);
-    }
+std::string JsCodeGenerator::Generate() {
+    // Clear state for multiple calls
+    output_.Reset(EstimateOutputSize(proto_file_, options_));
 
-    // Remove extension
-    path = ChangeExtension(path, "");
+    // Generate file header
+    output_ << "// Generated by protoc-gen-js-mjs\n";
+    output_ << "// Source: " << proto_file_.name() << "\n\n";
 
-    // Split path parts
-    std::vector<std::string> parts;
-    std::stringstream ss(path);
-    std::string part;
-    while (std::getline(ss, part, '/')) {
-        parts.push_back(part);
+    if (!proto_file_.package().empty()) {
+        output_ << "// Package: " << proto_file_.package() << "\n\n";
     }
 
-    // Convert each part to PascalCase
-    for (std::string& part : parts) {
-        if (part.empty()) continue;
+    // Generate import statements
+    GenerateImports();
 
-        // Remove invalid characters, keep only alphanumeric and underscore
-        std::string cleaned;
-        for (char c : part) {
-            if (std::isalnum(static_cast<unsigned char>(c)) || c == '_') {
-                cleaned += c;
-            }
-            else {
-                cleaned += '_';
-            }
+    // Generate helpers used by clone/equals/hashCode
+    if (proto_file_.message_type_size() > 0) {
+        GenerateValueHelpers();
+        if (file_.uses_well_known_types) {
+            GenerateWellKnownTypeHelpers();
         }
-
-        if (cleaned.empty()) {
-            cleaned = "Part";
+        if (file_.uses_int64 && options_.int64 != Int64Mode::kNumber) {
+            GenerateInt64Helpers();
         }
-
-        // Ensure first character is uppercase
-        if (!cleaned.empty() && std::islower(static_cast<unsigned char>(cleaned[0]))) {
-            cleaned[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(cleaned[0])));
+        if (options_.validate) {
+            GenerateValidationHelpers();
+        }
+        if (options_.passthrough) {
+            GeneratePassthroughHelpers();
+        }
+        if (options_.flat) {
+            GenerateFlatHelpers();
         }
+        if (options_.columnar) {
+            GenerateColumnHelpers();
+        }
+    }
 
-        part = cleaned;
+    // Generate enums
+    for (const EnumDescriptorProto& enum_type : proto_file_.enum_type()) {
+        GenerateEnum(enum_type, proto_file_.package());
     }
 
-    // Combine all parts
-    std::string alias;
-    for (const std::string& part : parts) {
-        if (!part.empty()) {
-            alias += part;
-        }
+    // Generate messages
+    for (const DescriptorProto& message_type : proto_file_.message_type()) {
+        GenerateMessage(message_type, proto_file_.package());
     }
 
-    // Add prefix if alias is empty or starts with underscore
-    if (alias.empty() || alias[0] == '_') {
-        alias = "Import" + alias;
+    // Client stub over the module's message ids
+    if (options_.client) {
+        GenerateClient();
     }
 
-    // Ensure alias starts with a letter
-    if (!alias.empty() && !std::isalpha(static_cast<unsigned char>(alias[0]))) {
-        alias = "Import" + alias;
+    // Embed the schema for runtime reflection
+    if (options_.embed_descriptors) {
+        GenerateFileDescriptor();
     }
 
-    return "__" + alias;
+    return output_.Release();
 }
 
-std::string JsCodeGenerator::TransformTypeName(
-    const std::string& type_name,
-    const FileDescriptorProto& proto_file) {
-
-    // Only process if the file matches
-    if (proto_file.name() != proto_file_.name()) {
-        return "";
-    }
+void JsCodeGenerator::GenerateImports() {
+    if (file_.imports.empty()) return;
 
-    auto external_info = type_resolver_.GetExternalTypeInfo(type_name);
-    if (external_info && !external_info->first.empty()) {
-        auto it = import_aliases_.find(external_info->first);
-        if (it != import_aliases_.end()) {
-            // External type, use alias
-            return it->second + "." + external_info->second;
-        }
+    for (const ImportSchema& import : file_.imports) {
+        output_ << "import * as " << import.alias << " from '" << import.module_path << "';\n";
     }
-
-    // Return empty string to let TypeHelper use default logic
-    return "";
+    output_ << "\n";
 }
 
-void JsCodeGenerator::RecordTypeReference(const std::string& type_name) {
-    if (!type_name.empty()) {
-        referenced_external_types_.insert(type_name);
+void JsCodeGenerator::GenerateFileDescriptor() {
+    // Source comments are only attached to the files being generated and are
+    // not needed for reflection
+    FileDescriptorProto file = proto_file_;
+    file.clear_source_code_info();
+    std::string data;
+    file.SerializeToString(&data);
+
+    output_ << "// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs\n";
+    output_ << "export const __fileDescriptor = {\n";
+    output_ << "    name: \"" << proto_file_.name() << "\",\n";
+    output_ << "    dependencies: [";
+    for (int i = 0; i < proto_file_.dependency_size(); ++i) {
+        output_ << (i == 0 ? "" : ", ") << "\"" << proto_file_.dependency(i) << "\"";
     }
+    output_ << "],\n";
+    output_ << "    data: \"" << Base64Encode(data) << "\",\n";
+    output_ << "};\n";
 }
 
-void JsCodeGenerator::GenerateEnum(const EnumDescriptorProto& enum_type) {
-    output_ << "// Enum: " << enum_type.name() << "\n";
-    output_ << "export const " << enum_type.name() << " = {\n";
+void JsCodeGenerator::GenerateEnum(
+    const EnumDescriptorProto& enum_type,
+    const std::string& parent_full_name) {
+
+    // Nested enums are module-level constants under their independent name,
+    // exposed as static members of the enclosing class
+    bool is_top_level = parent_full_name == proto_file_.package();
+    std::string full_name = parent_full_name.empty() ?
+        enum_type.name() : parent_full_name + "." + enum_type.name();
+    std::string enum_name = is_top_level ?
+        enum_type.name() : TypeHelper::GetIndependentClassName(full_name, &proto_file_);
+
+    output_ << "// Enum: " << enum_name << "\n";
+    output_ << (is_top_level ? "export const " : "const ") << enum_name << " = {\n";
 
     for (const auto& value : enum_type.value()) {
         std::string value_name = StripEnumValuePrefix(enum_type.name(), value.name());
@@ -316,18 +378,16 @@ void JsCodeGenerator::GenerateEnum(const EnumDescriptorProto& enum_type) {
     output_ << "};\n";
 
     // Generate __descriptor for enum
-    std::string full_name = enum_type.name();
-    if (!proto_file_.package().empty()) {
-        full_name = proto_file_.package() + "." + full_name;
-    }
-
-    output_ << "Object.defineProperty(" << enum_type.name() << ", \"__descriptor\", {\n";
+    output_ << "Object.defineProperty(" << enum_name << ", \"__descriptor\", {\n";
     output_ << "    value: {\n";
     output_ << "        name: \"" << enum_type.name() << "\",\n";
-    output_ << "        get clrType() { return " << enum_type.name() << "; },\n";
+    output_ << "        get clrType() { return " << enum_name << "; },\n";
     output_ << "        fullName: \"" << full_name << "\",\n";
-    if (!proto_file_.package().empty()) {
-        output_ << "        package: \"" << proto_file_.package() << "\",\n";
+    if (is_top_level && !parent_full_name.empty()) {
+        output_ << "        package: \"" << parent_full_name << "\",\n";
+    }
+    if (options_.embed_descriptors) {
+        output_ << "        get file() { return __fileDescriptor; },\n";
     }
 
     // Enum values
@@ -348,140 +408,55 @@ void JsCodeGenerator::GenerateEnum(const EnumDescriptorProto& enum_type) {
     } else {
         output_ << "]";
     }
+    output_ << ",\n";
+    GenerateEnumValueIndex(enum_type);
     output_ << "\n    },\n";
     output_ << "    enumerable: false,\n";
     output_ << "    writable: false,\n";
     output_ << "});\n";
 
-    output_ << "Object.freeze(" << enum_type.name() << ");\n\n";
+    output_ << "Object.freeze(" << enum_name << ");\n\n";
 }
 
-void JsCodeGenerator::GenerateMessage(
+std::string JsCodeGenerator::GenerateMessage(
     const DescriptorProto& message_type,
-    const std::string& indent,
     const std::string& parent_full_name) {
 
-    std::string class_name = message_type.name();
+    // Nested messages are module-level classes under their independent name,
+    // exposed as static members of the enclosing class
+    bool is_top_level = parent_full_name == proto_file_.package();
     std::string full_name = parent_full_name.empty() ?
-        class_name : parent_full_name + "." + class_name;
-    bool is_top_level = indent.empty();
-
-    if (!is_top_level) {
-        // Nested messages shouldn't be generated by this method
-        return;
-    }
-
-    // First generate independent class definitions for all nested messages
-    std::unordered_map<const DescriptorProto*, std::string> nested_independent_class_names;
-    for (const DescriptorProto& nested_message : message_type.nested_type()) {
-        std::string independent_class_name = GenerateNestedMessageClass(nested_message, full_name);
-        nested_independent_class_names[&nested_message] = independent_class_name;
-    }
-
-    // Generate top-level export class
-    output_ << indent << "// Message: " << class_name << "\n";
-    output_ << indent << "export class " << class_name << " {\n";
-
-    // Static descriptor
-    output_ << indent << "    static __descriptor = {\n";
-    output_ << indent << "        name: \"" << class_name << "\",\n";
-    output_ << indent << "        get clrType() { return " << class_name << "; },\n";
-    output_ << indent << "        fullName: \"" << full_name << "\",\n";
-    if (!parent_full_name.empty()) {
-        output_ << indent << "        package: \"" << parent_full_name << "\",\n";
-    }
-
-    // Field descriptors
-    output_ << indent << "        fields: [";
-    if (message_type.field_size() > 0) {
-        output_ << "\n";
-        for (int i = 0; i < message_type.field_size(); ++i) {
-            const FieldDescriptorProto& field = message_type.field(i);
-            std::string camel_case_name = SnakeToCamelCase(field.name());
-            output_ << indent << "            {";
-            output_ << "name: \"" << camel_case_name << "\", ";
-            output_ << "number: " << field.number() << ", ";
-            output_ << "type: \"" << FieldDescriptorProto::Type_Name(field.type()) << "\", ";
-            if (!field.type_name().empty()) {
-                output_ << "typeName: \"" << field.type_name() << "\", ";
-            }
-            // Add clrType field for message and enum types
-            std::string class_ref = GetFieldClassRef(field);
-            if (!class_ref.empty()) {
-                output_ << "get clrType() { return " << class_ref << "; },";
-            }
-            output_ << "label: \"" << FieldDescriptorProto::Label_Name(field.label()) << "\"}";
-            if (i < message_type.field_size() - 1) {
-                output_ << ",\n";
-            }
-            else {
-                output_ << "\n";
-            }
-        }
-        output_ << indent << "        ]";
-    }
-    else {
-        output_ << "]";
-    }
-    output_ << "\n";
-    output_ << indent << "    }\n\n";
-
-    // Generate constructor
-    // output_ << indent << "    constructor() {\n";
-    // for (const FieldDescriptorProto& field : message_type.field()) {
-    //     std::string camel_case_name = SnakeToCamelCase(field.name());
-    //     std::string default_value = TypeHelper::GetJsDefaultValue(field, proto_file_);
-    //     output_ << indent << "        this." << camel_case_name << " = " << default_value << ";\n";
-    // }
-    // output_ << indent << "    }\n\n";
-
-    // Generate getter/setter methods for fields
-    for (const FieldDescriptorProto& field : message_type.field()) {
-        GenerateFieldMethods(field, indent + "    ", class_name);
-    }
+        message_type.name() : parent_full_name + "." + message_type.name();
+    std::string class_name = is_top_level ?
+        message_type.name() : TypeHelper::GetIndependentClassName(full_name, &proto_file_);
+    const std::string& indent = CodeWriter::Indent(1);
 
-    // Add static references to nested messages
+    // Nested types are defined first so the static members below can refer to them
+    std::vector<std::pair<const std::string*, std::string>> nested_class_names;
     for (const DescriptorProto& nested_message : message_type.nested_type()) {
-        auto it = nested_independent_class_names.find(&nested_message);
-        if (it != nested_independent_class_names.end()) {
-            output_ << indent << "    static " << nested_message.name()
-                << " = " << it->second << ";\n";
-        }
+        nested_class_names.emplace_back(&nested_message.name(), GenerateMessage(nested_message, full_name));
     }
-
-    // Generate nested enums
     for (const EnumDescriptorProto& nested_enum : message_type.enum_type()) {
-        output_ << "\n";
-        GenerateNestedEnum(nested_enum, indent + "    ", full_name);
-    }
-
-    output_ << indent << "}\n\n";
-}
-
-std::string JsCodeGenerator::GenerateNestedMessageClass(
-    const DescriptorProto& message_type,
-    const std::string& parent_full_name) {
-
-    std::string class_name = message_type.name();
-    std::string full_name = parent_full_name.empty() ?
-        class_name : parent_full_name + "." + class_name;
-
-    // Check if already generated
-    if (generated_nested_classes_.find(full_name) != generated_nested_classes_.end()) {
-        return TypeHelper::GetIndependentClassName(full_name, &proto_file_);
+        GenerateEnum(nested_enum, full_name);
+        nested_class_names.emplace_back(&nested_enum.name(),
+            TypeHelper::GetIndependentClassName(full_name + "." + nested_enum.name(), &proto_file_));
     }
 
-    generated_nested_classes_.insert(full_name);
-
-    // Generate independent class definition
-    std::string independent_class_name = TypeHelper::GetIndependentClassName(full_name, &proto_file_);
-    output_ << "class " << independent_class_name << " {\n";
+    output_ << "// Message: " << class_name << "\n";
+    output_ << (is_top_level ? "export class " : "class ") << class_name << " {\n";
 
     // Static descriptor
     output_ << "    static __descriptor = {\n";
-    output_ << "        name: \"" << class_name << "\",\n";
-    output_ << "        get clrType() { return " << independent_class_name << "; },\n";
+    output_ << "        name: \"" << message_type.name() << "\",\n";
+    output_ << "        get clrType() { return " << class_name << "; },\n";
     output_ << "        fullName: \"" << full_name << "\",\n";
+    if (is_top_level && !parent_full_name.empty()) {
+        output_ << "        package: \"" << parent_full_name << "\",\n";
+    }
+    if (options_.embed_descriptors) {
+        output_ << "        get file() { return __fileDescriptor; },\n";
+    }
+    GenerateFrameIds(message_type, "");
 
     // Field descriptors
     output_ << "        fields: [";
@@ -502,6 +477,24 @@ std::string JsCodeGenerator::GenerateNestedMessageClass(
             if (!class_ref.empty()) {
                 output_ << "get clrType() { return " << class_ref << "; },";
             }
+            if (IsRealOneofField(field)) {
+                output_ << "oneof: \"" << SnakeToCamelCase(message_type.oneof_decl(field.oneof_index()).name()) << "\", ";
+            }
+            if (IsInternField(field)) {
+                output_ << "intern: true, ";
+            }
+            if (IsLazyField(field)) {
+                output_ << "lazy: true, ";
+            }
+            if (IsInt64Field(field)) {
+                output_ << "int64: \"" << GetInt64ModeName(options_.int64) << "\", ";
+            }
+            if (std::string well_known_type = TypeHelper::GetWellKnownType(field); !well_known_type.empty()) {
+                output_ << "wkt: \"" << well_known_type << "\", ";
+                if (well_known_type == "Timestamp" && options_.timestamp_number) {
+                    output_ << "epochMillis: true, ";
+                }
+            }
             output_ << "label: \"" << FieldDescriptorProto::Label_Name(field.label()) << "\"}";
             if (i < message_type.field_size() - 1) {
                 output_ << ",\n";
@@ -521,170 +514,2615 @@ std::string JsCodeGenerator::GenerateNestedMessageClass(
     // Generate constructor
     output_ << "    constructor() {\n";
     for (const FieldDescriptorProto& field : message_type.field()) {
+        // Oneof members and presence-tracked fields start unset
+        if (IsRealOneofField(field) || GetPresenceBit(field) >= 0) continue;
         std::string camel_case_name = SnakeToCamelCase(field.name());
-        std::string default_value = TypeHelper::GetJsDefaultValue(field, proto_file_);
-        output_ << "        this." << camel_case_name << " = " << default_value << ";\n";
+        std::string default_value = GetFieldDefaultValue(field);
+        // Backing fields of pass-through accessors are set directly
+        bool backed = options_.passthrough && !IsLazyField(field);
+        output_ << "        this." << (backed ? "__" : "") << camel_case_name << " = " << default_value << ";\n";
     }
     output_ << "    }\n\n";
 
+    // Generate presence bitmask slots
+    GeneratePresenceSlots(message_type, indent);
+
+    // Generate oneof discriminants and storage
+    GenerateOneofMembers(message_type, indent, class_name);
+
     // Generate getter/setter methods for fields
     for (const FieldDescriptorProto& field : message_type.field()) {
-        GenerateFieldMethods(field, "    ", independent_class_name);
+        GenerateFieldMethods(message_type, field, indent, class_name);
     }
+    GenerateLazyMethods(message_type, indent);
 
-    // Recursively generate independent class definitions for nested messages
-    for (const DescriptorProto& nested_message : message_type.nested_type()) {
-        std::string nested_independent_class_name =
-            GenerateNestedMessageClass(nested_message, full_name);
-        // Add static reference in current class
-        output_ << "    static " << nested_message.name()
-            << " = " << nested_independent_class_name << ";\n";
-    }
+    // Generate retained source JSON for pass-through
+    GeneratePassthroughMethods(message_type, indent);
 
-    // Generate nested enums
-    for (const EnumDescriptorProto& nested_enum : message_type.enum_type()) {
-        output_ << "\n";
-        GenerateNestedEnum(nested_enum, "    ", full_name);
+    // Generate clone/copyFrom/equals/hashCode
+    GenerateValueMethods(message_type, indent, class_name);
+
+    // Generate clear(), also used when decoding into an existing instance
+    GenerateClearMethod(message_type, indent, class_name);
+
+    // Generate free list methods
+    GeneratePoolMethods(message_type, indent, class_name);
+
+    // Generate delta encoding methods
+    GenerateDeltaMethods(message_type, indent, class_name);
+
+    // Generate JSON encoder
+    GenerateToJson(message_type, indent, class_name);
+
+    // Generate validators for untrusted input
+    GenerateValidationMethods(message_type, indent, class_name);
+
+    // Generate flat blob view
+    GenerateFlatView(message_type, indent, class_name);
+
+    // Generate columnar table
+    GenerateColumns(message_type, indent, class_name);
+
+    // Add static references to nested messages and enums
+    for (const auto& [nested_name, nested_class_name] : nested_class_names) {
+        output_ << "    static " << *nested_name << " = " << nested_class_name << ";\n";
     }
 
     output_ << "}\n\n";
 
-    return independent_class_name;
+    return class_name;
 }
 
-void JsCodeGenerator::GenerateNestedEnum(
-    const EnumDescriptorProto& enum_type,
-    const std::string& indent,
-    const std::string& parent_full_name) {
+void JsCodeGenerator::GenerateEnumValueIndex(const EnumDescriptorProto& enum_type) {
+
+    // Reverse lookup table: enum number -> index into values.
+    // Compact enums get a dense array, sparse ones (e.g. MessageId) a Map.
+    std::vector<std::pair<int, int>> entries;
+    std::unordered_set<int> seen_numbers;
+    int min_number = 0;
+    int max_number = 0;
+    for (int i = 0; i < enum_type.value_size(); ++i) {
+        int number = enum_type.value(i).number();
+        // Aliases resolve to the first declared value
+        if (!seen_numbers.insert(number).second) continue;
+        if (entries.empty() || number < min_number) min_number = number;
+        if (entries.empty() || number > max_number) max_number = number;
+        entries.emplace_back(number, i);
+    }
 
-    output_ << indent << "// Nested enum: " << enum_type.name() << "\n";
-    output_ << indent << "static " << enum_type.name() << " = {\n";
+    bool is_dense = !entries.empty() && min_number >= 0 &&
+        static_cast<int64_t>(max_number) < 2 * static_cast<int64_t>(entries.size());
 
-    for (const auto& value : enum_type.value()) {
-        std::string value_name = StripEnumValuePrefix(enum_type.name(), value.name());
-        output_ << indent << "    " << value_name << ": " << value.number() << ",\n";
+    output_ << "        valueIndex: ";
+    if (is_dense) {
+        std::vector<int> dense(static_cast<size_t>(max_number) + 1, -1);
+        for (const auto& entry : entries) {
+            dense[static_cast<size_t>(entry.first)] = entry.second;
+        }
+        output_ << "[";
+        for (size_t i = 0; i < dense.size(); ++i) {
+            if (i > 0) output_ << ", ";
+            output_ << dense[i];
+        }
+        output_ << "]";
+    } else {
+        output_ << "new Map([";
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (i > 0) output_ << ", ";
+            output_ << "[" << entries[i].first << ", " << entries[i].second << "]";
+        }
+        output_ << "])";
     }
+}
 
-    output_ << indent << "};\n";
+std::vector<const FieldDescriptorProto*> JsCodeGenerator::GetPresenceFields(
+    const DescriptorProto& message_type) const {
 
-    // Generate __descriptor for nested enum
-    std::string full_name = enum_type.name();
-    if (!parent_full_name.empty()) {
-        full_name = parent_full_name + "." + full_name;
+    // In bit order, as the schema assigned them
+    std::vector<const FieldDescriptorProto*> fields;
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        int bit = GetPresenceBit(field);
+        if (bit < 0) continue;
+        if (fields.size() <= static_cast<size_t>(bit)) {
+            fields.resize(static_cast<size_t>(bit) + 1);
+        }
+        fields[static_cast<size_t>(bit)] = &field;
     }
+    return fields;
+}
 
-    output_ << indent << "Object.defineProperty(" << enum_type.name() << ", \"__descriptor\", {\n";
-    output_ << indent << "    value: {\n";
-    output_ << indent << "        name: \"" << enum_type.name() << "\",\n";
-    output_ << indent << "        get clrType() { return " << enum_type.name() << "; },\n";
-    output_ << indent << "        fullName: \"" << full_name << "\",\n";
-    if (!parent_full_name.empty()) {
-        output_ << indent << "        package: \"" << parent_full_name << "\",\n";
-    }
+int JsCodeGenerator::GetPresenceBit(const FieldDescriptorProto& field) const {
+    // Assigned once per message by the schema, which covers every field
+    // generated from this file
+    const FieldSchema* schema = file_.FindField(field);
+    assert(schema != nullptr && "field missing from the file's schema");
+    return schema != nullptr ? schema->presence_bit : -1;
+}
 
-    // Enum values
-    output_ << indent << "        values: [";
-    if (enum_type.value_size() > 0) {
-        output_ << "\n";
-        for (int i = 0; i < enum_type.value_size(); ++i) {
-            const auto& value = enum_type.value(i);
-            std::string value_name = StripEnumValuePrefix(enum_type.name(), value.name());
-            output_ << indent << "            {name: \"" << value_name << "\", originalName: \"" << value.name() << "\", number: " << value.number() << "}";
-            if (i < enum_type.value_size() - 1) {
-                output_ << ",\n";
-            } else {
-                output_ << "\n";
-            }
-        }
-        output_ << indent << "        ]";
-    } else {
-        output_ << "]";
+void JsCodeGenerator::GeneratePresenceSlots(
+    const DescriptorProto& message_type,
+    const std::string& indent) {
+
+    size_t field_count = GetPresenceFields(message_type).size();
+    if (field_count == 0) return;
+
+    // One int32 slot per 32 presence-tracked fields
+    output_ << indent << "// Presence bitmask\n";
+    for (size_t slot = 0; slot * 32 < field_count; ++slot) {
+        output_ << indent << "__has" << slot << " = 0;\n";
     }
     output_ << "\n";
-    output_ << indent << "    },\n";
-    output_ << indent << "    enumerable: false,\n";
-    output_ << indent << "    writable: false,\n";
-    output_ << indent << "});\n";
-    
-    output_ << indent << "Object.freeze(" << enum_type.name() << ");\n";
 }
 
-void JsCodeGenerator::GenerateFieldMethods(
-    const FieldDescriptorProto& field,
+void JsCodeGenerator::GenerateOneofMembers(
+    const DescriptorProto& message_type,
     const std::string& indent,
     const std::string& class_name) {
 
-    std::string field_name = field.name();
-    std::string camel_case_name = SnakeToCamelCase(field_name);
-    std::string pascal_case_name = SnakeToPascalCase(field_name);
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        std::vector<const FieldDescriptorProto*> members;
+        for (const FieldDescriptorProto& field : message_type.field()) {
+            if (IsRealOneofField(field) && field.oneof_index() == oneof_index) {
+                members.push_back(&field);
+            }
+        }
+        // Synthetic oneofs of proto3 optional fields have no real members
+        if (members.empty()) continue;
+
+        const std::string& oneof_name = message_type.oneof_decl(oneof_index).name();
+        std::string camel_case_name = SnakeToCamelCase(oneof_name);
+        std::string pascal_case_name = SnakeToPascalCase(oneof_name);
+
+        // Case constants, numbered by field number (0 means not set)
+        output_ << indent << "// Oneof: " << oneof_name << "\n";
+        output_ << indent << "static " << pascal_case_name << "Case = Object.freeze({\n";
+        output_ << indent << "    NONE: 0,\n";
+        for (const FieldDescriptorProto* field : members) {
+            output_ << indent << "    " << GetCaseConstantName(field->name()) << ": " << field->number() << ",\n";
+        }
+        output_ << indent << "});\n\n";
+
+        // Discriminant and single storage slot shared by all members
+        output_ << indent << "/** @type {number} */\n";
+        output_ << indent << camel_case_name << "Case = 0;\n";
+        output_ << indent << "__" << camel_case_name << " = undefined;\n\n";
+
+        // clearXxx method
+        output_ << indent << "/** \n";
+        output_ << indent << " * @return {" << class_name << "} \n";
+        output_ << indent << " */\n";
+        output_ << indent << "clear" << pascal_case_name << "() {\n";
+        for (const FieldDescriptorProto* field : members) {
+            if (std::string mark = GetDirtyMark(message_type, *field); !mark.empty()) {
+                output_ << indent << "    " << mark << "\n";
+            }
+        }
+        if (options_.passthrough) {
+            output_ << indent << "    this.__rawStale = true;\n";
+        }
+        output_ << indent << "    this.__" << camel_case_name << " = undefined;\n";
+        output_ << indent << "    this." << camel_case_name << "Case = 0;\n";
+        output_ << indent << "    return this;\n";
+        output_ << indent << "}\n\n";
+    }
+}
 
-    // Check if it's a oneof field
-    bool is_oneof_field = field.has_oneof_index() && field.oneof_index() >= 0;
+void JsCodeGenerator::GenerateValueHelpers() {
+    output_ << R"(// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
 
-    if (is_oneof_field) {
-        output_ << indent << "// Oneof field (index: " << field.oneof_index() << ")\n";
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
     }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
 
-    // Record external type reference
-    if (field.type() == FieldDescriptorProto::TYPE_MESSAGE ||
-        field.type() == FieldDescriptorProto::TYPE_ENUM) {
-        RecordTypeReference(field.type_name());
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
     }
+    return hash;
+}
 
-    // Field type mapping
-    std::string js_type = TypeHelper::GetJsType(field, proto_file_);
-
-    // Public field declaration
-    output_ << indent << "/** @type {" << js_type << "} */\n";
-    output_ << indent << camel_case_name << ";\n\n";
-
-    // withXxx method (supports fluent chaining)
-    output_ << indent << "/** \n";
-    output_ << indent << " * @param {" << js_type << "} value \n";
-    output_ << indent << " * @return {" << class_name << "} \n";
-    output_ << indent << " */\n";
-    output_ << indent << "with" << TypeHelper::GetMethodName(field) << "(value) {\n";
-    output_ << indent << "    this." << camel_case_name << " = value;\n";
-    output_ << indent << "    return this;\n";
-    output_ << indent << "}\n\n";
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
 }
 
-std::string JsCodeGenerator::GetFieldClassRef(
-    const google::protobuf::FieldDescriptorProto& field) {
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
 
-    using google::protobuf::FieldDescriptorProto;
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
 
-    // Only message and enum types need class references
-    if (field.type() != FieldDescriptorProto::TYPE_MESSAGE &&
-        field.type() != FieldDescriptorProto::TYPE_ENUM) {
-        return "";
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
     }
+    return hash;
+}
 
-    // Use the type name transformer to get the JavaScript reference
-    if (TypeHelper::GetTypeNameTransformer()) {
-        std::string transformed = TypeHelper::GetTypeNameTransformer()(field.type_name(), proto_file_);
-        if (!transformed.empty()) {
-            return transformed;
-        }
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
     }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
 
-    // For local types, get the appropriate class name
-    if (field.type() == FieldDescriptorProto::TYPE_MESSAGE) {
-        return TypeHelper::GetMessageTypeName(field.type_name(), proto_file_);
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+)";
+}
+
+void JsCodeGenerator::GenerateWellKnownTypeHelpers() {
+    // Timestamps are Date instances unless timestamp=number, durations are
+    // milliseconds, wrappers are nullable primitives, the rest plain JSON
+    std::string timestamp_result = options_.timestamp_number ? "millis" : "new Date(millis)";
+    output_ << R"(// Codecs of the google.protobuf well-known types
+const __timestampPattern = /^\d{4}-\d{2}-\d{2}[Tt]\d{2}:\d{2}:\d{2}(\.\d{1,9})?([Zz]|[+-]\d{2}:\d{2})$/;
+const __durationPattern = /^(-?)(\d+)(?:\.(\d{1,9}))?s$/;
+
+function __decodeTimestamp(value) {
+    const millis = typeof value === 'number' ? value :
+        value instanceof Date ? value.getTime() :
+        typeof value === 'string' && __timestampPattern.test(value) ? Date.parse(value) : NaN;
+    return Number.isFinite(millis) ? )" << timestamp_result << R"( : undefined;
+}
+
+function __decodeDuration(value) {
+    if (typeof value === 'number') return Number.isFinite(value) ? value : undefined;
+    const match = typeof value === 'string' ? __durationPattern.exec(value) : null;
+    if (match === null) return undefined;
+    const millis = Number(match[2]) * 1000 + (match[3] === undefined ? 0 : Number(match[3].padEnd(9, '0')) / 1e6);
+    return match[1] === '-' ? -millis : millis;
+}
+
+function __decodeFieldMask(value) {
+    if (typeof value === 'string') return value === '' ? [] : value.split(',');
+    return Array.isArray(value) && value.every(path => typeof path === 'string') ? value : undefined;
+}
+
+function __equalsDate(a, b) {
+    return a == null || b == null ? a == b : a.getTime() === b.getTime();
+}
+
+function __hashDate(hash, value) {
+    return __hashNumber(hash, value.getTime());
+}
+
+function __cloneDate(value) {
+    return value == null ? value : new Date(value.getTime());
+}
+
+function __equalsJson(a, b) {
+    if (a === b) return true;
+    if (a === null || b === null || typeof a !== 'object' || typeof b !== 'object' ||
+        Array.isArray(a) !== Array.isArray(b)) {
+        return false;
+    }
+    return Array.isArray(a) ? __equalsArray(a, b, __equalsJson) : __equalsMap(a, b, __equalsJson);
+}
+
+function __hashJson(hash, value) {
+    switch (typeof value) {
+        case 'string': return __hashString(hash, value);
+        case 'number': return __hashNumber(hash, value);
+        case 'boolean': return __hashBool(hash, value);
+        case 'object':
+            if (Array.isArray(value)) return __hashArray(hash, value, __hashJson);
+            if (value !== null) return __hashMap(hash, value, __hashJson);
+    }
+    return Math.imul(hash, 31) | 0;
+}
+
+function __cloneJson(value) {
+    if (value === null || typeof value !== 'object') return value;
+    return Array.isArray(value) ? value.map(__cloneJson) : __cloneMap(value, __cloneJson);
+}
+
+)";
+
+    if (options_.validate) {
+        output_ << R"(function __isTimestamp(value) {
+    return typeof value !== 'object' && __decodeTimestamp(value) !== undefined;
+}
+
+function __isDuration(value) {
+    return __decodeDuration(value) !== undefined;
+}
+
+function __isFieldMask(value) {
+    return __decodeFieldMask(value) !== undefined;
+}
+
+function __isValue(value) {
+    const type = typeof value;
+    return type === 'object' || type === 'string' || type === 'number' || type === 'boolean';
+}
+
+function __isAny(value) {
+    return __isObject(value) && typeof value['@type'] === 'string';
+}
+
+)";
+    }
+
+    if (options_.flat) {
+        std::string timestamp_read = options_.timestamp_number ?
+            "view.getFloat64(offset, true)" : "new Date(view.getFloat64(offset, true))";
+        output_ << "function __flatTimestamp(view, offset) {\n";
+        output_ << "    return " << timestamp_read << ";\n";
+        output_ << "}\n\n";
+        output_ << R"(function __flatJson(view, offset) {
+    const text = __flatString(view, offset);
+    return text === '' ? undefined : JSON.parse(text);
+}
+
+)";
+    }
+}
+
+void JsCodeGenerator::GenerateValueMethods(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    // Value kind of a field: map fields use their entry's value field
+    auto get_helpers = [this, &message_type](const FieldDescriptorProto& field) {
+        if (TypeHelper::IsMapField(field)) {
+            const DescriptorProto* entry = TypeHelper::FindMapEntry(message_type, field);
+            if (entry && entry->field_size() == 2) {
+                return GetValueHelpers(entry->field(1), options_);
+            }
+            return ValueHelpers{"", "__hashNumber", ""};
+        }
+        return GetValueHelpers(field, options_);
+    };
+    auto or_undefined = [](const std::string& name) {
+        return name.empty() ? std::string("undefined") : name;
+    };
+
+    // clone()
+    output_ << indent << "/** \n";
+    output_ << indent << " * @return {" << class_name << "} a deep copy of this message\n";
+    output_ << indent << " */\n";
+    output_ << indent << "clone() {\n";
+    output_ << indent << "    return new " << class_name << "().copyFrom(this);\n";
+    output_ << indent << "}\n\n";
+
+    // copyFrom()
+    output_ << indent << "/** \n";
+    output_ << indent << " * Deep copy all fields from another message of the same type\n";
+    output_ << indent << " * @param {" << class_name << "} other \n";
+    output_ << indent << " * @return {" << class_name << "} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "copyFrom(other) {\n";
+    if (options_.passthrough) {
+        output_ << indent << "    this.__rawStale = true;\n";
+    }
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsRealOneofField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        ValueHelpers helpers = get_helpers(field);
+        std::string source = "other." + camel_case_name;
+        std::string copy;
+        if (TypeHelper::IsMapField(field)) {
+            copy = "__cloneMap(" + source + ", " + or_undefined(helpers.clone) + ")";
+        } else if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            copy = "__cloneArray(" + source + ", " + or_undefined(helpers.clone) + ")";
+        } else if (!helpers.clone.empty()) {
+            copy = helpers.clone + "(" + source + ")";
+        } else {
+            copy = source;
+        }
+        output_ << indent << "    this." << camel_case_name << " = " << copy << ";\n";
+    }
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        if (!HasRealOneofMembers(message_type, oneof_index)) continue;
+        std::string camel_case_name = SnakeToCamelCase(message_type.oneof_decl(oneof_index).name());
+        output_ << indent << "    switch (other." << camel_case_name << "Case) {\n";
+        for (const FieldDescriptorProto& field : message_type.field()) {
+            if (!IsRealOneofField(field) || field.oneof_index() != oneof_index) continue;
+            ValueHelpers helpers = get_helpers(field);
+            std::string source = "other.__" + camel_case_name;
+            output_ << indent << "        case " << field.number() << ": this." << SnakeToCamelCase(field.name())
+                << " = " << (helpers.clone.empty() ? source : helpers.clone + "(" + source + ")") << "; break;\n";
+        }
+        output_ << indent << "        default: this.clear" << SnakeToPascalCase(message_type.oneof_decl(oneof_index).name())
+            << "(); break;\n";
+        output_ << indent << "    }\n";
+    }
+    output_ << indent << "    return this;\n";
+    output_ << indent << "}\n\n";
+
+    // equals()
+    output_ << indent << "/** \n";
+    output_ << indent << " * Structural equality, unset implicit fields equal their defaults\n";
+    output_ << indent << " * @param {" << class_name << "} other \n";
+    output_ << indent << " * @return {boolean} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "equals(other) {\n";
+    output_ << indent << "    if (this === other) return true;\n";
+    output_ << indent << "    if (!(other instanceof " << class_name << ")) return false;\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsRealOneofField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        ValueHelpers helpers = get_helpers(field);
+        std::string a = "this." + camel_case_name;
+        std::string b = "other." + camel_case_name;
+        std::string test;
+        if (TypeHelper::IsMapField(field)) {
+            test = "!__equalsMap(" + a + ", " + b + ", " + or_undefined(helpers.equals) + ")";
+        } else if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            test = "!__equalsArray(" + a + ", " + b + ", " + or_undefined(helpers.equals) + ")";
+        } else if (!helpers.equals.empty()) {
+            test = "!" + helpers.equals + "(" + a + ", " + b + ")";
+        } else if (GetPresenceBit(field) >= 0) {
+            test = a + " !== " + b;
+        } else {
+            std::string default_value = GetFieldDefaultValue(field);
+            test = "(" + a + " ?? " + default_value + ") !== (" + b + " ?? " + default_value + ")";
+        }
+        output_ << indent << "    if (" << test << ") return false;\n";
+    }
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        if (!HasRealOneofMembers(message_type, oneof_index)) continue;
+        std::string camel_case_name = SnakeToCamelCase(message_type.oneof_decl(oneof_index).name());
+        output_ << indent << "    if (this." << camel_case_name << "Case !== other." << camel_case_name << "Case) return false;\n";
+        output_ << indent << "    switch (this." << camel_case_name << "Case) {\n";
+        for (const FieldDescriptorProto& field : message_type.field()) {
+            if (!IsRealOneofField(field) || field.oneof_index() != oneof_index) continue;
+            ValueHelpers helpers = get_helpers(field);
+            std::string a = "this.__" + camel_case_name;
+            std::string b = "other.__" + camel_case_name;
+            std::string test = helpers.equals.empty() ? a + " !== " + b : "!" + helpers.equals + "(" + a + ", " + b + ")";
+            output_ << indent << "        case " << field.number() << ": if (" << test << ") return false; break;\n";
+        }
+        output_ << indent << "    }\n";
+    }
+    output_ << indent << "    return true;\n";
+    output_ << indent << "}\n\n";
+
+    // hashCode()
+    output_ << indent << "/** \n";
+    output_ << indent << " * Structural hash consistent with equals()\n";
+    output_ << indent << " * @return {number} int32 hash\n";
+    output_ << indent << " */\n";
+    output_ << indent << "hashCode() {\n";
+    output_ << indent << "    let hash = 17;\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsRealOneofField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        ValueHelpers helpers = get_helpers(field);
+        std::string value = "this." + camel_case_name;
+        std::string expr;
+        if (TypeHelper::IsMapField(field)) {
+            expr = "__hashMap(hash, " + value + ", " + helpers.hash + ")";
+        } else if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            expr = "__hashArray(hash, " + value + ", " + helpers.hash + ")";
+        } else if (IsMessageField(field) || GetPresenceBit(field) >= 0) {
+            // Unset optional scalars hash like a null message
+            expr = IsMessageField(field) ?
+                helpers.hash + "(hash, " + value + ")" :
+                "(" + value + " === undefined ? __hashMessage(hash, undefined) : " + helpers.hash + "(hash, " + value + "))";
+        } else if (field.type() == FieldDescriptorProto::TYPE_BYTES) {
+            expr = helpers.hash + "(hash, " + value + " ?? [])";
+        } else {
+            expr = helpers.hash + "(hash, " + value + " ?? " + GetFieldDefaultValue(field) + ")";
+        }
+        output_ << indent << "    hash = " << expr << ";\n";
+    }
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        if (!HasRealOneofMembers(message_type, oneof_index)) continue;
+        std::string camel_case_name = SnakeToCamelCase(message_type.oneof_decl(oneof_index).name());
+        output_ << indent << "    hash = __hashNumber(hash, this." << camel_case_name << "Case);\n";
+        output_ << indent << "    switch (this." << camel_case_name << "Case) {\n";
+        for (const FieldDescriptorProto& field : message_type.field()) {
+            if (!IsRealOneofField(field) || field.oneof_index() != oneof_index) continue;
+            output_ << indent << "        case " << field.number() << ": hash = " << get_helpers(field).hash
+                << "(hash, this.__" << camel_case_name << "); break;\n";
+        }
+        output_ << indent << "    }\n";
+    }
+    output_ << indent << "    return hash;\n";
+    output_ << indent << "}\n\n";
+}
+
+void JsCodeGenerator::GenerateClearMethod(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    auto presence_fields = GetPresenceFields(message_type);
+
+    // clear(): reset to defaults in place, keeping repeated field arrays
+    output_ << indent << "/** \n";
+    output_ << indent << " * Reset all fields to their defaults without reallocating arrays\n";
+    output_ << indent << " * @return {" << class_name << "} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "clear() {\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsRealOneofField(field) || GetPresenceBit(field) >= 0) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        if (IsLazyField(field)) {
+            // Dropping the JSON first keeps the getter from decoding it
+            output_ << indent << "    this.__" << camel_case_name << "Raw = undefined;\n";
+        }
+        if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            output_ << indent << "    if (Array.isArray(this." << camel_case_name << ")) this."
+                << camel_case_name << ".length = 0; else this." << camel_case_name << " = [];\n";
+        } else {
+            output_ << indent << "    this." << camel_case_name << " = " << GetFieldDefaultValue(field) << ";\n";
+        }
+    }
+    for (const FieldDescriptorProto* field : presence_fields) {
+        output_ << indent << "    this.__" << SnakeToCamelCase(field->name()) << " = undefined;\n";
+        if (IsLazyField(*field)) {
+            output_ << indent << "    this.__" << SnakeToCamelCase(field->name()) << "Raw = undefined;\n";
+        }
+    }
+    for (size_t slot = 0; slot * 32 < presence_fields.size(); ++slot) {
+        output_ << indent << "    this.__has" << slot << " = 0;\n";
+    }
+    if (options_.dirty_tracking) {
+        for (int slot = 0; slot * 32 < message_type.field_size(); ++slot) {
+            output_ << indent << "    this.__dirty" << slot << " = 0;\n";
+        }
+    }
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        if (!HasRealOneofMembers(message_type, oneof_index)) continue;
+        std::string camel_case_name = SnakeToCamelCase(message_type.oneof_decl(oneof_index).name());
+        output_ << indent << "    this." << camel_case_name << "Case = 0;\n";
+        output_ << indent << "    this.__" << camel_case_name << " = undefined;\n";
+    }
+    if (options_.passthrough) {
+        output_ << indent << "    this.__raw = undefined;\n";
+        output_ << indent << "    this.__rawText = undefined;\n";
+        output_ << indent << "    this.__rawStale = false;\n";
+    }
+    output_ << indent << "    return this;\n";
+    output_ << indent << "}\n\n";
+}
+
+void JsCodeGenerator::GeneratePoolMethods(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    if (!options_.pool) return;
+
+    // Free list; the flag catches an instance released twice, which would
+    // otherwise sit in the free list twice and be handed to two callers
+    output_ << indent << "static __pool = [];\n\n";
+    output_ << indent << "__released = false;\n\n";
+
+    output_ << indent << "/** \n";
+    output_ << indent << " * Take an instance from the free list, or allocate one if it is empty\n";
+    output_ << indent << " * @return {" << class_name << "} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "static acquire() {\n";
+    output_ << indent << "    const message = " << class_name << ".__pool.pop();\n";
+    output_ << indent << "    if (message === undefined) return new " << class_name << "();\n";
+    output_ << indent << "    message.__released = false;\n";
+    output_ << indent << "    return message;\n";
+    output_ << indent << "}\n\n";
+
+    // release(): sub-messages are owned by the released message and released with it
+    output_ << indent << "/** \n";
+    output_ << indent << " * Return an instance and the sub-messages it owns to their free lists\n";
+    output_ << indent << " * @param {" << class_name << "} message \n";
+    output_ << indent << " * @throws {Error} if the instance was already released\n";
+    output_ << indent << " */\n";
+    output_ << indent << "static release(message) {\n";
+    output_ << indent << "    if (message.__released) {\n";
+    output_ << indent << "        throw new Error('" << class_name << " instance released twice');\n";
+    output_ << indent << "    }\n";
+    output_ << indent << "    message.__releaseOwned();\n";
+    output_ << indent << "    message.clear();\n";
+    output_ << indent << "    message.__released = true;\n";
+    output_ << indent << "    if (" << class_name << ".__pool.length < " << options_.pool_size << ") {\n";
+    output_ << indent << "        " << class_name << ".__pool.push(message);\n";
+    output_ << indent << "    }\n";
+    output_ << indent << "}\n\n";
+
+    // __releaseOwned(): also run before decoding into an existing instance,
+    // whose clear() would otherwise drop the sub-messages
+    output_ << indent << "/** \n";
+    output_ << indent << " * Return the sub-messages this instance owns to their free lists\n";
+    output_ << indent << " * @private\n";
+    output_ << indent << " */\n";
+    output_ << indent << "__releaseOwned() {\n";
+    bool declared_value = false;
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (!IsMessageField(field) || TypeHelper::IsMapField(field) || IsRealOneofField(field)) {
+            continue;
+        }
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        std::string class_ref = GetFieldClassRef(field);
+        if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            // Lazy fields release only the items already decoded
+            std::string value = (IsLazyField(field) ? "this.__" : "this.") + camel_case_name;
+            output_ << indent << "    if (Array.isArray(" << value << ")) {\n";
+            output_ << indent << "        for (const item of " << value << ") {\n";
+            output_ << indent << "            if (item instanceof " << class_ref << ") " << class_ref << ".release(item);\n";
+            output_ << indent << "        }\n";
+            output_ << indent << "    }\n";
+        } else {
+            if (!declared_value) {
+                output_ << indent << "    let value;\n";
+                declared_value = true;
+            }
+            output_ << indent << "    if ((value = this.__" << camel_case_name << ") instanceof " << class_ref << ") "
+                << class_ref << ".release(value);\n";
+        }
+    }
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        std::string camel_case_name = SnakeToCamelCase(message_type.oneof_decl(oneof_index).name());
+        bool has_members = false;
+        for (const FieldDescriptorProto& field : message_type.field()) {
+            if (!IsRealOneofField(field) || field.oneof_index() != oneof_index || !IsMessageField(field)) {
+                continue;
+            }
+            if (!has_members) {
+                output_ << indent << "    switch (this." << camel_case_name << "Case) {\n";
+                has_members = true;
+            }
+            std::string class_ref = GetFieldClassRef(field);
+            output_ << indent << "        case " << field.number() << ": " << class_ref
+                << ".release(this.__" << camel_case_name << "); break;\n";
+        }
+        if (has_members) {
+            output_ << indent << "    }\n";
+        }
+    }
+    output_ << indent << "}\n\n";
+}
+
+std::string JsCodeGenerator::GetDirtyMark(
+    const DescriptorProto& message_type,
+    const FieldDescriptorProto& field) const {
+
+    if (!options_.dirty_tracking) return "";
+
+    int index = GetFieldIndex(message_type, field);
+    return "this.__dirty" + std::to_string(index / 32) + " |= " + GetBitMask(index) + ";";
+}
+
+void JsCodeGenerator::GenerateMutationMarks(
+    const DescriptorProto& message_type,
+    const FieldDescriptorProto& field,
+    const std::string& indent) {
+
+    if (std::string mark = GetDirtyMark(message_type, field); !mark.empty()) {
+        output_ << indent << mark << "\n";
+    }
+    if (options_.passthrough) {
+        output_ << indent << "this.__rawStale = true;\n";
+    }
+}
+
+bool JsCodeGenerator::IsInt64Field(const FieldDescriptorProto& field) const {
+    return options_.int64 != Int64Mode::kNumber && TypeHelper::IsInt64Type(field.type());
+}
+
+std::string JsCodeGenerator::GetValueDecoder(const FieldDescriptorProto& field) const {
+    return IsInt64Field(field) ? "__decodeInt64" : GetWellKnownDecoder(field);
+}
+
+std::string JsCodeGenerator::GetJsonValue(const FieldDescriptorProto& field, const std::string& value) const {
+    // Strings are already their JSON form
+    if (!IsInt64Field(field) || options_.int64 == Int64Mode::kString) {
+        return value;
+    }
+    return (field.label() == FieldDescriptorProto::LABEL_REPEATED ?
+        "__encodeInt64List(" : "__encodeInt64(") + value + ")";
+}
+
+bool JsCodeGenerator::HasJsonEncodedFields(const DescriptorProto& message_type) const {
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (GetJsonValue(field, "") != "") return true;
+    }
+    return false;
+}
+
+bool JsCodeGenerator::IsLazyField(const FieldDescriptorProto& field) const {
+    return options_.lazy && IsMessageField(field) &&
+        !TypeHelper::IsMapField(field) && !IsRealOneofField(field);
+}
+
+bool JsCodeGenerator::HasLazyFields(const DescriptorProto& message_type) const {
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsLazyField(field)) return true;
+    }
+    return false;
+}
+
+void JsCodeGenerator::GenerateLazyMaterialize(
+    const DescriptorProto& message_type,
+    const FieldDescriptorProto& field,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    // Repeated fields decode into the array already held by the instance
+    std::string camel_case_name = SnakeToCamelCase(field.name());
+    output_ << indent << "if (this.__" << camel_case_name << "Raw !== undefined) {\n";
+    output_ << indent << "    this.__" << camel_case_name << " = this.__decode(" << class_name
+        << ".__descriptor.fields[" << GetFieldIndex(message_type, field) << "], this.__"
+        << camel_case_name << "Raw, this.__" << camel_case_name << ");\n";
+    output_ << indent << "    this.__" << camel_case_name << "Raw = undefined;\n";
+    output_ << indent << "}\n";
+}
+
+void JsCodeGenerator::GenerateLazyMethods(
+    const DescriptorProto& message_type,
+    const std::string& indent) {
+
+    if (!HasLazyFields(message_type)) return;
+
+    // Decoder shared by the pending fields, set by the runtime with the raw JSON
+    output_ << indent << "__decode = undefined;\n\n";
+
+    // __setLazy(): called by the runtime decoder instead of the field's setter
+    output_ << indent << "/** \n";
+    output_ << indent << " * Keep a field's JSON to decode on first access\n";
+    output_ << indent << " * @param {number} number - field number\n";
+    output_ << indent << " * @param {Object|Array} raw - JSON value of the field\n";
+    output_ << indent << " * @param {function(Object, *, *): *} decode - decoder of a field value\n";
+    output_ << indent << " */\n";
+    output_ << indent << "__setLazy(number, raw, decode) {\n";
+    output_ << indent << "    this.__decode = decode;\n";
+    output_ << indent << "    switch (number) {\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (!IsLazyField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        output_ << indent << "        case " << field.number() << ":\n";
+        if (int bit = GetPresenceBit(field); bit >= 0) {
+            if (std::string mark = GetDirtyMark(message_type, field); !mark.empty()) {
+                output_ << indent << "            " << mark << "\n";
+            }
+            output_ << indent << "            this.__" << camel_case_name << " = undefined;\n";
+            output_ << indent << "            this.__" << camel_case_name << "Raw = raw;\n";
+            output_ << indent << "            this." << GetPresenceSlotName(bit) << " |= " << GetBitMask(bit) << ";\n";
+        } else {
+            output_ << indent << "            this.__" << camel_case_name << "Raw = raw;\n";
+        }
+        output_ << indent << "            break;\n";
+    }
+    output_ << indent << "    }\n";
+    output_ << indent << "}\n\n";
+}
+
+void JsCodeGenerator::GeneratePassthroughMethods(
+    const DescriptorProto& message_type,
+    const std::string& indent) {
+
+    if (!options_.passthrough) return;
+
+    output_ << indent << "// Source JSON retained for pass-through, and its text when decoded from one\n";
+    output_ << indent << "__raw = undefined;\n";
+    output_ << indent << "__rawText = undefined;\n";
+    output_ << indent << "__rawStale = false;\n\n";
+
+    // Keys read by the decoder, everything else in the source JSON is unknown
+    output_ << indent << "static __knownKeys = new Set([";
+    for (int i = 0; i < message_type.field_size(); ++i) {
+        output_ << (i == 0 ? "\"" : ", \"") << SnakeToCamelCase(message_type.field(i).name()) << "\"";
+    }
+    output_ << "]);\n\n";
+
+    // __retain(): called by the runtime decoder once all fields are set
+    output_ << indent << "/** \n";
+    output_ << indent << " * Keep the JSON this message was decoded from\n";
+    output_ << indent << " * @param {Object} raw - decoded JSON object\n";
+    output_ << indent << " * @param {string} [text] - JSON text raw was parsed from\n";
+    output_ << indent << " */\n";
+    output_ << indent << "__retain(raw, text) {\n";
+    output_ << indent << "    this.__raw = raw;\n";
+    output_ << indent << "    this.__rawText = text;\n";
+    output_ << indent << "    this.__rawStale = false;\n";
+    output_ << indent << "}\n\n";
+
+    // __isPristine(): every field is an accessor marking the message stale on
+    // assignment, so only what changes in place is checked here. Sub-messages
+    // still pending as lazy JSON are pristine by construction, decoded ones are
+    // asked in turn; repeated fields are compared against the retained arrays.
+    output_ << indent << "/** \n";
+    output_ << indent << " * Whether the retained JSON still encodes this message: nothing was set\n";
+    output_ << indent << " * since decoding and every decoded sub-message is pristine as well\n";
+    output_ << indent << " * @return {boolean} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "__isPristine() {\n";
+    output_ << indent << "    if (this.__raw === undefined || this.__rawStale) return false;\n";
+    bool declared_value = false;
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        bool repeated = field.label() == FieldDescriptorProto::LABEL_REPEATED;
+        if ((!IsMessageField(field) && !repeated) || IsRealOneofField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        if (!declared_value) {
+            output_ << indent << "    let value, raw;\n";
+            declared_value = true;
+        }
+        if (!repeated) {
+            output_ << indent << "    if ((value = this.__" << camel_case_name << ") != null && !value.__isPristine()) return false;\n";
+            continue;
+        }
+
+        if (TypeHelper::IsMapField(field)) {
+            GenerateMapPristineCheck(message_type, field, indent);
+            continue;
+        }
+
+        // Items added or removed in place change the length
+        output_ << indent << "    if ((value = this.__" << camel_case_name << ") != null) {\n";
+        output_ << indent << "        raw = this.__raw." << camel_case_name << ";\n";
+        output_ << indent << "        if (value.length !== (raw == null ? 0 : raw.length)) return false;\n";
+        if (IsMessageField(field)) {
+            output_ << indent << "        for (const item of value) {\n";
+            output_ << indent << "            if (item != null && !item.__isPristine()) return false;\n";
+            output_ << indent << "        }\n";
+        } else if (field.type() != FieldDescriptorProto::TYPE_BYTES && GetWellKnownDecoder(field).empty()) {
+            // Scalars decode to their JSON value; bytes and well-known types
+            // decode to objects and are only compared by count
+            std::string decoder = GetValueDecoder(field);
+            output_ << indent << "        for (let i = 0; i < value.length; i++) {\n";
+            output_ << indent << "            if (value[i] !== " << (decoder.empty() ? "raw[i]" : decoder + "(raw[i])")
+                << ") return false;\n";
+            output_ << indent << "        }\n";
+        }
+        output_ << indent << "    }\n";
+    }
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        std::string camel_case_name = SnakeToCamelCase(message_type.oneof_decl(oneof_index).name());
+        bool has_members = false;
+        for (const FieldDescriptorProto& field : message_type.field()) {
+            if (!IsRealOneofField(field) || field.oneof_index() != oneof_index || !IsMessageField(field)) {
+                continue;
+            }
+            if (!has_members) {
+                output_ << indent << "    switch (this." << camel_case_name << "Case) {\n";
+                has_members = true;
+            }
+            output_ << indent << "        case " << field.number() << ":\n";
+        }
+        if (has_members) {
+            output_ << indent << "            if (!this.__" << camel_case_name << ".__isPristine()) return false;\n";
+            output_ << indent << "            break;\n";
+            output_ << indent << "    }\n";
+        }
+    }
+    output_ << indent << "    return true;\n";
+    output_ << indent << "}\n\n";
+}
+
+void JsCodeGenerator::GenerateMapPristineCheck(
+    const DescriptorProto& message_type,
+    const FieldDescriptorProto& field,
+    const std::string& indent) {
+
+    // Maps decode either to an array of entry messages or to an object keyed
+    // like the JSON; either way the keys are compared before the values
+    std::string camel_case_name = SnakeToCamelCase(field.name());
+    const DescriptorProto* entry = TypeHelper::FindMapEntry(message_type, field);
+    const FieldDescriptorProto* value_field = entry && entry->field_size() == 2 ? &entry->field(1) : nullptr;
+    output_ << indent << "    if ((value = this.__" << camel_case_name << ") != null) {\n";
+    output_ << indent << "        raw = this.__raw." << camel_case_name << ";\n";
+    output_ << indent << "        if (raw == null ? Object.keys(value).length !== 0\n";
+    output_ << indent << "            : Array.isArray(value) !== Array.isArray(raw) || Object.keys(value).length !== Object.keys(raw).length) return false;\n";
+    output_ << indent << "        for (const key in value) {\n";
+    if (value_field && IsMessageField(*value_field)) {
+        output_ << indent << "            if (value[key] != null && !value[key].__isPristine()) return false;\n";
+    } else if (value_field && value_field->type() != FieldDescriptorProto::TYPE_BYTES &&
+               GetWellKnownDecoder(*value_field).empty()) {
+        // Scalar map values stay plain JSON in the object form
+        output_ << indent << "            if (Array.isArray(value) ? value[key] != null && !value[key].__isPristine()\n";
+        output_ << indent << "                : value[key] !== raw[key]) return false;\n";
+    } else {
+        output_ << indent << "            if (Array.isArray(value) && value[key] != null && !value[key].__isPristine()) return false;\n";
+    }
+    output_ << indent << "        }\n";
+    output_ << indent << "    }\n";
+}
+
+void JsCodeGenerator::GenerateDeltaMethods(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    if (!options_.dirty_tracking) return;
+
+    // One dirty bit per field, in declaration order
+    output_ << indent << "// Dirty field bitmask\n";
+    for (int slot = 0; slot * 32 < message_type.field_size(); ++slot) {
+        output_ << indent << "__dirty" << slot << " = 0;\n";
+    }
+    output_ << "\n";
+
+    // __markCommitted(): decoding and applyDelta() assign through the setters,
+    // which mark the fields they touch; the result is committed state
+    output_ << indent << "/** \n";
+    output_ << indent << " * Clear the dirty bits of this message only, sub-messages keep theirs\n";
+    output_ << indent << " * @private\n";
+    output_ << indent << " */\n";
+    output_ << indent << "__markCommitted() {\n";
+    for (int slot = 0; slot * 32 < message_type.field_size(); ++slot) {
+        output_ << indent << "    this.__dirty" << slot << " = 0;\n";
+    }
+    output_ << indent << "}\n\n";
+
+    auto dirty_test = [](int index) {
+        return "(this.__dirty" + std::to_string(index / 32) + " & " + GetBitMask(index) + ")";
+    };
+
+    // encodeDelta(): changed fields by value, untouched sub-messages recursively
+    output_ << indent << "/** \n";
+    output_ << indent << " * Encode fields changed since the last commit()\n";
+    output_ << indent << " * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)\n";
+    output_ << indent << " */\n";
+    output_ << indent << "encodeDelta() {\n";
+    output_ << indent << "    let full;\n";
+    output_ << indent << "    let nested;\n";
+    output_ << indent << "    let value;\n";
+    for (int slot = 0; slot * 32 < message_type.field_size(); ++slot) {
+        std::string slot_var = message_type.field_size() > 32 ? "bits" + std::to_string(slot) : "bits";
+        output_ << indent << "    for (let " << slot_var << " = this.__dirty" << slot << "; "
+            << slot_var << " !== 0;) {\n";
+        output_ << indent << "        const bit = " << slot_var << " & -" << slot_var << ";\n";
+        output_ << indent << "        " << slot_var << " ^= bit;\n";
+        output_ << indent << "        switch (bit) {\n";
+        for (int index = slot * 32; index < message_type.field_size() && index < (slot + 1) * 32; ++index) {
+            const FieldDescriptorProto& field = message_type.field(index);
+            std::string camel_case_name = SnakeToCamelCase(field.name());
+            // Cleared fields are sent as null
+            bool is_optional = IsRealOneofField(field) || GetPresenceBit(field) >= 0;
+            output_ << indent << "            case " << GetBitMask(index) << ": (full \?\?= {})." << camel_case_name
+                << " = " << GetJsonValue(field, "this." + camel_case_name) << (is_optional ? " ?? null" : "") << "; break;\n";
+        }
+        output_ << indent << "        }\n";
+        output_ << indent << "    }\n";
+    }
+    for (int index = 0; index < message_type.field_size(); ++index) {
+        const FieldDescriptorProto& field = message_type.field(index);
+        if (!IsMessageField(field) || TypeHelper::IsMapField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            // Element deltas keyed by index
+            output_ << indent << "    if (" << dirty_test(index) << " === 0 && Array.isArray(this." << camel_case_name << ")) {\n";
+            output_ << indent << "        const list = this." << camel_case_name << ";\n";
+            output_ << indent << "        let items;\n";
+            output_ << indent << "        for (let i = 0; i < list.length; i++) {\n";
+            output_ << indent << "            if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items \?\?= {})[i] = value;\n";
+            output_ << indent << "        }\n";
+            output_ << indent << "        if (items !== undefined) (nested \?\?= {})." << camel_case_name << " = items;\n";
+            output_ << indent << "    }\n";
+        } else {
+            output_ << indent << "    if (" << dirty_test(index) << " === 0 && (value = this." << camel_case_name
+                << ") && (value = value.encodeDelta()) !== undefined) (nested \?\?= {})." << camel_case_name << " = value;\n";
+        }
+    }
+    output_ << indent << "    return full === undefined && nested === undefined ? undefined : { f: full, d: nested };\n";
+    output_ << indent << "}\n\n";
+
+    // applyDelta(): assign changed values, recurse into nested deltas
+    output_ << indent << "/** \n";
+    output_ << indent << " * Apply a delta produced by encodeDelta() (also accepts its JSON form)\n";
+    output_ << indent << " * @param {{f?: Object, d?: Object}} delta \n";
+    output_ << indent << " * @return {" << class_name << "} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "applyDelta(delta) {\n";
+    output_ << indent << "    let value;\n";
+    output_ << indent << "    const full = delta.f;\n";
+    output_ << indent << "    if (full !== undefined) {\n";
+    for (int index = 0; index < message_type.field_size(); ++index) {
+        const FieldDescriptorProto& field = message_type.field(index);
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        bool is_message = IsMessageField(field) && !TypeHelper::IsMapField(field);
+        std::string decoder = GetValueDecoder(field);
+        output_ << indent << "        if ((value = full." << camel_case_name << ") !== undefined) {\n";
+        if (!decoder.empty()) {
+            // Timestamps, durations and 64-bit integers arrive in their JSON form after transport
+            output_ << indent << "            this." << camel_case_name << " = "
+                << (field.label() == FieldDescriptorProto::LABEL_REPEATED ?
+                    "value === null ? [] : value.map(item => " + decoder + "(item))" :
+                    "value === null ? undefined : " + decoder + "(value)") << ";\n";
+        } else if (!is_message) {
+            // A delta applied in the same process still holds the sender's arrays
+            output_ << indent << "            this." << camel_case_name << " = "
+                << (field.label() == FieldDescriptorProto::LABEL_REPEATED ? "value === null ? [] : value.slice()" : "value")
+                << ";\n";
+        } else {
+            // Full values are plain JSON after transport, decode them as full deltas;
+            // instances of a delta applied in the same process are copied, not adopted
+            std::string class_ref = GetFieldClassRef(field);
+            auto decode = [&class_ref](const std::string& var) {
+                return "(" + var + " instanceof " + class_ref + " ? " + var + ".clone().commit() : new " + class_ref +
+                    "().applyDelta({ f: " + var + " }))";
+            };
+            if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+                output_ << indent << "            this." << camel_case_name << " = value === null ? [] : value.map(item => "
+                    << decode("item") << ");\n";
+            } else {
+                output_ << indent << "            this." << camel_case_name << " = value === null ? undefined : "
+                    << decode("value") << ";\n";
+            }
+        }
+        output_ << indent << "        }\n";
+    }
+    output_ << indent << "    }\n";
+    output_ << indent << "    const nested = delta.d;\n";
+    output_ << indent << "    if (nested !== undefined) {\n";
+    for (int index = 0; index < message_type.field_size(); ++index) {
+        const FieldDescriptorProto& field = message_type.field(index);
+        if (!IsMessageField(field) || TypeHelper::IsMapField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        output_ << indent << "        if ((value = nested." << camel_case_name << ") !== undefined) {\n";
+        if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            output_ << indent << "            const list = this." << camel_case_name << ";\n";
+            output_ << indent << "            for (const i in value) list[i]?.applyDelta(value[i]);\n";
+        } else {
+            output_ << indent << "            (this." << camel_case_name << " ?? (this." << camel_case_name
+                << " = new " << GetFieldClassRef(field) << "())).applyDelta(value);\n";
+        }
+        output_ << indent << "        }\n";
+    }
+    output_ << indent << "    }\n";
+    output_ << indent << "    this.__markCommitted();\n";
+    output_ << indent << "    return this;\n";
+    output_ << indent << "}\n\n";
+
+    // commit(): clear dirty state of this message and everything below it
+    output_ << indent << "/** \n";
+    output_ << indent << " * Mark the current state as synchronized\n";
+    output_ << indent << " * @return {" << class_name << "} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "commit() {\n";
+    for (int slot = 0; slot * 32 < message_type.field_size(); ++slot) {
+        output_ << indent << "    this.__dirty" << slot << " = 0;\n";
+    }
+    bool declared_value = false;
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (!IsMessageField(field) || TypeHelper::IsMapField(field)) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        if (field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+            output_ << indent << "    if (Array.isArray(this." << camel_case_name << ")) {\n";
+            output_ << indent << "        for (const item of this." << camel_case_name << ") item?.commit();\n";
+            output_ << indent << "    }\n";
+        } else {
+            if (!declared_value) {
+                output_ << indent << "    let value;\n";
+                declared_value = true;
+            }
+            output_ << indent << "    if ((value = this." << camel_case_name << ")) value.commit();\n";
+        }
+    }
+    output_ << indent << "    return this;\n";
+    output_ << indent << "}\n\n";
+}
+
+void JsCodeGenerator::GenerateToJson(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    auto presence_fields = GetPresenceFields(message_type);
+
+    // Plain messages serialize their own fields directly, unless they carry
+    // internal state such as dirty bits
+    if (!HasRealOneof(message_type) && presence_fields.empty() && !options_.dirty_tracking &&
+        !HasLazyFields(message_type) && !HasJsonEncodedFields(message_type) && !options_.passthrough) {
+        return;
+    }
+
+    output_ << indent << "toJSON() {\n";
+    if (options_.passthrough) {
+        output_ << indent << "    if (this.__isPristine()) return this.__raw;\n";
+    }
+    output_ << indent << "    const json = {";
+    bool has_regular_fields = false;
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (IsRealOneofField(field) || GetPresenceBit(field) >= 0) continue;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        // Lazy fields still holding their JSON write it back without decoding
+        std::string value = IsLazyField(field) ?
+            "this.__" + camel_case_name + "Raw ?? this.__" + camel_case_name :
+            GetJsonValue(field, "this." + camel_case_name);
+        output_ << "\n" << indent << "        " << camel_case_name << ": " << value << ",";
+        has_regular_fields = true;
+    }
+    if (has_regular_fields) {
+        output_ << "\n" << indent << "    ";
+    }
+    output_ << "};\n";
+
+    // Presence-tracked fields: visit set bits only
+    for (size_t slot = 0; slot * 32 < presence_fields.size(); ++slot) {
+        std::string slot_var = presence_fields.size() > 32 ? "bits" + std::to_string(slot) : "bits";
+        output_ << indent << "    for (let " << slot_var << " = this.__has" << slot << "; "
+            << slot_var << " !== 0;) {\n";
+        output_ << indent << "        const bit = " << slot_var << " & -" << slot_var << ";\n";
+        output_ << indent << "        " << slot_var << " ^= bit;\n";
+        output_ << indent << "        switch (bit) {\n";
+        for (size_t bit = slot * 32; bit < presence_fields.size() && bit < (slot + 1) * 32; ++bit) {
+            std::string camel_case_name = SnakeToCamelCase(presence_fields[bit]->name());
+            std::string value = IsLazyField(*presence_fields[bit]) ?
+                "this.__" + camel_case_name + "Raw ?? this.__" + camel_case_name :
+                GetJsonValue(*presence_fields[bit], "this.__" + camel_case_name);
+            output_ << indent << "            case " << GetBitMask(static_cast<int>(bit)) << ": json."
+                << camel_case_name << " = " << value << "; break;\n";
+        }
+        output_ << indent << "        }\n";
+        output_ << indent << "    }\n";
+    }
+
+    // Only the active member of each oneof is written
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        std::string camel_case_name = SnakeToCamelCase(message_type.oneof_decl(oneof_index).name());
+        bool has_members = false;
+        for (const FieldDescriptorProto& field : message_type.field()) {
+            if (!IsRealOneofField(field) || field.oneof_index() != oneof_index) continue;
+            if (!has_members) {
+                output_ << indent << "    switch (this." << camel_case_name << "Case) {\n";
+                has_members = true;
+            }
+            output_ << indent << "        case " << field.number() << ": json."
+                << SnakeToCamelCase(field.name()) << " = " << GetJsonValue(field, "this.__" + camel_case_name) << "; break;\n";
+        }
+        if (has_members) {
+            output_ << indent << "    }\n";
+        }
+    }
+    if (options_.passthrough) {
+        // Keys of the source JSON that no field reads survive modification
+        output_ << indent << "    return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, "
+            << class_name << ".__knownKeys);\n";
+    } else {
+        output_ << indent << "    return json;\n";
+    }
+    output_ << indent << "}\n\n";
+}
+
+void JsCodeGenerator::GenerateInt64Helpers() {
+    // JSON carries 64-bit integers as numbers or decimal strings; each
+    // representation gets its own decoder rather than a shared conversion
+    output_ << "// Codecs of the 64-bit integer representation (int64=" << GetInt64ModeName(options_.int64) << ")\n";
+    if (options_.int64 != Int64Mode::kNumber) {
+        // BigInt() alone would also accept "", whitespace and hex strings
+        output_ << R"(function __checkInt64String(value) {
+    if (!/^-?\d+$/.test(value)) {
+        throw new Error(`Invalid 64-bit integer: ${JSON.stringify(value)}`);
+    }
+    return value;
+}
+
+)";
+    }
+    switch (options_.int64) {
+        case Int64Mode::kBigInt:
+            output_ << R"(function __decodeInt64(value) {
+    if (typeof value === 'bigint') return value;
+    return BigInt(typeof value === 'string' ? __checkInt64String(value) : value);
+}
+
+function __encodeInt64(value) {
+    return typeof value === 'bigint' ? value.toString() : value;
+}
+
+)";
+            break;
+        case Int64Mode::kString:
+            output_ << R"(function __decodeInt64(value) {
+    return typeof value === 'string' ? __checkInt64String(value) : String(BigInt(value));
+}
+
+)";
+            break;
+        case Int64Mode::kHybrid:
+            // Up to 15 digits is always a safe integer, no bigint is created
+            output_ << R"(function __decodeInt64(value) {
+    if (typeof value === 'number') {
+        return Number.isSafeInteger(value) ? value : BigInt(value);
+    }
+    if (typeof value === 'string') {
+        if (/^-?\d{1,15}$/.test(value)) return Number(value);
+        __checkInt64String(value);
+    }
+    const big = typeof value === 'bigint' ? value : BigInt(value);
+    return big >= -9007199254740991n && big <= 9007199254740991n ? Number(big) : big;
+}
+
+function __encodeInt64(value) {
+    return typeof value === 'bigint' ? value.toString() : value;
+}
+
+function __hashInt64(hash, value) {
+    return typeof value === 'bigint' ? __hashBigInt(hash, value) : __hashNumber(hash, value);
+}
+
+)";
+            break;
+        case Int64Mode::kNumber:
+            return;
+    }
+    if (options_.int64 != Int64Mode::kString) {
+        output_ << R"(function __encodeInt64List(list) {
+    return Array.isArray(list) ? list.map(__encodeInt64) : list;
+}
+
+function __hashBigInt(hash, value) {
+    hash = (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value))) | 0;
+    return (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value >> 32n))) | 0;
+}
+
+)";
+    }
+}
+
+void JsCodeGenerator::GeneratePassthroughHelpers() {
+    output_ << R"(// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+)";
+}
+
+void JsCodeGenerator::GenerateValidationHelpers() {
+    output_ << R"(// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+)";
+}
+
+std::string JsCodeGenerator::GetValidationCheck(
+    const FieldDescriptorProto& field,
+    const std::string& value) {
+
+    if (std::string well_known_type = TypeHelper::GetWellKnownType(field); !well_known_type.empty()) {
+        FieldDescriptorProto::Type wrapped_type = TypeHelper::GetWrappedType(well_known_type);
+        if (wrapped_type != FieldDescriptorProto::TYPE_MESSAGE) {
+            // Wrappers are their primitive value in JSON
+            FieldDescriptorProto wrapped = field;
+            wrapped.set_type(wrapped_type);
+            wrapped.clear_type_name();
+            return GetValidationCheck(wrapped, value);
+        }
+        if (well_known_type == "Struct" || well_known_type == "Empty") {
+            return "__isObject(" + value + ")";
+        }
+        if (well_known_type == "ListValue") {
+            return "Array.isArray(" + value + ")";
+        }
+        return "__is" + well_known_type + "(" + value + ")";
+    }
+
+    switch (field.type()) {
+        case FieldDescriptorProto::TYPE_INT32:
+        case FieldDescriptorProto::TYPE_SINT32:
+        case FieldDescriptorProto::TYPE_SFIXED32:
+            return "__isInt32(" + value + ")";
+        case FieldDescriptorProto::TYPE_UINT32:
+        case FieldDescriptorProto::TYPE_FIXED32:
+            return "__isUint32(" + value + ")";
+        case FieldDescriptorProto::TYPE_INT64:
+        case FieldDescriptorProto::TYPE_SINT64:
+        case FieldDescriptorProto::TYPE_SFIXED64:
+            return "__isInt64(" + value + ")";
+        case FieldDescriptorProto::TYPE_UINT64:
+        case FieldDescriptorProto::TYPE_FIXED64:
+            return "__isUint64(" + value + ")";
+        case FieldDescriptorProto::TYPE_FLOAT:
+            return "__isFloat(" + value + ")";
+        case FieldDescriptorProto::TYPE_DOUBLE:
+            return "__isDouble(" + value + ")";
+        case FieldDescriptorProto::TYPE_BOOL:
+            return "__isBool(" + value + ")";
+        case FieldDescriptorProto::TYPE_STRING:
+            return "__isString(" + value + ")";
+        case FieldDescriptorProto::TYPE_BYTES:
+            return "__isBytes(" + value + ")";
+        case FieldDescriptorProto::TYPE_ENUM:
+            return "__isEnum(" + GetFieldClassRef(field) + ", " + value + ")";
+        default:
+            return "__isObject(" + value + ")";
+    }
+}
+
+void JsCodeGenerator::GenerateValidationMethods(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    if (!options_.validate) return;
+
+    // Expected type name used in error messages
+    auto expected = [this](const FieldDescriptorProto& field) {
+        if (std::string well_known_type = TypeHelper::GetWellKnownType(field); !well_known_type.empty()) {
+            return "google.protobuf." + well_known_type;
+        }
+        if (field.type() == FieldDescriptorProto::TYPE_ENUM) {
+            const EnumDescriptorProto* enum_type = type_resolver_.FindEnum(field.type_name());
+            return "enum " + (enum_type ? enum_type->name() : field.type_name());
+        }
+        std::string name = FieldDescriptorProto::Type_Name(field.type()).substr(5);
+        std::transform(name.begin(), name.end(), name.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return name;
+    };
+
+    // Check of a map key, empty for string keys
+    auto key_check = [this](const FieldDescriptorProto& key) -> std::string {
+        switch (key.type()) {
+            case FieldDescriptorProto::TYPE_STRING:
+                return "";
+            case FieldDescriptorProto::TYPE_BOOL:
+                return "(key === \"true\" || key === \"false\")";
+            case FieldDescriptorProto::TYPE_INT64:
+            case FieldDescriptorProto::TYPE_SINT64:
+            case FieldDescriptorProto::TYPE_SFIXED64:
+            case FieldDescriptorProto::TYPE_UINT64:
+            case FieldDescriptorProto::TYPE_FIXED64:
+                return GetValidationCheck(key, "key");
+            default: {
+                std::string check = GetValidationCheck(key, "value");
+                return "__isNumericKey(key, " + check.substr(0, check.find('(')) + ")";
+            }
+        }
+    };
+
+    // Oneof members set together are rejected; emitted as "if (cond) <action> __invalid(...)"
+    auto oneof_checks = [&](const std::string& action) {
+        for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+            std::string members;
+            int count = 0;
+            for (const FieldDescriptorProto& field : message_type.field()) {
+                if (!IsRealOneofField(field) || field.oneof_index() != oneof_index) continue;
+                members += (count++ == 0 ? "" : " + ") +
+                    std::string("(json.") + SnakeToCamelCase(field.name()) + " != null ? 1 : 0)";
+            }
+            if (count < 2) continue;
+            output_ << indent << "    if (" << members << " > 1) " << action << " __invalid(\""
+                << SnakeToCamelCase(message_type.oneof_decl(oneof_index).name()) << "\", \"a single oneof member\");\n";
+        }
+    };
+
+    // validate(json): returns null or an error carrying the field path
+    output_ << indent << "/**\n";
+    output_ << indent << " * Validate untrusted JSON without decoding it\n";
+    output_ << indent << " * @param {any} json\n";
+    output_ << indent << " * @return {Error|null} null when valid, otherwise an error with the field path\n";
+    output_ << indent << " */\n";
+    output_ << indent << "static validate(json) {\n";
+    output_ << indent << "    if (!__isObject(json)) return __invalid(\"\", \"object\");\n";
+    oneof_checks("return");
+    if (message_type.field_size() > 0) {
+        output_ << indent << "    let value, error;\n";
+    }
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        std::string name = SnakeToCamelCase(field.name());
+        const DescriptorProto* entry = field.type() == FieldDescriptorProto::TYPE_MESSAGE ?
+            TypeHelper::FindMapEntry(message_type, field) : nullptr;
+        bool repeated = field.label() == FieldDescriptorProto::LABEL_REPEATED;
+        const FieldDescriptorProto& item_field = entry ? entry->field(1) : field;
+        std::string item = repeated ? "item" : "value";
+        std::string path = "\"" + name + "\"";
+        std::string index = entry ? ", key" : repeated ? ", i" : "";
+        std::string item_check = IsMessageField(item_field) ?
+            "(error = " + GetFieldClassRef(item_field) + ".validate(" + item + ")) !== null) return __prefixError(error, " + path + index + ");" :
+            !repeated ? "!" + GetValidationCheck(item_field, item) + ") return __invalid(" + path + ", \"" + expected(item_field) + "\");" :
+            "!" + GetValidationCheck(item_field, item) + ") return __prefixError(__invalid(\"\", \"" + expected(item_field) + "\"), " + path + index + ");";
+
+        output_ << indent << "    value = json." << name << ";\n";
+        if (!repeated) {
+            output_ << indent << "    if (value != null && " << item_check << "\n";
+            continue;
+        }
+        output_ << indent << "    if (value != null) {\n";
+        if (entry) {
+            // The codec writes maps as arrays of entry messages; objects keyed
+            // by the map key (the proto3 JSON form) are accepted too
+            output_ << indent << "        if (Array.isArray(value)) {\n";
+            output_ << indent << "            for (let i = 0; i < value.length; i++) {\n";
+            output_ << indent << "                if ((error = " << GetFieldClassRef(field) << ".validate(value[i])) !== null) "
+                << "return __prefixError(error, " << path << ", i);\n";
+            output_ << indent << "            }\n";
+            output_ << indent << "        } else if (!__isObject(value)) {\n";
+            output_ << indent << "            return __invalid(" << path << ", \"object or array of entries\");\n";
+            output_ << indent << "        } else {\n";
+            output_ << indent << "            for (const key in value) {\n";
+            if (std::string check = key_check(entry->field(0)); !check.empty()) {
+                output_ << indent << "                if (!" << check << ") return __prefixError(__invalid(\"\", \""
+                    << expected(entry->field(0)) << " key\"), " << path << ", key);\n";
+            }
+            output_ << indent << "                const item = value[key];\n";
+            output_ << indent << "                if (" << item_check << "\n";
+            output_ << indent << "            }\n";
+            output_ << indent << "        }\n";
+            output_ << indent << "    }\n";
+            continue;
+        }
+        output_ << indent << "        if (!Array.isArray(value)) return __invalid(" << path << ", \"array\");\n";
+        output_ << indent << "        for (let i = 0; i < value.length; i++) {\n";
+        output_ << indent << "            const item = value[i];\n";
+        output_ << indent << "            if (" << item_check << "\n";
+        output_ << indent << "        }\n";
+        output_ << indent << "    }\n";
+    }
+    output_ << indent << "    return null;\n";
+    output_ << indent << "}\n\n";
+
+    // validateAndDecode(json): checks and builds the instance in one walk
+    output_ << indent << "/**\n";
+    output_ << indent << " * Validate untrusted JSON and decode it in a single pass\n";
+    output_ << indent << " * @param {any} json\n";
+    output_ << indent << " * @return {" << class_name << "}\n";
+    output_ << indent << " * @throws {Error} ValidationError carrying the field path\n";
+    output_ << indent << " */\n";
+    output_ << indent << "static validateAndDecode(json) {\n";
+    output_ << indent << "    if (!__isObject(json)) throw __invalid(\"\", \"object\");\n";
+    oneof_checks("throw");
+    output_ << indent << "    const message = " << (options_.pool ? class_name + ".acquire()" : "new " + class_name + "()") << ";\n";
+    // A pooled instance goes back to the free list when the input is
+    // rejected, together with the sub-messages already decoded into it
+    std::string body = indent;
+    if (options_.pool) {
+        output_ << indent << "    try {\n";
+        body = indent + "    ";
+    }
+    if (message_type.field_size() > 0) {
+        output_ << body << "    let value;\n";
+    }
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        std::string name = SnakeToCamelCase(field.name());
+        const DescriptorProto* entry = field.type() == FieldDescriptorProto::TYPE_MESSAGE ?
+            TypeHelper::FindMapEntry(message_type, field) : nullptr;
+        bool repeated = field.label() == FieldDescriptorProto::LABEL_REPEATED;
+        const FieldDescriptorProto& item_field = entry ? entry->field(1) : field;
+        std::string path = "\"" + name + "\"";
+        bool is_message = IsMessageField(item_field);
+        // Map values stay plain JSON
+        std::string decoder = entry ? GetWellKnownDecoder(item_field) : GetValueDecoder(item_field);
+
+        output_ << body << "    value = json." << name << ";\n";
+        if (!repeated) {
+            output_ << body << "    if (value != null) {\n";
+            if (is_message) {
+                output_ << body << "        message." << name << " = __decodeNested("
+                    << GetFieldClassRef(field) << ", value, " << path << ");\n";
+            } else {
+                output_ << body << "        if (!" << GetValidationCheck(field, "value") << ") throw __invalid("
+                    << path << ", \"" << expected(field) << "\");\n";
+                output_ << body << "        message." << name << " = "
+                    << (decoder.empty() ? "value" : decoder + "(value)") << ";\n";
+            }
+            output_ << body << "    }\n";
+            continue;
+        }
+
+        std::string index = entry ? "key" : "i";
+        std::string decode = is_message ?
+            "__decodeNested(" + GetFieldClassRef(item_field) + ", item, " + path + ", " + index + ")" :
+            decoder.empty() ? "item" : decoder + "(item)";
+        output_ << body << "    if (value != null) {\n";
+        if (entry) {
+            // Entry arrays decode to entry messages, as fromJson does
+            output_ << body << "        if (Array.isArray(value)) {\n";
+            output_ << body << "            message." << name << " = value.map((item, i) => __decodeNested("
+                << GetFieldClassRef(field) << ", item, " << path << ", i));\n";
+            output_ << body << "        } else {\n";
+            output_ << body << "            if (!__isObject(value)) throw __invalid(" << path << ", \"object or array of entries\");\n";
+            output_ << body << "            const map = {};\n";
+            output_ << body << "            for (const key in value) {\n";
+            if (std::string check = key_check(entry->field(0)); !check.empty()) {
+                output_ << body << "                if (!" << check << ") throw __prefixError(__invalid(\"\", \""
+                    << expected(entry->field(0)) << " key\"), " << path << ", key);\n";
+            }
+            output_ << body << "                const item = value[key];\n";
+            if (!is_message) {
+                output_ << body << "                if (!" << GetValidationCheck(item_field, "item") << ") throw __prefixError(__invalid(\"\", \""
+                    << expected(item_field) << "\"), " << path << ", key);\n";
+            }
+            output_ << body << "                map[key] = " << decode << ";\n";
+            output_ << body << "            }\n";
+            output_ << body << "            message." << name << " = map;\n";
+            output_ << body << "        }\n";
+            output_ << body << "    }\n";
+            continue;
+        }
+        output_ << body << "        if (!Array.isArray(value)) throw __invalid(" << path << ", \"array\");\n";
+        output_ << body << "        const list = new Array(value.length);\n";
+        output_ << body << "        message." << name << " = list;\n";
+        output_ << body << "        for (let i = 0; i < value.length; i++) {\n";
+        output_ << body << "            const item = value[i];\n";
+        if (!is_message) {
+            output_ << body << "            if (!" << GetValidationCheck(item_field, "item") << ") throw __prefixError(__invalid(\"\", \""
+                << expected(item_field) << "\"), " << path << ", i);\n";
+        }
+        output_ << body << "            list[i] = " << decode << ";\n";
+        output_ << body << "        }\n";
+        output_ << body << "    }\n";
+    }
+    if (options_.dirty_tracking) {
+        output_ << body << "    message.__markCommitted();\n";
+    }
+    if (options_.passthrough) {
+        output_ << body << "    message.__retain(json);\n";
+    }
+    if (options_.pool) {
+        output_ << indent << "    } catch (error) {\n";
+        output_ << indent << "        " << class_name << ".release(message);\n";
+        output_ << indent << "        throw error;\n";
+        output_ << indent << "    }\n";
+    }
+    output_ << indent << "    return message;\n";
+    output_ << indent << "}\n\n";
+}
+
+void JsCodeGenerator::GenerateFlatHelpers() {
+    output_ << R"(// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+)";
+
+    // 64-bit readers per int64 representation; numbers are assembled from
+    // the two 32-bit halves without going through a bigint
+    switch (options_.int64) {
+        case Int64Mode::kNumber:
+            output_ << R"(function __flatInt64(view, offset) {
+    return view.getInt32(offset + 4, true) * 4294967296 + view.getUint32(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    return view.getUint32(offset + 4, true) * 4294967296 + view.getUint32(offset, true);
+}
+)";
+            break;
+        case Int64Mode::kBigInt:
+            output_ << R"(function __flatInt64(view, offset) {
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    return view.getBigUint64(offset, true);
+}
+)";
+            break;
+        case Int64Mode::kString:
+            output_ << R"(function __flatInt64(view, offset) {
+    return view.getBigInt64(offset, true).toString();
+}
+
+function __flatUint64(view, offset) {
+    return view.getBigUint64(offset, true).toString();
+}
+)";
+            break;
+        case Int64Mode::kHybrid:
+            // A high word within +-2^21 keeps the value a safe integer
+            output_ << R"(function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+)";
+            break;
+    }
+
+    output_ << R"(
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+)";
+}
+
+void JsCodeGenerator::GenerateFlatView(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    // Map entries are stored inline in their map field
+    if (!options_.flat || message_type.options().map_entry()) return;
+
+    FlatLayout layout = FlatLayout::Compute(message_type, GetPresenceFields(message_type));
+    std::string view_name = class_name + "View";
+
+    // Layout entry of a field, consumed by the packer in proto-flat.mjs
+    auto field_layout = [this](const FieldDescriptorProto& field, const FlatFieldLayout& slot) {
+        CodeWriter entry;
+        entry << "{name: \"" << SnakeToCamelCase(field.name()) << "\", "
+            << "type: \"" << FieldDescriptorProto::Type_Name(FlatLayout::GetStorageType(field)) << "\", "
+            << "offset: " << slot.offset;
+        if (std::string well_known_type = TypeHelper::GetWellKnownType(field); !well_known_type.empty()) {
+            entry << ", wkt: \"" << well_known_type << "\"";
+        }
+        if (slot.stride > 0) {
+            entry << ", repeated: true, stride: " << slot.stride;
+        }
+        if (slot.presence_bit >= 0) {
+            entry << ", has: " << slot.presence_bit;
+        }
+        if (slot.oneof_offset >= 0) {
+            entry << ", oneof: " << slot.oneof_offset << ", number: " << field.number();
+        }
+        return entry.Release();
+    };
+
+    output_ << indent << "// Zero-copy reader over the flat binary blob format\n";
+    output_ << indent << "static View = class " << view_name << " {\n";
+    output_ << indent << "    static __layout = {\n";
+    output_ << indent << "        size: " << layout.size << ",\n";
+    char hash[16];
+    std::snprintf(hash, sizeof(hash), "0x%08x", layout.hash);
+    output_ << indent << "        hash: " << hash << ",\n";
+    output_ << indent << "        presence: " << layout.presence_offset << ",\n";
+    output_ << indent << "        fields: [";
+    for (size_t i = 0; i < layout.fields.size(); ++i) {
+        const FlatFieldLayout& slot = layout.fields[i];
+        const FieldDescriptorProto& field = *slot.field;
+        output_ << (i == 0 ? "\n" : ",\n") << indent << "            " << field_layout(field, slot);
+        const DescriptorProto* entry = field.type() == FieldDescriptorProto::TYPE_MESSAGE ?
+            TypeHelper::FindMapEntry(message_type, field) : nullptr;
+        if (entry) {
+            FlatLayout entry_layout = FlatLayout::Compute(*entry, {});
+            output_ << ", map: [";
+            for (size_t j = 0; j < entry_layout.fields.size(); ++j) {
+                const FlatFieldLayout& entry_slot = entry_layout.fields[j];
+                output_ << (j == 0 ? "" : ", ") << field_layout(*entry_slot.field, entry_slot);
+                if (IsMessageField(*entry_slot.field)) {
+                    output_ << ", get view() { return " << GetFieldClassRef(*entry_slot.field) << ".View; }";
+                }
+                output_ << "}";
+            }
+            output_ << "]";
+        } else if (IsMessageField(field)) {
+            output_ << ", get view() { return " << GetFieldClassRef(field) << ".View; }";
+        }
+        output_ << "}";
+    }
+    output_ << (layout.fields.empty() ? "]\n" : "\n" + indent + "        ]\n");
+    output_ << indent << "    };\n\n";
+
+    // Open a blob whose root record is this message
+    output_ << indent << "    static open(buffer) {\n";
+    output_ << indent << "        const view = __flatOpen(buffer, " << view_name << ".__layout.hash);\n";
+    output_ << indent << "        return new " << view_name << "(view, view.getUint32(8, true));\n";
+    output_ << indent << "    }\n\n";
+
+    output_ << indent << "    constructor(view, offset) {\n";
+    output_ << indent << "        this.__view = view;\n";
+    output_ << indent << "        this.__offset = offset;\n";
+    output_ << indent << "    }\n";
+
+    // Oneof case getters
+    for (int oneof_index = 0; oneof_index < message_type.oneof_decl_size(); ++oneof_index) {
+        for (const FlatFieldLayout& slot : layout.fields) {
+            if (slot.oneof_offset >= 0 && slot.field->oneof_index() == oneof_index) {
+                output_ << "\n";
+                output_ << indent << "    get " << SnakeToCamelCase(message_type.oneof_decl(oneof_index).name()) << "Case() {\n";
+                output_ << indent << "        return __flatUint32(this.__view, this.__offset + " << slot.oneof_offset << ");\n";
+                output_ << indent << "    }\n";
+                break;
+            }
+        }
+    }
+
+    for (const FlatFieldLayout& slot : layout.fields) {
+        const FieldDescriptorProto& field = *slot.field;
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        std::string slot_ref = "this.__offset + " + std::to_string(slot.offset);
+        std::string view_ref = IsMessageField(field) ?
+            ", " + GetFieldClassRef(field) + ".View" : "";
+
+        output_ << "\n";
+        output_ << indent << "    get " << camel_case_name << "() {\n";
+        const DescriptorProto* entry = field.type() == FieldDescriptorProto::TYPE_MESSAGE ?
+            TypeHelper::FindMapEntry(message_type, field) : nullptr;
+        if (entry) {
+            FlatLayout entry_layout = FlatLayout::Compute(*entry, {});
+            const FlatFieldLayout& key = entry_layout.fields[0];
+            const FlatFieldLayout& value = entry_layout.fields[1];
+            std::string value_view = IsMessageField(*value.field) ?
+                GetFieldClassRef(*value.field) + ".View" : "undefined";
+            output_ << indent << "        return __flatMap(this.__view, " << slot_ref << ", " << slot.stride << ", "
+                << FlatLayout::GetReaderName(*key.field) << ", " << key.offset << ", "
+                << FlatLayout::GetReaderName(*value.field) << ", " << value.offset << ", " << value_view << ");\n";
+        } else if (slot.stride > 0) {
+            output_ << indent << "        return __flatList(this.__view, " << slot_ref << ", " << slot.stride << ", "
+                << FlatLayout::GetReaderName(field) << view_ref << ");\n";
+        } else {
+            std::string read = FlatLayout::GetReaderName(field) + "(this.__view, " + slot_ref + view_ref + ")";
+            if (slot.oneof_offset >= 0) {
+                output_ << indent << "        return __flatUint32(this.__view, this.__offset + " << slot.oneof_offset
+                    << ") === " << field.number() << " ? " << read << " : undefined;\n";
+            } else if (slot.presence_bit >= 0) {
+                output_ << indent << "        return (__flatUint32(this.__view, this.__offset + "
+                    << layout.presence_offset + slot.presence_bit / 32 * 4 << ") & " << GetBitMask(slot.presence_bit)
+                    << ") !== 0 ? " << read << " : undefined;\n";
+            } else {
+                output_ << indent << "        return " << read << ";\n";
+            }
+        }
+        output_ << indent << "    }\n";
+
+        // Presence query for fields that can be absent
+        bool has_presence = slot.presence_bit >= 0 ||
+            (IsMessageField(field) && slot.stride == 0 && slot.oneof_offset < 0);
+        if (has_presence) {
+            output_ << "\n";
+            output_ << indent << "    has" << SnakeToPascalCase(field.name()) << "() {\n";
+            output_ << indent << "        return this." << camel_case_name << " !== undefined;\n";
+            output_ << indent << "    }\n";
+        }
+    }
+
+    output_ << indent << "};\n\n";
+}
+
+void JsCodeGenerator::GenerateColumnHelpers() {
+    output_ << R"(// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
+)";
+}
+
+void JsCodeGenerator::GenerateColumns(
+    const DescriptorProto& message_type,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    if (!options_.columnar || message_type.options().map_entry()) return;
+
+    std::string columns_name = class_name + "Columns";
+    std::string row_name = class_name + "Row";
+
+    output_ << indent << "// Struct-of-arrays table over rows of this message\n";
+    output_ << indent << "static Columns = class " << columns_name << " extends __ColumnTable {\n";
+
+    // Row view reading one index out of the columns
+    output_ << indent << "    static Row = class " << row_name << " {\n";
+    output_ << indent << "        constructor(table, index) {\n";
+    output_ << indent << "            this.__table = table;\n";
+    output_ << indent << "            this.__index = index;\n";
+    output_ << indent << "        }\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        std::string kind = GetColumnKind(field);
+        output_ << "\n";
+        output_ << indent << "        get " << camel_case_name << "() {\n";
+        if (kind == "string") {
+            output_ << indent << "            const table = this.__table;\n";
+            output_ << indent << "            return table.dictionaries." << camel_case_name
+                << "[table.columns." << camel_case_name << "[this.__index]];\n";
+        } else if (kind == "Uint8Array") {
+            output_ << indent << "            return this.__table.columns." << camel_case_name << "[this.__index] !== 0;\n";
+        } else {
+            output_ << indent << "            return this.__table.columns." << camel_case_name << "[this.__index];\n";
+        }
+        output_ << indent << "        }\n";
+    }
+    output_ << indent << "    };\n\n";
+
+    // Column storage
+    output_ << indent << "    constructor(length) {\n";
+    output_ << indent << "        super();\n";
+    output_ << indent << "        this.length = length;\n";
+    output_ << indent << "        this.dictionaries = {";
+    bool first = true;
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (GetColumnKind(field) != "string") continue;
+        output_ << (first ? "" : ", ") << SnakeToCamelCase(field.name()) << ": []";
+        first = false;
+    }
+    output_ << "};\n";
+    output_ << indent << "        this.columns = {\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        std::string kind = GetColumnKind(field);
+        output_ << indent << "            " << SnakeToCamelCase(field.name()) << ": new "
+            << (kind == "string" ? "Uint32Array" : kind) << "(length),\n";
+    }
+    output_ << indent << "        };\n";
+    output_ << indent << "    }\n\n";
+
+    // Build from an array of message instances or JSON rows
+    output_ << indent << "    static fromRows(rows) {\n";
+    output_ << indent << "        const table = new " << columns_name << "(rows.length);\n";
+    output_ << indent << "        const { columns, dictionaries } = table;\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (GetColumnKind(field) == "string") {
+            output_ << indent << "        const " << SnakeToCamelCase(field.name()) << "Codes = new Map();\n";
+        }
+    }
+    output_ << indent << "        for (let i = 0; i < rows.length; i++) {\n";
+    output_ << indent << "            const row = rows[i];\n";
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        std::string camel_case_name = SnakeToCamelCase(field.name());
+        std::string kind = GetColumnKind(field);
+        output_ << indent << "            columns." << camel_case_name << "[i] = ";
+        if (kind == "string") {
+            output_ << "__columnEncode(" << camel_case_name << "Codes, dictionaries." << camel_case_name
+                << ", row." << camel_case_name << " ?? \"\");\n";
+        } else if (kind == "Uint8Array") {
+            output_ << "row." << camel_case_name << " ? 1 : 0;\n";
+        } else if (kind == "Array") {
+            output_ << "row." << camel_case_name << ";\n";
+        } else {
+            output_ << "row." << camel_case_name << " ?? " << GetFieldDefaultValue(field) << ";\n";
+        }
+    }
+    output_ << indent << "        }\n";
+    output_ << indent << "        return table;\n";
+    output_ << indent << "    }\n";
+    output_ << indent << "};\n\n";
+}
+
+std::string JsCodeGenerator::GetColumnKind(const FieldDescriptorProto& field) const {
+
+    // Repeated, message, bytes and maybe-absent fields keep their values as is
+    if (field.label() == FieldDescriptorProto::LABEL_REPEATED || IsRealOneofField(field) ||
+        GetPresenceBit(field) >= 0) {
+        return "Array";
+    }
+    switch (field.type()) {
+        case FieldDescriptorProto::TYPE_BOOL:
+            return "Uint8Array";
+        case FieldDescriptorProto::TYPE_INT32:
+        case FieldDescriptorProto::TYPE_SINT32:
+        case FieldDescriptorProto::TYPE_SFIXED32:
+        case FieldDescriptorProto::TYPE_ENUM:
+            return "Int32Array";
+        case FieldDescriptorProto::TYPE_UINT32:
+        case FieldDescriptorProto::TYPE_FIXED32:
+            return "Uint32Array";
+        case FieldDescriptorProto::TYPE_FLOAT:
+            return "Float32Array";
+        case FieldDescriptorProto::TYPE_INT64:
+        case FieldDescriptorProto::TYPE_SINT64:
+        case FieldDescriptorProto::TYPE_SFIXED64:
+        case FieldDescriptorProto::TYPE_UINT64:
+        case FieldDescriptorProto::TYPE_FIXED64:
+            // Mixed numbers and bigints (hybrid) or decimal strings stay as is
+            if (options_.int64 == Int64Mode::kBigInt) {
+                bool is_unsigned = field.type() == FieldDescriptorProto::TYPE_UINT64 ||
+                    field.type() == FieldDescriptorProto::TYPE_FIXED64;
+                return is_unsigned ? "BigUint64Array" : "BigInt64Array";
+            }
+            return options_.int64 == Int64Mode::kNumber ? "Float64Array" : "Array";
+        case FieldDescriptorProto::TYPE_DOUBLE:
+            return "Float64Array";
+        case FieldDescriptorProto::TYPE_STRING:
+            return "string";
+        default:
+            return "Array";
+    }
+}
+
+void JsCodeGenerator::GenerateFieldMethods(
+    const DescriptorProto& message_type,
+    const FieldDescriptorProto& field,
+    const std::string& indent,
+    const std::string& class_name) {
+
+    // Naming variants resolved by the schema
+    const FieldSchema* schema = file_.FindField(field);
+    std::string camel_case_name = schema ? schema->camel_name : SnakeToCamelCase(field.name());
+    std::string pascal_case_name = schema ? schema->pascal_name : SnakeToPascalCase(field.name());
+
+    // Field type mapping
+    std::string js_type = GetFieldJsType(field);
+    bool lazy = IsLazyField(field);
+
+    if (IsRealOneofField(field)) {
+        // Oneof members are accessors over the shared storage slot
+        std::string oneof_name = SnakeToCamelCase(message_type.oneof_decl(field.oneof_index()).name());
+        output_ << indent << "/** @type {" << js_type << "|undefined} */\n";
+        output_ << indent << "get " << camel_case_name << "() {\n";
+        output_ << indent << "    return this." << oneof_name << "Case === " << field.number()
+            << " ? this.__" << oneof_name << " : undefined;\n";
+        output_ << indent << "}\n";
+        output_ << indent << "set " << camel_case_name << "(value) {\n";
+        GenerateMutationMarks(message_type, field, CodeWriter::Deeper(indent));
+        output_ << indent << "    if (value === undefined || value === null) {\n";
+        output_ << indent << "        if (this." << oneof_name << "Case === " << field.number() << ") {\n";
+        output_ << indent << "            this.__" << oneof_name << " = undefined;\n";
+        output_ << indent << "            this." << oneof_name << "Case = 0;\n";
+        output_ << indent << "        }\n";
+        output_ << indent << "        return;\n";
+        output_ << indent << "    }\n";
+        output_ << indent << "    this.__" << oneof_name << " = value;\n";
+        output_ << indent << "    this." << oneof_name << "Case = " << field.number() << ";\n";
+        output_ << indent << "}\n\n";
+    } else if (int bit = GetPresenceBit(field); bit >= 0) {
+        // Presence-tracked fields are accessors over a backing field and a bit
+        std::string slot = "this." + GetPresenceSlotName(bit);
+        std::string mask = GetBitMask(bit);
+        output_ << indent << "__" << camel_case_name << " = undefined;\n";
+        if (lazy) {
+            output_ << indent << "__" << camel_case_name << "Raw = undefined;\n";
+        }
+        output_ << "\n";
+        output_ << indent << "/** @type {" << js_type << "|undefined} */\n";
+        output_ << indent << "get " << camel_case_name << "() {\n";
+        if (lazy) {
+            GenerateLazyMaterialize(message_type, field, CodeWriter::Deeper(indent), class_name);
+        }
+        output_ << indent << "    return this.__" << camel_case_name << ";\n";
+        output_ << indent << "}\n";
+        output_ << indent << "set " << camel_case_name << "(value) {\n";
+        GenerateMutationMarks(message_type, field, CodeWriter::Deeper(indent));
+        if (lazy) {
+            output_ << indent << "    this.__" << camel_case_name << "Raw = undefined;\n";
+        }
+        output_ << indent << "    if (value === undefined || value === null) {\n";
+        output_ << indent << "        this.__" << camel_case_name << " = undefined;\n";
+        output_ << indent << "        " << slot << " &= ~" << mask << ";\n";
+        output_ << indent << "    } else {\n";
+        output_ << indent << "        this.__" << camel_case_name << " = value;\n";
+        output_ << indent << "        " << slot << " |= " << mask << ";\n";
+        output_ << indent << "    }\n";
+        output_ << indent << "}\n\n";
+
+        // hasXxx method
+        output_ << indent << "/** \n";
+        output_ << indent << " * @return {boolean} \n";
+        output_ << indent << " */\n";
+        output_ << indent << "has" << pascal_case_name << "() {\n";
+        output_ << indent << "    return (" << slot << " & " << mask << ") !== 0;\n";
+        output_ << indent << "}\n\n";
+
+        // clearXxx method
+        output_ << indent << "/** \n";
+        output_ << indent << " * @return {" << class_name << "} \n";
+        output_ << indent << " */\n";
+        output_ << indent << "clear" << pascal_case_name << "() {\n";
+        GenerateMutationMarks(message_type, field, CodeWriter::Deeper(indent));
+        output_ << indent << "    this.__" << camel_case_name << " = undefined;\n";
+        if (lazy) {
+            output_ << indent << "    this.__" << camel_case_name << "Raw = undefined;\n";
+        }
+        output_ << indent << "    " << slot << " &= ~" << mask << ";\n";
+        output_ << indent << "    return this;\n";
+        output_ << indent << "}\n\n";
+    } else if (lazy) {
+        // Lazy repeated fields are accessors over the decoded array and its JSON
+        output_ << indent << "__" << camel_case_name << " = undefined;\n";
+        output_ << indent << "__" << camel_case_name << "Raw = undefined;\n\n";
+        output_ << indent << "/** @type {" << js_type << "} */\n";
+        output_ << indent << "get " << camel_case_name << "() {\n";
+        GenerateLazyMaterialize(message_type, field, CodeWriter::Deeper(indent), class_name);
+        output_ << indent << "    return this.__" << camel_case_name << ";\n";
+        output_ << indent << "}\n";
+        output_ << indent << "set " << camel_case_name << "(value) {\n";
+        if (options_.passthrough) {
+            output_ << indent << "    this.__rawStale = true;\n";
+        }
+        output_ << indent << "    this.__" << camel_case_name << "Raw = undefined;\n";
+        output_ << indent << "    this.__" << camel_case_name << " = value;\n";
+        output_ << indent << "}\n\n";
+    } else if (options_.passthrough) {
+        // Pass-through needs every assignment to drop the retained JSON
+        output_ << indent << "__" << camel_case_name << " = undefined;\n\n";
+        output_ << indent << "/** @type {" << js_type << "} */\n";
+        output_ << indent << "get " << camel_case_name << "() {\n";
+        output_ << indent << "    return this.__" << camel_case_name << ";\n";
+        output_ << indent << "}\n";
+        output_ << indent << "set " << camel_case_name << "(value) {\n";
+        output_ << indent << "    this.__rawStale = true;\n";
+        output_ << indent << "    this.__" << camel_case_name << " = value;\n";
+        output_ << indent << "}\n\n";
+    } else {
+        // Public field declaration
+        output_ << indent << "/** @type {" << js_type << "} */\n";
+        output_ << indent << camel_case_name << ";\n\n";
+    }
+
+    // withXxx method (supports fluent chaining)
+    output_ << indent << "/** \n";
+    output_ << indent << " * @param {" << js_type << "} value \n";
+    output_ << indent << " * @return {" << class_name << "} \n";
+    output_ << indent << " */\n";
+    output_ << indent << "with" << TypeHelper::GetMethodName(field) << "(value) {\n";
+    output_ << indent << "    this." << camel_case_name << " = value;\n";
+    // Accessor setters mark themselves, plain fields are marked here
+    if (!IsRealOneofField(field) && GetPresenceBit(field) < 0) {
+        GenerateMutationMarks(message_type, field, CodeWriter::Deeper(indent));
+    }
+    output_ << indent << "    return this;\n";
+    output_ << indent << "}\n\n";
+}
+
+std::string JsCodeGenerator::GetFieldJsType(const FieldDescriptorProto& field) const {
+    if (options_.timestamp_number && TypeHelper::GetWellKnownType(field) == "Timestamp") {
+        // Epoch milliseconds instead of Date
+        return field.label() == FieldDescriptorProto::LABEL_REPEATED ? "number[]" : "number";
+    }
+    if (TypeHelper::IsMapField(field)) {
+        // JSON serialization doesn't support Map type
+        return "any";
+    }
+
+    std::string base_type;
+    if (IsMessageField(field)) {
+        base_type = GetFieldClassRef(field);
     } else if (field.type() == FieldDescriptorProto::TYPE_ENUM) {
-        // For enums, return the last component (enum name)
-        // Remove leading dot if present
-        std::string type_name = field.type_name();
-        if (!type_name.empty() && type_name[0] == '.') {
-            type_name = type_name.substr(1);
+        std::string enum_ref = GetFieldClassRef(field);
+        base_type = enum_ref + "[keyof typeof " + enum_ref + "]";
+    } else if (IsInt64Field(field)) {
+        base_type = options_.int64 == Int64Mode::kBigInt ? "bigint" :
+            options_.int64 == Int64Mode::kString ? "string" : "(number|bigint)";
+    } else {
+        base_type = TypeHelper::GetBaseJsType(field, proto_file_);
+    }
+    return field.label() == FieldDescriptorProto::LABEL_REPEATED ? base_type + "[]" : base_type;
+}
+
+std::string JsCodeGenerator::GetFieldClassRef(const FieldDescriptorProto& field) const {
+    // Only message and enum types need class references
+    if (!IsMessageField(field) && field.type() != FieldDescriptorProto::TYPE_ENUM) {
+        return "";
+    }
+
+    const FieldSchema* schema = file_.FindField(field);
+    if (schema == nullptr || schema->type == nullptr) {
+        // Unresolved type, fall back to its name
+        return TypeHelper::GetMessageTypeName(field.type_name(), proto_file_);
+    }
+
+    // External types through the namespace import of their module
+    const TypeResolver::Symbol& type = *schema->type;
+    if (schema->import != nullptr) {
+        return schema->import->alias + "." + type.path;
+    }
+
+    // Local top-level types by name, nested messages as their module-private
+    // class and nested enums as static members of their parent class
+    size_t pos = type.path.find_last_of('.');
+    if (pos == std::string::npos) {
+        return type.path;
+    }
+    if (field.type() == FieldDescriptorProto::TYPE_MESSAGE) {
+        return TypeHelper::GetIndependentClassName(type.full_name, &proto_file_);
+    }
+    std::string parent_path = type.path.substr(0, pos);
+    std::string parent_ref = parent_path.find('.') == std::string::npos ? parent_path :
+        TypeHelper::GetIndependentClassName(type.full_name.substr(0, type.full_name.find_last_of('.')), &proto_file_);
+    return parent_ref + "." + type.path.substr(pos + 1);
+}
+
+bool JsCodeGenerator::IsInternField(const FieldDescriptorProto& field) const {
+    if (field.type() != FieldDescriptorProto::TYPE_STRING) return false;
+    if (options_.intern_strings) return true;
+    if (intern_extension_number_ == 0 || !field.has_options()) return false;
+
+    // The extension is unknown to the plugin, so it arrives as an unknown field
+    uint64_t value = 0;
+    return GetUnknownVarint(field.options(), intern_extension_number_, &value) && value != 0;
+}
+
+bool JsCodeGenerator::GetFrameIds(
+    const DescriptorProto& message_type,
+    uint64_t* module_id,
+    uint64_t* message_id,
+    const EnumDescriptorProto** message_id_enum) const {
+
+    if (!message_type.has_options()) return false;
+
+    // Every module declares its own message_id extension over its MessageId enum
+    for (const FieldDescriptorProto* extension : message_id_extensions_) {
+        if (!GetUnknownVarint(message_type.options(), extension->number(), message_id)) continue;
+
+        *module_id = 0;
+        const EnumDescriptorProto* enum_type = type_resolver_.FindEnum(extension->type_name());
+        if (enum_type != nullptr && enum_type->has_options() && module_id_extension_number_ != 0) {
+            GetUnknownVarint(enum_type->options(), module_id_extension_number_, module_id);
+        }
+        if (message_id_enum != nullptr) {
+            *message_id_enum = enum_type;
         }
-        size_t pos = type_name.find_last_of('.');
-        if (pos != std::string::npos) {
-            return type_name.substr(pos + 1);
+        return true;
+    }
+    return false;
+}
+
+void JsCodeGenerator::GenerateClient() {
+    struct Call {
+        std::string method;
+        std::string request_class;
+        std::string response_class;  // empty for one-way requests
+    };
+
+    // Message id names of the module's top-level messages, e.g. "LOGIN_REQUEST"
+    uint64_t module_id = 0;
+    std::vector<std::pair<std::string, std::string>> id_names;  // (id name, class name)
+    for (const DescriptorProto& message_type : proto_file_.message_type()) {
+        uint64_t message_id = 0;
+        const EnumDescriptorProto* message_id_enum = nullptr;
+        if (!GetFrameIds(message_type, &module_id, &message_id, &message_id_enum) || message_id_enum == nullptr) {
+            continue;
+        }
+        for (const auto& value : message_id_enum->value()) {
+            if (static_cast<uint64_t>(value.number()) == message_id) {
+                id_names.emplace_back(StripEnumValuePrefix(message_id_enum->name(), value.name()), message_type.name());
+                break;
+            }
         }
-        return type_name;
     }
 
-    return "";
+    // Pair X_REQUEST with X_RESPONSE; requests without a response are one-way
+    const std::string kRequestSuffix = "_REQUEST";
+    const std::string kResponseSuffix = "_RESPONSE";
+    std::vector<Call> calls;
+    for (const auto& [id_name, class_name] : id_names) {
+        if (id_name.size() <= kRequestSuffix.size() ||
+            id_name.compare(id_name.size() - kRequestSuffix.size(), kRequestSuffix.size(), kRequestSuffix) != 0) {
+            continue;
+        }
+        std::string base = id_name.substr(0, id_name.size() - kRequestSuffix.size());
+        Call call;
+        std::string lower_base = base;
+        std::transform(lower_base.begin(), lower_base.end(), lower_base.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        call.method = SnakeToCamelCase(lower_base);
+        call.request_class = class_name;
+        for (const auto& [response_name, response_class] : id_names) {
+            if (response_name == base + kResponseSuffix) {
+                call.response_class = response_class;
+                break;
+            }
+        }
+        calls.push_back(std::move(call));
+    }
+    if (calls.empty()) {
+        return;
+    }
+
+    // Client class named after the module, e.g. MODULE_ID_USER -> UserClient
+    std::string module_name;
+    std::vector<const FieldDescriptorProto*> module_id_extensions =
+        type_resolver_.FindExtensions(".google.protobuf.EnumOptions", "module_id");
+    if (!module_id_extensions.empty()) {
+        if (const EnumDescriptorProto* module_enum = type_resolver_.FindEnum(module_id_extensions[0]->type_name())) {
+            for (const auto& value : module_enum->value()) {
+                if (static_cast<uint64_t>(value.number()) == module_id) {
+                    module_name = StripEnumValuePrefix(module_enum->name(), value.name());
+                    break;
+                }
+            }
+        }
+    }
+    if (module_name.empty()) {
+        // Without a module id, fall back to the file name
+        std::string file_name = proto_file_.name();
+        size_t slash_pos = file_name.find_last_of('/');
+        module_name = file_name.substr(slash_pos == std::string::npos ? 0 : slash_pos + 1);
+        module_name = module_name.substr(0, module_name.find('.'));
+    }
+    std::transform(module_name.begin(), module_name.end(), module_name.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    std::string client_name = SnakeToPascalCase(module_name) + "Client";
+
+    output_ << "// Client stub: request/response pairs of the module's message ids\n";
+    output_ << "export class " << client_name << " {\n";
+    output_ << "    static __calls = [\n";
+    for (const Call& call : calls) {
+        output_ << "        {name: \"" << call.method << "\", get requestType() { return " << call.request_class << "; }";
+        if (!call.response_class.empty()) {
+            output_ << ", get responseType() { return " << call.response_class << "; }";
+        }
+        output_ << "},\n";
+    }
+    output_ << "    ];\n\n";
+
+    output_ << "    /**\n";
+    output_ << "     * @param {{call: function(Object, Function, Object=): Promise<Object>, send: function(Object): void}} channel\n";
+    output_ << "     *     RpcChannel of proto-rpc.mjs, or any object with the same call/send methods\n";
+    output_ << "     */\n";
+    output_ << "    constructor(channel) {\n";
+    output_ << "        this.channel = channel;\n";
+    output_ << "    }\n";
+
+    for (const Call& call : calls) {
+        output_ << "\n";
+        output_ << "    /**\n";
+        output_ << "     * @param {" << call.request_class << "} request\n";
+        if (call.response_class.empty()) {
+            output_ << "     */\n";
+            output_ << "    " << call.method << "(request) {\n";
+            output_ << "        this.channel.send(request);\n";
+        } else {
+            output_ << "     * @param {{timeout?: number}} [options]\n";
+            output_ << "     * @returns {Promise<" << call.response_class << ">}\n";
+            output_ << "     */\n";
+            output_ << "    " << call.method << "(request, options) {\n";
+            output_ << "        return this.channel.call(request, " << call.response_class << ", options);\n";
+        }
+        output_ << "    }\n";
+    }
+    output_ << "}\n\n";
+}
+
+void JsCodeGenerator::GenerateFrameIds(const DescriptorProto& message_type, const std::string& indent) {
+    uint64_t module_id = 0;
+    uint64_t message_id = 0;
+    if (!options_.framing || !GetFrameIds(message_type, &module_id, &message_id)) return;
+
+    output_ << indent << "        moduleId: " << module_id << ",\n";
+    output_ << indent << "        messageId: " << message_id << ",\n";
+}
+
+std::string JsCodeGenerator::GetFieldDefaultValue(
+    const google::protobuf::FieldDescriptorProto& field) {
+
+    if (IsInt64Field(field) && field.label() != FieldDescriptorProto::LABEL_REPEATED) {
+        return options_.int64 == Int64Mode::kBigInt ? "0n" :
+            options_.int64 == Int64Mode::kString ? "\"0\"" : "0";
+    }
+    if (field.type() != FieldDescriptorProto::TYPE_ENUM ||
+        field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+        return TypeHelper::GetJsDefaultValue(field, proto_file_);
+    }
+
+    // Enum default is the first declared value
+    const EnumDescriptorProto* enum_type = type_resolver_.FindEnum(field.type_name());
+    if (!enum_type || enum_type->value_size() == 0) {
+        return TypeHelper::GetJsDefaultValue(field, proto_file_);
+    }
+
+    const auto& value = enum_type->value(0);
+    if (options_.enum_inline) {
+        return std::to_string(value.number());
+    }
+    return GetFieldClassRef(field) + "." + StripEnumValuePrefix(enum_type->name(), value.name());
 }
 }
\ No newline at end of file
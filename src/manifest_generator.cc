@@ -0,0 +1,148 @@
+#include "manifest_generator.h"
+
+#include <set>
+#include <string>
+
+#include "schema.h"
+#include "sha256.h"
+
+namespace protoc_js_gen_plugin {
+
+namespace {
+
+using google::protobuf::FileDescriptorProto;
+using google::protobuf::compiler::CodeGeneratorResponse;
+
+// Proto files shipped with protoc rather than found under manifest_root
+constexpr char kBundledProtoPrefix[] = "google/protobuf/";
+
+// JSON string literal
+std::string JsonString(const std::string& value) {
+    static const char kHexDigits[] = "0123456789abcdef";
+    std::string result = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            result += "\\u00";
+            result += kHexDigits[(c >> 4) & 0xf];
+            result += kHexDigits[c & 0xf];
+        } else {
+            result += c;
+        }
+    }
+    return result + "\"";
+}
+
+// Path escaped for a Make/Ninja depfile
+std::string DepfilePath(const std::string& path) {
+    std::string result;
+    for (char c : path) {
+        if (c == ' ' || c == '#' || c == '\\') {
+            result += '\\';
+        } else if (c == '$') {
+            result += '$';
+        }
+        result += c;
+    }
+    return result;
+}
+
+}  // namespace
+
+ManifestGenerator::ManifestGenerator(
+    const Schema& schema,
+    const CodeGeneratorResponse& response,
+    const GeneratorOptions& options)
+    : schema_(schema),
+    response_(response),
+    options_(options) {
+    for (const FileDescriptorProto* proto_file : schema.all_proto_files()) {
+        proto_files_[proto_file->name()] = proto_file;
+    }
+}
+
+std::string ManifestGenerator::GenerateManifest() {
+    output_.Reset(256 + 256 * static_cast<size_t>(response_.file_size()));
+
+    output_ << "{\n";
+    output_ << "  \"generator\": \"protoc-gen-js-mjs\",\n";
+    output_ << "  \"depfile\": " << JsonString(GetDepfileName(options_.manifest_file)) << ",\n";
+    output_ << "  \"files\": [";
+    for (int i = 0; i < response_.file_size(); ++i) {
+        const CodeGeneratorResponse::File& file = response_.file(i);
+        output_ << (i == 0 ? "\n" : ",\n");
+        output_ << "    {\n";
+        output_ << "      \"name\": " << JsonString(file.name()) << ",\n";
+        output_ << "      \"sha256\": \"" << Sha256Hex(file.content()) << "\",\n";
+        output_ << "      \"size\": " << file.content().size() << ",\n";
+        output_ << "      \"dependencies\": [";
+        bool first = true;
+        for (const std::string& dependency : GetDependencies(file.name())) {
+            output_ << (first ? "\n" : ",\n") << "        " << JsonString(dependency);
+            first = false;
+        }
+        output_ << (first ? "]\n" : "\n      ]\n");
+        output_ << "    }";
+    }
+    output_ << (response_.file_size() == 0 ? "]\n" : "\n  ]\n");
+    output_ << "}\n";
+
+    return output_.Release();
+}
+
+std::string ManifestGenerator::GenerateDepfile() {
+    output_.Reset(256 * static_cast<size_t>(response_.file_size()));
+
+    for (const CodeGeneratorResponse::File& file : response_.file()) {
+        output_ << DepfilePath(options_.output_root + file.name()) << ":";
+        for (const std::string& dependency : GetDependencies(file.name())) {
+            if (!options_.manifest_root.empty() && dependency.rfind(kBundledProtoPrefix, 0) == 0) {
+                continue;
+            }
+            output_ << " \\\n  " << DepfilePath(options_.manifest_root + dependency);
+        }
+        output_ << "\n";
+    }
+
+    return output_.Release();
+}
+
+std::string ManifestGenerator::GetDepfileName(const std::string& manifest_file) {
+    // The option parser guarantees the .json extension
+    return manifest_file.substr(0, manifest_file.size() - 5) + ".d";
+}
+
+std::set<std::string> ManifestGenerator::GetDependencies(const std::string& output_name) const {
+    std::set<std::string> closure;
+    for (const FileSchema& file : schema_.files()) {
+        if (file.output_name == output_name) {
+            CollectDependencies(file.proto->name(), &closure);
+            return closure;
+        }
+    }
+
+    // Request-wide outputs such as the registry depend on every generated file
+    for (const FileSchema& file : schema_.files()) {
+        CollectDependencies(file.proto->name(), &closure);
+    }
+    return closure;
+}
+
+void ManifestGenerator::CollectDependencies(
+    const std::string& proto_file, std::set<std::string>* closure) const {
+
+    if (!closure->insert(proto_file).second) {
+        return;
+    }
+    auto it = proto_files_.find(proto_file);
+    if (it == proto_files_.end()) {
+        return;
+    }
+    for (const std::string& dependency : it->second->dependency()) {
+        CollectDependencies(dependency, closure);
+    }
+}
+
+}  // namespace protoc_js_gen_plugin
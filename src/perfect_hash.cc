@@ -0,0 +1,79 @@
+#include "perfect_hash.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace protoc_js_gen_plugin {
+
+uint32_t PerfectHash::Hash(uint32_t seed, const std::string& key) {
+    uint32_t hash = seed ^ 2166136261u;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+PerfectHash PerfectHash::Build(const std::vector<std::string>& keys) {
+    const size_t n = keys.size();
+    PerfectHash result;
+    result.seeds.assign(n, 0);
+    result.slots.assign(n, -1);
+    if (n == 0) {
+        return result;
+    }
+
+    std::vector<std::vector<int>> buckets(n);
+    for (size_t i = 0; i < n; ++i) {
+        buckets[Hash(0, keys[i]) % n].push_back(static_cast<int>(i));
+    }
+
+    // Place the largest buckets first while most slots are still free
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    std::vector<uint32_t> candidate;
+    size_t next_free = 0;
+    for (size_t bucket_index : order) {
+        const std::vector<int>& bucket = buckets[bucket_index];
+        if (bucket.empty()) {
+            break;
+        }
+
+        if (bucket.size() == 1) {
+            while (result.slots[next_free] != -1) ++next_free;
+            result.slots[next_free] = bucket[0];
+            result.seeds[bucket_index] = -static_cast<int32_t>(next_free) - 1;
+            continue;
+        }
+
+        for (uint32_t seed = 1;; ++seed) {
+            candidate.clear();
+            bool placed = true;
+            for (int key_index : bucket) {
+                uint32_t slot = Hash(seed, keys[key_index]) % n;
+                if (result.slots[slot] != -1 ||
+                    std::find(candidate.begin(), candidate.end(), slot) != candidate.end()) {
+                    placed = false;
+                    break;
+                }
+                candidate.push_back(slot);
+            }
+            if (placed) {
+                for (size_t i = 0; i < bucket.size(); ++i) {
+                    result.slots[candidate[i]] = bucket[i];
+                }
+                result.seeds[bucket_index] = static_cast<int32_t>(seed);
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace protoc_js_gen_plugin
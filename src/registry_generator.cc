@@ -0,0 +1,157 @@
+#include "registry_generator.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "import_planner.h"
+#include "perfect_hash.h"
+#include "schema.h"
+#include "type_resolver.h"
+
+namespace protoc_js_gen_plugin {
+
+RegistryGenerator::RegistryGenerator(const Schema& schema, const GeneratorOptions& options)
+    : type_resolver_(schema.type_resolver()),
+    options_(options) {
+    for (const FileSchema& file : schema.files()) {
+        generated_files_.push_back(file.proto->name());
+    }
+}
+
+std::string RegistryGenerator::Generate() {
+    // Only types of generated files have a module to import
+    std::vector<const TypeResolver::Symbol*> symbols;
+    std::vector<std::string> names;
+    for (const TypeResolver::Symbol& symbol : type_resolver_.GetSymbols()) {
+        if (std::find(generated_files_.begin(), generated_files_.end(), symbol.proto_file) != generated_files_.end()) {
+            symbols.push_back(&symbol);
+            names.push_back(symbol.full_name);
+        }
+    }
+    PerfectHash hash = PerfectHash::Build(names);
+
+    // Four lines of tables per name, plus the fixed lookup functions
+    output_.Reset(4096 + 128 * names.size() + 128 * generated_files_.size());
+
+    output_ << "// Generated by protoc-gen-js-mjs\n";
+    output_ << "// Type registry: " << names.size() << " messages and enums in "
+        << generated_files_.size() << " files\n\n";
+
+    // Perfect hash seeds
+    output_ << "// Perfect hash buckets: a displacement seed, or -(slot + 1) for a single name\n";
+    output_ << "const __seeds = new Int32Array([";
+    for (size_t i = 0; i < hash.seeds.size(); ++i) {
+        output_ << (i % 16 == 0 ? "\n    " : " ") << hash.seeds[i] << ",";
+    }
+    output_ << (hash.seeds.empty() ? "" : "\n") << "]);\n\n";
+
+    // Slot tables
+    output_ << "// Full name, module and export path of each slot\n";
+    output_ << "const __names = [";
+    for (int key_index : hash.slots) {
+        output_ << "\n    \"" << symbols[key_index]->full_name << "\",";
+    }
+    output_ << (hash.slots.empty() ? "" : "\n") << "];\n";
+
+    output_ << "const __modules = new Uint16Array([";
+    for (size_t i = 0; i < hash.slots.size(); ++i) {
+        const std::string& proto_file = symbols[hash.slots[i]]->proto_file;
+        size_t module_index = std::find(generated_files_.begin(), generated_files_.end(), proto_file) - generated_files_.begin();
+        output_ << (i % 16 == 0 ? "\n    " : " ") << module_index << ",";
+    }
+    output_ << (hash.slots.empty() ? "" : "\n") << "]);\n";
+
+    output_ << "const __paths = [";
+    for (int key_index : hash.slots) {
+        output_ << "\n    \"" << symbols[key_index]->path << "\",";
+    }
+    output_ << (hash.slots.empty() ? "" : "\n") << "];\n\n";
+
+    // One loader per module so bundlers can split them
+    output_ << "// Module loaders, imported on first resolve\n";
+    output_ << "const __loaders = [";
+    ImportPlanner import_planner;
+    for (const std::string& proto_file : generated_files_) {
+        output_ << "\n    () => import('" << import_planner.GetImportPath(options_.registry_file, proto_file) << "'),";
+    }
+    output_ << (generated_files_.empty() ? "" : "\n") << "];\n";
+    output_ << "const __imports = new Array(__loaders.length);\n";
+    output_ << "const __types = new Array(__names.length);\n\n";
+
+    output_ << "function __hashName(seed, name) {\n";
+    output_ << "    let hash = (seed ^ 0x811c9dc5) >>> 0;\n";
+    output_ << "    for (let i = 0; i < name.length; i++) {\n";
+    output_ << "        hash = Math.imul(hash ^ name.charCodeAt(i), 0x01000193);\n";
+    output_ << "    }\n";
+    output_ << "    return hash >>> 0;\n";
+    output_ << "}\n\n";
+
+    output_ << "/** \n";
+    output_ << " * Slot of a registered full name\n";
+    output_ << " * @param {string} fullName full name, optionally with a leading dot\n";
+    output_ << " * @return {number} slot index, -1 if the name is not registered\n";
+    output_ << " */\n";
+    output_ << "export function findTypeSlot(fullName) {\n";
+    output_ << "    if (fullName.charCodeAt(0) === 46) fullName = fullName.substring(1);\n";
+    output_ << "    const seed = __seeds[__hashName(0, fullName) % __seeds.length];\n";
+    output_ << "    const slot = seed < 0 ? -seed - 1 : __hashName(seed, fullName) % __seeds.length;\n";
+    output_ << "    return __names[slot] === fullName ? slot : -1;\n";
+    output_ << "}\n\n";
+
+    output_ << "/** \n";
+    output_ << " * @param {string} fullName \n";
+    output_ << " * @return {boolean} whether the registry knows the full name\n";
+    output_ << " */\n";
+    output_ << "export function hasType(fullName) {\n";
+    output_ << "    return findTypeSlot(fullName) !== -1;\n";
+    output_ << "}\n\n";
+
+    output_ << "/** \n";
+    output_ << " * Class or enum of a full name whose module has already been loaded\n";
+    output_ << " * @param {string} fullName \n";
+    output_ << " * @return {Function|Object|undefined} \n";
+    output_ << " */\n";
+    output_ << "export function getType(fullName) {\n";
+    output_ << "    const slot = findTypeSlot(fullName);\n";
+    output_ << "    return slot === -1 ? undefined : __types[slot];\n";
+    output_ << "}\n\n";
+
+    output_ << "/** \n";
+    output_ << " * Import the module declaring a full name and resolve its class or enum\n";
+    output_ << " * @param {string} fullName \n";
+    output_ << " * @return {Promise<Function|Object|undefined>} undefined if the name is not registered\n";
+    output_ << " */\n";
+    output_ << "export function loadType(fullName) {\n";
+    output_ << "    const slot = findTypeSlot(fullName);\n";
+    output_ << "    if (slot === -1) return Promise.resolve(undefined);\n";
+    output_ << "    if (__types[slot] !== undefined) return Promise.resolve(__types[slot]);\n";
+    output_ << "    const index = __modules[slot];\n";
+    // A failed import is not kept, the next call retries it
+    output_ << "    __imports[index] \?\?= __loaders[index]().catch(error => {\n";
+    output_ << "        __imports[index] = undefined;\n";
+    output_ << "        throw error;\n";
+    output_ << "    });\n";
+    output_ << "    return __imports[index].then(module => {\n";
+    output_ << "        let type = module;\n";
+    output_ << "        for (const key of __paths[slot].split('.')) type = type[key];\n";
+    output_ << "        return __types[slot] = type;\n";
+    output_ << "    });\n";
+    output_ << "}\n\n";
+
+    output_ << "/** \n";
+    output_ << " * Resolve the type of a google.protobuf.Any type URL\n";
+    output_ << " * @param {string} typeUrl e.g. \"type.googleapis.com/pokeworld.Detail\"\n";
+    output_ << " * @return {Promise<Function|Object|undefined>} \n";
+    output_ << " */\n";
+    output_ << "export function loadTypeByUrl(typeUrl) {\n";
+    output_ << "    return loadType(typeUrl.substring(typeUrl.lastIndexOf('/') + 1));\n";
+    output_ << "}\n\n";
+
+    output_ << "/** @type {ReadonlyArray<string>} all registered full names, in slot order */\n";
+    output_ << "export const typeNames = Object.freeze(__names.slice());\n";
+
+    return output_.Release();
+}
+
+}  // namespace protoc_js_gen_plugin
@@ -1,12 +1,18 @@
 #include "request_processor.h"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "generator_options.h"
 #include "google/protobuf/compiler/plugin.pb.h"
 #include "js_code_generator.h"
-#include "type_resolver.h"
+#include "manifest_generator.h"
+#include "registry_generator.h"
+#include "schema.h"
 
 namespace protoc_js_gen_plugin {
 
@@ -14,7 +20,6 @@ namespace {
 
 using google::protobuf::compiler::CodeGeneratorRequest;
 using google::protobuf::compiler::CodeGeneratorResponse;
-using google::protobuf::FileDescriptorProto;
 
 }  // namespace
 
@@ -23,26 +28,75 @@ CodeGeneratorResponse RequestProcessor::ProcessRequest(
 
     CodeGeneratorResponse response;
 
-    // Collect all proto files as pointers
-    std::vector<const FileDescriptorProto*> all_proto_files;
-    for (const FileDescriptorProto& proto_file : request.proto_file()) {
-        all_proto_files.push_back(&proto_file);
+    // Proto3 optional fields get explicit presence tracking
+    response.set_supported_features(CodeGeneratorResponse::FEATURE_PROTO3_OPTIONAL);
+
+    // Parse generator options
+    GeneratorOptions options;
+    std::string error;
+    if (!GeneratorOptions::Parse(request.parameter(), &options, &error)) {
+        response.set_error(error);
+        return response;
     }
 
-    // Process each proto file
-    for (const FileDescriptorProto& proto_file : request.proto_file()) {
-        // Only process files requested for generation, not dependencies
-        if (std::find(request.file_to_generate().begin(),
-                      request.file_to_generate().end(),
-                      proto_file.name()) == request.file_to_generate().end()) {
-            continue;
+    // Names, types and imports are resolved once for all emitters
+    Schema schema(request);
+    const std::vector<FileSchema>& files = schema.files();
+
+    // Generators only read the schema, so files can be generated concurrently;
+    // at most one worker per hardware thread, each taking the next file in turn
+    std::vector<std::string> file_contents(files.size());
+    size_t worker_count = std::min<size_t>(files.size(), std::max(1u, std::thread::hardware_concurrency()));
+    if (options.parallel && worker_count > 1) {
+        std::atomic<size_t> next_file{0};
+        auto work = [&files, &schema, &options, &file_contents, &next_file] {
+            for (size_t i = next_file++; i < files.size(); i = next_file++) {
+                file_contents[i] = GenerateFileContent(files[i], schema, options);
+            }
+        };
+        std::vector<std::future<void>> workers;
+        workers.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; ++i) {
+            workers.push_back(std::async(std::launch::async, work));
+        }
+        for (std::future<void>& worker : workers) {
+            worker.get();
+        }
+    } else {
+        for (size_t i = 0; i < files.size(); ++i) {
+            file_contents[i] = GenerateFileContent(files[i], schema, options);
         }
+    }
 
-        std::string file_content = GenerateFileContent(proto_file, all_proto_files);
+    // Output files in schema order regardless of completion order
+    for (size_t i = 0; i < files.size(); ++i) {
+        auto* output_file = response.add_file();
+        output_file->set_name(files[i].output_name);
+        output_file->set_content(std::move(file_contents[i]));
+    }
+
+    // Request-wide registry over the generated files
+    if (options.registry) {
+        RegistryGenerator generator(schema, options);
 
         auto* output_file = response.add_file();
-        output_file->set_name(GetOutputFileName(proto_file.name()));
-        output_file->set_content(file_content);
+        output_file->set_name(options.registry_file);
+        output_file->set_content(generator.Generate());
+    }
+
+    // Manifest and depfile over every file above
+    if (options.manifest) {
+        ManifestGenerator generator(schema, response, options);
+        std::string manifest = generator.GenerateManifest();
+        std::string depfile = generator.GenerateDepfile();
+
+        auto* manifest_file = response.add_file();
+        manifest_file->set_name(options.manifest_file);
+        manifest_file->set_content(std::move(manifest));
+
+        auto* depfile_file = response.add_file();
+        depfile_file->set_name(ManifestGenerator::GetDepfileName(options.manifest_file));
+        depfile_file->set_content(std::move(depfile));
     }
 
     return response;
@@ -53,11 +107,11 @@ std::string RequestProcessor::GetOutputFileName(const std::string& proto_file_na
 }
 
 std::string RequestProcessor::GenerateFileContent(
-    const FileDescriptorProto& proto_file,
-    const std::vector<const FileDescriptorProto*>& all_proto_files) {
+    const FileSchema& file,
+    const Schema& schema,
+    const GeneratorOptions& options) {
 
-    TypeResolver type_resolver(proto_file, all_proto_files);
-    JsCodeGenerator generator(proto_file, type_resolver);
+    JsCodeGenerator generator(file, schema.type_resolver(), options);
     return generator.Generate();
 }
 
@@ -0,0 +1,172 @@
+#include "schema.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "import_planner.h"
+#include "request_processor.h"
+#include "string_extensions.h"
+#include "type_helper.h"
+
+namespace protoc_js_gen_plugin {
+
+namespace {
+
+using google::protobuf::DescriptorProto;
+using google::protobuf::FieldDescriptorProto;
+using google::protobuf::FileDescriptorProto;
+using google::protobuf::compiler::CodeGeneratorRequest;
+
+// Proto files declaring the message and enum types referenced by a message,
+// and whether it uses the codecs of well-known types or 64-bit integers
+void CollectImportedFiles(
+    const DescriptorProto& message_type,
+    const FileDescriptorProto& proto_file,
+    const TypeResolver& type_resolver,
+    std::set<std::string>* imported_files,
+    bool* uses_well_known_types,
+    bool* uses_int64) {
+
+    for (const FieldDescriptorProto& field : message_type.field()) {
+        if (TypeHelper::IsInt64Type(field.type())) {
+            *uses_int64 = true;
+        } else if (!TypeHelper::GetWellKnownType(field).empty()) {
+            // Decoded by the generated codecs, nothing to import
+            *uses_well_known_types = true;
+        } else if (field.type() == FieldDescriptorProto::TYPE_MESSAGE ||
+            field.type() == FieldDescriptorProto::TYPE_ENUM) {
+            const TypeResolver::Symbol* symbol = type_resolver.FindSymbol(field.type_name());
+            if (symbol && symbol->proto_file != proto_file.name()) {
+                imported_files->insert(symbol->proto_file);
+            }
+        }
+    }
+
+    for (const DescriptorProto& nested_message : message_type.nested_type()) {
+        CollectImportedFiles(
+            nested_message, proto_file, type_resolver, imported_files, uses_well_known_types, uses_int64);
+    }
+}
+
+MessageSchema BuildMessage(
+    const DescriptorProto& message_type,
+    const std::string& parent_full_name,
+    const FileSchema& file,
+    const TypeResolver& type_resolver) {
+
+    MessageSchema message;
+    message.proto = &message_type;
+    message.full_name = parent_full_name.empty() ?
+        message_type.name() : parent_full_name + "." + message_type.name();
+    message.path = file.proto->package().empty() ?
+        message.full_name : message.full_name.substr(file.proto->package().size() + 1);
+
+    message.fields.reserve(message_type.field_size());
+    int presence_bits = 0;
+    for (const FieldDescriptorProto& field_proto : message_type.field()) {
+        FieldSchema field;
+        field.proto = &field_proto;
+        field.camel_name = SnakeToCamelCase(field_proto.name());
+        field.pascal_name = SnakeToPascalCase(field_proto.name());
+        field.well_known_type = TypeHelper::GetWellKnownType(field_proto);
+        if (TypeHelper::HasPresenceBit(field_proto, *file.proto)) {
+            field.presence_bit = presence_bits++;
+        }
+
+        if (field.well_known_type.empty() &&
+            (field_proto.type() == FieldDescriptorProto::TYPE_MESSAGE ||
+             field_proto.type() == FieldDescriptorProto::TYPE_ENUM)) {
+            field.type = type_resolver.FindSymbol(field_proto.type_name());
+            if (field.type && field.type->proto_file != file.proto->name()) {
+                for (const ImportSchema& import : file.imports) {
+                    if (import.proto_file == field.type->proto_file) {
+                        field.import = &import;
+                        break;
+                    }
+                }
+            }
+        }
+        message.fields.push_back(std::move(field));
+    }
+
+    message.nested_types.reserve(message_type.nested_type_size());
+    for (const DescriptorProto& nested_message : message_type.nested_type()) {
+        message.nested_types.push_back(BuildMessage(nested_message, message.full_name, file, type_resolver));
+    }
+    return message;
+}
+
+void IndexFields(const MessageSchema& message, FileSchema* file) {
+    for (const FieldSchema& field : message.fields) {
+        file->fields_by_proto[field.proto] = &field;
+    }
+    for (const MessageSchema& nested_message : message.nested_types) {
+        IndexFields(nested_message, file);
+    }
+}
+
+}  // namespace
+
+const FieldSchema* FileSchema::FindField(const FieldDescriptorProto& field) const {
+    auto it = fields_by_proto.find(&field);
+    return it != fields_by_proto.end() ? it->second : nullptr;
+}
+
+Schema::Schema(const CodeGeneratorRequest& request)
+    : all_proto_files_([&request] {
+          std::vector<const FileDescriptorProto*> files;
+          for (const FileDescriptorProto& proto_file : request.proto_file()) {
+              files.push_back(&proto_file);
+          }
+          return files;
+      }()),
+      type_resolver_(all_proto_files_) {
+
+    // Import paths and aliases are shared by all files of the request
+    ImportPlanner import_planner;
+
+    // Sorted by name so output does not depend on the command line order
+    std::vector<std::string> file_names(request.file_to_generate().begin(), request.file_to_generate().end());
+    std::sort(file_names.begin(), file_names.end());
+
+    files_.reserve(file_names.size());
+    for (const std::string& file_name : file_names) {
+        auto it = std::find_if(all_proto_files_.begin(), all_proto_files_.end(),
+            [&file_name](const FileDescriptorProto* proto_file) { return proto_file->name() == file_name; });
+        if (it == all_proto_files_.end()) {
+            continue;
+        }
+        const FileDescriptorProto& proto_file = **it;
+
+        files_.emplace_back();
+        FileSchema& file = files_.back();
+        file.proto = &proto_file;
+        file.output_name = RequestProcessor::GetOutputFileName(proto_file.name());
+
+        // Import edges, ordered by proto file
+        std::set<std::string> imported_files;
+        for (const DescriptorProto& message_type : proto_file.message_type()) {
+            CollectImportedFiles(message_type, proto_file, type_resolver_, &imported_files,
+                &file.uses_well_known_types, &file.uses_int64);
+        }
+        for (const std::string& imported_file : imported_files) {
+            ImportSchema import;
+            import.proto_file = imported_file;
+            import.module_path = import_planner.GetImportPath(proto_file.name(), imported_file);
+            import.alias = import_planner.GetAlias(imported_file);
+            file.imports.push_back(std::move(import));
+        }
+
+        file.messages.reserve(proto_file.message_type_size());
+        for (const DescriptorProto& message_type : proto_file.message_type()) {
+            file.messages.push_back(BuildMessage(message_type, proto_file.package(), file, type_resolver_));
+        }
+        for (const MessageSchema& message : file.messages) {
+            IndexFields(message, &file);
+        }
+    }
+}
+
+}  // namespace protoc_js_gen_plugin
@@ -10,6 +10,7 @@ namespace protoc_js_gen_plugin {
 
 namespace {
 
+using google::protobuf::DescriptorProto;
 using google::protobuf::FieldDescriptorProto;
 using google::protobuf::FileDescriptorProto;
 
@@ -20,18 +21,41 @@ std::string GetLastComponent(const std::string& str) {
     return str.substr(pos + 1);
 }
 
-}  // namespace
-
-// Static member initialization
-TypeHelper::TypeNameTransformer TypeHelper::type_name_transformer_ = nullptr;
-
-void TypeHelper::SetTypeNameTransformer(TypeNameTransformer transformer) {
-    type_name_transformer_ = std::move(transformer);
+// JavaScript representation of the well-known types, see GetWellKnownType
+struct WellKnownType {
+    const char* name;
+    FieldDescriptorProto::Type wrapped_type;
+    const char* js_type;
+};
+
+constexpr WellKnownType kWellKnownTypes[] = {
+    {"Timestamp", FieldDescriptorProto::TYPE_MESSAGE, "Date"},
+    {"Duration", FieldDescriptorProto::TYPE_MESSAGE, "number"},
+    {"DoubleValue", FieldDescriptorProto::TYPE_DOUBLE, "number"},
+    {"FloatValue", FieldDescriptorProto::TYPE_FLOAT, "number"},
+    {"Int64Value", FieldDescriptorProto::TYPE_INT64, "number"},
+    {"UInt64Value", FieldDescriptorProto::TYPE_UINT64, "number"},
+    {"Int32Value", FieldDescriptorProto::TYPE_INT32, "number"},
+    {"UInt32Value", FieldDescriptorProto::TYPE_UINT32, "number"},
+    {"BoolValue", FieldDescriptorProto::TYPE_BOOL, "boolean"},
+    {"StringValue", FieldDescriptorProto::TYPE_STRING, "string"},
+    {"BytesValue", FieldDescriptorProto::TYPE_BYTES, "Uint8Array"},
+    {"Struct", FieldDescriptorProto::TYPE_MESSAGE, "Object<string, any>"},
+    {"Value", FieldDescriptorProto::TYPE_MESSAGE, "any"},
+    {"ListValue", FieldDescriptorProto::TYPE_MESSAGE, "Array<any>"},
+    {"Any", FieldDescriptorProto::TYPE_MESSAGE, "Object"},
+    {"Empty", FieldDescriptorProto::TYPE_MESSAGE, "Object"},
+    {"FieldMask", FieldDescriptorProto::TYPE_MESSAGE, "string[]"},
+};
+
+const WellKnownType* FindWellKnownType(const std::string& name) {
+    for (const WellKnownType& type : kWellKnownTypes) {
+        if (name == type.name) return &type;
+    }
+    return nullptr;
 }
 
-TypeHelper::TypeNameTransformer TypeHelper::GetTypeNameTransformer() {
-    return type_name_transformer_;
-}
+}  // namespace
 
 std::string TypeHelper::GetJsType(
     const FieldDescriptorProto& field,
@@ -57,6 +81,11 @@ std::string TypeHelper::GetBaseJsType(
     const FieldDescriptorProto& field,
     const FileDescriptorProto& proto_file) {
 
+    // Well-known types are plain JavaScript values, not generated classes
+    if (const WellKnownType* type = FindWellKnownType(GetWellKnownType(field))) {
+        return type->js_type;
+    }
+
     switch (field.type()) {
         case FieldDescriptorProto::TYPE_DOUBLE:
         case FieldDescriptorProto::TYPE_FLOAT:
@@ -84,21 +113,9 @@ std::string TypeHelper::GetBaseJsType(
             return "Uint8Array";
 
         case FieldDescriptorProto::TYPE_ENUM:
-            if (type_name_transformer_) {
-                std::string transformed = type_name_transformer_(field.type_name(), proto_file);
-                if (!transformed.empty()) {
-                    return transformed;
-                }
-            }
             return GetLastComponent(field.type_name()) + "[keyof typeof " + GetLastComponent(field.type_name()) + "]";
 
         case FieldDescriptorProto::TYPE_MESSAGE:
-            if (type_name_transformer_) {
-                std::string transformed = type_name_transformer_(field.type_name(), proto_file);
-                if (!transformed.empty()) {
-                    return transformed;
-                }
-            }
             return GetMessageTypeName(field.type_name(), proto_file);
 
         default:
@@ -106,6 +123,46 @@ std::string TypeHelper::GetBaseJsType(
     }
 }
 
+std::string TypeHelper::GetWellKnownType(const FieldDescriptorProto& field) {
+    static const std::string kPrefix = ".google.protobuf.";
+    if (field.type() != FieldDescriptorProto::TYPE_MESSAGE ||
+        field.type_name().compare(0, kPrefix.size(), kPrefix) != 0) {
+        return "";
+    }
+    std::string name = field.type_name().substr(kPrefix.size());
+    return FindWellKnownType(name) ? name : "";
+}
+
+FieldDescriptorProto::Type TypeHelper::GetWrappedType(const std::string& well_known_type) {
+    const WellKnownType* type = FindWellKnownType(well_known_type);
+    return type ? type->wrapped_type : FieldDescriptorProto::TYPE_MESSAGE;
+}
+
+bool TypeHelper::IsInt64Type(FieldDescriptorProto::Type type) {
+    switch (type) {
+        case FieldDescriptorProto::TYPE_INT64:
+        case FieldDescriptorProto::TYPE_UINT64:
+        case FieldDescriptorProto::TYPE_SINT64:
+        case FieldDescriptorProto::TYPE_FIXED64:
+        case FieldDescriptorProto::TYPE_SFIXED64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool TypeHelper::HasPresenceBit(
+    const FieldDescriptorProto& field,
+    const FileDescriptorProto& proto_file) {
+
+    bool is_oneof_member = field.has_oneof_index() && field.oneof_index() >= 0 && !field.proto3_optional();
+    if (is_oneof_member || field.label() == FieldDescriptorProto::LABEL_REPEATED) {
+        return false;
+    }
+    return field.type() == FieldDescriptorProto::TYPE_MESSAGE ||
+           field.proto3_optional() || proto_file.syntax() != "proto3";
+}
+
 bool TypeHelper::IsMapField(const FieldDescriptorProto& field) {
     // Simple check: if it's a repeated message type and type name contains "Entry"
     return field.type() == FieldDescriptorProto::TYPE_MESSAGE &&
@@ -113,6 +170,20 @@ bool TypeHelper::IsMapField(const FieldDescriptorProto& field) {
            field.type_name().find("Entry") != std::string::npos;
 }
 
+const DescriptorProto* TypeHelper::FindMapEntry(
+    const DescriptorProto& message_type,
+    const FieldDescriptorProto& field) {
+
+    size_t pos = field.type_name().find_last_of('.');
+    std::string entry_name = pos == std::string::npos ? field.type_name() : field.type_name().substr(pos + 1);
+    for (const DescriptorProto& nested_type : message_type.nested_type()) {
+        if (nested_type.name() == entry_name && nested_type.options().map_entry()) {
+            return &nested_type;
+        }
+    }
+    return nullptr;
+}
+
 std::pair<std::string, std::string> TypeHelper::GetMapKeyValueTypes(
     const FieldDescriptorProto& field) {
     // Simplified implementation
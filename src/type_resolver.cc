@@ -1,10 +1,7 @@
 #include "type_resolver.h"
 
 #include <algorithm>
-#include <memory>
 #include <string>
-#include <unordered_set>
-#include <utility>
 #include <vector>
 
 namespace protoc_js_gen_plugin {
@@ -13,33 +10,34 @@ namespace {
 
 using google::protobuf::DescriptorProto;
 using google::protobuf::EnumDescriptorProto;
+using google::protobuf::FieldDescriptorProto;
 using google::protobuf::FileDescriptorProto;
 
-// Hash function for std::pair<std::string, std::string>
-struct PairHash {
-    std::size_t operator()(const std::pair<std::string, std::string>& p) const noexcept {
-        std::size_t h1 = std::hash<std::string>{}(p.first);
-        std::size_t h2 = std::hash<std::string>{}(p.second);
-        // Combine hashes (from boost::hash_combine)
-        return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
-    }
-};
+// Symbol of a type registered under its dotted full name
+TypeResolver::Symbol MakeSymbol(
+    const std::string& dotted_full_name,
+    const FileDescriptorProto& proto_file) {
+
+    TypeResolver::Symbol symbol;
+    symbol.full_name = dotted_full_name.substr(1);
+    symbol.proto_file = proto_file.name();
+    symbol.path = proto_file.package().empty() ?
+        symbol.full_name : symbol.full_name.substr(proto_file.package().size() + 1);
+    return symbol;
+}
 
-// Equality function for std::pair<std::string, std::string>
-struct PairEqual {
-    bool operator()(const std::pair<std::string, std::string>& a,
-                    const std::pair<std::string, std::string>& b) const noexcept {
-        return a.first == b.first && a.second == b.second;
+// Ensure a type name starts with a dot
+std::string NormalizeTypeName(const std::string& type_name) {
+    if (type_name.empty() || type_name[0] != '.') {
+        return "." + type_name;
     }
-};
+    return type_name;
+}
 
 }  // namespace
 
-TypeResolver::TypeResolver(
-    const FileDescriptorProto& current_file,
-    const std::vector<const FileDescriptorProto*>& all_proto_files)
-    : current_file_(current_file),
-      all_proto_files_(all_proto_files) {
+TypeResolver::TypeResolver(const std::vector<const FileDescriptorProto*>& all_proto_files)
+    : all_proto_files_(all_proto_files) {
     BuildTypeMap();
 }
 
@@ -55,6 +53,13 @@ void TypeResolver::BuildTypeMap() {
             RegisterEnum(enum_type, *proto_file);
         }
     }
+
+    std::sort(symbols_.begin(), symbols_.end(), [](const Symbol& a, const Symbol& b) {
+        return a.full_name < b.full_name;
+    });
+    for (size_t i = 0; i < symbols_.size(); ++i) {
+        symbol_map_["." + symbols_[i].full_name] = i;
+    }
 }
 
 void TypeResolver::RegisterMessage(
@@ -63,7 +68,7 @@ void TypeResolver::RegisterMessage(
     const std::string& parent_full_name) {
 
     std::string full_name = GetFullName(message.name(), proto_file.package(), parent_full_name);
-    type_map_[full_name] = std::make_pair(proto_file.name(), message.name());
+    symbols_.push_back(MakeSymbol(full_name, proto_file));
 
     // Recursively process nested messages
     for (const DescriptorProto& nested_message : message.nested_type()) {
@@ -82,7 +87,8 @@ void TypeResolver::RegisterEnum(
     const std::string& parent_full_name) {
 
     std::string full_name = GetFullName(enum_type.name(), proto_file.package(), parent_full_name);
-    type_map_[full_name] = std::make_pair(proto_file.name(), enum_type.name());
+    enum_map_[full_name] = &enum_type;
+    symbols_.push_back(MakeSymbol(full_name, proto_file));
 }
 
 std::string TypeResolver::GetFullName(
@@ -100,44 +106,44 @@ std::string TypeResolver::GetFullName(
     }
 }
 
-std::unique_ptr<TypeResolver::TypeInfo> TypeResolver::GetExternalTypeInfo(
-    const std::string& type_name) const {
-
-    // Normalize type name: ensure it starts with dot
-    std::string normalized_name = type_name;
-    if (normalized_name.empty() || normalized_name[0] != '.') {
-        normalized_name = "." + normalized_name;
-    }
+const TypeResolver::Symbol* TypeResolver::FindSymbol(const std::string& type_name) const {
+    auto it = symbol_map_.find(NormalizeTypeName(type_name));
+    return it != symbol_map_.end() ? &symbols_[it->second] : nullptr;
+}
 
-    auto it = type_map_.find(normalized_name);
-    if (it != type_map_.end()) {
-        const TypeInfo& info = it->second;
+const EnumDescriptorProto* TypeResolver::FindEnum(const std::string& type_name) const {
+    auto it = enum_map_.find(NormalizeTypeName(type_name));
+    return it != enum_map_.end() ? it->second : nullptr;
+}
 
-        // Check if it's from the current file
-        if (info.first == current_file_.name()) {
-            return nullptr;
+int TypeResolver::FindExtensionNumber(const std::string& extendee, const std::string& name) const {
+    // Extensions of the descriptor options are declared at file scope
+    for (const FileDescriptorProto* proto_file : all_proto_files_) {
+        for (const FieldDescriptorProto& extension : proto_file->extension()) {
+            if (extension.extendee() == extendee && extension.name() == name) {
+                return extension.number();
+            }
         }
-
-        return std::make_unique<TypeInfo>(info);
     }
-
-    // Type not found (could be a basic type or error)
-    return nullptr;
+    return 0;
 }
 
-std::vector<TypeResolver::TypeInfo> TypeResolver::GetRequiredImports(
-    const std::vector<std::string>& referenced_type_names) const {
+std::vector<const FieldDescriptorProto*> TypeResolver::FindExtensions(
+    const std::string& extendee, const std::string& name) const {
 
-    std::unordered_set<TypeInfo, PairHash, PairEqual> imports;
-
-    for (const std::string& type_name : referenced_type_names) {
-        auto info = GetExternalTypeInfo(type_name);
-        if (info) {
-            imports.insert(*info);
+    std::vector<const FieldDescriptorProto*> extensions;
+    for (const FileDescriptorProto* proto_file : all_proto_files_) {
+        for (const FieldDescriptorProto& extension : proto_file->extension()) {
+            if (extension.extendee() == extendee && extension.name() == name) {
+                extensions.push_back(&extension);
+            }
         }
     }
+    return extensions;
+}
 
-    return std::vector<TypeInfo>(imports.begin(), imports.end());
+const std::vector<TypeResolver::Symbol>& TypeResolver::GetSymbols() const {
+    return symbols_;
 }
 
-}  // namespace protoc_js_gen_plugin
\ No newline at end of file
+}  // namespace protoc_js_gen_plugin
@@ -0,0 +1,215 @@
+/**
+ * Benchmark: JSON encode/decode throughput, payload bytes and heap allocation
+ * per operation of the generated classes on representative pokeworld
+ * messages (small, wide, deep and a large table). When protobufjs is
+ * installed and gen/ is built with 'embed_descriptors', the same schemas are
+ * loaded into protobufjs from the embedded descriptors and measured too.
+ */
+
+import v8 from 'v8';
+import { toJson, fromJson, fromJsonValidated } from '../proto.mjs';
+import { ReflectionRoot } from '../proto-reflect.mjs';
+import { Vector3 } from '../gen/pokeworld/math/comm_math.mjs';
+import { Pokemon, TbPokemon } from '../gen/pokeworld/pokemon/cfg_pokemon.mjs';
+import { GetPlayersResponse } from '../gen/pokeworld/player/cs_player.mjs';
+
+// Minimum measured time per operation, after warm-up
+const MEASURE_MS = Number(process.env.BENCH_MS ?? 500);
+const TABLE_ROWS = 5000;
+const PLAYERS = 32;
+const TIERS = ['OU', 'UU', 'RU', 'NU', 'PU', 'LC', 'Uber'];
+
+function makePokemonJson(i) {
+    return {
+        id: i,
+        num: i % 1025,
+        name: `pokemon-${i}`,
+        gen: 1 + (i % 9),
+        baseForme: i % 4 === 0 ? 'Alola' : '',
+        abilities: 'Overgrow,Chlorophyll',
+        pokeTypes: [i % 18, (i * 7) % 18],
+        evos: `pokemon-${i + 1}`,
+        evoLevel: 16 + (i % 20),
+        tier: TIERS[i % TIERS.length],
+        doublesTier: TIERS[(i * 3) % TIERS.length],
+        natDexTier: TIERS[(i * 5) % TIERS.length],
+        eggGroups: i % 3 === 0 ? 'Monster' : 'Field',
+        canHatch: i % 5 !== 0,
+        genderRatio: 'M:0.5,F:0.5',
+        hp: (i * 37) % 255,
+        atk: (i * 53) % 255,
+        def: (i * 71) % 255,
+        spa: (i * 89) % 255,
+        spd: (i * 97) % 255,
+        spe: (i * 101) % 255,
+        weight: 6.9 + (i % 100),
+        height: 0.7 + (i % 10) / 10,
+        frontAtlasAssetAdress: { packageName: 'PokemonPackage', location: `Assets/Res/Pokemon/Front/${i}` },
+        backAtlasAssetAdress: { packageName: 'PokemonPackage', location: `Assets/Res/Pokemon/Back/${i}` },
+    };
+}
+
+function makePlayersJson() {
+    const results = [];
+    for (let i = 0; i < PLAYERS; i++) {
+        results.push({
+            success: i % 7 !== 0,
+            entityId: 100000 + i,
+            player: {
+                entityInfo: { id: 100000 + i },
+                actorInfo: { cfgId: 1 + (i % 4) },
+                playerInfo: { nickname: `trainer-${i}` },
+                entityTransform: { pos: { x: i * 3, y: i * 5 } },
+                actorTransform: { direction: i % 4 },
+                actorState: { motionState: i % 2 },
+            },
+        });
+    }
+    return { results };
+}
+
+// Representative messages: [name, class, JSON object]
+function makeFixtures() {
+    return [
+        ['small: Vector3', Vector3, { x: 1.5, y: -2.25, z: 1024 }],
+        ['wide: Pokemon', Pokemon, makePokemonJson(25)],
+        ['deep: GetPlayersResponse', GetPlayersResponse, makePlayersJson()],
+        [`large: TbPokemon x${TABLE_ROWS}`, TbPokemon, { dataList: Array.from({ length: TABLE_ROWS }, (_, i) => makePokemonJson(i)) }],
+    ];
+}
+
+// Run op repeatedly for at least MEASURE_MS; allocation from the GC profiler
+// (bytes freed by each collection plus net heap growth, as in pool.mjs)
+export function measureOp(op) {
+    let batch = 1;
+    const warmupEnd = performance.now() + Math.min(MEASURE_MS, 200);
+    while (performance.now() < warmupEnd) {
+        for (let i = 0; i < batch; i++) op();
+        batch *= 2;
+    }
+    batch = Math.max(1, batch >> 4);
+
+    const profiler = typeof v8.GCProfiler === 'function' ? new v8.GCProfiler() : undefined;
+    const startUsed = v8.getHeapStatistics().used_heap_size;
+    profiler?.start();
+    const start = performance.now();
+    let ops = 0;
+    let elapsed;
+    do {
+        for (let i = 0; i < batch; i++) op();
+        ops += batch;
+        elapsed = performance.now() - start;
+    } while (elapsed < MEASURE_MS);
+    const statistics = profiler?.stop().statistics;
+    const endUsed = v8.getHeapStatistics().used_heap_size;
+
+    let allocatedBytes;
+    if (statistics !== undefined) {
+        allocatedBytes = Math.max(0, endUsed - startUsed);
+        for (const gc of statistics) {
+            allocatedBytes += Math.max(0, gc.beforeGC.heapStatistics.usedHeapSize - gc.afterGC.heapStatistics.usedHeapSize);
+        }
+    }
+    return {
+        opsPerSec: Math.round(ops / (elapsed / 1000)),
+        allocBytesPerOp: allocatedBytes === undefined ? undefined : Math.round(allocatedBytes / ops),
+    };
+}
+
+function row(fixture, implementation, operation, bytesPerOp, op) {
+    return { fixture, implementation, operation, bytesPerOp, ...measureOp(op) };
+}
+
+// Generated classes through the runtime codecs
+function measureGenerated(name, messageCls, json) {
+    const text = JSON.stringify(json);
+    // A copy holds no retained source text, so encode measures serialization
+    const message = fromJson(messageCls, text).clone();
+    const encoded = toJson(message);
+    const rows = [
+        row(name, 'generated', 'encode', encoded.length, () => toJson(message)),
+        row(name, 'generated', 'decode', text.length, () => fromJson(messageCls, text)),
+    ];
+    if (typeof messageCls.validateAndDecode === 'function') {
+        rows.push(row(name, 'generated', 'decode (validated)', text.length, () => fromJsonValidated(messageCls, text)));
+    }
+    if (typeof messageCls.acquire === 'function') {
+        rows.push(row(name, 'generated', 'decode (pooled)', text.length, () => {
+            const instance = messageCls.acquire();
+            fromJson(messageCls, text, instance);
+            messageCls.release(instance);
+        }));
+    }
+    return rows;
+}
+
+function camelKeysToSnake(value) {
+    if (Array.isArray(value)) return value.map(camelKeysToSnake);
+    if (value === null || typeof value !== 'object') return value;
+    const result = {};
+    for (const [key, item] of Object.entries(value)) {
+        result[key.replace(/([A-Z])/g, '_$1').toLowerCase()] = camelKeysToSnake(item);
+    }
+    return result;
+}
+
+// protobufjs root built from the embedded descriptors, undefined if unavailable
+async function loadProtobufjs(classes) {
+    let protobuf;
+    try {
+        protobuf = (await import('protobufjs')).default;
+        await import('protobufjs/ext/descriptor/index.js');
+    } catch {
+        return { skipped: 'protobufjs is not installed' };
+    }
+    try {
+        const reflection = new ReflectionRoot();
+        for (const cls of classes) reflection.addClass(cls);
+        return { root: protobuf.Root.fromDescriptor(reflection.toFileDescriptorSet()) };
+    } catch (error) {
+        return { skipped: `cannot load embedded descriptors (${error.message})` };
+    }
+}
+
+// protobufjs on the same schema: JSON through fromObject/toObject, and its binary codec
+function measureProtobufjs(root, name, messageCls, json) {
+    const type = root.lookupType(messageCls.__descriptor.fullName);
+    const text = JSON.stringify(camelKeysToSnake(json));
+    const message = type.fromObject(JSON.parse(text));
+    const encoded = JSON.stringify(type.toObject(message));
+    const binary = type.encode(message).finish();
+    return [
+        row(name, 'protobufjs', 'encode', encoded.length, () => JSON.stringify(type.toObject(message))),
+        row(name, 'protobufjs', 'decode', text.length, () => type.fromObject(JSON.parse(text))),
+        row(name, 'protobufjs', 'encode (binary)', binary.length, () => type.encode(message).finish()),
+        row(name, 'protobufjs', 'decode (binary)', binary.length, () => type.decode(binary)),
+    ];
+}
+
+export async function runCodecBenchmark({ protobufjs = true } = {}) {
+    const fixtures = makeFixtures();
+    const rows = [];
+    for (const [name, messageCls, json] of fixtures) {
+        rows.push(...measureGenerated(name, messageCls, json));
+    }
+
+    let skipped;
+    if (protobufjs) {
+        const loaded = await loadProtobufjs(fixtures.map(([, messageCls]) => messageCls));
+        skipped = loaded.skipped;
+        if (loaded.root !== undefined) {
+            for (const [name, messageCls, json] of fixtures) {
+                rows.push(...measureProtobufjs(loaded.root, name, messageCls, json));
+            }
+        }
+    }
+    return { rows, protobufjsSkipped: skipped };
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+    const { rows, protobufjsSkipped } = await runCodecBenchmark();
+    console.table(rows);
+    if (protobufjsSkipped) {
+        console.log(`protobufjs comparison skipped: ${protobufjsSkipped}`);
+    }
+}
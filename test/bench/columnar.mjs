@@ -0,0 +1,93 @@
+/**
+ * Benchmark: memory per row and full-scan time of an array of Pokemon
+ * instances versus the generated columnar table (requires gen/ built with
+ * the 'columnar' option; run with --expose-gc for stable heap numbers)
+ */
+
+import v8 from 'v8';
+import { fromJson } from '../proto.mjs';
+import { Pokemon } from '../gen/pokeworld/pokemon/cfg_pokemon.mjs';
+
+const ROWS = 100000;
+const SCANS = 50;
+const TIERS = ['OU', 'UU', 'RU', 'NU', 'PU', 'LC', 'Uber'];
+
+// Synthetic config rows with realistic low-cardinality strings
+function makeRowJson(i) {
+    return {
+        id: i,
+        num: i % 1025,
+        name: `pokemon-${i}`,
+        gen: 1 + (i % 9),
+        tier: TIERS[i % TIERS.length],
+        doublesTier: TIERS[(i * 7) % TIERS.length],
+        eggGroups: i % 3 === 0 ? 'Monster' : 'Field',
+        canHatch: i % 5 !== 0,
+        hp: (i * 37) % 255,
+        atk: (i * 53) % 255,
+        def: (i * 71) % 255,
+        spa: (i * 89) % 255,
+        spd: (i * 97) % 255,
+        spe: (i * 101) % 255,
+    };
+}
+
+function collect() {
+    if (typeof global.gc === 'function') {
+        global.gc();
+        global.gc();
+    }
+    return v8.getHeapStatistics().used_heap_size;
+}
+
+// Retained heap of whatever build() returns
+function measureHeap(build) {
+    const before = collect();
+    const retained = build();
+    const after = collect();
+    return { retained, bytes: after - before };
+}
+
+function timeScans(scan) {
+    scan();
+    const start = process.hrtime.bigint();
+    let checksum = 0;
+    for (let i = 0; i < SCANS; i++) {
+        checksum += scan();
+    }
+    return { ms: Number(process.hrtime.bigint() - start) / 1e6 / SCANS, checksum };
+}
+
+export function runColumnarBenchmark() {
+    if (typeof Pokemon.Columns?.fromRows !== 'function') {
+        throw new Error('Generated code has no columnar support, rebuild gen/ with the columnar option');
+    }
+
+    const json = Array.from({ length: ROWS }, (_, i) => makeRowJson(i));
+    const instances = measureHeap(() => json.map(row => fromJson(Pokemon, row)));
+    const columns = measureHeap(() => Pokemon.Columns.fromRows(instances.retained));
+
+    // "Sum of attack of OU pokemon with hp > 100"
+    const rows = instances.retained;
+    const objectScan = timeScans(() => {
+        let total = 0;
+        for (const row of rows) {
+            if (row.hp > 100 && row.tier === 'OU') total += row.atk;
+        }
+        return total;
+    });
+    const table = columns.retained;
+    const columnScan = timeScans(() => table.sum('atk', table.where('tier', tier => tier === 'OU', table.where('hp', hp => hp > 100))));
+    if (objectScan.checksum !== columnScan.checksum) {
+        throw new Error('Scan results differ');
+    }
+
+    return [
+        { name: 'instances', rows: ROWS, bytesPerRow: Math.round(instances.bytes / ROWS), scanMs: Number(objectScan.ms.toFixed(3)) },
+        { name: 'columns', rows: ROWS, bytesPerRow: Math.round(columns.bytes / ROWS), scanMs: Number(columnScan.ms.toFixed(3)) },
+    ];
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+    console.table(runColumnarBenchmark());
+}
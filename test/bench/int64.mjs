@@ -0,0 +1,77 @@
+/**
+ * Benchmark: codecs of id-heavy messages in the int64 representation gen/ was
+ * built with (number, bigint, string or hybrid). Ids within the safe-integer
+ * range and full-width 64-bit ids are measured separately, since hybrid only
+ * allocates bigints for the latter. Compare representations by rebuilding:
+ *
+ *   node build.mjs int64=bigint && node bench/int64.mjs
+ */
+
+import { toJson, fromJson, fromJsonValidated } from '../proto.mjs';
+import { packFlat, openFlat } from '../proto-flat.mjs';
+import { GetPlayersRequest, GetPlayersResponse } from '../gen/pokeworld/player/cs_player.mjs';
+import { measureOp } from './codec.mjs';
+
+const IDS = 10000;
+const PLAYERS = 1000;
+
+// int64 representation of the current gen/ build
+export function getInt64Mode() {
+    return GetPlayersRequest.__descriptor.fields[0].int64 ?? 'number';
+}
+
+// Decimal id strings as proto3 JSON writes them; wide ids need all 64 bits
+function makeIds(wide) {
+    const ids = new Array(IDS);
+    for (let i = 0; i < IDS; i++) {
+        ids[i] = wide ? (18446744073709551615n - BigInt(i) * 7919n).toString() : String(100000 + i * 7919);
+    }
+    return ids;
+}
+
+function makePlayersJson(wide) {
+    const results = [];
+    for (let i = 0; i < PLAYERS; i++) {
+        const id = wide ? (9223372036854775807n - BigInt(i)).toString() : String(100000 + i);
+        results.push({ success: true, entityId: id, player: { entityInfo: { id } } });
+    }
+    return { results };
+}
+
+function measure(mode, fixture, messageCls, json) {
+    const text = JSON.stringify(json);
+    // A copy holds no retained source text, so encode measures serialization
+    const message = fromJson(messageCls, text).clone();
+    const ops = [
+        ['decode', () => fromJson(messageCls, text)],
+        ['encode', () => toJson(message)],
+        ['hashCode', () => message.hashCode()],
+    ];
+    if (typeof messageCls.validateAndDecode === 'function') {
+        ops.push(['decode (validated)', () => fromJsonValidated(messageCls, text)]);
+    }
+    if (typeof messageCls.View === 'function' && messageCls === GetPlayersRequest) {
+        const view = openFlat(messageCls, packFlat(messageCls, message));
+        ops.push(['flat read', () => {
+            let count = 0;
+            for (const id of view.entityIds) count += id ? 1 : 0;
+            return count;
+        }]);
+    }
+    return ops.map(([operation, op]) => ({ mode, fixture, operation, ...measureOp(op) }));
+}
+
+export function runInt64Benchmark() {
+    const mode = getInt64Mode();
+    const rows = [];
+    for (const wide of [false, true]) {
+        const ids = wide ? 'wide ids' : 'safe ids';
+        rows.push(...measure(mode, `GetPlayersRequest x${IDS}, ${ids}`, GetPlayersRequest, { entityIds: makeIds(wide) }));
+        rows.push(...measure(mode, `GetPlayersResponse x${PLAYERS}, ${ids}`, GetPlayersResponse, makePlayersJson(wide)));
+    }
+    return rows;
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+    console.table(runInt64Benchmark());
+}
@@ -0,0 +1,91 @@
+/**
+ * Instrumentation: intern hit rate and bytes saved when decoding pokeworld
+ * config tables whose low-cardinality string fields are marked (intern)
+ * (run with --expose-gc to also measure retained heap)
+ */
+
+import v8 from 'v8';
+import { toJson, fromJson, InternTable } from '../proto.mjs';
+import { TbResource } from '../gen/pokeworld/resource/cfg_resource.mjs';
+import { TbPokemon } from '../gen/pokeworld/pokemon/cfg_pokemon.mjs';
+
+const RESOURCE_ROWS = 20000;
+const POKEMON_ROWS = 20000;
+const PACKAGES = ['DefaultPackage', 'UIPackage', 'ActorPackage', 'ScenePackage'];
+const TIERS = ['OU', 'UU', 'RU', 'NU', 'PU', 'LC', 'Uber', 'ZU'];
+const EGG_GROUPS = ['Monster', 'Water 1', 'Bug', 'Flying', 'Field', 'Fairy', 'Grass', 'Mineral'];
+const GENDER_RATIOS = ['M:0.5,F:0.5', 'M:0.875,F:0.125', 'N', 'M:0.25,F:0.75'];
+
+// Resource table: many rows pointing into a handful of packages and folders
+function makeResourceJson() {
+    const dataList = [];
+    for (let i = 0; i < RESOURCE_ROWS; i++) {
+        dataList.push({
+            id: 1001 + (i % 16),
+            assetAddress: {
+                packageName: PACKAGES[i % PACKAGES.length],
+                location: `Assets/Res/${PACKAGES[i % PACKAGES.length]}/${['Panel', 'Atlas', 'Prefab'][i % 3]}`,
+            },
+        });
+    }
+    return toJson(fromJson(TbResource, { dataList }));
+}
+
+function makePokemonJson() {
+    const dataList = [];
+    for (let i = 0; i < POKEMON_ROWS; i++) {
+        dataList.push({
+            id: i,
+            name: `pokemon-${i}`,
+            tier: TIERS[i % TIERS.length],
+            doublesTier: TIERS[(i * 3) % TIERS.length],
+            natDexTier: TIERS[(i * 5) % TIERS.length],
+            eggGroups: EGG_GROUPS[i % EGG_GROUPS.length],
+            genderRatio: GENDER_RATIOS[i % GENDER_RATIOS.length],
+        });
+    }
+    return toJson(fromJson(TbPokemon, { dataList }));
+}
+
+function collect() {
+    if (typeof global.gc === 'function') {
+        global.gc();
+        global.gc();
+    }
+    return v8.getHeapStatistics().used_heap_size;
+}
+
+function measure(name, messageCls, json) {
+    // Decode without interning to get the baseline retained size
+    let before = collect();
+    let decoded = fromJson(messageCls, json, undefined, { internTable: null });
+    const plainBytes = collect() - before;
+    decoded = undefined;
+
+    const internTable = new InternTable();
+    before = collect();
+    decoded = fromJson(messageCls, json, undefined, { internTable });
+    const internedBytes = collect() - before;
+
+    const stats = internTable.stats();
+    return {
+        table: name,
+        lookups: stats.lookups,
+        hitRate: Number(stats.hitRate.toFixed(4)),
+        distinct: stats.size,
+        estimatedBytesSaved: stats.bytesSaved,
+        measuredBytesSaved: typeof global.gc === 'function' ? plainBytes - internedBytes : undefined,
+        rows: decoded.dataList.length,
+    };
+}
+
+export function runInternBenchmark() {
+    return [
+        measure('TbResource', TbResource, makeResourceJson()),
+        measure('TbPokemon', TbPokemon, makePokemonJson()),
+    ];
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+    console.table(runInternBenchmark());
+}
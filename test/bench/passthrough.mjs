@@ -0,0 +1,76 @@
+/**
+ * Benchmark: forwarding cost of a read-mostly proxy. A frame is decoded, one
+ * field is read and the message is written to the outbound FrameWriter, once
+ * unmodified and once after changing a single nested field, against copying
+ * the frame bytes as the lower bound. Compare with full re-encoding by
+ * rebuilding without the option:
+ *
+ *   node build.mjs && node bench/passthrough.mjs
+ */
+
+import { fromJson } from '../proto.mjs';
+import { FrameTypes, FrameWriter, FrameReader } from '../proto-frame.mjs';
+import { GetPlayersResponse } from '../gen/pokeworld/player/cs_player.mjs';
+import * as csPlayer from '../gen/pokeworld/player/cs_player.mjs';
+import { measureOp } from './codec.mjs';
+
+const PLAYERS = [8, 256];
+
+function makePlayersJson(count) {
+    const results = [];
+    for (let i = 0; i < count; i++) {
+        const id = String(100000 + i);
+        results.push({
+            success: true,
+            entityId: id,
+            player: {
+                entityInfo: { id },
+                actorInfo: { cfgId: 1 + (i % 16) },
+                playerInfo: { nickname: `trainer-${i}` },
+                entityTransform: { pos: { x: i % 64, y: (i * 7) % 64 } },
+                actorTransform: { direction: i % 4 },
+                actorState: { motionState: i % 3 },
+            },
+        });
+    }
+    return { results };
+}
+
+// Whether gen/ was built with the 'passthrough' option
+export function hasPassthrough() {
+    return typeof GetPlayersResponse.prototype.__retain === 'function';
+}
+
+function measure(count) {
+    const writer = new FrameWriter();
+    writer.write(fromJson(GetPlayersResponse, makePlayersJson(count)));
+    const frame = writer.flush().slice();
+
+    const types = new FrameTypes(csPlayer);
+    const reader = new FrameReader(types);
+    const outbound = new FrameWriter({ initialSize: frame.length * 2 });
+    const copy = new Uint8Array(frame.length);
+
+    const forward = modify => () => {
+        const [message] = reader.push(frame);
+        const first = message.results[0];
+        if (modify) first.withSuccess(!first.success);
+        outbound.write(message);
+        outbound.release(outbound.flush());
+    };
+
+    const fixture = `GetPlayersResponse x${count}`;
+    return [
+        ['copy frame bytes', () => copy.set(frame)],
+        ['forward unmodified', forward(false)],
+        ['forward, one field changed', forward(true)],
+    ].map(([operation, op]) => ({ fixture, operation, bytesPerOp: frame.length, ...measureOp(op) }));
+}
+
+export function runPassthroughBenchmark() {
+    return PLAYERS.flatMap(measure);
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+    console.table(runPassthroughBenchmark());
+}
@@ -0,0 +1,135 @@
+/**
+ * Benchmark: GC pauses and allocation rate of per-tick sync messages
+ * with and without object pooling (requires gen/ built with the 'pool' option)
+ */
+
+import v8 from 'v8';
+import { fromJson } from '../proto.mjs';
+import { EntitySyncNotify } from '../gen/pokeworld/world/cs_world.mjs';
+
+const TICKS = 20000;
+const ENTITIES_PER_TICK = 64;
+
+// One tick worth of entity sync traffic, already parsed from the wire
+function makeTickJson(tick) {
+    const syncs = [];
+    for (let i = 0; i < ENTITIES_PER_TICK; i++) {
+        const body = {
+            entityInfo: { id: i + 1 },
+            entityTransform: { pos: { x: (tick + i) % 100, y: (tick * 3 + i) % 100 } },
+            actorTransform: { direction: tick % 4 },
+            actorState: { motionState: i % 2 },
+        };
+        syncs.push(i % 4 === 0 ? { npc: body } : { player: body });
+    }
+    return { syncs };
+}
+
+// Run a workload under the GC profiler and summarize collections
+function measure(name, run) {
+    const inputs = [];
+    for (let i = 0; i < 16; i++) {
+        inputs.push(makeTickJson(i));
+    }
+
+    // Warm up so both variants run optimized code
+    run(inputs, 1000);
+
+    const profiler = new v8.GCProfiler();
+    const startUsed = v8.getHeapStatistics().used_heap_size;
+    profiler.start();
+    const start = process.hrtime.bigint();
+    run(inputs, TICKS);
+    const elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+    const { statistics } = profiler.stop();
+    const endUsed = v8.getHeapStatistics().used_heap_size;
+
+    // Bytes freed by each collection plus the net heap growth approximate allocation
+    let freedBytes = 0;
+    let pauseUs = 0;
+    let maxPauseUs = 0;
+    for (const gc of statistics) {
+        freedBytes += Math.max(0, gc.beforeGC.heapStatistics.usedHeapSize - gc.afterGC.heapStatistics.usedHeapSize);
+        pauseUs += gc.cost;
+        maxPauseUs = Math.max(maxPauseUs, gc.cost);
+    }
+    const allocatedBytes = freedBytes + Math.max(0, endUsed - startUsed);
+
+    return {
+        name,
+        ticks: TICKS,
+        elapsedMs: Number(elapsedMs.toFixed(2)),
+        gcCount: statistics.length,
+        gcPauseMs: Number((pauseUs / 1000).toFixed(2)),
+        maxGcPauseMs: Number((maxPauseUs / 1000).toFixed(3)),
+        allocatedMB: Number((allocatedBytes / (1 << 20)).toFixed(2)),
+        allocationRateMBps: Number((allocatedBytes / (1 << 20) / (elapsedMs / 1000)).toFixed(2)),
+    };
+}
+
+// Without pooling: a fresh message graph per tick
+function runUnpooled(inputs, ticks) {
+    const saved = disablePools();
+    let checksum = 0;
+    try {
+        for (let tick = 0; tick < ticks; tick++) {
+            const notify = fromJson(EntitySyncNotify, inputs[tick % inputs.length]);
+            checksum += notify.syncs.length;
+        }
+    } finally {
+        restorePools(saved);
+    }
+    return checksum;
+}
+
+// With pooling: acquire, decode into the instance, release after handling
+function runPooled(inputs, ticks) {
+    let checksum = 0;
+    for (let tick = 0; tick < ticks; tick++) {
+        const notify = EntitySyncNotify.acquire();
+        fromJson(EntitySyncNotify, inputs[tick % inputs.length], notify);
+        checksum += notify.syncs.length;
+        EntitySyncNotify.release(notify);
+    }
+    return checksum;
+}
+
+// Temporarily hide acquire() so decoding falls back to new
+const pooledClasses = new Set();
+function collectClasses(cls) {
+    if (pooledClasses.has(cls) || typeof cls.acquire !== 'function') return;
+    pooledClasses.add(cls);
+    for (const field of cls.__descriptor.fields) {
+        if (field.type === 'TYPE_MESSAGE') collectClasses(field.clrType);
+    }
+}
+collectClasses(EntitySyncNotify);
+
+function disablePools() {
+    const saved = new Map();
+    for (const cls of pooledClasses) {
+        saved.set(cls, cls.acquire);
+        cls.acquire = undefined;
+    }
+    return saved;
+}
+
+function restorePools(saved) {
+    for (const [cls, acquire] of saved) {
+        cls.acquire = acquire;
+    }
+}
+
+export function runPoolBenchmark() {
+    if (typeof EntitySyncNotify.acquire !== 'function') {
+        throw new Error('Generated code has no pool support, rebuild gen/ with the pool option');
+    }
+    return [
+        measure('pooling off', runUnpooled),
+        measure('pooling on', runPooled),
+    ];
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+    console.table(runPoolBenchmark());
+}
@@ -0,0 +1,67 @@
+/**
+ * Benchmark: request throughput of the generated client stubs over the
+ * loopback transport with pipelining on and off, with and without simulated
+ * link latency (requires gen/ built with the 'client' option)
+ */
+
+import { fromJson } from '../proto.mjs';
+import { RpcChannel, RpcServer, createLoopback } from '../proto-rpc.mjs';
+import * as csUser from '../gen/pokeworld/user/cs_user.mjs';
+
+// Calls issued at once per run; fewer when every call waits a full round trip
+const CALLS = 20000;
+const SERIAL_CALLS = 2000;
+const LATENCY_SERIAL_CALLS = 100;
+
+async function measure(latency, pipelining) {
+    const { UserClient, LoginRequest, LoginResponse } = csUser;
+    if (typeof UserClient !== 'function') {
+        throw new Error("gen/ has no client stubs (generate with the 'client' option)");
+    }
+
+    const [clientTransport, serverTransport] = createLoopback({ latency });
+    const response = fromJson(LoginResponse, { success: true });
+    const server = new RpcServer(serverTransport, csUser).implement(UserClient, { login: () => response });
+    const channel = new RpcChannel(clientTransport, csUser, { pipelining });
+    const client = new UserClient(channel);
+    const request = fromJson(LoginRequest, { email: 'red@kanto.jp', password: 'pikachu' });
+
+    // Warm up
+    await Promise.all(Array.from({ length: 100 }, () => client.login(request)));
+
+    const calls = pipelining ? CALLS : latency > 0 ? LATENCY_SERIAL_CALLS : SERIAL_CALLS;
+    const startWrites = channel.writes;
+    const startServerWrites = server.writes;
+    const startBytes = clientTransport.bytes;
+    const start = performance.now();
+    const pending = [];
+    for (let i = 0; i < calls; i++) {
+        pending.push(client.login(request));
+    }
+    await Promise.all(pending);
+    const elapsed = performance.now() - start;
+
+    return {
+        latencyMs: latency,
+        pipelining,
+        calls,
+        callsPerSec: Math.round(calls / (elapsed / 1000)),
+        clientWrites: channel.writes - startWrites,
+        serverWrites: server.writes - startServerWrites,
+        requestBytesPerCall: Math.round((clientTransport.bytes - startBytes) / calls),
+    };
+}
+
+export async function runRpcBenchmark() {
+    const rows = [];
+    for (const latency of [0, 1]) {
+        for (const pipelining of [true, false]) {
+            rows.push(await measure(latency, pipelining));
+        }
+    }
+    return rows;
+}
+
+if (import.meta.url === `file://${process.argv[1]}`) {
+    console.table(await runRpcBenchmark());
+}
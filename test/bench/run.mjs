@@ -0,0 +1,105 @@
+/**
+ * Benchmark suite runner (npm run bench): runs the codec, pool, columnar,
+ * intern, rpc, int64 and passthrough benchmarks against the current gen/ build
+ * and writes a JSON report, so reports of gen/ builds with different generator
+ * options can be compared.
+ *
+ *   node --expose-gc bench/run.mjs [--out report.json] [--only codec,pool] [--no-protobufjs]
+ *
+ * Set BENCH_MS to change the measuring time per codec operation.
+ */
+
+import { writeFileSync } from 'fs';
+import { dirname, join } from 'path';
+import { fileURLToPath } from 'url';
+import os from 'os';
+import { runCodecBenchmark } from './codec.mjs';
+import { runPoolBenchmark } from './pool.mjs';
+import { runColumnarBenchmark } from './columnar.mjs';
+import { runInternBenchmark } from './intern.mjs';
+import { runRpcBenchmark } from './rpc.mjs';
+import { runInt64Benchmark, getInt64Mode } from './int64.mjs';
+import { runPassthroughBenchmark, hasPassthrough } from './passthrough.mjs';
+import { Pokemon } from '../gen/pokeworld/pokemon/cfg_pokemon.mjs';
+import * as csUser from '../gen/pokeworld/user/cs_user.mjs';
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+
+function parseArgs(argv) {
+    const args = { out: join(__dirname, 'report.json'), only: undefined, protobufjs: true };
+    for (let i = 0; i < argv.length; i++) {
+        if (argv[i] === '--out') {
+            args.out = argv[++i];
+        } else if (argv[i] === '--only') {
+            args.only = new Set(argv[++i].split(','));
+        } else if (argv[i] === '--no-protobufjs') {
+            args.protobufjs = false;
+        } else {
+            throw new Error(`Unknown argument: ${argv[i]}`);
+        }
+    }
+    return args;
+}
+
+// Generator options the current gen/ build was made with, detected from the output
+async function detectModes() {
+    const registry = await import('../gen/type_registry.mjs').catch(() => undefined);
+    return {
+        pool: typeof Pokemon.acquire === 'function',
+        dirtyTracking: typeof Pokemon.prototype.encodeDelta === 'function',
+        validate: typeof Pokemon.validate === 'function',
+        flat: typeof Pokemon.View === 'function',
+        columnar: typeof Pokemon.Columns === 'function',
+        embedDescriptors: Pokemon.__descriptor.file !== undefined,
+        registry: registry?.hasType(Pokemon.__descriptor.fullName) === true,
+        client: typeof csUser.UserClient === 'function',
+        lazy: csUser.GetServersResponse.__descriptor.fields.some(field => field.lazy === true),
+        int64: getInt64Mode(),
+        passthrough: hasPassthrough(),
+    };
+}
+
+const benchmarks = {
+    codec: options => runCodecBenchmark({ protobufjs: options.protobufjs }),
+    pool: () => runPoolBenchmark(),
+    columnar: () => runColumnarBenchmark(),
+    intern: () => runInternBenchmark(),
+    rpc: () => runRpcBenchmark(),
+    int64: () => runInt64Benchmark(),
+    passthrough: () => runPassthroughBenchmark(),
+};
+
+async function main() {
+    const args = parseArgs(process.argv.slice(2));
+    const report = {
+        date: new Date().toISOString(),
+        node: process.version,
+        platform: `${os.platform()} ${os.arch()}`,
+        cpu: os.cpus()[0]?.model,
+        exposeGc: typeof global.gc === 'function',
+        modes: await detectModes(),
+        results: {},
+    };
+
+    for (const [name, run] of Object.entries(benchmarks)) {
+        if (args.only !== undefined && !args.only.has(name)) continue;
+        console.log(`\n=== ${name} ===`);
+        try {
+            const result = await run(args);
+            report.results[name] = result;
+            console.table(Array.isArray(result) ? result : result.rows);
+            if (result.protobufjsSkipped) {
+                console.log(`protobufjs comparison skipped: ${result.protobufjsSkipped}`);
+            }
+        } catch (error) {
+            // A gen/ build without the required option skips that benchmark
+            report.results[name] = { skipped: error.message };
+            console.log(`skipped: ${error.message}`);
+        }
+    }
+
+    writeFileSync(args.out, JSON.stringify(report, null, 2) + '\n');
+    console.log(`\nReport written to ${args.out}`);
+}
+
+await main();
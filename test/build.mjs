@@ -31,6 +31,10 @@ const config = {
   protoDir: join(__dirname, 'proto'),
   outputDir: join(__dirname, 'gen'),
   pluginPath: resolve(__dirname, '../build/bin/Release/protoc-gen-js-plugin.exe'),
+  // 插件选项，通过 --js-mjs_opt 传递（例如 'enum_inline'）
+  // 命令行参数追加到插件选项之后，同名选项以后者为准（例如 node build.mjs int64=bigint）
+  // 依赖文件中的路径相对于本目录（protoc在此目录下运行）
+  generatorOptions: ['pool', 'dirty_tracking', 'validate', 'flat', 'columnar', 'embed_descriptors', 'registry', 'framing', 'client', 'manifest', 'manifest_root=proto', 'output_root=gen', 'lazy', 'passthrough', 'int64=hybrid', 'parallel', ...process.argv.slice(2)],
 };
 
 // 确保输出目录存在
@@ -46,11 +50,14 @@ function buildProtocCommand(protoFiles) {
   const plugin = `--plugin=protoc-gen-js-mjs="${config.pluginPath}"`;
   const output = `--js-mjs_out=${config.outputDir}`;
   const include = `-I ${config.protoDir}`;
+  const options = config.generatorOptions.length > 0 ?
+    `--js-mjs_opt=${config.generatorOptions.join(',')}` : '';
 
   const command = [
     'protoc',
     plugin,
     output,
+    options,
     include,
     ...protoFiles
   ].join(' ');
@@ -93,7 +100,7 @@ async function main() {
   console.log(`执行命令: ${command}`);
 
   try {
-    execSync(command, { stdio: 'inherit' });
+    execSync(command, { stdio: 'inherit', cwd: __dirname });
     console.log('✅ 生成完成!');
   } catch (error) {
     console.error('❌ 生成失败:');
@@ -5,6 +5,426 @@
 
 import * as __PokeworldResourceCfg_resource from '../resource/cfg_resource.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Message: Actor
 export class Actor {
     static __descriptor = {
@@ -12,14 +432,53 @@ export class Actor {
         get clrType() { return Actor; },
         fullName: "pokeworld.actor.cfg.Actor",
         package: "pokeworld.actor.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "player", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.Player", get clrType() { return Player; },label: "LABEL_OPTIONAL"}
+            {name: "player", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.Player", get clrType() { return Player; },oneof: "value", label: "LABEL_OPTIONAL"}
         ]
     }
 
-    // Oneof field (index: 0)
-    /** @type {Player} */
-    player;
+    constructor() {
+    }
+
+    // Oneof: value
+    static ValueCase = Object.freeze({
+        NONE: 0,
+        PLAYER: 1,
+    });
+
+    /** @type {number} */
+    valueCase = 0;
+    __value = undefined;
+
+    /** 
+     * @return {Actor} 
+     */
+    clearValue() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__value = undefined;
+        this.valueCase = 0;
+        return this;
+    }
+
+    /** @type {Player|undefined} */
+    get player() {
+        return this.valueCase === 1 ? this.__value : undefined;
+    }
+    set player(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            if (this.valueCase === 1) {
+                this.__value = undefined;
+                this.valueCase = 0;
+            }
+            return;
+        }
+        this.__value = value;
+        this.valueCase = 1;
+    }
 
     /** 
      * @param {Player} value 
@@ -30,6 +489,317 @@ export class Actor {
         return this;
     }
 
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["player"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        switch (this.valueCase) {
+            case 1:
+                if (!this.__value.__isPristine()) return false;
+                break;
+        }
+        return true;
+    }
+
+    /** 
+     * @return {Actor} a deep copy of this message
+     */
+    clone() {
+        return new Actor().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Actor} other 
+     * @return {Actor} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        switch (other.valueCase) {
+            case 1: this.player = __cloneMessage(other.__value); break;
+            default: this.clearValue(); break;
+        }
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Actor} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Actor)) return false;
+        if (this.valueCase !== other.valueCase) return false;
+        switch (this.valueCase) {
+            case 1: if (!__equalsMessage(this.__value, other.__value)) return false; break;
+        }
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.valueCase);
+        switch (this.valueCase) {
+            case 1: hash = __hashMessage(hash, this.__value); break;
+        }
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Actor} 
+     */
+    clear() {
+        this.__dirty0 = 0;
+        this.valueCase = 0;
+        this.__value = undefined;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Actor} 
+     */
+    static acquire() {
+        const message = Actor.__pool.pop();
+        if (message === undefined) return new Actor();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Actor} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Actor instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Actor.__pool.length < 64) {
+            Actor.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        switch (this.valueCase) {
+            case 1: Player.release(this.__value); break;
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).player = this.player ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.player) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).player = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Actor} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.player) !== undefined) {
+                this.player = value === null ? undefined : (value instanceof Player ? value.clone().commit() : new Player().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.player) !== undefined) {
+                (this.player ?? (this.player = new Player())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Actor} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.player)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        switch (this.valueCase) {
+            case 1: json.player = this.__value; break;
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Actor.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.player;
+        if (value != null && (error = Player.validate(value)) !== null) return __prefixError(error, "player");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Actor}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Actor.acquire();
+        try {
+            let value;
+            value = json.player;
+            if (value != null) {
+                message.player = __decodeNested(Player, value, "player");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Actor.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ActorView {
+        static __layout = {
+            size: 8,
+            hash: 0xad31b88c,
+            presence: 0,
+            fields: [
+                {name: "player", type: "TYPE_MESSAGE", offset: 4, oneof: 0, number: 1, get view() { return Player.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ActorView.__layout.hash);
+            return new ActorView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get valueCase() {
+            return __flatUint32(this.__view, this.__offset + 0);
+        }
+
+        get player() {
+            return __flatUint32(this.__view, this.__offset + 0) === 1 ? __flatMessage(this.__view, this.__offset + 4, Player.View) : undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ActorColumns extends __ColumnTable {
+        static Row = class ActorRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get player() {
+                return this.__table.columns.player[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                player: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ActorColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.player[i] = row.player;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: Player
@@ -39,6 +809,7 @@ export class Player {
         get clrType() { return Player; },
         fullName: "pokeworld.actor.cfg.Player",
         package: "pokeworld.actor.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
             {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
@@ -51,8 +822,27 @@ export class Player {
         ]
     }
 
+    constructor() {
+        this.__id = 0;
+        this.__name = "";
+        this.__resourceId = __PokeworldResourceCfg_resource.ResourceId.NONE;
+        this.__walkSpeed = 0;
+        this.__walkAtlasResourceId = __PokeworldResourceCfg_resource.ResourceId.NONE;
+        this.__runSpeed = 0;
+        this.__startingTurnTime = 0;
+        this.__illustrationResourceId = __PokeworldResourceCfg_resource.ResourceId.NONE;
+    }
+
+    __id = undefined;
+
     /** @type {number} */
-    id;
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
     /** 
      * @param {number} value 
@@ -60,11 +850,21 @@ export class Player {
      */
     withId(value) {
         this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __name = undefined;
+
     /** @type {string} */
-    name;
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
 
     /** 
      * @param {string} value 
@@ -72,23 +872,43 @@ export class Player {
      */
     withName(value) {
         this.name = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {__PokeworldResourceCfg_resource.ResourceId} */
-    resourceId;
+    __resourceId = undefined;
+
+    /** @type {__PokeworldResourceCfg_resource.ResourceId[keyof typeof __PokeworldResourceCfg_resource.ResourceId]} */
+    get resourceId() {
+        return this.__resourceId;
+    }
+    set resourceId(value) {
+        this.__rawStale = true;
+        this.__resourceId = value;
+    }
 
     /** 
-     * @param {__PokeworldResourceCfg_resource.ResourceId} value 
+     * @param {__PokeworldResourceCfg_resource.ResourceId[keyof typeof __PokeworldResourceCfg_resource.ResourceId]} value 
      * @return {Player} 
      */
     withResourceId(value) {
         this.resourceId = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
+    __walkSpeed = undefined;
+
     /** @type {number} */
-    walkSpeed;
+    get walkSpeed() {
+        return this.__walkSpeed;
+    }
+    set walkSpeed(value) {
+        this.__rawStale = true;
+        this.__walkSpeed = value;
+    }
 
     /** 
      * @param {number} value 
@@ -96,23 +916,43 @@ export class Player {
      */
     withWalkSpeed(value) {
         this.walkSpeed = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {__PokeworldResourceCfg_resource.ResourceId} */
-    walkAtlasResourceId;
+    __walkAtlasResourceId = undefined;
+
+    /** @type {__PokeworldResourceCfg_resource.ResourceId[keyof typeof __PokeworldResourceCfg_resource.ResourceId]} */
+    get walkAtlasResourceId() {
+        return this.__walkAtlasResourceId;
+    }
+    set walkAtlasResourceId(value) {
+        this.__rawStale = true;
+        this.__walkAtlasResourceId = value;
+    }
 
     /** 
-     * @param {__PokeworldResourceCfg_resource.ResourceId} value 
+     * @param {__PokeworldResourceCfg_resource.ResourceId[keyof typeof __PokeworldResourceCfg_resource.ResourceId]} value 
      * @return {Player} 
      */
     withWalkAtlasResourceId(value) {
         this.walkAtlasResourceId = value;
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
         return this;
     }
 
+    __runSpeed = undefined;
+
     /** @type {number} */
-    runSpeed;
+    get runSpeed() {
+        return this.__runSpeed;
+    }
+    set runSpeed(value) {
+        this.__rawStale = true;
+        this.__runSpeed = value;
+    }
 
     /** 
      * @param {number} value 
@@ -120,11 +960,21 @@ export class Player {
      */
     withRunSpeed(value) {
         this.runSpeed = value;
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
         return this;
     }
 
+    __startingTurnTime = undefined;
+
     /** @type {number} */
-    startingTurnTime;
+    get startingTurnTime() {
+        return this.__startingTurnTime;
+    }
+    set startingTurnTime(value) {
+        this.__rawStale = true;
+        this.__startingTurnTime = value;
+    }
 
     /** 
      * @param {number} value 
@@ -132,21 +982,507 @@ export class Player {
      */
     withStartingTurnTime(value) {
         this.startingTurnTime = value;
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {__PokeworldResourceCfg_resource.ResourceId} */
-    illustrationResourceId;
+    __illustrationResourceId = undefined;
+
+    /** @type {__PokeworldResourceCfg_resource.ResourceId[keyof typeof __PokeworldResourceCfg_resource.ResourceId]} */
+    get illustrationResourceId() {
+        return this.__illustrationResourceId;
+    }
+    set illustrationResourceId(value) {
+        this.__rawStale = true;
+        this.__illustrationResourceId = value;
+    }
 
     /** 
-     * @param {__PokeworldResourceCfg_resource.ResourceId} value 
+     * @param {__PokeworldResourceCfg_resource.ResourceId[keyof typeof __PokeworldResourceCfg_resource.ResourceId]} value 
      * @return {Player} 
      */
     withIllustrationResourceId(value) {
         this.illustrationResourceId = value;
+        this.__dirty0 |= 128;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["id", "name", "resourceId", "walkSpeed", "walkAtlasResourceId", "runSpeed", "startingTurnTime", "illustrationResourceId"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Player} a deep copy of this message
+     */
+    clone() {
+        return new Player().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Player} other 
+     * @return {Player} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.name = other.name;
+        this.resourceId = other.resourceId;
+        this.walkSpeed = other.walkSpeed;
+        this.walkAtlasResourceId = other.walkAtlasResourceId;
+        this.runSpeed = other.runSpeed;
+        this.startingTurnTime = other.startingTurnTime;
+        this.illustrationResourceId = other.illustrationResourceId;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Player} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Player)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if ((this.resourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE) !== (other.resourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE)) return false;
+        if ((this.walkSpeed ?? 0) !== (other.walkSpeed ?? 0)) return false;
+        if ((this.walkAtlasResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE) !== (other.walkAtlasResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE)) return false;
+        if ((this.runSpeed ?? 0) !== (other.runSpeed ?? 0)) return false;
+        if ((this.startingTurnTime ?? 0) !== (other.startingTurnTime ?? 0)) return false;
+        if ((this.illustrationResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE) !== (other.illustrationResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashNumber(hash, this.resourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE);
+        hash = __hashNumber(hash, this.walkSpeed ?? 0);
+        hash = __hashNumber(hash, this.walkAtlasResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE);
+        hash = __hashNumber(hash, this.runSpeed ?? 0);
+        hash = __hashNumber(hash, this.startingTurnTime ?? 0);
+        hash = __hashNumber(hash, this.illustrationResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Player} 
+     */
+    clear() {
+        this.id = 0;
+        this.name = "";
+        this.resourceId = __PokeworldResourceCfg_resource.ResourceId.NONE;
+        this.walkSpeed = 0;
+        this.walkAtlasResourceId = __PokeworldResourceCfg_resource.ResourceId.NONE;
+        this.runSpeed = 0;
+        this.startingTurnTime = 0;
+        this.illustrationResourceId = __PokeworldResourceCfg_resource.ResourceId.NONE;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Player} 
+     */
+    static acquire() {
+        const message = Player.__pool.pop();
+        if (message === undefined) return new Player();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Player} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Player instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Player.__pool.length < 64) {
+            Player.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).name = this.name; break;
+                case 4: (full ??= {}).resourceId = this.resourceId; break;
+                case 8: (full ??= {}).walkSpeed = this.walkSpeed; break;
+                case 16: (full ??= {}).walkAtlasResourceId = this.walkAtlasResourceId; break;
+                case 32: (full ??= {}).runSpeed = this.runSpeed; break;
+                case 64: (full ??= {}).startingTurnTime = this.startingTurnTime; break;
+                case 128: (full ??= {}).illustrationResourceId = this.illustrationResourceId; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Player} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.resourceId) !== undefined) {
+                this.resourceId = value;
+            }
+            if ((value = full.walkSpeed) !== undefined) {
+                this.walkSpeed = value;
+            }
+            if ((value = full.walkAtlasResourceId) !== undefined) {
+                this.walkAtlasResourceId = value;
+            }
+            if ((value = full.runSpeed) !== undefined) {
+                this.runSpeed = value;
+            }
+            if ((value = full.startingTurnTime) !== undefined) {
+                this.startingTurnTime = value;
+            }
+            if ((value = full.illustrationResourceId) !== undefined) {
+                this.illustrationResourceId = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
         return this;
     }
 
+    /** 
+     * Mark the current state as synchronized
+     * @return {Player} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            name: this.name,
+            resourceId: this.resourceId,
+            walkSpeed: this.walkSpeed,
+            walkAtlasResourceId: this.walkAtlasResourceId,
+            runSpeed: this.runSpeed,
+            startingTurnTime: this.startingTurnTime,
+            illustrationResourceId: this.illustrationResourceId,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Player.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.resourceId;
+        if (value != null && !__isEnum(__PokeworldResourceCfg_resource.ResourceId, value)) return __invalid("resourceId", "enum ResourceId");
+        value = json.walkSpeed;
+        if (value != null && !__isFloat(value)) return __invalid("walkSpeed", "float");
+        value = json.walkAtlasResourceId;
+        if (value != null && !__isEnum(__PokeworldResourceCfg_resource.ResourceId, value)) return __invalid("walkAtlasResourceId", "enum ResourceId");
+        value = json.runSpeed;
+        if (value != null && !__isFloat(value)) return __invalid("runSpeed", "float");
+        value = json.startingTurnTime;
+        if (value != null && !__isFloat(value)) return __invalid("startingTurnTime", "float");
+        value = json.illustrationResourceId;
+        if (value != null && !__isEnum(__PokeworldResourceCfg_resource.ResourceId, value)) return __invalid("illustrationResourceId", "enum ResourceId");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Player}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Player.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.resourceId;
+            if (value != null) {
+                if (!__isEnum(__PokeworldResourceCfg_resource.ResourceId, value)) throw __invalid("resourceId", "enum ResourceId");
+                message.resourceId = value;
+            }
+            value = json.walkSpeed;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("walkSpeed", "float");
+                message.walkSpeed = value;
+            }
+            value = json.walkAtlasResourceId;
+            if (value != null) {
+                if (!__isEnum(__PokeworldResourceCfg_resource.ResourceId, value)) throw __invalid("walkAtlasResourceId", "enum ResourceId");
+                message.walkAtlasResourceId = value;
+            }
+            value = json.runSpeed;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("runSpeed", "float");
+                message.runSpeed = value;
+            }
+            value = json.startingTurnTime;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("startingTurnTime", "float");
+                message.startingTurnTime = value;
+            }
+            value = json.illustrationResourceId;
+            if (value != null) {
+                if (!__isEnum(__PokeworldResourceCfg_resource.ResourceId, value)) throw __invalid("illustrationResourceId", "enum ResourceId");
+                message.illustrationResourceId = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Player.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class PlayerView {
+        static __layout = {
+            size: 40,
+            hash: 0xffc89f31,
+            presence: 8,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 8},
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "resourceId", type: "TYPE_ENUM", offset: 12},
+                {name: "walkSpeed", type: "TYPE_FLOAT", offset: 16},
+                {name: "walkAtlasResourceId", type: "TYPE_ENUM", offset: 20},
+                {name: "runSpeed", type: "TYPE_FLOAT", offset: 24},
+                {name: "startingTurnTime", type: "TYPE_FLOAT", offset: 28},
+                {name: "illustrationResourceId", type: "TYPE_ENUM", offset: 32}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, PlayerView.__layout.hash);
+            return new PlayerView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get resourceId() {
+            return __flatInt32(this.__view, this.__offset + 12);
+        }
+
+        get walkSpeed() {
+            return __flatFloat(this.__view, this.__offset + 16);
+        }
+
+        get walkAtlasResourceId() {
+            return __flatInt32(this.__view, this.__offset + 20);
+        }
+
+        get runSpeed() {
+            return __flatFloat(this.__view, this.__offset + 24);
+        }
+
+        get startingTurnTime() {
+            return __flatFloat(this.__view, this.__offset + 28);
+        }
+
+        get illustrationResourceId() {
+            return __flatInt32(this.__view, this.__offset + 32);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class PlayerColumns extends __ColumnTable {
+        static Row = class PlayerRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get resourceId() {
+                return this.__table.columns.resourceId[this.__index];
+            }
+
+            get walkSpeed() {
+                return this.__table.columns.walkSpeed[this.__index];
+            }
+
+            get walkAtlasResourceId() {
+                return this.__table.columns.walkAtlasResourceId[this.__index];
+            }
+
+            get runSpeed() {
+                return this.__table.columns.runSpeed[this.__index];
+            }
+
+            get startingTurnTime() {
+                return this.__table.columns.startingTurnTime[this.__index];
+            }
+
+            get illustrationResourceId() {
+                return this.__table.columns.illustrationResourceId[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                id: new Int32Array(length),
+                name: new Uint32Array(length),
+                resourceId: new Int32Array(length),
+                walkSpeed: new Float32Array(length),
+                walkAtlasResourceId: new Int32Array(length),
+                runSpeed: new Float32Array(length),
+                startingTurnTime: new Float32Array(length),
+                illustrationResourceId: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new PlayerColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.resourceId[i] = row.resourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE;
+                columns.walkSpeed[i] = row.walkSpeed ?? 0;
+                columns.walkAtlasResourceId[i] = row.walkAtlasResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE;
+                columns.runSpeed[i] = row.runSpeed ?? 0;
+                columns.startingTurnTime[i] = row.startingTurnTime ?? 0;
+                columns.illustrationResourceId[i] = row.illustrationResourceId ?? __PokeworldResourceCfg_resource.ResourceId.NONE;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: TbPlayer
@@ -156,13 +1492,32 @@ export class TbPlayer {
         get clrType() { return TbPlayer; },
         fullName: "pokeworld.actor.cfg.TbPlayer",
         package: "pokeworld.actor.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.Player", get clrType() { return Player; },label: "LABEL_REPEATED"}
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.Player", get clrType() { return Player; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
     /** @type {Player[]} */
-    dataList;
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbPlayer.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
 
     /** 
      * @param {Player[]} value 
@@ -170,8 +1525,356 @@ export class TbPlayer {
      */
     withDataList(value) {
         this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbPlayer} a deep copy of this message
+     */
+    clone() {
+        return new TbPlayer().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbPlayer} other 
+     * @return {TbPlayer} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
         return this;
     }
 
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbPlayer} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbPlayer)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbPlayer} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbPlayer} 
+     */
+    static acquire() {
+        const message = TbPlayer.__pool.pop();
+        if (message === undefined) return new TbPlayer();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbPlayer} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbPlayer instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbPlayer.__pool.length < 64) {
+            TbPlayer.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof Player) Player.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbPlayer} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof Player ? item.clone().commit() : new Player().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbPlayer} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbPlayer.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Player.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbPlayer}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbPlayer.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Player, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbPlayer.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbPlayerView {
+        static __layout = {
+            size: 8,
+            hash: 0x5e08d23a,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Player.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbPlayerView.__layout.hash);
+            return new TbPlayerView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Player.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbPlayerColumns extends __ColumnTable {
+        static Row = class TbPlayerRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbPlayerColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/actor/cfg_actor.proto",
+    dependencies: ["pokeworld/resource/cfg_resource.proto"],
+    data: "Ch9wb2tld29ybGQvYWN0b3IvY2ZnX2FjdG9yLnByb3RvEhNwb2tld29ybGQuYWN0b3IuY2ZnGiVwb2tld29ybGQvcmVzb3VyY2UvY2ZnX3Jlc291cmNlLnByb3RvIkcKBUFjdG9yEjUKBnBsYXllchgBIAEoCzIbLnBva2V3b3JsZC5hY3Rvci5jZmcuUGxheWVySABSBnBsYXllckIHCgV2YWx1ZSKSAwoGUGxheWVyEg4KAmlkGAEgASgFUgJpZBISCgRuYW1lGAIgASgJUgRuYW1lEkMKC3Jlc291cmNlX2lkGAMgASgOMiIucG9rZXdvcmxkLnJlc291cmNlLmNmZy5SZXNvdXJjZUlkUgpyZXNvdXJjZUlkEh0KCndhbGtfc3BlZWQYBCABKAJSCXdhbGtTcGVlZBJXChZ3YWxrX2F0bGFzX3Jlc291cmNlX2lkGAUgASgOMiIucG9rZXdvcmxkLnJlc291cmNlLmNmZy5SZXNvdXJjZUlkUhN3YWxrQXRsYXNSZXNvdXJjZUlkEhsKCXJ1bl9zcGVlZBgGIAEoAlIIcnVuU3BlZWQSLAoSc3RhcnRpbmdfdHVybl90aW1lGAcgASgCUhBzdGFydGluZ1R1cm5UaW1lElwKGGlsbHVzdHJhdGlvbl9yZXNvdXJjZV9pZBgIIAEoDjIiLnBva2V3b3JsZC5yZXNvdXJjZS5jZmcuUmVzb3VyY2VJZFIWaWxsdXN0cmF0aW9uUmVzb3VyY2VJZCJICghUYlBsYXllchI8CglkYXRhX2xpc3QYASADKAsyGy5wb2tld29ybGQuYWN0b3IuY2ZnLlBsYXllckICEABSCGRhdGFMaXN0YgZwcm90bzM=",
+};
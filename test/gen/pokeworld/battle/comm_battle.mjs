@@ -0,0 +1,2538 @@
+// Generated by protoc-gen-js-mjs
+// Source: pokeworld/battle/comm_battle.proto
+
+// Package: pokeworld.battle.comm
+
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Codecs of the google.protobuf well-known types
+const __timestampPattern = /^\d{4}-\d{2}-\d{2}[Tt]\d{2}:\d{2}:\d{2}(\.\d{1,9})?([Zz]|[+-]\d{2}:\d{2})$/;
+const __durationPattern = /^(-?)(\d+)(?:\.(\d{1,9}))?s$/;
+
+function __decodeTimestamp(value) {
+    const millis = typeof value === 'number' ? value :
+        value instanceof Date ? value.getTime() :
+        typeof value === 'string' && __timestampPattern.test(value) ? Date.parse(value) : NaN;
+    return Number.isFinite(millis) ? new Date(millis) : undefined;
+}
+
+function __decodeDuration(value) {
+    if (typeof value === 'number') return Number.isFinite(value) ? value : undefined;
+    const match = typeof value === 'string' ? __durationPattern.exec(value) : null;
+    if (match === null) return undefined;
+    const millis = Number(match[2]) * 1000 + (match[3] === undefined ? 0 : Number(match[3].padEnd(9, '0')) / 1e6);
+    return match[1] === '-' ? -millis : millis;
+}
+
+function __decodeFieldMask(value) {
+    if (typeof value === 'string') return value === '' ? [] : value.split(',');
+    return Array.isArray(value) && value.every(path => typeof path === 'string') ? value : undefined;
+}
+
+function __equalsDate(a, b) {
+    return a == null || b == null ? a == b : a.getTime() === b.getTime();
+}
+
+function __hashDate(hash, value) {
+    return __hashNumber(hash, value.getTime());
+}
+
+function __cloneDate(value) {
+    return value == null ? value : new Date(value.getTime());
+}
+
+function __equalsJson(a, b) {
+    if (a === b) return true;
+    if (a === null || b === null || typeof a !== 'object' || typeof b !== 'object' ||
+        Array.isArray(a) !== Array.isArray(b)) {
+        return false;
+    }
+    return Array.isArray(a) ? __equalsArray(a, b, __equalsJson) : __equalsMap(a, b, __equalsJson);
+}
+
+function __hashJson(hash, value) {
+    switch (typeof value) {
+        case 'string': return __hashString(hash, value);
+        case 'number': return __hashNumber(hash, value);
+        case 'boolean': return __hashBool(hash, value);
+        case 'object':
+            if (Array.isArray(value)) return __hashArray(hash, value, __hashJson);
+            if (value !== null) return __hashMap(hash, value, __hashJson);
+    }
+    return Math.imul(hash, 31) | 0;
+}
+
+function __cloneJson(value) {
+    if (value === null || typeof value !== 'object') return value;
+    return Array.isArray(value) ? value.map(__cloneJson) : __cloneMap(value, __cloneJson);
+}
+
+function __isTimestamp(value) {
+    return typeof value !== 'object' && __decodeTimestamp(value) !== undefined;
+}
+
+function __isDuration(value) {
+    return __decodeDuration(value) !== undefined;
+}
+
+function __isFieldMask(value) {
+    return __decodeFieldMask(value) !== undefined;
+}
+
+function __isValue(value) {
+    const type = typeof value;
+    return type === 'object' || type === 'string' || type === 'number' || type === 'boolean';
+}
+
+function __isAny(value) {
+    return __isObject(value) && typeof value['@type'] === 'string';
+}
+
+function __flatTimestamp(view, offset) {
+    return new Date(view.getFloat64(offset, true));
+}
+
+function __flatJson(view, offset) {
+    const text = __flatString(view, offset);
+    return text === '' ? undefined : JSON.parse(text);
+}
+
+// Codecs of the 64-bit integer representation (int64=hybrid)
+function __checkInt64String(value) {
+    if (!/^-?\d+$/.test(value)) {
+        throw new Error(`Invalid 64-bit integer: ${JSON.stringify(value)}`);
+    }
+    return value;
+}
+
+function __decodeInt64(value) {
+    if (typeof value === 'number') {
+        return Number.isSafeInteger(value) ? value : BigInt(value);
+    }
+    if (typeof value === 'string') {
+        if (/^-?\d{1,15}$/.test(value)) return Number(value);
+        __checkInt64String(value);
+    }
+    const big = typeof value === 'bigint' ? value : BigInt(value);
+    return big >= -9007199254740991n && big <= 9007199254740991n ? Number(big) : big;
+}
+
+function __encodeInt64(value) {
+    return typeof value === 'bigint' ? value.toString() : value;
+}
+
+function __hashInt64(hash, value) {
+    return typeof value === 'bigint' ? __hashBigInt(hash, value) : __hashNumber(hash, value);
+}
+
+function __encodeInt64List(list) {
+    return Array.isArray(list) ? list.map(__encodeInt64) : list;
+}
+
+function __hashBigInt(hash, value) {
+    hash = (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value))) | 0;
+    return (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value >> 32n))) | 0;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
+// Message: __BattleEvent_CooldownsEntry
+class __BattleEvent_CooldownsEntry {
+    static __descriptor = {
+        name: "CooldownsEntry",
+        get clrType() { return __BattleEvent_CooldownsEntry; },
+        fullName: "pokeworld.battle.comm.BattleEvent.CooldownsEntry",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "key", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "value", number: 2, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Duration", wkt: "Duration", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__key = "";
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __key = undefined;
+
+    /** @type {string} */
+    get key() {
+        return this.__key;
+    }
+    set key(value) {
+        this.__rawStale = true;
+        this.__key = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    withKey(value) {
+        this.key = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __value = undefined;
+
+    /** @type {number|undefined} */
+    get value() {
+        return this.__value;
+    }
+    set value(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__value = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__value = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasValue() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    clearValue() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__value = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    withValue(value) {
+        this.value = value;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["key", "value"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {__BattleEvent_CooldownsEntry} a deep copy of this message
+     */
+    clone() {
+        return new __BattleEvent_CooldownsEntry().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {__BattleEvent_CooldownsEntry} other 
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.key = other.key;
+        this.value = other.value;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {__BattleEvent_CooldownsEntry} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof __BattleEvent_CooldownsEntry)) return false;
+        if ((this.key ?? "") !== (other.key ?? "")) return false;
+        if (this.value !== other.value) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.key ?? "");
+        hash = (this.value === undefined ? __hashMessage(hash, undefined) : __hashNumber(hash, this.value));
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    clear() {
+        this.key = "";
+        this.__value = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    static acquire() {
+        const message = __BattleEvent_CooldownsEntry.__pool.pop();
+        if (message === undefined) return new __BattleEvent_CooldownsEntry();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {__BattleEvent_CooldownsEntry} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('__BattleEvent_CooldownsEntry instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (__BattleEvent_CooldownsEntry.__pool.length < 64) {
+            __BattleEvent_CooldownsEntry.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).key = this.key; break;
+                case 2: (full ??= {}).value = this.value ?? null; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.key) !== undefined) {
+                this.key = value;
+            }
+            if ((value = full.value) !== undefined) {
+                this.value = value === null ? undefined : __decodeDuration(value);
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {__BattleEvent_CooldownsEntry} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            key: this.key,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.value = this.__value; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, __BattleEvent_CooldownsEntry.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.key;
+        if (value != null && !__isString(value)) return __invalid("key", "string");
+        value = json.value;
+        if (value != null && !__isDuration(value)) return __invalid("value", "google.protobuf.Duration");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {__BattleEvent_CooldownsEntry}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = __BattleEvent_CooldownsEntry.acquire();
+        try {
+            let value;
+            value = json.key;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("key", "string");
+                message.key = value;
+            }
+            value = json.value;
+            if (value != null) {
+                if (!__isDuration(value)) throw __invalid("value", "google.protobuf.Duration");
+                message.value = __decodeDuration(value);
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            __BattleEvent_CooldownsEntry.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+}
+
+// Message: BattleEvent
+export class BattleEvent {
+    static __descriptor = {
+        name: "BattleEvent",
+        get clrType() { return BattleEvent; },
+        fullName: "pokeworld.battle.comm.BattleEvent",
+        package: "pokeworld.battle.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "battleId", number: 1, type: "TYPE_UINT64", int64: "hybrid", label: "LABEL_OPTIONAL"},
+            {name: "occurredAt", number: 2, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Timestamp", wkt: "Timestamp", label: "LABEL_OPTIONAL"},
+            {name: "elapsed", number: 3, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Duration", wkt: "Duration", label: "LABEL_OPTIONAL"},
+            {name: "damage", number: 4, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Int32Value", wkt: "Int32Value", label: "LABEL_OPTIONAL"},
+            {name: "moveName", number: 5, type: "TYPE_MESSAGE", typeName: ".google.protobuf.StringValue", wkt: "StringValue", label: "LABEL_OPTIONAL"},
+            {name: "critical", number: 6, type: "TYPE_MESSAGE", typeName: ".google.protobuf.BoolValue", wkt: "BoolValue", label: "LABEL_OPTIONAL"},
+            {name: "extra", number: 7, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Struct", wkt: "Struct", label: "LABEL_OPTIONAL"},
+            {name: "payload", number: 8, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Value", wkt: "Value", label: "LABEL_OPTIONAL"},
+            {name: "tags", number: 9, type: "TYPE_MESSAGE", typeName: ".google.protobuf.ListValue", wkt: "ListValue", label: "LABEL_OPTIONAL"},
+            {name: "updateMask", number: 10, type: "TYPE_MESSAGE", typeName: ".google.protobuf.FieldMask", wkt: "FieldMask", label: "LABEL_OPTIONAL"},
+            {name: "detail", number: 11, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Any", wkt: "Any", label: "LABEL_OPTIONAL"},
+            {name: "checkpoints", number: 12, type: "TYPE_MESSAGE", typeName: ".google.protobuf.Timestamp", wkt: "Timestamp", label: "LABEL_REPEATED"},
+            {name: "cooldowns", number: 13, type: "TYPE_MESSAGE", typeName: ".pokeworld.battle.comm.BattleEvent.CooldownsEntry", get clrType() { return __BattleEvent_CooldownsEntry; },label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.__battleId = 0;
+        this.__checkpoints = [];
+        this.__cooldowns = [];
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __battleId = undefined;
+
+    /** @type {(number|bigint)} */
+    get battleId() {
+        return this.__battleId;
+    }
+    set battleId(value) {
+        this.__rawStale = true;
+        this.__battleId = value;
+    }
+
+    /** 
+     * @param {(number|bigint)} value 
+     * @return {BattleEvent} 
+     */
+    withBattleId(value) {
+        this.battleId = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __occurredAt = undefined;
+
+    /** @type {Date|undefined} */
+    get occurredAt() {
+        return this.__occurredAt;
+    }
+    set occurredAt(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__occurredAt = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__occurredAt = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasOccurredAt() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearOccurredAt() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__occurredAt = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {Date} value 
+     * @return {BattleEvent} 
+     */
+    withOccurredAt(value) {
+        this.occurredAt = value;
+        return this;
+    }
+
+    __elapsed = undefined;
+
+    /** @type {number|undefined} */
+    get elapsed() {
+        return this.__elapsed;
+    }
+    set elapsed(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__elapsed = undefined;
+            this.__has0 &= ~2;
+        } else {
+            this.__elapsed = value;
+            this.__has0 |= 2;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasElapsed() {
+        return (this.__has0 & 2) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearElapsed() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__elapsed = undefined;
+        this.__has0 &= ~2;
+        return this;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {BattleEvent} 
+     */
+    withElapsed(value) {
+        this.elapsed = value;
+        return this;
+    }
+
+    __damage = undefined;
+
+    /** @type {number|undefined} */
+    get damage() {
+        return this.__damage;
+    }
+    set damage(value) {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__damage = undefined;
+            this.__has0 &= ~4;
+        } else {
+            this.__damage = value;
+            this.__has0 |= 4;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasDamage() {
+        return (this.__has0 & 4) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearDamage() {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__damage = undefined;
+        this.__has0 &= ~4;
+        return this;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {BattleEvent} 
+     */
+    withDamage(value) {
+        this.damage = value;
+        return this;
+    }
+
+    __moveName = undefined;
+
+    /** @type {string|undefined} */
+    get moveName() {
+        return this.__moveName;
+    }
+    set moveName(value) {
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__moveName = undefined;
+            this.__has0 &= ~8;
+        } else {
+            this.__moveName = value;
+            this.__has0 |= 8;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasMoveName() {
+        return (this.__has0 & 8) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearMoveName() {
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
+        this.__moveName = undefined;
+        this.__has0 &= ~8;
+        return this;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {BattleEvent} 
+     */
+    withMoveName(value) {
+        this.moveName = value;
+        return this;
+    }
+
+    __critical = undefined;
+
+    /** @type {boolean|undefined} */
+    get critical() {
+        return this.__critical;
+    }
+    set critical(value) {
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__critical = undefined;
+            this.__has0 &= ~16;
+        } else {
+            this.__critical = value;
+            this.__has0 |= 16;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasCritical() {
+        return (this.__has0 & 16) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearCritical() {
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
+        this.__critical = undefined;
+        this.__has0 &= ~16;
+        return this;
+    }
+
+    /** 
+     * @param {boolean} value 
+     * @return {BattleEvent} 
+     */
+    withCritical(value) {
+        this.critical = value;
+        return this;
+    }
+
+    __extra = undefined;
+
+    /** @type {Object<string, any>|undefined} */
+    get extra() {
+        return this.__extra;
+    }
+    set extra(value) {
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__extra = undefined;
+            this.__has0 &= ~32;
+        } else {
+            this.__extra = value;
+            this.__has0 |= 32;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasExtra() {
+        return (this.__has0 & 32) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearExtra() {
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
+        this.__extra = undefined;
+        this.__has0 &= ~32;
+        return this;
+    }
+
+    /** 
+     * @param {Object<string, any>} value 
+     * @return {BattleEvent} 
+     */
+    withExtra(value) {
+        this.extra = value;
+        return this;
+    }
+
+    __payload = undefined;
+
+    /** @type {any|undefined} */
+    get payload() {
+        return this.__payload;
+    }
+    set payload(value) {
+        this.__dirty0 |= 128;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__payload = undefined;
+            this.__has0 &= ~64;
+        } else {
+            this.__payload = value;
+            this.__has0 |= 64;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasPayload() {
+        return (this.__has0 & 64) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearPayload() {
+        this.__dirty0 |= 128;
+        this.__rawStale = true;
+        this.__payload = undefined;
+        this.__has0 &= ~64;
+        return this;
+    }
+
+    /** 
+     * @param {any} value 
+     * @return {BattleEvent} 
+     */
+    withPayload(value) {
+        this.payload = value;
+        return this;
+    }
+
+    __tags = undefined;
+
+    /** @type {Array<any>|undefined} */
+    get tags() {
+        return this.__tags;
+    }
+    set tags(value) {
+        this.__dirty0 |= 256;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__tags = undefined;
+            this.__has0 &= ~128;
+        } else {
+            this.__tags = value;
+            this.__has0 |= 128;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasTags() {
+        return (this.__has0 & 128) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearTags() {
+        this.__dirty0 |= 256;
+        this.__rawStale = true;
+        this.__tags = undefined;
+        this.__has0 &= ~128;
+        return this;
+    }
+
+    /** 
+     * @param {Array<any>} value 
+     * @return {BattleEvent} 
+     */
+    withTags(value) {
+        this.tags = value;
+        return this;
+    }
+
+    __updateMask = undefined;
+
+    /** @type {string[]|undefined} */
+    get updateMask() {
+        return this.__updateMask;
+    }
+    set updateMask(value) {
+        this.__dirty0 |= 512;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__updateMask = undefined;
+            this.__has0 &= ~256;
+        } else {
+            this.__updateMask = value;
+            this.__has0 |= 256;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasUpdateMask() {
+        return (this.__has0 & 256) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearUpdateMask() {
+        this.__dirty0 |= 512;
+        this.__rawStale = true;
+        this.__updateMask = undefined;
+        this.__has0 &= ~256;
+        return this;
+    }
+
+    /** 
+     * @param {string[]} value 
+     * @return {BattleEvent} 
+     */
+    withUpdateMask(value) {
+        this.updateMask = value;
+        return this;
+    }
+
+    __detail = undefined;
+
+    /** @type {Object|undefined} */
+    get detail() {
+        return this.__detail;
+    }
+    set detail(value) {
+        this.__dirty0 |= 1024;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            this.__detail = undefined;
+            this.__has0 &= ~512;
+        } else {
+            this.__detail = value;
+            this.__has0 |= 512;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasDetail() {
+        return (this.__has0 & 512) !== 0;
+    }
+
+    /** 
+     * @return {BattleEvent} 
+     */
+    clearDetail() {
+        this.__dirty0 |= 1024;
+        this.__rawStale = true;
+        this.__detail = undefined;
+        this.__has0 &= ~512;
+        return this;
+    }
+
+    /** 
+     * @param {Object} value 
+     * @return {BattleEvent} 
+     */
+    withDetail(value) {
+        this.detail = value;
+        return this;
+    }
+
+    __checkpoints = undefined;
+
+    /** @type {Date[]} */
+    get checkpoints() {
+        return this.__checkpoints;
+    }
+    set checkpoints(value) {
+        this.__rawStale = true;
+        this.__checkpoints = value;
+    }
+
+    /** 
+     * @param {Date[]} value 
+     * @return {BattleEvent} 
+     */
+    withCheckpoints(value) {
+        this.checkpoints = value;
+        this.__dirty0 |= 2048;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __cooldowns = undefined;
+
+    /** @type {any} */
+    get cooldowns() {
+        return this.__cooldowns;
+    }
+    set cooldowns(value) {
+        this.__rawStale = true;
+        this.__cooldowns = value;
+    }
+
+    /** 
+     * @param {any} value 
+     * @return {BattleEvent} 
+     */
+    withCooldowns(value) {
+        this.cooldowns = value;
+        this.__dirty0 |= 4096;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["battleId", "occurredAt", "elapsed", "damage", "moveName", "critical", "extra", "payload", "tags", "updateMask", "detail", "checkpoints", "cooldowns"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__checkpoints) != null) {
+            raw = this.__raw.checkpoints;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+        }
+        if ((value = this.__cooldowns) != null) {
+            raw = this.__raw.cooldowns;
+            if (raw == null ? Object.keys(value).length !== 0
+                : Array.isArray(value) !== Array.isArray(raw) || Object.keys(value).length !== Object.keys(raw).length) return false;
+            for (const key in value) {
+                if (Array.isArray(value) && value[key] != null && !value[key].__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {BattleEvent} a deep copy of this message
+     */
+    clone() {
+        return new BattleEvent().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {BattleEvent} other 
+     * @return {BattleEvent} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.battleId = other.battleId;
+        this.occurredAt = __cloneDate(other.occurredAt);
+        this.elapsed = other.elapsed;
+        this.damage = other.damage;
+        this.moveName = other.moveName;
+        this.critical = other.critical;
+        this.extra = __cloneJson(other.extra);
+        this.payload = __cloneJson(other.payload);
+        this.tags = __cloneJson(other.tags);
+        this.updateMask = __cloneJson(other.updateMask);
+        this.detail = __cloneJson(other.detail);
+        this.checkpoints = __cloneArray(other.checkpoints, __cloneDate);
+        this.cooldowns = __cloneMap(other.cooldowns, undefined);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {BattleEvent} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof BattleEvent)) return false;
+        if ((this.battleId ?? 0) !== (other.battleId ?? 0)) return false;
+        if (!__equalsDate(this.occurredAt, other.occurredAt)) return false;
+        if (this.elapsed !== other.elapsed) return false;
+        if (this.damage !== other.damage) return false;
+        if (this.moveName !== other.moveName) return false;
+        if (this.critical !== other.critical) return false;
+        if (!__equalsJson(this.extra, other.extra)) return false;
+        if (!__equalsJson(this.payload, other.payload)) return false;
+        if (!__equalsJson(this.tags, other.tags)) return false;
+        if (!__equalsJson(this.updateMask, other.updateMask)) return false;
+        if (!__equalsJson(this.detail, other.detail)) return false;
+        if (!__equalsArray(this.checkpoints, other.checkpoints, __equalsDate)) return false;
+        if (!__equalsMap(this.cooldowns, other.cooldowns, undefined)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashInt64(hash, this.battleId ?? 0);
+        hash = (this.occurredAt === undefined ? __hashMessage(hash, undefined) : __hashDate(hash, this.occurredAt));
+        hash = (this.elapsed === undefined ? __hashMessage(hash, undefined) : __hashNumber(hash, this.elapsed));
+        hash = (this.damage === undefined ? __hashMessage(hash, undefined) : __hashNumber(hash, this.damage));
+        hash = (this.moveName === undefined ? __hashMessage(hash, undefined) : __hashString(hash, this.moveName));
+        hash = (this.critical === undefined ? __hashMessage(hash, undefined) : __hashBool(hash, this.critical));
+        hash = (this.extra === undefined ? __hashMessage(hash, undefined) : __hashJson(hash, this.extra));
+        hash = (this.payload === undefined ? __hashMessage(hash, undefined) : __hashJson(hash, this.payload));
+        hash = (this.tags === undefined ? __hashMessage(hash, undefined) : __hashJson(hash, this.tags));
+        hash = (this.updateMask === undefined ? __hashMessage(hash, undefined) : __hashJson(hash, this.updateMask));
+        hash = (this.detail === undefined ? __hashMessage(hash, undefined) : __hashJson(hash, this.detail));
+        hash = __hashArray(hash, this.checkpoints, __hashDate);
+        hash = __hashMap(hash, this.cooldowns, __hashNumber);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {BattleEvent} 
+     */
+    clear() {
+        this.battleId = 0;
+        if (Array.isArray(this.checkpoints)) this.checkpoints.length = 0; else this.checkpoints = [];
+        if (Array.isArray(this.cooldowns)) this.cooldowns.length = 0; else this.cooldowns = [];
+        this.__occurredAt = undefined;
+        this.__elapsed = undefined;
+        this.__damage = undefined;
+        this.__moveName = undefined;
+        this.__critical = undefined;
+        this.__extra = undefined;
+        this.__payload = undefined;
+        this.__tags = undefined;
+        this.__updateMask = undefined;
+        this.__detail = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {BattleEvent} 
+     */
+    static acquire() {
+        const message = BattleEvent.__pool.pop();
+        if (message === undefined) return new BattleEvent();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {BattleEvent} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('BattleEvent instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (BattleEvent.__pool.length < 64) {
+            BattleEvent.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).battleId = __encodeInt64(this.battleId); break;
+                case 2: (full ??= {}).occurredAt = this.occurredAt ?? null; break;
+                case 4: (full ??= {}).elapsed = this.elapsed ?? null; break;
+                case 8: (full ??= {}).damage = this.damage ?? null; break;
+                case 16: (full ??= {}).moveName = this.moveName ?? null; break;
+                case 32: (full ??= {}).critical = this.critical ?? null; break;
+                case 64: (full ??= {}).extra = this.extra ?? null; break;
+                case 128: (full ??= {}).payload = this.payload ?? null; break;
+                case 256: (full ??= {}).tags = this.tags ?? null; break;
+                case 512: (full ??= {}).updateMask = this.updateMask ?? null; break;
+                case 1024: (full ??= {}).detail = this.detail ?? null; break;
+                case 2048: (full ??= {}).checkpoints = this.checkpoints; break;
+                case 4096: (full ??= {}).cooldowns = this.cooldowns; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {BattleEvent} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.battleId) !== undefined) {
+                this.battleId = value === null ? undefined : __decodeInt64(value);
+            }
+            if ((value = full.occurredAt) !== undefined) {
+                this.occurredAt = value === null ? undefined : __decodeTimestamp(value);
+            }
+            if ((value = full.elapsed) !== undefined) {
+                this.elapsed = value === null ? undefined : __decodeDuration(value);
+            }
+            if ((value = full.damage) !== undefined) {
+                this.damage = value;
+            }
+            if ((value = full.moveName) !== undefined) {
+                this.moveName = value;
+            }
+            if ((value = full.critical) !== undefined) {
+                this.critical = value;
+            }
+            if ((value = full.extra) !== undefined) {
+                this.extra = value;
+            }
+            if ((value = full.payload) !== undefined) {
+                this.payload = value;
+            }
+            if ((value = full.tags) !== undefined) {
+                this.tags = value;
+            }
+            if ((value = full.updateMask) !== undefined) {
+                this.updateMask = value === null ? undefined : __decodeFieldMask(value);
+            }
+            if ((value = full.detail) !== undefined) {
+                this.detail = value;
+            }
+            if ((value = full.checkpoints) !== undefined) {
+                this.checkpoints = value === null ? [] : value.map(item => __decodeTimestamp(item));
+            }
+            if ((value = full.cooldowns) !== undefined) {
+                this.cooldowns = value === null ? [] : value.slice();
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {BattleEvent} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            battleId: __encodeInt64(this.battleId),
+            checkpoints: this.checkpoints,
+            cooldowns: this.cooldowns,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.occurredAt = this.__occurredAt; break;
+                case 2: json.elapsed = this.__elapsed; break;
+                case 4: json.damage = this.__damage; break;
+                case 8: json.moveName = this.__moveName; break;
+                case 16: json.critical = this.__critical; break;
+                case 32: json.extra = this.__extra; break;
+                case 64: json.payload = this.__payload; break;
+                case 128: json.tags = this.__tags; break;
+                case 256: json.updateMask = this.__updateMask; break;
+                case 512: json.detail = this.__detail; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, BattleEvent.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.battleId;
+        if (value != null && !__isUint64(value)) return __invalid("battleId", "uint64");
+        value = json.occurredAt;
+        if (value != null && !__isTimestamp(value)) return __invalid("occurredAt", "google.protobuf.Timestamp");
+        value = json.elapsed;
+        if (value != null && !__isDuration(value)) return __invalid("elapsed", "google.protobuf.Duration");
+        value = json.damage;
+        if (value != null && !__isInt32(value)) return __invalid("damage", "google.protobuf.Int32Value");
+        value = json.moveName;
+        if (value != null && !__isString(value)) return __invalid("moveName", "google.protobuf.StringValue");
+        value = json.critical;
+        if (value != null && !__isBool(value)) return __invalid("critical", "google.protobuf.BoolValue");
+        value = json.extra;
+        if (value != null && !__isObject(value)) return __invalid("extra", "google.protobuf.Struct");
+        value = json.payload;
+        if (value != null && !__isValue(value)) return __invalid("payload", "google.protobuf.Value");
+        value = json.tags;
+        if (value != null && !Array.isArray(value)) return __invalid("tags", "google.protobuf.ListValue");
+        value = json.updateMask;
+        if (value != null && !__isFieldMask(value)) return __invalid("updateMask", "google.protobuf.FieldMask");
+        value = json.detail;
+        if (value != null && !__isAny(value)) return __invalid("detail", "google.protobuf.Any");
+        value = json.checkpoints;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("checkpoints", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if (!__isTimestamp(item)) return __prefixError(__invalid("", "google.protobuf.Timestamp"), "checkpoints", i);
+            }
+        }
+        value = json.cooldowns;
+        if (value != null) {
+            if (Array.isArray(value)) {
+                for (let i = 0; i < value.length; i++) {
+                    if ((error = __BattleEvent_CooldownsEntry.validate(value[i])) !== null) return __prefixError(error, "cooldowns", i);
+                }
+            } else if (!__isObject(value)) {
+                return __invalid("cooldowns", "object or array of entries");
+            } else {
+                for (const key in value) {
+                    const item = value[key];
+                    if (!__isDuration(item)) return __prefixError(__invalid("", "google.protobuf.Duration"), "cooldowns", key);
+                }
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {BattleEvent}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = BattleEvent.acquire();
+        try {
+            let value;
+            value = json.battleId;
+            if (value != null) {
+                if (!__isUint64(value)) throw __invalid("battleId", "uint64");
+                message.battleId = __decodeInt64(value);
+            }
+            value = json.occurredAt;
+            if (value != null) {
+                if (!__isTimestamp(value)) throw __invalid("occurredAt", "google.protobuf.Timestamp");
+                message.occurredAt = __decodeTimestamp(value);
+            }
+            value = json.elapsed;
+            if (value != null) {
+                if (!__isDuration(value)) throw __invalid("elapsed", "google.protobuf.Duration");
+                message.elapsed = __decodeDuration(value);
+            }
+            value = json.damage;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("damage", "google.protobuf.Int32Value");
+                message.damage = value;
+            }
+            value = json.moveName;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("moveName", "google.protobuf.StringValue");
+                message.moveName = value;
+            }
+            value = json.critical;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("critical", "google.protobuf.BoolValue");
+                message.critical = value;
+            }
+            value = json.extra;
+            if (value != null) {
+                if (!__isObject(value)) throw __invalid("extra", "google.protobuf.Struct");
+                message.extra = value;
+            }
+            value = json.payload;
+            if (value != null) {
+                if (!__isValue(value)) throw __invalid("payload", "google.protobuf.Value");
+                message.payload = value;
+            }
+            value = json.tags;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("tags", "google.protobuf.ListValue");
+                message.tags = value;
+            }
+            value = json.updateMask;
+            if (value != null) {
+                if (!__isFieldMask(value)) throw __invalid("updateMask", "google.protobuf.FieldMask");
+                message.updateMask = __decodeFieldMask(value);
+            }
+            value = json.detail;
+            if (value != null) {
+                if (!__isAny(value)) throw __invalid("detail", "google.protobuf.Any");
+                message.detail = value;
+            }
+            value = json.checkpoints;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("checkpoints", "array");
+                const list = new Array(value.length);
+                message.checkpoints = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    if (!__isTimestamp(item)) throw __prefixError(__invalid("", "google.protobuf.Timestamp"), "checkpoints", i);
+                    list[i] = __decodeTimestamp(item);
+                }
+            }
+            value = json.cooldowns;
+            if (value != null) {
+                if (Array.isArray(value)) {
+                    message.cooldowns = value.map((item, i) => __decodeNested(__BattleEvent_CooldownsEntry, item, "cooldowns", i));
+                } else {
+                    if (!__isObject(value)) throw __invalid("cooldowns", "object or array of entries");
+                    const map = {};
+                    for (const key in value) {
+                        const item = value[key];
+                        if (!__isDuration(item)) throw __prefixError(__invalid("", "google.protobuf.Duration"), "cooldowns", key);
+                        map[key] = __decodeDuration(item);
+                    }
+                    message.cooldowns = map;
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            BattleEvent.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class BattleEventView {
+        static __layout = {
+            size: 104,
+            hash: 0xa76e8255,
+            presence: 88,
+            fields: [
+                {name: "battleId", type: "TYPE_UINT64", offset: 0},
+                {name: "occurredAt", type: "TYPE_DOUBLE", offset: 8, wkt: "Timestamp", has: 0},
+                {name: "elapsed", type: "TYPE_DOUBLE", offset: 16, wkt: "Duration", has: 1},
+                {name: "damage", type: "TYPE_INT32", offset: 92, wkt: "Int32Value", has: 2},
+                {name: "moveName", type: "TYPE_STRING", offset: 24, wkt: "StringValue", has: 3},
+                {name: "critical", type: "TYPE_BOOL", offset: 96, wkt: "BoolValue", has: 4},
+                {name: "extra", type: "TYPE_STRING", offset: 32, wkt: "Struct", has: 5},
+                {name: "payload", type: "TYPE_STRING", offset: 40, wkt: "Value", has: 6},
+                {name: "tags", type: "TYPE_STRING", offset: 48, wkt: "ListValue", has: 7},
+                {name: "updateMask", type: "TYPE_STRING", offset: 56, wkt: "FieldMask", has: 8},
+                {name: "detail", type: "TYPE_STRING", offset: 64, wkt: "Any", has: 9},
+                {name: "checkpoints", type: "TYPE_DOUBLE", offset: 72, wkt: "Timestamp", repeated: true, stride: 8},
+                {name: "cooldowns", type: "TYPE_MESSAGE", offset: 80, repeated: true, stride: 16, map: [{name: "key", type: "TYPE_STRING", offset: 0}, {name: "value", type: "TYPE_DOUBLE", offset: 8, wkt: "Duration"}]}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, BattleEventView.__layout.hash);
+            return new BattleEventView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get battleId() {
+            return __flatUint64(this.__view, this.__offset + 0);
+        }
+
+        get occurredAt() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 1) !== 0 ? __flatTimestamp(this.__view, this.__offset + 8) : undefined;
+        }
+
+        hasOccurredAt() {
+            return this.occurredAt !== undefined;
+        }
+
+        get elapsed() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 2) !== 0 ? __flatDouble(this.__view, this.__offset + 16) : undefined;
+        }
+
+        hasElapsed() {
+            return this.elapsed !== undefined;
+        }
+
+        get damage() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 4) !== 0 ? __flatInt32(this.__view, this.__offset + 92) : undefined;
+        }
+
+        hasDamage() {
+            return this.damage !== undefined;
+        }
+
+        get moveName() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 8) !== 0 ? __flatString(this.__view, this.__offset + 24) : undefined;
+        }
+
+        hasMoveName() {
+            return this.moveName !== undefined;
+        }
+
+        get critical() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 16) !== 0 ? __flatBool(this.__view, this.__offset + 96) : undefined;
+        }
+
+        hasCritical() {
+            return this.critical !== undefined;
+        }
+
+        get extra() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 32) !== 0 ? __flatJson(this.__view, this.__offset + 32) : undefined;
+        }
+
+        hasExtra() {
+            return this.extra !== undefined;
+        }
+
+        get payload() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 64) !== 0 ? __flatJson(this.__view, this.__offset + 40) : undefined;
+        }
+
+        hasPayload() {
+            return this.payload !== undefined;
+        }
+
+        get tags() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 128) !== 0 ? __flatJson(this.__view, this.__offset + 48) : undefined;
+        }
+
+        hasTags() {
+            return this.tags !== undefined;
+        }
+
+        get updateMask() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 256) !== 0 ? __flatJson(this.__view, this.__offset + 56) : undefined;
+        }
+
+        hasUpdateMask() {
+            return this.updateMask !== undefined;
+        }
+
+        get detail() {
+            return (__flatUint32(this.__view, this.__offset + 88) & 512) !== 0 ? __flatJson(this.__view, this.__offset + 64) : undefined;
+        }
+
+        hasDetail() {
+            return this.detail !== undefined;
+        }
+
+        get checkpoints() {
+            return __flatList(this.__view, this.__offset + 72, 8, __flatTimestamp);
+        }
+
+        get cooldowns() {
+            return __flatMap(this.__view, this.__offset + 80, 16, __flatString, 0, __flatDouble, 8, undefined);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class BattleEventColumns extends __ColumnTable {
+        static Row = class BattleEventRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get battleId() {
+                return this.__table.columns.battleId[this.__index];
+            }
+
+            get occurredAt() {
+                return this.__table.columns.occurredAt[this.__index];
+            }
+
+            get elapsed() {
+                return this.__table.columns.elapsed[this.__index];
+            }
+
+            get damage() {
+                return this.__table.columns.damage[this.__index];
+            }
+
+            get moveName() {
+                return this.__table.columns.moveName[this.__index];
+            }
+
+            get critical() {
+                return this.__table.columns.critical[this.__index];
+            }
+
+            get extra() {
+                return this.__table.columns.extra[this.__index];
+            }
+
+            get payload() {
+                return this.__table.columns.payload[this.__index];
+            }
+
+            get tags() {
+                return this.__table.columns.tags[this.__index];
+            }
+
+            get updateMask() {
+                return this.__table.columns.updateMask[this.__index];
+            }
+
+            get detail() {
+                return this.__table.columns.detail[this.__index];
+            }
+
+            get checkpoints() {
+                return this.__table.columns.checkpoints[this.__index];
+            }
+
+            get cooldowns() {
+                return this.__table.columns.cooldowns[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                battleId: new Array(length),
+                occurredAt: new Array(length),
+                elapsed: new Array(length),
+                damage: new Array(length),
+                moveName: new Array(length),
+                critical: new Array(length),
+                extra: new Array(length),
+                payload: new Array(length),
+                tags: new Array(length),
+                updateMask: new Array(length),
+                detail: new Array(length),
+                checkpoints: new Array(length),
+                cooldowns: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new BattleEventColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.battleId[i] = row.battleId;
+                columns.occurredAt[i] = row.occurredAt;
+                columns.elapsed[i] = row.elapsed;
+                columns.damage[i] = row.damage;
+                columns.moveName[i] = row.moveName;
+                columns.critical[i] = row.critical;
+                columns.extra[i] = row.extra;
+                columns.payload[i] = row.payload;
+                columns.tags[i] = row.tags;
+                columns.updateMask[i] = row.updateMask;
+                columns.detail[i] = row.detail;
+                columns.checkpoints[i] = row.checkpoints;
+                columns.cooldowns[i] = row.cooldowns;
+            }
+            return table;
+        }
+    };
+
+    static CooldownsEntry = __BattleEvent_CooldownsEntry;
+}
+
+// Message: BattleLog
+export class BattleLog {
+    static __descriptor = {
+        name: "BattleLog",
+        get clrType() { return BattleLog; },
+        fullName: "pokeworld.battle.comm.BattleLog",
+        package: "pokeworld.battle.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "events", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.battle.comm.BattleEvent", get clrType() { return BattleEvent; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.events = [];
+    }
+
+    __events = undefined;
+    __eventsRaw = undefined;
+
+    /** @type {BattleEvent[]} */
+    get events() {
+        if (this.__eventsRaw !== undefined) {
+            this.__events = this.__decode(BattleLog.__descriptor.fields[0], this.__eventsRaw, this.__events);
+            this.__eventsRaw = undefined;
+        }
+        return this.__events;
+    }
+    set events(value) {
+        this.__rawStale = true;
+        this.__eventsRaw = undefined;
+        this.__events = value;
+    }
+
+    /** 
+     * @param {BattleEvent[]} value 
+     * @return {BattleLog} 
+     */
+    withEvents(value) {
+        this.events = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__eventsRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["events"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__events) != null) {
+            raw = this.__raw.events;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {BattleLog} a deep copy of this message
+     */
+    clone() {
+        return new BattleLog().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {BattleLog} other 
+     * @return {BattleLog} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.events = __cloneArray(other.events, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {BattleLog} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof BattleLog)) return false;
+        if (!__equalsArray(this.events, other.events, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.events, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {BattleLog} 
+     */
+    clear() {
+        this.__eventsRaw = undefined;
+        if (Array.isArray(this.events)) this.events.length = 0; else this.events = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {BattleLog} 
+     */
+    static acquire() {
+        const message = BattleLog.__pool.pop();
+        if (message === undefined) return new BattleLog();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {BattleLog} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('BattleLog instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (BattleLog.__pool.length < 64) {
+            BattleLog.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__events)) {
+            for (const item of this.__events) {
+                if (item instanceof BattleEvent) BattleEvent.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).events = this.events; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.events)) {
+            const list = this.events;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).events = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {BattleLog} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.events) !== undefined) {
+                this.events = value === null ? [] : value.map(item => (item instanceof BattleEvent ? item.clone().commit() : new BattleEvent().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.events) !== undefined) {
+                const list = this.events;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {BattleLog} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.events)) {
+            for (const item of this.events) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            events: this.__eventsRaw ?? this.__events,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, BattleLog.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.events;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("events", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = BattleEvent.validate(item)) !== null) return __prefixError(error, "events", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {BattleLog}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = BattleLog.acquire();
+        try {
+            let value;
+            value = json.events;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("events", "array");
+                const list = new Array(value.length);
+                message.events = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(BattleEvent, item, "events", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            BattleLog.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class BattleLogView {
+        static __layout = {
+            size: 8,
+            hash: 0xa1fd986b,
+            presence: 8,
+            fields: [
+                {name: "events", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return BattleEvent.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, BattleLogView.__layout.hash);
+            return new BattleLogView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get events() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, BattleEvent.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class BattleLogColumns extends __ColumnTable {
+        static Row = class BattleLogRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get events() {
+                return this.__table.columns.events[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                events: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new BattleLogColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.events[i] = row.events;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/battle/comm_battle.proto",
+    dependencies: ["google/protobuf/any.proto", "google/protobuf/duration.proto", "google/protobuf/field_mask.proto", "google/protobuf/struct.proto", "google/protobuf/timestamp.proto", "google/protobuf/wrappers.proto"],
+    data: "CiJwb2tld29ybGQvYmF0dGxlL2NvbW1fYmF0dGxlLnByb3RvEhVwb2tld29ybGQuYmF0dGxlLmNvbW0aGWdvb2dsZS9wcm90b2J1Zi9hbnkucHJvdG8aHmdvb2dsZS9wcm90b2J1Zi9kdXJhdGlvbi5wcm90bxogZ29vZ2xlL3Byb3RvYnVmL2ZpZWxkX21hc2sucHJvdG8aHGdvb2dsZS9wcm90b2J1Zi9zdHJ1Y3QucHJvdG8aH2dvb2dsZS9wcm90b2J1Zi90aW1lc3RhbXAucHJvdG8aHmdvb2dsZS9wcm90b2J1Zi93cmFwcGVycy5wcm90byKoBgoLQmF0dGxlRXZlbnQSGwoJYmF0dGxlX2lkGAEgASgEUghiYXR0bGVJZBI7CgtvY2N1cnJlZF9hdBgCIAEoCzIaLmdvb2dsZS5wcm90b2J1Zi5UaW1lc3RhbXBSCm9jY3VycmVkQXQSMwoHZWxhcHNlZBgDIAEoCzIZLmdvb2dsZS5wcm90b2J1Zi5EdXJhdGlvblIHZWxhcHNlZBIzCgZkYW1hZ2UYBCABKAsyGy5nb29nbGUucHJvdG9idWYuSW50MzJWYWx1ZVIGZGFtYWdlEjkKCW1vdmVfbmFtZRgFIAEoCzIcLmdvb2dsZS5wcm90b2J1Zi5TdHJpbmdWYWx1ZVIIbW92ZU5hbWUSNgoIY3JpdGljYWwYBiABKAsyGi5nb29nbGUucHJvdG9idWYuQm9vbFZhbHVlUghjcml0aWNhbBItCgVleHRyYRgHIAEoCzIXLmdvb2dsZS5wcm90b2J1Zi5TdHJ1Y3RSBWV4dHJhEjAKB3BheWxvYWQYCCABKAsyFi5nb29nbGUucHJvdG9idWYuVmFsdWVSB3BheWxvYWQSLgoEdGFncxgJIAEoCzIaLmdvb2dsZS5wcm90b2J1Zi5MaXN0VmFsdWVSBHRhZ3MSOwoLdXBkYXRlX21hc2sYCiABKAsyGi5nb29nbGUucHJvdG9idWYuRmllbGRNYXNrUgp1cGRhdGVNYXNrEiwKBmRldGFpbBgLIAEoCzIULmdvb2dsZS5wcm90b2J1Zi5BbnlSBmRldGFpbBI8CgtjaGVja3BvaW50cxgMIAMoCzIaLmdvb2dsZS5wcm90b2J1Zi5UaW1lc3RhbXBSC2NoZWNrcG9pbnRzEk8KCWNvb2xkb3ducxgNIAMoCzIxLnBva2V3b3JsZC5iYXR0bGUuY29tbS5CYXR0bGVFdmVudC5Db29sZG93bnNFbnRyeVIJY29vbGRvd25zGlcKDkNvb2xkb3duc0VudHJ5EhAKA2tleRgBIAEoCVIDa2V5Ei8KBXZhbHVlGAIgASgLMhkuZ29vZ2xlLnByb3RvYnVmLkR1cmF0aW9uUgV2YWx1ZToCOAEiRwoJQmF0dGxlTG9nEjoKBmV2ZW50cxgBIAMoCzIiLnBva2V3b3JsZC5iYXR0bGUuY29tbS5CYXR0bGVFdmVudFIGZXZlbnRzYgZwcm90bzM=",
+};
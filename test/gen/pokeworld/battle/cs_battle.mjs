@@ -13,12 +13,20 @@ Object.defineProperty(MessageId, "__descriptor", {
         get clrType() { return MessageId; },
         fullName: "pokeworld.battle.cs.MessageId",
         package: "pokeworld.battle.cs",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "MSG_ID_INVALID", originalName: "MSG_ID_INVALID", number: 0}
-        ]
+        ],
+        valueIndex: [0]
     },
     enumerable: false,
     writable: false,
 });
 Object.freeze(MessageId);
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/battle/cs_battle.proto",
+    dependencies: ["google/protobuf/descriptor.proto", "pokeworld/module/module_id.proto"],
+    data: "CiBwb2tld29ybGQvYmF0dGxlL2NzX2JhdHRsZS5wcm90bxITcG9rZXdvcmxkLmJhdHRsZS5jcxogZ29vZ2xlL3Byb3RvYnVmL2Rlc2NyaXB0b3IucHJvdG8aIHBva2V3b3JsZC9tb2R1bGUvbW9kdWxlX2lkLnByb3RvKicKCU1lc3NhZ2VJZBISCg5NU0dfSURfSU5WQUxJRBAAGgaI0KVM6gc6WQoGbXNnX2lkEh8uZ29vZ2xlLnByb3RvYnVmLk1lc3NhZ2VPcHRpb25zGKL2xQkgASgOMh4ucG9rZXdvcmxkLmJhdHRsZS5jcy5NZXNzYWdlSWRSBW1zZ0lkYgZwcm90bzM=",
+};
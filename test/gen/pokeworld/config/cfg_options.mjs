@@ -3,6 +3,426 @@
 
 // Package: pokeworld.config.cfg
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Message: FieldOptionsTableLoader
 export class FieldOptionsTableLoader {
     static __descriptor = {
@@ -10,14 +430,28 @@ export class FieldOptionsTableLoader {
         get clrType() { return FieldOptionsTableLoader; },
         fullName: "pokeworld.config.cfg.FieldOptionsTableLoader",
         package: "pokeworld.config.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "tableName", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
             {name: "dataFileName", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__tableName = "";
+        this.__dataFileName = "";
+    }
+
+    __tableName = undefined;
+
     /** @type {string} */
-    tableName;
+    get tableName() {
+        return this.__tableName;
+    }
+    set tableName(value) {
+        this.__rawStale = true;
+        this.__tableName = value;
+    }
 
     /** 
      * @param {string} value 
@@ -25,11 +459,21 @@ export class FieldOptionsTableLoader {
      */
     withTableName(value) {
         this.tableName = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __dataFileName = undefined;
+
     /** @type {string} */
-    dataFileName;
+    get dataFileName() {
+        return this.__dataFileName;
+    }
+    set dataFileName(value) {
+        this.__rawStale = true;
+        this.__dataFileName = value;
+    }
 
     /** 
      * @param {string} value 
@@ -37,8 +481,330 @@ export class FieldOptionsTableLoader {
      */
     withDataFileName(value) {
         this.dataFileName = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["tableName", "dataFileName"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {FieldOptionsTableLoader} a deep copy of this message
+     */
+    clone() {
+        return new FieldOptionsTableLoader().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {FieldOptionsTableLoader} other 
+     * @return {FieldOptionsTableLoader} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.tableName = other.tableName;
+        this.dataFileName = other.dataFileName;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {FieldOptionsTableLoader} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof FieldOptionsTableLoader)) return false;
+        if ((this.tableName ?? "") !== (other.tableName ?? "")) return false;
+        if ((this.dataFileName ?? "") !== (other.dataFileName ?? "")) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.tableName ?? "");
+        hash = __hashString(hash, this.dataFileName ?? "");
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {FieldOptionsTableLoader} 
+     */
+    clear() {
+        this.tableName = "";
+        this.dataFileName = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {FieldOptionsTableLoader} 
+     */
+    static acquire() {
+        const message = FieldOptionsTableLoader.__pool.pop();
+        if (message === undefined) return new FieldOptionsTableLoader();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {FieldOptionsTableLoader} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('FieldOptionsTableLoader instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (FieldOptionsTableLoader.__pool.length < 64) {
+            FieldOptionsTableLoader.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).tableName = this.tableName; break;
+                case 2: (full ??= {}).dataFileName = this.dataFileName; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {FieldOptionsTableLoader} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.tableName) !== undefined) {
+                this.tableName = value;
+            }
+            if ((value = full.dataFileName) !== undefined) {
+                this.dataFileName = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {FieldOptionsTableLoader} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            tableName: this.tableName,
+            dataFileName: this.dataFileName,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, FieldOptionsTableLoader.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.tableName;
+        if (value != null && !__isString(value)) return __invalid("tableName", "string");
+        value = json.dataFileName;
+        if (value != null && !__isString(value)) return __invalid("dataFileName", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {FieldOptionsTableLoader}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = FieldOptionsTableLoader.acquire();
+        try {
+            let value;
+            value = json.tableName;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("tableName", "string");
+                message.tableName = value;
+            }
+            value = json.dataFileName;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("dataFileName", "string");
+                message.dataFileName = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            FieldOptionsTableLoader.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class FieldOptionsTableLoaderView {
+        static __layout = {
+            size: 16,
+            hash: 0x46cb1e1c,
+            presence: 16,
+            fields: [
+                {name: "tableName", type: "TYPE_STRING", offset: 0},
+                {name: "dataFileName", type: "TYPE_STRING", offset: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, FieldOptionsTableLoaderView.__layout.hash);
+            return new FieldOptionsTableLoaderView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get tableName() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get dataFileName() {
+            return __flatString(this.__view, this.__offset + 8);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class FieldOptionsTableLoaderColumns extends __ColumnTable {
+        static Row = class FieldOptionsTableLoaderRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get tableName() {
+                const table = this.__table;
+                return table.dictionaries.tableName[table.columns.tableName[this.__index]];
+            }
+
+            get dataFileName() {
+                const table = this.__table;
+                return table.dictionaries.dataFileName[table.columns.dataFileName[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {tableName: [], dataFileName: []};
+            this.columns = {
+                tableName: new Uint32Array(length),
+                dataFileName: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new FieldOptionsTableLoaderColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const tableNameCodes = new Map();
+            const dataFileNameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.tableName[i] = __columnEncode(tableNameCodes, dictionaries.tableName, row.tableName ?? "");
+                columns.dataFileName[i] = __columnEncode(dataFileNameCodes, dictionaries.dataFileName, row.dataFileName ?? "");
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/config/cfg_options.proto",
+    dependencies: ["google/protobuf/descriptor.proto"],
+    data: "CiJwb2tld29ybGQvY29uZmlnL2NmZ19vcHRpb25zLnByb3RvEhRwb2tld29ybGQuY29uZmlnLmNmZxogZ29vZ2xlL3Byb3RvYnVmL2Rlc2NyaXB0b3IucHJvdG8iXgoXRmllbGRPcHRpb25zVGFibGVMb2FkZXISHQoKdGFibGVfbmFtZRgBIAEoCVIJdGFibGVOYW1lEiQKDmRhdGFfZmlsZV9uYW1lGAIgASgJUgxkYXRhRmlsZU5hbWU6cAoMdGFibGVfbG9hZGVyEh0uZ29vZ2xlLnByb3RvYnVmLkZpZWxkT3B0aW9ucxiwVCABKAsyLS5wb2tld29ybGQuY29uZmlnLmNmZy5GaWVsZE9wdGlvbnNUYWJsZUxvYWRlclILdGFibGVMb2FkZXI6NgoGaW50ZXJuEh0uZ29vZ2xlLnByb3RvYnVmLkZpZWxkT3B0aW9ucxixVCABKAhSBmludGVybmIGcHJvdG8z",
+};
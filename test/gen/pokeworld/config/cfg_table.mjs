@@ -3,11 +3,431 @@
 
 // Package: pokeworld.config.cfg
 
-import * as __PokeworldResourceCfg_resource from '../resource/cfg_resource.mjs';
+import * as __PokeworldActorCfg_actor from '../actor/cfg_actor.mjs';
 import * as __PokeworldNetworkCfg_network from '../network/cfg_network.mjs';
 import * as __PokeworldPokemonCfg_pokemon from '../pokemon/cfg_pokemon.mjs';
+import * as __PokeworldResourceCfg_resource from '../resource/cfg_resource.mjs';
 import * as __PokeworldWorldCfg_world from '../world/cfg_world.mjs';
-import * as __PokeworldActorCfg_actor from '../actor/cfg_actor.mjs';
+
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
 
 // Message: Tables
 export class Tables {
@@ -16,20 +436,67 @@ export class Tables {
         get clrType() { return Tables; },
         fullName: "pokeworld.config.cfg.Tables",
         package: "pokeworld.config.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "actorCfgTbplayer", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.TbPlayer", get clrType() { return __PokeworldActorCfg_actor.TbPlayer; },label: "LABEL_OPTIONAL"},
-            {name: "networkCfgTbserver", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.network.cfg.TbServer", get clrType() { return __PokeworldNetworkCfg_network.TbServer; },label: "LABEL_OPTIONAL"},
-            {name: "pokemonCfgTbpokemon", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.TbPokemon", get clrType() { return __PokeworldPokemonCfg_pokemon.TbPokemon; },label: "LABEL_OPTIONAL"},
-            {name: "pokemonCfgTbmove", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.TbMove", get clrType() { return __PokeworldPokemonCfg_pokemon.TbMove; },label: "LABEL_OPTIONAL"},
-            {name: "pokemonCfgTbpoketypeinfo", number: 5, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.TbPokeTypeInfo", get clrType() { return __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo; },label: "LABEL_OPTIONAL"},
-            {name: "worldCfgTbworld", number: 6, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.TbWorld", get clrType() { return __PokeworldWorldCfg_world.TbWorld; },label: "LABEL_OPTIONAL"},
-            {name: "worldCfgTbterrain", number: 7, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.TbTerrain", get clrType() { return __PokeworldWorldCfg_world.TbTerrain; },label: "LABEL_OPTIONAL"},
-            {name: "resourceCfgTbresource", number: 8, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.TbResource", get clrType() { return __PokeworldResourceCfg_resource.TbResource; },label: "LABEL_OPTIONAL"}
+            {name: "actorCfgTbplayer", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.TbPlayer", get clrType() { return __PokeworldActorCfg_actor.TbPlayer; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "networkCfgTbserver", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.network.cfg.TbServer", get clrType() { return __PokeworldNetworkCfg_network.TbServer; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "pokemonCfgTbpokemon", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.TbPokemon", get clrType() { return __PokeworldPokemonCfg_pokemon.TbPokemon; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "pokemonCfgTbmove", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.TbMove", get clrType() { return __PokeworldPokemonCfg_pokemon.TbMove; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "pokemonCfgTbpoketypeinfo", number: 5, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.TbPokeTypeInfo", get clrType() { return __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "worldCfgTbworld", number: 6, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.TbWorld", get clrType() { return __PokeworldWorldCfg_world.TbWorld; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "worldCfgTbterrain", number: 7, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.TbTerrain", get clrType() { return __PokeworldWorldCfg_world.TbTerrain; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "resourceCfgTbresource", number: 8, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.TbResource", get clrType() { return __PokeworldResourceCfg_resource.TbResource; },lazy: true, label: "LABEL_OPTIONAL"}
         ]
     }
 
-    /** @type {__PokeworldActorCfg_actor.TbPlayer} */
-    actorCfgTbplayer;
+    constructor() {
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __actorCfgTbplayer = undefined;
+    __actorCfgTbplayerRaw = undefined;
+
+    /** @type {__PokeworldActorCfg_actor.TbPlayer|undefined} */
+    get actorCfgTbplayer() {
+        if (this.__actorCfgTbplayerRaw !== undefined) {
+            this.__actorCfgTbplayer = this.__decode(Tables.__descriptor.fields[0], this.__actorCfgTbplayerRaw, this.__actorCfgTbplayer);
+            this.__actorCfgTbplayerRaw = undefined;
+        }
+        return this.__actorCfgTbplayer;
+    }
+    set actorCfgTbplayer(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__actorCfgTbplayerRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorCfgTbplayer = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__actorCfgTbplayer = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorCfgTbplayer() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearActorCfgTbplayer() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__actorCfgTbplayer = undefined;
+        this.__actorCfgTbplayerRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldActorCfg_actor.TbPlayer} value 
@@ -40,8 +507,48 @@ export class Tables {
         return this;
     }
 
-    /** @type {__PokeworldNetworkCfg_network.TbServer} */
-    networkCfgTbserver;
+    __networkCfgTbserver = undefined;
+    __networkCfgTbserverRaw = undefined;
+
+    /** @type {__PokeworldNetworkCfg_network.TbServer|undefined} */
+    get networkCfgTbserver() {
+        if (this.__networkCfgTbserverRaw !== undefined) {
+            this.__networkCfgTbserver = this.__decode(Tables.__descriptor.fields[1], this.__networkCfgTbserverRaw, this.__networkCfgTbserver);
+            this.__networkCfgTbserverRaw = undefined;
+        }
+        return this.__networkCfgTbserver;
+    }
+    set networkCfgTbserver(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__networkCfgTbserverRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__networkCfgTbserver = undefined;
+            this.__has0 &= ~2;
+        } else {
+            this.__networkCfgTbserver = value;
+            this.__has0 |= 2;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasNetworkCfgTbserver() {
+        return (this.__has0 & 2) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearNetworkCfgTbserver() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__networkCfgTbserver = undefined;
+        this.__networkCfgTbserverRaw = undefined;
+        this.__has0 &= ~2;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldNetworkCfg_network.TbServer} value 
@@ -52,8 +559,48 @@ export class Tables {
         return this;
     }
 
-    /** @type {__PokeworldPokemonCfg_pokemon.TbPokemon} */
-    pokemonCfgTbpokemon;
+    __pokemonCfgTbpokemon = undefined;
+    __pokemonCfgTbpokemonRaw = undefined;
+
+    /** @type {__PokeworldPokemonCfg_pokemon.TbPokemon|undefined} */
+    get pokemonCfgTbpokemon() {
+        if (this.__pokemonCfgTbpokemonRaw !== undefined) {
+            this.__pokemonCfgTbpokemon = this.__decode(Tables.__descriptor.fields[2], this.__pokemonCfgTbpokemonRaw, this.__pokemonCfgTbpokemon);
+            this.__pokemonCfgTbpokemonRaw = undefined;
+        }
+        return this.__pokemonCfgTbpokemon;
+    }
+    set pokemonCfgTbpokemon(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__pokemonCfgTbpokemonRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__pokemonCfgTbpokemon = undefined;
+            this.__has0 &= ~4;
+        } else {
+            this.__pokemonCfgTbpokemon = value;
+            this.__has0 |= 4;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasPokemonCfgTbpokemon() {
+        return (this.__has0 & 4) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearPokemonCfgTbpokemon() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__pokemonCfgTbpokemon = undefined;
+        this.__pokemonCfgTbpokemonRaw = undefined;
+        this.__has0 &= ~4;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldPokemonCfg_pokemon.TbPokemon} value 
@@ -64,8 +611,48 @@ export class Tables {
         return this;
     }
 
-    /** @type {__PokeworldPokemonCfg_pokemon.TbMove} */
-    pokemonCfgTbmove;
+    __pokemonCfgTbmove = undefined;
+    __pokemonCfgTbmoveRaw = undefined;
+
+    /** @type {__PokeworldPokemonCfg_pokemon.TbMove|undefined} */
+    get pokemonCfgTbmove() {
+        if (this.__pokemonCfgTbmoveRaw !== undefined) {
+            this.__pokemonCfgTbmove = this.__decode(Tables.__descriptor.fields[3], this.__pokemonCfgTbmoveRaw, this.__pokemonCfgTbmove);
+            this.__pokemonCfgTbmoveRaw = undefined;
+        }
+        return this.__pokemonCfgTbmove;
+    }
+    set pokemonCfgTbmove(value) {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__pokemonCfgTbmoveRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__pokemonCfgTbmove = undefined;
+            this.__has0 &= ~8;
+        } else {
+            this.__pokemonCfgTbmove = value;
+            this.__has0 |= 8;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasPokemonCfgTbmove() {
+        return (this.__has0 & 8) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearPokemonCfgTbmove() {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__pokemonCfgTbmove = undefined;
+        this.__pokemonCfgTbmoveRaw = undefined;
+        this.__has0 &= ~8;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldPokemonCfg_pokemon.TbMove} value 
@@ -76,8 +663,48 @@ export class Tables {
         return this;
     }
 
-    /** @type {__PokeworldPokemonCfg_pokemon.TbPokeTypeInfo} */
-    pokemonCfgTbpoketypeinfo;
+    __pokemonCfgTbpoketypeinfo = undefined;
+    __pokemonCfgTbpoketypeinfoRaw = undefined;
+
+    /** @type {__PokeworldPokemonCfg_pokemon.TbPokeTypeInfo|undefined} */
+    get pokemonCfgTbpoketypeinfo() {
+        if (this.__pokemonCfgTbpoketypeinfoRaw !== undefined) {
+            this.__pokemonCfgTbpoketypeinfo = this.__decode(Tables.__descriptor.fields[4], this.__pokemonCfgTbpoketypeinfoRaw, this.__pokemonCfgTbpoketypeinfo);
+            this.__pokemonCfgTbpoketypeinfoRaw = undefined;
+        }
+        return this.__pokemonCfgTbpoketypeinfo;
+    }
+    set pokemonCfgTbpoketypeinfo(value) {
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
+        this.__pokemonCfgTbpoketypeinfoRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__pokemonCfgTbpoketypeinfo = undefined;
+            this.__has0 &= ~16;
+        } else {
+            this.__pokemonCfgTbpoketypeinfo = value;
+            this.__has0 |= 16;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasPokemonCfgTbpoketypeinfo() {
+        return (this.__has0 & 16) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearPokemonCfgTbpoketypeinfo() {
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
+        this.__pokemonCfgTbpoketypeinfo = undefined;
+        this.__pokemonCfgTbpoketypeinfoRaw = undefined;
+        this.__has0 &= ~16;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldPokemonCfg_pokemon.TbPokeTypeInfo} value 
@@ -88,8 +715,48 @@ export class Tables {
         return this;
     }
 
-    /** @type {__PokeworldWorldCfg_world.TbWorld} */
-    worldCfgTbworld;
+    __worldCfgTbworld = undefined;
+    __worldCfgTbworldRaw = undefined;
+
+    /** @type {__PokeworldWorldCfg_world.TbWorld|undefined} */
+    get worldCfgTbworld() {
+        if (this.__worldCfgTbworldRaw !== undefined) {
+            this.__worldCfgTbworld = this.__decode(Tables.__descriptor.fields[5], this.__worldCfgTbworldRaw, this.__worldCfgTbworld);
+            this.__worldCfgTbworldRaw = undefined;
+        }
+        return this.__worldCfgTbworld;
+    }
+    set worldCfgTbworld(value) {
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
+        this.__worldCfgTbworldRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__worldCfgTbworld = undefined;
+            this.__has0 &= ~32;
+        } else {
+            this.__worldCfgTbworld = value;
+            this.__has0 |= 32;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasWorldCfgTbworld() {
+        return (this.__has0 & 32) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearWorldCfgTbworld() {
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
+        this.__worldCfgTbworld = undefined;
+        this.__worldCfgTbworldRaw = undefined;
+        this.__has0 &= ~32;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldWorldCfg_world.TbWorld} value 
@@ -100,8 +767,48 @@ export class Tables {
         return this;
     }
 
-    /** @type {__PokeworldWorldCfg_world.TbTerrain} */
-    worldCfgTbterrain;
+    __worldCfgTbterrain = undefined;
+    __worldCfgTbterrainRaw = undefined;
+
+    /** @type {__PokeworldWorldCfg_world.TbTerrain|undefined} */
+    get worldCfgTbterrain() {
+        if (this.__worldCfgTbterrainRaw !== undefined) {
+            this.__worldCfgTbterrain = this.__decode(Tables.__descriptor.fields[6], this.__worldCfgTbterrainRaw, this.__worldCfgTbterrain);
+            this.__worldCfgTbterrainRaw = undefined;
+        }
+        return this.__worldCfgTbterrain;
+    }
+    set worldCfgTbterrain(value) {
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
+        this.__worldCfgTbterrainRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__worldCfgTbterrain = undefined;
+            this.__has0 &= ~64;
+        } else {
+            this.__worldCfgTbterrain = value;
+            this.__has0 |= 64;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasWorldCfgTbterrain() {
+        return (this.__has0 & 64) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearWorldCfgTbterrain() {
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
+        this.__worldCfgTbterrain = undefined;
+        this.__worldCfgTbterrainRaw = undefined;
+        this.__has0 &= ~64;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldWorldCfg_world.TbTerrain} value 
@@ -112,8 +819,48 @@ export class Tables {
         return this;
     }
 
-    /** @type {__PokeworldResourceCfg_resource.TbResource} */
-    resourceCfgTbresource;
+    __resourceCfgTbresource = undefined;
+    __resourceCfgTbresourceRaw = undefined;
+
+    /** @type {__PokeworldResourceCfg_resource.TbResource|undefined} */
+    get resourceCfgTbresource() {
+        if (this.__resourceCfgTbresourceRaw !== undefined) {
+            this.__resourceCfgTbresource = this.__decode(Tables.__descriptor.fields[7], this.__resourceCfgTbresourceRaw, this.__resourceCfgTbresource);
+            this.__resourceCfgTbresourceRaw = undefined;
+        }
+        return this.__resourceCfgTbresource;
+    }
+    set resourceCfgTbresource(value) {
+        this.__dirty0 |= 128;
+        this.__rawStale = true;
+        this.__resourceCfgTbresourceRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__resourceCfgTbresource = undefined;
+            this.__has0 &= ~128;
+        } else {
+            this.__resourceCfgTbresource = value;
+            this.__has0 |= 128;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasResourceCfgTbresource() {
+        return (this.__has0 & 128) !== 0;
+    }
+
+    /** 
+     * @return {Tables} 
+     */
+    clearResourceCfgTbresource() {
+        this.__dirty0 |= 128;
+        this.__rawStale = true;
+        this.__resourceCfgTbresource = undefined;
+        this.__resourceCfgTbresourceRaw = undefined;
+        this.__has0 &= ~128;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldResourceCfg_resource.TbResource} value 
@@ -124,5 +871,642 @@ export class Tables {
         return this;
     }
 
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dirty0 |= 1;
+                this.__actorCfgTbplayer = undefined;
+                this.__actorCfgTbplayerRaw = raw;
+                this.__has0 |= 1;
+                break;
+            case 2:
+                this.__dirty0 |= 2;
+                this.__networkCfgTbserver = undefined;
+                this.__networkCfgTbserverRaw = raw;
+                this.__has0 |= 2;
+                break;
+            case 3:
+                this.__dirty0 |= 4;
+                this.__pokemonCfgTbpokemon = undefined;
+                this.__pokemonCfgTbpokemonRaw = raw;
+                this.__has0 |= 4;
+                break;
+            case 4:
+                this.__dirty0 |= 8;
+                this.__pokemonCfgTbmove = undefined;
+                this.__pokemonCfgTbmoveRaw = raw;
+                this.__has0 |= 8;
+                break;
+            case 5:
+                this.__dirty0 |= 16;
+                this.__pokemonCfgTbpoketypeinfo = undefined;
+                this.__pokemonCfgTbpoketypeinfoRaw = raw;
+                this.__has0 |= 16;
+                break;
+            case 6:
+                this.__dirty0 |= 32;
+                this.__worldCfgTbworld = undefined;
+                this.__worldCfgTbworldRaw = raw;
+                this.__has0 |= 32;
+                break;
+            case 7:
+                this.__dirty0 |= 64;
+                this.__worldCfgTbterrain = undefined;
+                this.__worldCfgTbterrainRaw = raw;
+                this.__has0 |= 64;
+                break;
+            case 8:
+                this.__dirty0 |= 128;
+                this.__resourceCfgTbresource = undefined;
+                this.__resourceCfgTbresourceRaw = raw;
+                this.__has0 |= 128;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["actorCfgTbplayer", "networkCfgTbserver", "pokemonCfgTbpokemon", "pokemonCfgTbmove", "pokemonCfgTbpoketypeinfo", "worldCfgTbworld", "worldCfgTbterrain", "resourceCfgTbresource"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__actorCfgTbplayer) != null && !value.__isPristine()) return false;
+        if ((value = this.__networkCfgTbserver) != null && !value.__isPristine()) return false;
+        if ((value = this.__pokemonCfgTbpokemon) != null && !value.__isPristine()) return false;
+        if ((value = this.__pokemonCfgTbmove) != null && !value.__isPristine()) return false;
+        if ((value = this.__pokemonCfgTbpoketypeinfo) != null && !value.__isPristine()) return false;
+        if ((value = this.__worldCfgTbworld) != null && !value.__isPristine()) return false;
+        if ((value = this.__worldCfgTbterrain) != null && !value.__isPristine()) return false;
+        if ((value = this.__resourceCfgTbresource) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Tables} a deep copy of this message
+     */
+    clone() {
+        return new Tables().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Tables} other 
+     * @return {Tables} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.actorCfgTbplayer = __cloneMessage(other.actorCfgTbplayer);
+        this.networkCfgTbserver = __cloneMessage(other.networkCfgTbserver);
+        this.pokemonCfgTbpokemon = __cloneMessage(other.pokemonCfgTbpokemon);
+        this.pokemonCfgTbmove = __cloneMessage(other.pokemonCfgTbmove);
+        this.pokemonCfgTbpoketypeinfo = __cloneMessage(other.pokemonCfgTbpoketypeinfo);
+        this.worldCfgTbworld = __cloneMessage(other.worldCfgTbworld);
+        this.worldCfgTbterrain = __cloneMessage(other.worldCfgTbterrain);
+        this.resourceCfgTbresource = __cloneMessage(other.resourceCfgTbresource);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Tables} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Tables)) return false;
+        if (!__equalsMessage(this.actorCfgTbplayer, other.actorCfgTbplayer)) return false;
+        if (!__equalsMessage(this.networkCfgTbserver, other.networkCfgTbserver)) return false;
+        if (!__equalsMessage(this.pokemonCfgTbpokemon, other.pokemonCfgTbpokemon)) return false;
+        if (!__equalsMessage(this.pokemonCfgTbmove, other.pokemonCfgTbmove)) return false;
+        if (!__equalsMessage(this.pokemonCfgTbpoketypeinfo, other.pokemonCfgTbpoketypeinfo)) return false;
+        if (!__equalsMessage(this.worldCfgTbworld, other.worldCfgTbworld)) return false;
+        if (!__equalsMessage(this.worldCfgTbterrain, other.worldCfgTbterrain)) return false;
+        if (!__equalsMessage(this.resourceCfgTbresource, other.resourceCfgTbresource)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashMessage(hash, this.actorCfgTbplayer);
+        hash = __hashMessage(hash, this.networkCfgTbserver);
+        hash = __hashMessage(hash, this.pokemonCfgTbpokemon);
+        hash = __hashMessage(hash, this.pokemonCfgTbmove);
+        hash = __hashMessage(hash, this.pokemonCfgTbpoketypeinfo);
+        hash = __hashMessage(hash, this.worldCfgTbworld);
+        hash = __hashMessage(hash, this.worldCfgTbterrain);
+        hash = __hashMessage(hash, this.resourceCfgTbresource);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Tables} 
+     */
+    clear() {
+        this.__actorCfgTbplayer = undefined;
+        this.__actorCfgTbplayerRaw = undefined;
+        this.__networkCfgTbserver = undefined;
+        this.__networkCfgTbserverRaw = undefined;
+        this.__pokemonCfgTbpokemon = undefined;
+        this.__pokemonCfgTbpokemonRaw = undefined;
+        this.__pokemonCfgTbmove = undefined;
+        this.__pokemonCfgTbmoveRaw = undefined;
+        this.__pokemonCfgTbpoketypeinfo = undefined;
+        this.__pokemonCfgTbpoketypeinfoRaw = undefined;
+        this.__worldCfgTbworld = undefined;
+        this.__worldCfgTbworldRaw = undefined;
+        this.__worldCfgTbterrain = undefined;
+        this.__worldCfgTbterrainRaw = undefined;
+        this.__resourceCfgTbresource = undefined;
+        this.__resourceCfgTbresourceRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Tables} 
+     */
+    static acquire() {
+        const message = Tables.__pool.pop();
+        if (message === undefined) return new Tables();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Tables} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Tables instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Tables.__pool.length < 64) {
+            Tables.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__actorCfgTbplayer) instanceof __PokeworldActorCfg_actor.TbPlayer) __PokeworldActorCfg_actor.TbPlayer.release(value);
+        if ((value = this.__networkCfgTbserver) instanceof __PokeworldNetworkCfg_network.TbServer) __PokeworldNetworkCfg_network.TbServer.release(value);
+        if ((value = this.__pokemonCfgTbpokemon) instanceof __PokeworldPokemonCfg_pokemon.TbPokemon) __PokeworldPokemonCfg_pokemon.TbPokemon.release(value);
+        if ((value = this.__pokemonCfgTbmove) instanceof __PokeworldPokemonCfg_pokemon.TbMove) __PokeworldPokemonCfg_pokemon.TbMove.release(value);
+        if ((value = this.__pokemonCfgTbpoketypeinfo) instanceof __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo) __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo.release(value);
+        if ((value = this.__worldCfgTbworld) instanceof __PokeworldWorldCfg_world.TbWorld) __PokeworldWorldCfg_world.TbWorld.release(value);
+        if ((value = this.__worldCfgTbterrain) instanceof __PokeworldWorldCfg_world.TbTerrain) __PokeworldWorldCfg_world.TbTerrain.release(value);
+        if ((value = this.__resourceCfgTbresource) instanceof __PokeworldResourceCfg_resource.TbResource) __PokeworldResourceCfg_resource.TbResource.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).actorCfgTbplayer = this.actorCfgTbplayer ?? null; break;
+                case 2: (full ??= {}).networkCfgTbserver = this.networkCfgTbserver ?? null; break;
+                case 4: (full ??= {}).pokemonCfgTbpokemon = this.pokemonCfgTbpokemon ?? null; break;
+                case 8: (full ??= {}).pokemonCfgTbmove = this.pokemonCfgTbmove ?? null; break;
+                case 16: (full ??= {}).pokemonCfgTbpoketypeinfo = this.pokemonCfgTbpoketypeinfo ?? null; break;
+                case 32: (full ??= {}).worldCfgTbworld = this.worldCfgTbworld ?? null; break;
+                case 64: (full ??= {}).worldCfgTbterrain = this.worldCfgTbterrain ?? null; break;
+                case 128: (full ??= {}).resourceCfgTbresource = this.resourceCfgTbresource ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.actorCfgTbplayer) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorCfgTbplayer = value;
+        if ((this.__dirty0 & 2) === 0 && (value = this.networkCfgTbserver) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).networkCfgTbserver = value;
+        if ((this.__dirty0 & 4) === 0 && (value = this.pokemonCfgTbpokemon) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).pokemonCfgTbpokemon = value;
+        if ((this.__dirty0 & 8) === 0 && (value = this.pokemonCfgTbmove) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).pokemonCfgTbmove = value;
+        if ((this.__dirty0 & 16) === 0 && (value = this.pokemonCfgTbpoketypeinfo) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).pokemonCfgTbpoketypeinfo = value;
+        if ((this.__dirty0 & 32) === 0 && (value = this.worldCfgTbworld) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).worldCfgTbworld = value;
+        if ((this.__dirty0 & 64) === 0 && (value = this.worldCfgTbterrain) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).worldCfgTbterrain = value;
+        if ((this.__dirty0 & 128) === 0 && (value = this.resourceCfgTbresource) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).resourceCfgTbresource = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Tables} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.actorCfgTbplayer) !== undefined) {
+                this.actorCfgTbplayer = value === null ? undefined : (value instanceof __PokeworldActorCfg_actor.TbPlayer ? value.clone().commit() : new __PokeworldActorCfg_actor.TbPlayer().applyDelta({ f: value }));
+            }
+            if ((value = full.networkCfgTbserver) !== undefined) {
+                this.networkCfgTbserver = value === null ? undefined : (value instanceof __PokeworldNetworkCfg_network.TbServer ? value.clone().commit() : new __PokeworldNetworkCfg_network.TbServer().applyDelta({ f: value }));
+            }
+            if ((value = full.pokemonCfgTbpokemon) !== undefined) {
+                this.pokemonCfgTbpokemon = value === null ? undefined : (value instanceof __PokeworldPokemonCfg_pokemon.TbPokemon ? value.clone().commit() : new __PokeworldPokemonCfg_pokemon.TbPokemon().applyDelta({ f: value }));
+            }
+            if ((value = full.pokemonCfgTbmove) !== undefined) {
+                this.pokemonCfgTbmove = value === null ? undefined : (value instanceof __PokeworldPokemonCfg_pokemon.TbMove ? value.clone().commit() : new __PokeworldPokemonCfg_pokemon.TbMove().applyDelta({ f: value }));
+            }
+            if ((value = full.pokemonCfgTbpoketypeinfo) !== undefined) {
+                this.pokemonCfgTbpoketypeinfo = value === null ? undefined : (value instanceof __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo ? value.clone().commit() : new __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo().applyDelta({ f: value }));
+            }
+            if ((value = full.worldCfgTbworld) !== undefined) {
+                this.worldCfgTbworld = value === null ? undefined : (value instanceof __PokeworldWorldCfg_world.TbWorld ? value.clone().commit() : new __PokeworldWorldCfg_world.TbWorld().applyDelta({ f: value }));
+            }
+            if ((value = full.worldCfgTbterrain) !== undefined) {
+                this.worldCfgTbterrain = value === null ? undefined : (value instanceof __PokeworldWorldCfg_world.TbTerrain ? value.clone().commit() : new __PokeworldWorldCfg_world.TbTerrain().applyDelta({ f: value }));
+            }
+            if ((value = full.resourceCfgTbresource) !== undefined) {
+                this.resourceCfgTbresource = value === null ? undefined : (value instanceof __PokeworldResourceCfg_resource.TbResource ? value.clone().commit() : new __PokeworldResourceCfg_resource.TbResource().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.actorCfgTbplayer) !== undefined) {
+                (this.actorCfgTbplayer ?? (this.actorCfgTbplayer = new __PokeworldActorCfg_actor.TbPlayer())).applyDelta(value);
+            }
+            if ((value = nested.networkCfgTbserver) !== undefined) {
+                (this.networkCfgTbserver ?? (this.networkCfgTbserver = new __PokeworldNetworkCfg_network.TbServer())).applyDelta(value);
+            }
+            if ((value = nested.pokemonCfgTbpokemon) !== undefined) {
+                (this.pokemonCfgTbpokemon ?? (this.pokemonCfgTbpokemon = new __PokeworldPokemonCfg_pokemon.TbPokemon())).applyDelta(value);
+            }
+            if ((value = nested.pokemonCfgTbmove) !== undefined) {
+                (this.pokemonCfgTbmove ?? (this.pokemonCfgTbmove = new __PokeworldPokemonCfg_pokemon.TbMove())).applyDelta(value);
+            }
+            if ((value = nested.pokemonCfgTbpoketypeinfo) !== undefined) {
+                (this.pokemonCfgTbpoketypeinfo ?? (this.pokemonCfgTbpoketypeinfo = new __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo())).applyDelta(value);
+            }
+            if ((value = nested.worldCfgTbworld) !== undefined) {
+                (this.worldCfgTbworld ?? (this.worldCfgTbworld = new __PokeworldWorldCfg_world.TbWorld())).applyDelta(value);
+            }
+            if ((value = nested.worldCfgTbterrain) !== undefined) {
+                (this.worldCfgTbterrain ?? (this.worldCfgTbterrain = new __PokeworldWorldCfg_world.TbTerrain())).applyDelta(value);
+            }
+            if ((value = nested.resourceCfgTbresource) !== undefined) {
+                (this.resourceCfgTbresource ?? (this.resourceCfgTbresource = new __PokeworldResourceCfg_resource.TbResource())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Tables} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.actorCfgTbplayer)) value.commit();
+        if ((value = this.networkCfgTbserver)) value.commit();
+        if ((value = this.pokemonCfgTbpokemon)) value.commit();
+        if ((value = this.pokemonCfgTbmove)) value.commit();
+        if ((value = this.pokemonCfgTbpoketypeinfo)) value.commit();
+        if ((value = this.worldCfgTbworld)) value.commit();
+        if ((value = this.worldCfgTbterrain)) value.commit();
+        if ((value = this.resourceCfgTbresource)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.actorCfgTbplayer = this.__actorCfgTbplayerRaw ?? this.__actorCfgTbplayer; break;
+                case 2: json.networkCfgTbserver = this.__networkCfgTbserverRaw ?? this.__networkCfgTbserver; break;
+                case 4: json.pokemonCfgTbpokemon = this.__pokemonCfgTbpokemonRaw ?? this.__pokemonCfgTbpokemon; break;
+                case 8: json.pokemonCfgTbmove = this.__pokemonCfgTbmoveRaw ?? this.__pokemonCfgTbmove; break;
+                case 16: json.pokemonCfgTbpoketypeinfo = this.__pokemonCfgTbpoketypeinfoRaw ?? this.__pokemonCfgTbpoketypeinfo; break;
+                case 32: json.worldCfgTbworld = this.__worldCfgTbworldRaw ?? this.__worldCfgTbworld; break;
+                case 64: json.worldCfgTbterrain = this.__worldCfgTbterrainRaw ?? this.__worldCfgTbterrain; break;
+                case 128: json.resourceCfgTbresource = this.__resourceCfgTbresourceRaw ?? this.__resourceCfgTbresource; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Tables.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.actorCfgTbplayer;
+        if (value != null && (error = __PokeworldActorCfg_actor.TbPlayer.validate(value)) !== null) return __prefixError(error, "actorCfgTbplayer");
+        value = json.networkCfgTbserver;
+        if (value != null && (error = __PokeworldNetworkCfg_network.TbServer.validate(value)) !== null) return __prefixError(error, "networkCfgTbserver");
+        value = json.pokemonCfgTbpokemon;
+        if (value != null && (error = __PokeworldPokemonCfg_pokemon.TbPokemon.validate(value)) !== null) return __prefixError(error, "pokemonCfgTbpokemon");
+        value = json.pokemonCfgTbmove;
+        if (value != null && (error = __PokeworldPokemonCfg_pokemon.TbMove.validate(value)) !== null) return __prefixError(error, "pokemonCfgTbmove");
+        value = json.pokemonCfgTbpoketypeinfo;
+        if (value != null && (error = __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo.validate(value)) !== null) return __prefixError(error, "pokemonCfgTbpoketypeinfo");
+        value = json.worldCfgTbworld;
+        if (value != null && (error = __PokeworldWorldCfg_world.TbWorld.validate(value)) !== null) return __prefixError(error, "worldCfgTbworld");
+        value = json.worldCfgTbterrain;
+        if (value != null && (error = __PokeworldWorldCfg_world.TbTerrain.validate(value)) !== null) return __prefixError(error, "worldCfgTbterrain");
+        value = json.resourceCfgTbresource;
+        if (value != null && (error = __PokeworldResourceCfg_resource.TbResource.validate(value)) !== null) return __prefixError(error, "resourceCfgTbresource");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Tables}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Tables.acquire();
+        try {
+            let value;
+            value = json.actorCfgTbplayer;
+            if (value != null) {
+                message.actorCfgTbplayer = __decodeNested(__PokeworldActorCfg_actor.TbPlayer, value, "actorCfgTbplayer");
+            }
+            value = json.networkCfgTbserver;
+            if (value != null) {
+                message.networkCfgTbserver = __decodeNested(__PokeworldNetworkCfg_network.TbServer, value, "networkCfgTbserver");
+            }
+            value = json.pokemonCfgTbpokemon;
+            if (value != null) {
+                message.pokemonCfgTbpokemon = __decodeNested(__PokeworldPokemonCfg_pokemon.TbPokemon, value, "pokemonCfgTbpokemon");
+            }
+            value = json.pokemonCfgTbmove;
+            if (value != null) {
+                message.pokemonCfgTbmove = __decodeNested(__PokeworldPokemonCfg_pokemon.TbMove, value, "pokemonCfgTbmove");
+            }
+            value = json.pokemonCfgTbpoketypeinfo;
+            if (value != null) {
+                message.pokemonCfgTbpoketypeinfo = __decodeNested(__PokeworldPokemonCfg_pokemon.TbPokeTypeInfo, value, "pokemonCfgTbpoketypeinfo");
+            }
+            value = json.worldCfgTbworld;
+            if (value != null) {
+                message.worldCfgTbworld = __decodeNested(__PokeworldWorldCfg_world.TbWorld, value, "worldCfgTbworld");
+            }
+            value = json.worldCfgTbterrain;
+            if (value != null) {
+                message.worldCfgTbterrain = __decodeNested(__PokeworldWorldCfg_world.TbTerrain, value, "worldCfgTbterrain");
+            }
+            value = json.resourceCfgTbresource;
+            if (value != null) {
+                message.resourceCfgTbresource = __decodeNested(__PokeworldResourceCfg_resource.TbResource, value, "resourceCfgTbresource");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Tables.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TablesView {
+        static __layout = {
+            size: 32,
+            hash: 0xcb5d4cf7,
+            presence: 0,
+            fields: [
+                {name: "actorCfgTbplayer", type: "TYPE_MESSAGE", offset: 0, get view() { return __PokeworldActorCfg_actor.TbPlayer.View; }},
+                {name: "networkCfgTbserver", type: "TYPE_MESSAGE", offset: 4, get view() { return __PokeworldNetworkCfg_network.TbServer.View; }},
+                {name: "pokemonCfgTbpokemon", type: "TYPE_MESSAGE", offset: 8, get view() { return __PokeworldPokemonCfg_pokemon.TbPokemon.View; }},
+                {name: "pokemonCfgTbmove", type: "TYPE_MESSAGE", offset: 12, get view() { return __PokeworldPokemonCfg_pokemon.TbMove.View; }},
+                {name: "pokemonCfgTbpoketypeinfo", type: "TYPE_MESSAGE", offset: 16, get view() { return __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo.View; }},
+                {name: "worldCfgTbworld", type: "TYPE_MESSAGE", offset: 20, get view() { return __PokeworldWorldCfg_world.TbWorld.View; }},
+                {name: "worldCfgTbterrain", type: "TYPE_MESSAGE", offset: 24, get view() { return __PokeworldWorldCfg_world.TbTerrain.View; }},
+                {name: "resourceCfgTbresource", type: "TYPE_MESSAGE", offset: 28, get view() { return __PokeworldResourceCfg_resource.TbResource.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TablesView.__layout.hash);
+            return new TablesView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get actorCfgTbplayer() {
+            return __flatMessage(this.__view, this.__offset + 0, __PokeworldActorCfg_actor.TbPlayer.View);
+        }
+
+        hasActorCfgTbplayer() {
+            return this.actorCfgTbplayer !== undefined;
+        }
+
+        get networkCfgTbserver() {
+            return __flatMessage(this.__view, this.__offset + 4, __PokeworldNetworkCfg_network.TbServer.View);
+        }
+
+        hasNetworkCfgTbserver() {
+            return this.networkCfgTbserver !== undefined;
+        }
+
+        get pokemonCfgTbpokemon() {
+            return __flatMessage(this.__view, this.__offset + 8, __PokeworldPokemonCfg_pokemon.TbPokemon.View);
+        }
+
+        hasPokemonCfgTbpokemon() {
+            return this.pokemonCfgTbpokemon !== undefined;
+        }
+
+        get pokemonCfgTbmove() {
+            return __flatMessage(this.__view, this.__offset + 12, __PokeworldPokemonCfg_pokemon.TbMove.View);
+        }
+
+        hasPokemonCfgTbmove() {
+            return this.pokemonCfgTbmove !== undefined;
+        }
+
+        get pokemonCfgTbpoketypeinfo() {
+            return __flatMessage(this.__view, this.__offset + 16, __PokeworldPokemonCfg_pokemon.TbPokeTypeInfo.View);
+        }
+
+        hasPokemonCfgTbpoketypeinfo() {
+            return this.pokemonCfgTbpoketypeinfo !== undefined;
+        }
+
+        get worldCfgTbworld() {
+            return __flatMessage(this.__view, this.__offset + 20, __PokeworldWorldCfg_world.TbWorld.View);
+        }
+
+        hasWorldCfgTbworld() {
+            return this.worldCfgTbworld !== undefined;
+        }
+
+        get worldCfgTbterrain() {
+            return __flatMessage(this.__view, this.__offset + 24, __PokeworldWorldCfg_world.TbTerrain.View);
+        }
+
+        hasWorldCfgTbterrain() {
+            return this.worldCfgTbterrain !== undefined;
+        }
+
+        get resourceCfgTbresource() {
+            return __flatMessage(this.__view, this.__offset + 28, __PokeworldResourceCfg_resource.TbResource.View);
+        }
+
+        hasResourceCfgTbresource() {
+            return this.resourceCfgTbresource !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TablesColumns extends __ColumnTable {
+        static Row = class TablesRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get actorCfgTbplayer() {
+                return this.__table.columns.actorCfgTbplayer[this.__index];
+            }
+
+            get networkCfgTbserver() {
+                return this.__table.columns.networkCfgTbserver[this.__index];
+            }
+
+            get pokemonCfgTbpokemon() {
+                return this.__table.columns.pokemonCfgTbpokemon[this.__index];
+            }
+
+            get pokemonCfgTbmove() {
+                return this.__table.columns.pokemonCfgTbmove[this.__index];
+            }
+
+            get pokemonCfgTbpoketypeinfo() {
+                return this.__table.columns.pokemonCfgTbpoketypeinfo[this.__index];
+            }
+
+            get worldCfgTbworld() {
+                return this.__table.columns.worldCfgTbworld[this.__index];
+            }
+
+            get worldCfgTbterrain() {
+                return this.__table.columns.worldCfgTbterrain[this.__index];
+            }
+
+            get resourceCfgTbresource() {
+                return this.__table.columns.resourceCfgTbresource[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                actorCfgTbplayer: new Array(length),
+                networkCfgTbserver: new Array(length),
+                pokemonCfgTbpokemon: new Array(length),
+                pokemonCfgTbmove: new Array(length),
+                pokemonCfgTbpoketypeinfo: new Array(length),
+                worldCfgTbworld: new Array(length),
+                worldCfgTbterrain: new Array(length),
+                resourceCfgTbresource: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TablesColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.actorCfgTbplayer[i] = row.actorCfgTbplayer;
+                columns.networkCfgTbserver[i] = row.networkCfgTbserver;
+                columns.pokemonCfgTbpokemon[i] = row.pokemonCfgTbpokemon;
+                columns.pokemonCfgTbmove[i] = row.pokemonCfgTbmove;
+                columns.pokemonCfgTbpoketypeinfo[i] = row.pokemonCfgTbpoketypeinfo;
+                columns.worldCfgTbworld[i] = row.worldCfgTbworld;
+                columns.worldCfgTbterrain[i] = row.worldCfgTbterrain;
+                columns.resourceCfgTbresource[i] = row.resourceCfgTbresource;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/config/cfg_table.proto",
+    dependencies: ["pokeworld/actor/cfg_actor.proto", "pokeworld/network/cfg_network.proto", "pokeworld/pokemon/cfg_pokemon.proto", "pokeworld/world/cfg_world.proto", "pokeworld/resource/cfg_resource.proto", "pokeworld/config/cfg_options.proto"],
+    data: "CiBwb2tld29ybGQvY29uZmlnL2NmZ190YWJsZS5wcm90bxIUcG9rZXdvcmxkLmNvbmZpZy5jZmcaH3Bva2V3b3JsZC9hY3Rvci9jZmdfYWN0b3IucHJvdG8aI3Bva2V3b3JsZC9uZXR3b3JrL2NmZ19uZXR3b3JrLnByb3RvGiNwb2tld29ybGQvcG9rZW1vbi9jZmdfcG9rZW1vbi5wcm90bxofcG9rZXdvcmxkL3dvcmxkL2NmZ193b3JsZC5wcm90bxolcG9rZXdvcmxkL3Jlc291cmNlL2NmZ19yZXNvdXJjZS5wcm90bxoicG9rZXdvcmxkL2NvbmZpZy9jZmdfb3B0aW9ucy5wcm90byKBCQoGVGFibGVzEoEBChJhY3Rvcl9jZmdfdGJwbGF5ZXIYASABKAsyHS5wb2tld29ybGQuYWN0b3IuY2ZnLlRiUGxheWVyQjSCowUwChpwb2tld29ybGQuYWN0b3IuY2ZnLlBsYXllchISYWN0b3JfY2ZnX3RicGxheWVyUhBhY3RvckNmZ1RicGxheWVyEosBChRuZXR3b3JrX2NmZ190YnNlcnZlchgCIAEoCzIfLnBva2V3b3JsZC5uZXR3b3JrLmNmZy5UYlNlcnZlckI4gqMFNAoccG9rZXdvcmxkLm5ldHdvcmsuY2ZnLlNlcnZlchIUbmV0d29ya19jZmdfdGJzZXJ2ZXJSEm5ldHdvcmtDZmdUYnNlcnZlchKQAQoVcG9rZW1vbl9jZmdfdGJwb2tlbW9uGAMgASgLMiAucG9rZXdvcmxkLnBva2Vtb24uY2ZnLlRiUG9rZW1vbkI6gqMFNgodcG9rZXdvcmxkLnBva2Vtb24uY2ZnLlBva2Vtb24SFXBva2Vtb25fY2ZnX3RicG9rZW1vblITcG9rZW1vbkNmZ1RicG9rZW1vbhKBAQoScG9rZW1vbl9jZmdfdGJtb3ZlGAQgASgLMh0ucG9rZXdvcmxkLnBva2Vtb24uY2ZnLlRiTW92ZUI0gqMFMAoacG9rZXdvcmxkLnBva2Vtb24uY2ZnLk1vdmUSEnBva2Vtb25fY2ZnX3RibW92ZVIQcG9rZW1vbkNmZ1RibW92ZRKpAQoacG9rZW1vbl9jZmdfdGJwb2tldHlwZWluZm8YBSABKAsyJS5wb2tld29ybGQucG9rZW1vbi5jZmcuVGJQb2tlVHlwZUluZm9CRIKjBUAKInBva2V3b3JsZC5wb2tlbW9uLmNmZy5Qb2tlVHlwZUluZm8SGnBva2Vtb25fY2ZnX3RicG9rZXR5cGVpbmZvUhhwb2tlbW9uQ2ZnVGJwb2tldHlwZWluZm8SfAoRd29ybGRfY2ZnX3Rid29ybGQYBiABKAsyHC5wb2tld29ybGQud29ybGQuY2ZnLlRiV29ybGRCMoKjBS4KGXBva2V3b3JsZC53b3JsZC5jZmcuV29ybGQSEXdvcmxkX2NmZ190YndvcmxkUg93b3JsZENmZ1Rid29ybGQShgEKE3dvcmxkX2NmZ190YnRlcnJhaW4YByABKAsyHi5wb2tld29ybGQud29ybGQuY2ZnLlRiVGVycmFpbkI2gqMFMgobcG9rZXdvcmxkLndvcmxkLmNmZy5UZXJyYWluEhN3b3JsZF9jZmdfdGJ0ZXJyYWluUhF3b3JsZENmZ1RidGVycmFpbhKaAQoXcmVzb3VyY2VfY2ZnX3RicmVzb3VyY2UYCCABKAsyIi5wb2tld29ybGQucmVzb3VyY2UuY2ZnLlRiUmVzb3VyY2VCPoKjBToKH3Bva2V3b3JsZC5yZXNvdXJjZS5jZmcuUmVzb3VyY2USF3Jlc291cmNlX2NmZ190YnJlc291cmNlUhVyZXNvdXJjZUNmZ1RicmVzb3VyY2ViBnByb3RvMw==",
+};
@@ -5,6 +5,426 @@
 
 import * as __PokeworldActorCfg_actor from '../actor/cfg_actor.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Message: Entity
 export class Entity {
     static __descriptor = {
@@ -12,14 +432,53 @@ export class Entity {
         get clrType() { return Entity; },
         fullName: "pokeworld.entity.cfg.Entity",
         package: "pokeworld.entity.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "Player", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.Player", get clrType() { return __PokeworldActorCfg_actor.Player; },label: "LABEL_OPTIONAL"}
+            {name: "Player", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.actor.cfg.Player", get clrType() { return __PokeworldActorCfg_actor.Player; },oneof: "value", label: "LABEL_OPTIONAL"}
         ]
     }
 
-    // Oneof field (index: 0)
-    /** @type {__PokeworldActorCfg_actor.Player} */
-    Player;
+    constructor() {
+    }
+
+    // Oneof: value
+    static ValueCase = Object.freeze({
+        NONE: 0,
+        PLAYER: 1,
+    });
+
+    /** @type {number} */
+    valueCase = 0;
+    __value = undefined;
+
+    /** 
+     * @return {Entity} 
+     */
+    clearValue() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__value = undefined;
+        this.valueCase = 0;
+        return this;
+    }
+
+    /** @type {__PokeworldActorCfg_actor.Player|undefined} */
+    get Player() {
+        return this.valueCase === 1 ? this.__value : undefined;
+    }
+    set Player(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            if (this.valueCase === 1) {
+                this.__value = undefined;
+                this.valueCase = 0;
+            }
+            return;
+        }
+        this.__value = value;
+        this.valueCase = 1;
+    }
 
     /** 
      * @param {__PokeworldActorCfg_actor.Player} value 
@@ -30,5 +489,322 @@ export class Entity {
         return this;
     }
 
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["Player"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        switch (this.valueCase) {
+            case 1:
+                if (!this.__value.__isPristine()) return false;
+                break;
+        }
+        return true;
+    }
+
+    /** 
+     * @return {Entity} a deep copy of this message
+     */
+    clone() {
+        return new Entity().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Entity} other 
+     * @return {Entity} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        switch (other.valueCase) {
+            case 1: this.Player = __cloneMessage(other.__value); break;
+            default: this.clearValue(); break;
+        }
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Entity} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Entity)) return false;
+        if (this.valueCase !== other.valueCase) return false;
+        switch (this.valueCase) {
+            case 1: if (!__equalsMessage(this.__value, other.__value)) return false; break;
+        }
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.valueCase);
+        switch (this.valueCase) {
+            case 1: hash = __hashMessage(hash, this.__value); break;
+        }
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Entity} 
+     */
+    clear() {
+        this.__dirty0 = 0;
+        this.valueCase = 0;
+        this.__value = undefined;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Entity} 
+     */
+    static acquire() {
+        const message = Entity.__pool.pop();
+        if (message === undefined) return new Entity();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Entity} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Entity instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Entity.__pool.length < 64) {
+            Entity.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        switch (this.valueCase) {
+            case 1: __PokeworldActorCfg_actor.Player.release(this.__value); break;
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).Player = this.Player ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.Player) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).Player = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Entity} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.Player) !== undefined) {
+                this.Player = value === null ? undefined : (value instanceof __PokeworldActorCfg_actor.Player ? value.clone().commit() : new __PokeworldActorCfg_actor.Player().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.Player) !== undefined) {
+                (this.Player ?? (this.Player = new __PokeworldActorCfg_actor.Player())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Entity} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.Player)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        switch (this.valueCase) {
+            case 1: json.Player = this.__value; break;
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Entity.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.Player;
+        if (value != null && (error = __PokeworldActorCfg_actor.Player.validate(value)) !== null) return __prefixError(error, "Player");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Entity}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Entity.acquire();
+        try {
+            let value;
+            value = json.Player;
+            if (value != null) {
+                message.Player = __decodeNested(__PokeworldActorCfg_actor.Player, value, "Player");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Entity.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EntityView {
+        static __layout = {
+            size: 8,
+            hash: 0xf4c0fc0c,
+            presence: 0,
+            fields: [
+                {name: "Player", type: "TYPE_MESSAGE", offset: 4, oneof: 0, number: 1, get view() { return __PokeworldActorCfg_actor.Player.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EntityView.__layout.hash);
+            return new EntityView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get valueCase() {
+            return __flatUint32(this.__view, this.__offset + 0);
+        }
+
+        get Player() {
+            return __flatUint32(this.__view, this.__offset + 0) === 1 ? __flatMessage(this.__view, this.__offset + 4, __PokeworldActorCfg_actor.Player.View) : undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EntityColumns extends __ColumnTable {
+        static Row = class EntityRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get Player() {
+                return this.__table.columns.Player[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                Player: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EntityColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.Player[i] = row.Player;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/entity/cfg_entity.proto",
+    dependencies: ["pokeworld/actor/cfg_actor.proto"],
+    data: "CiFwb2tld29ybGQvZW50aXR5L2NmZ19lbnRpdHkucHJvdG8SFHBva2V3b3JsZC5lbnRpdHkuY2ZnGh9wb2tld29ybGQvYWN0b3IvY2ZnX2FjdG9yLnByb3RvIkgKBkVudGl0eRI1CgZQbGF5ZXIYASABKAsyGy5wb2tld29ybGQuYWN0b3IuY2ZnLlBsYXllckgAUgZQbGF5ZXJCBwoFdmFsdWViBnByb3RvMw==",
+};
@@ -5,6 +5,463 @@
 
 import * as __PokeworldMathComm_math from '../math/comm_math.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Codecs of the 64-bit integer representation (int64=hybrid)
+function __checkInt64String(value) {
+    if (!/^-?\d+$/.test(value)) {
+        throw new Error(`Invalid 64-bit integer: ${JSON.stringify(value)}`);
+    }
+    return value;
+}
+
+function __decodeInt64(value) {
+    if (typeof value === 'number') {
+        return Number.isSafeInteger(value) ? value : BigInt(value);
+    }
+    if (typeof value === 'string') {
+        if (/^-?\d{1,15}$/.test(value)) return Number(value);
+        __checkInt64String(value);
+    }
+    const big = typeof value === 'bigint' ? value : BigInt(value);
+    return big >= -9007199254740991n && big <= 9007199254740991n ? Number(big) : big;
+}
+
+function __encodeInt64(value) {
+    return typeof value === 'bigint' ? value.toString() : value;
+}
+
+function __hashInt64(hash, value) {
+    return typeof value === 'bigint' ? __hashBigInt(hash, value) : __hashNumber(hash, value);
+}
+
+function __encodeInt64List(list) {
+    return Array.isArray(list) ? list.map(__encodeInt64) : list;
+}
+
+function __hashBigInt(hash, value) {
+    hash = (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value))) | 0;
+    return (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value >> 32n))) | 0;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: Type
 export const Type = {
     PLAYER: 0,
@@ -16,10 +473,12 @@ Object.defineProperty(Type, "__descriptor", {
         get clrType() { return Type; },
         fullName: "pokeworld.entity.comm.Type",
         package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "PLAYER", originalName: "TYPE_PLAYER", number: 0},
             {name: "POKEMON", originalName: "TYPE_POKEMON", number: 1}
-        ]
+        ],
+        valueIndex: [0, 1]
     },
     enumerable: false,
     writable: false,
@@ -39,12 +498,14 @@ Object.defineProperty(Direction, "__descriptor", {
         get clrType() { return Direction; },
         fullName: "pokeworld.entity.comm.Direction",
         package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "UP", originalName: "DIRECTION_UP", number: 0},
             {name: "DOWN", originalName: "DIRECTION_DOWN", number: 1},
             {name: "LEFT", originalName: "DIRECTION_LEFT", number: 2},
             {name: "RIGHT", originalName: "DIRECTION_RIGHT", number: 3}
-        ]
+        ],
+        valueIndex: [0, 1, 2, 3]
     },
     enumerable: false,
     writable: false,
@@ -64,12 +525,14 @@ Object.defineProperty(MotionState, "__descriptor", {
         get clrType() { return MotionState; },
         fullName: "pokeworld.entity.comm.MotionState",
         package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "IDLE", originalName: "MOTION_STATE_IDLE", number: 0},
             {name: "MOVEMENT", originalName: "MOTION_STATE_MOVEMENT", number: 1},
             {name: "JUMP", originalName: "MOTION_STATE_JUMP", number: 2},
             {name: "TELEPORT", originalName: "MOTION_STATE_TELEPORT", number: 3}
-        ]
+        ],
+        valueIndex: [0, 1, 2, 3]
     },
     enumerable: false,
     writable: false,
@@ -83,143 +546,1722 @@ export class EntityInfo {
         get clrType() { return EntityInfo; },
         fullName: "pokeworld.entity.comm.EntityInfo",
         package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "id", number: 1, type: "TYPE_UINT64", label: "LABEL_OPTIONAL"}
+            {name: "id", number: 1, type: "TYPE_UINT64", int64: "hybrid", label: "LABEL_OPTIONAL"}
         ]
     }
 
-    /** @type {number} */
-    id;
+    constructor() {
+        this.__id = 0;
+    }
+
+    __id = undefined;
+
+    /** @type {(number|bigint)} */
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
     /** 
-     * @param {number} value 
+     * @param {(number|bigint)} value 
      * @return {EntityInfo} 
      */
     withId(value) {
         this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
-}
-
-// Message: ActorInfo
-export class ActorInfo {
-    static __descriptor = {
-        name: "ActorInfo",
-        get clrType() { return ActorInfo; },
-        fullName: "pokeworld.entity.comm.ActorInfo",
-        package: "pokeworld.entity.comm",
-        fields: [
-            {name: "cfgId", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
-        ]
-    }
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
 
-    /** @type {number} */
-    cfgId;
+    static __knownKeys = new Set(["id"]);
 
     /** 
-     * @param {number} value 
-     * @return {ActorInfo} 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
      */
-    withCfgId(value) {
-        this.cfgId = value;
-        return this;
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-}
-
-// Message: PlayerInfo
-export class PlayerInfo {
-    static __descriptor = {
-        name: "PlayerInfo",
-        get clrType() { return PlayerInfo; },
-        fullName: "pokeworld.entity.comm.PlayerInfo",
-        package: "pokeworld.entity.comm",
-        fields: [
-            {name: "nickname", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
     }
 
-    /** @type {string} */
-    nickname;
+    /** 
+     * @return {EntityInfo} a deep copy of this message
+     */
+    clone() {
+        return new EntityInfo().copyFrom(this);
+    }
 
     /** 
-     * @param {string} value 
-     * @return {PlayerInfo} 
+     * Deep copy all fields from another message of the same type
+     * @param {EntityInfo} other 
+     * @return {EntityInfo} 
      */
-    withNickname(value) {
-        this.nickname = value;
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
         return this;
     }
 
-}
-
-// Message: NpcInfo
-export class NpcInfo {
-    static __descriptor = {
-        name: "NpcInfo",
-        get clrType() { return NpcInfo; },
-        fullName: "pokeworld.entity.comm.NpcInfo",
-        package: "pokeworld.entity.comm",
-        fields: [
-            {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {EntityInfo} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof EntityInfo)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        return true;
     }
 
-    /** @type {string} */
-    name;
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashInt64(hash, this.id ?? 0);
+        return hash;
+    }
 
     /** 
-     * @param {string} value 
-     * @return {NpcInfo} 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {EntityInfo} 
      */
-    withName(value) {
-        this.name = value;
+    clear() {
+        this.id = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-}
+    static __pool = [];
 
-// Message: EntityTransform
-export class EntityTransform {
-    static __descriptor = {
-        name: "EntityTransform",
-        get clrType() { return EntityTransform; },
-        fullName: "pokeworld.entity.comm.EntityTransform",
-        package: "pokeworld.entity.comm",
-        fields: [
-            {name: "pos", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector2Int", get clrType() { return __PokeworldMathComm_math.Vector2Int; },label: "LABEL_OPTIONAL"}
-        ]
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {EntityInfo} 
+     */
+    static acquire() {
+        const message = EntityInfo.__pool.pop();
+        if (message === undefined) return new EntityInfo();
+        message.__released = false;
+        return message;
     }
 
-    /** @type {__PokeworldMathComm_math.Vector2Int} */
-    pos;
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {EntityInfo} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('EntityInfo instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (EntityInfo.__pool.length < 64) {
+            EntityInfo.__pool.push(message);
+        }
+    }
 
     /** 
-     * @param {__PokeworldMathComm_math.Vector2Int} value 
-     * @return {EntityTransform} 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
      */
-    withPos(value) {
-        this.pos = value;
-        return this;
+    __releaseOwned() {
     }
 
-}
+    // Dirty field bitmask
+    __dirty0 = 0;
 
-// Message: ActorTransform
-export class ActorTransform {
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = __encodeInt64(this.id); break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {EntityInfo} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value === null ? undefined : __decodeInt64(value);
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {EntityInfo} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: __encodeInt64(this.id),
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, EntityInfo.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isUint64(value)) return __invalid("id", "uint64");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {EntityInfo}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = EntityInfo.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isUint64(value)) throw __invalid("id", "uint64");
+                message.id = __decodeInt64(value);
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            EntityInfo.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EntityInfoView {
+        static __layout = {
+            size: 8,
+            hash: 0x412e713f,
+            presence: 8,
+            fields: [
+                {name: "id", type: "TYPE_UINT64", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EntityInfoView.__layout.hash);
+            return new EntityInfoView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatUint64(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EntityInfoColumns extends __ColumnTable {
+        static Row = class EntityInfoRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                id: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EntityInfoColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: ActorInfo
+export class ActorInfo {
+    static __descriptor = {
+        name: "ActorInfo",
+        get clrType() { return ActorInfo; },
+        fullName: "pokeworld.entity.comm.ActorInfo",
+        package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "cfgId", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__cfgId = 0;
+    }
+
+    __cfgId = undefined;
+
+    /** @type {number} */
+    get cfgId() {
+        return this.__cfgId;
+    }
+    set cfgId(value) {
+        this.__rawStale = true;
+        this.__cfgId = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {ActorInfo} 
+     */
+    withCfgId(value) {
+        this.cfgId = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["cfgId"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {ActorInfo} a deep copy of this message
+     */
+    clone() {
+        return new ActorInfo().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {ActorInfo} other 
+     * @return {ActorInfo} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.cfgId = other.cfgId;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {ActorInfo} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof ActorInfo)) return false;
+        if ((this.cfgId ?? 0) !== (other.cfgId ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.cfgId ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {ActorInfo} 
+     */
+    clear() {
+        this.cfgId = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {ActorInfo} 
+     */
+    static acquire() {
+        const message = ActorInfo.__pool.pop();
+        if (message === undefined) return new ActorInfo();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {ActorInfo} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('ActorInfo instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (ActorInfo.__pool.length < 64) {
+            ActorInfo.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).cfgId = this.cfgId; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {ActorInfo} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.cfgId) !== undefined) {
+                this.cfgId = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {ActorInfo} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            cfgId: this.cfgId,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, ActorInfo.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.cfgId;
+        if (value != null && !__isInt32(value)) return __invalid("cfgId", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {ActorInfo}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = ActorInfo.acquire();
+        try {
+            let value;
+            value = json.cfgId;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("cfgId", "int32");
+                message.cfgId = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            ActorInfo.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ActorInfoView {
+        static __layout = {
+            size: 8,
+            hash: 0x1531be3f,
+            presence: 0,
+            fields: [
+                {name: "cfgId", type: "TYPE_INT32", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ActorInfoView.__layout.hash);
+            return new ActorInfoView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get cfgId() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ActorInfoColumns extends __ColumnTable {
+        static Row = class ActorInfoRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get cfgId() {
+                return this.__table.columns.cfgId[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                cfgId: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ActorInfoColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.cfgId[i] = row.cfgId ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: PlayerInfo
+export class PlayerInfo {
+    static __descriptor = {
+        name: "PlayerInfo",
+        get clrType() { return PlayerInfo; },
+        fullName: "pokeworld.entity.comm.PlayerInfo",
+        package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "nickname", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__nickname = "";
+    }
+
+    __nickname = undefined;
+
+    /** @type {string} */
+    get nickname() {
+        return this.__nickname;
+    }
+    set nickname(value) {
+        this.__rawStale = true;
+        this.__nickname = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {PlayerInfo} 
+     */
+    withNickname(value) {
+        this.nickname = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["nickname"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {PlayerInfo} a deep copy of this message
+     */
+    clone() {
+        return new PlayerInfo().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {PlayerInfo} other 
+     * @return {PlayerInfo} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.nickname = other.nickname;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {PlayerInfo} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof PlayerInfo)) return false;
+        if ((this.nickname ?? "") !== (other.nickname ?? "")) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.nickname ?? "");
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {PlayerInfo} 
+     */
+    clear() {
+        this.nickname = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {PlayerInfo} 
+     */
+    static acquire() {
+        const message = PlayerInfo.__pool.pop();
+        if (message === undefined) return new PlayerInfo();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {PlayerInfo} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('PlayerInfo instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (PlayerInfo.__pool.length < 64) {
+            PlayerInfo.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).nickname = this.nickname; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {PlayerInfo} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.nickname) !== undefined) {
+                this.nickname = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {PlayerInfo} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            nickname: this.nickname,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, PlayerInfo.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.nickname;
+        if (value != null && !__isString(value)) return __invalid("nickname", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {PlayerInfo}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = PlayerInfo.acquire();
+        try {
+            let value;
+            value = json.nickname;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("nickname", "string");
+                message.nickname = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            PlayerInfo.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class PlayerInfoView {
+        static __layout = {
+            size: 8,
+            hash: 0x83edf457,
+            presence: 8,
+            fields: [
+                {name: "nickname", type: "TYPE_STRING", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, PlayerInfoView.__layout.hash);
+            return new PlayerInfoView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get nickname() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class PlayerInfoColumns extends __ColumnTable {
+        static Row = class PlayerInfoRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get nickname() {
+                const table = this.__table;
+                return table.dictionaries.nickname[table.columns.nickname[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {nickname: []};
+            this.columns = {
+                nickname: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new PlayerInfoColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nicknameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.nickname[i] = __columnEncode(nicknameCodes, dictionaries.nickname, row.nickname ?? "");
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: NpcInfo
+export class NpcInfo {
+    static __descriptor = {
+        name: "NpcInfo",
+        get clrType() { return NpcInfo; },
+        fullName: "pokeworld.entity.comm.NpcInfo",
+        package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__name = "";
+    }
+
+    __name = undefined;
+
+    /** @type {string} */
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {NpcInfo} 
+     */
+    withName(value) {
+        this.name = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["name"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {NpcInfo} a deep copy of this message
+     */
+    clone() {
+        return new NpcInfo().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {NpcInfo} other 
+     * @return {NpcInfo} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.name = other.name;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {NpcInfo} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof NpcInfo)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.name ?? "");
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {NpcInfo} 
+     */
+    clear() {
+        this.name = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {NpcInfo} 
+     */
+    static acquire() {
+        const message = NpcInfo.__pool.pop();
+        if (message === undefined) return new NpcInfo();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {NpcInfo} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('NpcInfo instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (NpcInfo.__pool.length < 64) {
+            NpcInfo.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).name = this.name; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {NpcInfo} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {NpcInfo} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            name: this.name,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, NpcInfo.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {NpcInfo}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = NpcInfo.acquire();
+        try {
+            let value;
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            NpcInfo.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class NpcInfoView {
+        static __layout = {
+            size: 8,
+            hash: 0x62c4a1ae,
+            presence: 8,
+            fields: [
+                {name: "name", type: "TYPE_STRING", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, NpcInfoView.__layout.hash);
+            return new NpcInfoView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class NpcInfoColumns extends __ColumnTable {
+        static Row = class NpcInfoRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                name: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new NpcInfoColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: EntityTransform
+export class EntityTransform {
+    static __descriptor = {
+        name: "EntityTransform",
+        get clrType() { return EntityTransform; },
+        fullName: "pokeworld.entity.comm.EntityTransform",
+        package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "pos", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector2Int", get clrType() { return __PokeworldMathComm_math.Vector2Int; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __pos = undefined;
+    __posRaw = undefined;
+
+    /** @type {__PokeworldMathComm_math.Vector2Int|undefined} */
+    get pos() {
+        if (this.__posRaw !== undefined) {
+            this.__pos = this.__decode(EntityTransform.__descriptor.fields[0], this.__posRaw, this.__pos);
+            this.__posRaw = undefined;
+        }
+        return this.__pos;
+    }
+    set pos(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__posRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__pos = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__pos = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasPos() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {EntityTransform} 
+     */
+    clearPos() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__pos = undefined;
+        this.__posRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldMathComm_math.Vector2Int} value 
+     * @return {EntityTransform} 
+     */
+    withPos(value) {
+        this.pos = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dirty0 |= 1;
+                this.__pos = undefined;
+                this.__posRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["pos"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__pos) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {EntityTransform} a deep copy of this message
+     */
+    clone() {
+        return new EntityTransform().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {EntityTransform} other 
+     * @return {EntityTransform} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.pos = __cloneMessage(other.pos);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {EntityTransform} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof EntityTransform)) return false;
+        if (!__equalsMessage(this.pos, other.pos)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashMessage(hash, this.pos);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {EntityTransform} 
+     */
+    clear() {
+        this.__pos = undefined;
+        this.__posRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {EntityTransform} 
+     */
+    static acquire() {
+        const message = EntityTransform.__pool.pop();
+        if (message === undefined) return new EntityTransform();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {EntityTransform} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('EntityTransform instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (EntityTransform.__pool.length < 64) {
+            EntityTransform.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__pos) instanceof __PokeworldMathComm_math.Vector2Int) __PokeworldMathComm_math.Vector2Int.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).pos = this.pos ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.pos) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).pos = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {EntityTransform} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.pos) !== undefined) {
+                this.pos = value === null ? undefined : (value instanceof __PokeworldMathComm_math.Vector2Int ? value.clone().commit() : new __PokeworldMathComm_math.Vector2Int().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.pos) !== undefined) {
+                (this.pos ?? (this.pos = new __PokeworldMathComm_math.Vector2Int())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {EntityTransform} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.pos)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.pos = this.__posRaw ?? this.__pos; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, EntityTransform.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.pos;
+        if (value != null && (error = __PokeworldMathComm_math.Vector2Int.validate(value)) !== null) return __prefixError(error, "pos");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {EntityTransform}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = EntityTransform.acquire();
+        try {
+            let value;
+            value = json.pos;
+            if (value != null) {
+                message.pos = __decodeNested(__PokeworldMathComm_math.Vector2Int, value, "pos");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            EntityTransform.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EntityTransformView {
+        static __layout = {
+            size: 8,
+            hash: 0x0d68ad77,
+            presence: 0,
+            fields: [
+                {name: "pos", type: "TYPE_MESSAGE", offset: 0, get view() { return __PokeworldMathComm_math.Vector2Int.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EntityTransformView.__layout.hash);
+            return new EntityTransformView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get pos() {
+            return __flatMessage(this.__view, this.__offset + 0, __PokeworldMathComm_math.Vector2Int.View);
+        }
+
+        hasPos() {
+            return this.pos !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EntityTransformColumns extends __ColumnTable {
+        static Row = class EntityTransformRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get pos() {
+                return this.__table.columns.pos[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                pos: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EntityTransformColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.pos[i] = row.pos;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: ActorTransform
+export class ActorTransform {
     static __descriptor = {
         name: "ActorTransform",
         get clrType() { return ActorTransform; },
         fullName: "pokeworld.entity.comm.ActorTransform",
         package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "direction", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.entity.comm.Direction", get clrType() { return Direction; },label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__direction = Direction.UP;
+    }
+
+    __direction = undefined;
+
     /** @type {Direction[keyof typeof Direction]} */
-    direction;
+    get direction() {
+        return this.__direction;
+    }
+    set direction(value) {
+        this.__rawStale = true;
+        this.__direction = value;
+    }
 
     /** 
      * @param {Direction[keyof typeof Direction]} value 
@@ -227,9 +2269,294 @@ export class ActorTransform {
      */
     withDirection(value) {
         this.direction = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["direction"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {ActorTransform} a deep copy of this message
+     */
+    clone() {
+        return new ActorTransform().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {ActorTransform} other 
+     * @return {ActorTransform} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.direction = other.direction;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {ActorTransform} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof ActorTransform)) return false;
+        if ((this.direction ?? Direction.UP) !== (other.direction ?? Direction.UP)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.direction ?? Direction.UP);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {ActorTransform} 
+     */
+    clear() {
+        this.direction = Direction.UP;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {ActorTransform} 
+     */
+    static acquire() {
+        const message = ActorTransform.__pool.pop();
+        if (message === undefined) return new ActorTransform();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {ActorTransform} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('ActorTransform instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (ActorTransform.__pool.length < 64) {
+            ActorTransform.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).direction = this.direction; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {ActorTransform} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.direction) !== undefined) {
+                this.direction = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {ActorTransform} 
+     */
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            direction: this.direction,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, ActorTransform.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.direction;
+        if (value != null && !__isEnum(Direction, value)) return __invalid("direction", "enum Direction");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {ActorTransform}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = ActorTransform.acquire();
+        try {
+            let value;
+            value = json.direction;
+            if (value != null) {
+                if (!__isEnum(Direction, value)) throw __invalid("direction", "enum Direction");
+                message.direction = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            ActorTransform.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ActorTransformView {
+        static __layout = {
+            size: 8,
+            hash: 0x5f02bdb1,
+            presence: 0,
+            fields: [
+                {name: "direction", type: "TYPE_ENUM", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ActorTransformView.__layout.hash);
+            return new ActorTransformView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get direction() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ActorTransformColumns extends __ColumnTable {
+        static Row = class ActorTransformRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get direction() {
+                return this.__table.columns.direction[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                direction: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ActorTransformColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.direction[i] = row.direction ?? Direction.UP;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: ActorState
@@ -239,13 +2566,26 @@ export class ActorState {
         get clrType() { return ActorState; },
         fullName: "pokeworld.entity.comm.ActorState",
         package: "pokeworld.entity.comm",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "motionState", number: 1, type: "TYPE_ENUM", typeName: ".pokeworld.entity.comm.MotionState", get clrType() { return MotionState; },label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__motionState = MotionState.IDLE;
+    }
+
+    __motionState = undefined;
+
     /** @type {MotionState[keyof typeof MotionState]} */
-    motionState;
+    get motionState() {
+        return this.__motionState;
+    }
+    set motionState(value) {
+        this.__rawStale = true;
+        this.__motionState = value;
+    }
 
     /** 
      * @param {MotionState[keyof typeof MotionState]} value 
@@ -253,8 +2593,299 @@ export class ActorState {
      */
     withMotionState(value) {
         this.motionState = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["motionState"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {ActorState} a deep copy of this message
+     */
+    clone() {
+        return new ActorState().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {ActorState} other 
+     * @return {ActorState} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.motionState = other.motionState;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {ActorState} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof ActorState)) return false;
+        if ((this.motionState ?? MotionState.IDLE) !== (other.motionState ?? MotionState.IDLE)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.motionState ?? MotionState.IDLE);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {ActorState} 
+     */
+    clear() {
+        this.motionState = MotionState.IDLE;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {ActorState} 
+     */
+    static acquire() {
+        const message = ActorState.__pool.pop();
+        if (message === undefined) return new ActorState();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {ActorState} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('ActorState instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (ActorState.__pool.length < 64) {
+            ActorState.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).motionState = this.motionState; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {ActorState} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.motionState) !== undefined) {
+                this.motionState = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {ActorState} 
+     */
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            motionState: this.motionState,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, ActorState.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.motionState;
+        if (value != null && !__isEnum(MotionState, value)) return __invalid("motionState", "enum MotionState");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {ActorState}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = ActorState.acquire();
+        try {
+            let value;
+            value = json.motionState;
+            if (value != null) {
+                if (!__isEnum(MotionState, value)) throw __invalid("motionState", "enum MotionState");
+                message.motionState = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            ActorState.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ActorStateView {
+        static __layout = {
+            size: 8,
+            hash: 0xcdf210d7,
+            presence: 0,
+            fields: [
+                {name: "motionState", type: "TYPE_ENUM", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ActorStateView.__layout.hash);
+            return new ActorStateView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get motionState() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ActorStateColumns extends __ColumnTable {
+        static Row = class ActorStateRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get motionState() {
+                return this.__table.columns.motionState[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                motionState: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ActorStateColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.motionState[i] = row.motionState ?? MotionState.IDLE;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/entity/comm_entity.proto",
+    dependencies: ["pokeworld/math/comm_math.proto", "pokeworld/entity/comm_model.proto"],
+    data: "CiJwb2tld29ybGQvZW50aXR5L2NvbW1fZW50aXR5LnByb3RvEhVwb2tld29ybGQuZW50aXR5LmNvbW0aHnBva2V3b3JsZC9tYXRoL2NvbW1fbWF0aC5wcm90bxohcG9rZXdvcmxkL2VudGl0eS9jb21tX21vZGVsLnByb3RvIhwKCkVudGl0eUluZm8SDgoCaWQYASABKARSAmlkIiIKCUFjdG9ySW5mbxIVCgZjZmdfaWQYASABKAVSBWNmZ0lkIigKClBsYXllckluZm8SGgoIbmlja25hbWUYAiABKAlSCG5pY2tuYW1lIh0KB05wY0luZm8SEgoEbmFtZRgCIAEoCVIEbmFtZSJECg9FbnRpdHlUcmFuc2Zvcm0SMQoDcG9zGAEgASgLMh8ucG9rZXdvcmxkLm1hdGguY29tbS5WZWN0b3IySW50UgNwb3MiUAoOQWN0b3JUcmFuc2Zvcm0SPgoJZGlyZWN0aW9uGAIgASgOMiAucG9rZXdvcmxkLmVudGl0eS5jb21tLkRpcmVjdGlvblIJZGlyZWN0aW9uIlMKCkFjdG9yU3RhdGUSRQoMbW90aW9uX3N0YXRlGAEgASgOMiIucG9rZXdvcmxkLmVudGl0eS5jb21tLk1vdGlvblN0YXRlUgttb3Rpb25TdGF0ZSopCgRUeXBlEg8KC1RZUEVfUExBWUVSEAASEAoMVFlQRV9QT0tFTU9OEAEqWgoJRGlyZWN0aW9uEhAKDERJUkVDVElPTl9VUBAAEhIKDkRJUkVDVElPTl9ET1dOEAESEgoORElSRUNUSU9OX0xFRlQQAhITCg9ESVJFQ1RJT05fUklHSFQQAypxCgtNb3Rpb25TdGF0ZRIVChFNT1RJT05fU1RBVEVfSURMRRAAEhkKFU1PVElPTl9TVEFURV9NT1ZFTUVOVBABEhUKEU1PVElPTl9TVEFURV9KVU1QEAISGQoVTU9USU9OX1NUQVRFX1RFTEVQT1JUEANiBnByb3RvMw==",
+};
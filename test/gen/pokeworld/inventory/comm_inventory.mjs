@@ -3,6 +3,426 @@
 
 // Package: pokeworld.inventory.comm
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: Tab
 export const Tab = {
     NONE: 0,
@@ -15,11 +435,13 @@ Object.defineProperty(Tab, "__descriptor", {
         get clrType() { return Tab; },
         fullName: "pokeworld.inventory.comm.Tab",
         package: "pokeworld.inventory.comm",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "NONE", originalName: "NONE", number: 0},
             {name: "KNAPSACK", originalName: "KNAPSACK", number: 1},
             {name: "QUICK_USE", originalName: "QUICK_USE", number: 2}
-        ]
+        ],
+        valueIndex: [0, 1, 2]
     },
     enumerable: false,
     writable: false,
@@ -33,78 +455,745 @@ export class Slot {
         get clrType() { return Slot; },
         fullName: "pokeworld.inventory.comm.Slot",
         package: "pokeworld.inventory.comm",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "itemId", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
             {name: "itemNum", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
         ]
     }
 
-    /** @type {number} */
-    itemId;
+    constructor() {
+        this.__itemId = 0;
+        this.__itemNum = 0;
+    }
+
+    __itemId = undefined;
+
+    /** @type {number} */
+    get itemId() {
+        return this.__itemId;
+    }
+    set itemId(value) {
+        this.__rawStale = true;
+        this.__itemId = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Slot} 
+     */
+    withItemId(value) {
+        this.itemId = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __itemNum = undefined;
+
+    /** @type {number} */
+    get itemNum() {
+        return this.__itemNum;
+    }
+    set itemNum(value) {
+        this.__rawStale = true;
+        this.__itemNum = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Slot} 
+     */
+    withItemNum(value) {
+        this.itemNum = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["itemId", "itemNum"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Slot} a deep copy of this message
+     */
+    clone() {
+        return new Slot().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Slot} other 
+     * @return {Slot} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.itemId = other.itemId;
+        this.itemNum = other.itemNum;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Slot} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Slot)) return false;
+        if ((this.itemId ?? 0) !== (other.itemId ?? 0)) return false;
+        if ((this.itemNum ?? 0) !== (other.itemNum ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.itemId ?? 0);
+        hash = __hashNumber(hash, this.itemNum ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Slot} 
+     */
+    clear() {
+        this.itemId = 0;
+        this.itemNum = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Slot} 
+     */
+    static acquire() {
+        const message = Slot.__pool.pop();
+        if (message === undefined) return new Slot();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Slot} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Slot instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Slot.__pool.length < 64) {
+            Slot.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).itemId = this.itemId; break;
+                case 2: (full ??= {}).itemNum = this.itemNum; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Slot} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.itemId) !== undefined) {
+                this.itemId = value;
+            }
+            if ((value = full.itemNum) !== undefined) {
+                this.itemNum = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Slot} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            itemId: this.itemId,
+            itemNum: this.itemNum,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Slot.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.itemId;
+        if (value != null && !__isInt32(value)) return __invalid("itemId", "int32");
+        value = json.itemNum;
+        if (value != null && !__isInt32(value)) return __invalid("itemNum", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Slot}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Slot.acquire();
+        try {
+            let value;
+            value = json.itemId;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("itemId", "int32");
+                message.itemId = value;
+            }
+            value = json.itemNum;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("itemNum", "int32");
+                message.itemNum = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Slot.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class SlotView {
+        static __layout = {
+            size: 8,
+            hash: 0xbafaff38,
+            presence: 0,
+            fields: [
+                {name: "itemId", type: "TYPE_INT32", offset: 0},
+                {name: "itemNum", type: "TYPE_INT32", offset: 4}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, SlotView.__layout.hash);
+            return new SlotView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get itemId() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get itemNum() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class SlotColumns extends __ColumnTable {
+        static Row = class SlotRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get itemId() {
+                return this.__table.columns.itemId[this.__index];
+            }
+
+            get itemNum() {
+                return this.__table.columns.itemNum[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                itemId: new Int32Array(length),
+                itemNum: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new SlotColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.itemId[i] = row.itemId ?? 0;
+                columns.itemNum[i] = row.itemNum ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: __Inventory_SlotMapEntry
+class __Inventory_SlotMapEntry {
+    static __descriptor = {
+        name: "SlotMapEntry",
+        get clrType() { return __Inventory_SlotMapEntry; },
+        fullName: "pokeworld.inventory.comm.Inventory.SlotMapEntry",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "key", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "value", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.inventory.comm.Slot", get clrType() { return Slot; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__key = 0;
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __key = undefined;
+
+    /** @type {number} */
+    get key() {
+        return this.__key;
+    }
+    set key(value) {
+        this.__rawStale = true;
+        this.__key = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {__Inventory_SlotMapEntry} 
+     */
+    withKey(value) {
+        this.key = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __value = undefined;
+    __valueRaw = undefined;
+
+    /** @type {Slot|undefined} */
+    get value() {
+        if (this.__valueRaw !== undefined) {
+            this.__value = this.__decode(__Inventory_SlotMapEntry.__descriptor.fields[1], this.__valueRaw, this.__value);
+            this.__valueRaw = undefined;
+        }
+        return this.__value;
+    }
+    set value(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__valueRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__value = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__value = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasValue() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {__Inventory_SlotMapEntry} 
+     */
+    clearValue() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__value = undefined;
+        this.__valueRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {Slot} value 
+     * @return {__Inventory_SlotMapEntry} 
+     */
+    withValue(value) {
+        this.value = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 2:
+                this.__dirty0 |= 2;
+                this.__value = undefined;
+                this.__valueRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["key", "value"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__value) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {__Inventory_SlotMapEntry} a deep copy of this message
+     */
+    clone() {
+        return new __Inventory_SlotMapEntry().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {__Inventory_SlotMapEntry} other 
+     * @return {__Inventory_SlotMapEntry} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.key = other.key;
+        this.value = __cloneMessage(other.value);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {__Inventory_SlotMapEntry} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof __Inventory_SlotMapEntry)) return false;
+        if ((this.key ?? 0) !== (other.key ?? 0)) return false;
+        if (!__equalsMessage(this.value, other.value)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.key ?? 0);
+        hash = __hashMessage(hash, this.value);
+        return hash;
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Slot} 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {__Inventory_SlotMapEntry} 
      */
-    withItemId(value) {
-        this.itemId = value;
+    clear() {
+        this.key = 0;
+        this.__value = undefined;
+        this.__valueRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-    /** @type {number} */
-    itemNum;
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {number} value 
-     * @return {Slot} 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {__Inventory_SlotMapEntry} 
      */
-    withItemNum(value) {
-        this.itemNum = value;
-        return this;
+    static acquire() {
+        const message = __Inventory_SlotMapEntry.__pool.pop();
+        if (message === undefined) return new __Inventory_SlotMapEntry();
+        message.__released = false;
+        return message;
     }
 
-}
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {__Inventory_SlotMapEntry} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('__Inventory_SlotMapEntry instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (__Inventory_SlotMapEntry.__pool.length < 64) {
+            __Inventory_SlotMapEntry.__pool.push(message);
+        }
+    }
 
-class __Inventory_SlotMapEntry {
-    static __descriptor = {
-        name: "SlotMapEntry",
-        get clrType() { return __Inventory_SlotMapEntry; },
-        fullName: "pokeworld.inventory.comm.Inventory.SlotMapEntry",
-        fields: [
-            {name: "key", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "value", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.inventory.comm.Slot", get clrType() { return Slot; },label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__value) instanceof Slot) Slot.release(value);
     }
 
-    constructor() {
-        this.key = 0;
-        this.value = null;
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-    /** @type {number} */
-    key;
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).key = this.key; break;
+                case 2: (full ??= {}).value = this.value ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && (value = this.value) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).value = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
     /** 
-     * @param {number} value 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
      * @return {__Inventory_SlotMapEntry} 
      */
-    withKey(value) {
-        this.key = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.key) !== undefined) {
+                this.key = value;
+            }
+            if ((value = full.value) !== undefined) {
+                this.value = value === null ? undefined : (value instanceof Slot ? value.clone().commit() : new Slot().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.value) !== undefined) {
+                (this.value ?? (this.value = new Slot())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {Slot} */
-    value;
-
     /** 
-     * @param {Slot} value 
+     * Mark the current state as synchronized
      * @return {__Inventory_SlotMapEntry} 
      */
-    withValue(value) {
-        this.value = value;
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.value)) value.commit();
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            key: this.key,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.value = this.__valueRaw ?? this.__value; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, __Inventory_SlotMapEntry.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.key;
+        if (value != null && !__isInt32(value)) return __invalid("key", "int32");
+        value = json.value;
+        if (value != null && (error = Slot.validate(value)) !== null) return __prefixError(error, "value");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {__Inventory_SlotMapEntry}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = __Inventory_SlotMapEntry.acquire();
+        try {
+            let value;
+            value = json.key;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("key", "int32");
+                message.key = value;
+            }
+            value = json.value;
+            if (value != null) {
+                message.value = __decodeNested(Slot, value, "value");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            __Inventory_SlotMapEntry.release(message);
+            throw error;
+        }
+        return message;
+    }
+
 }
 
 // Message: Inventory
@@ -114,6 +1203,7 @@ export class Inventory {
         get clrType() { return Inventory; },
         fullName: "pokeworld.inventory.comm.Inventory",
         package: "pokeworld.inventory.comm",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "tab", number: 1, type: "TYPE_ENUM", typeName: ".pokeworld.inventory.comm.Tab", get clrType() { return Tab; },label: "LABEL_OPTIONAL"},
             {name: "maxSlot", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
@@ -121,8 +1211,22 @@ export class Inventory {
         ]
     }
 
+    constructor() {
+        this.__tab = Tab.NONE;
+        this.__maxSlot = 0;
+        this.__slotMap = [];
+    }
+
+    __tab = undefined;
+
     /** @type {Tab[keyof typeof Tab]} */
-    tab;
+    get tab() {
+        return this.__tab;
+    }
+    set tab(value) {
+        this.__rawStale = true;
+        this.__tab = value;
+    }
 
     /** 
      * @param {Tab[keyof typeof Tab]} value 
@@ -130,11 +1234,21 @@ export class Inventory {
      */
     withTab(value) {
         this.tab = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __maxSlot = undefined;
+
     /** @type {number} */
-    maxSlot;
+    get maxSlot() {
+        return this.__maxSlot;
+    }
+    set maxSlot(value) {
+        this.__rawStale = true;
+        this.__maxSlot = value;
+    }
 
     /** 
      * @param {number} value 
@@ -142,11 +1256,21 @@ export class Inventory {
      */
     withMaxSlot(value) {
         this.maxSlot = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
+    __slotMap = undefined;
+
     /** @type {any} */
-    slotMap;
+    get slotMap() {
+        return this.__slotMap;
+    }
+    set slotMap(value) {
+        this.__rawStale = true;
+        this.__slotMap = value;
+    }
 
     /** 
      * @param {any} value 
@@ -154,9 +1278,381 @@ export class Inventory {
      */
     withSlotMap(value) {
         this.slotMap = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["tab", "maxSlot", "slotMap"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__slotMap) != null) {
+            raw = this.__raw.slotMap;
+            if (raw == null ? Object.keys(value).length !== 0
+                : Array.isArray(value) !== Array.isArray(raw) || Object.keys(value).length !== Object.keys(raw).length) return false;
+            for (const key in value) {
+                if (value[key] != null && !value[key].__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {Inventory} a deep copy of this message
+     */
+    clone() {
+        return new Inventory().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Inventory} other 
+     * @return {Inventory} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.tab = other.tab;
+        this.maxSlot = other.maxSlot;
+        this.slotMap = __cloneMap(other.slotMap, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Inventory} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Inventory)) return false;
+        if ((this.tab ?? Tab.NONE) !== (other.tab ?? Tab.NONE)) return false;
+        if ((this.maxSlot ?? 0) !== (other.maxSlot ?? 0)) return false;
+        if (!__equalsMap(this.slotMap, other.slotMap, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.tab ?? Tab.NONE);
+        hash = __hashNumber(hash, this.maxSlot ?? 0);
+        hash = __hashMap(hash, this.slotMap, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Inventory} 
+     */
+    clear() {
+        this.tab = Tab.NONE;
+        this.maxSlot = 0;
+        if (Array.isArray(this.slotMap)) this.slotMap.length = 0; else this.slotMap = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Inventory} 
+     */
+    static acquire() {
+        const message = Inventory.__pool.pop();
+        if (message === undefined) return new Inventory();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Inventory} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Inventory instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Inventory.__pool.length < 64) {
+            Inventory.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).tab = this.tab; break;
+                case 2: (full ??= {}).maxSlot = this.maxSlot; break;
+                case 4: (full ??= {}).slotMap = this.slotMap; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Inventory} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.tab) !== undefined) {
+                this.tab = value;
+            }
+            if ((value = full.maxSlot) !== undefined) {
+                this.maxSlot = value;
+            }
+            if ((value = full.slotMap) !== undefined) {
+                this.slotMap = value === null ? [] : value.slice();
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Inventory} 
+     */
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            tab: this.tab,
+            maxSlot: this.maxSlot,
+            slotMap: this.slotMap,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Inventory.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.tab;
+        if (value != null && !__isEnum(Tab, value)) return __invalid("tab", "enum Tab");
+        value = json.maxSlot;
+        if (value != null && !__isInt32(value)) return __invalid("maxSlot", "int32");
+        value = json.slotMap;
+        if (value != null) {
+            if (Array.isArray(value)) {
+                for (let i = 0; i < value.length; i++) {
+                    if ((error = __Inventory_SlotMapEntry.validate(value[i])) !== null) return __prefixError(error, "slotMap", i);
+                }
+            } else if (!__isObject(value)) {
+                return __invalid("slotMap", "object or array of entries");
+            } else {
+                for (const key in value) {
+                    if (!__isNumericKey(key, __isInt32)) return __prefixError(__invalid("", "int32 key"), "slotMap", key);
+                    const item = value[key];
+                    if ((error = Slot.validate(item)) !== null) return __prefixError(error, "slotMap", key);
+                }
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Inventory}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Inventory.acquire();
+        try {
+            let value;
+            value = json.tab;
+            if (value != null) {
+                if (!__isEnum(Tab, value)) throw __invalid("tab", "enum Tab");
+                message.tab = value;
+            }
+            value = json.maxSlot;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("maxSlot", "int32");
+                message.maxSlot = value;
+            }
+            value = json.slotMap;
+            if (value != null) {
+                if (Array.isArray(value)) {
+                    message.slotMap = value.map((item, i) => __decodeNested(__Inventory_SlotMapEntry, item, "slotMap", i));
+                } else {
+                    if (!__isObject(value)) throw __invalid("slotMap", "object or array of entries");
+                    const map = {};
+                    for (const key in value) {
+                        if (!__isNumericKey(key, __isInt32)) throw __prefixError(__invalid("", "int32 key"), "slotMap", key);
+                        const item = value[key];
+                        map[key] = __decodeNested(Slot, item, "slotMap", key);
+                    }
+                    message.slotMap = map;
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Inventory.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class InventoryView {
+        static __layout = {
+            size: 16,
+            hash: 0xdae1a52f,
+            presence: 8,
+            fields: [
+                {name: "tab", type: "TYPE_ENUM", offset: 8},
+                {name: "maxSlot", type: "TYPE_INT32", offset: 12},
+                {name: "slotMap", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 8, map: [{name: "key", type: "TYPE_INT32", offset: 0}, {name: "value", type: "TYPE_MESSAGE", offset: 4, get view() { return Slot.View; }}]}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, InventoryView.__layout.hash);
+            return new InventoryView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get tab() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+
+        get maxSlot() {
+            return __flatInt32(this.__view, this.__offset + 12);
+        }
+
+        get slotMap() {
+            return __flatMap(this.__view, this.__offset + 0, 8, __flatInt32, 0, __flatMessage, 4, Slot.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class InventoryColumns extends __ColumnTable {
+        static Row = class InventoryRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get tab() {
+                return this.__table.columns.tab[this.__index];
+            }
+
+            get maxSlot() {
+                return this.__table.columns.maxSlot[this.__index];
+            }
+
+            get slotMap() {
+                return this.__table.columns.slotMap[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                tab: new Int32Array(length),
+                maxSlot: new Int32Array(length),
+                slotMap: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new InventoryColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.tab[i] = row.tab ?? Tab.NONE;
+                columns.maxSlot[i] = row.maxSlot ?? 0;
+                columns.slotMap[i] = row.slotMap;
+            }
+            return table;
+        }
+    };
+
     static SlotMapEntry = __Inventory_SlotMapEntry;
 }
 
@@ -167,13 +1663,32 @@ export class Inventories {
         get clrType() { return Inventories; },
         fullName: "pokeworld.inventory.comm.Inventories",
         package: "pokeworld.inventory.comm",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "list", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.inventory.comm.Inventory", get clrType() { return Inventory; },label: "LABEL_REPEATED"}
+            {name: "list", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.inventory.comm.Inventory", get clrType() { return Inventory; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
+    constructor() {
+        this.list = [];
+    }
+
+    __list = undefined;
+    __listRaw = undefined;
+
     /** @type {Inventory[]} */
-    list;
+    get list() {
+        if (this.__listRaw !== undefined) {
+            this.__list = this.__decode(Inventories.__descriptor.fields[0], this.__listRaw, this.__list);
+            this.__listRaw = undefined;
+        }
+        return this.__list;
+    }
+    set list(value) {
+        this.__rawStale = true;
+        this.__listRaw = undefined;
+        this.__list = value;
+    }
 
     /** 
      * @param {Inventory[]} value 
@@ -181,8 +1696,356 @@ export class Inventories {
      */
     withList(value) {
         this.list = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__listRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["list"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__list) != null) {
+            raw = this.__raw.list;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {Inventories} a deep copy of this message
+     */
+    clone() {
+        return new Inventories().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Inventories} other 
+     * @return {Inventories} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.list = __cloneArray(other.list, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Inventories} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Inventories)) return false;
+        if (!__equalsArray(this.list, other.list, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.list, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Inventories} 
+     */
+    clear() {
+        this.__listRaw = undefined;
+        if (Array.isArray(this.list)) this.list.length = 0; else this.list = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Inventories} 
+     */
+    static acquire() {
+        const message = Inventories.__pool.pop();
+        if (message === undefined) return new Inventories();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Inventories} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Inventories instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Inventories.__pool.length < 64) {
+            Inventories.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__list)) {
+            for (const item of this.__list) {
+                if (item instanceof Inventory) Inventory.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).list = this.list; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.list)) {
+            const list = this.list;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).list = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Inventories} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.list) !== undefined) {
+                this.list = value === null ? [] : value.map(item => (item instanceof Inventory ? item.clone().commit() : new Inventory().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.list) !== undefined) {
+                const list = this.list;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Inventories} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.list)) {
+            for (const item of this.list) item?.commit();
+        }
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            list: this.__listRaw ?? this.__list,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Inventories.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.list;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("list", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Inventory.validate(item)) !== null) return __prefixError(error, "list", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Inventories}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Inventories.acquire();
+        try {
+            let value;
+            value = json.list;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("list", "array");
+                const list = new Array(value.length);
+                message.list = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Inventory, item, "list", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Inventories.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class InventoriesView {
+        static __layout = {
+            size: 8,
+            hash: 0xbacbcdfa,
+            presence: 8,
+            fields: [
+                {name: "list", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Inventory.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, InventoriesView.__layout.hash);
+            return new InventoriesView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get list() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Inventory.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class InventoriesColumns extends __ColumnTable {
+        static Row = class InventoriesRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get list() {
+                return this.__table.columns.list[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                list: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new InventoriesColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.list[i] = row.list;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/inventory/comm_inventory.proto",
+    dependencies: [],
+    data: "Cihwb2tld29ybGQvaW52ZW50b3J5L2NvbW1faW52ZW50b3J5LnByb3RvEhhwb2tld29ybGQuaW52ZW50b3J5LmNvbW0iOgoEU2xvdBIXCgdpdGVtX2lkGAEgASgFUgZpdGVtSWQSGQoIaXRlbV9udW0YAiABKAVSB2l0ZW1OdW0igAIKCUludmVudG9yeRIvCgN0YWIYASABKA4yHS5wb2tld29ybGQuaW52ZW50b3J5LmNvbW0uVGFiUgN0YWISGQoIbWF4X3Nsb3QYAiABKAVSB21heFNsb3QSSwoIc2xvdF9tYXAYAyADKAsyMC5wb2tld29ybGQuaW52ZW50b3J5LmNvbW0uSW52ZW50b3J5LlNsb3RNYXBFbnRyeVIHc2xvdE1hcBpaCgxTbG90TWFwRW50cnkSEAoDa2V5GAEgASgFUgNrZXkSNAoFdmFsdWUYAiABKAsyHi5wb2tld29ybGQuaW52ZW50b3J5LmNvbW0uU2xvdFIFdmFsdWU6AjgBIkYKC0ludmVudG9yaWVzEjcKBGxpc3QYASADKAsyIy5wb2tld29ybGQuaW52ZW50b3J5LmNvbW0uSW52ZW50b3J5UgRsaXN0KiwKA1RhYhIICgROT05FEAASDAoIS05BUFNBQ0sQARINCglRVUlDS19VU0UQAmIGcHJvdG8z",
+};
@@ -5,6 +5,426 @@
 
 import * as __PokeworldInventoryComm_inventory from './comm_inventory.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: MessageId
 export const MessageId = {
     INVALID: 0,
@@ -18,12 +438,14 @@ Object.defineProperty(MessageId, "__descriptor", {
         get clrType() { return MessageId; },
         fullName: "pokeworld.inventory.cs.MessageId",
         package: "pokeworld.inventory.cs",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "INVALID", originalName: "MESSAGE_ID_INVALID", number: 0},
             {name: "PULL_REQUEST", originalName: "MESSAGE_ID_PULL_REQUEST", number: 1},
             {name: "SYNC_NOTIFY", originalName: "MESSAGE_ID_SYNC_NOTIFY", number: 2},
             {name: "SWAP_SLOT_REQUEST", originalName: "MESSAGE_ID_SWAP_SLOT_REQUEST", number: 3}
-        ]
+        ],
+        valueIndex: [0, 1, 2, 3]
     },
     enumerable: false,
     writable: false,
@@ -37,23 +459,323 @@ export class PullRequest {
         get clrType() { return PullRequest; },
         fullName: "pokeworld.inventory.cs.PullRequest",
         package: "pokeworld.inventory.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1004,
+        messageId: 1,
         fields: [
             {name: "tab", number: 1, type: "TYPE_ENUM", typeName: ".pokeworld.inventory.comm.Tab", get clrType() { return __PokeworldInventoryComm_inventory.Tab; },label: "LABEL_OPTIONAL"}
         ]
     }
 
-    /** @type {__PokeworldInventoryComm_inventory.Tab} */
-    tab;
+    constructor() {
+        this.__tab = __PokeworldInventoryComm_inventory.Tab.NONE;
+    }
+
+    __tab = undefined;
+
+    /** @type {__PokeworldInventoryComm_inventory.Tab[keyof typeof __PokeworldInventoryComm_inventory.Tab]} */
+    get tab() {
+        return this.__tab;
+    }
+    set tab(value) {
+        this.__rawStale = true;
+        this.__tab = value;
+    }
 
     /** 
-     * @param {__PokeworldInventoryComm_inventory.Tab} value 
+     * @param {__PokeworldInventoryComm_inventory.Tab[keyof typeof __PokeworldInventoryComm_inventory.Tab]} value 
      * @return {PullRequest} 
      */
     withTab(value) {
         this.tab = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["tab"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {PullRequest} a deep copy of this message
+     */
+    clone() {
+        return new PullRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {PullRequest} other 
+     * @return {PullRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.tab = other.tab;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {PullRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof PullRequest)) return false;
+        if ((this.tab ?? __PokeworldInventoryComm_inventory.Tab.NONE) !== (other.tab ?? __PokeworldInventoryComm_inventory.Tab.NONE)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.tab ?? __PokeworldInventoryComm_inventory.Tab.NONE);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {PullRequest} 
+     */
+    clear() {
+        this.tab = __PokeworldInventoryComm_inventory.Tab.NONE;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {PullRequest} 
+     */
+    static acquire() {
+        const message = PullRequest.__pool.pop();
+        if (message === undefined) return new PullRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {PullRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('PullRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (PullRequest.__pool.length < 64) {
+            PullRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).tab = this.tab; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {PullRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.tab) !== undefined) {
+                this.tab = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
         return this;
     }
 
+    /** 
+     * Mark the current state as synchronized
+     * @return {PullRequest} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            tab: this.tab,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, PullRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.tab;
+        if (value != null && !__isEnum(__PokeworldInventoryComm_inventory.Tab, value)) return __invalid("tab", "enum Tab");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {PullRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = PullRequest.acquire();
+        try {
+            let value;
+            value = json.tab;
+            if (value != null) {
+                if (!__isEnum(__PokeworldInventoryComm_inventory.Tab, value)) throw __invalid("tab", "enum Tab");
+                message.tab = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            PullRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class PullRequestView {
+        static __layout = {
+            size: 8,
+            hash: 0x660629c9,
+            presence: 0,
+            fields: [
+                {name: "tab", type: "TYPE_ENUM", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, PullRequestView.__layout.hash);
+            return new PullRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get tab() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class PullRequestColumns extends __ColumnTable {
+        static Row = class PullRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get tab() {
+                return this.__table.columns.tab[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                tab: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new PullRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.tab[i] = row.tab ?? __PokeworldInventoryComm_inventory.Tab.NONE;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: SyncNotify
@@ -63,13 +785,62 @@ export class SyncNotify {
         get clrType() { return SyncNotify; },
         fullName: "pokeworld.inventory.cs.SyncNotify",
         package: "pokeworld.inventory.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1004,
+        messageId: 2,
         fields: [
-            {name: "inventory", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.inventory.comm.Inventory", get clrType() { return __PokeworldInventoryComm_inventory.Inventory; },label: "LABEL_OPTIONAL"}
+            {name: "inventory", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.inventory.comm.Inventory", get clrType() { return __PokeworldInventoryComm_inventory.Inventory; },lazy: true, label: "LABEL_OPTIONAL"}
         ]
     }
 
-    /** @type {__PokeworldInventoryComm_inventory.Inventory} */
-    inventory;
+    constructor() {
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __inventory = undefined;
+    __inventoryRaw = undefined;
+
+    /** @type {__PokeworldInventoryComm_inventory.Inventory|undefined} */
+    get inventory() {
+        if (this.__inventoryRaw !== undefined) {
+            this.__inventory = this.__decode(SyncNotify.__descriptor.fields[0], this.__inventoryRaw, this.__inventory);
+            this.__inventoryRaw = undefined;
+        }
+        return this.__inventory;
+    }
+    set inventory(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__inventoryRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__inventory = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__inventory = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasInventory() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {SyncNotify} 
+     */
+    clearInventory() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__inventory = undefined;
+        this.__inventoryRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldInventoryComm_inventory.Inventory} value 
@@ -80,6 +851,329 @@ export class SyncNotify {
         return this;
     }
 
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dirty0 |= 1;
+                this.__inventory = undefined;
+                this.__inventoryRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["inventory"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__inventory) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {SyncNotify} a deep copy of this message
+     */
+    clone() {
+        return new SyncNotify().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {SyncNotify} other 
+     * @return {SyncNotify} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.inventory = __cloneMessage(other.inventory);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {SyncNotify} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof SyncNotify)) return false;
+        if (!__equalsMessage(this.inventory, other.inventory)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashMessage(hash, this.inventory);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {SyncNotify} 
+     */
+    clear() {
+        this.__inventory = undefined;
+        this.__inventoryRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {SyncNotify} 
+     */
+    static acquire() {
+        const message = SyncNotify.__pool.pop();
+        if (message === undefined) return new SyncNotify();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {SyncNotify} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('SyncNotify instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (SyncNotify.__pool.length < 64) {
+            SyncNotify.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__inventory) instanceof __PokeworldInventoryComm_inventory.Inventory) __PokeworldInventoryComm_inventory.Inventory.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).inventory = this.inventory ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.inventory) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).inventory = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {SyncNotify} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.inventory) !== undefined) {
+                this.inventory = value === null ? undefined : (value instanceof __PokeworldInventoryComm_inventory.Inventory ? value.clone().commit() : new __PokeworldInventoryComm_inventory.Inventory().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.inventory) !== undefined) {
+                (this.inventory ?? (this.inventory = new __PokeworldInventoryComm_inventory.Inventory())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {SyncNotify} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.inventory)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.inventory = this.__inventoryRaw ?? this.__inventory; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, SyncNotify.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.inventory;
+        if (value != null && (error = __PokeworldInventoryComm_inventory.Inventory.validate(value)) !== null) return __prefixError(error, "inventory");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {SyncNotify}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = SyncNotify.acquire();
+        try {
+            let value;
+            value = json.inventory;
+            if (value != null) {
+                message.inventory = __decodeNested(__PokeworldInventoryComm_inventory.Inventory, value, "inventory");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            SyncNotify.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class SyncNotifyView {
+        static __layout = {
+            size: 8,
+            hash: 0x62d863d0,
+            presence: 0,
+            fields: [
+                {name: "inventory", type: "TYPE_MESSAGE", offset: 0, get view() { return __PokeworldInventoryComm_inventory.Inventory.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, SyncNotifyView.__layout.hash);
+            return new SyncNotifyView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get inventory() {
+            return __flatMessage(this.__view, this.__offset + 0, __PokeworldInventoryComm_inventory.Inventory.View);
+        }
+
+        hasInventory() {
+            return this.inventory !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class SyncNotifyColumns extends __ColumnTable {
+        static Row = class SyncNotifyRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get inventory() {
+                return this.__table.columns.inventory[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                inventory: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new SyncNotifyColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.inventory[i] = row.inventory;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: SwapSlotRequest
@@ -89,14 +1183,30 @@ export class SwapSlotRequest {
         get clrType() { return SwapSlotRequest; },
         fullName: "pokeworld.inventory.cs.SwapSlotRequest",
         package: "pokeworld.inventory.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1004,
+        messageId: 3,
         fields: [
             {name: "srcSlotId", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
             {name: "destSlotId", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__srcSlotId = 0;
+        this.__destSlotId = 0;
+    }
+
+    __srcSlotId = undefined;
+
     /** @type {number} */
-    srcSlotId;
+    get srcSlotId() {
+        return this.__srcSlotId;
+    }
+    set srcSlotId(value) {
+        this.__rawStale = true;
+        this.__srcSlotId = value;
+    }
 
     /** 
      * @param {number} value 
@@ -104,11 +1214,21 @@ export class SwapSlotRequest {
      */
     withSrcSlotId(value) {
         this.srcSlotId = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __destSlotId = undefined;
+
     /** @type {number} */
-    destSlotId;
+    get destSlotId() {
+        return this.__destSlotId;
+    }
+    set destSlotId(value) {
+        this.__rawStale = true;
+        this.__destSlotId = value;
+    }
 
     /** 
      * @param {number} value 
@@ -116,8 +1236,356 @@ export class SwapSlotRequest {
      */
     withDestSlotId(value) {
         this.destSlotId = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["srcSlotId", "destSlotId"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {SwapSlotRequest} a deep copy of this message
+     */
+    clone() {
+        return new SwapSlotRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {SwapSlotRequest} other 
+     * @return {SwapSlotRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.srcSlotId = other.srcSlotId;
+        this.destSlotId = other.destSlotId;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {SwapSlotRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof SwapSlotRequest)) return false;
+        if ((this.srcSlotId ?? 0) !== (other.srcSlotId ?? 0)) return false;
+        if ((this.destSlotId ?? 0) !== (other.destSlotId ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.srcSlotId ?? 0);
+        hash = __hashNumber(hash, this.destSlotId ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {SwapSlotRequest} 
+     */
+    clear() {
+        this.srcSlotId = 0;
+        this.destSlotId = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {SwapSlotRequest} 
+     */
+    static acquire() {
+        const message = SwapSlotRequest.__pool.pop();
+        if (message === undefined) return new SwapSlotRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {SwapSlotRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('SwapSlotRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (SwapSlotRequest.__pool.length < 64) {
+            SwapSlotRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).srcSlotId = this.srcSlotId; break;
+                case 2: (full ??= {}).destSlotId = this.destSlotId; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {SwapSlotRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.srcSlotId) !== undefined) {
+                this.srcSlotId = value;
+            }
+            if ((value = full.destSlotId) !== undefined) {
+                this.destSlotId = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {SwapSlotRequest} 
+     */
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            srcSlotId: this.srcSlotId,
+            destSlotId: this.destSlotId,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, SwapSlotRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.srcSlotId;
+        if (value != null && !__isInt32(value)) return __invalid("srcSlotId", "int32");
+        value = json.destSlotId;
+        if (value != null && !__isInt32(value)) return __invalid("destSlotId", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {SwapSlotRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = SwapSlotRequest.acquire();
+        try {
+            let value;
+            value = json.srcSlotId;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("srcSlotId", "int32");
+                message.srcSlotId = value;
+            }
+            value = json.destSlotId;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("destSlotId", "int32");
+                message.destSlotId = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            SwapSlotRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class SwapSlotRequestView {
+        static __layout = {
+            size: 8,
+            hash: 0xc8db9fdb,
+            presence: 0,
+            fields: [
+                {name: "srcSlotId", type: "TYPE_INT32", offset: 0},
+                {name: "destSlotId", type: "TYPE_INT32", offset: 4}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, SwapSlotRequestView.__layout.hash);
+            return new SwapSlotRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get srcSlotId() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get destSlotId() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class SwapSlotRequestColumns extends __ColumnTable {
+        static Row = class SwapSlotRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get srcSlotId() {
+                return this.__table.columns.srcSlotId[this.__index];
+            }
+
+            get destSlotId() {
+                return this.__table.columns.destSlotId[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                srcSlotId: new Int32Array(length),
+                destSlotId: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new SwapSlotRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.srcSlotId[i] = row.srcSlotId ?? 0;
+                columns.destSlotId[i] = row.destSlotId ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Client stub: request/response pairs of the module's message ids
+export class InventoryClient {
+    static __calls = [
+        {name: "pull", get requestType() { return PullRequest; }},
+        {name: "swapSlot", get requestType() { return SwapSlotRequest; }},
+    ];
+
+    /**
+     * @param {{call: function(Object, Function, Object=): Promise<Object>, send: function(Object): void}} channel
+     *     RpcChannel of proto-rpc.mjs, or any object with the same call/send methods
+     */
+    constructor(channel) {
+        this.channel = channel;
+    }
+
+    /**
+     * @param {PullRequest} request
+     */
+    pull(request) {
+        this.channel.send(request);
+    }
+
+    /**
+     * @param {SwapSlotRequest} request
+     */
+    swapSlot(request) {
+        this.channel.send(request);
+    }
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/inventory/cs_inventory.proto",
+    dependencies: ["google/protobuf/descriptor.proto", "pokeworld/module/module_id.proto", "pokeworld/inventory/comm_inventory.proto"],
+    data: "CiZwb2tld29ybGQvaW52ZW50b3J5L2NzX2ludmVudG9yeS5wcm90bxIWcG9rZXdvcmxkLmludmVudG9yeS5jcxogZ29vZ2xlL3Byb3RvYnVmL2Rlc2NyaXB0b3IucHJvdG8aIHBva2V3b3JsZC9tb2R1bGUvbW9kdWxlX2lkLnByb3RvGihwb2tld29ybGQvaW52ZW50b3J5L2NvbW1faW52ZW50b3J5LnByb3RvIkUKC1B1bGxSZXF1ZXN0Ei8KA3RhYhgBIAEoDjIdLnBva2V3b3JsZC5pbnZlbnRvcnkuY29tbS5UYWJSA3RhYjoFkKO0TAEiVgoKU3luY05vdGlmeRJBCglpbnZlbnRvcnkYASABKAsyIy5wb2tld29ybGQuaW52ZW50b3J5LmNvbW0uSW52ZW50b3J5UglpbnZlbnRvcnk6BZCjtEwCIloKD1N3YXBTbG90UmVxdWVzdBIeCgtzcmNfc2xvdF9pZBgBIAEoBVIJc3JjU2xvdElkEiAKDGRlc3Rfc2xvdF9pZBgCIAEoBVIKZGVzdFNsb3RJZDoFkKO0TAMqhgEKCU1lc3NhZ2VJZBIWChJNRVNTQUdFX0lEX0lOVkFMSUQQABIbChdNRVNTQUdFX0lEX1BVTExfUkVRVUVTVBABEhoKFk1FU1NBR0VfSURfU1lOQ19OT1RJRlkQAhIgChxNRVNTQUdFX0lEX1NXQVBfU0xPVF9SRVFVRVNUEAMaBojQpUzsBzpkCgptZXNzYWdlX2lkEh8uZ29vZ2xlLnByb3RvYnVmLk1lc3NhZ2VPcHRpb25zGLLExgkgASgOMiEucG9rZXdvcmxkLmludmVudG9yeS5jcy5NZXNzYWdlSWRSCW1lc3NhZ2VJZGIGcHJvdG8z",
+};
@@ -3,6 +3,426 @@
 
 // Package: pokeworld.math.comm
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Message: Rect
 export class Rect {
     static __descriptor = {
@@ -10,6 +430,7 @@ export class Rect {
         get clrType() { return Rect; },
         fullName: "pokeworld.math.comm.Rect",
         package: "pokeworld.math.comm",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "x", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
             {name: "y", number: 2, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
@@ -18,300 +439,2977 @@ export class Rect {
         ]
     }
 
-    /** @type {number} */
-    x;
+    constructor() {
+        this.__x = 0;
+        this.__y = 0;
+        this.__width = 0;
+        this.__height = 0;
+    }
+
+    __x = undefined;
+
+    /** @type {number} */
+    get x() {
+        return this.__x;
+    }
+    set x(value) {
+        this.__rawStale = true;
+        this.__x = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Rect} 
+     */
+    withX(value) {
+        this.x = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __y = undefined;
+
+    /** @type {number} */
+    get y() {
+        return this.__y;
+    }
+    set y(value) {
+        this.__rawStale = true;
+        this.__y = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Rect} 
+     */
+    withY(value) {
+        this.y = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __width = undefined;
+
+    /** @type {number} */
+    get width() {
+        return this.__width;
+    }
+    set width(value) {
+        this.__rawStale = true;
+        this.__width = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Rect} 
+     */
+    withWidth(value) {
+        this.width = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __height = undefined;
+
+    /** @type {number} */
+    get height() {
+        return this.__height;
+    }
+    set height(value) {
+        this.__rawStale = true;
+        this.__height = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Rect} 
+     */
+    withHeight(value) {
+        this.height = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["x", "y", "width", "height"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Rect} a deep copy of this message
+     */
+    clone() {
+        return new Rect().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Rect} other 
+     * @return {Rect} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.x = other.x;
+        this.y = other.y;
+        this.width = other.width;
+        this.height = other.height;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Rect} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Rect)) return false;
+        if ((this.x ?? 0) !== (other.x ?? 0)) return false;
+        if ((this.y ?? 0) !== (other.y ?? 0)) return false;
+        if ((this.width ?? 0) !== (other.width ?? 0)) return false;
+        if ((this.height ?? 0) !== (other.height ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.x ?? 0);
+        hash = __hashNumber(hash, this.y ?? 0);
+        hash = __hashNumber(hash, this.width ?? 0);
+        hash = __hashNumber(hash, this.height ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Rect} 
+     */
+    clear() {
+        this.x = 0;
+        this.y = 0;
+        this.width = 0;
+        this.height = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Rect} 
+     */
+    static acquire() {
+        const message = Rect.__pool.pop();
+        if (message === undefined) return new Rect();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Rect} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Rect instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Rect.__pool.length < 64) {
+            Rect.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).x = this.x; break;
+                case 2: (full ??= {}).y = this.y; break;
+                case 4: (full ??= {}).width = this.width; break;
+                case 8: (full ??= {}).height = this.height; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Rect} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.x) !== undefined) {
+                this.x = value;
+            }
+            if ((value = full.y) !== undefined) {
+                this.y = value;
+            }
+            if ((value = full.width) !== undefined) {
+                this.width = value;
+            }
+            if ((value = full.height) !== undefined) {
+                this.height = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Rect} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            x: this.x,
+            y: this.y,
+            width: this.width,
+            height: this.height,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Rect.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.x;
+        if (value != null && !__isFloat(value)) return __invalid("x", "float");
+        value = json.y;
+        if (value != null && !__isFloat(value)) return __invalid("y", "float");
+        value = json.width;
+        if (value != null && !__isFloat(value)) return __invalid("width", "float");
+        value = json.height;
+        if (value != null && !__isFloat(value)) return __invalid("height", "float");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Rect}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Rect.acquire();
+        try {
+            let value;
+            value = json.x;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("x", "float");
+                message.x = value;
+            }
+            value = json.y;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("y", "float");
+                message.y = value;
+            }
+            value = json.width;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("width", "float");
+                message.width = value;
+            }
+            value = json.height;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("height", "float");
+                message.height = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Rect.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class RectView {
+        static __layout = {
+            size: 16,
+            hash: 0x9c26a6ef,
+            presence: 0,
+            fields: [
+                {name: "x", type: "TYPE_FLOAT", offset: 0},
+                {name: "y", type: "TYPE_FLOAT", offset: 4},
+                {name: "width", type: "TYPE_FLOAT", offset: 8},
+                {name: "height", type: "TYPE_FLOAT", offset: 12}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, RectView.__layout.hash);
+            return new RectView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get x() {
+            return __flatFloat(this.__view, this.__offset + 0);
+        }
+
+        get y() {
+            return __flatFloat(this.__view, this.__offset + 4);
+        }
+
+        get width() {
+            return __flatFloat(this.__view, this.__offset + 8);
+        }
+
+        get height() {
+            return __flatFloat(this.__view, this.__offset + 12);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class RectColumns extends __ColumnTable {
+        static Row = class RectRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get x() {
+                return this.__table.columns.x[this.__index];
+            }
+
+            get y() {
+                return this.__table.columns.y[this.__index];
+            }
+
+            get width() {
+                return this.__table.columns.width[this.__index];
+            }
+
+            get height() {
+                return this.__table.columns.height[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                x: new Float32Array(length),
+                y: new Float32Array(length),
+                width: new Float32Array(length),
+                height: new Float32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new RectColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.x[i] = row.x ?? 0;
+                columns.y[i] = row.y ?? 0;
+                columns.width[i] = row.width ?? 0;
+                columns.height[i] = row.height ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: RectInt
+export class RectInt {
+    static __descriptor = {
+        name: "RectInt",
+        get clrType() { return RectInt; },
+        fullName: "pokeworld.math.comm.RectInt",
+        package: "pokeworld.math.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "x", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "y", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "width", number: 3, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "height", number: 4, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__x = 0;
+        this.__y = 0;
+        this.__width = 0;
+        this.__height = 0;
+    }
+
+    __x = undefined;
+
+    /** @type {number} */
+    get x() {
+        return this.__x;
+    }
+    set x(value) {
+        this.__rawStale = true;
+        this.__x = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {RectInt} 
+     */
+    withX(value) {
+        this.x = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __y = undefined;
+
+    /** @type {number} */
+    get y() {
+        return this.__y;
+    }
+    set y(value) {
+        this.__rawStale = true;
+        this.__y = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {RectInt} 
+     */
+    withY(value) {
+        this.y = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __width = undefined;
+
+    /** @type {number} */
+    get width() {
+        return this.__width;
+    }
+    set width(value) {
+        this.__rawStale = true;
+        this.__width = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {RectInt} 
+     */
+    withWidth(value) {
+        this.width = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __height = undefined;
+
+    /** @type {number} */
+    get height() {
+        return this.__height;
+    }
+    set height(value) {
+        this.__rawStale = true;
+        this.__height = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {RectInt} 
+     */
+    withHeight(value) {
+        this.height = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["x", "y", "width", "height"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {RectInt} a deep copy of this message
+     */
+    clone() {
+        return new RectInt().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {RectInt} other 
+     * @return {RectInt} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.x = other.x;
+        this.y = other.y;
+        this.width = other.width;
+        this.height = other.height;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {RectInt} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof RectInt)) return false;
+        if ((this.x ?? 0) !== (other.x ?? 0)) return false;
+        if ((this.y ?? 0) !== (other.y ?? 0)) return false;
+        if ((this.width ?? 0) !== (other.width ?? 0)) return false;
+        if ((this.height ?? 0) !== (other.height ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.x ?? 0);
+        hash = __hashNumber(hash, this.y ?? 0);
+        hash = __hashNumber(hash, this.width ?? 0);
+        hash = __hashNumber(hash, this.height ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {RectInt} 
+     */
+    clear() {
+        this.x = 0;
+        this.y = 0;
+        this.width = 0;
+        this.height = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {RectInt} 
+     */
+    static acquire() {
+        const message = RectInt.__pool.pop();
+        if (message === undefined) return new RectInt();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {RectInt} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('RectInt instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (RectInt.__pool.length < 64) {
+            RectInt.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).x = this.x; break;
+                case 2: (full ??= {}).y = this.y; break;
+                case 4: (full ??= {}).width = this.width; break;
+                case 8: (full ??= {}).height = this.height; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {RectInt} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.x) !== undefined) {
+                this.x = value;
+            }
+            if ((value = full.y) !== undefined) {
+                this.y = value;
+            }
+            if ((value = full.width) !== undefined) {
+                this.width = value;
+            }
+            if ((value = full.height) !== undefined) {
+                this.height = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {RectInt} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            x: this.x,
+            y: this.y,
+            width: this.width,
+            height: this.height,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, RectInt.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.x;
+        if (value != null && !__isInt32(value)) return __invalid("x", "int32");
+        value = json.y;
+        if (value != null && !__isInt32(value)) return __invalid("y", "int32");
+        value = json.width;
+        if (value != null && !__isInt32(value)) return __invalid("width", "int32");
+        value = json.height;
+        if (value != null && !__isInt32(value)) return __invalid("height", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {RectInt}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = RectInt.acquire();
+        try {
+            let value;
+            value = json.x;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("x", "int32");
+                message.x = value;
+            }
+            value = json.y;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("y", "int32");
+                message.y = value;
+            }
+            value = json.width;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("width", "int32");
+                message.width = value;
+            }
+            value = json.height;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("height", "int32");
+                message.height = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            RectInt.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class RectIntView {
+        static __layout = {
+            size: 16,
+            hash: 0x7c530e58,
+            presence: 0,
+            fields: [
+                {name: "x", type: "TYPE_INT32", offset: 0},
+                {name: "y", type: "TYPE_INT32", offset: 4},
+                {name: "width", type: "TYPE_INT32", offset: 8},
+                {name: "height", type: "TYPE_INT32", offset: 12}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, RectIntView.__layout.hash);
+            return new RectIntView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get x() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get y() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+
+        get width() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+
+        get height() {
+            return __flatInt32(this.__view, this.__offset + 12);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class RectIntColumns extends __ColumnTable {
+        static Row = class RectIntRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get x() {
+                return this.__table.columns.x[this.__index];
+            }
+
+            get y() {
+                return this.__table.columns.y[this.__index];
+            }
+
+            get width() {
+                return this.__table.columns.width[this.__index];
+            }
+
+            get height() {
+                return this.__table.columns.height[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                x: new Int32Array(length),
+                y: new Int32Array(length),
+                width: new Int32Array(length),
+                height: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new RectIntColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.x[i] = row.x ?? 0;
+                columns.y[i] = row.y ?? 0;
+                columns.width[i] = row.width ?? 0;
+                columns.height[i] = row.height ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: Vector2
+export class Vector2 {
+    static __descriptor = {
+        name: "Vector2",
+        get clrType() { return Vector2; },
+        fullName: "pokeworld.math.comm.Vector2",
+        package: "pokeworld.math.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "x", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
+            {name: "y", number: 2, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__x = 0;
+        this.__y = 0;
+    }
+
+    __x = undefined;
+
+    /** @type {number} */
+    get x() {
+        return this.__x;
+    }
+    set x(value) {
+        this.__rawStale = true;
+        this.__x = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector2} 
+     */
+    withX(value) {
+        this.x = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __y = undefined;
+
+    /** @type {number} */
+    get y() {
+        return this.__y;
+    }
+    set y(value) {
+        this.__rawStale = true;
+        this.__y = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector2} 
+     */
+    withY(value) {
+        this.y = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["x", "y"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Vector2} a deep copy of this message
+     */
+    clone() {
+        return new Vector2().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Vector2} other 
+     * @return {Vector2} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.x = other.x;
+        this.y = other.y;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Vector2} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Vector2)) return false;
+        if ((this.x ?? 0) !== (other.x ?? 0)) return false;
+        if ((this.y ?? 0) !== (other.y ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.x ?? 0);
+        hash = __hashNumber(hash, this.y ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Vector2} 
+     */
+    clear() {
+        this.x = 0;
+        this.y = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Vector2} 
+     */
+    static acquire() {
+        const message = Vector2.__pool.pop();
+        if (message === undefined) return new Vector2();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Vector2} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Vector2 instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Vector2.__pool.length < 64) {
+            Vector2.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).x = this.x; break;
+                case 2: (full ??= {}).y = this.y; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Vector2} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.x) !== undefined) {
+                this.x = value;
+            }
+            if ((value = full.y) !== undefined) {
+                this.y = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Vector2} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            x: this.x,
+            y: this.y,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Vector2.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.x;
+        if (value != null && !__isFloat(value)) return __invalid("x", "float");
+        value = json.y;
+        if (value != null && !__isFloat(value)) return __invalid("y", "float");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Vector2}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Vector2.acquire();
+        try {
+            let value;
+            value = json.x;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("x", "float");
+                message.x = value;
+            }
+            value = json.y;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("y", "float");
+                message.y = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Vector2.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class Vector2View {
+        static __layout = {
+            size: 8,
+            hash: 0x94850c6f,
+            presence: 0,
+            fields: [
+                {name: "x", type: "TYPE_FLOAT", offset: 0},
+                {name: "y", type: "TYPE_FLOAT", offset: 4}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, Vector2View.__layout.hash);
+            return new Vector2View(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get x() {
+            return __flatFloat(this.__view, this.__offset + 0);
+        }
+
+        get y() {
+            return __flatFloat(this.__view, this.__offset + 4);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class Vector2Columns extends __ColumnTable {
+        static Row = class Vector2Row {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get x() {
+                return this.__table.columns.x[this.__index];
+            }
+
+            get y() {
+                return this.__table.columns.y[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                x: new Float32Array(length),
+                y: new Float32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new Vector2Columns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.x[i] = row.x ?? 0;
+                columns.y[i] = row.y ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: Vector2Int
+export class Vector2Int {
+    static __descriptor = {
+        name: "Vector2Int",
+        get clrType() { return Vector2Int; },
+        fullName: "pokeworld.math.comm.Vector2Int",
+        package: "pokeworld.math.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "x", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "y", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__x = 0;
+        this.__y = 0;
+    }
+
+    __x = undefined;
+
+    /** @type {number} */
+    get x() {
+        return this.__x;
+    }
+    set x(value) {
+        this.__rawStale = true;
+        this.__x = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector2Int} 
+     */
+    withX(value) {
+        this.x = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __y = undefined;
+
+    /** @type {number} */
+    get y() {
+        return this.__y;
+    }
+    set y(value) {
+        this.__rawStale = true;
+        this.__y = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector2Int} 
+     */
+    withY(value) {
+        this.y = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["x", "y"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Vector2Int} a deep copy of this message
+     */
+    clone() {
+        return new Vector2Int().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Vector2Int} other 
+     * @return {Vector2Int} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.x = other.x;
+        this.y = other.y;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Vector2Int} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Vector2Int)) return false;
+        if ((this.x ?? 0) !== (other.x ?? 0)) return false;
+        if ((this.y ?? 0) !== (other.y ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.x ?? 0);
+        hash = __hashNumber(hash, this.y ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Vector2Int} 
+     */
+    clear() {
+        this.x = 0;
+        this.y = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Vector2Int} 
+     */
+    static acquire() {
+        const message = Vector2Int.__pool.pop();
+        if (message === undefined) return new Vector2Int();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Vector2Int} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Vector2Int instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Vector2Int.__pool.length < 64) {
+            Vector2Int.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).x = this.x; break;
+                case 2: (full ??= {}).y = this.y; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Vector2Int} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.x) !== undefined) {
+                this.x = value;
+            }
+            if ((value = full.y) !== undefined) {
+                this.y = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Vector2Int} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            x: this.x,
+            y: this.y,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Vector2Int.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.x;
+        if (value != null && !__isInt32(value)) return __invalid("x", "int32");
+        value = json.y;
+        if (value != null && !__isInt32(value)) return __invalid("y", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Vector2Int}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Vector2Int.acquire();
+        try {
+            let value;
+            value = json.x;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("x", "int32");
+                message.x = value;
+            }
+            value = json.y;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("y", "int32");
+                message.y = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Vector2Int.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class Vector2IntView {
+        static __layout = {
+            size: 8,
+            hash: 0x91e7e2d4,
+            presence: 0,
+            fields: [
+                {name: "x", type: "TYPE_INT32", offset: 0},
+                {name: "y", type: "TYPE_INT32", offset: 4}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, Vector2IntView.__layout.hash);
+            return new Vector2IntView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get x() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get y() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class Vector2IntColumns extends __ColumnTable {
+        static Row = class Vector2IntRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get x() {
+                return this.__table.columns.x[this.__index];
+            }
+
+            get y() {
+                return this.__table.columns.y[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                x: new Int32Array(length),
+                y: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new Vector2IntColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.x[i] = row.x ?? 0;
+                columns.y[i] = row.y ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: Vector3
+export class Vector3 {
+    static __descriptor = {
+        name: "Vector3",
+        get clrType() { return Vector3; },
+        fullName: "pokeworld.math.comm.Vector3",
+        package: "pokeworld.math.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "x", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
+            {name: "y", number: 2, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
+            {name: "z", number: 3, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__x = 0;
+        this.__y = 0;
+        this.__z = 0;
+    }
+
+    __x = undefined;
+
+    /** @type {number} */
+    get x() {
+        return this.__x;
+    }
+    set x(value) {
+        this.__rawStale = true;
+        this.__x = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector3} 
+     */
+    withX(value) {
+        this.x = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __y = undefined;
+
+    /** @type {number} */
+    get y() {
+        return this.__y;
+    }
+    set y(value) {
+        this.__rawStale = true;
+        this.__y = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector3} 
+     */
+    withY(value) {
+        this.y = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __z = undefined;
+
+    /** @type {number} */
+    get z() {
+        return this.__z;
+    }
+    set z(value) {
+        this.__rawStale = true;
+        this.__z = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector3} 
+     */
+    withZ(value) {
+        this.z = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["x", "y", "z"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Vector3} a deep copy of this message
+     */
+    clone() {
+        return new Vector3().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Vector3} other 
+     * @return {Vector3} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.x = other.x;
+        this.y = other.y;
+        this.z = other.z;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Vector3} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Vector3)) return false;
+        if ((this.x ?? 0) !== (other.x ?? 0)) return false;
+        if ((this.y ?? 0) !== (other.y ?? 0)) return false;
+        if ((this.z ?? 0) !== (other.z ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.x ?? 0);
+        hash = __hashNumber(hash, this.y ?? 0);
+        hash = __hashNumber(hash, this.z ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Vector3} 
+     */
+    clear() {
+        this.x = 0;
+        this.y = 0;
+        this.z = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Vector3} 
+     */
+    static acquire() {
+        const message = Vector3.__pool.pop();
+        if (message === undefined) return new Vector3();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Vector3} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Vector3 instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Vector3.__pool.length < 64) {
+            Vector3.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).x = this.x; break;
+                case 2: (full ??= {}).y = this.y; break;
+                case 4: (full ??= {}).z = this.z; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Vector3} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.x) !== undefined) {
+                this.x = value;
+            }
+            if ((value = full.y) !== undefined) {
+                this.y = value;
+            }
+            if ((value = full.z) !== undefined) {
+                this.z = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Vector3} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            x: this.x,
+            y: this.y,
+            z: this.z,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Vector3.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.x;
+        if (value != null && !__isFloat(value)) return __invalid("x", "float");
+        value = json.y;
+        if (value != null && !__isFloat(value)) return __invalid("y", "float");
+        value = json.z;
+        if (value != null && !__isFloat(value)) return __invalid("z", "float");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Vector3}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Vector3.acquire();
+        try {
+            let value;
+            value = json.x;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("x", "float");
+                message.x = value;
+            }
+            value = json.y;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("y", "float");
+                message.y = value;
+            }
+            value = json.z;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("z", "float");
+                message.z = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Vector3.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class Vector3View {
+        static __layout = {
+            size: 16,
+            hash: 0xe4214cd5,
+            presence: 0,
+            fields: [
+                {name: "x", type: "TYPE_FLOAT", offset: 0},
+                {name: "y", type: "TYPE_FLOAT", offset: 4},
+                {name: "z", type: "TYPE_FLOAT", offset: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, Vector3View.__layout.hash);
+            return new Vector3View(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get x() {
+            return __flatFloat(this.__view, this.__offset + 0);
+        }
+
+        get y() {
+            return __flatFloat(this.__view, this.__offset + 4);
+        }
+
+        get z() {
+            return __flatFloat(this.__view, this.__offset + 8);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class Vector3Columns extends __ColumnTable {
+        static Row = class Vector3Row {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get x() {
+                return this.__table.columns.x[this.__index];
+            }
+
+            get y() {
+                return this.__table.columns.y[this.__index];
+            }
+
+            get z() {
+                return this.__table.columns.z[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                x: new Float32Array(length),
+                y: new Float32Array(length),
+                z: new Float32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new Vector3Columns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.x[i] = row.x ?? 0;
+                columns.y[i] = row.y ?? 0;
+                columns.z[i] = row.z ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: Vector3Int
+export class Vector3Int {
+    static __descriptor = {
+        name: "Vector3Int",
+        get clrType() { return Vector3Int; },
+        fullName: "pokeworld.math.comm.Vector3Int",
+        package: "pokeworld.math.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "x", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "y", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "z", number: 3, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__x = 0;
+        this.__y = 0;
+        this.__z = 0;
+    }
+
+    __x = undefined;
+
+    /** @type {number} */
+    get x() {
+        return this.__x;
+    }
+    set x(value) {
+        this.__rawStale = true;
+        this.__x = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector3Int} 
+     */
+    withX(value) {
+        this.x = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __y = undefined;
+
+    /** @type {number} */
+    get y() {
+        return this.__y;
+    }
+    set y(value) {
+        this.__rawStale = true;
+        this.__y = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector3Int} 
+     */
+    withY(value) {
+        this.y = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __z = undefined;
+
+    /** @type {number} */
+    get z() {
+        return this.__z;
+    }
+    set z(value) {
+        this.__rawStale = true;
+        this.__z = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Vector3Int} 
+     */
+    withZ(value) {
+        this.z = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["x", "y", "z"]);
 
     /** 
-     * @param {number} value 
-     * @return {Rect} 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
      */
-    withX(value) {
-        this.x = value;
-        return this;
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-    /** @type {number} */
-    y;
-
     /** 
-     * @param {number} value 
-     * @return {Rect} 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
      */
-    withY(value) {
-        this.y = value;
-        return this;
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
     }
 
-    /** @type {number} */
-    width;
+    /** 
+     * @return {Vector3Int} a deep copy of this message
+     */
+    clone() {
+        return new Vector3Int().copyFrom(this);
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Rect} 
+     * Deep copy all fields from another message of the same type
+     * @param {Vector3Int} other 
+     * @return {Vector3Int} 
      */
-    withWidth(value) {
-        this.width = value;
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.x = other.x;
+        this.y = other.y;
+        this.z = other.z;
         return this;
     }
 
-    /** @type {number} */
-    height;
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Vector3Int} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Vector3Int)) return false;
+        if ((this.x ?? 0) !== (other.x ?? 0)) return false;
+        if ((this.y ?? 0) !== (other.y ?? 0)) return false;
+        if ((this.z ?? 0) !== (other.z ?? 0)) return false;
+        return true;
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Rect} 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
      */
-    withHeight(value) {
-        this.height = value;
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.x ?? 0);
+        hash = __hashNumber(hash, this.y ?? 0);
+        hash = __hashNumber(hash, this.z ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Vector3Int} 
+     */
+    clear() {
+        this.x = 0;
+        this.y = 0;
+        this.z = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-}
+    static __pool = [];
 
-// Message: RectInt
-export class RectInt {
-    static __descriptor = {
-        name: "RectInt",
-        get clrType() { return RectInt; },
-        fullName: "pokeworld.math.comm.RectInt",
-        package: "pokeworld.math.comm",
-        fields: [
-            {name: "x", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "y", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "width", number: 3, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "height", number: 4, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
-        ]
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Vector3Int} 
+     */
+    static acquire() {
+        const message = Vector3Int.__pool.pop();
+        if (message === undefined) return new Vector3Int();
+        message.__released = false;
+        return message;
     }
 
-    /** @type {number} */
-    x;
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Vector3Int} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Vector3Int instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Vector3Int.__pool.length < 64) {
+            Vector3Int.__pool.push(message);
+        }
+    }
 
     /** 
-     * @param {number} value 
-     * @return {RectInt} 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
      */
-    withX(value) {
-        this.x = value;
-        return this;
+    __releaseOwned() {
     }
 
-    /** @type {number} */
-    y;
+    // Dirty field bitmask
+    __dirty0 = 0;
 
     /** 
-     * @param {number} value 
-     * @return {RectInt} 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
      */
-    withY(value) {
-        this.y = value;
-        return this;
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-    /** @type {number} */
-    width;
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).x = this.x; break;
+                case 2: (full ??= {}).y = this.y; break;
+                case 4: (full ??= {}).z = this.z; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
     /** 
-     * @param {number} value 
-     * @return {RectInt} 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Vector3Int} 
      */
-    withWidth(value) {
-        this.width = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.x) !== undefined) {
+                this.x = value;
+            }
+            if ((value = full.y) !== undefined) {
+                this.y = value;
+            }
+            if ((value = full.z) !== undefined) {
+                this.z = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {number} */
-    height;
-
     /** 
-     * @param {number} value 
-     * @return {RectInt} 
+     * Mark the current state as synchronized
+     * @return {Vector3Int} 
      */
-    withHeight(value) {
-        this.height = value;
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            x: this.x,
+            y: this.y,
+            z: this.z,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Vector3Int.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.x;
+        if (value != null && !__isInt32(value)) return __invalid("x", "int32");
+        value = json.y;
+        if (value != null && !__isInt32(value)) return __invalid("y", "int32");
+        value = json.z;
+        if (value != null && !__isInt32(value)) return __invalid("z", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Vector3Int}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Vector3Int.acquire();
+        try {
+            let value;
+            value = json.x;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("x", "int32");
+                message.x = value;
+            }
+            value = json.y;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("y", "int32");
+                message.y = value;
+            }
+            value = json.z;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("z", "int32");
+                message.z = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Vector3Int.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class Vector3IntView {
+        static __layout = {
+            size: 16,
+            hash: 0x05ecec3b,
+            presence: 0,
+            fields: [
+                {name: "x", type: "TYPE_INT32", offset: 0},
+                {name: "y", type: "TYPE_INT32", offset: 4},
+                {name: "z", type: "TYPE_INT32", offset: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, Vector3IntView.__layout.hash);
+            return new Vector3IntView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get x() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get y() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+
+        get z() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class Vector3IntColumns extends __ColumnTable {
+        static Row = class Vector3IntRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get x() {
+                return this.__table.columns.x[this.__index];
+            }
+
+            get y() {
+                return this.__table.columns.y[this.__index];
+            }
+
+            get z() {
+                return this.__table.columns.z[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                x: new Int32Array(length),
+                y: new Int32Array(length),
+                z: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new Vector3IntColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.x[i] = row.x ?? 0;
+                columns.y[i] = row.y ?? 0;
+                columns.z[i] = row.z ?? 0;
+            }
+            return table;
+        }
+    };
+
 }
 
-// Message: Vector2
-export class Vector2 {
+// Message: Segment
+export class Segment {
     static __descriptor = {
-        name: "Vector2",
-        get clrType() { return Vector2; },
-        fullName: "pokeworld.math.comm.Vector2",
+        name: "Segment",
+        get clrType() { return Segment; },
+        fullName: "pokeworld.math.comm.Segment",
         package: "pokeworld.math.comm",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "x", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
-            {name: "y", number: 2, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"}
+            {name: "length", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
+            {name: "dictionaries", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "row", number: 3, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__length = 0;
+        this.__dictionaries = "";
+        this.__row = 0;
+    }
+
+    __length = undefined;
+
     /** @type {number} */
-    x;
+    get length() {
+        return this.__length;
+    }
+    set length(value) {
+        this.__rawStale = true;
+        this.__length = value;
+    }
 
     /** 
      * @param {number} value 
-     * @return {Vector2} 
+     * @return {Segment} 
      */
-    withX(value) {
-        this.x = value;
+    withLength(value) {
+        this.length = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {number} */
-    y;
+    __dictionaries = undefined;
+
+    /** @type {string} */
+    get dictionaries() {
+        return this.__dictionaries;
+    }
+    set dictionaries(value) {
+        this.__rawStale = true;
+        this.__dictionaries = value;
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Vector2} 
+     * @param {string} value 
+     * @return {Segment} 
      */
-    withY(value) {
-        this.y = value;
+    withDictionaries(value) {
+        this.dictionaries = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
-}
-
-// Message: Vector2Int
-export class Vector2Int {
-    static __descriptor = {
-        name: "Vector2Int",
-        get clrType() { return Vector2Int; },
-        fullName: "pokeworld.math.comm.Vector2Int",
-        package: "pokeworld.math.comm",
-        fields: [
-            {name: "x", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "y", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
-        ]
-    }
+    __row = undefined;
 
     /** @type {number} */
-    x;
+    get row() {
+        return this.__row;
+    }
+    set row(value) {
+        this.__rawStale = true;
+        this.__row = value;
+    }
 
     /** 
      * @param {number} value 
-     * @return {Vector2Int} 
+     * @return {Segment} 
      */
-    withX(value) {
-        this.x = value;
+    withRow(value) {
+        this.row = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {number} */
-    y;
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["length", "dictionaries", "row"]);
 
     /** 
-     * @param {number} value 
-     * @return {Vector2Int} 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
      */
-    withY(value) {
-        this.y = value;
-        return this;
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-}
-
-// Message: Vector3
-export class Vector3 {
-    static __descriptor = {
-        name: "Vector3",
-        get clrType() { return Vector3; },
-        fullName: "pokeworld.math.comm.Vector3",
-        package: "pokeworld.math.comm",
-        fields: [
-            {name: "x", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
-            {name: "y", number: 2, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
-            {name: "z", number: 3, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
     }
 
-    /** @type {number} */
-    x;
+    /** 
+     * @return {Segment} a deep copy of this message
+     */
+    clone() {
+        return new Segment().copyFrom(this);
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Vector3} 
+     * Deep copy all fields from another message of the same type
+     * @param {Segment} other 
+     * @return {Segment} 
      */
-    withX(value) {
-        this.x = value;
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.length = other.length;
+        this.dictionaries = other.dictionaries;
+        this.row = other.row;
         return this;
     }
 
-    /** @type {number} */
-    y;
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Segment} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Segment)) return false;
+        if ((this.length ?? 0) !== (other.length ?? 0)) return false;
+        if ((this.dictionaries ?? "") !== (other.dictionaries ?? "")) return false;
+        if ((this.row ?? 0) !== (other.row ?? 0)) return false;
+        return true;
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Vector3} 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
      */
-    withY(value) {
-        this.y = value;
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.length ?? 0);
+        hash = __hashString(hash, this.dictionaries ?? "");
+        hash = __hashNumber(hash, this.row ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Segment} 
+     */
+    clear() {
+        this.length = 0;
+        this.dictionaries = "";
+        this.row = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-    /** @type {number} */
-    z;
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {number} value 
-     * @return {Vector3} 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Segment} 
      */
-    withZ(value) {
-        this.z = value;
-        return this;
+    static acquire() {
+        const message = Segment.__pool.pop();
+        if (message === undefined) return new Segment();
+        message.__released = false;
+        return message;
     }
 
-}
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Segment} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Segment instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Segment.__pool.length < 64) {
+            Segment.__pool.push(message);
+        }
+    }
 
-// Message: Vector3Int
-export class Vector3Int {
-    static __descriptor = {
-        name: "Vector3Int",
-        get clrType() { return Vector3Int; },
-        fullName: "pokeworld.math.comm.Vector3Int",
-        package: "pokeworld.math.comm",
-        fields: [
-            {name: "x", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "y", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "z", number: 3, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
     }
 
-    /** @type {number} */
-    x;
+    // Dirty field bitmask
+    __dirty0 = 0;
 
     /** 
-     * @param {number} value 
-     * @return {Vector3Int} 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
      */
-    withX(value) {
-        this.x = value;
-        return this;
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-    /** @type {number} */
-    y;
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).length = this.length; break;
+                case 2: (full ??= {}).dictionaries = this.dictionaries; break;
+                case 4: (full ??= {}).row = this.row; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Vector3Int} 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Segment} 
      */
-    withY(value) {
-        this.y = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.length) !== undefined) {
+                this.length = value;
+            }
+            if ((value = full.dictionaries) !== undefined) {
+                this.dictionaries = value;
+            }
+            if ((value = full.row) !== undefined) {
+                this.row = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {number} */
-    z;
-
     /** 
-     * @param {number} value 
-     * @return {Vector3Int} 
+     * Mark the current state as synchronized
+     * @return {Segment} 
      */
-    withZ(value) {
-        this.z = value;
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            length: this.length,
+            dictionaries: this.dictionaries,
+            row: this.row,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Segment.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.length;
+        if (value != null && !__isFloat(value)) return __invalid("length", "float");
+        value = json.dictionaries;
+        if (value != null && !__isString(value)) return __invalid("dictionaries", "string");
+        value = json.row;
+        if (value != null && !__isInt32(value)) return __invalid("row", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Segment}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Segment.acquire();
+        try {
+            let value;
+            value = json.length;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("length", "float");
+                message.length = value;
+            }
+            value = json.dictionaries;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("dictionaries", "string");
+                message.dictionaries = value;
+            }
+            value = json.row;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("row", "int32");
+                message.row = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Segment.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class SegmentView {
+        static __layout = {
+            size: 16,
+            hash: 0xc3697cbe,
+            presence: 8,
+            fields: [
+                {name: "length", type: "TYPE_FLOAT", offset: 8},
+                {name: "dictionaries", type: "TYPE_STRING", offset: 0},
+                {name: "row", type: "TYPE_INT32", offset: 12}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, SegmentView.__layout.hash);
+            return new SegmentView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get length() {
+            return __flatFloat(this.__view, this.__offset + 8);
+        }
+
+        get dictionaries() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get row() {
+            return __flatInt32(this.__view, this.__offset + 12);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class SegmentColumns extends __ColumnTable {
+        static Row = class SegmentRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get length() {
+                return this.__table.columns.length[this.__index];
+            }
+
+            get dictionaries() {
+                const table = this.__table;
+                return table.dictionaries.dictionaries[table.columns.dictionaries[this.__index]];
+            }
+
+            get row() {
+                return this.__table.columns.row[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {dictionaries: []};
+            this.columns = {
+                length: new Float32Array(length),
+                dictionaries: new Uint32Array(length),
+                row: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new SegmentColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const dictionariesCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.length[i] = row.length ?? 0;
+                columns.dictionaries[i] = __columnEncode(dictionariesCodes, dictionaries.dictionaries, row.dictionaries ?? "");
+                columns.row[i] = row.row ?? 0;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/math/comm_math.proto",
+    dependencies: [],
+    data: "Ch5wb2tld29ybGQvbWF0aC9jb21tX21hdGgucHJvdG8SE3Bva2V3b3JsZC5tYXRoLmNvbW0iUAoEUmVjdBIMCgF4GAEgASgCUgF4EgwKAXkYAiABKAJSAXkSFAoFd2lkdGgYAyABKAJSBXdpZHRoEhYKBmhlaWdodBgEIAEoAlIGaGVpZ2h0IlMKB1JlY3RJbnQSDAoBeBgBIAEoBVIBeBIMCgF5GAIgASgFUgF5EhQKBXdpZHRoGAMgASgFUgV3aWR0aBIWCgZoZWlnaHQYBCABKAVSBmhlaWdodCIlCgdWZWN0b3IyEgwKAXgYASABKAJSAXgSDAoBeRgCIAEoAlIBeSIoCgpWZWN0b3IySW50EgwKAXgYASABKAVSAXgSDAoBeRgCIAEoBVIBeSIzCgdWZWN0b3IzEgwKAXgYASABKAJSAXgSDAoBeRgCIAEoAlIBeRIMCgF6GAMgASgCUgF6IjYKClZlY3RvcjNJbnQSDAoBeBgBIAEoBVIBeBIMCgF5GAIgASgFUgF5EgwKAXoYAyABKAVSAXoiVwoHU2VnbWVudBIWCgZsZW5ndGgYASABKAJSBmxlbmd0aBIiCgxkaWN0aW9uYXJpZXMYAiABKAlSDGRpY3Rpb25hcmllcxIQCgNyb3cYAyABKAVSA3Jvd2IGcHJvdG8z",
+};
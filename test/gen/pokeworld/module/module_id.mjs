@@ -24,6 +24,7 @@ Object.defineProperty(ModuleId, "__descriptor", {
         get clrType() { return ModuleId; },
         fullName: "pokeworld.module.ModuleId",
         package: "pokeworld.module",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "INVALID", originalName: "MODULE_ID_INVALID", number: 0},
             {name: "AGENT", originalName: "MODULE_ID_AGENT", number: 1001},
@@ -37,10 +38,17 @@ Object.defineProperty(ModuleId, "__descriptor", {
             {name: "USER", originalName: "MODULE_ID_USER", number: 1009},
             {name: "WORLD", originalName: "MODULE_ID_WORLD", number: 1010},
             {name: "ACTOR", originalName: "MODULE_ID_ACTOR", number: 1011}
-        ]
+        ],
+        valueIndex: new Map([[0, 0], [1001, 1], [1002, 2], [1003, 3], [1004, 4], [1005, 5], [1006, 6], [1007, 7], [1008, 8], [1009, 9], [1010, 10], [1011, 11]])
     },
     enumerable: false,
     writable: false,
 });
 Object.freeze(ModuleId);
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/module/module_id.proto",
+    dependencies: ["google/protobuf/descriptor.proto"],
+    data: "CiBwb2tld29ybGQvbW9kdWxlL21vZHVsZV9pZC5wcm90bxIQcG9rZXdvcmxkLm1vZHVsZRogZ29vZ2xlL3Byb3RvYnVmL2Rlc2NyaXB0b3IucHJvdG8qnAIKCE1vZHVsZUlkEhUKEU1PRFVMRV9JRF9JTlZBTElEEAASFAoPTU9EVUxFX0lEX0FHRU5UEOkHEhUKEE1PRFVMRV9JRF9CQVRUTEUQ6gcSFQoQTU9EVUxFX0lEX0VOVElUWRDrBxIYChNNT0RVTEVfSURfSU5WRU5UT1JZEOwHEhMKDk1PRFVMRV9JRF9NQVRIEO0HEhYKEU1PRFVMRV9JRF9ORVRXT1JLEO4HEhUKEE1PRFVMRV9JRF9QTEFZRVIQ7wcSFgoRTU9EVUxFX0lEX1BPS0VNT04Q8AcSEwoOTU9EVUxFX0lEX1VTRVIQ8QcSFAoPTU9EVUxFX0lEX1dPUkxEEPIHEhQKD01PRFVMRV9JRF9BQ1RPUhDzBzpYCgltb2R1bGVfaWQSHC5nb29nbGUucHJvdG9idWYuRW51bU9wdGlvbnMYgdrECSABKA4yGi5wb2tld29ybGQubW9kdWxlLk1vZHVsZUlkUghtb2R1bGVJZGIGcHJvdG8z",
+};
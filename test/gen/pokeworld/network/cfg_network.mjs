@@ -3,6 +3,426 @@
 
 // Package: pokeworld.network.cfg
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: ServerType
 export const ServerType = {
     MAIN: 0,
@@ -14,10 +434,12 @@ Object.defineProperty(ServerType, "__descriptor", {
         get clrType() { return ServerType; },
         fullName: "pokeworld.network.cfg.ServerType",
         package: "pokeworld.network.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "MAIN", originalName: "SERVERTYPE_MAIN", number: 0},
             {name: "RESOURCE_DOWNLOAD", originalName: "SERVERTYPE_RESOURCE_DOWNLOAD", number: 1}
-        ]
+        ],
+        valueIndex: [0, 1]
     },
     enumerable: false,
     writable: false,
@@ -31,6 +453,7 @@ export class Server {
         get clrType() { return Server; },
         fullName: "pokeworld.network.cfg.Server",
         package: "pokeworld.network.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
             {name: "type", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.network.cfg.ServerType", get clrType() { return ServerType; },label: "LABEL_OPTIONAL"},
@@ -39,8 +462,23 @@ export class Server {
         ]
     }
 
+    constructor() {
+        this.__id = 0;
+        this.__type = ServerType.MAIN;
+        this.__host = "";
+        this.__port = 0;
+    }
+
+    __id = undefined;
+
     /** @type {number} */
-    id;
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
     /** 
      * @param {number} value 
@@ -48,11 +486,21 @@ export class Server {
      */
     withId(value) {
         this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __type = undefined;
+
     /** @type {ServerType[keyof typeof ServerType]} */
-    type;
+    get type() {
+        return this.__type;
+    }
+    set type(value) {
+        this.__rawStale = true;
+        this.__type = value;
+    }
 
     /** 
      * @param {ServerType[keyof typeof ServerType]} value 
@@ -60,11 +508,21 @@ export class Server {
      */
     withType(value) {
         this.type = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
+    __host = undefined;
+
     /** @type {string} */
-    host;
+    get host() {
+        return this.__host;
+    }
+    set host(value) {
+        this.__rawStale = true;
+        this.__host = value;
+    }
 
     /** 
      * @param {string} value 
@@ -72,11 +530,21 @@ export class Server {
      */
     withHost(value) {
         this.host = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
+    __port = undefined;
+
     /** @type {number} */
-    port;
+    get port() {
+        return this.__port;
+    }
+    set port(value) {
+        this.__rawStale = true;
+        this.__port = value;
+    }
 
     /** 
      * @param {number} value 
@@ -84,9 +552,377 @@ export class Server {
      */
     withPort(value) {
         this.port = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
         return this;
     }
 
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["id", "type", "host", "port"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Server} a deep copy of this message
+     */
+    clone() {
+        return new Server().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Server} other 
+     * @return {Server} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.type = other.type;
+        this.host = other.host;
+        this.port = other.port;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Server} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Server)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.type ?? ServerType.MAIN) !== (other.type ?? ServerType.MAIN)) return false;
+        if ((this.host ?? "") !== (other.host ?? "")) return false;
+        if ((this.port ?? 0) !== (other.port ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashNumber(hash, this.type ?? ServerType.MAIN);
+        hash = __hashString(hash, this.host ?? "");
+        hash = __hashNumber(hash, this.port ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Server} 
+     */
+    clear() {
+        this.id = 0;
+        this.type = ServerType.MAIN;
+        this.host = "";
+        this.port = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Server} 
+     */
+    static acquire() {
+        const message = Server.__pool.pop();
+        if (message === undefined) return new Server();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Server} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Server instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Server.__pool.length < 64) {
+            Server.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).type = this.type; break;
+                case 4: (full ??= {}).host = this.host; break;
+                case 8: (full ??= {}).port = this.port; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Server} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.type) !== undefined) {
+                this.type = value;
+            }
+            if ((value = full.host) !== undefined) {
+                this.host = value;
+            }
+            if ((value = full.port) !== undefined) {
+                this.port = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Server} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            type: this.type,
+            host: this.host,
+            port: this.port,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Server.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.type;
+        if (value != null && !__isEnum(ServerType, value)) return __invalid("type", "enum ServerType");
+        value = json.host;
+        if (value != null && !__isString(value)) return __invalid("host", "string");
+        value = json.port;
+        if (value != null && !__isInt32(value)) return __invalid("port", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Server}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Server.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.type;
+            if (value != null) {
+                if (!__isEnum(ServerType, value)) throw __invalid("type", "enum ServerType");
+                message.type = value;
+            }
+            value = json.host;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("host", "string");
+                message.host = value;
+            }
+            value = json.port;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("port", "int32");
+                message.port = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Server.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ServerView {
+        static __layout = {
+            size: 24,
+            hash: 0x778ab4b2,
+            presence: 8,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 8},
+                {name: "type", type: "TYPE_ENUM", offset: 12},
+                {name: "host", type: "TYPE_STRING", offset: 0},
+                {name: "port", type: "TYPE_INT32", offset: 16}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ServerView.__layout.hash);
+            return new ServerView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+
+        get type() {
+            return __flatInt32(this.__view, this.__offset + 12);
+        }
+
+        get host() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get port() {
+            return __flatInt32(this.__view, this.__offset + 16);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ServerColumns extends __ColumnTable {
+        static Row = class ServerRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get type() {
+                return this.__table.columns.type[this.__index];
+            }
+
+            get host() {
+                const table = this.__table;
+                return table.dictionaries.host[table.columns.host[this.__index]];
+            }
+
+            get port() {
+                return this.__table.columns.port[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {host: []};
+            this.columns = {
+                id: new Int32Array(length),
+                type: new Int32Array(length),
+                host: new Uint32Array(length),
+                port: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ServerColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const hostCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.type[i] = row.type ?? ServerType.MAIN;
+                columns.host[i] = __columnEncode(hostCodes, dictionaries.host, row.host ?? "");
+                columns.port[i] = row.port ?? 0;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: TbServer
@@ -96,13 +932,32 @@ export class TbServer {
         get clrType() { return TbServer; },
         fullName: "pokeworld.network.cfg.TbServer",
         package: "pokeworld.network.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.network.cfg.Server", get clrType() { return Server; },label: "LABEL_REPEATED"}
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.network.cfg.Server", get clrType() { return Server; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
     /** @type {Server[]} */
-    dataList;
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbServer.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
 
     /** 
      * @param {Server[]} value 
@@ -110,8 +965,356 @@ export class TbServer {
      */
     withDataList(value) {
         this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbServer} a deep copy of this message
+     */
+    clone() {
+        return new TbServer().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbServer} other 
+     * @return {TbServer} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbServer} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbServer)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbServer} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbServer} 
+     */
+    static acquire() {
+        const message = TbServer.__pool.pop();
+        if (message === undefined) return new TbServer();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbServer} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbServer instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbServer.__pool.length < 64) {
+            TbServer.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof Server) Server.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbServer} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof Server ? item.clone().commit() : new Server().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
         return this;
     }
 
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbServer} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbServer.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Server.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbServer}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbServer.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Server, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbServer.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbServerView {
+        static __layout = {
+            size: 8,
+            hash: 0xc70c464b,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Server.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbServerView.__layout.hash);
+            return new TbServerView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Server.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbServerColumns extends __ColumnTable {
+        static Row = class TbServerRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbServerColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/network/cfg_network.proto",
+    dependencies: [],
+    data: "CiNwb2tld29ybGQvbmV0d29yay9jZmdfbmV0d29yay5wcm90bxIVcG9rZXdvcmxkLm5ldHdvcmsuY2ZnIncKBlNlcnZlchIOCgJpZBgBIAEoBVICaWQSNQoEdHlwZRgCIAEoDjIhLnBva2V3b3JsZC5uZXR3b3JrLmNmZy5TZXJ2ZXJUeXBlUgR0eXBlEhIKBGhvc3QYAyABKAlSBGhvc3QSEgoEcG9ydBgEIAEoBVIEcG9ydCJKCghUYlNlcnZlchI+CglkYXRhX2xpc3QYASADKAsyHS5wb2tld29ybGQubmV0d29yay5jZmcuU2VydmVyQgIQAFIIZGF0YUxpc3QqQwoKU2VydmVyVHlwZRITCg9TRVJWRVJUWVBFX01BSU4QABIgChxTRVJWRVJUWVBFX1JFU09VUkNFX0RPV05MT0FEEAFiBnByb3RvMw==",
+};
@@ -5,6 +5,463 @@
 
 import * as __PokeworldEntityComm_entity from '../entity/comm_entity.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Codecs of the 64-bit integer representation (int64=hybrid)
+function __checkInt64String(value) {
+    if (!/^-?\d+$/.test(value)) {
+        throw new Error(`Invalid 64-bit integer: ${JSON.stringify(value)}`);
+    }
+    return value;
+}
+
+function __decodeInt64(value) {
+    if (typeof value === 'number') {
+        return Number.isSafeInteger(value) ? value : BigInt(value);
+    }
+    if (typeof value === 'string') {
+        if (/^-?\d{1,15}$/.test(value)) return Number(value);
+        __checkInt64String(value);
+    }
+    const big = typeof value === 'bigint' ? value : BigInt(value);
+    return big >= -9007199254740991n && big <= 9007199254740991n ? Number(big) : big;
+}
+
+function __encodeInt64(value) {
+    return typeof value === 'bigint' ? value.toString() : value;
+}
+
+function __hashInt64(hash, value) {
+    return typeof value === 'bigint' ? __hashBigInt(hash, value) : __hashNumber(hash, value);
+}
+
+function __encodeInt64List(list) {
+    return Array.isArray(list) ? list.map(__encodeInt64) : list;
+}
+
+function __hashBigInt(hash, value) {
+    hash = (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value))) | 0;
+    return (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value >> 32n))) | 0;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: MessageId
 export const MessageId = {
     INVALID: 0,
@@ -19,13 +476,15 @@ Object.defineProperty(MessageId, "__descriptor", {
         get clrType() { return MessageId; },
         fullName: "pokeworld.player.cs.MessageId",
         package: "pokeworld.player.cs",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "INVALID", originalName: "MESSAGE_ID_INVALID", number: 0},
             {name: "START_REQUEST", originalName: "MESSAGE_ID_START_REQUEST", number: 1001},
             {name: "START_RESPONSE", originalName: "MESSAGE_ID_START_RESPONSE", number: 1002},
             {name: "GET_PLAYER_REQUEST", originalName: "MESSAGE_ID_GET_PLAYER_REQUEST", number: 1003},
             {name: "GET_PLAYER_RESPONSE", originalName: "MESSAGE_ID_GET_PLAYER_RESPONSE", number: 1004}
-        ]
+        ],
+        valueIndex: new Map([[0, 0], [1001, 1], [1002, 2], [1003, 3], [1004, 4]])
     },
     enumerable: false,
     writable: false,
@@ -39,23 +498,323 @@ export class JoinGameRequest {
         get clrType() { return JoinGameRequest; },
         fullName: "pokeworld.player.cs.JoinGameRequest",
         package: "pokeworld.player.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1007,
+        messageId: 1001,
         fields: [
-            {name: "entityId", number: 1, type: "TYPE_UINT64", label: "LABEL_OPTIONAL"}
+            {name: "entityId", number: 1, type: "TYPE_UINT64", int64: "hybrid", label: "LABEL_OPTIONAL"}
         ]
     }
 
-    /** @type {number} */
-    entityId;
+    constructor() {
+        this.__entityId = 0;
+    }
+
+    __entityId = undefined;
+
+    /** @type {(number|bigint)} */
+    get entityId() {
+        return this.__entityId;
+    }
+    set entityId(value) {
+        this.__rawStale = true;
+        this.__entityId = value;
+    }
 
     /** 
-     * @param {number} value 
+     * @param {(number|bigint)} value 
      * @return {JoinGameRequest} 
      */
     withEntityId(value) {
         this.entityId = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["entityId"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {JoinGameRequest} a deep copy of this message
+     */
+    clone() {
+        return new JoinGameRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {JoinGameRequest} other 
+     * @return {JoinGameRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.entityId = other.entityId;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {JoinGameRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof JoinGameRequest)) return false;
+        if ((this.entityId ?? 0) !== (other.entityId ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashInt64(hash, this.entityId ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {JoinGameRequest} 
+     */
+    clear() {
+        this.entityId = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {JoinGameRequest} 
+     */
+    static acquire() {
+        const message = JoinGameRequest.__pool.pop();
+        if (message === undefined) return new JoinGameRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {JoinGameRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('JoinGameRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (JoinGameRequest.__pool.length < 64) {
+            JoinGameRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).entityId = __encodeInt64(this.entityId); break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {JoinGameRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.entityId) !== undefined) {
+                this.entityId = value === null ? undefined : __decodeInt64(value);
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {JoinGameRequest} 
+     */
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            entityId: __encodeInt64(this.entityId),
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, JoinGameRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.entityId;
+        if (value != null && !__isUint64(value)) return __invalid("entityId", "uint64");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {JoinGameRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = JoinGameRequest.acquire();
+        try {
+            let value;
+            value = json.entityId;
+            if (value != null) {
+                if (!__isUint64(value)) throw __invalid("entityId", "uint64");
+                message.entityId = __decodeInt64(value);
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            JoinGameRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class JoinGameRequestView {
+        static __layout = {
+            size: 8,
+            hash: 0x2789c02b,
+            presence: 8,
+            fields: [
+                {name: "entityId", type: "TYPE_UINT64", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, JoinGameRequestView.__layout.hash);
+            return new JoinGameRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get entityId() {
+            return __flatUint64(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class JoinGameRequestColumns extends __ColumnTable {
+        static Row = class JoinGameRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get entityId() {
+                return this.__table.columns.entityId[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                entityId: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new JoinGameRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.entityId[i] = row.entityId;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: JoinGameResponse
@@ -65,196 +824,2048 @@ export class JoinGameResponse {
         get clrType() { return JoinGameResponse; },
         fullName: "pokeworld.player.cs.JoinGameResponse",
         package: "pokeworld.player.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1007,
+        messageId: 1002,
         fields: [
             {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__success = false;
+    }
+
+    __success = undefined;
+
+    /** @type {boolean} */
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
+
+    /** 
+     * @param {boolean} value 
+     * @return {JoinGameResponse} 
+     */
+    withSuccess(value) {
+        this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {JoinGameResponse} a deep copy of this message
+     */
+    clone() {
+        return new JoinGameResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {JoinGameResponse} other 
+     * @return {JoinGameResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {JoinGameResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof JoinGameResponse)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {JoinGameResponse} 
+     */
+    clear() {
+        this.success = false;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {JoinGameResponse} 
+     */
+    static acquire() {
+        const message = JoinGameResponse.__pool.pop();
+        if (message === undefined) return new JoinGameResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {JoinGameResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('JoinGameResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (JoinGameResponse.__pool.length < 64) {
+            JoinGameResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {JoinGameResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {JoinGameResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, JoinGameResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {JoinGameResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = JoinGameResponse.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            JoinGameResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class JoinGameResponseView {
+        static __layout = {
+            size: 8,
+            hash: 0x2c4afd75,
+            presence: 0,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, JoinGameResponseView.__layout.hash);
+            return new JoinGameResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class JoinGameResponseColumns extends __ColumnTable {
+        static Row = class JoinGameResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new JoinGameResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: GetPlayersRequest
+export class GetPlayersRequest {
+    static __descriptor = {
+        name: "GetPlayersRequest",
+        get clrType() { return GetPlayersRequest; },
+        fullName: "pokeworld.player.cs.GetPlayersRequest",
+        package: "pokeworld.player.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1007,
+        messageId: 1003,
+        fields: [
+            {name: "entityIds", number: 1, type: "TYPE_UINT64", int64: "hybrid", label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.__entityIds = [];
+    }
+
+    __entityIds = undefined;
+
+    /** @type {(number|bigint)[]} */
+    get entityIds() {
+        return this.__entityIds;
+    }
+    set entityIds(value) {
+        this.__rawStale = true;
+        this.__entityIds = value;
+    }
+
+    /** 
+     * @param {(number|bigint)[]} value 
+     * @return {GetPlayersRequest} 
+     */
+    withEntityIds(value) {
+        this.entityIds = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["entityIds"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__entityIds) != null) {
+            raw = this.__raw.entityIds;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (let i = 0; i < value.length; i++) {
+                if (value[i] !== __decodeInt64(raw[i])) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {GetPlayersRequest} a deep copy of this message
+     */
+    clone() {
+        return new GetPlayersRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {GetPlayersRequest} other 
+     * @return {GetPlayersRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.entityIds = __cloneArray(other.entityIds, undefined);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {GetPlayersRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof GetPlayersRequest)) return false;
+        if (!__equalsArray(this.entityIds, other.entityIds, undefined)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.entityIds, __hashInt64);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {GetPlayersRequest} 
+     */
+    clear() {
+        if (Array.isArray(this.entityIds)) this.entityIds.length = 0; else this.entityIds = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {GetPlayersRequest} 
+     */
+    static acquire() {
+        const message = GetPlayersRequest.__pool.pop();
+        if (message === undefined) return new GetPlayersRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {GetPlayersRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('GetPlayersRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (GetPlayersRequest.__pool.length < 64) {
+            GetPlayersRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).entityIds = __encodeInt64List(this.entityIds); break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {GetPlayersRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.entityIds) !== undefined) {
+                this.entityIds = value === null ? [] : value.map(item => __decodeInt64(item));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {GetPlayersRequest} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            entityIds: __encodeInt64List(this.entityIds),
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, GetPlayersRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.entityIds;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("entityIds", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if (!__isUint64(item)) return __prefixError(__invalid("", "uint64"), "entityIds", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {GetPlayersRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = GetPlayersRequest.acquire();
+        try {
+            let value;
+            value = json.entityIds;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("entityIds", "array");
+                const list = new Array(value.length);
+                message.entityIds = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    if (!__isUint64(item)) throw __prefixError(__invalid("", "uint64"), "entityIds", i);
+                    list[i] = __decodeInt64(item);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            GetPlayersRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class GetPlayersRequestView {
+        static __layout = {
+            size: 8,
+            hash: 0x4ccb0326,
+            presence: 8,
+            fields: [
+                {name: "entityIds", type: "TYPE_UINT64", offset: 0, repeated: true, stride: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, GetPlayersRequestView.__layout.hash);
+            return new GetPlayersRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get entityIds() {
+            return __flatList(this.__view, this.__offset + 0, 8, __flatUint64);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class GetPlayersRequestColumns extends __ColumnTable {
+        static Row = class GetPlayersRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get entityIds() {
+                return this.__table.columns.entityIds[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                entityIds: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new GetPlayersRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.entityIds[i] = row.entityIds;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: Player
+export class Player {
+    static __descriptor = {
+        name: "Player",
+        get clrType() { return Player; },
+        fullName: "pokeworld.player.cs.Player",
+        package: "pokeworld.player.cs",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "entityInfo", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityInfo", get clrType() { return __PokeworldEntityComm_entity.EntityInfo; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "actorInfo", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorInfo", get clrType() { return __PokeworldEntityComm_entity.ActorInfo; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "playerInfo", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.PlayerInfo", get clrType() { return __PokeworldEntityComm_entity.PlayerInfo; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "entityTransform", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityTransform", get clrType() { return __PokeworldEntityComm_entity.EntityTransform; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "actorTransform", number: 5, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorTransform", get clrType() { return __PokeworldEntityComm_entity.ActorTransform; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "actorState", number: 6, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorState", get clrType() { return __PokeworldEntityComm_entity.ActorState; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __entityInfo = undefined;
+    __entityInfoRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.EntityInfo|undefined} */
+    get entityInfo() {
+        if (this.__entityInfoRaw !== undefined) {
+            this.__entityInfo = this.__decode(Player.__descriptor.fields[0], this.__entityInfoRaw, this.__entityInfo);
+            this.__entityInfoRaw = undefined;
+        }
+        return this.__entityInfo;
+    }
+    set entityInfo(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__entityInfoRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__entityInfo = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__entityInfo = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasEntityInfo() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {Player} 
+     */
+    clearEntityInfo() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__entityInfo = undefined;
+        this.__entityInfoRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.EntityInfo} value 
+     * @return {Player} 
+     */
+    withEntityInfo(value) {
+        this.entityInfo = value;
+        return this;
+    }
+
+    __actorInfo = undefined;
+    __actorInfoRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.ActorInfo|undefined} */
+    get actorInfo() {
+        if (this.__actorInfoRaw !== undefined) {
+            this.__actorInfo = this.__decode(Player.__descriptor.fields[1], this.__actorInfoRaw, this.__actorInfo);
+            this.__actorInfoRaw = undefined;
+        }
+        return this.__actorInfo;
+    }
+    set actorInfo(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__actorInfoRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorInfo = undefined;
+            this.__has0 &= ~2;
+        } else {
+            this.__actorInfo = value;
+            this.__has0 |= 2;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorInfo() {
+        return (this.__has0 & 2) !== 0;
+    }
+
+    /** 
+     * @return {Player} 
+     */
+    clearActorInfo() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__actorInfo = undefined;
+        this.__actorInfoRaw = undefined;
+        this.__has0 &= ~2;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.ActorInfo} value 
+     * @return {Player} 
+     */
+    withActorInfo(value) {
+        this.actorInfo = value;
+        return this;
+    }
+
+    __playerInfo = undefined;
+    __playerInfoRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.PlayerInfo|undefined} */
+    get playerInfo() {
+        if (this.__playerInfoRaw !== undefined) {
+            this.__playerInfo = this.__decode(Player.__descriptor.fields[2], this.__playerInfoRaw, this.__playerInfo);
+            this.__playerInfoRaw = undefined;
+        }
+        return this.__playerInfo;
+    }
+    set playerInfo(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__playerInfoRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__playerInfo = undefined;
+            this.__has0 &= ~4;
+        } else {
+            this.__playerInfo = value;
+            this.__has0 |= 4;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasPlayerInfo() {
+        return (this.__has0 & 4) !== 0;
+    }
+
+    /** 
+     * @return {Player} 
+     */
+    clearPlayerInfo() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__playerInfo = undefined;
+        this.__playerInfoRaw = undefined;
+        this.__has0 &= ~4;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.PlayerInfo} value 
+     * @return {Player} 
+     */
+    withPlayerInfo(value) {
+        this.playerInfo = value;
+        return this;
+    }
+
+    __entityTransform = undefined;
+    __entityTransformRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.EntityTransform|undefined} */
+    get entityTransform() {
+        if (this.__entityTransformRaw !== undefined) {
+            this.__entityTransform = this.__decode(Player.__descriptor.fields[3], this.__entityTransformRaw, this.__entityTransform);
+            this.__entityTransformRaw = undefined;
+        }
+        return this.__entityTransform;
+    }
+    set entityTransform(value) {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__entityTransformRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__entityTransform = undefined;
+            this.__has0 &= ~8;
+        } else {
+            this.__entityTransform = value;
+            this.__has0 |= 8;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasEntityTransform() {
+        return (this.__has0 & 8) !== 0;
+    }
+
+    /** 
+     * @return {Player} 
+     */
+    clearEntityTransform() {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__entityTransform = undefined;
+        this.__entityTransformRaw = undefined;
+        this.__has0 &= ~8;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.EntityTransform} value 
+     * @return {Player} 
+     */
+    withEntityTransform(value) {
+        this.entityTransform = value;
+        return this;
+    }
+
+    __actorTransform = undefined;
+    __actorTransformRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.ActorTransform|undefined} */
+    get actorTransform() {
+        if (this.__actorTransformRaw !== undefined) {
+            this.__actorTransform = this.__decode(Player.__descriptor.fields[4], this.__actorTransformRaw, this.__actorTransform);
+            this.__actorTransformRaw = undefined;
+        }
+        return this.__actorTransform;
+    }
+    set actorTransform(value) {
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
+        this.__actorTransformRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorTransform = undefined;
+            this.__has0 &= ~16;
+        } else {
+            this.__actorTransform = value;
+            this.__has0 |= 16;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorTransform() {
+        return (this.__has0 & 16) !== 0;
+    }
+
+    /** 
+     * @return {Player} 
+     */
+    clearActorTransform() {
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
+        this.__actorTransform = undefined;
+        this.__actorTransformRaw = undefined;
+        this.__has0 &= ~16;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.ActorTransform} value 
+     * @return {Player} 
+     */
+    withActorTransform(value) {
+        this.actorTransform = value;
+        return this;
+    }
+
+    __actorState = undefined;
+    __actorStateRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.ActorState|undefined} */
+    get actorState() {
+        if (this.__actorStateRaw !== undefined) {
+            this.__actorState = this.__decode(Player.__descriptor.fields[5], this.__actorStateRaw, this.__actorState);
+            this.__actorStateRaw = undefined;
+        }
+        return this.__actorState;
+    }
+    set actorState(value) {
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
+        this.__actorStateRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorState = undefined;
+            this.__has0 &= ~32;
+        } else {
+            this.__actorState = value;
+            this.__has0 |= 32;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorState() {
+        return (this.__has0 & 32) !== 0;
+    }
+
+    /** 
+     * @return {Player} 
+     */
+    clearActorState() {
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
+        this.__actorState = undefined;
+        this.__actorStateRaw = undefined;
+        this.__has0 &= ~32;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.ActorState} value 
+     * @return {Player} 
+     */
+    withActorState(value) {
+        this.actorState = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dirty0 |= 1;
+                this.__entityInfo = undefined;
+                this.__entityInfoRaw = raw;
+                this.__has0 |= 1;
+                break;
+            case 2:
+                this.__dirty0 |= 2;
+                this.__actorInfo = undefined;
+                this.__actorInfoRaw = raw;
+                this.__has0 |= 2;
+                break;
+            case 3:
+                this.__dirty0 |= 4;
+                this.__playerInfo = undefined;
+                this.__playerInfoRaw = raw;
+                this.__has0 |= 4;
+                break;
+            case 4:
+                this.__dirty0 |= 8;
+                this.__entityTransform = undefined;
+                this.__entityTransformRaw = raw;
+                this.__has0 |= 8;
+                break;
+            case 5:
+                this.__dirty0 |= 16;
+                this.__actorTransform = undefined;
+                this.__actorTransformRaw = raw;
+                this.__has0 |= 16;
+                break;
+            case 6:
+                this.__dirty0 |= 32;
+                this.__actorState = undefined;
+                this.__actorStateRaw = raw;
+                this.__has0 |= 32;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["entityInfo", "actorInfo", "playerInfo", "entityTransform", "actorTransform", "actorState"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__entityInfo) != null && !value.__isPristine()) return false;
+        if ((value = this.__actorInfo) != null && !value.__isPristine()) return false;
+        if ((value = this.__playerInfo) != null && !value.__isPristine()) return false;
+        if ((value = this.__entityTransform) != null && !value.__isPristine()) return false;
+        if ((value = this.__actorTransform) != null && !value.__isPristine()) return false;
+        if ((value = this.__actorState) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Player} a deep copy of this message
+     */
+    clone() {
+        return new Player().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Player} other 
+     * @return {Player} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.entityInfo = __cloneMessage(other.entityInfo);
+        this.actorInfo = __cloneMessage(other.actorInfo);
+        this.playerInfo = __cloneMessage(other.playerInfo);
+        this.entityTransform = __cloneMessage(other.entityTransform);
+        this.actorTransform = __cloneMessage(other.actorTransform);
+        this.actorState = __cloneMessage(other.actorState);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Player} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Player)) return false;
+        if (!__equalsMessage(this.entityInfo, other.entityInfo)) return false;
+        if (!__equalsMessage(this.actorInfo, other.actorInfo)) return false;
+        if (!__equalsMessage(this.playerInfo, other.playerInfo)) return false;
+        if (!__equalsMessage(this.entityTransform, other.entityTransform)) return false;
+        if (!__equalsMessage(this.actorTransform, other.actorTransform)) return false;
+        if (!__equalsMessage(this.actorState, other.actorState)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashMessage(hash, this.entityInfo);
+        hash = __hashMessage(hash, this.actorInfo);
+        hash = __hashMessage(hash, this.playerInfo);
+        hash = __hashMessage(hash, this.entityTransform);
+        hash = __hashMessage(hash, this.actorTransform);
+        hash = __hashMessage(hash, this.actorState);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Player} 
+     */
+    clear() {
+        this.__entityInfo = undefined;
+        this.__entityInfoRaw = undefined;
+        this.__actorInfo = undefined;
+        this.__actorInfoRaw = undefined;
+        this.__playerInfo = undefined;
+        this.__playerInfoRaw = undefined;
+        this.__entityTransform = undefined;
+        this.__entityTransformRaw = undefined;
+        this.__actorTransform = undefined;
+        this.__actorTransformRaw = undefined;
+        this.__actorState = undefined;
+        this.__actorStateRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Player} 
+     */
+    static acquire() {
+        const message = Player.__pool.pop();
+        if (message === undefined) return new Player();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Player} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Player instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Player.__pool.length < 64) {
+            Player.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__entityInfo) instanceof __PokeworldEntityComm_entity.EntityInfo) __PokeworldEntityComm_entity.EntityInfo.release(value);
+        if ((value = this.__actorInfo) instanceof __PokeworldEntityComm_entity.ActorInfo) __PokeworldEntityComm_entity.ActorInfo.release(value);
+        if ((value = this.__playerInfo) instanceof __PokeworldEntityComm_entity.PlayerInfo) __PokeworldEntityComm_entity.PlayerInfo.release(value);
+        if ((value = this.__entityTransform) instanceof __PokeworldEntityComm_entity.EntityTransform) __PokeworldEntityComm_entity.EntityTransform.release(value);
+        if ((value = this.__actorTransform) instanceof __PokeworldEntityComm_entity.ActorTransform) __PokeworldEntityComm_entity.ActorTransform.release(value);
+        if ((value = this.__actorState) instanceof __PokeworldEntityComm_entity.ActorState) __PokeworldEntityComm_entity.ActorState.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).entityInfo = this.entityInfo ?? null; break;
+                case 2: (full ??= {}).actorInfo = this.actorInfo ?? null; break;
+                case 4: (full ??= {}).playerInfo = this.playerInfo ?? null; break;
+                case 8: (full ??= {}).entityTransform = this.entityTransform ?? null; break;
+                case 16: (full ??= {}).actorTransform = this.actorTransform ?? null; break;
+                case 32: (full ??= {}).actorState = this.actorState ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.entityInfo) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).entityInfo = value;
+        if ((this.__dirty0 & 2) === 0 && (value = this.actorInfo) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorInfo = value;
+        if ((this.__dirty0 & 4) === 0 && (value = this.playerInfo) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).playerInfo = value;
+        if ((this.__dirty0 & 8) === 0 && (value = this.entityTransform) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).entityTransform = value;
+        if ((this.__dirty0 & 16) === 0 && (value = this.actorTransform) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorTransform = value;
+        if ((this.__dirty0 & 32) === 0 && (value = this.actorState) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorState = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Player} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.entityInfo) !== undefined) {
+                this.entityInfo = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.EntityInfo ? value.clone().commit() : new __PokeworldEntityComm_entity.EntityInfo().applyDelta({ f: value }));
+            }
+            if ((value = full.actorInfo) !== undefined) {
+                this.actorInfo = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.ActorInfo ? value.clone().commit() : new __PokeworldEntityComm_entity.ActorInfo().applyDelta({ f: value }));
+            }
+            if ((value = full.playerInfo) !== undefined) {
+                this.playerInfo = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.PlayerInfo ? value.clone().commit() : new __PokeworldEntityComm_entity.PlayerInfo().applyDelta({ f: value }));
+            }
+            if ((value = full.entityTransform) !== undefined) {
+                this.entityTransform = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.EntityTransform ? value.clone().commit() : new __PokeworldEntityComm_entity.EntityTransform().applyDelta({ f: value }));
+            }
+            if ((value = full.actorTransform) !== undefined) {
+                this.actorTransform = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.ActorTransform ? value.clone().commit() : new __PokeworldEntityComm_entity.ActorTransform().applyDelta({ f: value }));
+            }
+            if ((value = full.actorState) !== undefined) {
+                this.actorState = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.ActorState ? value.clone().commit() : new __PokeworldEntityComm_entity.ActorState().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.entityInfo) !== undefined) {
+                (this.entityInfo ?? (this.entityInfo = new __PokeworldEntityComm_entity.EntityInfo())).applyDelta(value);
+            }
+            if ((value = nested.actorInfo) !== undefined) {
+                (this.actorInfo ?? (this.actorInfo = new __PokeworldEntityComm_entity.ActorInfo())).applyDelta(value);
+            }
+            if ((value = nested.playerInfo) !== undefined) {
+                (this.playerInfo ?? (this.playerInfo = new __PokeworldEntityComm_entity.PlayerInfo())).applyDelta(value);
+            }
+            if ((value = nested.entityTransform) !== undefined) {
+                (this.entityTransform ?? (this.entityTransform = new __PokeworldEntityComm_entity.EntityTransform())).applyDelta(value);
+            }
+            if ((value = nested.actorTransform) !== undefined) {
+                (this.actorTransform ?? (this.actorTransform = new __PokeworldEntityComm_entity.ActorTransform())).applyDelta(value);
+            }
+            if ((value = nested.actorState) !== undefined) {
+                (this.actorState ?? (this.actorState = new __PokeworldEntityComm_entity.ActorState())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Player} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.entityInfo)) value.commit();
+        if ((value = this.actorInfo)) value.commit();
+        if ((value = this.playerInfo)) value.commit();
+        if ((value = this.entityTransform)) value.commit();
+        if ((value = this.actorTransform)) value.commit();
+        if ((value = this.actorState)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.entityInfo = this.__entityInfoRaw ?? this.__entityInfo; break;
+                case 2: json.actorInfo = this.__actorInfoRaw ?? this.__actorInfo; break;
+                case 4: json.playerInfo = this.__playerInfoRaw ?? this.__playerInfo; break;
+                case 8: json.entityTransform = this.__entityTransformRaw ?? this.__entityTransform; break;
+                case 16: json.actorTransform = this.__actorTransformRaw ?? this.__actorTransform; break;
+                case 32: json.actorState = this.__actorStateRaw ?? this.__actorState; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Player.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.entityInfo;
+        if (value != null && (error = __PokeworldEntityComm_entity.EntityInfo.validate(value)) !== null) return __prefixError(error, "entityInfo");
+        value = json.actorInfo;
+        if (value != null && (error = __PokeworldEntityComm_entity.ActorInfo.validate(value)) !== null) return __prefixError(error, "actorInfo");
+        value = json.playerInfo;
+        if (value != null && (error = __PokeworldEntityComm_entity.PlayerInfo.validate(value)) !== null) return __prefixError(error, "playerInfo");
+        value = json.entityTransform;
+        if (value != null && (error = __PokeworldEntityComm_entity.EntityTransform.validate(value)) !== null) return __prefixError(error, "entityTransform");
+        value = json.actorTransform;
+        if (value != null && (error = __PokeworldEntityComm_entity.ActorTransform.validate(value)) !== null) return __prefixError(error, "actorTransform");
+        value = json.actorState;
+        if (value != null && (error = __PokeworldEntityComm_entity.ActorState.validate(value)) !== null) return __prefixError(error, "actorState");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Player}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Player.acquire();
+        try {
+            let value;
+            value = json.entityInfo;
+            if (value != null) {
+                message.entityInfo = __decodeNested(__PokeworldEntityComm_entity.EntityInfo, value, "entityInfo");
+            }
+            value = json.actorInfo;
+            if (value != null) {
+                message.actorInfo = __decodeNested(__PokeworldEntityComm_entity.ActorInfo, value, "actorInfo");
+            }
+            value = json.playerInfo;
+            if (value != null) {
+                message.playerInfo = __decodeNested(__PokeworldEntityComm_entity.PlayerInfo, value, "playerInfo");
+            }
+            value = json.entityTransform;
+            if (value != null) {
+                message.entityTransform = __decodeNested(__PokeworldEntityComm_entity.EntityTransform, value, "entityTransform");
+            }
+            value = json.actorTransform;
+            if (value != null) {
+                message.actorTransform = __decodeNested(__PokeworldEntityComm_entity.ActorTransform, value, "actorTransform");
+            }
+            value = json.actorState;
+            if (value != null) {
+                message.actorState = __decodeNested(__PokeworldEntityComm_entity.ActorState, value, "actorState");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Player.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class PlayerView {
+        static __layout = {
+            size: 24,
+            hash: 0x95e12ed6,
+            presence: 0,
+            fields: [
+                {name: "entityInfo", type: "TYPE_MESSAGE", offset: 0, get view() { return __PokeworldEntityComm_entity.EntityInfo.View; }},
+                {name: "actorInfo", type: "TYPE_MESSAGE", offset: 4, get view() { return __PokeworldEntityComm_entity.ActorInfo.View; }},
+                {name: "playerInfo", type: "TYPE_MESSAGE", offset: 8, get view() { return __PokeworldEntityComm_entity.PlayerInfo.View; }},
+                {name: "entityTransform", type: "TYPE_MESSAGE", offset: 12, get view() { return __PokeworldEntityComm_entity.EntityTransform.View; }},
+                {name: "actorTransform", type: "TYPE_MESSAGE", offset: 16, get view() { return __PokeworldEntityComm_entity.ActorTransform.View; }},
+                {name: "actorState", type: "TYPE_MESSAGE", offset: 20, get view() { return __PokeworldEntityComm_entity.ActorState.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, PlayerView.__layout.hash);
+            return new PlayerView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get entityInfo() {
+            return __flatMessage(this.__view, this.__offset + 0, __PokeworldEntityComm_entity.EntityInfo.View);
+        }
+
+        hasEntityInfo() {
+            return this.entityInfo !== undefined;
+        }
+
+        get actorInfo() {
+            return __flatMessage(this.__view, this.__offset + 4, __PokeworldEntityComm_entity.ActorInfo.View);
+        }
+
+        hasActorInfo() {
+            return this.actorInfo !== undefined;
+        }
+
+        get playerInfo() {
+            return __flatMessage(this.__view, this.__offset + 8, __PokeworldEntityComm_entity.PlayerInfo.View);
+        }
+
+        hasPlayerInfo() {
+            return this.playerInfo !== undefined;
+        }
+
+        get entityTransform() {
+            return __flatMessage(this.__view, this.__offset + 12, __PokeworldEntityComm_entity.EntityTransform.View);
+        }
+
+        hasEntityTransform() {
+            return this.entityTransform !== undefined;
+        }
+
+        get actorTransform() {
+            return __flatMessage(this.__view, this.__offset + 16, __PokeworldEntityComm_entity.ActorTransform.View);
+        }
+
+        hasActorTransform() {
+            return this.actorTransform !== undefined;
+        }
+
+        get actorState() {
+            return __flatMessage(this.__view, this.__offset + 20, __PokeworldEntityComm_entity.ActorState.View);
+        }
+
+        hasActorState() {
+            return this.actorState !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class PlayerColumns extends __ColumnTable {
+        static Row = class PlayerRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get entityInfo() {
+                return this.__table.columns.entityInfo[this.__index];
+            }
+
+            get actorInfo() {
+                return this.__table.columns.actorInfo[this.__index];
+            }
+
+            get playerInfo() {
+                return this.__table.columns.playerInfo[this.__index];
+            }
+
+            get entityTransform() {
+                return this.__table.columns.entityTransform[this.__index];
+            }
+
+            get actorTransform() {
+                return this.__table.columns.actorTransform[this.__index];
+            }
+
+            get actorState() {
+                return this.__table.columns.actorState[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                entityInfo: new Array(length),
+                actorInfo: new Array(length),
+                playerInfo: new Array(length),
+                entityTransform: new Array(length),
+                actorTransform: new Array(length),
+                actorState: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new PlayerColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.entityInfo[i] = row.entityInfo;
+                columns.actorInfo[i] = row.actorInfo;
+                columns.playerInfo[i] = row.playerInfo;
+                columns.entityTransform[i] = row.entityTransform;
+                columns.actorTransform[i] = row.actorTransform;
+                columns.actorState[i] = row.actorState;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: __GetPlayersResponse_Result
+class __GetPlayersResponse_Result {
+    static __descriptor = {
+        name: "Result",
+        get clrType() { return __GetPlayersResponse_Result; },
+        fullName: "pokeworld.player.cs.GetPlayersResponse.Result",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"},
+            {name: "entityId", number: 2, type: "TYPE_UINT64", int64: "hybrid", label: "LABEL_OPTIONAL"},
+            {name: "player", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.player.cs.Player", get clrType() { return Player; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__success = false;
+        this.__entityId = 0;
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __success = undefined;
+
     /** @type {boolean} */
-    success;
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
 
     /** 
      * @param {boolean} value 
-     * @return {JoinGameResponse} 
+     * @return {__GetPlayersResponse_Result} 
      */
     withSuccess(value) {
         this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
-}
+    __entityId = undefined;
 
-// Message: GetPlayersRequest
-export class GetPlayersRequest {
-    static __descriptor = {
-        name: "GetPlayersRequest",
-        get clrType() { return GetPlayersRequest; },
-        fullName: "pokeworld.player.cs.GetPlayersRequest",
-        package: "pokeworld.player.cs",
-        fields: [
-            {name: "entityIds", number: 1, type: "TYPE_UINT64", label: "LABEL_REPEATED"}
-        ]
+    /** @type {(number|bigint)} */
+    get entityId() {
+        return this.__entityId;
+    }
+    set entityId(value) {
+        this.__rawStale = true;
+        this.__entityId = value;
     }
-
-    /** @type {number[]} */
-    entityIds;
 
     /** 
-     * @param {number[]} value 
-     * @return {GetPlayersRequest} 
+     * @param {(number|bigint)} value 
+     * @return {__GetPlayersResponse_Result} 
      */
-    withEntityIds(value) {
-        this.entityIds = value;
+    withEntityId(value) {
+        this.entityId = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
-}
+    __player = undefined;
+    __playerRaw = undefined;
 
-// Message: Player
-export class Player {
-    static __descriptor = {
-        name: "Player",
-        get clrType() { return Player; },
-        fullName: "pokeworld.player.cs.Player",
-        package: "pokeworld.player.cs",
-        fields: [
-            {name: "entityInfo", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityInfo", get clrType() { return __PokeworldEntityComm_entity.EntityInfo; },label: "LABEL_OPTIONAL"},
-            {name: "actorInfo", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorInfo", get clrType() { return __PokeworldEntityComm_entity.ActorInfo; },label: "LABEL_OPTIONAL"},
-            {name: "playerInfo", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.PlayerInfo", get clrType() { return __PokeworldEntityComm_entity.PlayerInfo; },label: "LABEL_OPTIONAL"},
-            {name: "entityTransform", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityTransform", get clrType() { return __PokeworldEntityComm_entity.EntityTransform; },label: "LABEL_OPTIONAL"},
-            {name: "actorTransform", number: 5, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorTransform", get clrType() { return __PokeworldEntityComm_entity.ActorTransform; },label: "LABEL_OPTIONAL"},
-            {name: "actorState", number: 6, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorState", get clrType() { return __PokeworldEntityComm_entity.ActorState; },label: "LABEL_OPTIONAL"}
-        ]
+    /** @type {Player|undefined} */
+    get player() {
+        if (this.__playerRaw !== undefined) {
+            this.__player = this.__decode(__GetPlayersResponse_Result.__descriptor.fields[2], this.__playerRaw, this.__player);
+            this.__playerRaw = undefined;
+        }
+        return this.__player;
+    }
+    set player(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__playerRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__player = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__player = value;
+            this.__has0 |= 1;
+        }
     }
 
-    /** @type {__PokeworldEntityComm_entity.EntityInfo} */
-    entityInfo;
+    /** 
+     * @return {boolean} 
+     */
+    hasPlayer() {
+        return (this.__has0 & 1) !== 0;
+    }
 
     /** 
-     * @param {__PokeworldEntityComm_entity.EntityInfo} value 
-     * @return {Player} 
+     * @return {__GetPlayersResponse_Result} 
      */
-    withEntityInfo(value) {
-        this.entityInfo = value;
+    clearPlayer() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__player = undefined;
+        this.__playerRaw = undefined;
+        this.__has0 &= ~1;
         return this;
     }
 
-    /** @type {__PokeworldEntityComm_entity.ActorInfo} */
-    actorInfo;
-
     /** 
-     * @param {__PokeworldEntityComm_entity.ActorInfo} value 
-     * @return {Player} 
+     * @param {Player} value 
+     * @return {__GetPlayersResponse_Result} 
      */
-    withActorInfo(value) {
-        this.actorInfo = value;
+    withPlayer(value) {
+        this.player = value;
         return this;
     }
 
-    /** @type {__PokeworldEntityComm_entity.PlayerInfo} */
-    playerInfo;
+    __decode = undefined;
 
     /** 
-     * @param {__PokeworldEntityComm_entity.PlayerInfo} value 
-     * @return {Player} 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
      */
-    withPlayerInfo(value) {
-        this.playerInfo = value;
-        return this;
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 3:
+                this.__dirty0 |= 4;
+                this.__player = undefined;
+                this.__playerRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
     }
 
-    /** @type {__PokeworldEntityComm_entity.EntityTransform} */
-    entityTransform;
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success", "entityId", "player"]);
 
     /** 
-     * @param {__PokeworldEntityComm_entity.EntityTransform} value 
-     * @return {Player} 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
      */
-    withEntityTransform(value) {
-        this.entityTransform = value;
-        return this;
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-    /** @type {__PokeworldEntityComm_entity.ActorTransform} */
-    actorTransform;
-
     /** 
-     * @param {__PokeworldEntityComm_entity.ActorTransform} value 
-     * @return {Player} 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
      */
-    withActorTransform(value) {
-        this.actorTransform = value;
-        return this;
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__player) != null && !value.__isPristine()) return false;
+        return true;
     }
 
-    /** @type {__PokeworldEntityComm_entity.ActorState} */
-    actorState;
+    /** 
+     * @return {__GetPlayersResponse_Result} a deep copy of this message
+     */
+    clone() {
+        return new __GetPlayersResponse_Result().copyFrom(this);
+    }
 
     /** 
-     * @param {__PokeworldEntityComm_entity.ActorState} value 
-     * @return {Player} 
+     * Deep copy all fields from another message of the same type
+     * @param {__GetPlayersResponse_Result} other 
+     * @return {__GetPlayersResponse_Result} 
      */
-    withActorState(value) {
-        this.actorState = value;
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        this.entityId = other.entityId;
+        this.player = __cloneMessage(other.player);
         return this;
     }
 
-}
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {__GetPlayersResponse_Result} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof __GetPlayersResponse_Result)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        if ((this.entityId ?? 0) !== (other.entityId ?? 0)) return false;
+        if (!__equalsMessage(this.player, other.player)) return false;
+        return true;
+    }
 
-class __GetPlayersResponse_Result {
-    static __descriptor = {
-        name: "Result",
-        get clrType() { return __GetPlayersResponse_Result; },
-        fullName: "pokeworld.player.cs.GetPlayersResponse.Result",
-        fields: [
-            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"},
-            {name: "entityId", number: 2, type: "TYPE_UINT64", label: "LABEL_OPTIONAL"},
-            {name: "player", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.player.cs.Player", get clrType() { return Player; },label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        hash = __hashInt64(hash, this.entityId ?? 0);
+        hash = __hashMessage(hash, this.player);
+        return hash;
     }
 
-    constructor() {
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {__GetPlayersResponse_Result} 
+     */
+    clear() {
         this.success = false;
         this.entityId = 0;
-        this.player = null;
+        this.__player = undefined;
+        this.__playerRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
     }
 
-    /** @type {boolean} */
-    success;
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {boolean} value 
+     * Take an instance from the free list, or allocate one if it is empty
      * @return {__GetPlayersResponse_Result} 
      */
-    withSuccess(value) {
-        this.success = value;
-        return this;
+    static acquire() {
+        const message = __GetPlayersResponse_Result.__pool.pop();
+        if (message === undefined) return new __GetPlayersResponse_Result();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {__GetPlayersResponse_Result} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('__GetPlayersResponse_Result instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (__GetPlayersResponse_Result.__pool.length < 64) {
+            __GetPlayersResponse_Result.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__player) instanceof Player) Player.release(value);
     }
 
-    /** @type {number} */
-    entityId;
+    // Dirty field bitmask
+    __dirty0 = 0;
 
     /** 
-     * @param {number} value 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+                case 2: (full ??= {}).entityId = __encodeInt64(this.entityId); break;
+                case 4: (full ??= {}).player = this.player ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 4) === 0 && (value = this.player) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).player = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
      * @return {__GetPlayersResponse_Result} 
      */
-    withEntityId(value) {
-        this.entityId = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+            if ((value = full.entityId) !== undefined) {
+                this.entityId = value === null ? undefined : __decodeInt64(value);
+            }
+            if ((value = full.player) !== undefined) {
+                this.player = value === null ? undefined : (value instanceof Player ? value.clone().commit() : new Player().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.player) !== undefined) {
+                (this.player ?? (this.player = new Player())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {Player} */
-    player;
-
     /** 
-     * @param {Player} value 
+     * Mark the current state as synchronized
      * @return {__GetPlayersResponse_Result} 
      */
-    withPlayer(value) {
-        this.player = value;
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.player)) value.commit();
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+            entityId: __encodeInt64(this.entityId),
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.player = this.__playerRaw ?? this.__player; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, __GetPlayersResponse_Result.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        value = json.entityId;
+        if (value != null && !__isUint64(value)) return __invalid("entityId", "uint64");
+        value = json.player;
+        if (value != null && (error = Player.validate(value)) !== null) return __prefixError(error, "player");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {__GetPlayersResponse_Result}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = __GetPlayersResponse_Result.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            value = json.entityId;
+            if (value != null) {
+                if (!__isUint64(value)) throw __invalid("entityId", "uint64");
+                message.entityId = __decodeInt64(value);
+            }
+            value = json.player;
+            if (value != null) {
+                message.player = __decodeNested(Player, value, "player");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            __GetPlayersResponse_Result.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class __GetPlayersResponse_ResultView {
+        static __layout = {
+            size: 16,
+            hash: 0xd79558a0,
+            presence: 8,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 12},
+                {name: "entityId", type: "TYPE_UINT64", offset: 0},
+                {name: "player", type: "TYPE_MESSAGE", offset: 8, get view() { return Player.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, __GetPlayersResponse_ResultView.__layout.hash);
+            return new __GetPlayersResponse_ResultView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 12);
+        }
+
+        get entityId() {
+            return __flatUint64(this.__view, this.__offset + 0);
+        }
+
+        get player() {
+            return __flatMessage(this.__view, this.__offset + 8, Player.View);
+        }
+
+        hasPlayer() {
+            return this.player !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class __GetPlayersResponse_ResultColumns extends __ColumnTable {
+        static Row = class __GetPlayersResponse_ResultRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+
+            get entityId() {
+                return this.__table.columns.entityId[this.__index];
+            }
+
+            get player() {
+                return this.__table.columns.player[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+                entityId: new Array(length),
+                player: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new __GetPlayersResponse_ResultColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+                columns.entityId[i] = row.entityId;
+                columns.player[i] = row.player;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: GetPlayersResponse
@@ -264,13 +2875,34 @@ export class GetPlayersResponse {
         get clrType() { return GetPlayersResponse; },
         fullName: "pokeworld.player.cs.GetPlayersResponse",
         package: "pokeworld.player.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1007,
+        messageId: 1004,
         fields: [
-            {name: "results", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.player.cs.GetPlayersResponse.Result", get clrType() { return __GetPlayersResponse_Result; },label: "LABEL_REPEATED"}
+            {name: "results", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.player.cs.GetPlayersResponse.Result", get clrType() { return __GetPlayersResponse_Result; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
+    constructor() {
+        this.results = [];
+    }
+
+    __results = undefined;
+    __resultsRaw = undefined;
+
     /** @type {__GetPlayersResponse_Result[]} */
-    results;
+    get results() {
+        if (this.__resultsRaw !== undefined) {
+            this.__results = this.__decode(GetPlayersResponse.__descriptor.fields[0], this.__resultsRaw, this.__results);
+            this.__resultsRaw = undefined;
+        }
+        return this.__results;
+    }
+    set results(value) {
+        this.__rawStale = true;
+        this.__resultsRaw = undefined;
+        this.__results = value;
+    }
 
     /** 
      * @param {__GetPlayersResponse_Result[]} value 
@@ -278,9 +2910,391 @@ export class GetPlayersResponse {
      */
     withResults(value) {
         this.results = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__resultsRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["results"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__results) != null) {
+            raw = this.__raw.results;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {GetPlayersResponse} a deep copy of this message
+     */
+    clone() {
+        return new GetPlayersResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {GetPlayersResponse} other 
+     * @return {GetPlayersResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.results = __cloneArray(other.results, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {GetPlayersResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof GetPlayersResponse)) return false;
+        if (!__equalsArray(this.results, other.results, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.results, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {GetPlayersResponse} 
+     */
+    clear() {
+        this.__resultsRaw = undefined;
+        if (Array.isArray(this.results)) this.results.length = 0; else this.results = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {GetPlayersResponse} 
+     */
+    static acquire() {
+        const message = GetPlayersResponse.__pool.pop();
+        if (message === undefined) return new GetPlayersResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {GetPlayersResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('GetPlayersResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (GetPlayersResponse.__pool.length < 64) {
+            GetPlayersResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__results)) {
+            for (const item of this.__results) {
+                if (item instanceof __GetPlayersResponse_Result) __GetPlayersResponse_Result.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).results = this.results; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.results)) {
+            const list = this.results;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).results = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {GetPlayersResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.results) !== undefined) {
+                this.results = value === null ? [] : value.map(item => (item instanceof __GetPlayersResponse_Result ? item.clone().commit() : new __GetPlayersResponse_Result().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.results) !== undefined) {
+                const list = this.results;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {GetPlayersResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.results)) {
+            for (const item of this.results) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            results: this.__resultsRaw ?? this.__results,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, GetPlayersResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.results;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("results", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = __GetPlayersResponse_Result.validate(item)) !== null) return __prefixError(error, "results", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {GetPlayersResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = GetPlayersResponse.acquire();
+        try {
+            let value;
+            value = json.results;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("results", "array");
+                const list = new Array(value.length);
+                message.results = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(__GetPlayersResponse_Result, item, "results", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            GetPlayersResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class GetPlayersResponseView {
+        static __layout = {
+            size: 8,
+            hash: 0xe74ed6ea,
+            presence: 8,
+            fields: [
+                {name: "results", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return __GetPlayersResponse_Result.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, GetPlayersResponseView.__layout.hash);
+            return new GetPlayersResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get results() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, __GetPlayersResponse_Result.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class GetPlayersResponseColumns extends __ColumnTable {
+        static Row = class GetPlayersResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get results() {
+                return this.__table.columns.results[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                results: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new GetPlayersResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.results[i] = row.results;
+            }
+            return table;
+        }
+    };
+
     static Result = __GetPlayersResponse_Result;
 }
 
+// Client stub: request/response pairs of the module's message ids
+export class PlayerClient {
+    static __calls = [
+        {name: "start", get requestType() { return JoinGameRequest; }, get responseType() { return JoinGameResponse; }},
+        {name: "getPlayer", get requestType() { return GetPlayersRequest; }, get responseType() { return GetPlayersResponse; }},
+    ];
+
+    /**
+     * @param {{call: function(Object, Function, Object=): Promise<Object>, send: function(Object): void}} channel
+     *     RpcChannel of proto-rpc.mjs, or any object with the same call/send methods
+     */
+    constructor(channel) {
+        this.channel = channel;
+    }
+
+    /**
+     * @param {JoinGameRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<JoinGameResponse>}
+     */
+    start(request, options) {
+        return this.channel.call(request, JoinGameResponse, options);
+    }
+
+    /**
+     * @param {GetPlayersRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<GetPlayersResponse>}
+     */
+    getPlayer(request, options) {
+        return this.channel.call(request, GetPlayersResponse, options);
+    }
+}
+
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/player/cs_player.proto",
+    dependencies: ["google/protobuf/descriptor.proto", "pokeworld/module/module_id.proto", "pokeworld/entity/comm_entity.proto"],
+    data: "CiBwb2tld29ybGQvcGxheWVyL2NzX3BsYXllci5wcm90bxITcG9rZXdvcmxkLnBsYXllci5jcxogZ29vZ2xlL3Byb3RvYnVmL2Rlc2NyaXB0b3IucHJvdG8aIHBva2V3b3JsZC9tb2R1bGUvbW9kdWxlX2lkLnByb3RvGiJwb2tld29ybGQvZW50aXR5L2NvbW1fZW50aXR5LnByb3RvIjYKD0pvaW5HYW1lUmVxdWVzdBIbCgllbnRpdHlfaWQYASABKARSCGVudGl0eUlkOgaQ58dM6QciNAoQSm9pbkdhbWVSZXNwb25zZRIYCgdzdWNjZXNzGAEgASgIUgdzdWNjZXNzOgaQ58dM6gciOgoRR2V0UGxheWVyc1JlcXVlc3QSHQoKZW50aXR5X2lkcxgBIAMoBFIJZW50aXR5SWRzOgaQ58dM6wciuAMKBlBsYXllchJCCgtlbnRpdHlfaW5mbxgBIAEoCzIhLnBva2V3b3JsZC5lbnRpdHkuY29tbS5FbnRpdHlJbmZvUgplbnRpdHlJbmZvEj8KCmFjdG9yX2luZm8YAiABKAsyIC5wb2tld29ybGQuZW50aXR5LmNvbW0uQWN0b3JJbmZvUglhY3RvckluZm8SQgoLcGxheWVyX2luZm8YAyABKAsyIS5wb2tld29ybGQuZW50aXR5LmNvbW0uUGxheWVySW5mb1IKcGxheWVySW5mbxJRChBlbnRpdHlfdHJhbnNmb3JtGAQgASgLMiYucG9rZXdvcmxkLmVudGl0eS5jb21tLkVudGl0eVRyYW5zZm9ybVIPZW50aXR5VHJhbnNmb3JtEk4KD2FjdG9yX3RyYW5zZm9ybRgFIAEoCzIlLnBva2V3b3JsZC5lbnRpdHkuY29tbS5BY3RvclRyYW5zZm9ybVIOYWN0b3JUcmFuc2Zvcm0SQgoLYWN0b3Jfc3RhdGUYBiABKAsyIS5wb2tld29ybGQuZW50aXR5LmNvbW0uQWN0b3JTdGF0ZVIKYWN0b3JTdGF0ZSLcAQoSR2V0UGxheWVyc1Jlc3BvbnNlEkgKB3Jlc3VsdHMYASADKAsyLi5wb2tld29ybGQucGxheWVyLmNzLkdldFBsYXllcnNSZXNwb25zZS5SZXN1bHRSB3Jlc3VsdHMadAoGUmVzdWx0EhgKB3N1Y2Nlc3MYASABKAhSB3N1Y2Nlc3MSGwoJZW50aXR5X2lkGAIgASgEUghlbnRpdHlJZBIzCgZwbGF5ZXIYAyABKAsyGy5wb2tld29ybGQucGxheWVyLmNzLlBsYXllclIGcGxheWVyOgaQ58dM7AcqswEKCU1lc3NhZ2VJZBIWChJNRVNTQUdFX0lEX0lOVkFMSUQQABIdChhNRVNTQUdFX0lEX1NUQVJUX1JFUVVFU1QQ6QcSHgoZTUVTU0FHRV9JRF9TVEFSVF9SRVNQT05TRRDqBxIiCh1NRVNTQUdFX0lEX0dFVF9QTEFZRVJfUkVRVUVTVBDrBxIjCh5NRVNTQUdFX0lEX0dFVF9QTEFZRVJfUkVTUE9OU0UQ7AcaBojQpUzvBzphCgptZXNzYWdlX2lkEh8uZ29vZ2xlLnByb3RvYnVmLk1lc3NhZ2VPcHRpb25zGPL8yAkgASgOMh4ucG9rZXdvcmxkLnBsYXllci5jcy5NZXNzYWdlSWRSCW1lc3NhZ2VJZGIGcHJvdG8z",
+};
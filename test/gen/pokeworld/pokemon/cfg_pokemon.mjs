@@ -5,6 +5,426 @@
 
 import * as __PokeworldResourceCfg_resource from '../resource/cfg_resource.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: MoveCategory
 export const MoveCategory = {
     PHYSICAL: 0,
@@ -17,11 +437,13 @@ Object.defineProperty(MoveCategory, "__descriptor", {
         get clrType() { return MoveCategory; },
         fullName: "pokeworld.pokemon.cfg.MoveCategory",
         package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "PHYSICAL", originalName: "MOVECATEGORY_PHYSICAL", number: 0},
             {name: "SPECIAL", originalName: "MOVECATEGORY_SPECIAL", number: 1},
             {name: "STATUS", originalName: "MOVECATEGORY_STATUS", number: 2}
-        ]
+        ],
+        valueIndex: [0, 1, 2]
     },
     enumerable: false,
     writable: false,
@@ -56,6 +478,7 @@ Object.defineProperty(PokeType, "__descriptor", {
         get clrType() { return PokeType; },
         fullName: "pokeworld.pokemon.cfg.PokeType",
         package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "NORMAL", originalName: "POKETYPE_NORMAL", number: 0},
             {name: "FLYING", originalName: "POKETYPE_FLYING", number: 1},
@@ -76,7 +499,8 @@ Object.defineProperty(PokeType, "__descriptor", {
             {name: "GROUND", originalName: "POKETYPE_GROUND", number: 16},
             {name: "FAIRY", originalName: "POKETYPE_FAIRY", number: 17},
             {name: "UNKNOWN", originalName: "POKETYPE_UNKNOWN", number: 18}
-        ]
+        ],
+        valueIndex: [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18]
     },
     enumerable: false,
     writable: false,
@@ -90,6 +514,7 @@ export class Move {
         get clrType() { return Move; },
         fullName: "pokeworld.pokemon.cfg.Move",
         package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
             {name: "num", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
@@ -115,8 +540,40 @@ export class Move {
         ]
     }
 
+    constructor() {
+        this.__id = 0;
+        this.__num = 0;
+        this.__name = "";
+        this.__gen = 0;
+        this.__basePower = 0;
+        this.__pp = 0;
+        this.__type = PokeType.NORMAL;
+        this.__category = MoveCategory.PHYSICAL;
+        this.__target = "";
+        this.__accuracy = 0;
+        this.__critRatio = 0;
+        this.__secondaries = "";
+        this.__priority = 0;
+        this.__ignoreOffensive = "";
+        this.__ignoreDefensive = "";
+        this.__ignoreImmunity = "";
+        this.__ignoreEvasion = "";
+        this.__hasSheerForce = false;
+        this.__noPpBoosts = false;
+        this.__ignoreAbility = false;
+        this.__zMove = "";
+    }
+
+    __id = undefined;
+
     /** @type {number} */
-    id;
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
     /** 
      * @param {number} value 
@@ -124,11 +581,21 @@ export class Move {
      */
     withId(value) {
         this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __num = undefined;
+
     /** @type {number} */
-    num;
+    get num() {
+        return this.__num;
+    }
+    set num(value) {
+        this.__rawStale = true;
+        this.__num = value;
+    }
 
     /** 
      * @param {number} value 
@@ -136,11 +603,21 @@ export class Move {
      */
     withNum(value) {
         this.num = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
+    __name = undefined;
+
     /** @type {string} */
-    name;
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
 
     /** 
      * @param {string} value 
@@ -148,11 +625,21 @@ export class Move {
      */
     withName(value) {
         this.name = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
+    __gen = undefined;
+
     /** @type {number} */
-    gen;
+    get gen() {
+        return this.__gen;
+    }
+    set gen(value) {
+        this.__rawStale = true;
+        this.__gen = value;
+    }
 
     /** 
      * @param {number} value 
@@ -160,11 +647,21 @@ export class Move {
      */
     withGen(value) {
         this.gen = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
         return this;
     }
 
+    __basePower = undefined;
+
     /** @type {number} */
-    basePower;
+    get basePower() {
+        return this.__basePower;
+    }
+    set basePower(value) {
+        this.__rawStale = true;
+        this.__basePower = value;
+    }
 
     /** 
      * @param {number} value 
@@ -172,11 +669,21 @@ export class Move {
      */
     withBasePower(value) {
         this.basePower = value;
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
         return this;
     }
 
+    __pp = undefined;
+
     /** @type {number} */
-    pp;
+    get pp() {
+        return this.__pp;
+    }
+    set pp(value) {
+        this.__rawStale = true;
+        this.__pp = value;
+    }
 
     /** 
      * @param {number} value 
@@ -184,11 +691,21 @@ export class Move {
      */
     withPp(value) {
         this.pp = value;
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
         return this;
     }
 
+    __type = undefined;
+
     /** @type {PokeType[keyof typeof PokeType]} */
-    type;
+    get type() {
+        return this.__type;
+    }
+    set type(value) {
+        this.__rawStale = true;
+        this.__type = value;
+    }
 
     /** 
      * @param {PokeType[keyof typeof PokeType]} value 
@@ -196,11 +713,21 @@ export class Move {
      */
     withType(value) {
         this.type = value;
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
         return this;
     }
 
+    __category = undefined;
+
     /** @type {MoveCategory[keyof typeof MoveCategory]} */
-    category;
+    get category() {
+        return this.__category;
+    }
+    set category(value) {
+        this.__rawStale = true;
+        this.__category = value;
+    }
 
     /** 
      * @param {MoveCategory[keyof typeof MoveCategory]} value 
@@ -208,11 +735,21 @@ export class Move {
      */
     withCategory(value) {
         this.category = value;
+        this.__dirty0 |= 128;
+        this.__rawStale = true;
         return this;
     }
 
+    __target = undefined;
+
     /** @type {string} */
-    target;
+    get target() {
+        return this.__target;
+    }
+    set target(value) {
+        this.__rawStale = true;
+        this.__target = value;
+    }
 
     /** 
      * @param {string} value 
@@ -220,11 +757,21 @@ export class Move {
      */
     withTarget(value) {
         this.target = value;
+        this.__dirty0 |= 256;
+        this.__rawStale = true;
         return this;
     }
 
+    __accuracy = undefined;
+
     /** @type {number} */
-    accuracy;
+    get accuracy() {
+        return this.__accuracy;
+    }
+    set accuracy(value) {
+        this.__rawStale = true;
+        this.__accuracy = value;
+    }
 
     /** 
      * @param {number} value 
@@ -232,11 +779,21 @@ export class Move {
      */
     withAccuracy(value) {
         this.accuracy = value;
+        this.__dirty0 |= 512;
+        this.__rawStale = true;
         return this;
     }
 
+    __critRatio = undefined;
+
     /** @type {number} */
-    critRatio;
+    get critRatio() {
+        return this.__critRatio;
+    }
+    set critRatio(value) {
+        this.__rawStale = true;
+        this.__critRatio = value;
+    }
 
     /** 
      * @param {number} value 
@@ -244,11 +801,21 @@ export class Move {
      */
     withCritRatio(value) {
         this.critRatio = value;
+        this.__dirty0 |= 1024;
+        this.__rawStale = true;
         return this;
     }
 
+    __secondaries = undefined;
+
     /** @type {string} */
-    secondaries;
+    get secondaries() {
+        return this.__secondaries;
+    }
+    set secondaries(value) {
+        this.__rawStale = true;
+        this.__secondaries = value;
+    }
 
     /** 
      * @param {string} value 
@@ -256,11 +823,21 @@ export class Move {
      */
     withSecondaries(value) {
         this.secondaries = value;
+        this.__dirty0 |= 2048;
+        this.__rawStale = true;
         return this;
     }
 
+    __priority = undefined;
+
     /** @type {number} */
-    priority;
+    get priority() {
+        return this.__priority;
+    }
+    set priority(value) {
+        this.__rawStale = true;
+        this.__priority = value;
+    }
 
     /** 
      * @param {number} value 
@@ -268,11 +845,21 @@ export class Move {
      */
     withPriority(value) {
         this.priority = value;
+        this.__dirty0 |= 4096;
+        this.__rawStale = true;
         return this;
     }
 
+    __ignoreOffensive = undefined;
+
     /** @type {string} */
-    ignoreOffensive;
+    get ignoreOffensive() {
+        return this.__ignoreOffensive;
+    }
+    set ignoreOffensive(value) {
+        this.__rawStale = true;
+        this.__ignoreOffensive = value;
+    }
 
     /** 
      * @param {string} value 
@@ -280,11 +867,21 @@ export class Move {
      */
     withIgnoreOffensive(value) {
         this.ignoreOffensive = value;
+        this.__dirty0 |= 8192;
+        this.__rawStale = true;
         return this;
     }
 
+    __ignoreDefensive = undefined;
+
     /** @type {string} */
-    ignoreDefensive;
+    get ignoreDefensive() {
+        return this.__ignoreDefensive;
+    }
+    set ignoreDefensive(value) {
+        this.__rawStale = true;
+        this.__ignoreDefensive = value;
+    }
 
     /** 
      * @param {string} value 
@@ -292,11 +889,21 @@ export class Move {
      */
     withIgnoreDefensive(value) {
         this.ignoreDefensive = value;
+        this.__dirty0 |= 16384;
+        this.__rawStale = true;
         return this;
     }
 
+    __ignoreImmunity = undefined;
+
     /** @type {string} */
-    ignoreImmunity;
+    get ignoreImmunity() {
+        return this.__ignoreImmunity;
+    }
+    set ignoreImmunity(value) {
+        this.__rawStale = true;
+        this.__ignoreImmunity = value;
+    }
 
     /** 
      * @param {string} value 
@@ -304,11 +911,21 @@ export class Move {
      */
     withIgnoreImmunity(value) {
         this.ignoreImmunity = value;
+        this.__dirty0 |= 32768;
+        this.__rawStale = true;
         return this;
     }
 
+    __ignoreEvasion = undefined;
+
     /** @type {string} */
-    ignoreEvasion;
+    get ignoreEvasion() {
+        return this.__ignoreEvasion;
+    }
+    set ignoreEvasion(value) {
+        this.__rawStale = true;
+        this.__ignoreEvasion = value;
+    }
 
     /** 
      * @param {string} value 
@@ -316,11 +933,21 @@ export class Move {
      */
     withIgnoreEvasion(value) {
         this.ignoreEvasion = value;
+        this.__dirty0 |= 65536;
+        this.__rawStale = true;
         return this;
     }
 
+    __hasSheerForce = undefined;
+
     /** @type {boolean} */
-    hasSheerForce;
+    get hasSheerForce() {
+        return this.__hasSheerForce;
+    }
+    set hasSheerForce(value) {
+        this.__rawStale = true;
+        this.__hasSheerForce = value;
+    }
 
     /** 
      * @param {boolean} value 
@@ -328,11 +955,21 @@ export class Move {
      */
     withHasSheerForce(value) {
         this.hasSheerForce = value;
+        this.__dirty0 |= 131072;
+        this.__rawStale = true;
         return this;
     }
 
+    __noPpBoosts = undefined;
+
     /** @type {boolean} */
-    noPpBoosts;
+    get noPpBoosts() {
+        return this.__noPpBoosts;
+    }
+    set noPpBoosts(value) {
+        this.__rawStale = true;
+        this.__noPpBoosts = value;
+    }
 
     /** 
      * @param {boolean} value 
@@ -340,11 +977,21 @@ export class Move {
      */
     withNoPpBoosts(value) {
         this.noPpBoosts = value;
+        this.__dirty0 |= 262144;
+        this.__rawStale = true;
         return this;
     }
 
+    __ignoreAbility = undefined;
+
     /** @type {boolean} */
-    ignoreAbility;
+    get ignoreAbility() {
+        return this.__ignoreAbility;
+    }
+    set ignoreAbility(value) {
+        this.__rawStale = true;
+        this.__ignoreAbility = value;
+    }
 
     /** 
      * @param {boolean} value 
@@ -352,11 +999,21 @@ export class Move {
      */
     withIgnoreAbility(value) {
         this.ignoreAbility = value;
+        this.__dirty0 |= 524288;
+        this.__rawStale = true;
         return this;
     }
 
+    __zMove = undefined;
+
     /** @type {string} */
-    zMove;
+    get zMove() {
+        return this.__zMove;
+    }
+    set zMove(value) {
+        this.__rawStale = true;
+        this.__zMove = value;
+    }
 
     /** 
      * @param {string} value 
@@ -364,87 +1021,998 @@ export class Move {
      */
     withZMove(value) {
         this.zMove = value;
+        this.__dirty0 |= 1048576;
+        this.__rawStale = true;
         return this;
     }
 
-}
-
-// Message: Pokemon
-export class Pokemon {
-    static __descriptor = {
-        name: "Pokemon",
-        get clrType() { return Pokemon; },
-        fullName: "pokeworld.pokemon.cfg.Pokemon",
-        package: "pokeworld.pokemon.cfg",
-        fields: [
-            {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "num", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "name", number: 3, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "gen", number: 4, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "baseForme", number: 5, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "otherFormes", number: 6, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "abilities", number: 7, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "pokeTypes", number: 8, type: "TYPE_ENUM", typeName: ".pokeworld.pokemon.cfg.PokeType", get clrType() { return PokeType; },label: "LABEL_REPEATED"},
-            {name: "prevo", number: 9, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "evos", number: 10, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "evoLevel", number: 11, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "tier", number: 12, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "doublesTier", number: 13, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "natDexTier", number: 14, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "eggGroups", number: 15, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "canHatch", number: 16, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"},
-            {name: "genderRatio", number: 17, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "hp", number: 18, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "atk", number: 19, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "def", number: 20, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "spa", number: 21, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "spd", number: 22, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "spe", number: 23, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "weight", number: 24, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
-            {name: "height", number: 25, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
-            {name: "frontAtlasAssetAdress", number: 26, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.AssetAddress", get clrType() { return __PokeworldResourceCfg_resource.AssetAddress; },label: "LABEL_OPTIONAL"},
-            {name: "backAtlasAssetAdress", number: 27, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.AssetAddress", get clrType() { return __PokeworldResourceCfg_resource.AssetAddress; },label: "LABEL_OPTIONAL"}
-        ]
-    }
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
 
-    /** @type {number} */
-    id;
+    static __knownKeys = new Set(["id", "num", "name", "gen", "basePower", "pp", "type", "category", "target", "accuracy", "critRatio", "secondaries", "priority", "ignoreOffensive", "ignoreDefensive", "ignoreImmunity", "ignoreEvasion", "hasSheerForce", "noPpBoosts", "ignoreAbility", "zMove"]);
 
     /** 
-     * @param {number} value 
-     * @return {Pokemon} 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
      */
-    withId(value) {
-        this.id = value;
-        return this;
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-    /** @type {number} */
-    num;
-
     /** 
-     * @param {number} value 
-     * @return {Pokemon} 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
      */
-    withNum(value) {
-        this.num = value;
-        return this;
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
     }
 
-    /** @type {string} */
-    name;
-
     /** 
-     * @param {string} value 
+     * @return {Move} a deep copy of this message
+     */
+    clone() {
+        return new Move().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Move} other 
+     * @return {Move} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.num = other.num;
+        this.name = other.name;
+        this.gen = other.gen;
+        this.basePower = other.basePower;
+        this.pp = other.pp;
+        this.type = other.type;
+        this.category = other.category;
+        this.target = other.target;
+        this.accuracy = other.accuracy;
+        this.critRatio = other.critRatio;
+        this.secondaries = other.secondaries;
+        this.priority = other.priority;
+        this.ignoreOffensive = other.ignoreOffensive;
+        this.ignoreDefensive = other.ignoreDefensive;
+        this.ignoreImmunity = other.ignoreImmunity;
+        this.ignoreEvasion = other.ignoreEvasion;
+        this.hasSheerForce = other.hasSheerForce;
+        this.noPpBoosts = other.noPpBoosts;
+        this.ignoreAbility = other.ignoreAbility;
+        this.zMove = other.zMove;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Move} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Move)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.num ?? 0) !== (other.num ?? 0)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if ((this.gen ?? 0) !== (other.gen ?? 0)) return false;
+        if ((this.basePower ?? 0) !== (other.basePower ?? 0)) return false;
+        if ((this.pp ?? 0) !== (other.pp ?? 0)) return false;
+        if ((this.type ?? PokeType.NORMAL) !== (other.type ?? PokeType.NORMAL)) return false;
+        if ((this.category ?? MoveCategory.PHYSICAL) !== (other.category ?? MoveCategory.PHYSICAL)) return false;
+        if ((this.target ?? "") !== (other.target ?? "")) return false;
+        if ((this.accuracy ?? 0) !== (other.accuracy ?? 0)) return false;
+        if ((this.critRatio ?? 0) !== (other.critRatio ?? 0)) return false;
+        if ((this.secondaries ?? "") !== (other.secondaries ?? "")) return false;
+        if ((this.priority ?? 0) !== (other.priority ?? 0)) return false;
+        if ((this.ignoreOffensive ?? "") !== (other.ignoreOffensive ?? "")) return false;
+        if ((this.ignoreDefensive ?? "") !== (other.ignoreDefensive ?? "")) return false;
+        if ((this.ignoreImmunity ?? "") !== (other.ignoreImmunity ?? "")) return false;
+        if ((this.ignoreEvasion ?? "") !== (other.ignoreEvasion ?? "")) return false;
+        if ((this.hasSheerForce ?? false) !== (other.hasSheerForce ?? false)) return false;
+        if ((this.noPpBoosts ?? false) !== (other.noPpBoosts ?? false)) return false;
+        if ((this.ignoreAbility ?? false) !== (other.ignoreAbility ?? false)) return false;
+        if ((this.zMove ?? "") !== (other.zMove ?? "")) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashNumber(hash, this.num ?? 0);
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashNumber(hash, this.gen ?? 0);
+        hash = __hashNumber(hash, this.basePower ?? 0);
+        hash = __hashNumber(hash, this.pp ?? 0);
+        hash = __hashNumber(hash, this.type ?? PokeType.NORMAL);
+        hash = __hashNumber(hash, this.category ?? MoveCategory.PHYSICAL);
+        hash = __hashString(hash, this.target ?? "");
+        hash = __hashNumber(hash, this.accuracy ?? 0);
+        hash = __hashNumber(hash, this.critRatio ?? 0);
+        hash = __hashString(hash, this.secondaries ?? "");
+        hash = __hashNumber(hash, this.priority ?? 0);
+        hash = __hashString(hash, this.ignoreOffensive ?? "");
+        hash = __hashString(hash, this.ignoreDefensive ?? "");
+        hash = __hashString(hash, this.ignoreImmunity ?? "");
+        hash = __hashString(hash, this.ignoreEvasion ?? "");
+        hash = __hashBool(hash, this.hasSheerForce ?? false);
+        hash = __hashBool(hash, this.noPpBoosts ?? false);
+        hash = __hashBool(hash, this.ignoreAbility ?? false);
+        hash = __hashString(hash, this.zMove ?? "");
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Move} 
+     */
+    clear() {
+        this.id = 0;
+        this.num = 0;
+        this.name = "";
+        this.gen = 0;
+        this.basePower = 0;
+        this.pp = 0;
+        this.type = PokeType.NORMAL;
+        this.category = MoveCategory.PHYSICAL;
+        this.target = "";
+        this.accuracy = 0;
+        this.critRatio = 0;
+        this.secondaries = "";
+        this.priority = 0;
+        this.ignoreOffensive = "";
+        this.ignoreDefensive = "";
+        this.ignoreImmunity = "";
+        this.ignoreEvasion = "";
+        this.hasSheerForce = false;
+        this.noPpBoosts = false;
+        this.ignoreAbility = false;
+        this.zMove = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Move} 
+     */
+    static acquire() {
+        const message = Move.__pool.pop();
+        if (message === undefined) return new Move();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Move} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Move instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Move.__pool.length < 64) {
+            Move.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).num = this.num; break;
+                case 4: (full ??= {}).name = this.name; break;
+                case 8: (full ??= {}).gen = this.gen; break;
+                case 16: (full ??= {}).basePower = this.basePower; break;
+                case 32: (full ??= {}).pp = this.pp; break;
+                case 64: (full ??= {}).type = this.type; break;
+                case 128: (full ??= {}).category = this.category; break;
+                case 256: (full ??= {}).target = this.target; break;
+                case 512: (full ??= {}).accuracy = this.accuracy; break;
+                case 1024: (full ??= {}).critRatio = this.critRatio; break;
+                case 2048: (full ??= {}).secondaries = this.secondaries; break;
+                case 4096: (full ??= {}).priority = this.priority; break;
+                case 8192: (full ??= {}).ignoreOffensive = this.ignoreOffensive; break;
+                case 16384: (full ??= {}).ignoreDefensive = this.ignoreDefensive; break;
+                case 32768: (full ??= {}).ignoreImmunity = this.ignoreImmunity; break;
+                case 65536: (full ??= {}).ignoreEvasion = this.ignoreEvasion; break;
+                case 131072: (full ??= {}).hasSheerForce = this.hasSheerForce; break;
+                case 262144: (full ??= {}).noPpBoosts = this.noPpBoosts; break;
+                case 524288: (full ??= {}).ignoreAbility = this.ignoreAbility; break;
+                case 1048576: (full ??= {}).zMove = this.zMove; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Move} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.num) !== undefined) {
+                this.num = value;
+            }
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.gen) !== undefined) {
+                this.gen = value;
+            }
+            if ((value = full.basePower) !== undefined) {
+                this.basePower = value;
+            }
+            if ((value = full.pp) !== undefined) {
+                this.pp = value;
+            }
+            if ((value = full.type) !== undefined) {
+                this.type = value;
+            }
+            if ((value = full.category) !== undefined) {
+                this.category = value;
+            }
+            if ((value = full.target) !== undefined) {
+                this.target = value;
+            }
+            if ((value = full.accuracy) !== undefined) {
+                this.accuracy = value;
+            }
+            if ((value = full.critRatio) !== undefined) {
+                this.critRatio = value;
+            }
+            if ((value = full.secondaries) !== undefined) {
+                this.secondaries = value;
+            }
+            if ((value = full.priority) !== undefined) {
+                this.priority = value;
+            }
+            if ((value = full.ignoreOffensive) !== undefined) {
+                this.ignoreOffensive = value;
+            }
+            if ((value = full.ignoreDefensive) !== undefined) {
+                this.ignoreDefensive = value;
+            }
+            if ((value = full.ignoreImmunity) !== undefined) {
+                this.ignoreImmunity = value;
+            }
+            if ((value = full.ignoreEvasion) !== undefined) {
+                this.ignoreEvasion = value;
+            }
+            if ((value = full.hasSheerForce) !== undefined) {
+                this.hasSheerForce = value;
+            }
+            if ((value = full.noPpBoosts) !== undefined) {
+                this.noPpBoosts = value;
+            }
+            if ((value = full.ignoreAbility) !== undefined) {
+                this.ignoreAbility = value;
+            }
+            if ((value = full.zMove) !== undefined) {
+                this.zMove = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Move} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            num: this.num,
+            name: this.name,
+            gen: this.gen,
+            basePower: this.basePower,
+            pp: this.pp,
+            type: this.type,
+            category: this.category,
+            target: this.target,
+            accuracy: this.accuracy,
+            critRatio: this.critRatio,
+            secondaries: this.secondaries,
+            priority: this.priority,
+            ignoreOffensive: this.ignoreOffensive,
+            ignoreDefensive: this.ignoreDefensive,
+            ignoreImmunity: this.ignoreImmunity,
+            ignoreEvasion: this.ignoreEvasion,
+            hasSheerForce: this.hasSheerForce,
+            noPpBoosts: this.noPpBoosts,
+            ignoreAbility: this.ignoreAbility,
+            zMove: this.zMove,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Move.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.num;
+        if (value != null && !__isInt32(value)) return __invalid("num", "int32");
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.gen;
+        if (value != null && !__isInt32(value)) return __invalid("gen", "int32");
+        value = json.basePower;
+        if (value != null && !__isInt32(value)) return __invalid("basePower", "int32");
+        value = json.pp;
+        if (value != null && !__isInt32(value)) return __invalid("pp", "int32");
+        value = json.type;
+        if (value != null && !__isEnum(PokeType, value)) return __invalid("type", "enum PokeType");
+        value = json.category;
+        if (value != null && !__isEnum(MoveCategory, value)) return __invalid("category", "enum MoveCategory");
+        value = json.target;
+        if (value != null && !__isString(value)) return __invalid("target", "string");
+        value = json.accuracy;
+        if (value != null && !__isInt32(value)) return __invalid("accuracy", "int32");
+        value = json.critRatio;
+        if (value != null && !__isInt32(value)) return __invalid("critRatio", "int32");
+        value = json.secondaries;
+        if (value != null && !__isString(value)) return __invalid("secondaries", "string");
+        value = json.priority;
+        if (value != null && !__isInt32(value)) return __invalid("priority", "int32");
+        value = json.ignoreOffensive;
+        if (value != null && !__isString(value)) return __invalid("ignoreOffensive", "string");
+        value = json.ignoreDefensive;
+        if (value != null && !__isString(value)) return __invalid("ignoreDefensive", "string");
+        value = json.ignoreImmunity;
+        if (value != null && !__isString(value)) return __invalid("ignoreImmunity", "string");
+        value = json.ignoreEvasion;
+        if (value != null && !__isString(value)) return __invalid("ignoreEvasion", "string");
+        value = json.hasSheerForce;
+        if (value != null && !__isBool(value)) return __invalid("hasSheerForce", "bool");
+        value = json.noPpBoosts;
+        if (value != null && !__isBool(value)) return __invalid("noPpBoosts", "bool");
+        value = json.ignoreAbility;
+        if (value != null && !__isBool(value)) return __invalid("ignoreAbility", "bool");
+        value = json.zMove;
+        if (value != null && !__isString(value)) return __invalid("zMove", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Move}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Move.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.num;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("num", "int32");
+                message.num = value;
+            }
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.gen;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("gen", "int32");
+                message.gen = value;
+            }
+            value = json.basePower;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("basePower", "int32");
+                message.basePower = value;
+            }
+            value = json.pp;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("pp", "int32");
+                message.pp = value;
+            }
+            value = json.type;
+            if (value != null) {
+                if (!__isEnum(PokeType, value)) throw __invalid("type", "enum PokeType");
+                message.type = value;
+            }
+            value = json.category;
+            if (value != null) {
+                if (!__isEnum(MoveCategory, value)) throw __invalid("category", "enum MoveCategory");
+                message.category = value;
+            }
+            value = json.target;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("target", "string");
+                message.target = value;
+            }
+            value = json.accuracy;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("accuracy", "int32");
+                message.accuracy = value;
+            }
+            value = json.critRatio;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("critRatio", "int32");
+                message.critRatio = value;
+            }
+            value = json.secondaries;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("secondaries", "string");
+                message.secondaries = value;
+            }
+            value = json.priority;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("priority", "int32");
+                message.priority = value;
+            }
+            value = json.ignoreOffensive;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("ignoreOffensive", "string");
+                message.ignoreOffensive = value;
+            }
+            value = json.ignoreDefensive;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("ignoreDefensive", "string");
+                message.ignoreDefensive = value;
+            }
+            value = json.ignoreImmunity;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("ignoreImmunity", "string");
+                message.ignoreImmunity = value;
+            }
+            value = json.ignoreEvasion;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("ignoreEvasion", "string");
+                message.ignoreEvasion = value;
+            }
+            value = json.hasSheerForce;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("hasSheerForce", "bool");
+                message.hasSheerForce = value;
+            }
+            value = json.noPpBoosts;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("noPpBoosts", "bool");
+                message.noPpBoosts = value;
+            }
+            value = json.ignoreAbility;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("ignoreAbility", "bool");
+                message.ignoreAbility = value;
+            }
+            value = json.zMove;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("zMove", "string");
+                message.zMove = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Move.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class MoveView {
+        static __layout = {
+            size: 112,
+            hash: 0x52b9e862,
+            presence: 64,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 64},
+                {name: "num", type: "TYPE_INT32", offset: 68},
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "gen", type: "TYPE_INT32", offset: 72},
+                {name: "basePower", type: "TYPE_INT32", offset: 76},
+                {name: "pp", type: "TYPE_INT32", offset: 80},
+                {name: "type", type: "TYPE_ENUM", offset: 84},
+                {name: "category", type: "TYPE_ENUM", offset: 88},
+                {name: "target", type: "TYPE_STRING", offset: 8},
+                {name: "accuracy", type: "TYPE_INT32", offset: 92},
+                {name: "critRatio", type: "TYPE_INT32", offset: 96},
+                {name: "secondaries", type: "TYPE_STRING", offset: 16},
+                {name: "priority", type: "TYPE_INT32", offset: 100},
+                {name: "ignoreOffensive", type: "TYPE_STRING", offset: 24},
+                {name: "ignoreDefensive", type: "TYPE_STRING", offset: 32},
+                {name: "ignoreImmunity", type: "TYPE_STRING", offset: 40},
+                {name: "ignoreEvasion", type: "TYPE_STRING", offset: 48},
+                {name: "hasSheerForce", type: "TYPE_BOOL", offset: 104},
+                {name: "noPpBoosts", type: "TYPE_BOOL", offset: 105},
+                {name: "ignoreAbility", type: "TYPE_BOOL", offset: 106},
+                {name: "zMove", type: "TYPE_STRING", offset: 56}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, MoveView.__layout.hash);
+            return new MoveView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 64);
+        }
+
+        get num() {
+            return __flatInt32(this.__view, this.__offset + 68);
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get gen() {
+            return __flatInt32(this.__view, this.__offset + 72);
+        }
+
+        get basePower() {
+            return __flatInt32(this.__view, this.__offset + 76);
+        }
+
+        get pp() {
+            return __flatInt32(this.__view, this.__offset + 80);
+        }
+
+        get type() {
+            return __flatInt32(this.__view, this.__offset + 84);
+        }
+
+        get category() {
+            return __flatInt32(this.__view, this.__offset + 88);
+        }
+
+        get target() {
+            return __flatString(this.__view, this.__offset + 8);
+        }
+
+        get accuracy() {
+            return __flatInt32(this.__view, this.__offset + 92);
+        }
+
+        get critRatio() {
+            return __flatInt32(this.__view, this.__offset + 96);
+        }
+
+        get secondaries() {
+            return __flatString(this.__view, this.__offset + 16);
+        }
+
+        get priority() {
+            return __flatInt32(this.__view, this.__offset + 100);
+        }
+
+        get ignoreOffensive() {
+            return __flatString(this.__view, this.__offset + 24);
+        }
+
+        get ignoreDefensive() {
+            return __flatString(this.__view, this.__offset + 32);
+        }
+
+        get ignoreImmunity() {
+            return __flatString(this.__view, this.__offset + 40);
+        }
+
+        get ignoreEvasion() {
+            return __flatString(this.__view, this.__offset + 48);
+        }
+
+        get hasSheerForce() {
+            return __flatBool(this.__view, this.__offset + 104);
+        }
+
+        get noPpBoosts() {
+            return __flatBool(this.__view, this.__offset + 105);
+        }
+
+        get ignoreAbility() {
+            return __flatBool(this.__view, this.__offset + 106);
+        }
+
+        get zMove() {
+            return __flatString(this.__view, this.__offset + 56);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class MoveColumns extends __ColumnTable {
+        static Row = class MoveRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get num() {
+                return this.__table.columns.num[this.__index];
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get gen() {
+                return this.__table.columns.gen[this.__index];
+            }
+
+            get basePower() {
+                return this.__table.columns.basePower[this.__index];
+            }
+
+            get pp() {
+                return this.__table.columns.pp[this.__index];
+            }
+
+            get type() {
+                return this.__table.columns.type[this.__index];
+            }
+
+            get category() {
+                return this.__table.columns.category[this.__index];
+            }
+
+            get target() {
+                const table = this.__table;
+                return table.dictionaries.target[table.columns.target[this.__index]];
+            }
+
+            get accuracy() {
+                return this.__table.columns.accuracy[this.__index];
+            }
+
+            get critRatio() {
+                return this.__table.columns.critRatio[this.__index];
+            }
+
+            get secondaries() {
+                const table = this.__table;
+                return table.dictionaries.secondaries[table.columns.secondaries[this.__index]];
+            }
+
+            get priority() {
+                return this.__table.columns.priority[this.__index];
+            }
+
+            get ignoreOffensive() {
+                const table = this.__table;
+                return table.dictionaries.ignoreOffensive[table.columns.ignoreOffensive[this.__index]];
+            }
+
+            get ignoreDefensive() {
+                const table = this.__table;
+                return table.dictionaries.ignoreDefensive[table.columns.ignoreDefensive[this.__index]];
+            }
+
+            get ignoreImmunity() {
+                const table = this.__table;
+                return table.dictionaries.ignoreImmunity[table.columns.ignoreImmunity[this.__index]];
+            }
+
+            get ignoreEvasion() {
+                const table = this.__table;
+                return table.dictionaries.ignoreEvasion[table.columns.ignoreEvasion[this.__index]];
+            }
+
+            get hasSheerForce() {
+                return this.__table.columns.hasSheerForce[this.__index] !== 0;
+            }
+
+            get noPpBoosts() {
+                return this.__table.columns.noPpBoosts[this.__index] !== 0;
+            }
+
+            get ignoreAbility() {
+                return this.__table.columns.ignoreAbility[this.__index] !== 0;
+            }
+
+            get zMove() {
+                const table = this.__table;
+                return table.dictionaries.zMove[table.columns.zMove[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: [], target: [], secondaries: [], ignoreOffensive: [], ignoreDefensive: [], ignoreImmunity: [], ignoreEvasion: [], zMove: []};
+            this.columns = {
+                id: new Int32Array(length),
+                num: new Int32Array(length),
+                name: new Uint32Array(length),
+                gen: new Int32Array(length),
+                basePower: new Int32Array(length),
+                pp: new Int32Array(length),
+                type: new Int32Array(length),
+                category: new Int32Array(length),
+                target: new Uint32Array(length),
+                accuracy: new Int32Array(length),
+                critRatio: new Int32Array(length),
+                secondaries: new Uint32Array(length),
+                priority: new Int32Array(length),
+                ignoreOffensive: new Uint32Array(length),
+                ignoreDefensive: new Uint32Array(length),
+                ignoreImmunity: new Uint32Array(length),
+                ignoreEvasion: new Uint32Array(length),
+                hasSheerForce: new Uint8Array(length),
+                noPpBoosts: new Uint8Array(length),
+                ignoreAbility: new Uint8Array(length),
+                zMove: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new MoveColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            const targetCodes = new Map();
+            const secondariesCodes = new Map();
+            const ignoreOffensiveCodes = new Map();
+            const ignoreDefensiveCodes = new Map();
+            const ignoreImmunityCodes = new Map();
+            const ignoreEvasionCodes = new Map();
+            const zMoveCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.num[i] = row.num ?? 0;
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.gen[i] = row.gen ?? 0;
+                columns.basePower[i] = row.basePower ?? 0;
+                columns.pp[i] = row.pp ?? 0;
+                columns.type[i] = row.type ?? PokeType.NORMAL;
+                columns.category[i] = row.category ?? MoveCategory.PHYSICAL;
+                columns.target[i] = __columnEncode(targetCodes, dictionaries.target, row.target ?? "");
+                columns.accuracy[i] = row.accuracy ?? 0;
+                columns.critRatio[i] = row.critRatio ?? 0;
+                columns.secondaries[i] = __columnEncode(secondariesCodes, dictionaries.secondaries, row.secondaries ?? "");
+                columns.priority[i] = row.priority ?? 0;
+                columns.ignoreOffensive[i] = __columnEncode(ignoreOffensiveCodes, dictionaries.ignoreOffensive, row.ignoreOffensive ?? "");
+                columns.ignoreDefensive[i] = __columnEncode(ignoreDefensiveCodes, dictionaries.ignoreDefensive, row.ignoreDefensive ?? "");
+                columns.ignoreImmunity[i] = __columnEncode(ignoreImmunityCodes, dictionaries.ignoreImmunity, row.ignoreImmunity ?? "");
+                columns.ignoreEvasion[i] = __columnEncode(ignoreEvasionCodes, dictionaries.ignoreEvasion, row.ignoreEvasion ?? "");
+                columns.hasSheerForce[i] = row.hasSheerForce ? 1 : 0;
+                columns.noPpBoosts[i] = row.noPpBoosts ? 1 : 0;
+                columns.ignoreAbility[i] = row.ignoreAbility ? 1 : 0;
+                columns.zMove[i] = __columnEncode(zMoveCodes, dictionaries.zMove, row.zMove ?? "");
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: Pokemon
+export class Pokemon {
+    static __descriptor = {
+        name: "Pokemon",
+        get clrType() { return Pokemon; },
+        fullName: "pokeworld.pokemon.cfg.Pokemon",
+        package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "num", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "name", number: 3, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "gen", number: 4, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "baseForme", number: 5, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "otherFormes", number: 6, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "abilities", number: 7, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "pokeTypes", number: 8, type: "TYPE_ENUM", typeName: ".pokeworld.pokemon.cfg.PokeType", get clrType() { return PokeType; },label: "LABEL_REPEATED"},
+            {name: "prevo", number: 9, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "evos", number: 10, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "evoLevel", number: 11, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "tier", number: 12, type: "TYPE_STRING", intern: true, label: "LABEL_OPTIONAL"},
+            {name: "doublesTier", number: 13, type: "TYPE_STRING", intern: true, label: "LABEL_OPTIONAL"},
+            {name: "natDexTier", number: 14, type: "TYPE_STRING", intern: true, label: "LABEL_OPTIONAL"},
+            {name: "eggGroups", number: 15, type: "TYPE_STRING", intern: true, label: "LABEL_OPTIONAL"},
+            {name: "canHatch", number: 16, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"},
+            {name: "genderRatio", number: 17, type: "TYPE_STRING", intern: true, label: "LABEL_OPTIONAL"},
+            {name: "hp", number: 18, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "atk", number: 19, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "def", number: 20, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "spa", number: 21, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "spd", number: 22, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "spe", number: 23, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "weight", number: 24, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
+            {name: "height", number: 25, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
+            {name: "frontAtlasAssetAdress", number: 26, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.AssetAddress", get clrType() { return __PokeworldResourceCfg_resource.AssetAddress; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "backAtlasAssetAdress", number: 27, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.AssetAddress", get clrType() { return __PokeworldResourceCfg_resource.AssetAddress; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__id = 0;
+        this.__num = 0;
+        this.__name = "";
+        this.__gen = 0;
+        this.__baseForme = "";
+        this.__otherFormes = "";
+        this.__abilities = "";
+        this.__pokeTypes = [];
+        this.__prevo = "";
+        this.__evos = "";
+        this.__evoLevel = 0;
+        this.__tier = "";
+        this.__doublesTier = "";
+        this.__natDexTier = "";
+        this.__eggGroups = "";
+        this.__canHatch = false;
+        this.__genderRatio = "";
+        this.__hp = 0;
+        this.__atk = 0;
+        this.__def = 0;
+        this.__spa = 0;
+        this.__spd = 0;
+        this.__spe = 0;
+        this.__weight = 0;
+        this.__height = 0;
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __id = undefined;
+
+    /** @type {number} */
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Pokemon} 
+     */
+    withId(value) {
+        this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __num = undefined;
+
+    /** @type {number} */
+    get num() {
+        return this.__num;
+    }
+    set num(value) {
+        this.__rawStale = true;
+        this.__num = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Pokemon} 
+     */
+    withNum(value) {
+        this.num = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __name = undefined;
+
+    /** @type {string} */
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
+
+    /** 
+     * @param {string} value 
      * @return {Pokemon} 
      */
     withName(value) {
         this.name = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
+    __gen = undefined;
+
     /** @type {number} */
-    gen;
+    get gen() {
+        return this.__gen;
+    }
+    set gen(value) {
+        this.__rawStale = true;
+        this.__gen = value;
+    }
 
     /** 
      * @param {number} value 
@@ -452,11 +2020,21 @@ export class Pokemon {
      */
     withGen(value) {
         this.gen = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
         return this;
     }
 
+    __baseForme = undefined;
+
     /** @type {string} */
-    baseForme;
+    get baseForme() {
+        return this.__baseForme;
+    }
+    set baseForme(value) {
+        this.__rawStale = true;
+        this.__baseForme = value;
+    }
 
     /** 
      * @param {string} value 
@@ -464,11 +2042,21 @@ export class Pokemon {
      */
     withBaseForme(value) {
         this.baseForme = value;
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
         return this;
     }
 
+    __otherFormes = undefined;
+
     /** @type {string} */
-    otherFormes;
+    get otherFormes() {
+        return this.__otherFormes;
+    }
+    set otherFormes(value) {
+        this.__rawStale = true;
+        this.__otherFormes = value;
+    }
 
     /** 
      * @param {string} value 
@@ -476,11 +2064,21 @@ export class Pokemon {
      */
     withOtherFormes(value) {
         this.otherFormes = value;
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
         return this;
     }
 
+    __abilities = undefined;
+
     /** @type {string} */
-    abilities;
+    get abilities() {
+        return this.__abilities;
+    }
+    set abilities(value) {
+        this.__rawStale = true;
+        this.__abilities = value;
+    }
 
     /** 
      * @param {string} value 
@@ -488,11 +2086,21 @@ export class Pokemon {
      */
     withAbilities(value) {
         this.abilities = value;
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
         return this;
     }
 
+    __pokeTypes = undefined;
+
     /** @type {PokeType[keyof typeof PokeType][]} */
-    pokeTypes;
+    get pokeTypes() {
+        return this.__pokeTypes;
+    }
+    set pokeTypes(value) {
+        this.__rawStale = true;
+        this.__pokeTypes = value;
+    }
 
     /** 
      * @param {PokeType[keyof typeof PokeType][]} value 
@@ -500,11 +2108,21 @@ export class Pokemon {
      */
     withPokeTypes(value) {
         this.pokeTypes = value;
+        this.__dirty0 |= 128;
+        this.__rawStale = true;
         return this;
     }
 
+    __prevo = undefined;
+
     /** @type {string} */
-    prevo;
+    get prevo() {
+        return this.__prevo;
+    }
+    set prevo(value) {
+        this.__rawStale = true;
+        this.__prevo = value;
+    }
 
     /** 
      * @param {string} value 
@@ -512,11 +2130,21 @@ export class Pokemon {
      */
     withPrevo(value) {
         this.prevo = value;
+        this.__dirty0 |= 256;
+        this.__rawStale = true;
         return this;
     }
 
+    __evos = undefined;
+
     /** @type {string} */
-    evos;
+    get evos() {
+        return this.__evos;
+    }
+    set evos(value) {
+        this.__rawStale = true;
+        this.__evos = value;
+    }
 
     /** 
      * @param {string} value 
@@ -524,11 +2152,21 @@ export class Pokemon {
      */
     withEvos(value) {
         this.evos = value;
+        this.__dirty0 |= 512;
+        this.__rawStale = true;
         return this;
     }
 
+    __evoLevel = undefined;
+
     /** @type {number} */
-    evoLevel;
+    get evoLevel() {
+        return this.__evoLevel;
+    }
+    set evoLevel(value) {
+        this.__rawStale = true;
+        this.__evoLevel = value;
+    }
 
     /** 
      * @param {number} value 
@@ -536,11 +2174,21 @@ export class Pokemon {
      */
     withEvoLevel(value) {
         this.evoLevel = value;
+        this.__dirty0 |= 1024;
+        this.__rawStale = true;
         return this;
     }
 
+    __tier = undefined;
+
     /** @type {string} */
-    tier;
+    get tier() {
+        return this.__tier;
+    }
+    set tier(value) {
+        this.__rawStale = true;
+        this.__tier = value;
+    }
 
     /** 
      * @param {string} value 
@@ -548,11 +2196,21 @@ export class Pokemon {
      */
     withTier(value) {
         this.tier = value;
+        this.__dirty0 |= 2048;
+        this.__rawStale = true;
         return this;
     }
 
+    __doublesTier = undefined;
+
     /** @type {string} */
-    doublesTier;
+    get doublesTier() {
+        return this.__doublesTier;
+    }
+    set doublesTier(value) {
+        this.__rawStale = true;
+        this.__doublesTier = value;
+    }
 
     /** 
      * @param {string} value 
@@ -560,11 +2218,21 @@ export class Pokemon {
      */
     withDoublesTier(value) {
         this.doublesTier = value;
+        this.__dirty0 |= 4096;
+        this.__rawStale = true;
         return this;
     }
 
+    __natDexTier = undefined;
+
     /** @type {string} */
-    natDexTier;
+    get natDexTier() {
+        return this.__natDexTier;
+    }
+    set natDexTier(value) {
+        this.__rawStale = true;
+        this.__natDexTier = value;
+    }
 
     /** 
      * @param {string} value 
@@ -572,11 +2240,21 @@ export class Pokemon {
      */
     withNatDexTier(value) {
         this.natDexTier = value;
+        this.__dirty0 |= 8192;
+        this.__rawStale = true;
         return this;
     }
 
+    __eggGroups = undefined;
+
     /** @type {string} */
-    eggGroups;
+    get eggGroups() {
+        return this.__eggGroups;
+    }
+    set eggGroups(value) {
+        this.__rawStale = true;
+        this.__eggGroups = value;
+    }
 
     /** 
      * @param {string} value 
@@ -584,11 +2262,21 @@ export class Pokemon {
      */
     withEggGroups(value) {
         this.eggGroups = value;
+        this.__dirty0 |= 16384;
+        this.__rawStale = true;
         return this;
     }
 
+    __canHatch = undefined;
+
     /** @type {boolean} */
-    canHatch;
+    get canHatch() {
+        return this.__canHatch;
+    }
+    set canHatch(value) {
+        this.__rawStale = true;
+        this.__canHatch = value;
+    }
 
     /** 
      * @param {boolean} value 
@@ -596,11 +2284,21 @@ export class Pokemon {
      */
     withCanHatch(value) {
         this.canHatch = value;
+        this.__dirty0 |= 32768;
+        this.__rawStale = true;
         return this;
     }
 
+    __genderRatio = undefined;
+
     /** @type {string} */
-    genderRatio;
+    get genderRatio() {
+        return this.__genderRatio;
+    }
+    set genderRatio(value) {
+        this.__rawStale = true;
+        this.__genderRatio = value;
+    }
 
     /** 
      * @param {string} value 
@@ -608,11 +2306,21 @@ export class Pokemon {
      */
     withGenderRatio(value) {
         this.genderRatio = value;
+        this.__dirty0 |= 65536;
+        this.__rawStale = true;
         return this;
     }
 
+    __hp = undefined;
+
     /** @type {number} */
-    hp;
+    get hp() {
+        return this.__hp;
+    }
+    set hp(value) {
+        this.__rawStale = true;
+        this.__hp = value;
+    }
 
     /** 
      * @param {number} value 
@@ -620,11 +2328,21 @@ export class Pokemon {
      */
     withHp(value) {
         this.hp = value;
+        this.__dirty0 |= 131072;
+        this.__rawStale = true;
         return this;
     }
 
+    __atk = undefined;
+
     /** @type {number} */
-    atk;
+    get atk() {
+        return this.__atk;
+    }
+    set atk(value) {
+        this.__rawStale = true;
+        this.__atk = value;
+    }
 
     /** 
      * @param {number} value 
@@ -632,11 +2350,21 @@ export class Pokemon {
      */
     withAtk(value) {
         this.atk = value;
+        this.__dirty0 |= 262144;
+        this.__rawStale = true;
         return this;
     }
 
+    __def = undefined;
+
     /** @type {number} */
-    def;
+    get def() {
+        return this.__def;
+    }
+    set def(value) {
+        this.__rawStale = true;
+        this.__def = value;
+    }
 
     /** 
      * @param {number} value 
@@ -644,11 +2372,21 @@ export class Pokemon {
      */
     withDef(value) {
         this.def = value;
+        this.__dirty0 |= 524288;
+        this.__rawStale = true;
         return this;
     }
 
+    __spa = undefined;
+
     /** @type {number} */
-    spa;
+    get spa() {
+        return this.__spa;
+    }
+    set spa(value) {
+        this.__rawStale = true;
+        this.__spa = value;
+    }
 
     /** 
      * @param {number} value 
@@ -656,11 +2394,21 @@ export class Pokemon {
      */
     withSpa(value) {
         this.spa = value;
+        this.__dirty0 |= 1048576;
+        this.__rawStale = true;
         return this;
     }
 
+    __spd = undefined;
+
     /** @type {number} */
-    spd;
+    get spd() {
+        return this.__spd;
+    }
+    set spd(value) {
+        this.__rawStale = true;
+        this.__spd = value;
+    }
 
     /** 
      * @param {number} value 
@@ -668,11 +2416,21 @@ export class Pokemon {
      */
     withSpd(value) {
         this.spd = value;
+        this.__dirty0 |= 2097152;
+        this.__rawStale = true;
         return this;
     }
 
+    __spe = undefined;
+
     /** @type {number} */
-    spe;
+    get spe() {
+        return this.__spe;
+    }
+    set spe(value) {
+        this.__rawStale = true;
+        this.__spe = value;
+    }
 
     /** 
      * @param {number} value 
@@ -680,11 +2438,21 @@ export class Pokemon {
      */
     withSpe(value) {
         this.spe = value;
+        this.__dirty0 |= 4194304;
+        this.__rawStale = true;
         return this;
     }
 
+    __weight = undefined;
+
     /** @type {number} */
-    weight;
+    get weight() {
+        return this.__weight;
+    }
+    set weight(value) {
+        this.__rawStale = true;
+        this.__weight = value;
+    }
 
     /** 
      * @param {number} value 
@@ -692,11 +2460,21 @@ export class Pokemon {
      */
     withWeight(value) {
         this.weight = value;
+        this.__dirty0 |= 8388608;
+        this.__rawStale = true;
         return this;
     }
 
+    __height = undefined;
+
     /** @type {number} */
-    height;
+    get height() {
+        return this.__height;
+    }
+    set height(value) {
+        this.__rawStale = true;
+        this.__height = value;
+    }
 
     /** 
      * @param {number} value 
@@ -704,14 +2482,56 @@ export class Pokemon {
      */
     withHeight(value) {
         this.height = value;
+        this.__dirty0 |= 16777216;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {__PokeworldResourceCfg_resource.AssetAddress} */
-    frontAtlasAssetAdress;
+    __frontAtlasAssetAdress = undefined;
+    __frontAtlasAssetAdressRaw = undefined;
+
+    /** @type {__PokeworldResourceCfg_resource.AssetAddress|undefined} */
+    get frontAtlasAssetAdress() {
+        if (this.__frontAtlasAssetAdressRaw !== undefined) {
+            this.__frontAtlasAssetAdress = this.__decode(Pokemon.__descriptor.fields[25], this.__frontAtlasAssetAdressRaw, this.__frontAtlasAssetAdress);
+            this.__frontAtlasAssetAdressRaw = undefined;
+        }
+        return this.__frontAtlasAssetAdress;
+    }
+    set frontAtlasAssetAdress(value) {
+        this.__dirty0 |= 33554432;
+        this.__rawStale = true;
+        this.__frontAtlasAssetAdressRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__frontAtlasAssetAdress = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__frontAtlasAssetAdress = value;
+            this.__has0 |= 1;
+        }
+    }
 
     /** 
-     * @param {__PokeworldResourceCfg_resource.AssetAddress} value 
+     * @return {boolean} 
+     */
+    hasFrontAtlasAssetAdress() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {Pokemon} 
+     */
+    clearFrontAtlasAssetAdress() {
+        this.__dirty0 |= 33554432;
+        this.__rawStale = true;
+        this.__frontAtlasAssetAdress = undefined;
+        this.__frontAtlasAssetAdressRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldResourceCfg_resource.AssetAddress} value 
      * @return {Pokemon} 
      */
     withFrontAtlasAssetAdress(value) {
@@ -719,8 +2539,48 @@ export class Pokemon {
         return this;
     }
 
-    /** @type {__PokeworldResourceCfg_resource.AssetAddress} */
-    backAtlasAssetAdress;
+    __backAtlasAssetAdress = undefined;
+    __backAtlasAssetAdressRaw = undefined;
+
+    /** @type {__PokeworldResourceCfg_resource.AssetAddress|undefined} */
+    get backAtlasAssetAdress() {
+        if (this.__backAtlasAssetAdressRaw !== undefined) {
+            this.__backAtlasAssetAdress = this.__decode(Pokemon.__descriptor.fields[26], this.__backAtlasAssetAdressRaw, this.__backAtlasAssetAdress);
+            this.__backAtlasAssetAdressRaw = undefined;
+        }
+        return this.__backAtlasAssetAdress;
+    }
+    set backAtlasAssetAdress(value) {
+        this.__dirty0 |= 67108864;
+        this.__rawStale = true;
+        this.__backAtlasAssetAdressRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__backAtlasAssetAdress = undefined;
+            this.__has0 &= ~2;
+        } else {
+            this.__backAtlasAssetAdress = value;
+            this.__has0 |= 2;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasBackAtlasAssetAdress() {
+        return (this.__has0 & 2) !== 0;
+    }
+
+    /** 
+     * @return {Pokemon} 
+     */
+    clearBackAtlasAssetAdress() {
+        this.__dirty0 |= 67108864;
+        this.__rawStale = true;
+        this.__backAtlasAssetAdress = undefined;
+        this.__backAtlasAssetAdressRaw = undefined;
+        this.__has0 &= ~2;
+        return this;
+    }
 
     /** 
      * @param {__PokeworldResourceCfg_resource.AssetAddress} value 
@@ -731,6 +2591,1090 @@ export class Pokemon {
         return this;
     }
 
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 26:
+                this.__dirty0 |= 33554432;
+                this.__frontAtlasAssetAdress = undefined;
+                this.__frontAtlasAssetAdressRaw = raw;
+                this.__has0 |= 1;
+                break;
+            case 27:
+                this.__dirty0 |= 67108864;
+                this.__backAtlasAssetAdress = undefined;
+                this.__backAtlasAssetAdressRaw = raw;
+                this.__has0 |= 2;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["id", "num", "name", "gen", "baseForme", "otherFormes", "abilities", "pokeTypes", "prevo", "evos", "evoLevel", "tier", "doublesTier", "natDexTier", "eggGroups", "canHatch", "genderRatio", "hp", "atk", "def", "spa", "spd", "spe", "weight", "height", "frontAtlasAssetAdress", "backAtlasAssetAdress"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__pokeTypes) != null) {
+            raw = this.__raw.pokeTypes;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (let i = 0; i < value.length; i++) {
+                if (value[i] !== raw[i]) return false;
+            }
+        }
+        if ((value = this.__frontAtlasAssetAdress) != null && !value.__isPristine()) return false;
+        if ((value = this.__backAtlasAssetAdress) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Pokemon} a deep copy of this message
+     */
+    clone() {
+        return new Pokemon().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Pokemon} other 
+     * @return {Pokemon} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.num = other.num;
+        this.name = other.name;
+        this.gen = other.gen;
+        this.baseForme = other.baseForme;
+        this.otherFormes = other.otherFormes;
+        this.abilities = other.abilities;
+        this.pokeTypes = __cloneArray(other.pokeTypes, undefined);
+        this.prevo = other.prevo;
+        this.evos = other.evos;
+        this.evoLevel = other.evoLevel;
+        this.tier = other.tier;
+        this.doublesTier = other.doublesTier;
+        this.natDexTier = other.natDexTier;
+        this.eggGroups = other.eggGroups;
+        this.canHatch = other.canHatch;
+        this.genderRatio = other.genderRatio;
+        this.hp = other.hp;
+        this.atk = other.atk;
+        this.def = other.def;
+        this.spa = other.spa;
+        this.spd = other.spd;
+        this.spe = other.spe;
+        this.weight = other.weight;
+        this.height = other.height;
+        this.frontAtlasAssetAdress = __cloneMessage(other.frontAtlasAssetAdress);
+        this.backAtlasAssetAdress = __cloneMessage(other.backAtlasAssetAdress);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Pokemon} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Pokemon)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.num ?? 0) !== (other.num ?? 0)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if ((this.gen ?? 0) !== (other.gen ?? 0)) return false;
+        if ((this.baseForme ?? "") !== (other.baseForme ?? "")) return false;
+        if ((this.otherFormes ?? "") !== (other.otherFormes ?? "")) return false;
+        if ((this.abilities ?? "") !== (other.abilities ?? "")) return false;
+        if (!__equalsArray(this.pokeTypes, other.pokeTypes, undefined)) return false;
+        if ((this.prevo ?? "") !== (other.prevo ?? "")) return false;
+        if ((this.evos ?? "") !== (other.evos ?? "")) return false;
+        if ((this.evoLevel ?? 0) !== (other.evoLevel ?? 0)) return false;
+        if ((this.tier ?? "") !== (other.tier ?? "")) return false;
+        if ((this.doublesTier ?? "") !== (other.doublesTier ?? "")) return false;
+        if ((this.natDexTier ?? "") !== (other.natDexTier ?? "")) return false;
+        if ((this.eggGroups ?? "") !== (other.eggGroups ?? "")) return false;
+        if ((this.canHatch ?? false) !== (other.canHatch ?? false)) return false;
+        if ((this.genderRatio ?? "") !== (other.genderRatio ?? "")) return false;
+        if ((this.hp ?? 0) !== (other.hp ?? 0)) return false;
+        if ((this.atk ?? 0) !== (other.atk ?? 0)) return false;
+        if ((this.def ?? 0) !== (other.def ?? 0)) return false;
+        if ((this.spa ?? 0) !== (other.spa ?? 0)) return false;
+        if ((this.spd ?? 0) !== (other.spd ?? 0)) return false;
+        if ((this.spe ?? 0) !== (other.spe ?? 0)) return false;
+        if ((this.weight ?? 0) !== (other.weight ?? 0)) return false;
+        if ((this.height ?? 0) !== (other.height ?? 0)) return false;
+        if (!__equalsMessage(this.frontAtlasAssetAdress, other.frontAtlasAssetAdress)) return false;
+        if (!__equalsMessage(this.backAtlasAssetAdress, other.backAtlasAssetAdress)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashNumber(hash, this.num ?? 0);
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashNumber(hash, this.gen ?? 0);
+        hash = __hashString(hash, this.baseForme ?? "");
+        hash = __hashString(hash, this.otherFormes ?? "");
+        hash = __hashString(hash, this.abilities ?? "");
+        hash = __hashArray(hash, this.pokeTypes, __hashNumber);
+        hash = __hashString(hash, this.prevo ?? "");
+        hash = __hashString(hash, this.evos ?? "");
+        hash = __hashNumber(hash, this.evoLevel ?? 0);
+        hash = __hashString(hash, this.tier ?? "");
+        hash = __hashString(hash, this.doublesTier ?? "");
+        hash = __hashString(hash, this.natDexTier ?? "");
+        hash = __hashString(hash, this.eggGroups ?? "");
+        hash = __hashBool(hash, this.canHatch ?? false);
+        hash = __hashString(hash, this.genderRatio ?? "");
+        hash = __hashNumber(hash, this.hp ?? 0);
+        hash = __hashNumber(hash, this.atk ?? 0);
+        hash = __hashNumber(hash, this.def ?? 0);
+        hash = __hashNumber(hash, this.spa ?? 0);
+        hash = __hashNumber(hash, this.spd ?? 0);
+        hash = __hashNumber(hash, this.spe ?? 0);
+        hash = __hashNumber(hash, this.weight ?? 0);
+        hash = __hashNumber(hash, this.height ?? 0);
+        hash = __hashMessage(hash, this.frontAtlasAssetAdress);
+        hash = __hashMessage(hash, this.backAtlasAssetAdress);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Pokemon} 
+     */
+    clear() {
+        this.id = 0;
+        this.num = 0;
+        this.name = "";
+        this.gen = 0;
+        this.baseForme = "";
+        this.otherFormes = "";
+        this.abilities = "";
+        if (Array.isArray(this.pokeTypes)) this.pokeTypes.length = 0; else this.pokeTypes = [];
+        this.prevo = "";
+        this.evos = "";
+        this.evoLevel = 0;
+        this.tier = "";
+        this.doublesTier = "";
+        this.natDexTier = "";
+        this.eggGroups = "";
+        this.canHatch = false;
+        this.genderRatio = "";
+        this.hp = 0;
+        this.atk = 0;
+        this.def = 0;
+        this.spa = 0;
+        this.spd = 0;
+        this.spe = 0;
+        this.weight = 0;
+        this.height = 0;
+        this.__frontAtlasAssetAdress = undefined;
+        this.__frontAtlasAssetAdressRaw = undefined;
+        this.__backAtlasAssetAdress = undefined;
+        this.__backAtlasAssetAdressRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Pokemon} 
+     */
+    static acquire() {
+        const message = Pokemon.__pool.pop();
+        if (message === undefined) return new Pokemon();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Pokemon} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Pokemon instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Pokemon.__pool.length < 64) {
+            Pokemon.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__frontAtlasAssetAdress) instanceof __PokeworldResourceCfg_resource.AssetAddress) __PokeworldResourceCfg_resource.AssetAddress.release(value);
+        if ((value = this.__backAtlasAssetAdress) instanceof __PokeworldResourceCfg_resource.AssetAddress) __PokeworldResourceCfg_resource.AssetAddress.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).num = this.num; break;
+                case 4: (full ??= {}).name = this.name; break;
+                case 8: (full ??= {}).gen = this.gen; break;
+                case 16: (full ??= {}).baseForme = this.baseForme; break;
+                case 32: (full ??= {}).otherFormes = this.otherFormes; break;
+                case 64: (full ??= {}).abilities = this.abilities; break;
+                case 128: (full ??= {}).pokeTypes = this.pokeTypes; break;
+                case 256: (full ??= {}).prevo = this.prevo; break;
+                case 512: (full ??= {}).evos = this.evos; break;
+                case 1024: (full ??= {}).evoLevel = this.evoLevel; break;
+                case 2048: (full ??= {}).tier = this.tier; break;
+                case 4096: (full ??= {}).doublesTier = this.doublesTier; break;
+                case 8192: (full ??= {}).natDexTier = this.natDexTier; break;
+                case 16384: (full ??= {}).eggGroups = this.eggGroups; break;
+                case 32768: (full ??= {}).canHatch = this.canHatch; break;
+                case 65536: (full ??= {}).genderRatio = this.genderRatio; break;
+                case 131072: (full ??= {}).hp = this.hp; break;
+                case 262144: (full ??= {}).atk = this.atk; break;
+                case 524288: (full ??= {}).def = this.def; break;
+                case 1048576: (full ??= {}).spa = this.spa; break;
+                case 2097152: (full ??= {}).spd = this.spd; break;
+                case 4194304: (full ??= {}).spe = this.spe; break;
+                case 8388608: (full ??= {}).weight = this.weight; break;
+                case 16777216: (full ??= {}).height = this.height; break;
+                case 33554432: (full ??= {}).frontAtlasAssetAdress = this.frontAtlasAssetAdress ?? null; break;
+                case 67108864: (full ??= {}).backAtlasAssetAdress = this.backAtlasAssetAdress ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 33554432) === 0 && (value = this.frontAtlasAssetAdress) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).frontAtlasAssetAdress = value;
+        if ((this.__dirty0 & 67108864) === 0 && (value = this.backAtlasAssetAdress) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).backAtlasAssetAdress = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Pokemon} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.num) !== undefined) {
+                this.num = value;
+            }
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.gen) !== undefined) {
+                this.gen = value;
+            }
+            if ((value = full.baseForme) !== undefined) {
+                this.baseForme = value;
+            }
+            if ((value = full.otherFormes) !== undefined) {
+                this.otherFormes = value;
+            }
+            if ((value = full.abilities) !== undefined) {
+                this.abilities = value;
+            }
+            if ((value = full.pokeTypes) !== undefined) {
+                this.pokeTypes = value === null ? [] : value.slice();
+            }
+            if ((value = full.prevo) !== undefined) {
+                this.prevo = value;
+            }
+            if ((value = full.evos) !== undefined) {
+                this.evos = value;
+            }
+            if ((value = full.evoLevel) !== undefined) {
+                this.evoLevel = value;
+            }
+            if ((value = full.tier) !== undefined) {
+                this.tier = value;
+            }
+            if ((value = full.doublesTier) !== undefined) {
+                this.doublesTier = value;
+            }
+            if ((value = full.natDexTier) !== undefined) {
+                this.natDexTier = value;
+            }
+            if ((value = full.eggGroups) !== undefined) {
+                this.eggGroups = value;
+            }
+            if ((value = full.canHatch) !== undefined) {
+                this.canHatch = value;
+            }
+            if ((value = full.genderRatio) !== undefined) {
+                this.genderRatio = value;
+            }
+            if ((value = full.hp) !== undefined) {
+                this.hp = value;
+            }
+            if ((value = full.atk) !== undefined) {
+                this.atk = value;
+            }
+            if ((value = full.def) !== undefined) {
+                this.def = value;
+            }
+            if ((value = full.spa) !== undefined) {
+                this.spa = value;
+            }
+            if ((value = full.spd) !== undefined) {
+                this.spd = value;
+            }
+            if ((value = full.spe) !== undefined) {
+                this.spe = value;
+            }
+            if ((value = full.weight) !== undefined) {
+                this.weight = value;
+            }
+            if ((value = full.height) !== undefined) {
+                this.height = value;
+            }
+            if ((value = full.frontAtlasAssetAdress) !== undefined) {
+                this.frontAtlasAssetAdress = value === null ? undefined : (value instanceof __PokeworldResourceCfg_resource.AssetAddress ? value.clone().commit() : new __PokeworldResourceCfg_resource.AssetAddress().applyDelta({ f: value }));
+            }
+            if ((value = full.backAtlasAssetAdress) !== undefined) {
+                this.backAtlasAssetAdress = value === null ? undefined : (value instanceof __PokeworldResourceCfg_resource.AssetAddress ? value.clone().commit() : new __PokeworldResourceCfg_resource.AssetAddress().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.frontAtlasAssetAdress) !== undefined) {
+                (this.frontAtlasAssetAdress ?? (this.frontAtlasAssetAdress = new __PokeworldResourceCfg_resource.AssetAddress())).applyDelta(value);
+            }
+            if ((value = nested.backAtlasAssetAdress) !== undefined) {
+                (this.backAtlasAssetAdress ?? (this.backAtlasAssetAdress = new __PokeworldResourceCfg_resource.AssetAddress())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Pokemon} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.frontAtlasAssetAdress)) value.commit();
+        if ((value = this.backAtlasAssetAdress)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            num: this.num,
+            name: this.name,
+            gen: this.gen,
+            baseForme: this.baseForme,
+            otherFormes: this.otherFormes,
+            abilities: this.abilities,
+            pokeTypes: this.pokeTypes,
+            prevo: this.prevo,
+            evos: this.evos,
+            evoLevel: this.evoLevel,
+            tier: this.tier,
+            doublesTier: this.doublesTier,
+            natDexTier: this.natDexTier,
+            eggGroups: this.eggGroups,
+            canHatch: this.canHatch,
+            genderRatio: this.genderRatio,
+            hp: this.hp,
+            atk: this.atk,
+            def: this.def,
+            spa: this.spa,
+            spd: this.spd,
+            spe: this.spe,
+            weight: this.weight,
+            height: this.height,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.frontAtlasAssetAdress = this.__frontAtlasAssetAdressRaw ?? this.__frontAtlasAssetAdress; break;
+                case 2: json.backAtlasAssetAdress = this.__backAtlasAssetAdressRaw ?? this.__backAtlasAssetAdress; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Pokemon.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.num;
+        if (value != null && !__isInt32(value)) return __invalid("num", "int32");
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.gen;
+        if (value != null && !__isInt32(value)) return __invalid("gen", "int32");
+        value = json.baseForme;
+        if (value != null && !__isString(value)) return __invalid("baseForme", "string");
+        value = json.otherFormes;
+        if (value != null && !__isString(value)) return __invalid("otherFormes", "string");
+        value = json.abilities;
+        if (value != null && !__isString(value)) return __invalid("abilities", "string");
+        value = json.pokeTypes;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("pokeTypes", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if (!__isEnum(PokeType, item)) return __prefixError(__invalid("", "enum PokeType"), "pokeTypes", i);
+            }
+        }
+        value = json.prevo;
+        if (value != null && !__isString(value)) return __invalid("prevo", "string");
+        value = json.evos;
+        if (value != null && !__isString(value)) return __invalid("evos", "string");
+        value = json.evoLevel;
+        if (value != null && !__isInt32(value)) return __invalid("evoLevel", "int32");
+        value = json.tier;
+        if (value != null && !__isString(value)) return __invalid("tier", "string");
+        value = json.doublesTier;
+        if (value != null && !__isString(value)) return __invalid("doublesTier", "string");
+        value = json.natDexTier;
+        if (value != null && !__isString(value)) return __invalid("natDexTier", "string");
+        value = json.eggGroups;
+        if (value != null && !__isString(value)) return __invalid("eggGroups", "string");
+        value = json.canHatch;
+        if (value != null && !__isBool(value)) return __invalid("canHatch", "bool");
+        value = json.genderRatio;
+        if (value != null && !__isString(value)) return __invalid("genderRatio", "string");
+        value = json.hp;
+        if (value != null && !__isInt32(value)) return __invalid("hp", "int32");
+        value = json.atk;
+        if (value != null && !__isInt32(value)) return __invalid("atk", "int32");
+        value = json.def;
+        if (value != null && !__isInt32(value)) return __invalid("def", "int32");
+        value = json.spa;
+        if (value != null && !__isInt32(value)) return __invalid("spa", "int32");
+        value = json.spd;
+        if (value != null && !__isInt32(value)) return __invalid("spd", "int32");
+        value = json.spe;
+        if (value != null && !__isInt32(value)) return __invalid("spe", "int32");
+        value = json.weight;
+        if (value != null && !__isFloat(value)) return __invalid("weight", "float");
+        value = json.height;
+        if (value != null && !__isFloat(value)) return __invalid("height", "float");
+        value = json.frontAtlasAssetAdress;
+        if (value != null && (error = __PokeworldResourceCfg_resource.AssetAddress.validate(value)) !== null) return __prefixError(error, "frontAtlasAssetAdress");
+        value = json.backAtlasAssetAdress;
+        if (value != null && (error = __PokeworldResourceCfg_resource.AssetAddress.validate(value)) !== null) return __prefixError(error, "backAtlasAssetAdress");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Pokemon}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Pokemon.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.num;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("num", "int32");
+                message.num = value;
+            }
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.gen;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("gen", "int32");
+                message.gen = value;
+            }
+            value = json.baseForme;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("baseForme", "string");
+                message.baseForme = value;
+            }
+            value = json.otherFormes;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("otherFormes", "string");
+                message.otherFormes = value;
+            }
+            value = json.abilities;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("abilities", "string");
+                message.abilities = value;
+            }
+            value = json.pokeTypes;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("pokeTypes", "array");
+                const list = new Array(value.length);
+                message.pokeTypes = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    if (!__isEnum(PokeType, item)) throw __prefixError(__invalid("", "enum PokeType"), "pokeTypes", i);
+                    list[i] = item;
+                }
+            }
+            value = json.prevo;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("prevo", "string");
+                message.prevo = value;
+            }
+            value = json.evos;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("evos", "string");
+                message.evos = value;
+            }
+            value = json.evoLevel;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("evoLevel", "int32");
+                message.evoLevel = value;
+            }
+            value = json.tier;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("tier", "string");
+                message.tier = value;
+            }
+            value = json.doublesTier;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("doublesTier", "string");
+                message.doublesTier = value;
+            }
+            value = json.natDexTier;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("natDexTier", "string");
+                message.natDexTier = value;
+            }
+            value = json.eggGroups;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("eggGroups", "string");
+                message.eggGroups = value;
+            }
+            value = json.canHatch;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("canHatch", "bool");
+                message.canHatch = value;
+            }
+            value = json.genderRatio;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("genderRatio", "string");
+                message.genderRatio = value;
+            }
+            value = json.hp;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("hp", "int32");
+                message.hp = value;
+            }
+            value = json.atk;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("atk", "int32");
+                message.atk = value;
+            }
+            value = json.def;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("def", "int32");
+                message.def = value;
+            }
+            value = json.spa;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("spa", "int32");
+                message.spa = value;
+            }
+            value = json.spd;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("spd", "int32");
+                message.spd = value;
+            }
+            value = json.spe;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("spe", "int32");
+                message.spe = value;
+            }
+            value = json.weight;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("weight", "float");
+                message.weight = value;
+            }
+            value = json.height;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("height", "float");
+                message.height = value;
+            }
+            value = json.frontAtlasAssetAdress;
+            if (value != null) {
+                message.frontAtlasAssetAdress = __decodeNested(__PokeworldResourceCfg_resource.AssetAddress, value, "frontAtlasAssetAdress");
+            }
+            value = json.backAtlasAssetAdress;
+            if (value != null) {
+                message.backAtlasAssetAdress = __decodeNested(__PokeworldResourceCfg_resource.AssetAddress, value, "backAtlasAssetAdress");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Pokemon.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class PokemonView {
+        static __layout = {
+            size: 160,
+            hash: 0x75abf3f7,
+            presence: 96,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 96},
+                {name: "num", type: "TYPE_INT32", offset: 100},
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "gen", type: "TYPE_INT32", offset: 104},
+                {name: "baseForme", type: "TYPE_STRING", offset: 8},
+                {name: "otherFormes", type: "TYPE_STRING", offset: 16},
+                {name: "abilities", type: "TYPE_STRING", offset: 24},
+                {name: "pokeTypes", type: "TYPE_ENUM", offset: 32, repeated: true, stride: 4},
+                {name: "prevo", type: "TYPE_STRING", offset: 40},
+                {name: "evos", type: "TYPE_STRING", offset: 48},
+                {name: "evoLevel", type: "TYPE_INT32", offset: 108},
+                {name: "tier", type: "TYPE_STRING", offset: 56},
+                {name: "doublesTier", type: "TYPE_STRING", offset: 64},
+                {name: "natDexTier", type: "TYPE_STRING", offset: 72},
+                {name: "eggGroups", type: "TYPE_STRING", offset: 80},
+                {name: "canHatch", type: "TYPE_BOOL", offset: 152},
+                {name: "genderRatio", type: "TYPE_STRING", offset: 88},
+                {name: "hp", type: "TYPE_INT32", offset: 112},
+                {name: "atk", type: "TYPE_INT32", offset: 116},
+                {name: "def", type: "TYPE_INT32", offset: 120},
+                {name: "spa", type: "TYPE_INT32", offset: 124},
+                {name: "spd", type: "TYPE_INT32", offset: 128},
+                {name: "spe", type: "TYPE_INT32", offset: 132},
+                {name: "weight", type: "TYPE_FLOAT", offset: 136},
+                {name: "height", type: "TYPE_FLOAT", offset: 140},
+                {name: "frontAtlasAssetAdress", type: "TYPE_MESSAGE", offset: 144, get view() { return __PokeworldResourceCfg_resource.AssetAddress.View; }},
+                {name: "backAtlasAssetAdress", type: "TYPE_MESSAGE", offset: 148, get view() { return __PokeworldResourceCfg_resource.AssetAddress.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, PokemonView.__layout.hash);
+            return new PokemonView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 96);
+        }
+
+        get num() {
+            return __flatInt32(this.__view, this.__offset + 100);
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get gen() {
+            return __flatInt32(this.__view, this.__offset + 104);
+        }
+
+        get baseForme() {
+            return __flatString(this.__view, this.__offset + 8);
+        }
+
+        get otherFormes() {
+            return __flatString(this.__view, this.__offset + 16);
+        }
+
+        get abilities() {
+            return __flatString(this.__view, this.__offset + 24);
+        }
+
+        get pokeTypes() {
+            return __flatList(this.__view, this.__offset + 32, 4, __flatInt32);
+        }
+
+        get prevo() {
+            return __flatString(this.__view, this.__offset + 40);
+        }
+
+        get evos() {
+            return __flatString(this.__view, this.__offset + 48);
+        }
+
+        get evoLevel() {
+            return __flatInt32(this.__view, this.__offset + 108);
+        }
+
+        get tier() {
+            return __flatString(this.__view, this.__offset + 56);
+        }
+
+        get doublesTier() {
+            return __flatString(this.__view, this.__offset + 64);
+        }
+
+        get natDexTier() {
+            return __flatString(this.__view, this.__offset + 72);
+        }
+
+        get eggGroups() {
+            return __flatString(this.__view, this.__offset + 80);
+        }
+
+        get canHatch() {
+            return __flatBool(this.__view, this.__offset + 152);
+        }
+
+        get genderRatio() {
+            return __flatString(this.__view, this.__offset + 88);
+        }
+
+        get hp() {
+            return __flatInt32(this.__view, this.__offset + 112);
+        }
+
+        get atk() {
+            return __flatInt32(this.__view, this.__offset + 116);
+        }
+
+        get def() {
+            return __flatInt32(this.__view, this.__offset + 120);
+        }
+
+        get spa() {
+            return __flatInt32(this.__view, this.__offset + 124);
+        }
+
+        get spd() {
+            return __flatInt32(this.__view, this.__offset + 128);
+        }
+
+        get spe() {
+            return __flatInt32(this.__view, this.__offset + 132);
+        }
+
+        get weight() {
+            return __flatFloat(this.__view, this.__offset + 136);
+        }
+
+        get height() {
+            return __flatFloat(this.__view, this.__offset + 140);
+        }
+
+        get frontAtlasAssetAdress() {
+            return __flatMessage(this.__view, this.__offset + 144, __PokeworldResourceCfg_resource.AssetAddress.View);
+        }
+
+        hasFrontAtlasAssetAdress() {
+            return this.frontAtlasAssetAdress !== undefined;
+        }
+
+        get backAtlasAssetAdress() {
+            return __flatMessage(this.__view, this.__offset + 148, __PokeworldResourceCfg_resource.AssetAddress.View);
+        }
+
+        hasBackAtlasAssetAdress() {
+            return this.backAtlasAssetAdress !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class PokemonColumns extends __ColumnTable {
+        static Row = class PokemonRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get num() {
+                return this.__table.columns.num[this.__index];
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get gen() {
+                return this.__table.columns.gen[this.__index];
+            }
+
+            get baseForme() {
+                const table = this.__table;
+                return table.dictionaries.baseForme[table.columns.baseForme[this.__index]];
+            }
+
+            get otherFormes() {
+                const table = this.__table;
+                return table.dictionaries.otherFormes[table.columns.otherFormes[this.__index]];
+            }
+
+            get abilities() {
+                const table = this.__table;
+                return table.dictionaries.abilities[table.columns.abilities[this.__index]];
+            }
+
+            get pokeTypes() {
+                return this.__table.columns.pokeTypes[this.__index];
+            }
+
+            get prevo() {
+                const table = this.__table;
+                return table.dictionaries.prevo[table.columns.prevo[this.__index]];
+            }
+
+            get evos() {
+                const table = this.__table;
+                return table.dictionaries.evos[table.columns.evos[this.__index]];
+            }
+
+            get evoLevel() {
+                return this.__table.columns.evoLevel[this.__index];
+            }
+
+            get tier() {
+                const table = this.__table;
+                return table.dictionaries.tier[table.columns.tier[this.__index]];
+            }
+
+            get doublesTier() {
+                const table = this.__table;
+                return table.dictionaries.doublesTier[table.columns.doublesTier[this.__index]];
+            }
+
+            get natDexTier() {
+                const table = this.__table;
+                return table.dictionaries.natDexTier[table.columns.natDexTier[this.__index]];
+            }
+
+            get eggGroups() {
+                const table = this.__table;
+                return table.dictionaries.eggGroups[table.columns.eggGroups[this.__index]];
+            }
+
+            get canHatch() {
+                return this.__table.columns.canHatch[this.__index] !== 0;
+            }
+
+            get genderRatio() {
+                const table = this.__table;
+                return table.dictionaries.genderRatio[table.columns.genderRatio[this.__index]];
+            }
+
+            get hp() {
+                return this.__table.columns.hp[this.__index];
+            }
+
+            get atk() {
+                return this.__table.columns.atk[this.__index];
+            }
+
+            get def() {
+                return this.__table.columns.def[this.__index];
+            }
+
+            get spa() {
+                return this.__table.columns.spa[this.__index];
+            }
+
+            get spd() {
+                return this.__table.columns.spd[this.__index];
+            }
+
+            get spe() {
+                return this.__table.columns.spe[this.__index];
+            }
+
+            get weight() {
+                return this.__table.columns.weight[this.__index];
+            }
+
+            get height() {
+                return this.__table.columns.height[this.__index];
+            }
+
+            get frontAtlasAssetAdress() {
+                return this.__table.columns.frontAtlasAssetAdress[this.__index];
+            }
+
+            get backAtlasAssetAdress() {
+                return this.__table.columns.backAtlasAssetAdress[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: [], baseForme: [], otherFormes: [], abilities: [], prevo: [], evos: [], tier: [], doublesTier: [], natDexTier: [], eggGroups: [], genderRatio: []};
+            this.columns = {
+                id: new Int32Array(length),
+                num: new Int32Array(length),
+                name: new Uint32Array(length),
+                gen: new Int32Array(length),
+                baseForme: new Uint32Array(length),
+                otherFormes: new Uint32Array(length),
+                abilities: new Uint32Array(length),
+                pokeTypes: new Array(length),
+                prevo: new Uint32Array(length),
+                evos: new Uint32Array(length),
+                evoLevel: new Int32Array(length),
+                tier: new Uint32Array(length),
+                doublesTier: new Uint32Array(length),
+                natDexTier: new Uint32Array(length),
+                eggGroups: new Uint32Array(length),
+                canHatch: new Uint8Array(length),
+                genderRatio: new Uint32Array(length),
+                hp: new Int32Array(length),
+                atk: new Int32Array(length),
+                def: new Int32Array(length),
+                spa: new Int32Array(length),
+                spd: new Int32Array(length),
+                spe: new Int32Array(length),
+                weight: new Float32Array(length),
+                height: new Float32Array(length),
+                frontAtlasAssetAdress: new Array(length),
+                backAtlasAssetAdress: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new PokemonColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            const baseFormeCodes = new Map();
+            const otherFormesCodes = new Map();
+            const abilitiesCodes = new Map();
+            const prevoCodes = new Map();
+            const evosCodes = new Map();
+            const tierCodes = new Map();
+            const doublesTierCodes = new Map();
+            const natDexTierCodes = new Map();
+            const eggGroupsCodes = new Map();
+            const genderRatioCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.num[i] = row.num ?? 0;
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.gen[i] = row.gen ?? 0;
+                columns.baseForme[i] = __columnEncode(baseFormeCodes, dictionaries.baseForme, row.baseForme ?? "");
+                columns.otherFormes[i] = __columnEncode(otherFormesCodes, dictionaries.otherFormes, row.otherFormes ?? "");
+                columns.abilities[i] = __columnEncode(abilitiesCodes, dictionaries.abilities, row.abilities ?? "");
+                columns.pokeTypes[i] = row.pokeTypes;
+                columns.prevo[i] = __columnEncode(prevoCodes, dictionaries.prevo, row.prevo ?? "");
+                columns.evos[i] = __columnEncode(evosCodes, dictionaries.evos, row.evos ?? "");
+                columns.evoLevel[i] = row.evoLevel ?? 0;
+                columns.tier[i] = __columnEncode(tierCodes, dictionaries.tier, row.tier ?? "");
+                columns.doublesTier[i] = __columnEncode(doublesTierCodes, dictionaries.doublesTier, row.doublesTier ?? "");
+                columns.natDexTier[i] = __columnEncode(natDexTierCodes, dictionaries.natDexTier, row.natDexTier ?? "");
+                columns.eggGroups[i] = __columnEncode(eggGroupsCodes, dictionaries.eggGroups, row.eggGroups ?? "");
+                columns.canHatch[i] = row.canHatch ? 1 : 0;
+                columns.genderRatio[i] = __columnEncode(genderRatioCodes, dictionaries.genderRatio, row.genderRatio ?? "");
+                columns.hp[i] = row.hp ?? 0;
+                columns.atk[i] = row.atk ?? 0;
+                columns.def[i] = row.def ?? 0;
+                columns.spa[i] = row.spa ?? 0;
+                columns.spd[i] = row.spd ?? 0;
+                columns.spe[i] = row.spe ?? 0;
+                columns.weight[i] = row.weight ?? 0;
+                columns.height[i] = row.height ?? 0;
+                columns.frontAtlasAssetAdress[i] = row.frontAtlasAssetAdress;
+                columns.backAtlasAssetAdress[i] = row.backAtlasAssetAdress;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: PokeTypeInfo
@@ -740,6 +3684,7 @@ export class PokeTypeInfo {
         get clrType() { return PokeTypeInfo; },
         fullName: "pokeworld.pokemon.cfg.PokeTypeInfo",
         package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
             {name: "type", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.pokemon.cfg.PokeType", get clrType() { return PokeType; },label: "LABEL_OPTIONAL"},
@@ -748,8 +3693,23 @@ export class PokeTypeInfo {
         ]
     }
 
+    constructor() {
+        this.__id = 0;
+        this.__type = PokeType.NORMAL;
+        this.__atlasIndex = 0;
+        this.__color = "";
+    }
+
+    __id = undefined;
+
     /** @type {number} */
-    id;
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
     /** 
      * @param {number} value 
@@ -757,11 +3717,21 @@ export class PokeTypeInfo {
      */
     withId(value) {
         this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __type = undefined;
+
     /** @type {PokeType[keyof typeof PokeType]} */
-    type;
+    get type() {
+        return this.__type;
+    }
+    set type(value) {
+        this.__rawStale = true;
+        this.__type = value;
+    }
 
     /** 
      * @param {PokeType[keyof typeof PokeType]} value 
@@ -769,11 +3739,21 @@ export class PokeTypeInfo {
      */
     withType(value) {
         this.type = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
+    __atlasIndex = undefined;
+
     /** @type {number} */
-    atlasIndex;
+    get atlasIndex() {
+        return this.__atlasIndex;
+    }
+    set atlasIndex(value) {
+        this.__rawStale = true;
+        this.__atlasIndex = value;
+    }
 
     /** 
      * @param {number} value 
@@ -781,11 +3761,21 @@ export class PokeTypeInfo {
      */
     withAtlasIndex(value) {
         this.atlasIndex = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
+    __color = undefined;
+
     /** @type {string} */
-    color;
+    get color() {
+        return this.__color;
+    }
+    set color(value) {
+        this.__rawStale = true;
+        this.__color = value;
+    }
 
     /** 
      * @param {string} value 
@@ -793,86 +3783,1543 @@ export class PokeTypeInfo {
      */
     withColor(value) {
         this.color = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
         return this;
     }
 
-}
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
 
-// Message: TbPokemon
-export class TbPokemon {
-    static __descriptor = {
-        name: "TbPokemon",
-        get clrType() { return TbPokemon; },
-        fullName: "pokeworld.pokemon.cfg.TbPokemon",
-        package: "pokeworld.pokemon.cfg",
-        fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.Pokemon", get clrType() { return Pokemon; },label: "LABEL_REPEATED"}
-        ]
+    static __knownKeys = new Set(["id", "type", "atlasIndex", "color"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-    /** @type {Pokemon[]} */
-    dataList;
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
 
     /** 
-     * @param {Pokemon[]} value 
-     * @return {TbPokemon} 
+     * @return {PokeTypeInfo} a deep copy of this message
      */
-    withDataList(value) {
-        this.dataList = value;
-        return this;
+    clone() {
+        return new PokeTypeInfo().copyFrom(this);
     }
 
-}
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {PokeTypeInfo} other 
+     * @return {PokeTypeInfo} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.type = other.type;
+        this.atlasIndex = other.atlasIndex;
+        this.color = other.color;
+        return this;
+    }
 
-// Message: TbMove
-export class TbMove {
-    static __descriptor = {
-        name: "TbMove",
-        get clrType() { return TbMove; },
-        fullName: "pokeworld.pokemon.cfg.TbMove",
-        package: "pokeworld.pokemon.cfg",
-        fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.Move", get clrType() { return Move; },label: "LABEL_REPEATED"}
-        ]
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {PokeTypeInfo} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof PokeTypeInfo)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.type ?? PokeType.NORMAL) !== (other.type ?? PokeType.NORMAL)) return false;
+        if ((this.atlasIndex ?? 0) !== (other.atlasIndex ?? 0)) return false;
+        if ((this.color ?? "") !== (other.color ?? "")) return false;
+        return true;
     }
 
-    /** @type {Move[]} */
-    dataList;
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashNumber(hash, this.type ?? PokeType.NORMAL);
+        hash = __hashNumber(hash, this.atlasIndex ?? 0);
+        hash = __hashString(hash, this.color ?? "");
+        return hash;
+    }
 
     /** 
-     * @param {Move[]} value 
-     * @return {TbMove} 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {PokeTypeInfo} 
      */
-    withDataList(value) {
-        this.dataList = value;
+    clear() {
+        this.id = 0;
+        this.type = PokeType.NORMAL;
+        this.atlasIndex = 0;
+        this.color = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-}
+    static __pool = [];
 
-// Message: TbPokeTypeInfo
-export class TbPokeTypeInfo {
-    static __descriptor = {
-        name: "TbPokeTypeInfo",
-        get clrType() { return TbPokeTypeInfo; },
-        fullName: "pokeworld.pokemon.cfg.TbPokeTypeInfo",
-        package: "pokeworld.pokemon.cfg",
-        fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.PokeTypeInfo", get clrType() { return PokeTypeInfo; },label: "LABEL_REPEATED"}
-        ]
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {PokeTypeInfo} 
+     */
+    static acquire() {
+        const message = PokeTypeInfo.__pool.pop();
+        if (message === undefined) return new PokeTypeInfo();
+        message.__released = false;
+        return message;
     }
 
-    /** @type {PokeTypeInfo[]} */
-    dataList;
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {PokeTypeInfo} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('PokeTypeInfo instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (PokeTypeInfo.__pool.length < 64) {
+            PokeTypeInfo.__pool.push(message);
+        }
+    }
 
     /** 
-     * @param {PokeTypeInfo[]} value 
-     * @return {TbPokeTypeInfo} 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
      */
-    withDataList(value) {
-        this.dataList = value;
-        return this;
+    __releaseOwned() {
     }
 
-}
+    // Dirty field bitmask
+    __dirty0 = 0;
 
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).type = this.type; break;
+                case 4: (full ??= {}).atlasIndex = this.atlasIndex; break;
+                case 8: (full ??= {}).color = this.color; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {PokeTypeInfo} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.type) !== undefined) {
+                this.type = value;
+            }
+            if ((value = full.atlasIndex) !== undefined) {
+                this.atlasIndex = value;
+            }
+            if ((value = full.color) !== undefined) {
+                this.color = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {PokeTypeInfo} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            type: this.type,
+            atlasIndex: this.atlasIndex,
+            color: this.color,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, PokeTypeInfo.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.type;
+        if (value != null && !__isEnum(PokeType, value)) return __invalid("type", "enum PokeType");
+        value = json.atlasIndex;
+        if (value != null && !__isInt32(value)) return __invalid("atlasIndex", "int32");
+        value = json.color;
+        if (value != null && !__isString(value)) return __invalid("color", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {PokeTypeInfo}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = PokeTypeInfo.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.type;
+            if (value != null) {
+                if (!__isEnum(PokeType, value)) throw __invalid("type", "enum PokeType");
+                message.type = value;
+            }
+            value = json.atlasIndex;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("atlasIndex", "int32");
+                message.atlasIndex = value;
+            }
+            value = json.color;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("color", "string");
+                message.color = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            PokeTypeInfo.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class PokeTypeInfoView {
+        static __layout = {
+            size: 24,
+            hash: 0x75385bcd,
+            presence: 8,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 8},
+                {name: "type", type: "TYPE_ENUM", offset: 12},
+                {name: "atlasIndex", type: "TYPE_INT32", offset: 16},
+                {name: "color", type: "TYPE_STRING", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, PokeTypeInfoView.__layout.hash);
+            return new PokeTypeInfoView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+
+        get type() {
+            return __flatInt32(this.__view, this.__offset + 12);
+        }
+
+        get atlasIndex() {
+            return __flatInt32(this.__view, this.__offset + 16);
+        }
+
+        get color() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class PokeTypeInfoColumns extends __ColumnTable {
+        static Row = class PokeTypeInfoRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get type() {
+                return this.__table.columns.type[this.__index];
+            }
+
+            get atlasIndex() {
+                return this.__table.columns.atlasIndex[this.__index];
+            }
+
+            get color() {
+                const table = this.__table;
+                return table.dictionaries.color[table.columns.color[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {color: []};
+            this.columns = {
+                id: new Int32Array(length),
+                type: new Int32Array(length),
+                atlasIndex: new Int32Array(length),
+                color: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new PokeTypeInfoColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const colorCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.type[i] = row.type ?? PokeType.NORMAL;
+                columns.atlasIndex[i] = row.atlasIndex ?? 0;
+                columns.color[i] = __columnEncode(colorCodes, dictionaries.color, row.color ?? "");
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TbPokemon
+export class TbPokemon {
+    static __descriptor = {
+        name: "TbPokemon",
+        get clrType() { return TbPokemon; },
+        fullName: "pokeworld.pokemon.cfg.TbPokemon",
+        package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.Pokemon", get clrType() { return Pokemon; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
+    /** @type {Pokemon[]} */
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbPokemon.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
+
+    /** 
+     * @param {Pokemon[]} value 
+     * @return {TbPokemon} 
+     */
+    withDataList(value) {
+        this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbPokemon} a deep copy of this message
+     */
+    clone() {
+        return new TbPokemon().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbPokemon} other 
+     * @return {TbPokemon} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbPokemon} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbPokemon)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbPokemon} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbPokemon} 
+     */
+    static acquire() {
+        const message = TbPokemon.__pool.pop();
+        if (message === undefined) return new TbPokemon();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbPokemon} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbPokemon instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbPokemon.__pool.length < 64) {
+            TbPokemon.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof Pokemon) Pokemon.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbPokemon} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof Pokemon ? item.clone().commit() : new Pokemon().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbPokemon} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbPokemon.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Pokemon.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbPokemon}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbPokemon.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Pokemon, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbPokemon.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbPokemonView {
+        static __layout = {
+            size: 8,
+            hash: 0x6c230232,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Pokemon.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbPokemonView.__layout.hash);
+            return new TbPokemonView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Pokemon.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbPokemonColumns extends __ColumnTable {
+        static Row = class TbPokemonRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbPokemonColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TbMove
+export class TbMove {
+    static __descriptor = {
+        name: "TbMove",
+        get clrType() { return TbMove; },
+        fullName: "pokeworld.pokemon.cfg.TbMove",
+        package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.Move", get clrType() { return Move; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
+    /** @type {Move[]} */
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbMove.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
+
+    /** 
+     * @param {Move[]} value 
+     * @return {TbMove} 
+     */
+    withDataList(value) {
+        this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbMove} a deep copy of this message
+     */
+    clone() {
+        return new TbMove().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbMove} other 
+     * @return {TbMove} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbMove} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbMove)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbMove} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbMove} 
+     */
+    static acquire() {
+        const message = TbMove.__pool.pop();
+        if (message === undefined) return new TbMove();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbMove} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbMove instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbMove.__pool.length < 64) {
+            TbMove.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof Move) Move.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbMove} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof Move ? item.clone().commit() : new Move().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbMove} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbMove.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Move.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbMove}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbMove.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Move, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbMove.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbMoveView {
+        static __layout = {
+            size: 8,
+            hash: 0x62a2a116,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Move.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbMoveView.__layout.hash);
+            return new TbMoveView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Move.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbMoveColumns extends __ColumnTable {
+        static Row = class TbMoveRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbMoveColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TbPokeTypeInfo
+export class TbPokeTypeInfo {
+    static __descriptor = {
+        name: "TbPokeTypeInfo",
+        get clrType() { return TbPokeTypeInfo; },
+        fullName: "pokeworld.pokemon.cfg.TbPokeTypeInfo",
+        package: "pokeworld.pokemon.cfg",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.cfg.PokeTypeInfo", get clrType() { return PokeTypeInfo; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
+    /** @type {PokeTypeInfo[]} */
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbPokeTypeInfo.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
+
+    /** 
+     * @param {PokeTypeInfo[]} value 
+     * @return {TbPokeTypeInfo} 
+     */
+    withDataList(value) {
+        this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbPokeTypeInfo} a deep copy of this message
+     */
+    clone() {
+        return new TbPokeTypeInfo().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbPokeTypeInfo} other 
+     * @return {TbPokeTypeInfo} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbPokeTypeInfo} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbPokeTypeInfo)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbPokeTypeInfo} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbPokeTypeInfo} 
+     */
+    static acquire() {
+        const message = TbPokeTypeInfo.__pool.pop();
+        if (message === undefined) return new TbPokeTypeInfo();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbPokeTypeInfo} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbPokeTypeInfo instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbPokeTypeInfo.__pool.length < 64) {
+            TbPokeTypeInfo.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof PokeTypeInfo) PokeTypeInfo.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbPokeTypeInfo} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof PokeTypeInfo ? item.clone().commit() : new PokeTypeInfo().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbPokeTypeInfo} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbPokeTypeInfo.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = PokeTypeInfo.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbPokeTypeInfo}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbPokeTypeInfo.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(PokeTypeInfo, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbPokeTypeInfo.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbPokeTypeInfoView {
+        static __layout = {
+            size: 8,
+            hash: 0x2e9db436,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return PokeTypeInfo.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbPokeTypeInfoView.__layout.hash);
+            return new TbPokeTypeInfoView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, PokeTypeInfo.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbPokeTypeInfoColumns extends __ColumnTable {
+        static Row = class TbPokeTypeInfoRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbPokeTypeInfoColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/pokemon/cfg_pokemon.proto",
+    dependencies: ["pokeworld/resource/cfg_resource.proto", "pokeworld/config/cfg_options.proto"],
+    data: "CiNwb2tld29ybGQvcG9rZW1vbi9jZmdfcG9rZW1vbi5wcm90bxIVcG9rZXdvcmxkLnBva2Vtb24uY2ZnGiVwb2tld29ybGQvcmVzb3VyY2UvY2ZnX3Jlc291cmNlLnByb3RvGiJwb2tld29ybGQvY29uZmlnL2NmZ19vcHRpb25zLnByb3RvIrIFCgRNb3ZlEg4KAmlkGAEgASgFUgJpZBIQCgNudW0YAiABKAVSA251bRISCgRuYW1lGAMgASgJUgRuYW1lEhAKA2dlbhgEIAEoBVIDZ2VuEh0KCmJhc2VfcG93ZXIYBSABKAVSCWJhc2VQb3dlchIOCgJwcBgGIAEoBVICcHASMwoEdHlwZRgHIAEoDjIfLnBva2V3b3JsZC5wb2tlbW9uLmNmZy5Qb2tlVHlwZVIEdHlwZRI/CghjYXRlZ29yeRgIIAEoDjIjLnBva2V3b3JsZC5wb2tlbW9uLmNmZy5Nb3ZlQ2F0ZWdvcnlSCGNhdGVnb3J5EhYKBnRhcmdldBgJIAEoCVIGdGFyZ2V0EhoKCGFjY3VyYWN5GAogASgFUghhY2N1cmFjeRIdCgpjcml0X3JhdGlvGAsgASgFUgljcml0UmF0aW8SIAoLc2Vjb25kYXJpZXMYDCABKAlSC3NlY29uZGFyaWVzEhoKCHByaW9yaXR5GA0gASgFUghwcmlvcml0eRIpChBpZ25vcmVfb2ZmZW5zaXZlGA4gASgJUg9pZ25vcmVPZmZlbnNpdmUSKQoQaWdub3JlX2RlZmVuc2l2ZRgPIAEoCVIPaWdub3JlRGVmZW5zaXZlEicKD2lnbm9yZV9pbW11bml0eRgQIAEoCVIOaWdub3JlSW1tdW5pdHkSJQoOaWdub3JlX2V2YXNpb24YESABKAlSDWlnbm9yZUV2YXNpb24SJgoPaGFzX3NoZWVyX2ZvcmNlGBIgASgIUg1oYXNTaGVlckZvcmNlEiAKDG5vX3BwX2Jvb3N0cxgTIAEoCFIKbm9QcEJvb3N0cxIlCg5pZ25vcmVfYWJpbGl0eRgUIAEoCFINaWdub3JlQWJpbGl0eRIVCgZ6X21vdmUYFSABKAlSBXpNb3ZlIugGCgdQb2tlbW9uEg4KAmlkGAEgASgFUgJpZBIQCgNudW0YAiABKAVSA251bRISCgRuYW1lGAMgASgJUgRuYW1lEhAKA2dlbhgEIAEoBVIDZ2VuEh0KCmJhc2VfZm9ybWUYBSABKAlSCWJhc2VGb3JtZRIhCgxvdGhlcl9mb3JtZXMYBiABKAlSC290aGVyRm9ybWVzEhwKCWFiaWxpdGllcxgHIAEoCVIJYWJpbGl0aWVzEkIKCnBva2VfdHlwZXMYCCADKA4yHy5wb2tld29ybGQucG9rZW1vbi5jZmcuUG9rZVR5cGVCAhAAUglwb2tlVHlwZXMSFAoFcHJldm8YCSABKAlSBXByZXZvEhIKBGV2b3MYCiABKAlSBGV2b3MSGwoJZXZvX2xldmVsGAsgASgFUghldm9MZXZlbBIYCgR0aWVyGAwgASgJQgSIowUBUgR0aWVyEicKDGRvdWJsZXNfdGllchgNIAEoCUIEiKMFAVILZG91Ymxlc1RpZXISJgoMbmF0X2RleF90aWVyGA4gASgJQgSIowUBUgpuYXREZXhUaWVyEiMKCmVnZ19ncm91cHMYDyABKAlCBIijBQFSCWVnZ0dyb3VwcxIbCgljYW5faGF0Y2gYECABKAhSCGNhbkhhdGNoEicKDGdlbmRlcl9yYXRpbxgRIAEoCUIEiKMFAVILZ2VuZGVyUmF0aW8SDgoCaHAYEiABKAVSAmhwEhAKA2F0axgTIAEoBVIDYXRrEhAKA2RlZhgUIAEoBVIDZGVmEhAKA3NwYRgVIAEoBVIDc3BhEhAKA3NwZBgWIAEoBVIDc3BkEhAKA3NwZRgXIAEoBVIDc3BlEhYKBndlaWdodBgYIAEoAlIGd2VpZ2h0EhYKBmhlaWdodBgZIAEoAlIGaGVpZ2h0El0KGGZyb250X2F0bGFzX2Fzc2V0X2FkcmVzcxgaIAEoCzIkLnBva2V3b3JsZC5yZXNvdXJjZS5jZmcuQXNzZXRBZGRyZXNzUhVmcm9udEF0bGFzQXNzZXRBZHJlc3MSWwoXYmFja19hdGxhc19hc3NldF9hZHJlc3MYGyABKAsyJC5wb2tld29ybGQucmVzb3VyY2UuY2ZnLkFzc2V0QWRkcmVzc1IUYmFja0F0bGFzQXNzZXRBZHJlc3MiigEKDFBva2VUeXBlSW5mbxIOCgJpZBgBIAEoBVICaWQSMwoEdHlwZRgCIAEoDjIfLnBva2V3b3JsZC5wb2tlbW9uLmNmZy5Qb2tlVHlwZVIEdHlwZRIfCgthdGxhc19pbmRleBgDIAEoBVIKYXRsYXNJbmRleBIUCgVjb2xvchgEIAEoCVIFY29sb3IiTAoJVGJQb2tlbW9uEj8KCWRhdGFfbGlzdBgBIAMoCzIeLnBva2V3b3JsZC5wb2tlbW9uLmNmZy5Qb2tlbW9uQgIQAFIIZGF0YUxpc3QiRgoGVGJNb3ZlEjwKCWRhdGFfbGlzdBgBIAMoCzIbLnBva2V3b3JsZC5wb2tlbW9uLmNmZy5Nb3ZlQgIQAFIIZGF0YUxpc3QiVgoOVGJQb2tlVHlwZUluZm8SRAoJZGF0YV9saXN0GAEgAygLMiMucG9rZXdvcmxkLnBva2Vtb24uY2ZnLlBva2VUeXBlSW5mb0ICEABSCGRhdGFMaXN0KlwKDE1vdmVDYXRlZ29yeRIZChVNT1ZFQ0FURUdPUllfUEhZU0lDQUwQABIYChRNT1ZFQ0FURUdPUllfU1BFQ0lBTBABEhcKE01PVkVDQVRFR09SWV9TVEFUVVMQAiqOAwoIUG9rZVR5cGUSEwoPUE9LRVRZUEVfTk9STUFMEAASEwoPUE9LRVRZUEVfRkxZSU5HEAESEQoNUE9LRVRZUEVfRklSRRACEhQKEFBPS0VUWVBFX1BTWUNISUMQAxISCg5QT0tFVFlQRV9XQVRFUhAEEhAKDFBPS0VUWVBFX0JVRxAFEhUKEVBPS0VUWVBFX0VMRUNUUklDEAYSEQoNUE9LRVRZUEVfUk9DSxAHEhIKDlBPS0VUWVBFX0dSQVNTEAgSEgoOUE9LRVRZUEVfR0hPU1QQCRIQCgxQT0tFVFlQRV9JQ0UQChITCg9QT0tFVFlQRV9EUkFHT04QCxIVChFQT0tFVFlQRV9GSUdIVElORxAMEhEKDVBPS0VUWVBFX0RBUksQDRITCg9QT0tFVFlQRV9QT0lTT04QDhISCg5QT0tFVFlQRV9TVEVFTBAPEhMKD1BPS0VUWVBFX0dST1VORBAQEhIKDlBPS0VUWVBFX0ZBSVJZEBESFAoQUE9LRVRZUEVfVU5LTk9XThASYgZwcm90bzM=",
+};
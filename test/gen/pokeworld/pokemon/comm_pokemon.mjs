@@ -0,0 +1,1717 @@
+// Generated by protoc-gen-js-mjs
+// Source: pokeworld/pokemon/comm_pokemon.proto
+
+// Package: pokeworld.pokemon.comm
+
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
+// Message: __Evolution_Stage_Condition
+class __Evolution_Stage_Condition {
+    static __descriptor = {
+        name: "Condition",
+        get clrType() { return __Evolution_Stage_Condition; },
+        fullName: "pokeworld.pokemon.comm.Evolution.Stage.Condition",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "minLevel", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "itemId", number: 2, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__minLevel = 0;
+        this.__itemId = 0;
+    }
+
+    __minLevel = undefined;
+
+    /** @type {number} */
+    get minLevel() {
+        return this.__minLevel;
+    }
+    set minLevel(value) {
+        this.__rawStale = true;
+        this.__minLevel = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {__Evolution_Stage_Condition} 
+     */
+    withMinLevel(value) {
+        this.minLevel = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __itemId = undefined;
+
+    /** @type {number} */
+    get itemId() {
+        return this.__itemId;
+    }
+    set itemId(value) {
+        this.__rawStale = true;
+        this.__itemId = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {__Evolution_Stage_Condition} 
+     */
+    withItemId(value) {
+        this.itemId = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["minLevel", "itemId"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {__Evolution_Stage_Condition} a deep copy of this message
+     */
+    clone() {
+        return new __Evolution_Stage_Condition().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {__Evolution_Stage_Condition} other 
+     * @return {__Evolution_Stage_Condition} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.minLevel = other.minLevel;
+        this.itemId = other.itemId;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {__Evolution_Stage_Condition} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof __Evolution_Stage_Condition)) return false;
+        if ((this.minLevel ?? 0) !== (other.minLevel ?? 0)) return false;
+        if ((this.itemId ?? 0) !== (other.itemId ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.minLevel ?? 0);
+        hash = __hashNumber(hash, this.itemId ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {__Evolution_Stage_Condition} 
+     */
+    clear() {
+        this.minLevel = 0;
+        this.itemId = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {__Evolution_Stage_Condition} 
+     */
+    static acquire() {
+        const message = __Evolution_Stage_Condition.__pool.pop();
+        if (message === undefined) return new __Evolution_Stage_Condition();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {__Evolution_Stage_Condition} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('__Evolution_Stage_Condition instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (__Evolution_Stage_Condition.__pool.length < 64) {
+            __Evolution_Stage_Condition.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).minLevel = this.minLevel; break;
+                case 2: (full ??= {}).itemId = this.itemId; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {__Evolution_Stage_Condition} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.minLevel) !== undefined) {
+                this.minLevel = value;
+            }
+            if ((value = full.itemId) !== undefined) {
+                this.itemId = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {__Evolution_Stage_Condition} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            minLevel: this.minLevel,
+            itemId: this.itemId,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, __Evolution_Stage_Condition.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.minLevel;
+        if (value != null && !__isInt32(value)) return __invalid("minLevel", "int32");
+        value = json.itemId;
+        if (value != null && !__isInt32(value)) return __invalid("itemId", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {__Evolution_Stage_Condition}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = __Evolution_Stage_Condition.acquire();
+        try {
+            let value;
+            value = json.minLevel;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("minLevel", "int32");
+                message.minLevel = value;
+            }
+            value = json.itemId;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("itemId", "int32");
+                message.itemId = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            __Evolution_Stage_Condition.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class __Evolution_Stage_ConditionView {
+        static __layout = {
+            size: 8,
+            hash: 0x8ba59430,
+            presence: 0,
+            fields: [
+                {name: "minLevel", type: "TYPE_INT32", offset: 0},
+                {name: "itemId", type: "TYPE_INT32", offset: 4}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, __Evolution_Stage_ConditionView.__layout.hash);
+            return new __Evolution_Stage_ConditionView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get minLevel() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get itemId() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class __Evolution_Stage_ConditionColumns extends __ColumnTable {
+        static Row = class __Evolution_Stage_ConditionRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get minLevel() {
+                return this.__table.columns.minLevel[this.__index];
+            }
+
+            get itemId() {
+                return this.__table.columns.itemId[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                minLevel: new Int32Array(length),
+                itemId: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new __Evolution_Stage_ConditionColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.minLevel[i] = row.minLevel ?? 0;
+                columns.itemId[i] = row.itemId ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: __Evolution_Stage
+class __Evolution_Stage {
+    static __descriptor = {
+        name: "Stage",
+        get clrType() { return __Evolution_Stage; },
+        fullName: "pokeworld.pokemon.comm.Evolution.Stage",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "speciesId", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "trigger", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.pokemon.comm.Evolution.Trigger", get clrType() { return Evolution.Trigger; },label: "LABEL_OPTIONAL"},
+            {name: "condition", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.comm.Evolution.Stage.Condition", get clrType() { return __Evolution_Stage_Condition; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__speciesId = 0;
+        this.__trigger = Evolution.Trigger.NONE;
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __speciesId = undefined;
+
+    /** @type {number} */
+    get speciesId() {
+        return this.__speciesId;
+    }
+    set speciesId(value) {
+        this.__rawStale = true;
+        this.__speciesId = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {__Evolution_Stage} 
+     */
+    withSpeciesId(value) {
+        this.speciesId = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __trigger = undefined;
+
+    /** @type {Evolution.Trigger[keyof typeof Evolution.Trigger]} */
+    get trigger() {
+        return this.__trigger;
+    }
+    set trigger(value) {
+        this.__rawStale = true;
+        this.__trigger = value;
+    }
+
+    /** 
+     * @param {Evolution.Trigger[keyof typeof Evolution.Trigger]} value 
+     * @return {__Evolution_Stage} 
+     */
+    withTrigger(value) {
+        this.trigger = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __condition = undefined;
+    __conditionRaw = undefined;
+
+    /** @type {__Evolution_Stage_Condition|undefined} */
+    get condition() {
+        if (this.__conditionRaw !== undefined) {
+            this.__condition = this.__decode(__Evolution_Stage.__descriptor.fields[2], this.__conditionRaw, this.__condition);
+            this.__conditionRaw = undefined;
+        }
+        return this.__condition;
+    }
+    set condition(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__conditionRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__condition = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__condition = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasCondition() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {__Evolution_Stage} 
+     */
+    clearCondition() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__condition = undefined;
+        this.__conditionRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__Evolution_Stage_Condition} value 
+     * @return {__Evolution_Stage} 
+     */
+    withCondition(value) {
+        this.condition = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 3:
+                this.__dirty0 |= 4;
+                this.__condition = undefined;
+                this.__conditionRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["speciesId", "trigger", "condition"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__condition) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {__Evolution_Stage} a deep copy of this message
+     */
+    clone() {
+        return new __Evolution_Stage().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {__Evolution_Stage} other 
+     * @return {__Evolution_Stage} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.speciesId = other.speciesId;
+        this.trigger = other.trigger;
+        this.condition = __cloneMessage(other.condition);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {__Evolution_Stage} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof __Evolution_Stage)) return false;
+        if ((this.speciesId ?? 0) !== (other.speciesId ?? 0)) return false;
+        if ((this.trigger ?? Evolution.Trigger.NONE) !== (other.trigger ?? Evolution.Trigger.NONE)) return false;
+        if (!__equalsMessage(this.condition, other.condition)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.speciesId ?? 0);
+        hash = __hashNumber(hash, this.trigger ?? Evolution.Trigger.NONE);
+        hash = __hashMessage(hash, this.condition);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {__Evolution_Stage} 
+     */
+    clear() {
+        this.speciesId = 0;
+        this.trigger = Evolution.Trigger.NONE;
+        this.__condition = undefined;
+        this.__conditionRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {__Evolution_Stage} 
+     */
+    static acquire() {
+        const message = __Evolution_Stage.__pool.pop();
+        if (message === undefined) return new __Evolution_Stage();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {__Evolution_Stage} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('__Evolution_Stage instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (__Evolution_Stage.__pool.length < 64) {
+            __Evolution_Stage.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__condition) instanceof __Evolution_Stage_Condition) __Evolution_Stage_Condition.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).speciesId = this.speciesId; break;
+                case 2: (full ??= {}).trigger = this.trigger; break;
+                case 4: (full ??= {}).condition = this.condition ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 4) === 0 && (value = this.condition) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).condition = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {__Evolution_Stage} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.speciesId) !== undefined) {
+                this.speciesId = value;
+            }
+            if ((value = full.trigger) !== undefined) {
+                this.trigger = value;
+            }
+            if ((value = full.condition) !== undefined) {
+                this.condition = value === null ? undefined : (value instanceof __Evolution_Stage_Condition ? value.clone().commit() : new __Evolution_Stage_Condition().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.condition) !== undefined) {
+                (this.condition ?? (this.condition = new __Evolution_Stage_Condition())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {__Evolution_Stage} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.condition)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            speciesId: this.speciesId,
+            trigger: this.trigger,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.condition = this.__conditionRaw ?? this.__condition; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, __Evolution_Stage.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.speciesId;
+        if (value != null && !__isInt32(value)) return __invalid("speciesId", "int32");
+        value = json.trigger;
+        if (value != null && !__isEnum(Evolution.Trigger, value)) return __invalid("trigger", "enum Trigger");
+        value = json.condition;
+        if (value != null && (error = __Evolution_Stage_Condition.validate(value)) !== null) return __prefixError(error, "condition");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {__Evolution_Stage}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = __Evolution_Stage.acquire();
+        try {
+            let value;
+            value = json.speciesId;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("speciesId", "int32");
+                message.speciesId = value;
+            }
+            value = json.trigger;
+            if (value != null) {
+                if (!__isEnum(Evolution.Trigger, value)) throw __invalid("trigger", "enum Trigger");
+                message.trigger = value;
+            }
+            value = json.condition;
+            if (value != null) {
+                message.condition = __decodeNested(__Evolution_Stage_Condition, value, "condition");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            __Evolution_Stage.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class __Evolution_StageView {
+        static __layout = {
+            size: 16,
+            hash: 0xbc6cf334,
+            presence: 0,
+            fields: [
+                {name: "speciesId", type: "TYPE_INT32", offset: 0},
+                {name: "trigger", type: "TYPE_ENUM", offset: 4},
+                {name: "condition", type: "TYPE_MESSAGE", offset: 8, get view() { return __Evolution_Stage_Condition.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, __Evolution_StageView.__layout.hash);
+            return new __Evolution_StageView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get speciesId() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get trigger() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+
+        get condition() {
+            return __flatMessage(this.__view, this.__offset + 8, __Evolution_Stage_Condition.View);
+        }
+
+        hasCondition() {
+            return this.condition !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class __Evolution_StageColumns extends __ColumnTable {
+        static Row = class __Evolution_StageRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get speciesId() {
+                return this.__table.columns.speciesId[this.__index];
+            }
+
+            get trigger() {
+                return this.__table.columns.trigger[this.__index];
+            }
+
+            get condition() {
+                return this.__table.columns.condition[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                speciesId: new Int32Array(length),
+                trigger: new Int32Array(length),
+                condition: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new __Evolution_StageColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.speciesId[i] = row.speciesId ?? 0;
+                columns.trigger[i] = row.trigger ?? Evolution.Trigger.NONE;
+                columns.condition[i] = row.condition;
+            }
+            return table;
+        }
+    };
+
+    static Condition = __Evolution_Stage_Condition;
+}
+
+// Enum: __Evolution_Trigger
+const __Evolution_Trigger = {
+    NONE: 0,
+    LEVEL_UP: 1,
+    ITEM: 2,
+};
+Object.defineProperty(__Evolution_Trigger, "__descriptor", {
+    value: {
+        name: "Trigger",
+        get clrType() { return __Evolution_Trigger; },
+        fullName: "pokeworld.pokemon.comm.Evolution.Trigger",
+        get file() { return __fileDescriptor; },
+        values: [
+            {name: "NONE", originalName: "TRIGGER_NONE", number: 0},
+            {name: "LEVEL_UP", originalName: "TRIGGER_LEVEL_UP", number: 1},
+            {name: "ITEM", originalName: "TRIGGER_ITEM", number: 2}
+        ],
+        valueIndex: [0, 1, 2]
+    },
+    enumerable: false,
+    writable: false,
+});
+Object.freeze(__Evolution_Trigger);
+
+// Message: Evolution
+export class Evolution {
+    static __descriptor = {
+        name: "Evolution",
+        get clrType() { return Evolution; },
+        fullName: "pokeworld.pokemon.comm.Evolution",
+        package: "pokeworld.pokemon.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "stages", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.pokemon.comm.Evolution.Stage", get clrType() { return __Evolution_Stage; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.stages = [];
+    }
+
+    __stages = undefined;
+    __stagesRaw = undefined;
+
+    /** @type {__Evolution_Stage[]} */
+    get stages() {
+        if (this.__stagesRaw !== undefined) {
+            this.__stages = this.__decode(Evolution.__descriptor.fields[0], this.__stagesRaw, this.__stages);
+            this.__stagesRaw = undefined;
+        }
+        return this.__stages;
+    }
+    set stages(value) {
+        this.__rawStale = true;
+        this.__stagesRaw = undefined;
+        this.__stages = value;
+    }
+
+    /** 
+     * @param {__Evolution_Stage[]} value 
+     * @return {Evolution} 
+     */
+    withStages(value) {
+        this.stages = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__stagesRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["stages"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__stages) != null) {
+            raw = this.__raw.stages;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {Evolution} a deep copy of this message
+     */
+    clone() {
+        return new Evolution().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Evolution} other 
+     * @return {Evolution} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.stages = __cloneArray(other.stages, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Evolution} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Evolution)) return false;
+        if (!__equalsArray(this.stages, other.stages, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.stages, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Evolution} 
+     */
+    clear() {
+        this.__stagesRaw = undefined;
+        if (Array.isArray(this.stages)) this.stages.length = 0; else this.stages = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Evolution} 
+     */
+    static acquire() {
+        const message = Evolution.__pool.pop();
+        if (message === undefined) return new Evolution();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Evolution} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Evolution instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Evolution.__pool.length < 64) {
+            Evolution.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__stages)) {
+            for (const item of this.__stages) {
+                if (item instanceof __Evolution_Stage) __Evolution_Stage.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).stages = this.stages; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.stages)) {
+            const list = this.stages;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).stages = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Evolution} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.stages) !== undefined) {
+                this.stages = value === null ? [] : value.map(item => (item instanceof __Evolution_Stage ? item.clone().commit() : new __Evolution_Stage().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.stages) !== undefined) {
+                const list = this.stages;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Evolution} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.stages)) {
+            for (const item of this.stages) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            stages: this.__stagesRaw ?? this.__stages,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Evolution.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.stages;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("stages", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = __Evolution_Stage.validate(item)) !== null) return __prefixError(error, "stages", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Evolution}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Evolution.acquire();
+        try {
+            let value;
+            value = json.stages;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("stages", "array");
+                const list = new Array(value.length);
+                message.stages = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(__Evolution_Stage, item, "stages", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Evolution.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EvolutionView {
+        static __layout = {
+            size: 8,
+            hash: 0x5dbc6544,
+            presence: 8,
+            fields: [
+                {name: "stages", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return __Evolution_Stage.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EvolutionView.__layout.hash);
+            return new EvolutionView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get stages() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, __Evolution_Stage.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EvolutionColumns extends __ColumnTable {
+        static Row = class EvolutionRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get stages() {
+                return this.__table.columns.stages[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                stages: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EvolutionColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.stages[i] = row.stages;
+            }
+            return table;
+        }
+    };
+
+    static Stage = __Evolution_Stage;
+    static Trigger = __Evolution_Trigger;
+}
+
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/pokemon/comm_pokemon.proto",
+    dependencies: [],
+    data: "CiRwb2tld29ybGQvcG9rZW1vbi9jb21tX3Bva2Vtb24ucHJvdG8SFnBva2V3b3JsZC5wb2tlbW9uLmNvbW0ikwMKCUV2b2x1dGlvbhI/CgZzdGFnZXMYASADKAsyJy5wb2tld29ybGQucG9rZW1vbi5jb21tLkV2b2x1dGlvbi5TdGFnZVIGc3RhZ2VzGv8BCgVTdGFnZRIdCgpzcGVjaWVzX2lkGAEgASgFUglzcGVjaWVzSWQSQwoHdHJpZ2dlchgCIAEoDjIpLnBva2V3b3JsZC5wb2tlbW9uLmNvbW0uRXZvbHV0aW9uLlRyaWdnZXJSB3RyaWdnZXISTwoJY29uZGl0aW9uGAMgASgLMjEucG9rZXdvcmxkLnBva2Vtb24uY29tbS5Fdm9sdXRpb24uU3RhZ2UuQ29uZGl0aW9uUgljb25kaXRpb24aQQoJQ29uZGl0aW9uEhsKCW1pbl9sZXZlbBgBIAEoBVIIbWluTGV2ZWwSFwoHaXRlbV9pZBgCIAEoBVIGaXRlbUlkIkMKB1RyaWdnZXISEAoMVFJJR0dFUl9OT05FEAASFAoQVFJJR0dFUl9MRVZFTF9VUBABEhAKDFRSSUdHRVJfSVRFTRACYgZwcm90bzM=",
+};
@@ -3,6 +3,426 @@
 
 // Package: pokeworld.resource.cfg
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: ResourceId
 export const ResourceId = {
     NONE: 0,
@@ -29,6 +449,7 @@ Object.defineProperty(ResourceId, "__descriptor", {
         get clrType() { return ResourceId; },
         fullName: "pokeworld.resource.cfg.ResourceId",
         package: "pokeworld.resource.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "NONE", originalName: "ResourceId_NONE", number: 0},
             {name: "UI_LOGIN_PANEL", originalName: "RESOURCEID_UI_LOGIN_PANEL", number: 1001},
@@ -47,7 +468,8 @@ Object.defineProperty(ResourceId, "__descriptor", {
             {name: "ACTOR_XIAO_ZHI", originalName: "RESOURCEID_ACTOR_XIAO_ZHI", number: 1014},
             {name: "ACTOR_ART_XIAO_ZHI_WALK_ATLAS", originalName: "RESOURCEID_ACTOR_ART_XIAO_ZHI_WALK_ATLAS", number: 1015},
             {name: "ACTOR_ART_XIAO_ZHI_ILLUSTRATION", originalName: "RESOURCEID_ACTOR_ART_XIAO_ZHI_ILLUSTRATION", number: 1016}
-        ]
+        ],
+        valueIndex: new Map([[0, 0], [1001, 1], [1002, 2], [1003, 3], [1004, 4], [1005, 5], [1006, 6], [1007, 7], [1008, 8], [1009, 9], [1010, 10], [1011, 11], [1012, 12], [1013, 13], [1014, 14], [1015, 15], [1016, 16]])
     },
     enumerable: false,
     writable: false,
@@ -61,14 +483,28 @@ export class AssetAddress {
         get clrType() { return AssetAddress; },
         fullName: "pokeworld.resource.cfg.AssetAddress",
         package: "pokeworld.resource.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "packageName", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "location", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
+            {name: "packageName", number: 1, type: "TYPE_STRING", intern: true, label: "LABEL_OPTIONAL"},
+            {name: "location", number: 2, type: "TYPE_STRING", intern: true, label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__packageName = "";
+        this.__location = "";
+    }
+
+    __packageName = undefined;
+
     /** @type {string} */
-    packageName;
+    get packageName() {
+        return this.__packageName;
+    }
+    set packageName(value) {
+        this.__rawStale = true;
+        this.__packageName = value;
+    }
 
     /** 
      * @param {string} value 
@@ -76,11 +512,21 @@ export class AssetAddress {
      */
     withPackageName(value) {
         this.packageName = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __location = undefined;
+
     /** @type {string} */
-    location;
+    get location() {
+        return this.__location;
+    }
+    set location(value) {
+        this.__rawStale = true;
+        this.__location = value;
+    }
 
     /** 
      * @param {string} value 
@@ -88,9 +534,325 @@ export class AssetAddress {
      */
     withLocation(value) {
         this.location = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["packageName", "location"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {AssetAddress} a deep copy of this message
+     */
+    clone() {
+        return new AssetAddress().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {AssetAddress} other 
+     * @return {AssetAddress} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.packageName = other.packageName;
+        this.location = other.location;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {AssetAddress} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof AssetAddress)) return false;
+        if ((this.packageName ?? "") !== (other.packageName ?? "")) return false;
+        if ((this.location ?? "") !== (other.location ?? "")) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.packageName ?? "");
+        hash = __hashString(hash, this.location ?? "");
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {AssetAddress} 
+     */
+    clear() {
+        this.packageName = "";
+        this.location = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {AssetAddress} 
+     */
+    static acquire() {
+        const message = AssetAddress.__pool.pop();
+        if (message === undefined) return new AssetAddress();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {AssetAddress} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('AssetAddress instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (AssetAddress.__pool.length < 64) {
+            AssetAddress.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).packageName = this.packageName; break;
+                case 2: (full ??= {}).location = this.location; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {AssetAddress} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.packageName) !== undefined) {
+                this.packageName = value;
+            }
+            if ((value = full.location) !== undefined) {
+                this.location = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {AssetAddress} 
+     */
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            packageName: this.packageName,
+            location: this.location,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, AssetAddress.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.packageName;
+        if (value != null && !__isString(value)) return __invalid("packageName", "string");
+        value = json.location;
+        if (value != null && !__isString(value)) return __invalid("location", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {AssetAddress}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = AssetAddress.acquire();
+        try {
+            let value;
+            value = json.packageName;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("packageName", "string");
+                message.packageName = value;
+            }
+            value = json.location;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("location", "string");
+                message.location = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            AssetAddress.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class AssetAddressView {
+        static __layout = {
+            size: 16,
+            hash: 0xa77186c8,
+            presence: 16,
+            fields: [
+                {name: "packageName", type: "TYPE_STRING", offset: 0},
+                {name: "location", type: "TYPE_STRING", offset: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, AssetAddressView.__layout.hash);
+            return new AssetAddressView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get packageName() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get location() {
+            return __flatString(this.__view, this.__offset + 8);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class AssetAddressColumns extends __ColumnTable {
+        static Row = class AssetAddressRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get packageName() {
+                const table = this.__table;
+                return table.dictionaries.packageName[table.columns.packageName[this.__index]];
+            }
+
+            get location() {
+                const table = this.__table;
+                return table.dictionaries.location[table.columns.location[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {packageName: [], location: []};
+            this.columns = {
+                packageName: new Uint32Array(length),
+                location: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new AssetAddressColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const packageNameCodes = new Map();
+            const locationCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.packageName[i] = __columnEncode(packageNameCodes, dictionaries.packageName, row.packageName ?? "");
+                columns.location[i] = __columnEncode(locationCodes, dictionaries.location, row.location ?? "");
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: Resource
@@ -100,14 +862,30 @@ export class Resource {
         get clrType() { return Resource; },
         fullName: "pokeworld.resource.cfg.Resource",
         package: "pokeworld.resource.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "id", number: 1, type: "TYPE_ENUM", typeName: ".pokeworld.resource.cfg.ResourceId", get clrType() { return ResourceId; },label: "LABEL_OPTIONAL"},
-            {name: "assetAddress", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.AssetAddress", get clrType() { return AssetAddress; },label: "LABEL_OPTIONAL"}
+            {name: "assetAddress", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.AssetAddress", get clrType() { return AssetAddress; },lazy: true, label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__id = ResourceId.NONE;
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __id = undefined;
+
     /** @type {ResourceId[keyof typeof ResourceId]} */
-    id;
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
     /** 
      * @param {ResourceId[keyof typeof ResourceId]} value 
@@ -115,11 +893,53 @@ export class Resource {
      */
     withId(value) {
         this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {AssetAddress} */
-    assetAddress;
+    __assetAddress = undefined;
+    __assetAddressRaw = undefined;
+
+    /** @type {AssetAddress|undefined} */
+    get assetAddress() {
+        if (this.__assetAddressRaw !== undefined) {
+            this.__assetAddress = this.__decode(Resource.__descriptor.fields[1], this.__assetAddressRaw, this.__assetAddress);
+            this.__assetAddressRaw = undefined;
+        }
+        return this.__assetAddress;
+    }
+    set assetAddress(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__assetAddressRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__assetAddress = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__assetAddress = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasAssetAddress() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {Resource} 
+     */
+    clearAssetAddress() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__assetAddress = undefined;
+        this.__assetAddressRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
 
     /** 
      * @param {AssetAddress} value 
@@ -130,6 +950,357 @@ export class Resource {
         return this;
     }
 
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 2:
+                this.__dirty0 |= 2;
+                this.__assetAddress = undefined;
+                this.__assetAddressRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["id", "assetAddress"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__assetAddress) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Resource} a deep copy of this message
+     */
+    clone() {
+        return new Resource().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Resource} other 
+     * @return {Resource} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.assetAddress = __cloneMessage(other.assetAddress);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Resource} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Resource)) return false;
+        if ((this.id ?? ResourceId.NONE) !== (other.id ?? ResourceId.NONE)) return false;
+        if (!__equalsMessage(this.assetAddress, other.assetAddress)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? ResourceId.NONE);
+        hash = __hashMessage(hash, this.assetAddress);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Resource} 
+     */
+    clear() {
+        this.id = ResourceId.NONE;
+        this.__assetAddress = undefined;
+        this.__assetAddressRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Resource} 
+     */
+    static acquire() {
+        const message = Resource.__pool.pop();
+        if (message === undefined) return new Resource();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Resource} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Resource instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Resource.__pool.length < 64) {
+            Resource.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__assetAddress) instanceof AssetAddress) AssetAddress.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).assetAddress = this.assetAddress ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && (value = this.assetAddress) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).assetAddress = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Resource} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.assetAddress) !== undefined) {
+                this.assetAddress = value === null ? undefined : (value instanceof AssetAddress ? value.clone().commit() : new AssetAddress().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.assetAddress) !== undefined) {
+                (this.assetAddress ?? (this.assetAddress = new AssetAddress())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Resource} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.assetAddress)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.assetAddress = this.__assetAddressRaw ?? this.__assetAddress; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Resource.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isEnum(ResourceId, value)) return __invalid("id", "enum ResourceId");
+        value = json.assetAddress;
+        if (value != null && (error = AssetAddress.validate(value)) !== null) return __prefixError(error, "assetAddress");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Resource}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Resource.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isEnum(ResourceId, value)) throw __invalid("id", "enum ResourceId");
+                message.id = value;
+            }
+            value = json.assetAddress;
+            if (value != null) {
+                message.assetAddress = __decodeNested(AssetAddress, value, "assetAddress");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Resource.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ResourceView {
+        static __layout = {
+            size: 8,
+            hash: 0xa76ea4c9,
+            presence: 0,
+            fields: [
+                {name: "id", type: "TYPE_ENUM", offset: 0},
+                {name: "assetAddress", type: "TYPE_MESSAGE", offset: 4, get view() { return AssetAddress.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ResourceView.__layout.hash);
+            return new ResourceView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get assetAddress() {
+            return __flatMessage(this.__view, this.__offset + 4, AssetAddress.View);
+        }
+
+        hasAssetAddress() {
+            return this.assetAddress !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ResourceColumns extends __ColumnTable {
+        static Row = class ResourceRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get assetAddress() {
+                return this.__table.columns.assetAddress[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                id: new Int32Array(length),
+                assetAddress: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ResourceColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? ResourceId.NONE;
+                columns.assetAddress[i] = row.assetAddress;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: TbResource
@@ -139,13 +1310,32 @@ export class TbResource {
         get clrType() { return TbResource; },
         fullName: "pokeworld.resource.cfg.TbResource",
         package: "pokeworld.resource.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.Resource", get clrType() { return Resource; },label: "LABEL_REPEATED"}
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.resource.cfg.Resource", get clrType() { return Resource; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
     /** @type {Resource[]} */
-    dataList;
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbResource.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
 
     /** 
      * @param {Resource[]} value 
@@ -153,8 +1343,356 @@ export class TbResource {
      */
     withDataList(value) {
         this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbResource} a deep copy of this message
+     */
+    clone() {
+        return new TbResource().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbResource} other 
+     * @return {TbResource} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbResource} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbResource)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbResource} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbResource} 
+     */
+    static acquire() {
+        const message = TbResource.__pool.pop();
+        if (message === undefined) return new TbResource();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbResource} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbResource instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbResource.__pool.length < 64) {
+            TbResource.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof Resource) Resource.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbResource} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof Resource ? item.clone().commit() : new Resource().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbResource} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbResource.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Resource.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbResource}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbResource.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Resource, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbResource.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbResourceView {
+        static __layout = {
+            size: 8,
+            hash: 0xe8b60331,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Resource.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbResourceView.__layout.hash);
+            return new TbResourceView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Resource.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbResourceColumns extends __ColumnTable {
+        static Row = class TbResourceRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbResourceColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/resource/cfg_resource.proto",
+    dependencies: ["pokeworld/config/cfg_options.proto"],
+    data: "CiVwb2tld29ybGQvcmVzb3VyY2UvY2ZnX3Jlc291cmNlLnByb3RvEhZwb2tld29ybGQucmVzb3VyY2UuY2ZnGiJwb2tld29ybGQvY29uZmlnL2NmZ19vcHRpb25zLnByb3RvIlgKDEFzc2V0QWRkcmVzcxImCgtwYWNrYWdlTmFtZRgBIAEoCUIEiKMFAVILcGFja2FnZU5hbWUSIAoIbG9jYXRpb24YAiABKAlCBIijBQFSCGxvY2F0aW9uIokBCghSZXNvdXJjZRIyCgJpZBgBIAEoDjIiLnBva2V3b3JsZC5yZXNvdXJjZS5jZmcuUmVzb3VyY2VJZFICaWQSSQoNYXNzZXRfYWRkcmVzcxgCIAEoCzIkLnBva2V3b3JsZC5yZXNvdXJjZS5jZmcuQXNzZXRBZGRyZXNzUgxhc3NldEFkZHJlc3MiTwoKVGJSZXNvdXJjZRJBCglkYXRhX2xpc3QYASADKAsyIC5wb2tld29ybGQucmVzb3VyY2UuY2ZnLlJlc291cmNlQgIQAFIIZGF0YUxpc3Qq7QQKClJlc291cmNlSWQSEwoPUmVzb3VyY2VJZF9OT05FEAASHgoZUkVTT1VSQ0VJRF9VSV9MT0dJTl9QQU5FTBDpBxIhChxSRVNPVVJDRUlEX1VJX1JFR0lTVEVSX1BBTkVMEOoHEh8KGlJFU09VUkNFSURfVUlfU0VSVkVSX1BBTkVMEOsHEh4KGVJFU09VUkNFSURfVUlfU0VSVkVSX0lURU0Q7AcSJgohUkVTT1VSQ0VJRF9VSV9QTEFZRVJfU0VMRUNUX1BBTkVMEO0HEiUKIFJFU09VUkNFSURfVUlfUExBWUVSX1NFTEVDVF9JVEVNEO4HEiQKH1JFU09VUkNFSURfVUlfUExBWUVSX0dBTUVfUEFORUwQ7wcSIAobUkVTT1VSQ0VJRF9VSV9QT0tFREVYX1BBTkVMEPAHEiIKHVJFU09VUkNFSURfVUlfUE9LRV9JTkZPX1BBTkVMEPEHEiYKIVJFU09VUkNFSURfVUlfQVJUX1BPS0VfVFlQRV9BVExBUxDyBxIrCiZSRVNPVVJDRUlEX1VJX0FSVF9QT0tFX1RZUEVfSUNPTl9BVExBUxDzBxIaChVSRVNPVVJDRUlEX1NDRU5FX0RFTU8Q9AcSGgoVUkVTT1VSQ0VJRF9TQ0VORV9VU0VSEPUHEh4KGVJFU09VUkNFSURfQUNUT1JfWElBT19aSEkQ9gcSLQooUkVTT1VSQ0VJRF9BQ1RPUl9BUlRfWElBT19aSElfV0FMS19BVExBUxD3BxIvCipSRVNPVVJDRUlEX0FDVE9SX0FSVF9YSUFPX1pISV9JTExVU1RSQVRJT04Q+AdiBnByb3RvMw==",
+};
@@ -15,14 +15,22 @@ Object.defineProperty(Config, "__descriptor", {
         get clrType() { return Config; },
         fullName: "pokeworld.user.comm.Config",
         package: "pokeworld.user.comm",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "INVALID", originalName: "CONFIG_INVALID", number: 0},
             {name: "PASSWORLD_MIN_LENGTH", originalName: "CONFIG_PASSWORLD_MIN_LENGTH", number: 6},
             {name: "PASSWORLD_MAX_LENGTH", originalName: "CONFIG_PASSWORLD_MAX_LENGTH", number: 20}
-        ]
+        ],
+        valueIndex: new Map([[0, 0], [6, 1], [20, 2]])
     },
     enumerable: false,
     writable: false,
 });
 Object.freeze(Config);
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/user/comm_user.proto",
+    dependencies: [],
+    data: "Ch5wb2tld29ybGQvdXNlci9jb21tX3VzZXIucHJvdG8SE3Bva2V3b3JsZC51c2VyLmNvbW0qXgoGQ29uZmlnEhIKDkNPTkZJR19JTlZBTElEEAASHwobQ09ORklHX1BBU1NXT1JMRF9NSU5fTEVOR1RIEAYSHwobQ09ORklHX1BBU1NXT1JMRF9NQVhfTEVOR1RIEBRiBnByb3RvMw==",
+};
@@ -3,6 +3,463 @@
 
 // Package: pokeworld.user.cs
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Codecs of the 64-bit integer representation (int64=hybrid)
+function __checkInt64String(value) {
+    if (!/^-?\d+$/.test(value)) {
+        throw new Error(`Invalid 64-bit integer: ${JSON.stringify(value)}`);
+    }
+    return value;
+}
+
+function __decodeInt64(value) {
+    if (typeof value === 'number') {
+        return Number.isSafeInteger(value) ? value : BigInt(value);
+    }
+    if (typeof value === 'string') {
+        if (/^-?\d{1,15}$/.test(value)) return Number(value);
+        __checkInt64String(value);
+    }
+    const big = typeof value === 'bigint' ? value : BigInt(value);
+    return big >= -9007199254740991n && big <= 9007199254740991n ? Number(big) : big;
+}
+
+function __encodeInt64(value) {
+    return typeof value === 'bigint' ? value.toString() : value;
+}
+
+function __hashInt64(hash, value) {
+    return typeof value === 'bigint' ? __hashBigInt(hash, value) : __hashNumber(hash, value);
+}
+
+function __encodeInt64List(list) {
+    return Array.isArray(list) ? list.map(__encodeInt64) : list;
+}
+
+function __hashBigInt(hash, value) {
+    hash = (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value))) | 0;
+    return (Math.imul(hash, 31) + Number(BigInt.asIntN(32, value >> 32n))) | 0;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: MessageId
 export const MessageId = {
     INVALID: 0,
@@ -23,6 +480,7 @@ Object.defineProperty(MessageId, "__descriptor", {
         get clrType() { return MessageId; },
         fullName: "pokeworld.user.cs.MessageId",
         package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "INVALID", originalName: "MESSAGE_ID_INVALID", number: 0},
             {name: "REGISTER_REQUEST", originalName: "MESSAGE_ID_REGISTER_REQUEST", number: 1001},
@@ -35,7 +493,8 @@ Object.defineProperty(MessageId, "__descriptor", {
             {name: "GET_SERVERS_RESPONSE", originalName: "MESSAGE_ID_GET_SERVERS_RESPONSE", number: 1008},
             {name: "GET_CREATED_PLAYERS_REQUEST", originalName: "MESSAGE_ID_GET_CREATED_PLAYERS_REQUEST", number: 1009},
             {name: "GET_CREATED_PLAYERS_RESPONSE", originalName: "MESSAGE_ID_GET_CREATED_PLAYERS_RESPONSE", number: 1010}
-        ]
+        ],
+        valueIndex: new Map([[0, 0], [1001, 1], [1002, 2], [1003, 3], [1004, 4], [1005, 5], [1006, 6], [1007, 7], [1008, 8], [1009, 9], [1010, 10]])
     },
     enumerable: false,
     writable: false,
@@ -49,6 +508,9 @@ export class RegisterRequest {
         get clrType() { return RegisterRequest; },
         fullName: "pokeworld.user.cs.RegisterRequest",
         package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1001,
         fields: [
             {name: "email", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
             {name: "userName", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
@@ -56,8 +518,22 @@ export class RegisterRequest {
         ]
     }
 
+    constructor() {
+        this.__email = "";
+        this.__userName = "";
+        this.__password = "";
+    }
+
+    __email = undefined;
+
     /** @type {string} */
-    email;
+    get email() {
+        return this.__email;
+    }
+    set email(value) {
+        this.__rawStale = true;
+        this.__email = value;
+    }
 
     /** 
      * @param {string} value 
@@ -65,11 +541,21 @@ export class RegisterRequest {
      */
     withEmail(value) {
         this.email = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __userName = undefined;
+
     /** @type {string} */
-    userName;
+    get userName() {
+        return this.__userName;
+    }
+    set userName(value) {
+        this.__rawStale = true;
+        this.__userName = value;
+    }
 
     /** 
      * @param {string} value 
@@ -77,11 +563,21 @@ export class RegisterRequest {
      */
     withUserName(value) {
         this.userName = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
+    __password = undefined;
+
     /** @type {string} */
-    password;
+    get password() {
+        return this.__password;
+    }
+    set password(value) {
+        this.__rawStale = true;
+        this.__password = value;
+    }
 
     /** 
      * @param {string} value 
@@ -89,267 +585,3427 @@ export class RegisterRequest {
      */
     withPassword(value) {
         this.password = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
-}
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
 
-// Message: RegisterResponse
-export class RegisterResponse {
-    static __descriptor = {
-        name: "RegisterResponse",
-        get clrType() { return RegisterResponse; },
-        fullName: "pokeworld.user.cs.RegisterResponse",
-        package: "pokeworld.user.cs",
-        fields: [
-            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
-        ]
+    static __knownKeys = new Set(["email", "userName", "password"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-    /** @type {boolean} */
-    success;
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
 
     /** 
-     * @param {boolean} value 
-     * @return {RegisterResponse} 
+     * @return {RegisterRequest} a deep copy of this message
      */
-    withSuccess(value) {
-        this.success = value;
-        return this;
+    clone() {
+        return new RegisterRequest().copyFrom(this);
     }
 
-}
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {RegisterRequest} other 
+     * @return {RegisterRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.email = other.email;
+        this.userName = other.userName;
+        this.password = other.password;
+        return this;
+    }
 
-// Message: LoginRequest
-export class LoginRequest {
-    static __descriptor = {
-        name: "LoginRequest",
-        get clrType() { return LoginRequest; },
-        fullName: "pokeworld.user.cs.LoginRequest",
-        package: "pokeworld.user.cs",
-        fields: [
-            {name: "email", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "password", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {RegisterRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof RegisterRequest)) return false;
+        if ((this.email ?? "") !== (other.email ?? "")) return false;
+        if ((this.userName ?? "") !== (other.userName ?? "")) return false;
+        if ((this.password ?? "") !== (other.password ?? "")) return false;
+        return true;
     }
 
-    /** @type {string} */
-    email;
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.email ?? "");
+        hash = __hashString(hash, this.userName ?? "");
+        hash = __hashString(hash, this.password ?? "");
+        return hash;
+    }
 
     /** 
-     * @param {string} value 
-     * @return {LoginRequest} 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {RegisterRequest} 
      */
-    withEmail(value) {
-        this.email = value;
+    clear() {
+        this.email = "";
+        this.userName = "";
+        this.password = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-    /** @type {string} */
-    password;
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {string} value 
-     * @return {LoginRequest} 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {RegisterRequest} 
      */
-    withPassword(value) {
-        this.password = value;
-        return this;
+    static acquire() {
+        const message = RegisterRequest.__pool.pop();
+        if (message === undefined) return new RegisterRequest();
+        message.__released = false;
+        return message;
     }
 
-}
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {RegisterRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('RegisterRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (RegisterRequest.__pool.length < 64) {
+            RegisterRequest.__pool.push(message);
+        }
+    }
 
-// Message: LoginResponse
-export class LoginResponse {
-    static __descriptor = {
-        name: "LoginResponse",
-        get clrType() { return LoginResponse; },
-        fullName: "pokeworld.user.cs.LoginResponse",
-        package: "pokeworld.user.cs",
-        fields: [
-            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
     }
 
-    /** @type {boolean} */
-    success;
+    // Dirty field bitmask
+    __dirty0 = 0;
 
     /** 
-     * @param {boolean} value 
-     * @return {LoginResponse} 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
      */
-    withSuccess(value) {
-        this.success = value;
-        return this;
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-}
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).email = this.email; break;
+                case 2: (full ??= {}).userName = this.userName; break;
+                case 4: (full ??= {}).password = this.password; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
-// Message: EnterServerRequest
-export class EnterServerRequest {
-    static __descriptor = {
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {RegisterRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.email) !== undefined) {
+                this.email = value;
+            }
+            if ((value = full.userName) !== undefined) {
+                this.userName = value;
+            }
+            if ((value = full.password) !== undefined) {
+                this.password = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {RegisterRequest} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            email: this.email,
+            userName: this.userName,
+            password: this.password,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, RegisterRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.email;
+        if (value != null && !__isString(value)) return __invalid("email", "string");
+        value = json.userName;
+        if (value != null && !__isString(value)) return __invalid("userName", "string");
+        value = json.password;
+        if (value != null && !__isString(value)) return __invalid("password", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {RegisterRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = RegisterRequest.acquire();
+        try {
+            let value;
+            value = json.email;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("email", "string");
+                message.email = value;
+            }
+            value = json.userName;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("userName", "string");
+                message.userName = value;
+            }
+            value = json.password;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("password", "string");
+                message.password = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            RegisterRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class RegisterRequestView {
+        static __layout = {
+            size: 24,
+            hash: 0xd1585d71,
+            presence: 24,
+            fields: [
+                {name: "email", type: "TYPE_STRING", offset: 0},
+                {name: "userName", type: "TYPE_STRING", offset: 8},
+                {name: "password", type: "TYPE_STRING", offset: 16}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, RegisterRequestView.__layout.hash);
+            return new RegisterRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get email() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get userName() {
+            return __flatString(this.__view, this.__offset + 8);
+        }
+
+        get password() {
+            return __flatString(this.__view, this.__offset + 16);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class RegisterRequestColumns extends __ColumnTable {
+        static Row = class RegisterRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get email() {
+                const table = this.__table;
+                return table.dictionaries.email[table.columns.email[this.__index]];
+            }
+
+            get userName() {
+                const table = this.__table;
+                return table.dictionaries.userName[table.columns.userName[this.__index]];
+            }
+
+            get password() {
+                const table = this.__table;
+                return table.dictionaries.password[table.columns.password[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {email: [], userName: [], password: []};
+            this.columns = {
+                email: new Uint32Array(length),
+                userName: new Uint32Array(length),
+                password: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new RegisterRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const emailCodes = new Map();
+            const userNameCodes = new Map();
+            const passwordCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.email[i] = __columnEncode(emailCodes, dictionaries.email, row.email ?? "");
+                columns.userName[i] = __columnEncode(userNameCodes, dictionaries.userName, row.userName ?? "");
+                columns.password[i] = __columnEncode(passwordCodes, dictionaries.password, row.password ?? "");
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: RegisterResponse
+export class RegisterResponse {
+    static __descriptor = {
+        name: "RegisterResponse",
+        get clrType() { return RegisterResponse; },
+        fullName: "pokeworld.user.cs.RegisterResponse",
+        package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1002,
+        fields: [
+            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__success = false;
+    }
+
+    __success = undefined;
+
+    /** @type {boolean} */
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
+
+    /** 
+     * @param {boolean} value 
+     * @return {RegisterResponse} 
+     */
+    withSuccess(value) {
+        this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {RegisterResponse} a deep copy of this message
+     */
+    clone() {
+        return new RegisterResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {RegisterResponse} other 
+     * @return {RegisterResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {RegisterResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof RegisterResponse)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {RegisterResponse} 
+     */
+    clear() {
+        this.success = false;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {RegisterResponse} 
+     */
+    static acquire() {
+        const message = RegisterResponse.__pool.pop();
+        if (message === undefined) return new RegisterResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {RegisterResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('RegisterResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (RegisterResponse.__pool.length < 64) {
+            RegisterResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {RegisterResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {RegisterResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, RegisterResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {RegisterResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = RegisterResponse.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            RegisterResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class RegisterResponseView {
+        static __layout = {
+            size: 8,
+            hash: 0x0cf8c9e8,
+            presence: 0,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, RegisterResponseView.__layout.hash);
+            return new RegisterResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class RegisterResponseColumns extends __ColumnTable {
+        static Row = class RegisterResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new RegisterResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: LoginRequest
+export class LoginRequest {
+    static __descriptor = {
+        name: "LoginRequest",
+        get clrType() { return LoginRequest; },
+        fullName: "pokeworld.user.cs.LoginRequest",
+        package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1003,
+        fields: [
+            {name: "email", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "password", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__email = "";
+        this.__password = "";
+    }
+
+    __email = undefined;
+
+    /** @type {string} */
+    get email() {
+        return this.__email;
+    }
+    set email(value) {
+        this.__rawStale = true;
+        this.__email = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {LoginRequest} 
+     */
+    withEmail(value) {
+        this.email = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __password = undefined;
+
+    /** @type {string} */
+    get password() {
+        return this.__password;
+    }
+    set password(value) {
+        this.__rawStale = true;
+        this.__password = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {LoginRequest} 
+     */
+    withPassword(value) {
+        this.password = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["email", "password"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {LoginRequest} a deep copy of this message
+     */
+    clone() {
+        return new LoginRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {LoginRequest} other 
+     * @return {LoginRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.email = other.email;
+        this.password = other.password;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {LoginRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof LoginRequest)) return false;
+        if ((this.email ?? "") !== (other.email ?? "")) return false;
+        if ((this.password ?? "") !== (other.password ?? "")) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.email ?? "");
+        hash = __hashString(hash, this.password ?? "");
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {LoginRequest} 
+     */
+    clear() {
+        this.email = "";
+        this.password = "";
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {LoginRequest} 
+     */
+    static acquire() {
+        const message = LoginRequest.__pool.pop();
+        if (message === undefined) return new LoginRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {LoginRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('LoginRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (LoginRequest.__pool.length < 64) {
+            LoginRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).email = this.email; break;
+                case 2: (full ??= {}).password = this.password; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {LoginRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.email) !== undefined) {
+                this.email = value;
+            }
+            if ((value = full.password) !== undefined) {
+                this.password = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {LoginRequest} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            email: this.email,
+            password: this.password,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, LoginRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.email;
+        if (value != null && !__isString(value)) return __invalid("email", "string");
+        value = json.password;
+        if (value != null && !__isString(value)) return __invalid("password", "string");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {LoginRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = LoginRequest.acquire();
+        try {
+            let value;
+            value = json.email;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("email", "string");
+                message.email = value;
+            }
+            value = json.password;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("password", "string");
+                message.password = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            LoginRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class LoginRequestView {
+        static __layout = {
+            size: 16,
+            hash: 0x748e9355,
+            presence: 16,
+            fields: [
+                {name: "email", type: "TYPE_STRING", offset: 0},
+                {name: "password", type: "TYPE_STRING", offset: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, LoginRequestView.__layout.hash);
+            return new LoginRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get email() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get password() {
+            return __flatString(this.__view, this.__offset + 8);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class LoginRequestColumns extends __ColumnTable {
+        static Row = class LoginRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get email() {
+                const table = this.__table;
+                return table.dictionaries.email[table.columns.email[this.__index]];
+            }
+
+            get password() {
+                const table = this.__table;
+                return table.dictionaries.password[table.columns.password[this.__index]];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {email: [], password: []};
+            this.columns = {
+                email: new Uint32Array(length),
+                password: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new LoginRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const emailCodes = new Map();
+            const passwordCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.email[i] = __columnEncode(emailCodes, dictionaries.email, row.email ?? "");
+                columns.password[i] = __columnEncode(passwordCodes, dictionaries.password, row.password ?? "");
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: LoginResponse
+export class LoginResponse {
+    static __descriptor = {
+        name: "LoginResponse",
+        get clrType() { return LoginResponse; },
+        fullName: "pokeworld.user.cs.LoginResponse",
+        package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1004,
+        fields: [
+            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__success = false;
+    }
+
+    __success = undefined;
+
+    /** @type {boolean} */
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
+
+    /** 
+     * @param {boolean} value 
+     * @return {LoginResponse} 
+     */
+    withSuccess(value) {
+        this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {LoginResponse} a deep copy of this message
+     */
+    clone() {
+        return new LoginResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {LoginResponse} other 
+     * @return {LoginResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {LoginResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof LoginResponse)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {LoginResponse} 
+     */
+    clear() {
+        this.success = false;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {LoginResponse} 
+     */
+    static acquire() {
+        const message = LoginResponse.__pool.pop();
+        if (message === undefined) return new LoginResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {LoginResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('LoginResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (LoginResponse.__pool.length < 64) {
+            LoginResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {LoginResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {LoginResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, LoginResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {LoginResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = LoginResponse.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            LoginResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class LoginResponseView {
+        static __layout = {
+            size: 8,
+            hash: 0x50f2a3a2,
+            presence: 0,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, LoginResponseView.__layout.hash);
+            return new LoginResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class LoginResponseColumns extends __ColumnTable {
+        static Row = class LoginResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new LoginResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: EnterServerRequest
+export class EnterServerRequest {
+    static __descriptor = {
         name: "EnterServerRequest",
         get clrType() { return EnterServerRequest; },
         fullName: "pokeworld.user.cs.EnterServerRequest",
         package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1005,
+        fields: [
+            {name: "serverId", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__serverId = 0;
+    }
+
+    __serverId = undefined;
+
+    /** @type {number} */
+    get serverId() {
+        return this.__serverId;
+    }
+    set serverId(value) {
+        this.__rawStale = true;
+        this.__serverId = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {EnterServerRequest} 
+     */
+    withServerId(value) {
+        this.serverId = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["serverId"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {EnterServerRequest} a deep copy of this message
+     */
+    clone() {
+        return new EnterServerRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {EnterServerRequest} other 
+     * @return {EnterServerRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.serverId = other.serverId;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {EnterServerRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof EnterServerRequest)) return false;
+        if ((this.serverId ?? 0) !== (other.serverId ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.serverId ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {EnterServerRequest} 
+     */
+    clear() {
+        this.serverId = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {EnterServerRequest} 
+     */
+    static acquire() {
+        const message = EnterServerRequest.__pool.pop();
+        if (message === undefined) return new EnterServerRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {EnterServerRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('EnterServerRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (EnterServerRequest.__pool.length < 64) {
+            EnterServerRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).serverId = this.serverId; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {EnterServerRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.serverId) !== undefined) {
+                this.serverId = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {EnterServerRequest} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            serverId: this.serverId,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, EnterServerRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.serverId;
+        if (value != null && !__isInt32(value)) return __invalid("serverId", "int32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {EnterServerRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = EnterServerRequest.acquire();
+        try {
+            let value;
+            value = json.serverId;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("serverId", "int32");
+                message.serverId = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            EnterServerRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EnterServerRequestView {
+        static __layout = {
+            size: 8,
+            hash: 0xe838b2af,
+            presence: 0,
+            fields: [
+                {name: "serverId", type: "TYPE_INT32", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EnterServerRequestView.__layout.hash);
+            return new EnterServerRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get serverId() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EnterServerRequestColumns extends __ColumnTable {
+        static Row = class EnterServerRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get serverId() {
+                return this.__table.columns.serverId[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                serverId: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EnterServerRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.serverId[i] = row.serverId ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: EnterServerResponse
+export class EnterServerResponse {
+    static __descriptor = {
+        name: "EnterServerResponse",
+        get clrType() { return EnterServerResponse; },
+        fullName: "pokeworld.user.cs.EnterServerResponse",
+        package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1006,
+        fields: [
+            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__success = false;
+    }
+
+    __success = undefined;
+
+    /** @type {boolean} */
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
+
+    /** 
+     * @param {boolean} value 
+     * @return {EnterServerResponse} 
+     */
+    withSuccess(value) {
+        this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {EnterServerResponse} a deep copy of this message
+     */
+    clone() {
+        return new EnterServerResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {EnterServerResponse} other 
+     * @return {EnterServerResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {EnterServerResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof EnterServerResponse)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {EnterServerResponse} 
+     */
+    clear() {
+        this.success = false;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {EnterServerResponse} 
+     */
+    static acquire() {
+        const message = EnterServerResponse.__pool.pop();
+        if (message === undefined) return new EnterServerResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {EnterServerResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('EnterServerResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (EnterServerResponse.__pool.length < 64) {
+            EnterServerResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {EnterServerResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {EnterServerResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, EnterServerResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {EnterServerResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = EnterServerResponse.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            EnterServerResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EnterServerResponseView {
+        static __layout = {
+            size: 8,
+            hash: 0x72eefaea,
+            presence: 0,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EnterServerResponseView.__layout.hash);
+            return new EnterServerResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EnterServerResponseColumns extends __ColumnTable {
+        static Row = class EnterServerResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EnterServerResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: GetServersRequest
+export class GetServersRequest {
+    static __descriptor = {
+        name: "GetServersRequest",
+        get clrType() { return GetServersRequest; },
+        fullName: "pokeworld.user.cs.GetServersRequest",
+        package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1007,
+        fields: []
+    }
+
+    constructor() {
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set([]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {GetServersRequest} a deep copy of this message
+     */
+    clone() {
+        return new GetServersRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {GetServersRequest} other 
+     * @return {GetServersRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {GetServersRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof GetServersRequest)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {GetServersRequest} 
+     */
+    clear() {
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {GetServersRequest} 
+     */
+    static acquire() {
+        const message = GetServersRequest.__pool.pop();
+        if (message === undefined) return new GetServersRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {GetServersRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('GetServersRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (GetServersRequest.__pool.length < 64) {
+            GetServersRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {GetServersRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {GetServersRequest} 
+     */
+    commit() {
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, GetServersRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {GetServersRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = GetServersRequest.acquire();
+        try {
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            GetServersRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class GetServersRequestView {
+        static __layout = {
+            size: 0,
+            hash: 0x5004ffe0,
+            presence: 0,
+            fields: []
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, GetServersRequestView.__layout.hash);
+            return new GetServersRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class GetServersRequestColumns extends __ColumnTable {
+        static Row = class GetServersRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new GetServersRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: Server
+export class Server {
+    static __descriptor = {
+        name: "Server",
+        get clrType() { return Server; },
+        fullName: "pokeworld.user.cs.Server",
+        package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "number", number: 3, type: "TYPE_UINT32", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__id = 0;
+        this.__name = "";
+        this.__number = 0;
+    }
+
+    __id = undefined;
+
+    /** @type {number} */
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Server} 
+     */
+    withId(value) {
+        this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __name = undefined;
+
+    /** @type {string} */
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {Server} 
+     */
+    withName(value) {
+        this.name = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __number = undefined;
+
+    /** @type {number} */
+    get number() {
+        return this.__number;
+    }
+    set number(value) {
+        this.__rawStale = true;
+        this.__number = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {Server} 
+     */
+    withNumber(value) {
+        this.number = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["id", "name", "number"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {Server} a deep copy of this message
+     */
+    clone() {
+        return new Server().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {Server} other 
+     * @return {Server} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.name = other.name;
+        this.number = other.number;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Server} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Server)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if ((this.number ?? 0) !== (other.number ?? 0)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashNumber(hash, this.number ?? 0);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Server} 
+     */
+    clear() {
+        this.id = 0;
+        this.name = "";
+        this.number = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Server} 
+     */
+    static acquire() {
+        const message = Server.__pool.pop();
+        if (message === undefined) return new Server();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Server} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Server instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Server.__pool.length < 64) {
+            Server.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).name = this.name; break;
+                case 4: (full ??= {}).number = this.number; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Server} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.number) !== undefined) {
+                this.number = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {Server} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            name: this.name,
+            number: this.number,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Server.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.number;
+        if (value != null && !__isUint32(value)) return __invalid("number", "uint32");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Server}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Server.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.number;
+            if (value != null) {
+                if (!__isUint32(value)) throw __invalid("number", "uint32");
+                message.number = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Server.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ServerView {
+        static __layout = {
+            size: 16,
+            hash: 0xacd1292b,
+            presence: 8,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 8},
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "number", type: "TYPE_UINT32", offset: 12}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ServerView.__layout.hash);
+            return new ServerView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get number() {
+            return __flatUint32(this.__view, this.__offset + 12);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ServerColumns extends __ColumnTable {
+        static Row = class ServerRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get number() {
+                return this.__table.columns.number[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                id: new Int32Array(length),
+                name: new Uint32Array(length),
+                number: new Uint32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ServerColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.number[i] = row.number ?? 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: GetServersResponse
+export class GetServersResponse {
+    static __descriptor = {
+        name: "GetServersResponse",
+        get clrType() { return GetServersResponse; },
+        fullName: "pokeworld.user.cs.GetServersResponse",
+        package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1008,
         fields: [
-            {name: "serverId", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"}
+            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"},
+            {name: "servers", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.user.cs.Server", get clrType() { return Server; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
-    /** @type {number} */
-    serverId;
+    constructor() {
+        this.__success = false;
+        this.servers = [];
+    }
+
+    __success = undefined;
+
+    /** @type {boolean} */
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
+
+    /** 
+     * @param {boolean} value 
+     * @return {GetServersResponse} 
+     */
+    withSuccess(value) {
+        this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __servers = undefined;
+    __serversRaw = undefined;
+
+    /** @type {Server[]} */
+    get servers() {
+        if (this.__serversRaw !== undefined) {
+            this.__servers = this.__decode(GetServersResponse.__descriptor.fields[1], this.__serversRaw, this.__servers);
+            this.__serversRaw = undefined;
+        }
+        return this.__servers;
+    }
+    set servers(value) {
+        this.__rawStale = true;
+        this.__serversRaw = undefined;
+        this.__servers = value;
+    }
+
+    /** 
+     * @param {Server[]} value 
+     * @return {GetServersResponse} 
+     */
+    withServers(value) {
+        this.servers = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 2:
+                this.__serversRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success", "servers"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__servers) != null) {
+            raw = this.__raw.servers;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {GetServersResponse} a deep copy of this message
+     */
+    clone() {
+        return new GetServersResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {GetServersResponse} other 
+     * @return {GetServersResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        this.servers = __cloneArray(other.servers, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {GetServersResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof GetServersResponse)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        if (!__equalsArray(this.servers, other.servers, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        hash = __hashArray(hash, this.servers, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {GetServersResponse} 
+     */
+    clear() {
+        this.success = false;
+        this.__serversRaw = undefined;
+        if (Array.isArray(this.servers)) this.servers.length = 0; else this.servers = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {GetServersResponse} 
+     */
+    static acquire() {
+        const message = GetServersResponse.__pool.pop();
+        if (message === undefined) return new GetServersResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {GetServersResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('GetServersResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (GetServersResponse.__pool.length < 64) {
+            GetServersResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__servers)) {
+            for (const item of this.__servers) {
+                if (item instanceof Server) Server.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+                case 2: (full ??= {}).servers = this.servers; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && Array.isArray(this.servers)) {
+            const list = this.servers;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).servers = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {GetServersResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+            if ((value = full.servers) !== undefined) {
+                this.servers = value === null ? [] : value.map(item => (item instanceof Server ? item.clone().commit() : new Server().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.servers) !== undefined) {
+                const list = this.servers;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {GetServersResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.servers)) {
+            for (const item of this.servers) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+            servers: this.__serversRaw ?? this.__servers,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, GetServersResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        value = json.servers;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("servers", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Server.validate(item)) !== null) return __prefixError(error, "servers", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {GetServersResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = GetServersResponse.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            value = json.servers;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("servers", "array");
+                const list = new Array(value.length);
+                message.servers = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Server, item, "servers", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            GetServersResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class GetServersResponseView {
+        static __layout = {
+            size: 16,
+            hash: 0x2aa7b615,
+            presence: 8,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 8},
+                {name: "servers", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Server.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, GetServersResponseView.__layout.hash);
+            return new GetServersResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 8);
+        }
+
+        get servers() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Server.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class GetServersResponseColumns extends __ColumnTable {
+        static Row = class GetServersResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
 
-    /** 
-     * @param {number} value 
-     * @return {EnterServerRequest} 
-     */
-    withServerId(value) {
-        this.serverId = value;
-        return this;
-    }
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+
+            get servers() {
+                return this.__table.columns.servers[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+                servers: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new GetServersResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+                columns.servers[i] = row.servers;
+            }
+            return table;
+        }
+    };
 
 }
 
-// Message: EnterServerResponse
-export class EnterServerResponse {
+// Message: GetCreatedPlayersRequest
+export class GetCreatedPlayersRequest {
     static __descriptor = {
-        name: "EnterServerResponse",
-        get clrType() { return EnterServerResponse; },
-        fullName: "pokeworld.user.cs.EnterServerResponse",
+        name: "GetCreatedPlayersRequest",
+        get clrType() { return GetCreatedPlayersRequest; },
+        fullName: "pokeworld.user.cs.GetCreatedPlayersRequest",
         package: "pokeworld.user.cs",
-        fields: [
-            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
-        ]
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1009,
+        fields: []
     }
 
-    /** @type {boolean} */
-    success;
+    constructor() {
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set([]);
 
     /** 
-     * @param {boolean} value 
-     * @return {EnterServerResponse} 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
      */
-    withSuccess(value) {
-        this.success = value;
-        return this;
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-}
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
 
-// Message: GetServersRequest
-export class GetServersRequest {
-    static __descriptor = {
-        name: "GetServersRequest",
-        get clrType() { return GetServersRequest; },
-        fullName: "pokeworld.user.cs.GetServersRequest",
-        package: "pokeworld.user.cs",
-        fields: []
+    /** 
+     * @return {GetCreatedPlayersRequest} a deep copy of this message
+     */
+    clone() {
+        return new GetCreatedPlayersRequest().copyFrom(this);
     }
 
-}
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {GetCreatedPlayersRequest} other 
+     * @return {GetCreatedPlayersRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        return this;
+    }
 
-// Message: Server
-export class Server {
-    static __descriptor = {
-        name: "Server",
-        get clrType() { return Server; },
-        fullName: "pokeworld.user.cs.Server",
-        package: "pokeworld.user.cs",
-        fields: [
-            {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "number", number: 3, type: "TYPE_UINT32", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {GetCreatedPlayersRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof GetCreatedPlayersRequest)) return false;
+        return true;
     }
 
-    /** @type {number} */
-    id;
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        return hash;
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Server} 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {GetCreatedPlayersRequest} 
      */
-    withId(value) {
-        this.id = value;
+    clear() {
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-    /** @type {string} */
-    name;
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {string} value 
-     * @return {Server} 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {GetCreatedPlayersRequest} 
      */
-    withName(value) {
-        this.name = value;
-        return this;
+    static acquire() {
+        const message = GetCreatedPlayersRequest.__pool.pop();
+        if (message === undefined) return new GetCreatedPlayersRequest();
+        message.__released = false;
+        return message;
     }
 
-    /** @type {number} */
-    number;
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {GetCreatedPlayersRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('GetCreatedPlayersRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (GetCreatedPlayersRequest.__pool.length < 64) {
+            GetCreatedPlayersRequest.__pool.push(message);
+        }
+    }
 
     /** 
-     * @param {number} value 
-     * @return {Server} 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
      */
-    withNumber(value) {
-        this.number = value;
-        return this;
+    __releaseOwned() {
     }
 
-}
+    // Dirty field bitmask
 
-// Message: GetServersResponse
-export class GetServersResponse {
-    static __descriptor = {
-        name: "GetServersResponse",
-        get clrType() { return GetServersResponse; },
-        fullName: "pokeworld.user.cs.GetServersResponse",
-        package: "pokeworld.user.cs",
-        fields: [
-            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"},
-            {name: "servers", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.user.cs.Server", get clrType() { return Server; },label: "LABEL_REPEATED"}
-        ]
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
     }
 
-    /** @type {boolean} */
-    success;
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
     /** 
-     * @param {boolean} value 
-     * @return {GetServersResponse} 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {GetCreatedPlayersRequest} 
      */
-    withSuccess(value) {
-        this.success = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {Server[]} */
-    servers;
-
     /** 
-     * @param {Server[]} value 
-     * @return {GetServersResponse} 
+     * Mark the current state as synchronized
+     * @return {GetCreatedPlayersRequest} 
      */
-    withServers(value) {
-        this.servers = value;
+    commit() {
         return this;
     }
 
-}
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, GetCreatedPlayersRequest.__knownKeys);
+    }
 
-// Message: GetCreatedPlayersRequest
-export class GetCreatedPlayersRequest {
-    static __descriptor = {
-        name: "GetCreatedPlayersRequest",
-        get clrType() { return GetCreatedPlayersRequest; },
-        fullName: "pokeworld.user.cs.GetCreatedPlayersRequest",
-        package: "pokeworld.user.cs",
-        fields: []
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {GetCreatedPlayersRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = GetCreatedPlayersRequest.acquire();
+        try {
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            GetCreatedPlayersRequest.release(message);
+            throw error;
+        }
+        return message;
     }
 
+    // Zero-copy reader over the flat binary blob format
+    static View = class GetCreatedPlayersRequestView {
+        static __layout = {
+            size: 0,
+            hash: 0x1408c020,
+            presence: 0,
+            fields: []
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, GetCreatedPlayersRequestView.__layout.hash);
+            return new GetCreatedPlayersRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class GetCreatedPlayersRequestColumns extends __ColumnTable {
+        static Row = class GetCreatedPlayersRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new GetCreatedPlayersRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: GetCreatedPlayersResponse
@@ -359,14 +4015,30 @@ export class GetCreatedPlayersResponse {
         get clrType() { return GetCreatedPlayersResponse; },
         fullName: "pokeworld.user.cs.GetCreatedPlayersResponse",
         package: "pokeworld.user.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1009,
+        messageId: 1010,
         fields: [
             {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"},
-            {name: "entityIds", number: 2, type: "TYPE_UINT64", label: "LABEL_REPEATED"}
+            {name: "entityIds", number: 2, type: "TYPE_UINT64", int64: "hybrid", label: "LABEL_REPEATED"}
         ]
     }
 
+    constructor() {
+        this.__success = false;
+        this.__entityIds = [];
+    }
+
+    __success = undefined;
+
     /** @type {boolean} */
-    success;
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
 
     /** 
      * @param {boolean} value 
@@ -374,20 +4046,432 @@ export class GetCreatedPlayersResponse {
      */
     withSuccess(value) {
         this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {number[]} */
-    entityIds;
+    __entityIds = undefined;
+
+    /** @type {(number|bigint)[]} */
+    get entityIds() {
+        return this.__entityIds;
+    }
+    set entityIds(value) {
+        this.__rawStale = true;
+        this.__entityIds = value;
+    }
 
     /** 
-     * @param {number[]} value 
+     * @param {(number|bigint)[]} value 
      * @return {GetCreatedPlayersResponse} 
      */
     withEntityIds(value) {
         this.entityIds = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success", "entityIds"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__entityIds) != null) {
+            raw = this.__raw.entityIds;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (let i = 0; i < value.length; i++) {
+                if (value[i] !== __decodeInt64(raw[i])) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {GetCreatedPlayersResponse} a deep copy of this message
+     */
+    clone() {
+        return new GetCreatedPlayersResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {GetCreatedPlayersResponse} other 
+     * @return {GetCreatedPlayersResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        this.entityIds = __cloneArray(other.entityIds, undefined);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {GetCreatedPlayersResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof GetCreatedPlayersResponse)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        if (!__equalsArray(this.entityIds, other.entityIds, undefined)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        hash = __hashArray(hash, this.entityIds, __hashInt64);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {GetCreatedPlayersResponse} 
+     */
+    clear() {
+        this.success = false;
+        if (Array.isArray(this.entityIds)) this.entityIds.length = 0; else this.entityIds = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {GetCreatedPlayersResponse} 
+     */
+    static acquire() {
+        const message = GetCreatedPlayersResponse.__pool.pop();
+        if (message === undefined) return new GetCreatedPlayersResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {GetCreatedPlayersResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('GetCreatedPlayersResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (GetCreatedPlayersResponse.__pool.length < 64) {
+            GetCreatedPlayersResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+                case 2: (full ??= {}).entityIds = __encodeInt64List(this.entityIds); break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {GetCreatedPlayersResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+            if ((value = full.entityIds) !== undefined) {
+                this.entityIds = value === null ? [] : value.map(item => __decodeInt64(item));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {GetCreatedPlayersResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+            entityIds: __encodeInt64List(this.entityIds),
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, GetCreatedPlayersResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        value = json.entityIds;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("entityIds", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if (!__isUint64(item)) return __prefixError(__invalid("", "uint64"), "entityIds", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {GetCreatedPlayersResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = GetCreatedPlayersResponse.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            value = json.entityIds;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("entityIds", "array");
+                const list = new Array(value.length);
+                message.entityIds = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    if (!__isUint64(item)) throw __prefixError(__invalid("", "uint64"), "entityIds", i);
+                    list[i] = __decodeInt64(item);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            GetCreatedPlayersResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class GetCreatedPlayersResponseView {
+        static __layout = {
+            size: 16,
+            hash: 0x7264241a,
+            presence: 8,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 8},
+                {name: "entityIds", type: "TYPE_UINT64", offset: 0, repeated: true, stride: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, GetCreatedPlayersResponseView.__layout.hash);
+            return new GetCreatedPlayersResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 8);
+        }
+
+        get entityIds() {
+            return __flatList(this.__view, this.__offset + 0, 8, __flatUint64);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class GetCreatedPlayersResponseColumns extends __ColumnTable {
+        static Row = class GetCreatedPlayersResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+
+            get entityIds() {
+                return this.__table.columns.entityIds[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+                entityIds: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new GetCreatedPlayersResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+                columns.entityIds[i] = row.entityIds;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Client stub: request/response pairs of the module's message ids
+export class UserClient {
+    static __calls = [
+        {name: "register", get requestType() { return RegisterRequest; }, get responseType() { return RegisterResponse; }},
+        {name: "login", get requestType() { return LoginRequest; }, get responseType() { return LoginResponse; }},
+        {name: "enterServer", get requestType() { return EnterServerRequest; }, get responseType() { return EnterServerResponse; }},
+        {name: "getServers", get requestType() { return GetServersRequest; }, get responseType() { return GetServersResponse; }},
+        {name: "getCreatedPlayers", get requestType() { return GetCreatedPlayersRequest; }, get responseType() { return GetCreatedPlayersResponse; }},
+    ];
+
+    /**
+     * @param {{call: function(Object, Function, Object=): Promise<Object>, send: function(Object): void}} channel
+     *     RpcChannel of proto-rpc.mjs, or any object with the same call/send methods
+     */
+    constructor(channel) {
+        this.channel = channel;
+    }
+
+    /**
+     * @param {RegisterRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<RegisterResponse>}
+     */
+    register(request, options) {
+        return this.channel.call(request, RegisterResponse, options);
+    }
+
+    /**
+     * @param {LoginRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<LoginResponse>}
+     */
+    login(request, options) {
+        return this.channel.call(request, LoginResponse, options);
+    }
+
+    /**
+     * @param {EnterServerRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<EnterServerResponse>}
+     */
+    enterServer(request, options) {
+        return this.channel.call(request, EnterServerResponse, options);
+    }
+
+    /**
+     * @param {GetServersRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<GetServersResponse>}
+     */
+    getServers(request, options) {
+        return this.channel.call(request, GetServersResponse, options);
+    }
+
+    /**
+     * @param {GetCreatedPlayersRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<GetCreatedPlayersResponse>}
+     */
+    getCreatedPlayers(request, options) {
+        return this.channel.call(request, GetCreatedPlayersResponse, options);
+    }
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/user/cs_user.proto",
+    dependencies: ["google/protobuf/descriptor.proto", "pokeworld/module/module_id.proto", "pokeworld/user/comm_user.proto"],
+    data: "Chxwb2tld29ybGQvdXNlci9jc191c2VyLnByb3RvEhFwb2tld29ybGQudXNlci5jcxogZ29vZ2xlL3Byb3RvYnVmL2Rlc2NyaXB0b3IucHJvdG8aIHBva2V3b3JsZC9tb2R1bGUvbW9kdWxlX2lkLnByb3RvGh5wb2tld29ybGQvdXNlci9jb21tX3VzZXIucHJvdG8iaAoPUmVnaXN0ZXJSZXF1ZXN0EhQKBWVtYWlsGAEgASgJUgVlbWFpbBIbCgl1c2VyX25hbWUYAiABKAlSCHVzZXJOYW1lEhoKCHBhc3N3b3JkGAMgASgJUghwYXNzd29yZDoGkMnRTOkHIjQKEFJlZ2lzdGVyUmVzcG9uc2USGAoHc3VjY2VzcxgBIAEoCFIHc3VjY2VzczoGkMnRTOoHIkgKDExvZ2luUmVxdWVzdBIUCgVlbWFpbBgBIAEoCVIFZW1haWwSGgoIcGFzc3dvcmQYAiABKAlSCHBhc3N3b3JkOgaQydFM6wciMQoNTG9naW5SZXNwb25zZRIYCgdzdWNjZXNzGAEgASgIUgdzdWNjZXNzOgaQydFM7AciOQoSRW50ZXJTZXJ2ZXJSZXF1ZXN0EhsKCXNlcnZlcl9pZBgBIAEoBVIIc2VydmVySWQ6BpDJ0UztByI3ChNFbnRlclNlcnZlclJlc3BvbnNlEhgKB3N1Y2Nlc3MYASABKAhSB3N1Y2Nlc3M6BpDJ0UzuByIbChFHZXRTZXJ2ZXJzUmVxdWVzdDoGkMnRTO8HIkQKBlNlcnZlchIOCgJpZBgBIAEoBVICaWQSEgoEbmFtZRgCIAEoCVIEbmFtZRIWCgZudW1iZXIYAyABKA1SBm51bWJlciJrChJHZXRTZXJ2ZXJzUmVzcG9uc2USGAoHc3VjY2VzcxgBIAEoCFIHc3VjY2VzcxIzCgdzZXJ2ZXJzGAIgAygLMhkucG9rZXdvcmxkLnVzZXIuY3MuU2VydmVyUgdzZXJ2ZXJzOgaQydFM8AciIgoYR2V0Q3JlYXRlZFBsYXllcnNSZXF1ZXN0OgaQydFM8QciXAoZR2V0Q3JlYXRlZFBsYXllcnNSZXNwb25zZRIYCgdzdWNjZXNzGAEgASgIUgdzdWNjZXNzEh0KCmVudGl0eV9pZHMYAiADKARSCWVudGl0eUlkczoGkMnRTPIHKqIDCglNZXNzYWdlSWQSFgoSTUVTU0FHRV9JRF9JTlZBTElEEAASIAobTUVTU0FHRV9JRF9SRUdJU1RFUl9SRVFVRVNUEOkHEiEKHE1FU1NBR0VfSURfUkVHSVNURVJfUkVTUE9OU0UQ6gcSHQoYTUVTU0FHRV9JRF9MT0dJTl9SRVFVRVNUEOsHEh4KGU1FU1NBR0VfSURfTE9HSU5fUkVTUE9OU0UQ7AcSJAofTUVTU0FHRV9JRF9FTlRFUl9TRVJWRVJfUkVRVUVTVBDtBxIlCiBNRVNTQUdFX0lEX0VOVEVSX1NFUlZFUl9SRVNQT05TRRDuBxIjCh5NRVNTQUdFX0lEX0dFVF9TRVJWRVJTX1JFUVVFU1QQ7wcSJAofTUVTU0FHRV9JRF9HRVRfU0VSVkVSU19SRVNQT05TRRDwBxIrCiZNRVNTQUdFX0lEX0dFVF9DUkVBVEVEX1BMQVlFUlNfUkVRVUVTVBDxBxIsCidNRVNTQUdFX0lEX0dFVF9DUkVBVEVEX1BMQVlFUlNfUkVTUE9OU0UQ8gcaBojQpUzxBzpfCgptZXNzYWdlX2lkEh8uZ29vZ2xlLnByb3RvYnVmLk1lc3NhZ2VPcHRpb25zGJKZygkgASgOMhwucG9rZXdvcmxkLnVzZXIuY3MuTWVzc2FnZUlkUgltZXNzYWdlSWRiBnByb3RvMw==",
+};
@@ -5,6 +5,426 @@
 
 import * as __PokeworldMathComm_math from '../math/comm_math.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: TerrainFlags
 export const TerrainFlags = {
     NONE: 0,
@@ -20,6 +440,7 @@ Object.defineProperty(TerrainFlags, "__descriptor", {
         get clrType() { return TerrainFlags; },
         fullName: "pokeworld.world.cfg.TerrainFlags",
         package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "NONE", originalName: "TERRAINFLAGS_NONE", number: 0},
             {name: "WALKABLE", originalName: "TERRAINFLAGS_WALKABLE", number: 1},
@@ -27,7 +448,8 @@ Object.defineProperty(TerrainFlags, "__descriptor", {
             {name: "PASSABLE", originalName: "TERRAINFLAGS_PASSABLE", number: 4},
             {name: "OBSTACLE", originalName: "TERRAINFLAGS_OBSTACLE", number: 8},
             {name: "SINGLE_WAY", originalName: "TERRAINFLAGS_SINGLE_WAY", number: 16}
-        ]
+        ],
+        valueIndex: new Map([[0, 0], [1, 1], [2, 2], [4, 3], [8, 4], [16, 5]])
     },
     enumerable: false,
     writable: false,
@@ -48,13 +470,15 @@ Object.defineProperty(TerrainRuleType, "__descriptor", {
         get clrType() { return TerrainRuleType; },
         fullName: "pokeworld.world.cfg.TerrainRuleType",
         package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "NONE", originalName: "TERRAINRULETYPE_NONE", number: 0},
             {name: "FILL", originalName: "TERRAINRULETYPE_FILL", number: 1},
             {name: "EDGE", originalName: "TERRAINRULETYPE_EDGE", number: 2},
             {name: "EXTERIOR_CORNER", originalName: "TERRAINRULETYPE_EXTERIOR_CORNER", number: 3},
             {name: "INTERIOR_CORNER", originalName: "TERRAINRULETYPE_INTERIOR_CORNER", number: 4}
-        ]
+        ],
+        valueIndex: [0, 1, 2, 3, 4]
     },
     enumerable: false,
     writable: false,
@@ -84,6 +508,7 @@ Object.defineProperty(TerrainTileRuleType, "__descriptor", {
         get clrType() { return TerrainTileRuleType; },
         fullName: "pokeworld.world.cfg.TerrainTileRuleType",
         package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "NONE", originalName: "TERRAINTILERULETYPE_NONE", number: 0},
             {name: "FILL", originalName: "TERRAINTILERULETYPE_FILL", number: 1},
@@ -99,7 +524,8 @@ Object.defineProperty(TerrainTileRuleType, "__descriptor", {
             {name: "TOP_RIGHT_INTERIOR_CORNER", originalName: "TERRAINTILERULETYPE_TOP_RIGHT_INTERIOR_CORNER", number: 11},
             {name: "BOTTOM_RIGHT_INTERIOR_CORNER", originalName: "TERRAINTILERULETYPE_BOTTOM_RIGHT_INTERIOR_CORNER", number: 12},
             {name: "BOTTOM_LEFT_INTERIOR_CORNER", originalName: "TERRAINTILERULETYPE_BOTTOM_LEFT_INTERIOR_CORNER", number: 13}
-        ]
+        ],
+        valueIndex: [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13]
     },
     enumerable: false,
     writable: false,
@@ -121,6 +547,7 @@ Object.defineProperty(TerrainType, "__descriptor", {
         get clrType() { return TerrainType; },
         fullName: "pokeworld.world.cfg.TerrainType",
         package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "NONE", originalName: "TERRAINTYPE_NONE", number: 0},
             {name: "AIR", originalName: "TERRAINTYPE_AIR", number: 1},
@@ -128,7 +555,8 @@ Object.defineProperty(TerrainType, "__descriptor", {
             {name: "STAIR", originalName: "TERRAINTYPE_STAIR", number: 3},
             {name: "LADDER", originalName: "TERRAINTYPE_LADDER", number: 4},
             {name: "WATER", originalName: "TERRAINTYPE_WATER", number: 5}
-        ]
+        ],
+        valueIndex: [0, 1, 2, 3, 4, 5]
     },
     enumerable: false,
     writable: false,
@@ -142,6 +570,7 @@ export class Terrain {
         get clrType() { return Terrain; },
         fullName: "pokeworld.world.cfg.Terrain",
         package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
             {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
@@ -153,8 +582,26 @@ export class Terrain {
         ]
     }
 
+    constructor() {
+        this.__id = 0;
+        this.__name = "";
+        this.__priority = 0;
+        this.__excludeRuleTypes = [];
+        this.__excludeTileRuleTypes = [];
+        this.__type = TerrainType.NONE;
+        this.__flags = TerrainFlags.NONE;
+    }
+
+    __id = undefined;
+
     /** @type {number} */
-    id;
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
     /** 
      * @param {number} value 
@@ -162,11 +609,21 @@ export class Terrain {
      */
     withId(value) {
         this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __name = undefined;
+
     /** @type {string} */
-    name;
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
 
     /** 
      * @param {string} value 
@@ -174,11 +631,21 @@ export class Terrain {
      */
     withName(value) {
         this.name = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
+    __priority = undefined;
+
     /** @type {number} */
-    priority;
+    get priority() {
+        return this.__priority;
+    }
+    set priority(value) {
+        this.__rawStale = true;
+        this.__priority = value;
+    }
 
     /** 
      * @param {number} value 
@@ -186,11 +653,21 @@ export class Terrain {
      */
     withPriority(value) {
         this.priority = value;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
         return this;
     }
 
+    __excludeRuleTypes = undefined;
+
     /** @type {TerrainRuleType[keyof typeof TerrainRuleType][]} */
-    excludeRuleTypes;
+    get excludeRuleTypes() {
+        return this.__excludeRuleTypes;
+    }
+    set excludeRuleTypes(value) {
+        this.__rawStale = true;
+        this.__excludeRuleTypes = value;
+    }
 
     /** 
      * @param {TerrainRuleType[keyof typeof TerrainRuleType][]} value 
@@ -198,11 +675,21 @@ export class Terrain {
      */
     withExcludeRuleTypes(value) {
         this.excludeRuleTypes = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
         return this;
     }
 
+    __excludeTileRuleTypes = undefined;
+
     /** @type {TerrainTileRuleType[keyof typeof TerrainTileRuleType][]} */
-    excludeTileRuleTypes;
+    get excludeTileRuleTypes() {
+        return this.__excludeTileRuleTypes;
+    }
+    set excludeTileRuleTypes(value) {
+        this.__rawStale = true;
+        this.__excludeTileRuleTypes = value;
+    }
 
     /** 
      * @param {TerrainTileRuleType[keyof typeof TerrainTileRuleType][]} value 
@@ -210,11 +697,21 @@ export class Terrain {
      */
     withExcludeTileRuleTypes(value) {
         this.excludeTileRuleTypes = value;
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
         return this;
     }
 
+    __type = undefined;
+
     /** @type {TerrainType[keyof typeof TerrainType]} */
-    type;
+    get type() {
+        return this.__type;
+    }
+    set type(value) {
+        this.__rawStale = true;
+        this.__type = value;
+    }
 
     /** 
      * @param {TerrainType[keyof typeof TerrainType]} value 
@@ -222,11 +719,21 @@ export class Terrain {
      */
     withType(value) {
         this.type = value;
+        this.__dirty0 |= 32;
+        this.__rawStale = true;
         return this;
     }
 
+    __flags = undefined;
+
     /** @type {TerrainFlags[keyof typeof TerrainFlags]} */
-    flags;
+    get flags() {
+        return this.__flags;
+    }
+    set flags(value) {
+        this.__rawStale = true;
+        this.__flags = value;
+    }
 
     /** 
      * @param {TerrainFlags[keyof typeof TerrainFlags]} value 
@@ -234,112 +741,1777 @@ export class Terrain {
      */
     withFlags(value) {
         this.flags = value;
+        this.__dirty0 |= 64;
+        this.__rawStale = true;
         return this;
     }
 
-}
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
 
-// Message: World
-export class World {
-    static __descriptor = {
-        name: "World",
-        get clrType() { return World; },
-        fullName: "pokeworld.world.cfg.World",
-        package: "pokeworld.world.cfg",
-        fields: [
-            {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
-            {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "spawnPosition", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector3Int", get clrType() { return __PokeworldMathComm_math.Vector3Int; },label: "LABEL_OPTIONAL"}
-        ]
-    }
+    static __knownKeys = new Set(["id", "name", "priority", "excludeRuleTypes", "excludeTileRuleTypes", "type", "flags"]);
 
-    /** @type {number} */
-    id;
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
 
     /** 
-     * @param {number} value 
-     * @return {World} 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
      */
-    withId(value) {
-        this.id = value;
-        return this;
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__excludeRuleTypes) != null) {
+            raw = this.__raw.excludeRuleTypes;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (let i = 0; i < value.length; i++) {
+                if (value[i] !== raw[i]) return false;
+            }
+        }
+        if ((value = this.__excludeTileRuleTypes) != null) {
+            raw = this.__raw.excludeTileRuleTypes;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (let i = 0; i < value.length; i++) {
+                if (value[i] !== raw[i]) return false;
+            }
+        }
+        return true;
     }
 
-    /** @type {string} */
-    name;
+    /** 
+     * @return {Terrain} a deep copy of this message
+     */
+    clone() {
+        return new Terrain().copyFrom(this);
+    }
 
     /** 
-     * @param {string} value 
-     * @return {World} 
+     * Deep copy all fields from another message of the same type
+     * @param {Terrain} other 
+     * @return {Terrain} 
      */
-    withName(value) {
-        this.name = value;
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.name = other.name;
+        this.priority = other.priority;
+        this.excludeRuleTypes = __cloneArray(other.excludeRuleTypes, undefined);
+        this.excludeTileRuleTypes = __cloneArray(other.excludeTileRuleTypes, undefined);
+        this.type = other.type;
+        this.flags = other.flags;
         return this;
     }
 
-    /** @type {__PokeworldMathComm_math.Vector3Int} */
-    spawnPosition;
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {Terrain} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof Terrain)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if ((this.priority ?? 0) !== (other.priority ?? 0)) return false;
+        if (!__equalsArray(this.excludeRuleTypes, other.excludeRuleTypes, undefined)) return false;
+        if (!__equalsArray(this.excludeTileRuleTypes, other.excludeTileRuleTypes, undefined)) return false;
+        if ((this.type ?? TerrainType.NONE) !== (other.type ?? TerrainType.NONE)) return false;
+        if ((this.flags ?? TerrainFlags.NONE) !== (other.flags ?? TerrainFlags.NONE)) return false;
+        return true;
+    }
 
     /** 
-     * @param {__PokeworldMathComm_math.Vector3Int} value 
-     * @return {World} 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
      */
-    withSpawnPosition(value) {
-        this.spawnPosition = value;
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashNumber(hash, this.priority ?? 0);
+        hash = __hashArray(hash, this.excludeRuleTypes, __hashNumber);
+        hash = __hashArray(hash, this.excludeTileRuleTypes, __hashNumber);
+        hash = __hashNumber(hash, this.type ?? TerrainType.NONE);
+        hash = __hashNumber(hash, this.flags ?? TerrainFlags.NONE);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {Terrain} 
+     */
+    clear() {
+        this.id = 0;
+        this.name = "";
+        this.priority = 0;
+        if (Array.isArray(this.excludeRuleTypes)) this.excludeRuleTypes.length = 0; else this.excludeRuleTypes = [];
+        if (Array.isArray(this.excludeTileRuleTypes)) this.excludeTileRuleTypes.length = 0; else this.excludeTileRuleTypes = [];
+        this.type = TerrainType.NONE;
+        this.flags = TerrainFlags.NONE;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-}
+    static __pool = [];
 
-// Message: TbWorld
-export class TbWorld {
-    static __descriptor = {
-        name: "TbWorld",
-        get clrType() { return TbWorld; },
-        fullName: "pokeworld.world.cfg.TbWorld",
-        package: "pokeworld.world.cfg",
-        fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.World", get clrType() { return World; },label: "LABEL_REPEATED"}
-        ]
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {Terrain} 
+     */
+    static acquire() {
+        const message = Terrain.__pool.pop();
+        if (message === undefined) return new Terrain();
+        message.__released = false;
+        return message;
     }
 
-    /** @type {World[]} */
-    dataList;
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {Terrain} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('Terrain instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (Terrain.__pool.length < 64) {
+            Terrain.__pool.push(message);
+        }
+    }
 
     /** 
-     * @param {World[]} value 
-     * @return {TbWorld} 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
      */
-    withDataList(value) {
-        this.dataList = value;
-        return this;
+    __releaseOwned() {
     }
 
-}
+    // Dirty field bitmask
+    __dirty0 = 0;
 
-// Message: TbTerrain
-export class TbTerrain {
-    static __descriptor = {
-        name: "TbTerrain",
-        get clrType() { return TbTerrain; },
-        fullName: "pokeworld.world.cfg.TbTerrain",
-        package: "pokeworld.world.cfg",
-        fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.Terrain", get clrType() { return Terrain; },label: "LABEL_REPEATED"}
-        ]
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-    /** @type {Terrain[]} */
-    dataList;
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).name = this.name; break;
+                case 4: (full ??= {}).priority = this.priority; break;
+                case 8: (full ??= {}).excludeRuleTypes = this.excludeRuleTypes; break;
+                case 16: (full ??= {}).excludeTileRuleTypes = this.excludeTileRuleTypes; break;
+                case 32: (full ??= {}).type = this.type; break;
+                case 64: (full ??= {}).flags = this.flags; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
     /** 
-     * @param {Terrain[]} value 
-     * @return {TbTerrain} 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {Terrain} 
      */
-    withDataList(value) {
-        this.dataList = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.priority) !== undefined) {
+                this.priority = value;
+            }
+            if ((value = full.excludeRuleTypes) !== undefined) {
+                this.excludeRuleTypes = value === null ? [] : value.slice();
+            }
+            if ((value = full.excludeTileRuleTypes) !== undefined) {
+                this.excludeTileRuleTypes = value === null ? [] : value.slice();
+            }
+            if ((value = full.type) !== undefined) {
+                this.type = value;
+            }
+            if ((value = full.flags) !== undefined) {
+                this.flags = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
         return this;
     }
 
-}
+    /** 
+     * Mark the current state as synchronized
+     * @return {Terrain} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            name: this.name,
+            priority: this.priority,
+            excludeRuleTypes: this.excludeRuleTypes,
+            excludeTileRuleTypes: this.excludeTileRuleTypes,
+            type: this.type,
+            flags: this.flags,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, Terrain.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.priority;
+        if (value != null && !__isInt32(value)) return __invalid("priority", "int32");
+        value = json.excludeRuleTypes;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("excludeRuleTypes", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if (!__isEnum(TerrainRuleType, item)) return __prefixError(__invalid("", "enum TerrainRuleType"), "excludeRuleTypes", i);
+            }
+        }
+        value = json.excludeTileRuleTypes;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("excludeTileRuleTypes", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if (!__isEnum(TerrainTileRuleType, item)) return __prefixError(__invalid("", "enum TerrainTileRuleType"), "excludeTileRuleTypes", i);
+            }
+        }
+        value = json.type;
+        if (value != null && !__isEnum(TerrainType, value)) return __invalid("type", "enum TerrainType");
+        value = json.flags;
+        if (value != null && !__isEnum(TerrainFlags, value)) return __invalid("flags", "enum TerrainFlags");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {Terrain}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = Terrain.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.priority;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("priority", "int32");
+                message.priority = value;
+            }
+            value = json.excludeRuleTypes;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("excludeRuleTypes", "array");
+                const list = new Array(value.length);
+                message.excludeRuleTypes = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    if (!__isEnum(TerrainRuleType, item)) throw __prefixError(__invalid("", "enum TerrainRuleType"), "excludeRuleTypes", i);
+                    list[i] = item;
+                }
+            }
+            value = json.excludeTileRuleTypes;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("excludeTileRuleTypes", "array");
+                const list = new Array(value.length);
+                message.excludeTileRuleTypes = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    if (!__isEnum(TerrainTileRuleType, item)) throw __prefixError(__invalid("", "enum TerrainTileRuleType"), "excludeTileRuleTypes", i);
+                    list[i] = item;
+                }
+            }
+            value = json.type;
+            if (value != null) {
+                if (!__isEnum(TerrainType, value)) throw __invalid("type", "enum TerrainType");
+                message.type = value;
+            }
+            value = json.flags;
+            if (value != null) {
+                if (!__isEnum(TerrainFlags, value)) throw __invalid("flags", "enum TerrainFlags");
+                message.flags = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            Terrain.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TerrainView {
+        static __layout = {
+            size: 40,
+            hash: 0xbb1ef727,
+            presence: 24,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 24},
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "priority", type: "TYPE_INT32", offset: 28},
+                {name: "excludeRuleTypes", type: "TYPE_ENUM", offset: 8, repeated: true, stride: 4},
+                {name: "excludeTileRuleTypes", type: "TYPE_ENUM", offset: 16, repeated: true, stride: 4},
+                {name: "type", type: "TYPE_ENUM", offset: 32},
+                {name: "flags", type: "TYPE_ENUM", offset: 36}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TerrainView.__layout.hash);
+            return new TerrainView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 24);
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get priority() {
+            return __flatInt32(this.__view, this.__offset + 28);
+        }
+
+        get excludeRuleTypes() {
+            return __flatList(this.__view, this.__offset + 8, 4, __flatInt32);
+        }
+
+        get excludeTileRuleTypes() {
+            return __flatList(this.__view, this.__offset + 16, 4, __flatInt32);
+        }
+
+        get type() {
+            return __flatInt32(this.__view, this.__offset + 32);
+        }
+
+        get flags() {
+            return __flatInt32(this.__view, this.__offset + 36);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TerrainColumns extends __ColumnTable {
+        static Row = class TerrainRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get priority() {
+                return this.__table.columns.priority[this.__index];
+            }
+
+            get excludeRuleTypes() {
+                return this.__table.columns.excludeRuleTypes[this.__index];
+            }
+
+            get excludeTileRuleTypes() {
+                return this.__table.columns.excludeTileRuleTypes[this.__index];
+            }
+
+            get type() {
+                return this.__table.columns.type[this.__index];
+            }
+
+            get flags() {
+                return this.__table.columns.flags[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                id: new Int32Array(length),
+                name: new Uint32Array(length),
+                priority: new Int32Array(length),
+                excludeRuleTypes: new Array(length),
+                excludeTileRuleTypes: new Array(length),
+                type: new Int32Array(length),
+                flags: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TerrainColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.priority[i] = row.priority ?? 0;
+                columns.excludeRuleTypes[i] = row.excludeRuleTypes;
+                columns.excludeTileRuleTypes[i] = row.excludeTileRuleTypes;
+                columns.type[i] = row.type ?? TerrainType.NONE;
+                columns.flags[i] = row.flags ?? TerrainFlags.NONE;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: World
+export class World {
+    static __descriptor = {
+        name: "World",
+        get clrType() { return World; },
+        fullName: "pokeworld.world.cfg.World",
+        package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "id", number: 1, type: "TYPE_INT32", label: "LABEL_OPTIONAL"},
+            {name: "name", number: 2, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "spawnPosition", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector3Int", get clrType() { return __PokeworldMathComm_math.Vector3Int; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__id = 0;
+        this.__name = "";
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __id = undefined;
+
+    /** @type {number} */
+    get id() {
+        return this.__id;
+    }
+    set id(value) {
+        this.__rawStale = true;
+        this.__id = value;
+    }
 
+    /** 
+     * @param {number} value 
+     * @return {World} 
+     */
+    withId(value) {
+        this.id = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __name = undefined;
+
+    /** @type {string} */
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {World} 
+     */
+    withName(value) {
+        this.name = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __spawnPosition = undefined;
+    __spawnPositionRaw = undefined;
+
+    /** @type {__PokeworldMathComm_math.Vector3Int|undefined} */
+    get spawnPosition() {
+        if (this.__spawnPositionRaw !== undefined) {
+            this.__spawnPosition = this.__decode(World.__descriptor.fields[2], this.__spawnPositionRaw, this.__spawnPosition);
+            this.__spawnPositionRaw = undefined;
+        }
+        return this.__spawnPosition;
+    }
+    set spawnPosition(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__spawnPositionRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__spawnPosition = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__spawnPosition = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasSpawnPosition() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {World} 
+     */
+    clearSpawnPosition() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__spawnPosition = undefined;
+        this.__spawnPositionRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldMathComm_math.Vector3Int} value 
+     * @return {World} 
+     */
+    withSpawnPosition(value) {
+        this.spawnPosition = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 3:
+                this.__dirty0 |= 4;
+                this.__spawnPosition = undefined;
+                this.__spawnPositionRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["id", "name", "spawnPosition"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__spawnPosition) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {World} a deep copy of this message
+     */
+    clone() {
+        return new World().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {World} other 
+     * @return {World} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.id = other.id;
+        this.name = other.name;
+        this.spawnPosition = __cloneMessage(other.spawnPosition);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {World} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof World)) return false;
+        if ((this.id ?? 0) !== (other.id ?? 0)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if (!__equalsMessage(this.spawnPosition, other.spawnPosition)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.id ?? 0);
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashMessage(hash, this.spawnPosition);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {World} 
+     */
+    clear() {
+        this.id = 0;
+        this.name = "";
+        this.__spawnPosition = undefined;
+        this.__spawnPositionRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {World} 
+     */
+    static acquire() {
+        const message = World.__pool.pop();
+        if (message === undefined) return new World();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {World} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('World instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (World.__pool.length < 64) {
+            World.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__spawnPosition) instanceof __PokeworldMathComm_math.Vector3Int) __PokeworldMathComm_math.Vector3Int.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).id = this.id; break;
+                case 2: (full ??= {}).name = this.name; break;
+                case 4: (full ??= {}).spawnPosition = this.spawnPosition ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 4) === 0 && (value = this.spawnPosition) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).spawnPosition = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {World} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.id) !== undefined) {
+                this.id = value;
+            }
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.spawnPosition) !== undefined) {
+                this.spawnPosition = value === null ? undefined : (value instanceof __PokeworldMathComm_math.Vector3Int ? value.clone().commit() : new __PokeworldMathComm_math.Vector3Int().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.spawnPosition) !== undefined) {
+                (this.spawnPosition ?? (this.spawnPosition = new __PokeworldMathComm_math.Vector3Int())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {World} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.spawnPosition)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            id: this.id,
+            name: this.name,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.spawnPosition = this.__spawnPositionRaw ?? this.__spawnPosition; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, World.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.id;
+        if (value != null && !__isInt32(value)) return __invalid("id", "int32");
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.spawnPosition;
+        if (value != null && (error = __PokeworldMathComm_math.Vector3Int.validate(value)) !== null) return __prefixError(error, "spawnPosition");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {World}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = World.acquire();
+        try {
+            let value;
+            value = json.id;
+            if (value != null) {
+                if (!__isInt32(value)) throw __invalid("id", "int32");
+                message.id = value;
+            }
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.spawnPosition;
+            if (value != null) {
+                message.spawnPosition = __decodeNested(__PokeworldMathComm_math.Vector3Int, value, "spawnPosition");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            World.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class WorldView {
+        static __layout = {
+            size: 16,
+            hash: 0xd184d78c,
+            presence: 8,
+            fields: [
+                {name: "id", type: "TYPE_INT32", offset: 8},
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "spawnPosition", type: "TYPE_MESSAGE", offset: 12, get view() { return __PokeworldMathComm_math.Vector3Int.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, WorldView.__layout.hash);
+            return new WorldView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get id() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get spawnPosition() {
+            return __flatMessage(this.__view, this.__offset + 12, __PokeworldMathComm_math.Vector3Int.View);
+        }
+
+        hasSpawnPosition() {
+            return this.spawnPosition !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class WorldColumns extends __ColumnTable {
+        static Row = class WorldRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get id() {
+                return this.__table.columns.id[this.__index];
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get spawnPosition() {
+                return this.__table.columns.spawnPosition[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                id: new Int32Array(length),
+                name: new Uint32Array(length),
+                spawnPosition: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new WorldColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.id[i] = row.id ?? 0;
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.spawnPosition[i] = row.spawnPosition;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TbWorld
+export class TbWorld {
+    static __descriptor = {
+        name: "TbWorld",
+        get clrType() { return TbWorld; },
+        fullName: "pokeworld.world.cfg.TbWorld",
+        package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.World", get clrType() { return World; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
+    /** @type {World[]} */
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbWorld.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
+
+    /** 
+     * @param {World[]} value 
+     * @return {TbWorld} 
+     */
+    withDataList(value) {
+        this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbWorld} a deep copy of this message
+     */
+    clone() {
+        return new TbWorld().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbWorld} other 
+     * @return {TbWorld} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbWorld} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbWorld)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbWorld} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbWorld} 
+     */
+    static acquire() {
+        const message = TbWorld.__pool.pop();
+        if (message === undefined) return new TbWorld();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbWorld} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbWorld instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbWorld.__pool.length < 64) {
+            TbWorld.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof World) World.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbWorld} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof World ? item.clone().commit() : new World().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbWorld} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbWorld.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = World.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbWorld}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbWorld.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(World, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbWorld.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbWorldView {
+        static __layout = {
+            size: 8,
+            hash: 0xd5baf3bf,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return World.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbWorldView.__layout.hash);
+            return new TbWorldView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, World.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbWorldColumns extends __ColumnTable {
+        static Row = class TbWorldRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbWorldColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TbTerrain
+export class TbTerrain {
+    static __descriptor = {
+        name: "TbTerrain",
+        get clrType() { return TbTerrain; },
+        fullName: "pokeworld.world.cfg.TbTerrain",
+        package: "pokeworld.world.cfg",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cfg.Terrain", get clrType() { return Terrain; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.dataList = [];
+    }
+
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
+    /** @type {Terrain[]} */
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbTerrain.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
+
+    /** 
+     * @param {Terrain[]} value 
+     * @return {TbTerrain} 
+     */
+    withDataList(value) {
+        this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["dataList"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TbTerrain} a deep copy of this message
+     */
+    clone() {
+        return new TbTerrain().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TbTerrain} other 
+     * @return {TbTerrain} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbTerrain} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbTerrain)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbTerrain} 
+     */
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbTerrain} 
+     */
+    static acquire() {
+        const message = TbTerrain.__pool.pop();
+        if (message === undefined) return new TbTerrain();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbTerrain} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbTerrain instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbTerrain.__pool.length < 64) {
+            TbTerrain.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof Terrain) Terrain.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbTerrain} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof Terrain ? item.clone().commit() : new Terrain().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TbTerrain} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbTerrain.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = Terrain.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbTerrain}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbTerrain.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(Terrain, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbTerrain.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbTerrainView {
+        static __layout = {
+            size: 8,
+            hash: 0x109bf15b,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return Terrain.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbTerrainView.__layout.hash);
+            return new TbTerrainView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, Terrain.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbTerrainColumns extends __ColumnTable {
+        static Row = class TbTerrainRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbTerrainColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/world/cfg_world.proto",
+    dependencies: ["pokeworld/math/comm_math.proto"],
+    data: "Ch9wb2tld29ybGQvd29ybGQvY2ZnX3dvcmxkLnByb3RvEhNwb2tld29ybGQud29ybGQuY2ZnGh5wb2tld29ybGQvbWF0aC9jb21tX21hdGgucHJvdG8i9QIKB1RlcnJhaW4SDgoCaWQYASABKAVSAmlkEhIKBG5hbWUYAiABKAlSBG5hbWUSGgoIcHJpb3JpdHkYAyABKAVSCHByaW9yaXR5ElYKEmV4Y2x1ZGVfcnVsZV90eXBlcxgEIAMoDjIkLnBva2V3b3JsZC53b3JsZC5jZmcuVGVycmFpblJ1bGVUeXBlQgIQAFIQZXhjbHVkZVJ1bGVUeXBlcxJjChdleGNsdWRlX3RpbGVfcnVsZV90eXBlcxgFIAMoDjIoLnBva2V3b3JsZC53b3JsZC5jZmcuVGVycmFpblRpbGVSdWxlVHlwZUICEABSFGV4Y2x1ZGVUaWxlUnVsZVR5cGVzEjQKBHR5cGUYBiABKA4yIC5wb2tld29ybGQud29ybGQuY2ZnLlRlcnJhaW5UeXBlUgR0eXBlEjcKBWZsYWdzGAcgASgOMiEucG9rZXdvcmxkLndvcmxkLmNmZy5UZXJyYWluRmxhZ3NSBWZsYWdzInMKBVdvcmxkEg4KAmlkGAEgASgFUgJpZBISCgRuYW1lGAIgASgJUgRuYW1lEkYKDnNwYXduX3Bvc2l0aW9uGAMgASgLMh8ucG9rZXdvcmxkLm1hdGguY29tbS5WZWN0b3IzSW50Ug1zcGF3blBvc2l0aW9uIkYKB1RiV29ybGQSOwoJZGF0YV9saXN0GAEgAygLMhoucG9rZXdvcmxkLndvcmxkLmNmZy5Xb3JsZEICEABSCGRhdGFMaXN0IkoKCVRiVGVycmFpbhI9CglkYXRhX2xpc3QYASADKAsyHC5wb2tld29ybGQud29ybGQuY2ZnLlRlcnJhaW5CAhAAUghkYXRhTGlzdCqwAQoMVGVycmFpbkZsYWdzEhUKEVRFUlJBSU5GTEFHU19OT05FEAASGQoVVEVSUkFJTkZMQUdTX1dBTEtBQkxFEAESGwoXVEVSUkFJTkZMQUdTX05PV0FMS0FCTEUQAhIZChVURVJSQUlORkxBR1NfUEFTU0FCTEUQBBIZChVURVJSQUlORkxBR1NfT0JTVEFDTEUQCBIbChdURVJSQUlORkxBR1NfU0lOR0xFX1dBWRAQKqkBCg9UZXJyYWluUnVsZVR5cGUSGAoUVEVSUkFJTlJVTEVUWVBFX05PTkUQABIYChRURVJSQUlOUlVMRVRZUEVfRklMTBABEhgKFFRFUlJBSU5SVUxFVFlQRV9FREdFEAISIwofVEVSUkFJTlJVTEVUWVBFX0VYVEVSSU9SX0NPUk5FUhADEiMKH1RFUlJBSU5SVUxFVFlQRV9JTlRFUklPUl9DT1JORVIQBCr/BAoTVGVycmFpblRpbGVSdWxlVHlwZRIcChhURVJSQUlOVElMRVJVTEVUWVBFX05PTkUQABIcChhURVJSQUlOVElMRVJVTEVUWVBFX0ZJTEwQARIgChxURVJSQUlOVElMRVJVTEVUWVBFX1RPUF9FREdFEAISIgoeVEVSUkFJTlRJTEVSVUxFVFlQRV9SSUdIVF9FREdFEAMSIwofVEVSUkFJTlRJTEVSVUxFVFlQRV9CT1RUT01fRURHRRAEEiEKHVRFUlJBSU5USUxFUlVMRVRZUEVfTEVGVF9FREdFEAUSMAosVEVSUkFJTlRJTEVSVUxFVFlQRV9UT1BfTEVGVF9FWFRFUklPUl9DT1JORVIQBhIxCi1URVJSQUlOVElMRVJVTEVUWVBFX1RPUF9SSUdIVF9FWFRFUklPUl9DT1JORVIQBxI0CjBURVJSQUlOVElMRVJVTEVUWVBFX0JPVFRPTV9SSUdIVF9FWFRFUklPUl9DT1JORVIQCBIzCi9URVJSQUlOVElMRVJVTEVUWVBFX0JPVFRPTV9MRUZUX0VYVEVSSU9SX0NPUk5FUhAJEjAKLFRFUlJBSU5USUxFUlVMRVRZUEVfVE9QX0xFRlRfSU5URVJJT1JfQ09STkVSEAoSMQotVEVSUkFJTlRJTEVSVUxFVFlQRV9UT1BfUklHSFRfSU5URVJJT1JfQ09STkVSEAsSNAowVEVSUkFJTlRJTEVSVUxFVFlQRV9CT1RUT01fUklHSFRfSU5URVJJT1JfQ09STkVSEAwSMwovVEVSUkFJTlRJTEVSVUxFVFlQRV9CT1RUT01fTEVGVF9JTlRFUklPUl9DT1JORVIQDSqUAQoLVGVycmFpblR5cGUSFAoQVEVSUkFJTlRZUEVfTk9ORRAAEhMKD1RFUlJBSU5UWVBFX0FJUhABEhQKEFRFUlJBSU5UWVBFX1JPQUQQAhIVChFURVJSQUlOVFlQRV9TVEFJUhADEhYKElRFUlJBSU5UWVBFX0xBRERFUhAEEhUKEVRFUlJBSU5UWVBFX1dBVEVSEAViBnByb3RvMw==",
+};
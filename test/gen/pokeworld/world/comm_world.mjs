@@ -6,6 +6,426 @@
 import * as __PokeworldMathComm_math from '../math/comm_math.mjs';
 import * as __PokeworldWorldCfg_world from './cfg_world.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: TerrainType
 export const TerrainType = {
     TERRAIN: 0,
@@ -17,10 +437,12 @@ Object.defineProperty(TerrainType, "__descriptor", {
         get clrType() { return TerrainType; },
         fullName: "pokeworld.world.comm.TerrainType",
         package: "pokeworld.world.comm",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "TERRAIN", originalName: "TERRAIN_TYPE_TERRAIN", number: 0},
             {name: "COMPOSITE_TERRAIN", originalName: "TERRAIN_TYPE_COMPOSITE_TERRAIN", number: 1}
-        ]
+        ],
+        valueIndex: [0, 1]
     },
     enumerable: false,
     writable: false,
@@ -34,15 +456,51 @@ export class TerrainDefinitionNode {
         get clrType() { return TerrainDefinitionNode; },
         fullName: "pokeworld.world.comm.TerrainDefinitionNode",
         package: "pokeworld.world.comm",
+        get file() { return __fileDescriptor; },
         fields: [
             {name: "name", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "group", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinitionGroup", get clrType() { return TerrainDefinitionGroup; },label: "LABEL_OPTIONAL"},
-            {name: "definition", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinition", get clrType() { return TerrainDefinition; },label: "LABEL_OPTIONAL"}
+            {name: "group", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinitionGroup", get clrType() { return TerrainDefinitionGroup; },oneof: "node", label: "LABEL_OPTIONAL"},
+            {name: "definition", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinition", get clrType() { return TerrainDefinition; },oneof: "node", label: "LABEL_OPTIONAL"}
         ]
     }
 
+    constructor() {
+        this.__name = "";
+    }
+
+    // Oneof: node
+    static NodeCase = Object.freeze({
+        NONE: 0,
+        GROUP: 2,
+        DEFINITION: 3,
+    });
+
+    /** @type {number} */
+    nodeCase = 0;
+    __node = undefined;
+
+    /** 
+     * @return {TerrainDefinitionNode} 
+     */
+    clearNode() {
+        this.__dirty0 |= 2;
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__node = undefined;
+        this.nodeCase = 0;
+        return this;
+    }
+
+    __name = undefined;
+
     /** @type {string} */
-    name;
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
 
     /** 
      * @param {string} value 
@@ -50,341 +508,3636 @@ export class TerrainDefinitionNode {
      */
     withName(value) {
         this.name = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    /** @type {TerrainDefinitionGroup|undefined} */
+    get group() {
+        return this.nodeCase === 2 ? this.__node : undefined;
+    }
+    set group(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            if (this.nodeCase === 2) {
+                this.__node = undefined;
+                this.nodeCase = 0;
+            }
+            return;
+        }
+        this.__node = value;
+        this.nodeCase = 2;
+    }
+
+    /** 
+     * @param {TerrainDefinitionGroup} value 
+     * @return {TerrainDefinitionNode} 
+     */
+    withGroup(value) {
+        this.group = value;
+        return this;
+    }
+
+    /** @type {TerrainDefinition|undefined} */
+    get definition() {
+        return this.nodeCase === 3 ? this.__node : undefined;
+    }
+    set definition(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            if (this.nodeCase === 3) {
+                this.__node = undefined;
+                this.nodeCase = 0;
+            }
+            return;
+        }
+        this.__node = value;
+        this.nodeCase = 3;
+    }
+
+    /** 
+     * @param {TerrainDefinition} value 
+     * @return {TerrainDefinitionNode} 
+     */
+    withDefinition(value) {
+        this.definition = value;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["name", "group", "definition"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        switch (this.nodeCase) {
+            case 2:
+            case 3:
+                if (!this.__node.__isPristine()) return false;
+                break;
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TerrainDefinitionNode} a deep copy of this message
+     */
+    clone() {
+        return new TerrainDefinitionNode().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TerrainDefinitionNode} other 
+     * @return {TerrainDefinitionNode} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.name = other.name;
+        switch (other.nodeCase) {
+            case 2: this.group = __cloneMessage(other.__node); break;
+            case 3: this.definition = __cloneMessage(other.__node); break;
+            default: this.clearNode(); break;
+        }
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TerrainDefinitionNode} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TerrainDefinitionNode)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if (this.nodeCase !== other.nodeCase) return false;
+        switch (this.nodeCase) {
+            case 2: if (!__equalsMessage(this.__node, other.__node)) return false; break;
+            case 3: if (!__equalsMessage(this.__node, other.__node)) return false; break;
+        }
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashNumber(hash, this.nodeCase);
+        switch (this.nodeCase) {
+            case 2: hash = __hashMessage(hash, this.__node); break;
+            case 3: hash = __hashMessage(hash, this.__node); break;
+        }
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TerrainDefinitionNode} 
+     */
+    clear() {
+        this.name = "";
+        this.__dirty0 = 0;
+        this.nodeCase = 0;
+        this.__node = undefined;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TerrainDefinitionNode} 
+     */
+    static acquire() {
+        const message = TerrainDefinitionNode.__pool.pop();
+        if (message === undefined) return new TerrainDefinitionNode();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TerrainDefinitionNode} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TerrainDefinitionNode instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TerrainDefinitionNode.__pool.length < 64) {
+            TerrainDefinitionNode.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        switch (this.nodeCase) {
+            case 2: TerrainDefinitionGroup.release(this.__node); break;
+            case 3: TerrainDefinition.release(this.__node); break;
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).name = this.name; break;
+                case 2: (full ??= {}).group = this.group ?? null; break;
+                case 4: (full ??= {}).definition = this.definition ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && (value = this.group) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).group = value;
+        if ((this.__dirty0 & 4) === 0 && (value = this.definition) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).definition = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TerrainDefinitionNode} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.group) !== undefined) {
+                this.group = value === null ? undefined : (value instanceof TerrainDefinitionGroup ? value.clone().commit() : new TerrainDefinitionGroup().applyDelta({ f: value }));
+            }
+            if ((value = full.definition) !== undefined) {
+                this.definition = value === null ? undefined : (value instanceof TerrainDefinition ? value.clone().commit() : new TerrainDefinition().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.group) !== undefined) {
+                (this.group ?? (this.group = new TerrainDefinitionGroup())).applyDelta(value);
+            }
+            if ((value = nested.definition) !== undefined) {
+                (this.definition ?? (this.definition = new TerrainDefinition())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TerrainDefinitionNode} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.group)) value.commit();
+        if ((value = this.definition)) value.commit();
         return this;
     }
 
-    // Oneof field (index: 0)
-    /** @type {TerrainDefinitionGroup} */
-    group;
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            name: this.name,
+        };
+        switch (this.nodeCase) {
+            case 2: json.group = this.__node; break;
+            case 3: json.definition = this.__node; break;
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TerrainDefinitionNode.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        if ((json.group != null ? 1 : 0) + (json.definition != null ? 1 : 0) > 1) return __invalid("node", "a single oneof member");
+        let value, error;
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.group;
+        if (value != null && (error = TerrainDefinitionGroup.validate(value)) !== null) return __prefixError(error, "group");
+        value = json.definition;
+        if (value != null && (error = TerrainDefinition.validate(value)) !== null) return __prefixError(error, "definition");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TerrainDefinitionNode}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        if ((json.group != null ? 1 : 0) + (json.definition != null ? 1 : 0) > 1) throw __invalid("node", "a single oneof member");
+        const message = TerrainDefinitionNode.acquire();
+        try {
+            let value;
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.group;
+            if (value != null) {
+                message.group = __decodeNested(TerrainDefinitionGroup, value, "group");
+            }
+            value = json.definition;
+            if (value != null) {
+                message.definition = __decodeNested(TerrainDefinition, value, "definition");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TerrainDefinitionNode.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TerrainDefinitionNodeView {
+        static __layout = {
+            size: 24,
+            hash: 0x83746ce2,
+            presence: 8,
+            fields: [
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "group", type: "TYPE_MESSAGE", offset: 12, oneof: 8, number: 2, get view() { return TerrainDefinitionGroup.View; }},
+                {name: "definition", type: "TYPE_MESSAGE", offset: 16, oneof: 8, number: 3, get view() { return TerrainDefinition.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TerrainDefinitionNodeView.__layout.hash);
+            return new TerrainDefinitionNodeView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get nodeCase() {
+            return __flatUint32(this.__view, this.__offset + 8);
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get group() {
+            return __flatUint32(this.__view, this.__offset + 8) === 2 ? __flatMessage(this.__view, this.__offset + 12, TerrainDefinitionGroup.View) : undefined;
+        }
+
+        get definition() {
+            return __flatUint32(this.__view, this.__offset + 8) === 3 ? __flatMessage(this.__view, this.__offset + 16, TerrainDefinition.View) : undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TerrainDefinitionNodeColumns extends __ColumnTable {
+        static Row = class TerrainDefinitionNodeRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get group() {
+                return this.__table.columns.group[this.__index];
+            }
+
+            get definition() {
+                return this.__table.columns.definition[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                name: new Uint32Array(length),
+                group: new Array(length),
+                definition: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TerrainDefinitionNodeColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.group[i] = row.group;
+                columns.definition[i] = row.definition;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TerrainDefinitionGroup
+export class TerrainDefinitionGroup {
+    static __descriptor = {
+        name: "TerrainDefinitionGroup",
+        get clrType() { return TerrainDefinitionGroup; },
+        fullName: "pokeworld.world.comm.TerrainDefinitionGroup",
+        package: "pokeworld.world.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "name", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "nodes", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinitionNode", get clrType() { return TerrainDefinitionNode; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.__name = "";
+        this.nodes = [];
+    }
+
+    __name = undefined;
+
+    /** @type {string} */
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {TerrainDefinitionGroup} 
+     */
+    withName(value) {
+        this.name = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __nodes = undefined;
+    __nodesRaw = undefined;
+
+    /** @type {TerrainDefinitionNode[]} */
+    get nodes() {
+        if (this.__nodesRaw !== undefined) {
+            this.__nodes = this.__decode(TerrainDefinitionGroup.__descriptor.fields[1], this.__nodesRaw, this.__nodes);
+            this.__nodesRaw = undefined;
+        }
+        return this.__nodes;
+    }
+    set nodes(value) {
+        this.__rawStale = true;
+        this.__nodesRaw = undefined;
+        this.__nodes = value;
+    }
+
+    /** 
+     * @param {TerrainDefinitionNode[]} value 
+     * @return {TerrainDefinitionGroup} 
+     */
+    withNodes(value) {
+        this.nodes = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 2:
+                this.__nodesRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["name", "nodes"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__nodes) != null) {
+            raw = this.__raw.nodes;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TerrainDefinitionGroup} a deep copy of this message
+     */
+    clone() {
+        return new TerrainDefinitionGroup().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TerrainDefinitionGroup} other 
+     * @return {TerrainDefinitionGroup} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.name = other.name;
+        this.nodes = __cloneArray(other.nodes, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TerrainDefinitionGroup} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TerrainDefinitionGroup)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if (!__equalsArray(this.nodes, other.nodes, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashArray(hash, this.nodes, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TerrainDefinitionGroup} 
+     */
+    clear() {
+        this.name = "";
+        this.__nodesRaw = undefined;
+        if (Array.isArray(this.nodes)) this.nodes.length = 0; else this.nodes = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TerrainDefinitionGroup} 
+     */
+    static acquire() {
+        const message = TerrainDefinitionGroup.__pool.pop();
+        if (message === undefined) return new TerrainDefinitionGroup();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TerrainDefinitionGroup} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TerrainDefinitionGroup instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TerrainDefinitionGroup.__pool.length < 64) {
+            TerrainDefinitionGroup.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__nodes)) {
+            for (const item of this.__nodes) {
+                if (item instanceof TerrainDefinitionNode) TerrainDefinitionNode.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).name = this.name; break;
+                case 2: (full ??= {}).nodes = this.nodes; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && Array.isArray(this.nodes)) {
+            const list = this.nodes;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).nodes = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TerrainDefinitionGroup} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.nodes) !== undefined) {
+                this.nodes = value === null ? [] : value.map(item => (item instanceof TerrainDefinitionNode ? item.clone().commit() : new TerrainDefinitionNode().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.nodes) !== undefined) {
+                const list = this.nodes;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TerrainDefinitionGroup} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.nodes)) {
+            for (const item of this.nodes) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            name: this.name,
+            nodes: this.__nodesRaw ?? this.__nodes,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TerrainDefinitionGroup.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.nodes;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("nodes", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = TerrainDefinitionNode.validate(item)) !== null) return __prefixError(error, "nodes", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TerrainDefinitionGroup}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TerrainDefinitionGroup.acquire();
+        try {
+            let value;
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.nodes;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("nodes", "array");
+                const list = new Array(value.length);
+                message.nodes = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(TerrainDefinitionNode, item, "nodes", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TerrainDefinitionGroup.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TerrainDefinitionGroupView {
+        static __layout = {
+            size: 16,
+            hash: 0x58693d27,
+            presence: 16,
+            fields: [
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "nodes", type: "TYPE_MESSAGE", offset: 8, repeated: true, stride: 4, get view() { return TerrainDefinitionNode.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TerrainDefinitionGroupView.__layout.hash);
+            return new TerrainDefinitionGroupView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get nodes() {
+            return __flatList(this.__view, this.__offset + 8, 4, __flatMessage, TerrainDefinitionNode.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TerrainDefinitionGroupColumns extends __ColumnTable {
+        static Row = class TerrainDefinitionGroupRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get nodes() {
+                return this.__table.columns.nodes[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                name: new Uint32Array(length),
+                nodes: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TerrainDefinitionGroupColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.nodes[i] = row.nodes;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TerrainDefinition
+export class TerrainDefinition {
+    static __descriptor = {
+        name: "TerrainDefinition",
+        get clrType() { return TerrainDefinition; },
+        fullName: "pokeworld.world.comm.TerrainDefinition",
+        package: "pokeworld.world.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "name", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "type", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.world.comm.TerrainType", get clrType() { return TerrainType; },label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__name = "";
+        this.__type = TerrainType.TERRAIN;
+    }
+
+    __name = undefined;
+
+    /** @type {string} */
+    get name() {
+        return this.__name;
+    }
+    set name(value) {
+        this.__rawStale = true;
+        this.__name = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {TerrainDefinition} 
+     */
+    withName(value) {
+        this.name = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __type = undefined;
+
+    /** @type {TerrainType[keyof typeof TerrainType]} */
+    get type() {
+        return this.__type;
+    }
+    set type(value) {
+        this.__rawStale = true;
+        this.__type = value;
+    }
+
+    /** 
+     * @param {TerrainType[keyof typeof TerrainType]} value 
+     * @return {TerrainDefinition} 
+     */
+    withType(value) {
+        this.type = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["name", "type"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {TerrainDefinition} a deep copy of this message
+     */
+    clone() {
+        return new TerrainDefinition().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TerrainDefinition} other 
+     * @return {TerrainDefinition} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.name = other.name;
+        this.type = other.type;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TerrainDefinition} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TerrainDefinition)) return false;
+        if ((this.name ?? "") !== (other.name ?? "")) return false;
+        if ((this.type ?? TerrainType.TERRAIN) !== (other.type ?? TerrainType.TERRAIN)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.name ?? "");
+        hash = __hashNumber(hash, this.type ?? TerrainType.TERRAIN);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TerrainDefinition} 
+     */
+    clear() {
+        this.name = "";
+        this.type = TerrainType.TERRAIN;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TerrainDefinition} 
+     */
+    static acquire() {
+        const message = TerrainDefinition.__pool.pop();
+        if (message === undefined) return new TerrainDefinition();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TerrainDefinition} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TerrainDefinition instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TerrainDefinition.__pool.length < 64) {
+            TerrainDefinition.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).name = this.name; break;
+                case 2: (full ??= {}).type = this.type; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TerrainDefinition} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.name) !== undefined) {
+                this.name = value;
+            }
+            if ((value = full.type) !== undefined) {
+                this.type = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TerrainDefinition} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            name: this.name,
+            type: this.type,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TerrainDefinition.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.name;
+        if (value != null && !__isString(value)) return __invalid("name", "string");
+        value = json.type;
+        if (value != null && !__isEnum(TerrainType, value)) return __invalid("type", "enum TerrainType");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TerrainDefinition}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TerrainDefinition.acquire();
+        try {
+            let value;
+            value = json.name;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("name", "string");
+                message.name = value;
+            }
+            value = json.type;
+            if (value != null) {
+                if (!__isEnum(TerrainType, value)) throw __invalid("type", "enum TerrainType");
+                message.type = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TerrainDefinition.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TerrainDefinitionView {
+        static __layout = {
+            size: 16,
+            hash: 0x44bc18ff,
+            presence: 8,
+            fields: [
+                {name: "name", type: "TYPE_STRING", offset: 0},
+                {name: "type", type: "TYPE_ENUM", offset: 8}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TerrainDefinitionView.__layout.hash);
+            return new TerrainDefinitionView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get name() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get type() {
+            return __flatInt32(this.__view, this.__offset + 8);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TerrainDefinitionColumns extends __ColumnTable {
+        static Row = class TerrainDefinitionRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get name() {
+                const table = this.__table;
+                return table.dictionaries.name[table.columns.name[this.__index]];
+            }
+
+            get type() {
+                return this.__table.columns.type[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {name: []};
+            this.columns = {
+                name: new Uint32Array(length),
+                type: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TerrainDefinitionColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const nameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.name[i] = __columnEncode(nameCodes, dictionaries.name, row.name ?? "");
+                columns.type[i] = row.type ?? TerrainType.TERRAIN;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: __TerrainSection_Tile
+class __TerrainSection_Tile {
+    static __descriptor = {
+        name: "Tile",
+        get clrType() { return __TerrainSection_Tile; },
+        fullName: "pokeworld.world.comm.TerrainSection.Tile",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "coordinate", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector3Int", get clrType() { return __PokeworldMathComm_math.Vector3Int; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "ruleType", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.world.cfg.TerrainTileRuleType", get clrType() { return __PokeworldWorldCfg_world.TerrainTileRuleType; },label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__ruleType = __PokeworldWorldCfg_world.TerrainTileRuleType.NONE;
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __coordinate = undefined;
+    __coordinateRaw = undefined;
+
+    /** @type {__PokeworldMathComm_math.Vector3Int|undefined} */
+    get coordinate() {
+        if (this.__coordinateRaw !== undefined) {
+            this.__coordinate = this.__decode(__TerrainSection_Tile.__descriptor.fields[0], this.__coordinateRaw, this.__coordinate);
+            this.__coordinateRaw = undefined;
+        }
+        return this.__coordinate;
+    }
+    set coordinate(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__coordinateRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__coordinate = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__coordinate = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasCoordinate() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {__TerrainSection_Tile} 
+     */
+    clearCoordinate() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__coordinate = undefined;
+        this.__coordinateRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldMathComm_math.Vector3Int} value 
+     * @return {__TerrainSection_Tile} 
+     */
+    withCoordinate(value) {
+        this.coordinate = value;
+        return this;
+    }
+
+    __ruleType = undefined;
+
+    /** @type {__PokeworldWorldCfg_world.TerrainTileRuleType[keyof typeof __PokeworldWorldCfg_world.TerrainTileRuleType]} */
+    get ruleType() {
+        return this.__ruleType;
+    }
+    set ruleType(value) {
+        this.__rawStale = true;
+        this.__ruleType = value;
+    }
+
+    /** 
+     * @param {__PokeworldWorldCfg_world.TerrainTileRuleType[keyof typeof __PokeworldWorldCfg_world.TerrainTileRuleType]} value 
+     * @return {__TerrainSection_Tile} 
+     */
+    withRuleType(value) {
+        this.ruleType = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dirty0 |= 1;
+                this.__coordinate = undefined;
+                this.__coordinateRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["coordinate", "ruleType"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__coordinate) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {__TerrainSection_Tile} a deep copy of this message
+     */
+    clone() {
+        return new __TerrainSection_Tile().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {__TerrainSection_Tile} other 
+     * @return {__TerrainSection_Tile} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.coordinate = __cloneMessage(other.coordinate);
+        this.ruleType = other.ruleType;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {__TerrainSection_Tile} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof __TerrainSection_Tile)) return false;
+        if (!__equalsMessage(this.coordinate, other.coordinate)) return false;
+        if ((this.ruleType ?? __PokeworldWorldCfg_world.TerrainTileRuleType.NONE) !== (other.ruleType ?? __PokeworldWorldCfg_world.TerrainTileRuleType.NONE)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashMessage(hash, this.coordinate);
+        hash = __hashNumber(hash, this.ruleType ?? __PokeworldWorldCfg_world.TerrainTileRuleType.NONE);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {__TerrainSection_Tile} 
+     */
+    clear() {
+        this.ruleType = __PokeworldWorldCfg_world.TerrainTileRuleType.NONE;
+        this.__coordinate = undefined;
+        this.__coordinateRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {__TerrainSection_Tile} 
+     */
+    static acquire() {
+        const message = __TerrainSection_Tile.__pool.pop();
+        if (message === undefined) return new __TerrainSection_Tile();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {__TerrainSection_Tile} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('__TerrainSection_Tile instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (__TerrainSection_Tile.__pool.length < 64) {
+            __TerrainSection_Tile.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__coordinate) instanceof __PokeworldMathComm_math.Vector3Int) __PokeworldMathComm_math.Vector3Int.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).coordinate = this.coordinate ?? null; break;
+                case 2: (full ??= {}).ruleType = this.ruleType; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.coordinate) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).coordinate = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {__TerrainSection_Tile} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.coordinate) !== undefined) {
+                this.coordinate = value === null ? undefined : (value instanceof __PokeworldMathComm_math.Vector3Int ? value.clone().commit() : new __PokeworldMathComm_math.Vector3Int().applyDelta({ f: value }));
+            }
+            if ((value = full.ruleType) !== undefined) {
+                this.ruleType = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.coordinate) !== undefined) {
+                (this.coordinate ?? (this.coordinate = new __PokeworldMathComm_math.Vector3Int())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {__TerrainSection_Tile} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.coordinate)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            ruleType: this.ruleType,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.coordinate = this.__coordinateRaw ?? this.__coordinate; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, __TerrainSection_Tile.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.coordinate;
+        if (value != null && (error = __PokeworldMathComm_math.Vector3Int.validate(value)) !== null) return __prefixError(error, "coordinate");
+        value = json.ruleType;
+        if (value != null && !__isEnum(__PokeworldWorldCfg_world.TerrainTileRuleType, value)) return __invalid("ruleType", "enum TerrainTileRuleType");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {__TerrainSection_Tile}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = __TerrainSection_Tile.acquire();
+        try {
+            let value;
+            value = json.coordinate;
+            if (value != null) {
+                message.coordinate = __decodeNested(__PokeworldMathComm_math.Vector3Int, value, "coordinate");
+            }
+            value = json.ruleType;
+            if (value != null) {
+                if (!__isEnum(__PokeworldWorldCfg_world.TerrainTileRuleType, value)) throw __invalid("ruleType", "enum TerrainTileRuleType");
+                message.ruleType = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            __TerrainSection_Tile.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class __TerrainSection_TileView {
+        static __layout = {
+            size: 8,
+            hash: 0xea4cedd9,
+            presence: 0,
+            fields: [
+                {name: "coordinate", type: "TYPE_MESSAGE", offset: 0, get view() { return __PokeworldMathComm_math.Vector3Int.View; }},
+                {name: "ruleType", type: "TYPE_ENUM", offset: 4}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, __TerrainSection_TileView.__layout.hash);
+            return new __TerrainSection_TileView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get coordinate() {
+            return __flatMessage(this.__view, this.__offset + 0, __PokeworldMathComm_math.Vector3Int.View);
+        }
+
+        hasCoordinate() {
+            return this.coordinate !== undefined;
+        }
+
+        get ruleType() {
+            return __flatInt32(this.__view, this.__offset + 4);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class __TerrainSection_TileColumns extends __ColumnTable {
+        static Row = class __TerrainSection_TileRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get coordinate() {
+                return this.__table.columns.coordinate[this.__index];
+            }
+
+            get ruleType() {
+                return this.__table.columns.ruleType[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                coordinate: new Array(length),
+                ruleType: new Int32Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new __TerrainSection_TileColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.coordinate[i] = row.coordinate;
+                columns.ruleType[i] = row.ruleType ?? __PokeworldWorldCfg_world.TerrainTileRuleType.NONE;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: TerrainSection
+export class TerrainSection {
+    static __descriptor = {
+        name: "TerrainSection",
+        get clrType() { return TerrainSection; },
+        fullName: "pokeworld.world.comm.TerrainSection",
+        package: "pokeworld.world.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "terrainName", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "tiles", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainSection.Tile", get clrType() { return __TerrainSection_Tile; },lazy: true, label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.__terrainName = "";
+        this.tiles = [];
+    }
+
+    __terrainName = undefined;
+
+    /** @type {string} */
+    get terrainName() {
+        return this.__terrainName;
+    }
+    set terrainName(value) {
+        this.__rawStale = true;
+        this.__terrainName = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {TerrainSection} 
+     */
+    withTerrainName(value) {
+        this.terrainName = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __tiles = undefined;
+    __tilesRaw = undefined;
+
+    /** @type {__TerrainSection_Tile[]} */
+    get tiles() {
+        if (this.__tilesRaw !== undefined) {
+            this.__tiles = this.__decode(TerrainSection.__descriptor.fields[1], this.__tilesRaw, this.__tiles);
+            this.__tilesRaw = undefined;
+        }
+        return this.__tiles;
+    }
+    set tiles(value) {
+        this.__rawStale = true;
+        this.__tilesRaw = undefined;
+        this.__tiles = value;
+    }
+
+    /** 
+     * @param {__TerrainSection_Tile[]} value 
+     * @return {TerrainSection} 
+     */
+    withTiles(value) {
+        this.tiles = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 2:
+                this.__tilesRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["terrainName", "tiles"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__tiles) != null) {
+            raw = this.__raw.tiles;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {TerrainSection} a deep copy of this message
+     */
+    clone() {
+        return new TerrainSection().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {TerrainSection} other 
+     * @return {TerrainSection} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.terrainName = other.terrainName;
+        this.tiles = __cloneArray(other.tiles, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TerrainSection} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TerrainSection)) return false;
+        if ((this.terrainName ?? "") !== (other.terrainName ?? "")) return false;
+        if (!__equalsArray(this.tiles, other.tiles, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.terrainName ?? "");
+        hash = __hashArray(hash, this.tiles, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TerrainSection} 
+     */
+    clear() {
+        this.terrainName = "";
+        this.__tilesRaw = undefined;
+        if (Array.isArray(this.tiles)) this.tiles.length = 0; else this.tiles = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TerrainSection} 
+     */
+    static acquire() {
+        const message = TerrainSection.__pool.pop();
+        if (message === undefined) return new TerrainSection();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TerrainSection} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TerrainSection instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TerrainSection.__pool.length < 64) {
+            TerrainSection.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__tiles)) {
+            for (const item of this.__tiles) {
+                if (item instanceof __TerrainSection_Tile) __TerrainSection_Tile.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).terrainName = this.terrainName; break;
+                case 2: (full ??= {}).tiles = this.tiles; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && Array.isArray(this.tiles)) {
+            const list = this.tiles;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).tiles = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TerrainSection} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.terrainName) !== undefined) {
+                this.terrainName = value;
+            }
+            if ((value = full.tiles) !== undefined) {
+                this.tiles = value === null ? [] : value.map(item => (item instanceof __TerrainSection_Tile ? item.clone().commit() : new __TerrainSection_Tile().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.tiles) !== undefined) {
+                const list = this.tiles;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {TerrainSection} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.tiles)) {
+            for (const item of this.tiles) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            terrainName: this.terrainName,
+            tiles: this.__tilesRaw ?? this.__tiles,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TerrainSection.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.terrainName;
+        if (value != null && !__isString(value)) return __invalid("terrainName", "string");
+        value = json.tiles;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("tiles", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = __TerrainSection_Tile.validate(item)) !== null) return __prefixError(error, "tiles", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TerrainSection}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TerrainSection.acquire();
+        try {
+            let value;
+            value = json.terrainName;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("terrainName", "string");
+                message.terrainName = value;
+            }
+            value = json.tiles;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("tiles", "array");
+                const list = new Array(value.length);
+                message.tiles = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(__TerrainSection_Tile, item, "tiles", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TerrainSection.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class TerrainSectionView {
+        static __layout = {
+            size: 16,
+            hash: 0x9fe27280,
+            presence: 16,
+            fields: [
+                {name: "terrainName", type: "TYPE_STRING", offset: 0},
+                {name: "tiles", type: "TYPE_MESSAGE", offset: 8, repeated: true, stride: 4, get view() { return __TerrainSection_Tile.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TerrainSectionView.__layout.hash);
+            return new TerrainSectionView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get terrainName() {
+            return __flatString(this.__view, this.__offset + 0);
+        }
+
+        get tiles() {
+            return __flatList(this.__view, this.__offset + 8, 4, __flatMessage, __TerrainSection_Tile.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TerrainSectionColumns extends __ColumnTable {
+        static Row = class TerrainSectionRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get terrainName() {
+                const table = this.__table;
+                return table.dictionaries.terrainName[table.columns.terrainName[this.__index]];
+            }
+
+            get tiles() {
+                return this.__table.columns.tiles[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {terrainName: []};
+            this.columns = {
+                terrainName: new Uint32Array(length),
+                tiles: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TerrainSectionColumns(rows.length);
+            const { columns, dictionaries } = table;
+            const terrainNameCodes = new Map();
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.terrainName[i] = __columnEncode(terrainNameCodes, dictionaries.terrainName, row.terrainName ?? "");
+                columns.tiles[i] = row.tiles;
+            }
+            return table;
+        }
+    };
+
+    static Tile = __TerrainSection_Tile;
+}
+
+// Message: __WorldData_TerrainSectionByNameEntry
+class __WorldData_TerrainSectionByNameEntry {
+    static __descriptor = {
+        name: "TerrainSectionByNameEntry",
+        get clrType() { return __WorldData_TerrainSectionByNameEntry; },
+        fullName: "pokeworld.world.comm.WorldData.TerrainSectionByNameEntry",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "key", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
+            {name: "value", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainSection", get clrType() { return TerrainSection; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__key = "";
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __key = undefined;
+
+    /** @type {string} */
+    get key() {
+        return this.__key;
+    }
+    set key(value) {
+        this.__rawStale = true;
+        this.__key = value;
+    }
+
+    /** 
+     * @param {string} value 
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    withKey(value) {
+        this.key = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __value = undefined;
+    __valueRaw = undefined;
+
+    /** @type {TerrainSection|undefined} */
+    get value() {
+        if (this.__valueRaw !== undefined) {
+            this.__value = this.__decode(__WorldData_TerrainSectionByNameEntry.__descriptor.fields[1], this.__valueRaw, this.__value);
+            this.__valueRaw = undefined;
+        }
+        return this.__value;
+    }
+    set value(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__valueRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__value = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__value = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasValue() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    clearValue() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__value = undefined;
+        this.__valueRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {TerrainSection} value 
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    withValue(value) {
+        this.value = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 2:
+                this.__dirty0 |= 2;
+                this.__value = undefined;
+                this.__valueRaw = raw;
+                this.__has0 |= 1;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["key", "value"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__value) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {__WorldData_TerrainSectionByNameEntry} a deep copy of this message
+     */
+    clone() {
+        return new __WorldData_TerrainSectionByNameEntry().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {__WorldData_TerrainSectionByNameEntry} other 
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.key = other.key;
+        this.value = __cloneMessage(other.value);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {__WorldData_TerrainSectionByNameEntry} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof __WorldData_TerrainSectionByNameEntry)) return false;
+        if ((this.key ?? "") !== (other.key ?? "")) return false;
+        if (!__equalsMessage(this.value, other.value)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashString(hash, this.key ?? "");
+        hash = __hashMessage(hash, this.value);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    clear() {
+        this.key = "";
+        this.__value = undefined;
+        this.__valueRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    static acquire() {
+        const message = __WorldData_TerrainSectionByNameEntry.__pool.pop();
+        if (message === undefined) return new __WorldData_TerrainSectionByNameEntry();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {__WorldData_TerrainSectionByNameEntry} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('__WorldData_TerrainSectionByNameEntry instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (__WorldData_TerrainSectionByNameEntry.__pool.length < 64) {
+            __WorldData_TerrainSectionByNameEntry.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__value) instanceof TerrainSection) TerrainSection.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).key = this.key; break;
+                case 2: (full ??= {}).value = this.value ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && (value = this.value) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).value = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.key) !== undefined) {
+                this.key = value;
+            }
+            if ((value = full.value) !== undefined) {
+                this.value = value === null ? undefined : (value instanceof TerrainSection ? value.clone().commit() : new TerrainSection().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.value) !== undefined) {
+                (this.value ?? (this.value = new TerrainSection())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {__WorldData_TerrainSectionByNameEntry} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.value)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            key: this.key,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.value = this.__valueRaw ?? this.__value; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, __WorldData_TerrainSectionByNameEntry.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.key;
+        if (value != null && !__isString(value)) return __invalid("key", "string");
+        value = json.value;
+        if (value != null && (error = TerrainSection.validate(value)) !== null) return __prefixError(error, "value");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {__WorldData_TerrainSectionByNameEntry}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = __WorldData_TerrainSectionByNameEntry.acquire();
+        try {
+            let value;
+            value = json.key;
+            if (value != null) {
+                if (!__isString(value)) throw __invalid("key", "string");
+                message.key = value;
+            }
+            value = json.value;
+            if (value != null) {
+                message.value = __decodeNested(TerrainSection, value, "value");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            __WorldData_TerrainSectionByNameEntry.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+}
+
+// Message: WorldData
+export class WorldData {
+    static __descriptor = {
+        name: "WorldData",
+        get clrType() { return WorldData; },
+        fullName: "pokeworld.world.comm.WorldData",
+        package: "pokeworld.world.comm",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "tileSize", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
+            {name: "startPosition", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector3", get clrType() { return __PokeworldMathComm_math.Vector3; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "baseRange", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector2Int", get clrType() { return __PokeworldMathComm_math.Vector2Int; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "terrainDefinitionNodes", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinitionNode", get clrType() { return TerrainDefinitionNode; },lazy: true, label: "LABEL_REPEATED"},
+            {name: "terrainSectionByName", number: 5, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.WorldData.TerrainSectionByNameEntry", get clrType() { return __WorldData_TerrainSectionByNameEntry; },label: "LABEL_REPEATED"}
+        ]
+    }
+
+    constructor() {
+        this.__tileSize = 0;
+        this.terrainDefinitionNodes = [];
+        this.__terrainSectionByName = [];
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __tileSize = undefined;
+
+    /** @type {number} */
+    get tileSize() {
+        return this.__tileSize;
+    }
+    set tileSize(value) {
+        this.__rawStale = true;
+        this.__tileSize = value;
+    }
+
+    /** 
+     * @param {number} value 
+     * @return {WorldData} 
+     */
+    withTileSize(value) {
+        this.tileSize = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __startPosition = undefined;
+    __startPositionRaw = undefined;
+
+    /** @type {__PokeworldMathComm_math.Vector3|undefined} */
+    get startPosition() {
+        if (this.__startPositionRaw !== undefined) {
+            this.__startPosition = this.__decode(WorldData.__descriptor.fields[1], this.__startPositionRaw, this.__startPosition);
+            this.__startPositionRaw = undefined;
+        }
+        return this.__startPosition;
+    }
+    set startPosition(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__startPositionRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__startPosition = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__startPosition = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasStartPosition() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {WorldData} 
+     */
+    clearStartPosition() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__startPosition = undefined;
+        this.__startPositionRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldMathComm_math.Vector3} value 
+     * @return {WorldData} 
+     */
+    withStartPosition(value) {
+        this.startPosition = value;
+        return this;
+    }
+
+    __baseRange = undefined;
+    __baseRangeRaw = undefined;
+
+    /** @type {__PokeworldMathComm_math.Vector2Int|undefined} */
+    get baseRange() {
+        if (this.__baseRangeRaw !== undefined) {
+            this.__baseRange = this.__decode(WorldData.__descriptor.fields[2], this.__baseRangeRaw, this.__baseRange);
+            this.__baseRangeRaw = undefined;
+        }
+        return this.__baseRange;
+    }
+    set baseRange(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__baseRangeRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__baseRange = undefined;
+            this.__has0 &= ~2;
+        } else {
+            this.__baseRange = value;
+            this.__has0 |= 2;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasBaseRange() {
+        return (this.__has0 & 2) !== 0;
+    }
+
+    /** 
+     * @return {WorldData} 
+     */
+    clearBaseRange() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__baseRange = undefined;
+        this.__baseRangeRaw = undefined;
+        this.__has0 &= ~2;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldMathComm_math.Vector2Int} value 
+     * @return {WorldData} 
+     */
+    withBaseRange(value) {
+        this.baseRange = value;
+        return this;
+    }
+
+    __terrainDefinitionNodes = undefined;
+    __terrainDefinitionNodesRaw = undefined;
+
+    /** @type {TerrainDefinitionNode[]} */
+    get terrainDefinitionNodes() {
+        if (this.__terrainDefinitionNodesRaw !== undefined) {
+            this.__terrainDefinitionNodes = this.__decode(WorldData.__descriptor.fields[3], this.__terrainDefinitionNodesRaw, this.__terrainDefinitionNodes);
+            this.__terrainDefinitionNodesRaw = undefined;
+        }
+        return this.__terrainDefinitionNodes;
+    }
+    set terrainDefinitionNodes(value) {
+        this.__rawStale = true;
+        this.__terrainDefinitionNodesRaw = undefined;
+        this.__terrainDefinitionNodes = value;
+    }
+
+    /** 
+     * @param {TerrainDefinitionNode[]} value 
+     * @return {WorldData} 
+     */
+    withTerrainDefinitionNodes(value) {
+        this.terrainDefinitionNodes = value;
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __terrainSectionByName = undefined;
+
+    /** @type {any} */
+    get terrainSectionByName() {
+        return this.__terrainSectionByName;
+    }
+    set terrainSectionByName(value) {
+        this.__rawStale = true;
+        this.__terrainSectionByName = value;
+    }
+
+    /** 
+     * @param {any} value 
+     * @return {WorldData} 
+     */
+    withTerrainSectionByName(value) {
+        this.terrainSectionByName = value;
+        this.__dirty0 |= 16;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 2:
+                this.__dirty0 |= 2;
+                this.__startPosition = undefined;
+                this.__startPositionRaw = raw;
+                this.__has0 |= 1;
+                break;
+            case 3:
+                this.__dirty0 |= 4;
+                this.__baseRange = undefined;
+                this.__baseRangeRaw = raw;
+                this.__has0 |= 2;
+                break;
+            case 4:
+                this.__terrainDefinitionNodesRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["tileSize", "startPosition", "baseRange", "terrainDefinitionNodes", "terrainSectionByName"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__startPosition) != null && !value.__isPristine()) return false;
+        if ((value = this.__baseRange) != null && !value.__isPristine()) return false;
+        if ((value = this.__terrainDefinitionNodes) != null) {
+            raw = this.__raw.terrainDefinitionNodes;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        if ((value = this.__terrainSectionByName) != null) {
+            raw = this.__raw.terrainSectionByName;
+            if (raw == null ? Object.keys(value).length !== 0
+                : Array.isArray(value) !== Array.isArray(raw) || Object.keys(value).length !== Object.keys(raw).length) return false;
+            for (const key in value) {
+                if (value[key] != null && !value[key].__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {WorldData} a deep copy of this message
+     */
+    clone() {
+        return new WorldData().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {WorldData} other 
+     * @return {WorldData} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.tileSize = other.tileSize;
+        this.startPosition = __cloneMessage(other.startPosition);
+        this.baseRange = __cloneMessage(other.baseRange);
+        this.terrainDefinitionNodes = __cloneArray(other.terrainDefinitionNodes, __cloneMessage);
+        this.terrainSectionByName = __cloneMap(other.terrainSectionByName, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {WorldData} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof WorldData)) return false;
+        if ((this.tileSize ?? 0) !== (other.tileSize ?? 0)) return false;
+        if (!__equalsMessage(this.startPosition, other.startPosition)) return false;
+        if (!__equalsMessage(this.baseRange, other.baseRange)) return false;
+        if (!__equalsArray(this.terrainDefinitionNodes, other.terrainDefinitionNodes, __equalsMessage)) return false;
+        if (!__equalsMap(this.terrainSectionByName, other.terrainSectionByName, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.tileSize ?? 0);
+        hash = __hashMessage(hash, this.startPosition);
+        hash = __hashMessage(hash, this.baseRange);
+        hash = __hashArray(hash, this.terrainDefinitionNodes, __hashMessage);
+        hash = __hashMap(hash, this.terrainSectionByName, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {WorldData} 
+     */
+    clear() {
+        this.tileSize = 0;
+        this.__terrainDefinitionNodesRaw = undefined;
+        if (Array.isArray(this.terrainDefinitionNodes)) this.terrainDefinitionNodes.length = 0; else this.terrainDefinitionNodes = [];
+        if (Array.isArray(this.terrainSectionByName)) this.terrainSectionByName.length = 0; else this.terrainSectionByName = [];
+        this.__startPosition = undefined;
+        this.__startPositionRaw = undefined;
+        this.__baseRange = undefined;
+        this.__baseRangeRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {TerrainDefinitionGroup} value 
-     * @return {TerrainDefinitionNode} 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {WorldData} 
      */
-    withGroup(value) {
-        this.group = value;
-        return this;
+    static acquire() {
+        const message = WorldData.__pool.pop();
+        if (message === undefined) return new WorldData();
+        message.__released = false;
+        return message;
     }
 
-    // Oneof field (index: 0)
-    /** @type {TerrainDefinition} */
-    definition;
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {WorldData} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('WorldData instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (WorldData.__pool.length < 64) {
+            WorldData.__pool.push(message);
+        }
+    }
 
     /** 
-     * @param {TerrainDefinition} value 
-     * @return {TerrainDefinitionNode} 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
      */
-    withDefinition(value) {
-        this.definition = value;
-        return this;
+    __releaseOwned() {
+        let value;
+        if ((value = this.__startPosition) instanceof __PokeworldMathComm_math.Vector3) __PokeworldMathComm_math.Vector3.release(value);
+        if ((value = this.__baseRange) instanceof __PokeworldMathComm_math.Vector2Int) __PokeworldMathComm_math.Vector2Int.release(value);
+        if (Array.isArray(this.__terrainDefinitionNodes)) {
+            for (const item of this.__terrainDefinitionNodes) {
+                if (item instanceof TerrainDefinitionNode) TerrainDefinitionNode.release(item);
+            }
+        }
     }
 
-}
+    // Dirty field bitmask
+    __dirty0 = 0;
 
-// Message: TerrainDefinitionGroup
-export class TerrainDefinitionGroup {
-    static __descriptor = {
-        name: "TerrainDefinitionGroup",
-        get clrType() { return TerrainDefinitionGroup; },
-        fullName: "pokeworld.world.comm.TerrainDefinitionGroup",
-        package: "pokeworld.world.comm",
-        fields: [
-            {name: "name", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "nodes", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinitionNode", get clrType() { return TerrainDefinitionNode; },label: "LABEL_REPEATED"}
-        ]
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-    /** @type {string} */
-    name;
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).tileSize = this.tileSize; break;
+                case 2: (full ??= {}).startPosition = this.startPosition ?? null; break;
+                case 4: (full ??= {}).baseRange = this.baseRange ?? null; break;
+                case 8: (full ??= {}).terrainDefinitionNodes = this.terrainDefinitionNodes; break;
+                case 16: (full ??= {}).terrainSectionByName = this.terrainSectionByName; break;
+            }
+        }
+        if ((this.__dirty0 & 2) === 0 && (value = this.startPosition) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).startPosition = value;
+        if ((this.__dirty0 & 4) === 0 && (value = this.baseRange) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).baseRange = value;
+        if ((this.__dirty0 & 8) === 0 && Array.isArray(this.terrainDefinitionNodes)) {
+            const list = this.terrainDefinitionNodes;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).terrainDefinitionNodes = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
     /** 
-     * @param {string} value 
-     * @return {TerrainDefinitionGroup} 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {WorldData} 
      */
-    withName(value) {
-        this.name = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.tileSize) !== undefined) {
+                this.tileSize = value;
+            }
+            if ((value = full.startPosition) !== undefined) {
+                this.startPosition = value === null ? undefined : (value instanceof __PokeworldMathComm_math.Vector3 ? value.clone().commit() : new __PokeworldMathComm_math.Vector3().applyDelta({ f: value }));
+            }
+            if ((value = full.baseRange) !== undefined) {
+                this.baseRange = value === null ? undefined : (value instanceof __PokeworldMathComm_math.Vector2Int ? value.clone().commit() : new __PokeworldMathComm_math.Vector2Int().applyDelta({ f: value }));
+            }
+            if ((value = full.terrainDefinitionNodes) !== undefined) {
+                this.terrainDefinitionNodes = value === null ? [] : value.map(item => (item instanceof TerrainDefinitionNode ? item.clone().commit() : new TerrainDefinitionNode().applyDelta({ f: item })));
+            }
+            if ((value = full.terrainSectionByName) !== undefined) {
+                this.terrainSectionByName = value === null ? [] : value.slice();
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.startPosition) !== undefined) {
+                (this.startPosition ?? (this.startPosition = new __PokeworldMathComm_math.Vector3())).applyDelta(value);
+            }
+            if ((value = nested.baseRange) !== undefined) {
+                (this.baseRange ?? (this.baseRange = new __PokeworldMathComm_math.Vector2Int())).applyDelta(value);
+            }
+            if ((value = nested.terrainDefinitionNodes) !== undefined) {
+                const list = this.terrainDefinitionNodes;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {TerrainDefinitionNode[]} */
-    nodes;
-
     /** 
-     * @param {TerrainDefinitionNode[]} value 
-     * @return {TerrainDefinitionGroup} 
+     * Mark the current state as synchronized
+     * @return {WorldData} 
      */
-    withNodes(value) {
-        this.nodes = value;
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.startPosition)) value.commit();
+        if ((value = this.baseRange)) value.commit();
+        if (Array.isArray(this.terrainDefinitionNodes)) {
+            for (const item of this.terrainDefinitionNodes) item?.commit();
+        }
         return this;
     }
 
-}
-
-// Message: TerrainDefinition
-export class TerrainDefinition {
-    static __descriptor = {
-        name: "TerrainDefinition",
-        get clrType() { return TerrainDefinition; },
-        fullName: "pokeworld.world.comm.TerrainDefinition",
-        package: "pokeworld.world.comm",
-        fields: [
-            {name: "name", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "type", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.world.comm.TerrainType", get clrType() { return TerrainType; },label: "LABEL_OPTIONAL"}
-        ]
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            tileSize: this.tileSize,
+            terrainDefinitionNodes: this.__terrainDefinitionNodesRaw ?? this.__terrainDefinitionNodes,
+            terrainSectionByName: this.terrainSectionByName,
+        };
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.startPosition = this.__startPositionRaw ?? this.__startPosition; break;
+                case 2: json.baseRange = this.__baseRangeRaw ?? this.__baseRange; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, WorldData.__knownKeys);
     }
 
-    /** @type {string} */
-    name;
-
-    /** 
-     * @param {string} value 
-     * @return {TerrainDefinition} 
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
      */
-    withName(value) {
-        this.name = value;
-        return this;
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.tileSize;
+        if (value != null && !__isFloat(value)) return __invalid("tileSize", "float");
+        value = json.startPosition;
+        if (value != null && (error = __PokeworldMathComm_math.Vector3.validate(value)) !== null) return __prefixError(error, "startPosition");
+        value = json.baseRange;
+        if (value != null && (error = __PokeworldMathComm_math.Vector2Int.validate(value)) !== null) return __prefixError(error, "baseRange");
+        value = json.terrainDefinitionNodes;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("terrainDefinitionNodes", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = TerrainDefinitionNode.validate(item)) !== null) return __prefixError(error, "terrainDefinitionNodes", i);
+            }
+        }
+        value = json.terrainSectionByName;
+        if (value != null) {
+            if (Array.isArray(value)) {
+                for (let i = 0; i < value.length; i++) {
+                    if ((error = __WorldData_TerrainSectionByNameEntry.validate(value[i])) !== null) return __prefixError(error, "terrainSectionByName", i);
+                }
+            } else if (!__isObject(value)) {
+                return __invalid("terrainSectionByName", "object or array of entries");
+            } else {
+                for (const key in value) {
+                    const item = value[key];
+                    if ((error = TerrainSection.validate(item)) !== null) return __prefixError(error, "terrainSectionByName", key);
+                }
+            }
+        }
+        return null;
     }
 
-    /** @type {TerrainType[keyof typeof TerrainType]} */
-    type;
-
-    /** 
-     * @param {TerrainType[keyof typeof TerrainType]} value 
-     * @return {TerrainDefinition} 
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {WorldData}
+     * @throws {Error} ValidationError carrying the field path
      */
-    withType(value) {
-        this.type = value;
-        return this;
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = WorldData.acquire();
+        try {
+            let value;
+            value = json.tileSize;
+            if (value != null) {
+                if (!__isFloat(value)) throw __invalid("tileSize", "float");
+                message.tileSize = value;
+            }
+            value = json.startPosition;
+            if (value != null) {
+                message.startPosition = __decodeNested(__PokeworldMathComm_math.Vector3, value, "startPosition");
+            }
+            value = json.baseRange;
+            if (value != null) {
+                message.baseRange = __decodeNested(__PokeworldMathComm_math.Vector2Int, value, "baseRange");
+            }
+            value = json.terrainDefinitionNodes;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("terrainDefinitionNodes", "array");
+                const list = new Array(value.length);
+                message.terrainDefinitionNodes = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(TerrainDefinitionNode, item, "terrainDefinitionNodes", i);
+                }
+            }
+            value = json.terrainSectionByName;
+            if (value != null) {
+                if (Array.isArray(value)) {
+                    message.terrainSectionByName = value.map((item, i) => __decodeNested(__WorldData_TerrainSectionByNameEntry, item, "terrainSectionByName", i));
+                } else {
+                    if (!__isObject(value)) throw __invalid("terrainSectionByName", "object or array of entries");
+                    const map = {};
+                    for (const key in value) {
+                        const item = value[key];
+                        map[key] = __decodeNested(TerrainSection, item, "terrainSectionByName", key);
+                    }
+                    message.terrainSectionByName = map;
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            WorldData.release(message);
+            throw error;
+        }
+        return message;
     }
 
+    // Zero-copy reader over the flat binary blob format
+    static View = class WorldDataView {
+        static __layout = {
+            size: 32,
+            hash: 0x84c01d79,
+            presence: 16,
+            fields: [
+                {name: "tileSize", type: "TYPE_FLOAT", offset: 16},
+                {name: "startPosition", type: "TYPE_MESSAGE", offset: 20, get view() { return __PokeworldMathComm_math.Vector3.View; }},
+                {name: "baseRange", type: "TYPE_MESSAGE", offset: 24, get view() { return __PokeworldMathComm_math.Vector2Int.View; }},
+                {name: "terrainDefinitionNodes", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return TerrainDefinitionNode.View; }},
+                {name: "terrainSectionByName", type: "TYPE_MESSAGE", offset: 8, repeated: true, stride: 16, map: [{name: "key", type: "TYPE_STRING", offset: 0}, {name: "value", type: "TYPE_MESSAGE", offset: 8, get view() { return TerrainSection.View; }}]}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, WorldDataView.__layout.hash);
+            return new WorldDataView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get tileSize() {
+            return __flatFloat(this.__view, this.__offset + 16);
+        }
+
+        get startPosition() {
+            return __flatMessage(this.__view, this.__offset + 20, __PokeworldMathComm_math.Vector3.View);
+        }
+
+        hasStartPosition() {
+            return this.startPosition !== undefined;
+        }
+
+        get baseRange() {
+            return __flatMessage(this.__view, this.__offset + 24, __PokeworldMathComm_math.Vector2Int.View);
+        }
+
+        hasBaseRange() {
+            return this.baseRange !== undefined;
+        }
+
+        get terrainDefinitionNodes() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, TerrainDefinitionNode.View);
+        }
+
+        get terrainSectionByName() {
+            return __flatMap(this.__view, this.__offset + 8, 16, __flatString, 0, __flatMessage, 8, TerrainSection.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class WorldDataColumns extends __ColumnTable {
+        static Row = class WorldDataRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get tileSize() {
+                return this.__table.columns.tileSize[this.__index];
+            }
+
+            get startPosition() {
+                return this.__table.columns.startPosition[this.__index];
+            }
+
+            get baseRange() {
+                return this.__table.columns.baseRange[this.__index];
+            }
+
+            get terrainDefinitionNodes() {
+                return this.__table.columns.terrainDefinitionNodes[this.__index];
+            }
+
+            get terrainSectionByName() {
+                return this.__table.columns.terrainSectionByName[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                tileSize: new Float32Array(length),
+                startPosition: new Array(length),
+                baseRange: new Array(length),
+                terrainDefinitionNodes: new Array(length),
+                terrainSectionByName: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new WorldDataColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.tileSize[i] = row.tileSize ?? 0;
+                columns.startPosition[i] = row.startPosition;
+                columns.baseRange[i] = row.baseRange;
+                columns.terrainDefinitionNodes[i] = row.terrainDefinitionNodes;
+                columns.terrainSectionByName[i] = row.terrainSectionByName;
+            }
+            return table;
+        }
+    };
+
+    static TerrainSectionByNameEntry = __WorldData_TerrainSectionByNameEntry;
 }
 
-class __TerrainSection_Tile {
+// Message: TbWorldData
+export class TbWorldData {
     static __descriptor = {
-        name: "Tile",
-        get clrType() { return __TerrainSection_Tile; },
-        fullName: "pokeworld.world.comm.TerrainSection.Tile",
+        name: "TbWorldData",
+        get clrType() { return TbWorldData; },
+        fullName: "pokeworld.world.comm.TbWorldData",
+        package: "pokeworld.world.comm",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "coordinate", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector3Int", get clrType() { return __PokeworldMathComm_math.Vector3Int; },label: "LABEL_OPTIONAL"},
-            {name: "ruleType", number: 2, type: "TYPE_ENUM", typeName: ".pokeworld.world.cfg.TerrainTileRuleType", get clrType() { return __PokeworldWorldCfg_world.TerrainTileRuleType; },label: "LABEL_OPTIONAL"}
+            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.WorldData", get clrType() { return WorldData; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
     constructor() {
-        this.coordinate = null;
-        this.ruleType = 0;
+        this.dataList = [];
     }
 
-    /** @type {__PokeworldMathComm_math.Vector3Int} */
-    coordinate;
+    __dataList = undefined;
+    __dataListRaw = undefined;
+
+    /** @type {WorldData[]} */
+    get dataList() {
+        if (this.__dataListRaw !== undefined) {
+            this.__dataList = this.__decode(TbWorldData.__descriptor.fields[0], this.__dataListRaw, this.__dataList);
+            this.__dataListRaw = undefined;
+        }
+        return this.__dataList;
+    }
+    set dataList(value) {
+        this.__rawStale = true;
+        this.__dataListRaw = undefined;
+        this.__dataList = value;
+    }
 
     /** 
-     * @param {__PokeworldMathComm_math.Vector3Int} value 
-     * @return {__TerrainSection_Tile} 
+     * @param {WorldData[]} value 
+     * @return {TbWorldData} 
      */
-    withCoordinate(value) {
-        this.coordinate = value;
+    withDataList(value) {
+        this.dataList = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
-    /** @type {__PokeworldWorldCfg_world.TerrainTileRuleType} */
-    ruleType;
+    __decode = undefined;
 
     /** 
-     * @param {__PokeworldWorldCfg_world.TerrainTileRuleType} value 
-     * @return {__TerrainSection_Tile} 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
      */
-    withRuleType(value) {
-        this.ruleType = value;
-        return this;
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dataListRaw = raw;
+                break;
+        }
     }
 
-}
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
 
-// Message: TerrainSection
-export class TerrainSection {
-    static __descriptor = {
-        name: "TerrainSection",
-        get clrType() { return TerrainSection; },
-        fullName: "pokeworld.world.comm.TerrainSection",
-        package: "pokeworld.world.comm",
-        fields: [
-            {name: "terrainName", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "tiles", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainSection.Tile", get clrType() { return __TerrainSection_Tile; },label: "LABEL_REPEATED"}
-        ]
-    }
+    static __knownKeys = new Set(["dataList"]);
 
-    /** @type {string} */
-    terrainName;
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
 
     /** 
-     * @param {string} value 
-     * @return {TerrainSection} 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
      */
-    withTerrainName(value) {
-        this.terrainName = value;
-        return this;
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__dataList) != null) {
+            raw = this.__raw.dataList;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
     }
 
-    /** @type {__TerrainSection_Tile[]} */
-    tiles;
+    /** 
+     * @return {TbWorldData} a deep copy of this message
+     */
+    clone() {
+        return new TbWorldData().copyFrom(this);
+    }
 
     /** 
-     * @param {__TerrainSection_Tile[]} value 
-     * @return {TerrainSection} 
+     * Deep copy all fields from another message of the same type
+     * @param {TbWorldData} other 
+     * @return {TbWorldData} 
      */
-    withTiles(value) {
-        this.tiles = value;
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.dataList = __cloneArray(other.dataList, __cloneMessage);
         return this;
     }
 
-    static Tile = __TerrainSection_Tile;
-}
-
-class __WorldData_TerrainSectionByNameEntry {
-    static __descriptor = {
-        name: "TerrainSectionByNameEntry",
-        get clrType() { return __WorldData_TerrainSectionByNameEntry; },
-        fullName: "pokeworld.world.comm.WorldData.TerrainSectionByNameEntry",
-        fields: [
-            {name: "key", number: 1, type: "TYPE_STRING", label: "LABEL_OPTIONAL"},
-            {name: "value", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainSection", get clrType() { return TerrainSection; },label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {TbWorldData} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof TbWorldData)) return false;
+        if (!__equalsArray(this.dataList, other.dataList, __equalsMessage)) return false;
+        return true;
     }
 
-    constructor() {
-        this.key = "";
-        this.value = null;
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.dataList, __hashMessage);
+        return hash;
     }
 
-    /** @type {string} */
-    key;
-
     /** 
-     * @param {string} value 
-     * @return {__WorldData_TerrainSectionByNameEntry} 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {TbWorldData} 
      */
-    withKey(value) {
-        this.key = value;
+    clear() {
+        this.__dataListRaw = undefined;
+        if (Array.isArray(this.dataList)) this.dataList.length = 0; else this.dataList = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-    /** @type {TerrainSection} */
-    value;
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {TerrainSection} value 
-     * @return {__WorldData_TerrainSectionByNameEntry} 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {TbWorldData} 
      */
-    withValue(value) {
-        this.value = value;
-        return this;
+    static acquire() {
+        const message = TbWorldData.__pool.pop();
+        if (message === undefined) return new TbWorldData();
+        message.__released = false;
+        return message;
     }
 
-}
-
-// Message: WorldData
-export class WorldData {
-    static __descriptor = {
-        name: "WorldData",
-        get clrType() { return WorldData; },
-        fullName: "pokeworld.world.comm.WorldData",
-        package: "pokeworld.world.comm",
-        fields: [
-            {name: "tileSize", number: 1, type: "TYPE_FLOAT", label: "LABEL_OPTIONAL"},
-            {name: "startPosition", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector3", get clrType() { return __PokeworldMathComm_math.Vector3; },label: "LABEL_OPTIONAL"},
-            {name: "baseRange", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.math.comm.Vector2Int", get clrType() { return __PokeworldMathComm_math.Vector2Int; },label: "LABEL_OPTIONAL"},
-            {name: "terrainDefinitionNodes", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.TerrainDefinitionNode", get clrType() { return TerrainDefinitionNode; },label: "LABEL_REPEATED"},
-            {name: "terrainSectionByName", number: 5, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.WorldData.TerrainSectionByNameEntry", get clrType() { return __WorldData_TerrainSectionByNameEntry; },label: "LABEL_REPEATED"}
-        ]
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {TbWorldData} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('TbWorldData instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (TbWorldData.__pool.length < 64) {
+            TbWorldData.__pool.push(message);
+        }
     }
 
-    /** @type {number} */
-    tileSize;
-
     /** 
-     * @param {number} value 
-     * @return {WorldData} 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
      */
-    withTileSize(value) {
-        this.tileSize = value;
-        return this;
+    __releaseOwned() {
+        if (Array.isArray(this.__dataList)) {
+            for (const item of this.__dataList) {
+                if (item instanceof WorldData) WorldData.release(item);
+            }
+        }
     }
 
-    /** @type {__PokeworldMathComm_math.Vector3} */
-    startPosition;
+    // Dirty field bitmask
+    __dirty0 = 0;
 
     /** 
-     * @param {__PokeworldMathComm_math.Vector3} value 
-     * @return {WorldData} 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
      */
-    withStartPosition(value) {
-        this.startPosition = value;
-        return this;
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-    /** @type {__PokeworldMathComm_math.Vector2Int} */
-    baseRange;
-
     /** 
-     * @param {__PokeworldMathComm_math.Vector2Int} value 
-     * @return {WorldData} 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
      */
-    withBaseRange(value) {
-        this.baseRange = value;
-        return this;
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).dataList = this.dataList; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.dataList)) {
+            const list = this.dataList;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).dataList = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
     }
 
-    /** @type {TerrainDefinitionNode[]} */
-    terrainDefinitionNodes;
-
     /** 
-     * @param {TerrainDefinitionNode[]} value 
-     * @return {WorldData} 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {TbWorldData} 
      */
-    withTerrainDefinitionNodes(value) {
-        this.terrainDefinitionNodes = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.dataList) !== undefined) {
+                this.dataList = value === null ? [] : value.map(item => (item instanceof WorldData ? item.clone().commit() : new WorldData().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.dataList) !== undefined) {
+                const list = this.dataList;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {any} */
-    terrainSectionByName;
-
     /** 
-     * @param {any} value 
-     * @return {WorldData} 
+     * Mark the current state as synchronized
+     * @return {TbWorldData} 
      */
-    withTerrainSectionByName(value) {
-        this.terrainSectionByName = value;
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.dataList)) {
+            for (const item of this.dataList) item?.commit();
+        }
         return this;
     }
 
-    static TerrainSectionByNameEntry = __WorldData_TerrainSectionByNameEntry;
-}
-
-// Message: TbWorldData
-export class TbWorldData {
-    static __descriptor = {
-        name: "TbWorldData",
-        get clrType() { return TbWorldData; },
-        fullName: "pokeworld.world.comm.TbWorldData",
-        package: "pokeworld.world.comm",
-        fields: [
-            {name: "dataList", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.comm.WorldData", get clrType() { return WorldData; },label: "LABEL_REPEATED"}
-        ]
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            dataList: this.__dataListRaw ?? this.__dataList,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, TbWorldData.__knownKeys);
     }
 
-    /** @type {WorldData[]} */
-    dataList;
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.dataList;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("dataList", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = WorldData.validate(item)) !== null) return __prefixError(error, "dataList", i);
+            }
+        }
+        return null;
+    }
 
-    /** 
-     * @param {WorldData[]} value 
-     * @return {TbWorldData} 
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {TbWorldData}
+     * @throws {Error} ValidationError carrying the field path
      */
-    withDataList(value) {
-        this.dataList = value;
-        return this;
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = TbWorldData.acquire();
+        try {
+            let value;
+            value = json.dataList;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("dataList", "array");
+                const list = new Array(value.length);
+                message.dataList = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(WorldData, item, "dataList", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            TbWorldData.release(message);
+            throw error;
+        }
+        return message;
     }
 
+    // Zero-copy reader over the flat binary blob format
+    static View = class TbWorldDataView {
+        static __layout = {
+            size: 8,
+            hash: 0x7f46f6cf,
+            presence: 8,
+            fields: [
+                {name: "dataList", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return WorldData.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, TbWorldDataView.__layout.hash);
+            return new TbWorldDataView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get dataList() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, WorldData.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class TbWorldDataColumns extends __ColumnTable {
+        static Row = class TbWorldDataRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get dataList() {
+                return this.__table.columns.dataList[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                dataList: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new TbWorldDataColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.dataList[i] = row.dataList;
+            }
+            return table;
+        }
+    };
+
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/world/comm_world.proto",
+    dependencies: ["pokeworld/world/cfg_world.proto", "pokeworld/math/comm_math.proto"],
+    data: "CiBwb2tld29ybGQvd29ybGQvY29tbV93b3JsZC5wcm90bxIUcG9rZXdvcmxkLndvcmxkLmNvbW0aH3Bva2V3b3JsZC93b3JsZC9jZmdfd29ybGQucHJvdG8aHnBva2V3b3JsZC9tYXRoL2NvbW1fbWF0aC5wcm90byLEAQoVVGVycmFpbkRlZmluaXRpb25Ob2RlEhIKBG5hbWUYASABKAlSBG5hbWUSRAoFZ3JvdXAYAiABKAsyLC5wb2tld29ybGQud29ybGQuY29tbS5UZXJyYWluRGVmaW5pdGlvbkdyb3VwSABSBWdyb3VwEkkKCmRlZmluaXRpb24YAyABKAsyJy5wb2tld29ybGQud29ybGQuY29tbS5UZXJyYWluRGVmaW5pdGlvbkgAUgpkZWZpbml0aW9uQgYKBG5vZGUibwoWVGVycmFpbkRlZmluaXRpb25Hcm91cBISCgRuYW1lGAEgASgJUgRuYW1lEkEKBW5vZGVzGAIgAygLMisucG9rZXdvcmxkLndvcmxkLmNvbW0uVGVycmFpbkRlZmluaXRpb25Ob2RlUgVub2RlcyJeChFUZXJyYWluRGVmaW5pdGlvbhISCgRuYW1lGAEgASgJUgRuYW1lEjUKBHR5cGUYAiABKA4yIS5wb2tld29ybGQud29ybGQuY29tbS5UZXJyYWluVHlwZVIEdHlwZSKFAgoOVGVycmFpblNlY3Rpb24SIQoMdGVycmFpbl9uYW1lGAEgASgJUgt0ZXJyYWluTmFtZRI/CgV0aWxlcxgCIAMoCzIpLnBva2V3b3JsZC53b3JsZC5jb21tLlRlcnJhaW5TZWN0aW9uLlRpbGVSBXRpbGVzGo4BCgRUaWxlEj8KCmNvb3JkaW5hdGUYASABKAsyHy5wb2tld29ybGQubWF0aC5jb21tLlZlY3RvcjNJbnRSCmNvb3JkaW5hdGUSRQoJcnVsZV90eXBlGAIgASgOMigucG9rZXdvcmxkLndvcmxkLmNmZy5UZXJyYWluVGlsZVJ1bGVUeXBlUghydWxlVHlwZSL1AwoJV29ybGREYXRhEhsKCXRpbGVfc2l6ZRgBIAEoAlIIdGlsZVNpemUSQwoOc3RhcnRfcG9zaXRpb24YAiABKAsyHC5wb2tld29ybGQubWF0aC5jb21tLlZlY3RvcjNSDXN0YXJ0UG9zaXRpb24SPgoKYmFzZV9yYW5nZRgDIAEoCzIfLnBva2V3b3JsZC5tYXRoLmNvbW0uVmVjdG9yMkludFIJYmFzZVJhbmdlEmUKGHRlcnJhaW5fZGVmaW5pdGlvbl9ub2RlcxgEIAMoCzIrLnBva2V3b3JsZC53b3JsZC5jb21tLlRlcnJhaW5EZWZpbml0aW9uTm9kZVIWdGVycmFpbkRlZmluaXRpb25Ob2RlcxJwChd0ZXJyYWluX3NlY3Rpb25fYnlfbmFtZRgFIAMoCzI5LnBva2V3b3JsZC53b3JsZC5jb21tLldvcmxkRGF0YS5UZXJyYWluU2VjdGlvbkJ5TmFtZUVudHJ5UhR0ZXJyYWluU2VjdGlvbkJ5TmFtZRptChlUZXJyYWluU2VjdGlvbkJ5TmFtZUVudHJ5EhAKA2tleRgBIAEoCVIDa2V5EjoKBXZhbHVlGAIgASgLMiQucG9rZXdvcmxkLndvcmxkLmNvbW0uVGVycmFpblNlY3Rpb25SBXZhbHVlOgI4ASJPCgtUYldvcmxkRGF0YRJACglkYXRhX2xpc3QYASADKAsyHy5wb2tld29ybGQud29ybGQuY29tbS5Xb3JsZERhdGFCAhAAUghkYXRhTGlzdCpLCgtUZXJyYWluVHlwZRIYChRURVJSQUlOX1RZUEVfVEVSUkFJThAAEiIKHlRFUlJBSU5fVFlQRV9DT01QT1NJVEVfVEVSUkFJThABYgZwcm90bzM=",
+};
@@ -5,6 +5,426 @@
 
 import * as __PokeworldEntityComm_entity from '../entity/comm_entity.mjs';
 
+// Value helpers for clone/equals/hashCode
+const __hashView = new DataView(new ArrayBuffer(8));
+
+function __hashNumber(hash, value) {
+    if ((value | 0) === value) {
+        return (Math.imul(hash, 31) + value) | 0;
+    }
+    __hashView.setFloat64(0, value);
+    return (Math.imul(Math.imul(hash, 31) + __hashView.getInt32(0), 31) + __hashView.getInt32(4)) | 0;
+}
+
+function __hashString(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value.charCodeAt(i)) | 0;
+    }
+    return hash;
+}
+
+function __hashBool(hash, value) {
+    return (Math.imul(hash, 31) + (value ? 1231 : 1237)) | 0;
+}
+
+function __hashBytes(hash, value) {
+    for (let i = 0; i < value.length; i++) {
+        hash = (Math.imul(hash, 31) + value[i]) | 0;
+    }
+    return hash;
+}
+
+function __hashMessage(hash, value) {
+    return (Math.imul(hash, 31) + (value == null ? 0 : value.hashCode())) | 0;
+}
+
+function __hashArray(hash, list, hashItem) {
+    if (list == null) return hash;
+    for (let i = 0; i < list.length; i++) {
+        hash = hashItem(hash, list[i]);
+    }
+    return hash;
+}
+
+function __hashMap(hash, map, hashValue) {
+    // Order independent, a missing map hashes like an empty one
+    let sum = 0;
+    for (const key in map) {
+        sum = (sum + (__hashString(17, key) ^ hashValue(17, map[key]))) | 0;
+    }
+    return (Math.imul(hash, 31) + sum) | 0;
+}
+
+function __equalsMessage(a, b) {
+    return a == null ? b == null : b != null && a.equals(b);
+}
+
+function __equalsBytes(a, b) {
+    if (a == null || b == null) return a == b;
+    if (a.length !== b.length) return false;
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] !== b[i]) return false;
+    }
+    return true;
+}
+
+function __equalsArray(a, b, equalsItem) {
+    const lengthA = a == null ? 0 : a.length;
+    const lengthB = b == null ? 0 : b.length;
+    if (lengthA !== lengthB) return false;
+    for (let i = 0; i < lengthA; i++) {
+        if (equalsItem === undefined ? a[i] !== b[i] : !equalsItem(a[i], b[i])) return false;
+    }
+    return true;
+}
+
+function __equalsMap(a, b, equalsValue) {
+    const keysA = a == null ? [] : Object.keys(a);
+    if (keysA.length !== (b == null ? 0 : Object.keys(b).length)) return false;
+    for (const key of keysA) {
+        if (!Object.hasOwn(b, key)) return false;
+        if (equalsValue === undefined ? a[key] !== b[key] : !equalsValue(a[key], b[key])) return false;
+    }
+    return true;
+}
+
+function __cloneMessage(value) {
+    return value == null ? value : value.clone();
+}
+
+function __cloneBytes(value) {
+    return value == null ? value : value.slice();
+}
+
+function __cloneArray(list, cloneItem) {
+    if (list == null) return [];
+    return cloneItem === undefined ? list.slice() : list.map(cloneItem);
+}
+
+function __cloneMap(map, cloneValue) {
+    const result = {};
+    if (map == null) return result;
+    for (const key in map) {
+        result[key] = cloneValue === undefined ? map[key] : cloneValue(map[key]);
+    }
+    return result;
+}
+
+// Validation helpers used by validate/validateAndDecode
+function __invalid(path, expected) {
+    const error = new Error(`${path === '' ? '<root>' : path}: expected ${expected}`);
+    error.name = 'ValidationError';
+    error.path = path;
+    error.expected = expected;
+    return error;
+}
+
+// Paths are only built while an error unwinds, never on success
+function __prefixError(error, name, index) {
+    if (error.name !== 'ValidationError') return error;
+    const segment = index === undefined ? name : `${name}[${index}]`;
+    error.path = error.path === '' ? segment : `${segment}.${error.path}`;
+    error.message = `${error.path}: expected ${error.expected}`;
+    return error;
+}
+
+function __decodeNested(type, value, name, index) {
+    try {
+        return type.validateAndDecode(value);
+    } catch (error) {
+        throw __prefixError(error, name, index);
+    }
+}
+
+function __isObject(value) {
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+function __isInt32(value) {
+    return typeof value === 'number' && (value | 0) === value;
+}
+
+function __isUint32(value) {
+    return typeof value === 'number' && value >>> 0 === value;
+}
+
+function __isInt64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && Math.abs(value) <= 9223372036854775807;
+    return typeof value === 'string' && /^-?(?:0|[1-9]\d{0,18})$/.test(value) &&
+        BigInt.asIntN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isUint64(value) {
+    if (typeof value === 'number') return Number.isInteger(value) && value >= 0 && value <= 18446744073709551615;
+    return typeof value === 'string' && /^(?:0|[1-9]\d{0,19})$/.test(value) &&
+        BigInt.asUintN(64, BigInt(value)) === BigInt(value);
+}
+
+function __isFloat(value) {
+    return typeof value === 'number' && !(Math.abs(value) > 3.4028234663852886e38 && Number.isFinite(value));
+}
+
+function __isDouble(value) {
+    return typeof value === 'number';
+}
+
+function __isBool(value) {
+    return typeof value === 'boolean';
+}
+
+function __isString(value) {
+    return typeof value === 'string';
+}
+
+function __isBytes(value) {
+    return typeof value === 'string' || value instanceof Uint8Array || Array.isArray(value);
+}
+
+function __isEnum(enumType, value) {
+    if (!__isInt32(value)) return false;
+    const valueIndex = enumType.__descriptor.valueIndex;
+    const index = valueIndex instanceof Map ? valueIndex.get(value) : valueIndex[value];
+    return index !== undefined && index >= 0;
+}
+
+function __isNumericKey(key, isValid) {
+    const number = Number(key);
+    return String(number) === key && isValid(number);
+}
+
+// Pass-through helper: keys of retained JSON no field reads are written back
+function __copyUnknown(json, raw, knownKeys) {
+    for (const key in raw) {
+        if (!knownKeys.has(key)) json[key] = raw[key];
+    }
+    return json;
+}
+
+// Flat blob readers used by the generated views
+const __flatTextDecoder = new TextDecoder();
+
+function __flatOpen(buffer, hash) {
+    const view = ArrayBuffer.isView(buffer) ?
+        new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength) : new DataView(buffer);
+    if (view.byteLength < 16 || view.getUint32(0, true) !== 0x31464250) {
+        throw new Error('Invalid flat blob (bad magic)');
+    }
+    if (view.getUint32(4, true) !== hash) {
+        throw new Error('Flat blob layout does not match the generated view');
+    }
+    return view;
+}
+
+function __flatBool(view, offset) {
+    return view.getUint8(offset) !== 0;
+}
+
+function __flatInt32(view, offset) {
+    return view.getInt32(offset, true);
+}
+
+function __flatUint32(view, offset) {
+    return view.getUint32(offset, true);
+}
+
+function __flatFloat(view, offset) {
+    return view.getFloat32(offset, true);
+}
+
+function __flatDouble(view, offset) {
+    return view.getFloat64(offset, true);
+}
+
+function __flatInt64(view, offset) {
+    const high = view.getInt32(offset + 4, true);
+    if (high > -0x200000 && high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigInt64(offset, true);
+}
+
+function __flatUint64(view, offset) {
+    const high = view.getUint32(offset + 4, true);
+    if (high < 0x200000) return high * 4294967296 + view.getUint32(offset, true);
+    return view.getBigUint64(offset, true);
+}
+
+function __flatBytes(view, offset) {
+    return new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), view.getUint32(offset + 4, true));
+}
+
+function __flatString(view, offset) {
+    const length = view.getUint32(offset + 4, true);
+    if (length === 0) return '';
+    return __flatTextDecoder.decode(new Uint8Array(view.buffer, view.byteOffset + view.getUint32(offset, true), length));
+}
+
+function __flatMessage(view, offset, viewCls) {
+    const record = view.getUint32(offset, true);
+    return record === 0 ? undefined : new viewCls(view, record);
+}
+
+class __FlatList {
+    constructor(view, offset, length, stride, read, viewCls) {
+        this.__view = view;
+        this.__offset = offset;
+        this.__stride = stride;
+        this.__read = read;
+        this.__viewCls = viewCls;
+        this.length = length;
+    }
+
+    get(index) {
+        if (index < 0 || index >= this.length) return undefined;
+        return this.__read(this.__view, this.__offset + index * this.__stride, this.__viewCls);
+    }
+
+    *[Symbol.iterator]() {
+        for (let i = 0; i < this.length; i++) {
+            yield this.__read(this.__view, this.__offset + i * this.__stride, this.__viewCls);
+        }
+    }
+
+    toArray() {
+        return Array.from(this);
+    }
+}
+
+function __flatList(view, offset, stride, read, viewCls) {
+    return new __FlatList(view, view.getUint32(offset, true), view.getUint32(offset + 4, true), stride, read, viewCls);
+}
+
+function __flatMap(view, offset, stride, readKey, keyOffset, readValue, valueOffset, valueViewCls) {
+    const result = {};
+    const base = view.getUint32(offset, true);
+    const count = view.getUint32(offset + 4, true);
+    for (let i = 0; i < count; i++) {
+        const entry = base + i * stride;
+        result[readKey(view, entry + keyOffset)] = readValue(view, entry + valueOffset, valueViewCls);
+    }
+    return result;
+}
+
+// Columnar table base shared by the generated Columns classes
+function __columnEncode(codes, dictionary, value) {
+    let code = codes.get(value);
+    if (code === undefined) {
+        code = dictionary.length;
+        dictionary.push(value);
+        codes.set(value, code);
+    }
+    return code;
+}
+
+function __column(table, field) {
+    if (!Object.hasOwn(table.columns, field)) {
+        throw new Error(`Unknown column '${field}'`);
+    }
+    return table.columns[field];
+}
+
+function __columnNumeric(table, field) {
+    const column = __column(table, field);
+    if (!ArrayBuffer.isView(column) || Object.hasOwn(table.dictionaries, field)) {
+        throw new Error(`'${field}' is not a numeric column`);
+    }
+    return column;
+}
+
+// Columns live in their own object, apart from length and the methods, so
+// that no field name can shadow them
+class __ColumnTable {
+    row(index) {
+        return new this.constructor.Row(this, index);
+    }
+
+    rows(selection) {
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Array(count);
+        for (let k = 0; k < count; k++) {
+            result[k] = this.row(selection === undefined ? k : selection[k]);
+        }
+        return result;
+    }
+
+    // Indices of the rows whose field value satisfies predicate, optionally within a selection
+    where(field, predicate, selection) {
+        const column = __column(this, field);
+        const count = selection === undefined ? this.length : selection.length;
+        const result = new Uint32Array(count);
+        let n = 0;
+        const dictionary = Object.hasOwn(this.dictionaries, field) ? this.dictionaries[field] : undefined;
+        if (dictionary !== undefined) {
+            // Evaluate the predicate once per distinct string
+            const matches = new Uint8Array(dictionary.length);
+            for (let code = 0; code < dictionary.length; code++) {
+                matches[code] = predicate(dictionary[code]) ? 1 : 0;
+            }
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (matches[column[i]] !== 0) result[n++] = i;
+            }
+        } else {
+            for (let k = 0; k < count; k++) {
+                const i = selection === undefined ? k : selection[k];
+                if (predicate(column[i])) result[n++] = i;
+            }
+        }
+        return result.subarray(0, n);
+    }
+
+    count(selection) {
+        return selection === undefined ? this.length : selection.length;
+    }
+
+    sum(field, selection) {
+        const column = __columnNumeric(this, field);
+        let total = column instanceof BigInt64Array || column instanceof BigUint64Array ? 0n : 0;
+        if (selection === undefined) {
+            for (let i = 0; i < this.length; i++) total += column[i];
+        } else {
+            for (let k = 0; k < selection.length; k++) total += column[selection[k]];
+        }
+        return total;
+    }
+
+    mean(field, selection) {
+        const count = this.count(selection);
+        return count === 0 ? NaN : Number(this.sum(field, selection)) / count;
+    }
+
+    min(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value < result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    max(field, selection) {
+        const column = __columnNumeric(this, field);
+        let result = -Infinity;
+        const count = this.count(selection);
+        for (let k = 0; k < count; k++) {
+            const value = column[selection === undefined ? k : selection[k]];
+            if (value > result) result = value;
+        }
+        return count === 0 ? undefined : result;
+    }
+
+    // Materialize the given fields of the selected rows as plain objects
+    project(fields, selection) {
+        return this.rows(selection).map(row => {
+            const result = {};
+            for (const field of fields) {
+                result[field] = row[field];
+            }
+            return result;
+        });
+    }
+}
+
 // Enum: MessageId
 export const MessageId = {
     INVALID: 0,
@@ -19,13 +439,15 @@ Object.defineProperty(MessageId, "__descriptor", {
         get clrType() { return MessageId; },
         fullName: "pokeworld.world.cs.MessageId",
         package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
         values: [
             {name: "INVALID", originalName: "MESSAGE_ID_INVALID", number: 0},
             {name: "MOVE_REQUEST", originalName: "MESSAGE_ID_MOVE_REQUEST", number: 1001},
             {name: "EXIT_REQUEST", originalName: "MESSAGE_ID_EXIT_REQUEST", number: 1002},
             {name: "EXIT_RESPONSE", originalName: "MESSAGE_ID_EXIT_RESPONSE", number: 1003},
             {name: "ENTITY_SYNC_NOTIFY", originalName: "MESSAGE_ID_ENTITY_SYNC_NOTIFY", number: 1004}
-        ]
+        ],
+        valueIndex: new Map([[0, 0], [1001, 1], [1002, 2], [1003, 3], [1004, 4]])
     },
     enumerable: false,
     writable: false,
@@ -39,26 +461,52 @@ export class MoveRequest {
         get clrType() { return MoveRequest; },
         fullName: "pokeworld.world.cs.MoveRequest",
         package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1010,
+        messageId: 1001,
         fields: [
             {name: "movement", number: 1, type: "TYPE_ENUM", typeName: ".pokeworld.entity.comm.Direction", get clrType() { return __PokeworldEntityComm_entity.Direction; },label: "LABEL_OPTIONAL"},
             {name: "run", number: 2, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
         ]
     }
 
-    /** @type {__PokeworldEntityComm_entity.Direction} */
-    movement;
+    constructor() {
+        this.__movement = __PokeworldEntityComm_entity.Direction.UP;
+        this.__run = false;
+    }
+
+    __movement = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.Direction[keyof typeof __PokeworldEntityComm_entity.Direction]} */
+    get movement() {
+        return this.__movement;
+    }
+    set movement(value) {
+        this.__rawStale = true;
+        this.__movement = value;
+    }
 
     /** 
-     * @param {__PokeworldEntityComm_entity.Direction} value 
+     * @param {__PokeworldEntityComm_entity.Direction[keyof typeof __PokeworldEntityComm_entity.Direction]} value 
      * @return {MoveRequest} 
      */
     withMovement(value) {
         this.movement = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
         return this;
     }
 
+    __run = undefined;
+
     /** @type {boolean} */
-    run;
+    get run() {
+        return this.__run;
+    }
+    set run(value) {
+        this.__rawStale = true;
+        this.__run = value;
+    }
 
     /** 
      * @param {boolean} value 
@@ -66,177 +514,2281 @@ export class MoveRequest {
      */
     withRun(value) {
         this.run = value;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
         return this;
     }
 
-}
-
-// Message: ExitRequest
-export class ExitRequest {
-    static __descriptor = {
-        name: "ExitRequest",
-        get clrType() { return ExitRequest; },
-        fullName: "pokeworld.world.cs.ExitRequest",
-        package: "pokeworld.world.cs",
-        fields: []
-    }
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
 
-}
+    static __knownKeys = new Set(["movement", "run"]);
 
-// Message: ExitResponse
-export class ExitResponse {
-    static __descriptor = {
-        name: "ExitResponse",
-        get clrType() { return ExitResponse; },
-        fullName: "pokeworld.world.cs.ExitResponse",
-        package: "pokeworld.world.cs",
-        fields: [
-            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
     }
 
-    /** @type {boolean} */
-    success;
-
     /** 
-     * @param {boolean} value 
-     * @return {ExitResponse} 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
      */
-    withSuccess(value) {
-        this.success = value;
-        return this;
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
     }
 
-}
-
-// Message: PlayerSync
-export class PlayerSync {
-    static __descriptor = {
-        name: "PlayerSync",
-        get clrType() { return PlayerSync; },
-        fullName: "pokeworld.world.cs.PlayerSync",
-        package: "pokeworld.world.cs",
-        fields: [
-            {name: "entityInfo", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityInfo", get clrType() { return __PokeworldEntityComm_entity.EntityInfo; },label: "LABEL_OPTIONAL"},
-            {name: "entityTransform", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityTransform", get clrType() { return __PokeworldEntityComm_entity.EntityTransform; },label: "LABEL_OPTIONAL"},
-            {name: "actorTransform", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorTransform", get clrType() { return __PokeworldEntityComm_entity.ActorTransform; },label: "LABEL_OPTIONAL"},
-            {name: "actorState", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorState", get clrType() { return __PokeworldEntityComm_entity.ActorState; },label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * @return {MoveRequest} a deep copy of this message
+     */
+    clone() {
+        return new MoveRequest().copyFrom(this);
     }
 
-    /** @type {__PokeworldEntityComm_entity.EntityInfo} */
-    entityInfo;
-
     /** 
-     * @param {__PokeworldEntityComm_entity.EntityInfo} value 
-     * @return {PlayerSync} 
+     * Deep copy all fields from another message of the same type
+     * @param {MoveRequest} other 
+     * @return {MoveRequest} 
      */
-    withEntityInfo(value) {
-        this.entityInfo = value;
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.movement = other.movement;
+        this.run = other.run;
         return this;
     }
 
-    /** @type {__PokeworldEntityComm_entity.EntityTransform} */
-    entityTransform;
-
     /** 
-     * @param {__PokeworldEntityComm_entity.EntityTransform} value 
-     * @return {PlayerSync} 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {MoveRequest} other 
+     * @return {boolean} 
      */
-    withEntityTransform(value) {
-        this.entityTransform = value;
-        return this;
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof MoveRequest)) return false;
+        if ((this.movement ?? __PokeworldEntityComm_entity.Direction.UP) !== (other.movement ?? __PokeworldEntityComm_entity.Direction.UP)) return false;
+        if ((this.run ?? false) !== (other.run ?? false)) return false;
+        return true;
     }
 
-    /** @type {__PokeworldEntityComm_entity.ActorTransform} */
-    actorTransform;
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.movement ?? __PokeworldEntityComm_entity.Direction.UP);
+        hash = __hashBool(hash, this.run ?? false);
+        return hash;
+    }
 
     /** 
-     * @param {__PokeworldEntityComm_entity.ActorTransform} value 
-     * @return {PlayerSync} 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {MoveRequest} 
      */
-    withActorTransform(value) {
-        this.actorTransform = value;
+    clear() {
+        this.movement = __PokeworldEntityComm_entity.Direction.UP;
+        this.run = false;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
-    /** @type {__PokeworldEntityComm_entity.ActorState} */
-    actorState;
+    static __pool = [];
+
+    __released = false;
 
     /** 
-     * @param {__PokeworldEntityComm_entity.ActorState} value 
-     * @return {PlayerSync} 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {MoveRequest} 
      */
-    withActorState(value) {
-        this.actorState = value;
-        return this;
+    static acquire() {
+        const message = MoveRequest.__pool.pop();
+        if (message === undefined) return new MoveRequest();
+        message.__released = false;
+        return message;
     }
 
-}
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {MoveRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('MoveRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (MoveRequest.__pool.length < 64) {
+            MoveRequest.__pool.push(message);
+        }
+    }
 
-// Message: NpcSync
-export class NpcSync {
-    static __descriptor = {
-        name: "NpcSync",
-        get clrType() { return NpcSync; },
-        fullName: "pokeworld.world.cs.NpcSync",
-        package: "pokeworld.world.cs",
-        fields: [
-            {name: "entityInfo", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityInfo", get clrType() { return __PokeworldEntityComm_entity.EntityInfo; },label: "LABEL_OPTIONAL"},
-            {name: "entityTransform", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityTransform", get clrType() { return __PokeworldEntityComm_entity.EntityTransform; },label: "LABEL_OPTIONAL"},
-            {name: "actorTransform", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorTransform", get clrType() { return __PokeworldEntityComm_entity.ActorTransform; },label: "LABEL_OPTIONAL"},
-            {name: "actorState", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorState", get clrType() { return __PokeworldEntityComm_entity.ActorState; },label: "LABEL_OPTIONAL"}
-        ]
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
     }
 
-    /** @type {__PokeworldEntityComm_entity.EntityInfo} */
-    entityInfo;
+    // Dirty field bitmask
+    __dirty0 = 0;
 
     /** 
-     * @param {__PokeworldEntityComm_entity.EntityInfo} value 
-     * @return {NpcSync} 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
      */
-    withEntityInfo(value) {
-        this.entityInfo = value;
-        return this;
+    __markCommitted() {
+        this.__dirty0 = 0;
     }
 
-    /** @type {__PokeworldEntityComm_entity.EntityTransform} */
-    entityTransform;
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).movement = this.movement; break;
+                case 2: (full ??= {}).run = this.run; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
 
     /** 
-     * @param {__PokeworldEntityComm_entity.EntityTransform} value 
-     * @return {NpcSync} 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {MoveRequest} 
      */
-    withEntityTransform(value) {
-        this.entityTransform = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.movement) !== undefined) {
+                this.movement = value;
+            }
+            if ((value = full.run) !== undefined) {
+                this.run = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
         return this;
     }
 
-    /** @type {__PokeworldEntityComm_entity.ActorTransform} */
-    actorTransform;
-
     /** 
-     * @param {__PokeworldEntityComm_entity.ActorTransform} value 
-     * @return {NpcSync} 
+     * Mark the current state as synchronized
+     * @return {MoveRequest} 
      */
-    withActorTransform(value) {
-        this.actorTransform = value;
+    commit() {
+        this.__dirty0 = 0;
         return this;
     }
 
-    /** @type {__PokeworldEntityComm_entity.ActorState} */
-    actorState;
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            movement: this.movement,
+            run: this.run,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, MoveRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.movement;
+        if (value != null && !__isEnum(__PokeworldEntityComm_entity.Direction, value)) return __invalid("movement", "enum Direction");
+        value = json.run;
+        if (value != null && !__isBool(value)) return __invalid("run", "bool");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {MoveRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = MoveRequest.acquire();
+        try {
+            let value;
+            value = json.movement;
+            if (value != null) {
+                if (!__isEnum(__PokeworldEntityComm_entity.Direction, value)) throw __invalid("movement", "enum Direction");
+                message.movement = value;
+            }
+            value = json.run;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("run", "bool");
+                message.run = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            MoveRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class MoveRequestView {
+        static __layout = {
+            size: 8,
+            hash: 0xaa1b3c97,
+            presence: 0,
+            fields: [
+                {name: "movement", type: "TYPE_ENUM", offset: 0},
+                {name: "run", type: "TYPE_BOOL", offset: 4}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, MoveRequestView.__layout.hash);
+            return new MoveRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get movement() {
+            return __flatInt32(this.__view, this.__offset + 0);
+        }
+
+        get run() {
+            return __flatBool(this.__view, this.__offset + 4);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class MoveRequestColumns extends __ColumnTable {
+        static Row = class MoveRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get movement() {
+                return this.__table.columns.movement[this.__index];
+            }
+
+            get run() {
+                return this.__table.columns.run[this.__index] !== 0;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                movement: new Int32Array(length),
+                run: new Uint8Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new MoveRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.movement[i] = row.movement ?? __PokeworldEntityComm_entity.Direction.UP;
+                columns.run[i] = row.run ? 1 : 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: ExitRequest
+export class ExitRequest {
+    static __descriptor = {
+        name: "ExitRequest",
+        get clrType() { return ExitRequest; },
+        fullName: "pokeworld.world.cs.ExitRequest",
+        package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1010,
+        messageId: 1002,
+        fields: []
+    }
+
+    constructor() {
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set([]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {ExitRequest} a deep copy of this message
+     */
+    clone() {
+        return new ExitRequest().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {ExitRequest} other 
+     * @return {ExitRequest} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {ExitRequest} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof ExitRequest)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {ExitRequest} 
+     */
+    clear() {
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {ExitRequest} 
+     */
+    static acquire() {
+        const message = ExitRequest.__pool.pop();
+        if (message === undefined) return new ExitRequest();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {ExitRequest} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('ExitRequest instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (ExitRequest.__pool.length < 64) {
+            ExitRequest.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {ExitRequest} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {ExitRequest} 
+     */
+    commit() {
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, ExitRequest.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {ExitRequest}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = ExitRequest.acquire();
+        try {
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            ExitRequest.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ExitRequestView {
+        static __layout = {
+            size: 0,
+            hash: 0x979030b8,
+            presence: 0,
+            fields: []
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ExitRequestView.__layout.hash);
+            return new ExitRequestView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ExitRequestColumns extends __ColumnTable {
+        static Row = class ExitRequestRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ExitRequestColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: ExitResponse
+export class ExitResponse {
+    static __descriptor = {
+        name: "ExitResponse",
+        get clrType() { return ExitResponse; },
+        fullName: "pokeworld.world.cs.ExitResponse",
+        package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1010,
+        messageId: 1003,
+        fields: [
+            {name: "success", number: 1, type: "TYPE_BOOL", label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+        this.__success = false;
+    }
+
+    __success = undefined;
+
+    /** @type {boolean} */
+    get success() {
+        return this.__success;
+    }
+    set success(value) {
+        this.__rawStale = true;
+        this.__success = value;
+    }
+
+    /** 
+     * @param {boolean} value 
+     * @return {ExitResponse} 
+     */
+    withSuccess(value) {
+        this.success = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["success"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        return true;
+    }
+
+    /** 
+     * @return {ExitResponse} a deep copy of this message
+     */
+    clone() {
+        return new ExitResponse().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {ExitResponse} other 
+     * @return {ExitResponse} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.success = other.success;
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {ExitResponse} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof ExitResponse)) return false;
+        if ((this.success ?? false) !== (other.success ?? false)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashBool(hash, this.success ?? false);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {ExitResponse} 
+     */
+    clear() {
+        this.success = false;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {ExitResponse} 
+     */
+    static acquire() {
+        const message = ExitResponse.__pool.pop();
+        if (message === undefined) return new ExitResponse();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {ExitResponse} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('ExitResponse instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (ExitResponse.__pool.length < 64) {
+            ExitResponse.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).success = this.success; break;
+            }
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {ExitResponse} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.success) !== undefined) {
+                this.success = value;
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {ExitResponse} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            success: this.success,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, ExitResponse.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.success;
+        if (value != null && !__isBool(value)) return __invalid("success", "bool");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {ExitResponse}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = ExitResponse.acquire();
+        try {
+            let value;
+            value = json.success;
+            if (value != null) {
+                if (!__isBool(value)) throw __invalid("success", "bool");
+                message.success = value;
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            ExitResponse.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class ExitResponseView {
+        static __layout = {
+            size: 8,
+            hash: 0xa6745bd7,
+            presence: 0,
+            fields: [
+                {name: "success", type: "TYPE_BOOL", offset: 0}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, ExitResponseView.__layout.hash);
+            return new ExitResponseView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get success() {
+            return __flatBool(this.__view, this.__offset + 0);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class ExitResponseColumns extends __ColumnTable {
+        static Row = class ExitResponseRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get success() {
+                return this.__table.columns.success[this.__index] !== 0;
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                success: new Uint8Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new ExitResponseColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.success[i] = row.success ? 1 : 0;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: PlayerSync
+export class PlayerSync {
+    static __descriptor = {
+        name: "PlayerSync",
+        get clrType() { return PlayerSync; },
+        fullName: "pokeworld.world.cs.PlayerSync",
+        package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "entityInfo", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityInfo", get clrType() { return __PokeworldEntityComm_entity.EntityInfo; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "entityTransform", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityTransform", get clrType() { return __PokeworldEntityComm_entity.EntityTransform; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "actorTransform", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorTransform", get clrType() { return __PokeworldEntityComm_entity.ActorTransform; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "actorState", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorState", get clrType() { return __PokeworldEntityComm_entity.ActorState; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __entityInfo = undefined;
+    __entityInfoRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.EntityInfo|undefined} */
+    get entityInfo() {
+        if (this.__entityInfoRaw !== undefined) {
+            this.__entityInfo = this.__decode(PlayerSync.__descriptor.fields[0], this.__entityInfoRaw, this.__entityInfo);
+            this.__entityInfoRaw = undefined;
+        }
+        return this.__entityInfo;
+    }
+    set entityInfo(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__entityInfoRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__entityInfo = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__entityInfo = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasEntityInfo() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {PlayerSync} 
+     */
+    clearEntityInfo() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__entityInfo = undefined;
+        this.__entityInfoRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.EntityInfo} value 
+     * @return {PlayerSync} 
+     */
+    withEntityInfo(value) {
+        this.entityInfo = value;
+        return this;
+    }
+
+    __entityTransform = undefined;
+    __entityTransformRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.EntityTransform|undefined} */
+    get entityTransform() {
+        if (this.__entityTransformRaw !== undefined) {
+            this.__entityTransform = this.__decode(PlayerSync.__descriptor.fields[1], this.__entityTransformRaw, this.__entityTransform);
+            this.__entityTransformRaw = undefined;
+        }
+        return this.__entityTransform;
+    }
+    set entityTransform(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__entityTransformRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__entityTransform = undefined;
+            this.__has0 &= ~2;
+        } else {
+            this.__entityTransform = value;
+            this.__has0 |= 2;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasEntityTransform() {
+        return (this.__has0 & 2) !== 0;
+    }
+
+    /** 
+     * @return {PlayerSync} 
+     */
+    clearEntityTransform() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__entityTransform = undefined;
+        this.__entityTransformRaw = undefined;
+        this.__has0 &= ~2;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.EntityTransform} value 
+     * @return {PlayerSync} 
+     */
+    withEntityTransform(value) {
+        this.entityTransform = value;
+        return this;
+    }
+
+    __actorTransform = undefined;
+    __actorTransformRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.ActorTransform|undefined} */
+    get actorTransform() {
+        if (this.__actorTransformRaw !== undefined) {
+            this.__actorTransform = this.__decode(PlayerSync.__descriptor.fields[2], this.__actorTransformRaw, this.__actorTransform);
+            this.__actorTransformRaw = undefined;
+        }
+        return this.__actorTransform;
+    }
+    set actorTransform(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__actorTransformRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorTransform = undefined;
+            this.__has0 &= ~4;
+        } else {
+            this.__actorTransform = value;
+            this.__has0 |= 4;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorTransform() {
+        return (this.__has0 & 4) !== 0;
+    }
+
+    /** 
+     * @return {PlayerSync} 
+     */
+    clearActorTransform() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__actorTransform = undefined;
+        this.__actorTransformRaw = undefined;
+        this.__has0 &= ~4;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.ActorTransform} value 
+     * @return {PlayerSync} 
+     */
+    withActorTransform(value) {
+        this.actorTransform = value;
+        return this;
+    }
+
+    __actorState = undefined;
+    __actorStateRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.ActorState|undefined} */
+    get actorState() {
+        if (this.__actorStateRaw !== undefined) {
+            this.__actorState = this.__decode(PlayerSync.__descriptor.fields[3], this.__actorStateRaw, this.__actorState);
+            this.__actorStateRaw = undefined;
+        }
+        return this.__actorState;
+    }
+    set actorState(value) {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__actorStateRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorState = undefined;
+            this.__has0 &= ~8;
+        } else {
+            this.__actorState = value;
+            this.__has0 |= 8;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorState() {
+        return (this.__has0 & 8) !== 0;
+    }
+
+    /** 
+     * @return {PlayerSync} 
+     */
+    clearActorState() {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__actorState = undefined;
+        this.__actorStateRaw = undefined;
+        this.__has0 &= ~8;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.ActorState} value 
+     * @return {PlayerSync} 
+     */
+    withActorState(value) {
+        this.actorState = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dirty0 |= 1;
+                this.__entityInfo = undefined;
+                this.__entityInfoRaw = raw;
+                this.__has0 |= 1;
+                break;
+            case 2:
+                this.__dirty0 |= 2;
+                this.__entityTransform = undefined;
+                this.__entityTransformRaw = raw;
+                this.__has0 |= 2;
+                break;
+            case 3:
+                this.__dirty0 |= 4;
+                this.__actorTransform = undefined;
+                this.__actorTransformRaw = raw;
+                this.__has0 |= 4;
+                break;
+            case 4:
+                this.__dirty0 |= 8;
+                this.__actorState = undefined;
+                this.__actorStateRaw = raw;
+                this.__has0 |= 8;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["entityInfo", "entityTransform", "actorTransform", "actorState"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__entityInfo) != null && !value.__isPristine()) return false;
+        if ((value = this.__entityTransform) != null && !value.__isPristine()) return false;
+        if ((value = this.__actorTransform) != null && !value.__isPristine()) return false;
+        if ((value = this.__actorState) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {PlayerSync} a deep copy of this message
+     */
+    clone() {
+        return new PlayerSync().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {PlayerSync} other 
+     * @return {PlayerSync} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.entityInfo = __cloneMessage(other.entityInfo);
+        this.entityTransform = __cloneMessage(other.entityTransform);
+        this.actorTransform = __cloneMessage(other.actorTransform);
+        this.actorState = __cloneMessage(other.actorState);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {PlayerSync} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof PlayerSync)) return false;
+        if (!__equalsMessage(this.entityInfo, other.entityInfo)) return false;
+        if (!__equalsMessage(this.entityTransform, other.entityTransform)) return false;
+        if (!__equalsMessage(this.actorTransform, other.actorTransform)) return false;
+        if (!__equalsMessage(this.actorState, other.actorState)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashMessage(hash, this.entityInfo);
+        hash = __hashMessage(hash, this.entityTransform);
+        hash = __hashMessage(hash, this.actorTransform);
+        hash = __hashMessage(hash, this.actorState);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {PlayerSync} 
+     */
+    clear() {
+        this.__entityInfo = undefined;
+        this.__entityInfoRaw = undefined;
+        this.__entityTransform = undefined;
+        this.__entityTransformRaw = undefined;
+        this.__actorTransform = undefined;
+        this.__actorTransformRaw = undefined;
+        this.__actorState = undefined;
+        this.__actorStateRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {PlayerSync} 
+     */
+    static acquire() {
+        const message = PlayerSync.__pool.pop();
+        if (message === undefined) return new PlayerSync();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {PlayerSync} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('PlayerSync instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (PlayerSync.__pool.length < 64) {
+            PlayerSync.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__entityInfo) instanceof __PokeworldEntityComm_entity.EntityInfo) __PokeworldEntityComm_entity.EntityInfo.release(value);
+        if ((value = this.__entityTransform) instanceof __PokeworldEntityComm_entity.EntityTransform) __PokeworldEntityComm_entity.EntityTransform.release(value);
+        if ((value = this.__actorTransform) instanceof __PokeworldEntityComm_entity.ActorTransform) __PokeworldEntityComm_entity.ActorTransform.release(value);
+        if ((value = this.__actorState) instanceof __PokeworldEntityComm_entity.ActorState) __PokeworldEntityComm_entity.ActorState.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).entityInfo = this.entityInfo ?? null; break;
+                case 2: (full ??= {}).entityTransform = this.entityTransform ?? null; break;
+                case 4: (full ??= {}).actorTransform = this.actorTransform ?? null; break;
+                case 8: (full ??= {}).actorState = this.actorState ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.entityInfo) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).entityInfo = value;
+        if ((this.__dirty0 & 2) === 0 && (value = this.entityTransform) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).entityTransform = value;
+        if ((this.__dirty0 & 4) === 0 && (value = this.actorTransform) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorTransform = value;
+        if ((this.__dirty0 & 8) === 0 && (value = this.actorState) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorState = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {PlayerSync} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.entityInfo) !== undefined) {
+                this.entityInfo = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.EntityInfo ? value.clone().commit() : new __PokeworldEntityComm_entity.EntityInfo().applyDelta({ f: value }));
+            }
+            if ((value = full.entityTransform) !== undefined) {
+                this.entityTransform = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.EntityTransform ? value.clone().commit() : new __PokeworldEntityComm_entity.EntityTransform().applyDelta({ f: value }));
+            }
+            if ((value = full.actorTransform) !== undefined) {
+                this.actorTransform = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.ActorTransform ? value.clone().commit() : new __PokeworldEntityComm_entity.ActorTransform().applyDelta({ f: value }));
+            }
+            if ((value = full.actorState) !== undefined) {
+                this.actorState = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.ActorState ? value.clone().commit() : new __PokeworldEntityComm_entity.ActorState().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.entityInfo) !== undefined) {
+                (this.entityInfo ?? (this.entityInfo = new __PokeworldEntityComm_entity.EntityInfo())).applyDelta(value);
+            }
+            if ((value = nested.entityTransform) !== undefined) {
+                (this.entityTransform ?? (this.entityTransform = new __PokeworldEntityComm_entity.EntityTransform())).applyDelta(value);
+            }
+            if ((value = nested.actorTransform) !== undefined) {
+                (this.actorTransform ?? (this.actorTransform = new __PokeworldEntityComm_entity.ActorTransform())).applyDelta(value);
+            }
+            if ((value = nested.actorState) !== undefined) {
+                (this.actorState ?? (this.actorState = new __PokeworldEntityComm_entity.ActorState())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {PlayerSync} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.entityInfo)) value.commit();
+        if ((value = this.entityTransform)) value.commit();
+        if ((value = this.actorTransform)) value.commit();
+        if ((value = this.actorState)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.entityInfo = this.__entityInfoRaw ?? this.__entityInfo; break;
+                case 2: json.entityTransform = this.__entityTransformRaw ?? this.__entityTransform; break;
+                case 4: json.actorTransform = this.__actorTransformRaw ?? this.__actorTransform; break;
+                case 8: json.actorState = this.__actorStateRaw ?? this.__actorState; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, PlayerSync.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.entityInfo;
+        if (value != null && (error = __PokeworldEntityComm_entity.EntityInfo.validate(value)) !== null) return __prefixError(error, "entityInfo");
+        value = json.entityTransform;
+        if (value != null && (error = __PokeworldEntityComm_entity.EntityTransform.validate(value)) !== null) return __prefixError(error, "entityTransform");
+        value = json.actorTransform;
+        if (value != null && (error = __PokeworldEntityComm_entity.ActorTransform.validate(value)) !== null) return __prefixError(error, "actorTransform");
+        value = json.actorState;
+        if (value != null && (error = __PokeworldEntityComm_entity.ActorState.validate(value)) !== null) return __prefixError(error, "actorState");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {PlayerSync}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = PlayerSync.acquire();
+        try {
+            let value;
+            value = json.entityInfo;
+            if (value != null) {
+                message.entityInfo = __decodeNested(__PokeworldEntityComm_entity.EntityInfo, value, "entityInfo");
+            }
+            value = json.entityTransform;
+            if (value != null) {
+                message.entityTransform = __decodeNested(__PokeworldEntityComm_entity.EntityTransform, value, "entityTransform");
+            }
+            value = json.actorTransform;
+            if (value != null) {
+                message.actorTransform = __decodeNested(__PokeworldEntityComm_entity.ActorTransform, value, "actorTransform");
+            }
+            value = json.actorState;
+            if (value != null) {
+                message.actorState = __decodeNested(__PokeworldEntityComm_entity.ActorState, value, "actorState");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            PlayerSync.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class PlayerSyncView {
+        static __layout = {
+            size: 16,
+            hash: 0x1af7fa41,
+            presence: 0,
+            fields: [
+                {name: "entityInfo", type: "TYPE_MESSAGE", offset: 0, get view() { return __PokeworldEntityComm_entity.EntityInfo.View; }},
+                {name: "entityTransform", type: "TYPE_MESSAGE", offset: 4, get view() { return __PokeworldEntityComm_entity.EntityTransform.View; }},
+                {name: "actorTransform", type: "TYPE_MESSAGE", offset: 8, get view() { return __PokeworldEntityComm_entity.ActorTransform.View; }},
+                {name: "actorState", type: "TYPE_MESSAGE", offset: 12, get view() { return __PokeworldEntityComm_entity.ActorState.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, PlayerSyncView.__layout.hash);
+            return new PlayerSyncView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get entityInfo() {
+            return __flatMessage(this.__view, this.__offset + 0, __PokeworldEntityComm_entity.EntityInfo.View);
+        }
+
+        hasEntityInfo() {
+            return this.entityInfo !== undefined;
+        }
+
+        get entityTransform() {
+            return __flatMessage(this.__view, this.__offset + 4, __PokeworldEntityComm_entity.EntityTransform.View);
+        }
+
+        hasEntityTransform() {
+            return this.entityTransform !== undefined;
+        }
+
+        get actorTransform() {
+            return __flatMessage(this.__view, this.__offset + 8, __PokeworldEntityComm_entity.ActorTransform.View);
+        }
+
+        hasActorTransform() {
+            return this.actorTransform !== undefined;
+        }
+
+        get actorState() {
+            return __flatMessage(this.__view, this.__offset + 12, __PokeworldEntityComm_entity.ActorState.View);
+        }
+
+        hasActorState() {
+            return this.actorState !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class PlayerSyncColumns extends __ColumnTable {
+        static Row = class PlayerSyncRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get entityInfo() {
+                return this.__table.columns.entityInfo[this.__index];
+            }
+
+            get entityTransform() {
+                return this.__table.columns.entityTransform[this.__index];
+            }
+
+            get actorTransform() {
+                return this.__table.columns.actorTransform[this.__index];
+            }
+
+            get actorState() {
+                return this.__table.columns.actorState[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                entityInfo: new Array(length),
+                entityTransform: new Array(length),
+                actorTransform: new Array(length),
+                actorState: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new PlayerSyncColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.entityInfo[i] = row.entityInfo;
+                columns.entityTransform[i] = row.entityTransform;
+                columns.actorTransform[i] = row.actorTransform;
+                columns.actorState[i] = row.actorState;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Message: NpcSync
+export class NpcSync {
+    static __descriptor = {
+        name: "NpcSync",
+        get clrType() { return NpcSync; },
+        fullName: "pokeworld.world.cs.NpcSync",
+        package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
+        fields: [
+            {name: "entityInfo", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityInfo", get clrType() { return __PokeworldEntityComm_entity.EntityInfo; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "entityTransform", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.EntityTransform", get clrType() { return __PokeworldEntityComm_entity.EntityTransform; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "actorTransform", number: 3, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorTransform", get clrType() { return __PokeworldEntityComm_entity.ActorTransform; },lazy: true, label: "LABEL_OPTIONAL"},
+            {name: "actorState", number: 4, type: "TYPE_MESSAGE", typeName: ".pokeworld.entity.comm.ActorState", get clrType() { return __PokeworldEntityComm_entity.ActorState; },lazy: true, label: "LABEL_OPTIONAL"}
+        ]
+    }
+
+    constructor() {
+    }
+
+    // Presence bitmask
+    __has0 = 0;
+
+    __entityInfo = undefined;
+    __entityInfoRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.EntityInfo|undefined} */
+    get entityInfo() {
+        if (this.__entityInfoRaw !== undefined) {
+            this.__entityInfo = this.__decode(NpcSync.__descriptor.fields[0], this.__entityInfoRaw, this.__entityInfo);
+            this.__entityInfoRaw = undefined;
+        }
+        return this.__entityInfo;
+    }
+    set entityInfo(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__entityInfoRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__entityInfo = undefined;
+            this.__has0 &= ~1;
+        } else {
+            this.__entityInfo = value;
+            this.__has0 |= 1;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasEntityInfo() {
+        return (this.__has0 & 1) !== 0;
+    }
+
+    /** 
+     * @return {NpcSync} 
+     */
+    clearEntityInfo() {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        this.__entityInfo = undefined;
+        this.__entityInfoRaw = undefined;
+        this.__has0 &= ~1;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.EntityInfo} value 
+     * @return {NpcSync} 
+     */
+    withEntityInfo(value) {
+        this.entityInfo = value;
+        return this;
+    }
+
+    __entityTransform = undefined;
+    __entityTransformRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.EntityTransform|undefined} */
+    get entityTransform() {
+        if (this.__entityTransformRaw !== undefined) {
+            this.__entityTransform = this.__decode(NpcSync.__descriptor.fields[1], this.__entityTransformRaw, this.__entityTransform);
+            this.__entityTransformRaw = undefined;
+        }
+        return this.__entityTransform;
+    }
+    set entityTransform(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__entityTransformRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__entityTransform = undefined;
+            this.__has0 &= ~2;
+        } else {
+            this.__entityTransform = value;
+            this.__has0 |= 2;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasEntityTransform() {
+        return (this.__has0 & 2) !== 0;
+    }
+
+    /** 
+     * @return {NpcSync} 
+     */
+    clearEntityTransform() {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__entityTransform = undefined;
+        this.__entityTransformRaw = undefined;
+        this.__has0 &= ~2;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.EntityTransform} value 
+     * @return {NpcSync} 
+     */
+    withEntityTransform(value) {
+        this.entityTransform = value;
+        return this;
+    }
+
+    __actorTransform = undefined;
+    __actorTransformRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.ActorTransform|undefined} */
+    get actorTransform() {
+        if (this.__actorTransformRaw !== undefined) {
+            this.__actorTransform = this.__decode(NpcSync.__descriptor.fields[2], this.__actorTransformRaw, this.__actorTransform);
+            this.__actorTransformRaw = undefined;
+        }
+        return this.__actorTransform;
+    }
+    set actorTransform(value) {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__actorTransformRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorTransform = undefined;
+            this.__has0 &= ~4;
+        } else {
+            this.__actorTransform = value;
+            this.__has0 |= 4;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorTransform() {
+        return (this.__has0 & 4) !== 0;
+    }
+
+    /** 
+     * @return {NpcSync} 
+     */
+    clearActorTransform() {
+        this.__dirty0 |= 4;
+        this.__rawStale = true;
+        this.__actorTransform = undefined;
+        this.__actorTransformRaw = undefined;
+        this.__has0 &= ~4;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.ActorTransform} value 
+     * @return {NpcSync} 
+     */
+    withActorTransform(value) {
+        this.actorTransform = value;
+        return this;
+    }
+
+    __actorState = undefined;
+    __actorStateRaw = undefined;
+
+    /** @type {__PokeworldEntityComm_entity.ActorState|undefined} */
+    get actorState() {
+        if (this.__actorStateRaw !== undefined) {
+            this.__actorState = this.__decode(NpcSync.__descriptor.fields[3], this.__actorStateRaw, this.__actorState);
+            this.__actorStateRaw = undefined;
+        }
+        return this.__actorState;
+    }
+    set actorState(value) {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__actorStateRaw = undefined;
+        if (value === undefined || value === null) {
+            this.__actorState = undefined;
+            this.__has0 &= ~8;
+        } else {
+            this.__actorState = value;
+            this.__has0 |= 8;
+        }
+    }
+
+    /** 
+     * @return {boolean} 
+     */
+    hasActorState() {
+        return (this.__has0 & 8) !== 0;
+    }
+
+    /** 
+     * @return {NpcSync} 
+     */
+    clearActorState() {
+        this.__dirty0 |= 8;
+        this.__rawStale = true;
+        this.__actorState = undefined;
+        this.__actorStateRaw = undefined;
+        this.__has0 &= ~8;
+        return this;
+    }
+
+    /** 
+     * @param {__PokeworldEntityComm_entity.ActorState} value 
+     * @return {NpcSync} 
+     */
+    withActorState(value) {
+        this.actorState = value;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__dirty0 |= 1;
+                this.__entityInfo = undefined;
+                this.__entityInfoRaw = raw;
+                this.__has0 |= 1;
+                break;
+            case 2:
+                this.__dirty0 |= 2;
+                this.__entityTransform = undefined;
+                this.__entityTransformRaw = raw;
+                this.__has0 |= 2;
+                break;
+            case 3:
+                this.__dirty0 |= 4;
+                this.__actorTransform = undefined;
+                this.__actorTransformRaw = raw;
+                this.__has0 |= 4;
+                break;
+            case 4:
+                this.__dirty0 |= 8;
+                this.__actorState = undefined;
+                this.__actorStateRaw = raw;
+                this.__has0 |= 8;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["entityInfo", "entityTransform", "actorTransform", "actorState"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__entityInfo) != null && !value.__isPristine()) return false;
+        if ((value = this.__entityTransform) != null && !value.__isPristine()) return false;
+        if ((value = this.__actorTransform) != null && !value.__isPristine()) return false;
+        if ((value = this.__actorState) != null && !value.__isPristine()) return false;
+        return true;
+    }
+
+    /** 
+     * @return {NpcSync} a deep copy of this message
+     */
+    clone() {
+        return new NpcSync().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {NpcSync} other 
+     * @return {NpcSync} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.entityInfo = __cloneMessage(other.entityInfo);
+        this.entityTransform = __cloneMessage(other.entityTransform);
+        this.actorTransform = __cloneMessage(other.actorTransform);
+        this.actorState = __cloneMessage(other.actorState);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {NpcSync} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof NpcSync)) return false;
+        if (!__equalsMessage(this.entityInfo, other.entityInfo)) return false;
+        if (!__equalsMessage(this.entityTransform, other.entityTransform)) return false;
+        if (!__equalsMessage(this.actorTransform, other.actorTransform)) return false;
+        if (!__equalsMessage(this.actorState, other.actorState)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashMessage(hash, this.entityInfo);
+        hash = __hashMessage(hash, this.entityTransform);
+        hash = __hashMessage(hash, this.actorTransform);
+        hash = __hashMessage(hash, this.actorState);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {NpcSync} 
+     */
+    clear() {
+        this.__entityInfo = undefined;
+        this.__entityInfoRaw = undefined;
+        this.__entityTransform = undefined;
+        this.__entityTransformRaw = undefined;
+        this.__actorTransform = undefined;
+        this.__actorTransformRaw = undefined;
+        this.__actorState = undefined;
+        this.__actorStateRaw = undefined;
+        this.__has0 = 0;
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {NpcSync} 
+     */
+    static acquire() {
+        const message = NpcSync.__pool.pop();
+        if (message === undefined) return new NpcSync();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {NpcSync} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('NpcSync instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (NpcSync.__pool.length < 64) {
+            NpcSync.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        let value;
+        if ((value = this.__entityInfo) instanceof __PokeworldEntityComm_entity.EntityInfo) __PokeworldEntityComm_entity.EntityInfo.release(value);
+        if ((value = this.__entityTransform) instanceof __PokeworldEntityComm_entity.EntityTransform) __PokeworldEntityComm_entity.EntityTransform.release(value);
+        if ((value = this.__actorTransform) instanceof __PokeworldEntityComm_entity.ActorTransform) __PokeworldEntityComm_entity.ActorTransform.release(value);
+        if ((value = this.__actorState) instanceof __PokeworldEntityComm_entity.ActorState) __PokeworldEntityComm_entity.ActorState.release(value);
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
 
     /** 
-     * @param {__PokeworldEntityComm_entity.ActorState} value 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).entityInfo = this.entityInfo ?? null; break;
+                case 2: (full ??= {}).entityTransform = this.entityTransform ?? null; break;
+                case 4: (full ??= {}).actorTransform = this.actorTransform ?? null; break;
+                case 8: (full ??= {}).actorState = this.actorState ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.entityInfo) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).entityInfo = value;
+        if ((this.__dirty0 & 2) === 0 && (value = this.entityTransform) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).entityTransform = value;
+        if ((this.__dirty0 & 4) === 0 && (value = this.actorTransform) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorTransform = value;
+        if ((this.__dirty0 & 8) === 0 && (value = this.actorState) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).actorState = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
      * @return {NpcSync} 
      */
-    withActorState(value) {
-        this.actorState = value;
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.entityInfo) !== undefined) {
+                this.entityInfo = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.EntityInfo ? value.clone().commit() : new __PokeworldEntityComm_entity.EntityInfo().applyDelta({ f: value }));
+            }
+            if ((value = full.entityTransform) !== undefined) {
+                this.entityTransform = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.EntityTransform ? value.clone().commit() : new __PokeworldEntityComm_entity.EntityTransform().applyDelta({ f: value }));
+            }
+            if ((value = full.actorTransform) !== undefined) {
+                this.actorTransform = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.ActorTransform ? value.clone().commit() : new __PokeworldEntityComm_entity.ActorTransform().applyDelta({ f: value }));
+            }
+            if ((value = full.actorState) !== undefined) {
+                this.actorState = value === null ? undefined : (value instanceof __PokeworldEntityComm_entity.ActorState ? value.clone().commit() : new __PokeworldEntityComm_entity.ActorState().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.entityInfo) !== undefined) {
+                (this.entityInfo ?? (this.entityInfo = new __PokeworldEntityComm_entity.EntityInfo())).applyDelta(value);
+            }
+            if ((value = nested.entityTransform) !== undefined) {
+                (this.entityTransform ?? (this.entityTransform = new __PokeworldEntityComm_entity.EntityTransform())).applyDelta(value);
+            }
+            if ((value = nested.actorTransform) !== undefined) {
+                (this.actorTransform ?? (this.actorTransform = new __PokeworldEntityComm_entity.ActorTransform())).applyDelta(value);
+            }
+            if ((value = nested.actorState) !== undefined) {
+                (this.actorState ?? (this.actorState = new __PokeworldEntityComm_entity.ActorState())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {NpcSync} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.entityInfo)) value.commit();
+        if ((value = this.entityTransform)) value.commit();
+        if ((value = this.actorTransform)) value.commit();
+        if ((value = this.actorState)) value.commit();
         return this;
     }
 
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        for (let bits = this.__has0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: json.entityInfo = this.__entityInfoRaw ?? this.__entityInfo; break;
+                case 2: json.entityTransform = this.__entityTransformRaw ?? this.__entityTransform; break;
+                case 4: json.actorTransform = this.__actorTransformRaw ?? this.__actorTransform; break;
+                case 8: json.actorState = this.__actorStateRaw ?? this.__actorState; break;
+            }
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, NpcSync.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.entityInfo;
+        if (value != null && (error = __PokeworldEntityComm_entity.EntityInfo.validate(value)) !== null) return __prefixError(error, "entityInfo");
+        value = json.entityTransform;
+        if (value != null && (error = __PokeworldEntityComm_entity.EntityTransform.validate(value)) !== null) return __prefixError(error, "entityTransform");
+        value = json.actorTransform;
+        if (value != null && (error = __PokeworldEntityComm_entity.ActorTransform.validate(value)) !== null) return __prefixError(error, "actorTransform");
+        value = json.actorState;
+        if (value != null && (error = __PokeworldEntityComm_entity.ActorState.validate(value)) !== null) return __prefixError(error, "actorState");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {NpcSync}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = NpcSync.acquire();
+        try {
+            let value;
+            value = json.entityInfo;
+            if (value != null) {
+                message.entityInfo = __decodeNested(__PokeworldEntityComm_entity.EntityInfo, value, "entityInfo");
+            }
+            value = json.entityTransform;
+            if (value != null) {
+                message.entityTransform = __decodeNested(__PokeworldEntityComm_entity.EntityTransform, value, "entityTransform");
+            }
+            value = json.actorTransform;
+            if (value != null) {
+                message.actorTransform = __decodeNested(__PokeworldEntityComm_entity.ActorTransform, value, "actorTransform");
+            }
+            value = json.actorState;
+            if (value != null) {
+                message.actorState = __decodeNested(__PokeworldEntityComm_entity.ActorState, value, "actorState");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            NpcSync.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class NpcSyncView {
+        static __layout = {
+            size: 16,
+            hash: 0x276e4fd1,
+            presence: 0,
+            fields: [
+                {name: "entityInfo", type: "TYPE_MESSAGE", offset: 0, get view() { return __PokeworldEntityComm_entity.EntityInfo.View; }},
+                {name: "entityTransform", type: "TYPE_MESSAGE", offset: 4, get view() { return __PokeworldEntityComm_entity.EntityTransform.View; }},
+                {name: "actorTransform", type: "TYPE_MESSAGE", offset: 8, get view() { return __PokeworldEntityComm_entity.ActorTransform.View; }},
+                {name: "actorState", type: "TYPE_MESSAGE", offset: 12, get view() { return __PokeworldEntityComm_entity.ActorState.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, NpcSyncView.__layout.hash);
+            return new NpcSyncView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get entityInfo() {
+            return __flatMessage(this.__view, this.__offset + 0, __PokeworldEntityComm_entity.EntityInfo.View);
+        }
+
+        hasEntityInfo() {
+            return this.entityInfo !== undefined;
+        }
+
+        get entityTransform() {
+            return __flatMessage(this.__view, this.__offset + 4, __PokeworldEntityComm_entity.EntityTransform.View);
+        }
+
+        hasEntityTransform() {
+            return this.entityTransform !== undefined;
+        }
+
+        get actorTransform() {
+            return __flatMessage(this.__view, this.__offset + 8, __PokeworldEntityComm_entity.ActorTransform.View);
+        }
+
+        hasActorTransform() {
+            return this.actorTransform !== undefined;
+        }
+
+        get actorState() {
+            return __flatMessage(this.__view, this.__offset + 12, __PokeworldEntityComm_entity.ActorState.View);
+        }
+
+        hasActorState() {
+            return this.actorState !== undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class NpcSyncColumns extends __ColumnTable {
+        static Row = class NpcSyncRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get entityInfo() {
+                return this.__table.columns.entityInfo[this.__index];
+            }
+
+            get entityTransform() {
+                return this.__table.columns.entityTransform[this.__index];
+            }
+
+            get actorTransform() {
+                return this.__table.columns.actorTransform[this.__index];
+            }
+
+            get actorState() {
+                return this.__table.columns.actorState[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                entityInfo: new Array(length),
+                entityTransform: new Array(length),
+                actorTransform: new Array(length),
+                actorState: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new NpcSyncColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.entityInfo[i] = row.entityInfo;
+                columns.entityTransform[i] = row.entityTransform;
+                columns.actorTransform[i] = row.actorTransform;
+                columns.actorState[i] = row.actorState;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: EntitySync
@@ -246,15 +2798,56 @@ export class EntitySync {
         get clrType() { return EntitySync; },
         fullName: "pokeworld.world.cs.EntitySync",
         package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
         fields: [
-            {name: "player", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cs.PlayerSync", get clrType() { return PlayerSync; },label: "LABEL_OPTIONAL"},
-            {name: "npc", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cs.NpcSync", get clrType() { return NpcSync; },label: "LABEL_OPTIONAL"}
+            {name: "player", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cs.PlayerSync", get clrType() { return PlayerSync; },oneof: "sync", label: "LABEL_OPTIONAL"},
+            {name: "npc", number: 2, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cs.NpcSync", get clrType() { return NpcSync; },oneof: "sync", label: "LABEL_OPTIONAL"}
         ]
     }
 
-    // Oneof field (index: 0)
-    /** @type {PlayerSync} */
-    player;
+    constructor() {
+    }
+
+    // Oneof: sync
+    static SyncCase = Object.freeze({
+        NONE: 0,
+        PLAYER: 1,
+        NPC: 2,
+    });
+
+    /** @type {number} */
+    syncCase = 0;
+    __sync = undefined;
+
+    /** 
+     * @return {EntitySync} 
+     */
+    clearSync() {
+        this.__dirty0 |= 1;
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        this.__sync = undefined;
+        this.syncCase = 0;
+        return this;
+    }
+
+    /** @type {PlayerSync|undefined} */
+    get player() {
+        return this.syncCase === 1 ? this.__sync : undefined;
+    }
+    set player(value) {
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            if (this.syncCase === 1) {
+                this.__sync = undefined;
+                this.syncCase = 0;
+            }
+            return;
+        }
+        this.__sync = value;
+        this.syncCase = 1;
+    }
 
     /** 
      * @param {PlayerSync} value 
@@ -265,9 +2858,23 @@ export class EntitySync {
         return this;
     }
 
-    // Oneof field (index: 0)
-    /** @type {NpcSync} */
-    npc;
+    /** @type {NpcSync|undefined} */
+    get npc() {
+        return this.syncCase === 2 ? this.__sync : undefined;
+    }
+    set npc(value) {
+        this.__dirty0 |= 2;
+        this.__rawStale = true;
+        if (value === undefined || value === null) {
+            if (this.syncCase === 2) {
+                this.__sync = undefined;
+                this.syncCase = 0;
+            }
+            return;
+        }
+        this.__sync = value;
+        this.syncCase = 2;
+    }
 
     /** 
      * @param {NpcSync} value 
@@ -278,6 +2885,351 @@ export class EntitySync {
         return this;
     }
 
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["player", "npc"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        switch (this.syncCase) {
+            case 1:
+            case 2:
+                if (!this.__sync.__isPristine()) return false;
+                break;
+        }
+        return true;
+    }
+
+    /** 
+     * @return {EntitySync} a deep copy of this message
+     */
+    clone() {
+        return new EntitySync().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {EntitySync} other 
+     * @return {EntitySync} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        switch (other.syncCase) {
+            case 1: this.player = __cloneMessage(other.__sync); break;
+            case 2: this.npc = __cloneMessage(other.__sync); break;
+            default: this.clearSync(); break;
+        }
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {EntitySync} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof EntitySync)) return false;
+        if (this.syncCase !== other.syncCase) return false;
+        switch (this.syncCase) {
+            case 1: if (!__equalsMessage(this.__sync, other.__sync)) return false; break;
+            case 2: if (!__equalsMessage(this.__sync, other.__sync)) return false; break;
+        }
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashNumber(hash, this.syncCase);
+        switch (this.syncCase) {
+            case 1: hash = __hashMessage(hash, this.__sync); break;
+            case 2: hash = __hashMessage(hash, this.__sync); break;
+        }
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {EntitySync} 
+     */
+    clear() {
+        this.__dirty0 = 0;
+        this.syncCase = 0;
+        this.__sync = undefined;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
+        return this;
+    }
+
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {EntitySync} 
+     */
+    static acquire() {
+        const message = EntitySync.__pool.pop();
+        if (message === undefined) return new EntitySync();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {EntitySync} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('EntitySync instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (EntitySync.__pool.length < 64) {
+            EntitySync.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        switch (this.syncCase) {
+            case 1: PlayerSync.release(this.__sync); break;
+            case 2: NpcSync.release(this.__sync); break;
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).player = this.player ?? null; break;
+                case 2: (full ??= {}).npc = this.npc ?? null; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && (value = this.player) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).player = value;
+        if ((this.__dirty0 & 2) === 0 && (value = this.npc) && (value = value.encodeDelta()) !== undefined) (nested ??= {}).npc = value;
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {EntitySync} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.player) !== undefined) {
+                this.player = value === null ? undefined : (value instanceof PlayerSync ? value.clone().commit() : new PlayerSync().applyDelta({ f: value }));
+            }
+            if ((value = full.npc) !== undefined) {
+                this.npc = value === null ? undefined : (value instanceof NpcSync ? value.clone().commit() : new NpcSync().applyDelta({ f: value }));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.player) !== undefined) {
+                (this.player ?? (this.player = new PlayerSync())).applyDelta(value);
+            }
+            if ((value = nested.npc) !== undefined) {
+                (this.npc ?? (this.npc = new NpcSync())).applyDelta(value);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {EntitySync} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        let value;
+        if ((value = this.player)) value.commit();
+        if ((value = this.npc)) value.commit();
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {};
+        switch (this.syncCase) {
+            case 1: json.player = this.__sync; break;
+            case 2: json.npc = this.__sync; break;
+        }
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, EntitySync.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        if ((json.player != null ? 1 : 0) + (json.npc != null ? 1 : 0) > 1) return __invalid("sync", "a single oneof member");
+        let value, error;
+        value = json.player;
+        if (value != null && (error = PlayerSync.validate(value)) !== null) return __prefixError(error, "player");
+        value = json.npc;
+        if (value != null && (error = NpcSync.validate(value)) !== null) return __prefixError(error, "npc");
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {EntitySync}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        if ((json.player != null ? 1 : 0) + (json.npc != null ? 1 : 0) > 1) throw __invalid("sync", "a single oneof member");
+        const message = EntitySync.acquire();
+        try {
+            let value;
+            value = json.player;
+            if (value != null) {
+                message.player = __decodeNested(PlayerSync, value, "player");
+            }
+            value = json.npc;
+            if (value != null) {
+                message.npc = __decodeNested(NpcSync, value, "npc");
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            EntitySync.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EntitySyncView {
+        static __layout = {
+            size: 16,
+            hash: 0x17f197b0,
+            presence: 0,
+            fields: [
+                {name: "player", type: "TYPE_MESSAGE", offset: 4, oneof: 0, number: 1, get view() { return PlayerSync.View; }},
+                {name: "npc", type: "TYPE_MESSAGE", offset: 8, oneof: 0, number: 2, get view() { return NpcSync.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EntitySyncView.__layout.hash);
+            return new EntitySyncView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get syncCase() {
+            return __flatUint32(this.__view, this.__offset + 0);
+        }
+
+        get player() {
+            return __flatUint32(this.__view, this.__offset + 0) === 1 ? __flatMessage(this.__view, this.__offset + 4, PlayerSync.View) : undefined;
+        }
+
+        get npc() {
+            return __flatUint32(this.__view, this.__offset + 0) === 2 ? __flatMessage(this.__view, this.__offset + 8, NpcSync.View) : undefined;
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EntitySyncColumns extends __ColumnTable {
+        static Row = class EntitySyncRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get player() {
+                return this.__table.columns.player[this.__index];
+            }
+
+            get npc() {
+                return this.__table.columns.npc[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                player: new Array(length),
+                npc: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EntitySyncColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.player[i] = row.player;
+                columns.npc[i] = row.npc;
+            }
+            return table;
+        }
+    };
+
 }
 
 // Message: EntitySyncNotify
@@ -287,13 +3239,34 @@ export class EntitySyncNotify {
         get clrType() { return EntitySyncNotify; },
         fullName: "pokeworld.world.cs.EntitySyncNotify",
         package: "pokeworld.world.cs",
+        get file() { return __fileDescriptor; },
+        moduleId: 1010,
+        messageId: 1004,
         fields: [
-            {name: "syncs", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cs.EntitySync", get clrType() { return EntitySync; },label: "LABEL_REPEATED"}
+            {name: "syncs", number: 1, type: "TYPE_MESSAGE", typeName: ".pokeworld.world.cs.EntitySync", get clrType() { return EntitySync; },lazy: true, label: "LABEL_REPEATED"}
         ]
     }
 
+    constructor() {
+        this.syncs = [];
+    }
+
+    __syncs = undefined;
+    __syncsRaw = undefined;
+
     /** @type {EntitySync[]} */
-    syncs;
+    get syncs() {
+        if (this.__syncsRaw !== undefined) {
+            this.__syncs = this.__decode(EntitySyncNotify.__descriptor.fields[0], this.__syncsRaw, this.__syncs);
+            this.__syncsRaw = undefined;
+        }
+        return this.__syncs;
+    }
+    set syncs(value) {
+        this.__rawStale = true;
+        this.__syncsRaw = undefined;
+        this.__syncs = value;
+    }
 
     /** 
      * @param {EntitySync[]} value 
@@ -301,8 +3274,388 @@ export class EntitySyncNotify {
      */
     withSyncs(value) {
         this.syncs = value;
+        this.__dirty0 |= 1;
+        this.__rawStale = true;
+        return this;
+    }
+
+    __decode = undefined;
+
+    /** 
+     * Keep a field's JSON to decode on first access
+     * @param {number} number - field number
+     * @param {Object|Array} raw - JSON value of the field
+     * @param {function(Object, *, *): *} decode - decoder of a field value
+     */
+    __setLazy(number, raw, decode) {
+        this.__decode = decode;
+        switch (number) {
+            case 1:
+                this.__syncsRaw = raw;
+                break;
+        }
+    }
+
+    // Source JSON retained for pass-through, and its text when decoded from one
+    __raw = undefined;
+    __rawText = undefined;
+    __rawStale = false;
+
+    static __knownKeys = new Set(["syncs"]);
+
+    /** 
+     * Keep the JSON this message was decoded from
+     * @param {Object} raw - decoded JSON object
+     * @param {string} [text] - JSON text raw was parsed from
+     */
+    __retain(raw, text) {
+        this.__raw = raw;
+        this.__rawText = text;
+        this.__rawStale = false;
+    }
+
+    /** 
+     * Whether the retained JSON still encodes this message: nothing was set
+     * since decoding and every decoded sub-message is pristine as well
+     * @return {boolean} 
+     */
+    __isPristine() {
+        if (this.__raw === undefined || this.__rawStale) return false;
+        let value, raw;
+        if ((value = this.__syncs) != null) {
+            raw = this.__raw.syncs;
+            if (value.length !== (raw == null ? 0 : raw.length)) return false;
+            for (const item of value) {
+                if (item != null && !item.__isPristine()) return false;
+            }
+        }
+        return true;
+    }
+
+    /** 
+     * @return {EntitySyncNotify} a deep copy of this message
+     */
+    clone() {
+        return new EntitySyncNotify().copyFrom(this);
+    }
+
+    /** 
+     * Deep copy all fields from another message of the same type
+     * @param {EntitySyncNotify} other 
+     * @return {EntitySyncNotify} 
+     */
+    copyFrom(other) {
+        this.__rawStale = true;
+        this.syncs = __cloneArray(other.syncs, __cloneMessage);
+        return this;
+    }
+
+    /** 
+     * Structural equality, unset implicit fields equal their defaults
+     * @param {EntitySyncNotify} other 
+     * @return {boolean} 
+     */
+    equals(other) {
+        if (this === other) return true;
+        if (!(other instanceof EntitySyncNotify)) return false;
+        if (!__equalsArray(this.syncs, other.syncs, __equalsMessage)) return false;
+        return true;
+    }
+
+    /** 
+     * Structural hash consistent with equals()
+     * @return {number} int32 hash
+     */
+    hashCode() {
+        let hash = 17;
+        hash = __hashArray(hash, this.syncs, __hashMessage);
+        return hash;
+    }
+
+    /** 
+     * Reset all fields to their defaults without reallocating arrays
+     * @return {EntitySyncNotify} 
+     */
+    clear() {
+        this.__syncsRaw = undefined;
+        if (Array.isArray(this.syncs)) this.syncs.length = 0; else this.syncs = [];
+        this.__dirty0 = 0;
+        this.__raw = undefined;
+        this.__rawText = undefined;
+        this.__rawStale = false;
         return this;
     }
 
+    static __pool = [];
+
+    __released = false;
+
+    /** 
+     * Take an instance from the free list, or allocate one if it is empty
+     * @return {EntitySyncNotify} 
+     */
+    static acquire() {
+        const message = EntitySyncNotify.__pool.pop();
+        if (message === undefined) return new EntitySyncNotify();
+        message.__released = false;
+        return message;
+    }
+
+    /** 
+     * Return an instance and the sub-messages it owns to their free lists
+     * @param {EntitySyncNotify} message 
+     * @throws {Error} if the instance was already released
+     */
+    static release(message) {
+        if (message.__released) {
+            throw new Error('EntitySyncNotify instance released twice');
+        }
+        message.__releaseOwned();
+        message.clear();
+        message.__released = true;
+        if (EntitySyncNotify.__pool.length < 64) {
+            EntitySyncNotify.__pool.push(message);
+        }
+    }
+
+    /** 
+     * Return the sub-messages this instance owns to their free lists
+     * @private
+     */
+    __releaseOwned() {
+        if (Array.isArray(this.__syncs)) {
+            for (const item of this.__syncs) {
+                if (item instanceof EntitySync) EntitySync.release(item);
+            }
+        }
+    }
+
+    // Dirty field bitmask
+    __dirty0 = 0;
+
+    /** 
+     * Clear the dirty bits of this message only, sub-messages keep theirs
+     * @private
+     */
+    __markCommitted() {
+        this.__dirty0 = 0;
+    }
+
+    /** 
+     * Encode fields changed since the last commit()
+     * @return {{f?: Object, d?: Object}|undefined} changed values (f) and nested deltas (d)
+     */
+    encodeDelta() {
+        let full;
+        let nested;
+        let value;
+        for (let bits = this.__dirty0; bits !== 0;) {
+            const bit = bits & -bits;
+            bits ^= bit;
+            switch (bit) {
+                case 1: (full ??= {}).syncs = this.syncs; break;
+            }
+        }
+        if ((this.__dirty0 & 1) === 0 && Array.isArray(this.syncs)) {
+            const list = this.syncs;
+            let items;
+            for (let i = 0; i < list.length; i++) {
+                if (list[i] && (value = list[i].encodeDelta()) !== undefined) (items ??= {})[i] = value;
+            }
+            if (items !== undefined) (nested ??= {}).syncs = items;
+        }
+        return full === undefined && nested === undefined ? undefined : { f: full, d: nested };
+    }
+
+    /** 
+     * Apply a delta produced by encodeDelta() (also accepts its JSON form)
+     * @param {{f?: Object, d?: Object}} delta 
+     * @return {EntitySyncNotify} 
+     */
+    applyDelta(delta) {
+        let value;
+        const full = delta.f;
+        if (full !== undefined) {
+            if ((value = full.syncs) !== undefined) {
+                this.syncs = value === null ? [] : value.map(item => (item instanceof EntitySync ? item.clone().commit() : new EntitySync().applyDelta({ f: item })));
+            }
+        }
+        const nested = delta.d;
+        if (nested !== undefined) {
+            if ((value = nested.syncs) !== undefined) {
+                const list = this.syncs;
+                for (const i in value) list[i]?.applyDelta(value[i]);
+            }
+        }
+        this.__markCommitted();
+        return this;
+    }
+
+    /** 
+     * Mark the current state as synchronized
+     * @return {EntitySyncNotify} 
+     */
+    commit() {
+        this.__dirty0 = 0;
+        if (Array.isArray(this.syncs)) {
+            for (const item of this.syncs) item?.commit();
+        }
+        return this;
+    }
+
+    toJSON() {
+        if (this.__isPristine()) return this.__raw;
+        const json = {
+            syncs: this.__syncsRaw ?? this.__syncs,
+        };
+        return this.__raw === undefined ? json : __copyUnknown(json, this.__raw, EntitySyncNotify.__knownKeys);
+    }
+
+    /**
+     * Validate untrusted JSON without decoding it
+     * @param {any} json
+     * @return {Error|null} null when valid, otherwise an error with the field path
+     */
+    static validate(json) {
+        if (!__isObject(json)) return __invalid("", "object");
+        let value, error;
+        value = json.syncs;
+        if (value != null) {
+            if (!Array.isArray(value)) return __invalid("syncs", "array");
+            for (let i = 0; i < value.length; i++) {
+                const item = value[i];
+                if ((error = EntitySync.validate(item)) !== null) return __prefixError(error, "syncs", i);
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Validate untrusted JSON and decode it in a single pass
+     * @param {any} json
+     * @return {EntitySyncNotify}
+     * @throws {Error} ValidationError carrying the field path
+     */
+    static validateAndDecode(json) {
+        if (!__isObject(json)) throw __invalid("", "object");
+        const message = EntitySyncNotify.acquire();
+        try {
+            let value;
+            value = json.syncs;
+            if (value != null) {
+                if (!Array.isArray(value)) throw __invalid("syncs", "array");
+                const list = new Array(value.length);
+                message.syncs = list;
+                for (let i = 0; i < value.length; i++) {
+                    const item = value[i];
+                    list[i] = __decodeNested(EntitySync, item, "syncs", i);
+                }
+            }
+            message.__markCommitted();
+            message.__retain(json);
+        } catch (error) {
+            EntitySyncNotify.release(message);
+            throw error;
+        }
+        return message;
+    }
+
+    // Zero-copy reader over the flat binary blob format
+    static View = class EntitySyncNotifyView {
+        static __layout = {
+            size: 8,
+            hash: 0xfd03e253,
+            presence: 8,
+            fields: [
+                {name: "syncs", type: "TYPE_MESSAGE", offset: 0, repeated: true, stride: 4, get view() { return EntitySync.View; }}
+            ]
+        };
+
+        static open(buffer) {
+            const view = __flatOpen(buffer, EntitySyncNotifyView.__layout.hash);
+            return new EntitySyncNotifyView(view, view.getUint32(8, true));
+        }
+
+        constructor(view, offset) {
+            this.__view = view;
+            this.__offset = offset;
+        }
+
+        get syncs() {
+            return __flatList(this.__view, this.__offset + 0, 4, __flatMessage, EntitySync.View);
+        }
+    };
+
+    // Struct-of-arrays table over rows of this message
+    static Columns = class EntitySyncNotifyColumns extends __ColumnTable {
+        static Row = class EntitySyncNotifyRow {
+            constructor(table, index) {
+                this.__table = table;
+                this.__index = index;
+            }
+
+            get syncs() {
+                return this.__table.columns.syncs[this.__index];
+            }
+        };
+
+        constructor(length) {
+            super();
+            this.length = length;
+            this.dictionaries = {};
+            this.columns = {
+                syncs: new Array(length),
+            };
+        }
+
+        static fromRows(rows) {
+            const table = new EntitySyncNotifyColumns(rows.length);
+            const { columns, dictionaries } = table;
+            for (let i = 0; i < rows.length; i++) {
+                const row = rows[i];
+                columns.syncs[i] = row.syncs;
+            }
+            return table;
+        }
+    };
+
+}
+
+// Client stub: request/response pairs of the module's message ids
+export class WorldClient {
+    static __calls = [
+        {name: "move", get requestType() { return MoveRequest; }},
+        {name: "exit", get requestType() { return ExitRequest; }, get responseType() { return ExitResponse; }},
+    ];
+
+    /**
+     * @param {{call: function(Object, Function, Object=): Promise<Object>, send: function(Object): void}} channel
+     *     RpcChannel of proto-rpc.mjs, or any object with the same call/send methods
+     */
+    constructor(channel) {
+        this.channel = channel;
+    }
+
+    /**
+     * @param {MoveRequest} request
+     */
+    move(request) {
+        this.channel.send(request);
+    }
+
+    /**
+     * @param {ExitRequest} request
+     * @param {{timeout?: number}} [options]
+     * @returns {Promise<ExitResponse>}
+     */
+    exit(request, options) {
+        return this.channel.call(request, ExitResponse, options);
+    }
 }
 
+// Serialized FileDescriptorProto (base64), decoded on first use by proto-reflect.mjs
+export const __fileDescriptor = {
+    name: "pokeworld/world/cs_world.proto",
+    dependencies: ["google/protobuf/descriptor.proto", "pokeworld/module/module_id.proto", "pokeworld/entity/comm_entity.proto"],
+    data: "Ch5wb2tld29ybGQvd29ybGQvY3Nfd29ybGQucHJvdG8SEnBva2V3b3JsZC53b3JsZC5jcxogZ29vZ2xlL3Byb3RvYnVmL2Rlc2NyaXB0b3IucHJvdG8aIHBva2V3b3JsZC9tb2R1bGUvbW9kdWxlX2lkLnByb3RvGiJwb2tld29ybGQvZW50aXR5L2NvbW1fZW50aXR5LnByb3RvImUKC01vdmVSZXF1ZXN0EjwKCG1vdmVtZW50GAEgASgOMiAucG9rZXdvcmxkLmVudGl0eS5jb21tLkRpcmVjdGlvblIIbW92ZW1lbnQSEAoDcnVuGAIgASgIUgNydW46BpC61kzpByIVCgtFeGl0UmVxdWVzdDoGkLrWTOoHIjAKDEV4aXRSZXNwb25zZRIYCgdzdWNjZXNzGAEgASgIUgdzdWNjZXNzOgaQutZM6wcitwIKClBsYXllclN5bmMSQgoLZW50aXR5X2luZm8YASABKAsyIS5wb2tld29ybGQuZW50aXR5LmNvbW0uRW50aXR5SW5mb1IKZW50aXR5SW5mbxJRChBlbnRpdHlfdHJhbnNmb3JtGAIgASgLMiYucG9rZXdvcmxkLmVudGl0eS5jb21tLkVudGl0eVRyYW5zZm9ybVIPZW50aXR5VHJhbnNmb3JtEk4KD2FjdG9yX3RyYW5zZm9ybRgDIAEoCzIlLnBva2V3b3JsZC5lbnRpdHkuY29tbS5BY3RvclRyYW5zZm9ybVIOYWN0b3JUcmFuc2Zvcm0SQgoLYWN0b3Jfc3RhdGUYBCABKAsyIS5wb2tld29ybGQuZW50aXR5LmNvbW0uQWN0b3JTdGF0ZVIKYWN0b3JTdGF0ZSK0AgoHTnBjU3luYxJCCgtlbnRpdHlfaW5mbxgBIAEoCzIhLnBva2V3b3JsZC5lbnRpdHkuY29tbS5FbnRpdHlJbmZvUgplbnRpdHlJbmZvElEKEGVudGl0eV90cmFuc2Zvcm0YAiABKAsyJi5wb2tld29ybGQuZW50aXR5LmNvbW0uRW50aXR5VHJhbnNmb3JtUg9lbnRpdHlUcmFuc2Zvcm0STgoPYWN0b3JfdHJhbnNmb3JtGAMgASgLMiUucG9rZXdvcmxkLmVudGl0eS5jb21tLkFjdG9yVHJhbnNmb3JtUg5hY3RvclRyYW5zZm9ybRJCCgthY3Rvcl9zdGF0ZRgEIAEoCzIhLnBva2V3b3JsZC5lbnRpdHkuY29tbS5BY3RvclN0YXRlUgphY3RvclN0YXRlIn8KCkVudGl0eVN5bmMSOAoGcGxheWVyGAEgASgLMh4ucG9rZXdvcmxkLndvcmxkLmNzLlBsYXllclN5bmNIAFIGcGxheWVyEi8KA25wYxgCIAEoCzIbLnBva2V3b3JsZC53b3JsZC5jcy5OcGNTeW5jSABSA25wY0IGCgRzeW5jIlAKEEVudGl0eVN5bmNOb3RpZnkSNAoFc3luY3MYASADKAsyHi5wb2tld29ybGQud29ybGQuY3MuRW50aXR5U3luY1IFc3luY3M6BpC61kzsByqqAQoJTWVzc2FnZUlkEhYKEk1FU1NBR0VfSURfSU5WQUxJRBAAEhwKF01FU1NBR0VfSURfTU9WRV9SRVFVRVNUEOkHEhwKF01FU1NBR0VfSURfRVhJVF9SRVFVRVNUEOoHEh0KGE1FU1NBR0VfSURfRVhJVF9SRVNQT05TRRDrBxIiCh1NRVNTQUdFX0lEX0VOVElUWV9TWU5DX05PVElGWRDsBxoGiNClTPIHOmAKCm1lc3NhZ2VfaWQSHy5nb29nbGUucHJvdG9idWYuTWVzc2FnZU9wdGlvbnMYoufKCSABKA4yHS5wb2tld29ybGQud29ybGQuY3MuTWVzc2FnZUlkUgltZXNzYWdlSWRiBnByb3RvMw==",
+};
@@ -0,0 +1,333 @@
+// Generated by protoc-gen-js-mjs
+// Type registry: 103 messages and enums in 22 files
+
+// Perfect hash buckets: a displacement seed, or -(slot + 1) for a single name
+const __seeds = new Int32Array([
+    0, 0, 0, 0, 0, -1, 0, 2, 6, 0, 0, 0, 0, 0, 2, -11,
+    0, -20, -21, 0, -23, 1, -24, 0, 2, 0, 2, -25, -26, 0, -32, 0,
+    1, 0, 3, 0, 1, 1, -35, 2, 0, -36, -44, -51, 1, -52, -54, 0,
+    3, 0, -56, 3, 1, 3, 0, 0, 9, 8, -57, 10, 0, -63, -65, 0,
+    0, -71, -74, 0, 0, 2, 0, -76, 0, 1, 0, -77, 30, -78, 0, 0,
+    3, -83, -85, -88, 0, 3, 0, 0, -91, 22, 0, 3, -93, 0, 1, 0,
+    5, 0, 0, -97, -103, 1, 0,
+]);
+
+// Full name, module and export path of each slot
+const __names = [
+    "pokeworld.user.cs.EnterServerResponse",
+    "pokeworld.user.cs.RegisterResponse",
+    "pokeworld.world.cfg.TerrainTileRuleType",
+    "pokeworld.user.comm.Config",
+    "pokeworld.world.comm.TerrainType",
+    "pokeworld.inventory.cs.SyncNotify",
+    "pokeworld.pokemon.cfg.TbMove",
+    "pokeworld.pokemon.cfg.Move",
+    "pokeworld.player.cs.GetPlayersResponse.Result",
+    "pokeworld.player.cs.GetPlayersRequest",
+    "pokeworld.world.cfg.TerrainType",
+    "pokeworld.world.comm.TerrainSection.Tile",
+    "pokeworld.world.comm.WorldData.TerrainSectionByNameEntry",
+    "pokeworld.inventory.cs.PullRequest",
+    "pokeworld.world.cs.ExitResponse",
+    "pokeworld.user.cs.LoginRequest",
+    "pokeworld.world.cs.MoveRequest",
+    "pokeworld.resource.cfg.Resource",
+    "pokeworld.pokemon.cfg.PokeTypeInfo",
+    "pokeworld.inventory.comm.Inventory",
+    "pokeworld.math.comm.Vector3Int",
+    "pokeworld.world.comm.WorldData",
+    "pokeworld.math.comm.RectInt",
+    "pokeworld.model.comm.Player",
+    "pokeworld.module.ModuleId",
+    "pokeworld.user.cs.GetServersRequest",
+    "pokeworld.entity.cfg.Entity",
+    "pokeworld.pokemon.cfg.MoveCategory",
+    "pokeworld.math.comm.Vector2Int",
+    "pokeworld.pokemon.cfg.PokeType",
+    "pokeworld.resource.cfg.ResourceId",
+    "pokeworld.network.cfg.ServerType",
+    "pokeworld.model.comm.Pokemon",
+    "pokeworld.user.cs.GetServersResponse",
+    "pokeworld.user.cs.MessageId",
+    "pokeworld.inventory.comm.Inventory.SlotMapEntry",
+    "pokeworld.world.cfg.TerrainFlags",
+    "pokeworld.player.cs.MessageId",
+    "pokeworld.world.cfg.Terrain",
+    "pokeworld.pokemon.comm.Evolution.Stage.Condition",
+    "pokeworld.pokemon.cfg.TbPokemon",
+    "pokeworld.network.cfg.TbServer",
+    "pokeworld.world.comm.TerrainDefinitionNode",
+    "pokeworld.resource.cfg.TbResource",
+    "pokeworld.pokemon.cfg.Pokemon",
+    "pokeworld.entity.comm.NpcInfo",
+    "pokeworld.user.cs.Server",
+    "pokeworld.player.cs.GetPlayersResponse",
+    "pokeworld.config.cfg.FieldOptionsTableLoader",
+    "pokeworld.network.cfg.Server",
+    "pokeworld.entity.comm.ActorTransform",
+    "pokeworld.pokemon.comm.Evolution",
+    "pokeworld.user.cs.EnterServerRequest",
+    "pokeworld.battle.comm.BattleEvent.CooldownsEntry",
+    "pokeworld.world.cs.MessageId",
+    "pokeworld.math.comm.Segment",
+    "pokeworld.entity.comm.EntityTransform",
+    "pokeworld.entity.comm.Direction",
+    "pokeworld.world.cfg.TbTerrain",
+    "pokeworld.entity.comm.ActorState",
+    "pokeworld.user.cs.RegisterRequest",
+    "pokeworld.entity.comm.ActorInfo",
+    "pokeworld.player.cs.JoinGameResponse",
+    "pokeworld.world.cfg.World",
+    "pokeworld.battle.comm.BattleLog",
+    "pokeworld.world.comm.TerrainSection",
+    "pokeworld.math.comm.Vector3",
+    "pokeworld.world.cs.NpcSync",
+    "pokeworld.pokemon.comm.Evolution.Stage",
+    "pokeworld.inventory.cs.MessageId",
+    "pokeworld.player.cs.JoinGameRequest",
+    "pokeworld.world.cs.PlayerSync",
+    "pokeworld.entity.comm.PlayerInfo",
+    "pokeworld.user.cs.GetCreatedPlayersResponse",
+    "pokeworld.config.cfg.Tables",
+    "pokeworld.world.comm.TbWorldData",
+    "pokeworld.math.comm.Rect",
+    "pokeworld.entity.comm.MotionState",
+    "pokeworld.math.comm.Vector2",
+    "pokeworld.world.comm.TerrainDefinition",
+    "pokeworld.user.cs.GetCreatedPlayersRequest",
+    "pokeworld.world.cfg.TbWorld",
+    "pokeworld.pokemon.comm.Evolution.Trigger",
+    "pokeworld.battle.cs.MessageId",
+    "pokeworld.world.cs.ExitRequest",
+    "pokeworld.inventory.comm.Inventories",
+    "pokeworld.actor.cfg.TbPlayer",
+    "pokeworld.player.cs.Player",
+    "pokeworld.inventory.cs.SwapSlotRequest",
+    "pokeworld.pokemon.cfg.TbPokeTypeInfo",
+    "pokeworld.world.cs.EntitySyncNotify",
+    "pokeworld.world.comm.TerrainDefinitionGroup",
+    "pokeworld.actor.cfg.Player",
+    "pokeworld.world.cfg.TerrainRuleType",
+    "pokeworld.battle.comm.BattleEvent",
+    "pokeworld.entity.comm.EntityInfo",
+    "pokeworld.user.cs.LoginResponse",
+    "pokeworld.inventory.comm.Slot",
+    "pokeworld.actor.cfg.Actor",
+    "pokeworld.resource.cfg.AssetAddress",
+    "pokeworld.inventory.comm.Tab",
+    "pokeworld.world.cs.EntitySync",
+    "pokeworld.entity.comm.Type",
+];
+const __modules = new Uint16Array([
+    18, 18, 19, 17, 20, 9, 14, 14, 13, 13, 19, 20, 20, 9, 21, 18,
+    21, 16, 14, 8, 10, 20, 10, 7, 11, 18, 5, 14, 10, 14, 16, 12,
+    7, 18, 18, 8, 19, 13, 19, 15, 14, 12, 20, 16, 14, 6, 18, 13,
+    3, 12, 6, 15, 18, 1, 21, 10, 6, 6, 19, 6, 18, 6, 13, 19,
+    1, 20, 10, 21, 15, 9, 13, 21, 6, 18, 4, 20, 10, 6, 10, 20,
+    18, 19, 15, 2, 21, 8, 0, 13, 9, 14, 21, 20, 0, 19, 1, 6,
+    18, 8, 0, 16, 8, 21, 6,
+]);
+const __paths = [
+    "EnterServerResponse",
+    "RegisterResponse",
+    "TerrainTileRuleType",
+    "Config",
+    "TerrainType",
+    "SyncNotify",
+    "TbMove",
+    "Move",
+    "GetPlayersResponse.Result",
+    "GetPlayersRequest",
+    "TerrainType",
+    "TerrainSection.Tile",
+    "WorldData.TerrainSectionByNameEntry",
+    "PullRequest",
+    "ExitResponse",
+    "LoginRequest",
+    "MoveRequest",
+    "Resource",
+    "PokeTypeInfo",
+    "Inventory",
+    "Vector3Int",
+    "WorldData",
+    "RectInt",
+    "Player",
+    "ModuleId",
+    "GetServersRequest",
+    "Entity",
+    "MoveCategory",
+    "Vector2Int",
+    "PokeType",
+    "ResourceId",
+    "ServerType",
+    "Pokemon",
+    "GetServersResponse",
+    "MessageId",
+    "Inventory.SlotMapEntry",
+    "TerrainFlags",
+    "MessageId",
+    "Terrain",
+    "Evolution.Stage.Condition",
+    "TbPokemon",
+    "TbServer",
+    "TerrainDefinitionNode",
+    "TbResource",
+    "Pokemon",
+    "NpcInfo",
+    "Server",
+    "GetPlayersResponse",
+    "FieldOptionsTableLoader",
+    "Server",
+    "ActorTransform",
+    "Evolution",
+    "EnterServerRequest",
+    "BattleEvent.CooldownsEntry",
+    "MessageId",
+    "Segment",
+    "EntityTransform",
+    "Direction",
+    "TbTerrain",
+    "ActorState",
+    "RegisterRequest",
+    "ActorInfo",
+    "JoinGameResponse",
+    "World",
+    "BattleLog",
+    "TerrainSection",
+    "Vector3",
+    "NpcSync",
+    "Evolution.Stage",
+    "MessageId",
+    "JoinGameRequest",
+    "PlayerSync",
+    "PlayerInfo",
+    "GetCreatedPlayersResponse",
+    "Tables",
+    "TbWorldData",
+    "Rect",
+    "MotionState",
+    "Vector2",
+    "TerrainDefinition",
+    "GetCreatedPlayersRequest",
+    "TbWorld",
+    "Evolution.Trigger",
+    "MessageId",
+    "ExitRequest",
+    "Inventories",
+    "TbPlayer",
+    "Player",
+    "SwapSlotRequest",
+    "TbPokeTypeInfo",
+    "EntitySyncNotify",
+    "TerrainDefinitionGroup",
+    "Player",
+    "TerrainRuleType",
+    "BattleEvent",
+    "EntityInfo",
+    "LoginResponse",
+    "Slot",
+    "Actor",
+    "AssetAddress",
+    "Tab",
+    "EntitySync",
+    "Type",
+];
+
+// Module loaders, imported on first resolve
+const __loaders = [
+    () => import('./pokeworld/actor/cfg_actor.mjs'),
+    () => import('./pokeworld/battle/comm_battle.mjs'),
+    () => import('./pokeworld/battle/cs_battle.mjs'),
+    () => import('./pokeworld/config/cfg_options.mjs'),
+    () => import('./pokeworld/config/cfg_table.mjs'),
+    () => import('./pokeworld/entity/cfg_entity.mjs'),
+    () => import('./pokeworld/entity/comm_entity.mjs'),
+    () => import('./pokeworld/entity/comm_model.mjs'),
+    () => import('./pokeworld/inventory/comm_inventory.mjs'),
+    () => import('./pokeworld/inventory/cs_inventory.mjs'),
+    () => import('./pokeworld/math/comm_math.mjs'),
+    () => import('./pokeworld/module/module_id.mjs'),
+    () => import('./pokeworld/network/cfg_network.mjs'),
+    () => import('./pokeworld/player/cs_player.mjs'),
+    () => import('./pokeworld/pokemon/cfg_pokemon.mjs'),
+    () => import('./pokeworld/pokemon/comm_pokemon.mjs'),
+    () => import('./pokeworld/resource/cfg_resource.mjs'),
+    () => import('./pokeworld/user/comm_user.mjs'),
+    () => import('./pokeworld/user/cs_user.mjs'),
+    () => import('./pokeworld/world/cfg_world.mjs'),
+    () => import('./pokeworld/world/comm_world.mjs'),
+    () => import('./pokeworld/world/cs_world.mjs'),
+];
+const __imports = new Array(__loaders.length);
+const __types = new Array(__names.length);
+
+function __hashName(seed, name) {
+    let hash = (seed ^ 0x811c9dc5) >>> 0;
+    for (let i = 0; i < name.length; i++) {
+        hash = Math.imul(hash ^ name.charCodeAt(i), 0x01000193);
+    }
+    return hash >>> 0;
+}
+
+/** 
+ * Slot of a registered full name
+ * @param {string} fullName full name, optionally with a leading dot
+ * @return {number} slot index, -1 if the name is not registered
+ */
+export function findTypeSlot(fullName) {
+    if (fullName.charCodeAt(0) === 46) fullName = fullName.substring(1);
+    const seed = __seeds[__hashName(0, fullName) % __seeds.length];
+    const slot = seed < 0 ? -seed - 1 : __hashName(seed, fullName) % __seeds.length;
+    return __names[slot] === fullName ? slot : -1;
+}
+
+/** 
+ * @param {string} fullName 
+ * @return {boolean} whether the registry knows the full name
+ */
+export function hasType(fullName) {
+    return findTypeSlot(fullName) !== -1;
+}
+
+/** 
+ * Class or enum of a full name whose module has already been loaded
+ * @param {string} fullName 
+ * @return {Function|Object|undefined} 
+ */
+export function getType(fullName) {
+    const slot = findTypeSlot(fullName);
+    return slot === -1 ? undefined : __types[slot];
+}
+
+/** 
+ * Import the module declaring a full name and resolve its class or enum
+ * @param {string} fullName 
+ * @return {Promise<Function|Object|undefined>} undefined if the name is not registered
+ */
+export function loadType(fullName) {
+    const slot = findTypeSlot(fullName);
+    if (slot === -1) return Promise.resolve(undefined);
+    if (__types[slot] !== undefined) return Promise.resolve(__types[slot]);
+    const index = __modules[slot];
+    __imports[index] ??= __loaders[index]().catch(error => {
+        __imports[index] = undefined;
+        throw error;
+    });
+    return __imports[index].then(module => {
+        let type = module;
+        for (const key of __paths[slot].split('.')) type = type[key];
+        return __types[slot] = type;
+    });
+}
+
+/** 
+ * Resolve the type of a google.protobuf.Any type URL
+ * @param {string} typeUrl e.g. "type.googleapis.com/pokeworld.Detail"
+ * @return {Promise<Function|Object|undefined>} 
+ */
+export function loadTypeByUrl(typeUrl) {
+    return loadType(typeUrl.substring(typeUrl.lastIndexOf('/') + 1));
+}
+
+/** @type {ReadonlyArray<string>} all registered full names, in slot order */
+export const typeNames = Object.freeze(__names.slice());
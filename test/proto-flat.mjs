@@ -0,0 +1,288 @@
+/**
+ * 扁平二进制表格式（flat模式）的打包器。
+ * 将消息实例或JSON数据按生成代码中View.__layout描述的定长布局写入一个连续的blob，
+ * 生成的View类可直接在ArrayBuffer/SharedArrayBuffer上读取字段，无需反序列化。
+ *
+ * blob头部（16字节，小端）：magic 'PBF1'、布局哈希、根记录偏移、总长度。
+ */
+
+import { decodeDuration, decodeFieldMask, decodeTimestamp } from './proto.mjs';
+import { metricsEnabled, measureEncode } from './proto-metrics.mjs';
+
+const FLAT_MAGIC = 0x31464250;
+const FLAT_HEADER_SIZE = 16;
+
+/**
+ * 获取消息类或View类的布局
+ * @private
+ * @param {Function} messageCls - 消息类（flat模式生成）或其View类
+ * @returns {Object} 布局描述
+ */
+function getLayout(messageCls) {
+    const layout = messageCls.__layout ?? messageCls.View?.__layout;
+    if (!layout) {
+        throw new Error(`'${messageCls.name}' has no flat layout (generate with the 'flat' option)`);
+    }
+    return layout;
+}
+
+/**
+ * 将知名类型的值转换为其存储形式：Timestamp/Duration为毫秒数，
+ * JSON类类型为JSON文本，包装类型即基本类型值
+ * @private
+ * @param {string} wkt - 知名类型名（如'Timestamp'）
+ * @param {any} value - 内存中的值或其JSON形式
+ * @returns {any} 存储值
+ */
+function toStoredValue(wkt, value) {
+    switch (wkt) {
+        case 'Timestamp':
+            return decodeTimestamp(value, true);
+        case 'Duration':
+            return decodeDuration(value);
+        case 'FieldMask':
+            return JSON.stringify(decodeFieldMask(value));
+        case 'Struct':
+        case 'Value':
+        case 'ListValue':
+        case 'Any':
+        case 'Empty':
+            return JSON.stringify(value);
+        default:
+            return value;
+    }
+}
+
+/**
+ * 可增长的blob写入器
+ * @private
+ */
+class FlatWriter {
+    constructor(initialSize) {
+        this.bytes = new Uint8Array(Math.max(initialSize, 64));
+        this.view = new DataView(this.bytes.buffer);
+        this.length = 0;
+        this.strings = new Map();
+        this.encoder = new TextEncoder();
+    }
+
+    // 分配size字节（按align对齐，已清零），返回偏移
+    alloc(size, align) {
+        const offset = (this.length + align - 1) & -align;
+        const end = offset + size;
+        if (end > this.bytes.length) {
+            let capacity = this.bytes.length * 2;
+            while (capacity < end) capacity *= 2;
+            const bytes = new Uint8Array(capacity);
+            bytes.set(this.bytes.subarray(0, this.length));
+            this.bytes = bytes;
+            this.view = new DataView(bytes.buffer);
+        }
+        this.length = end;
+        return offset;
+    }
+
+    // 写入字符串并返回[偏移, 字节长度]，相同字符串只存一份
+    writeString(value) {
+        let entry = this.strings.get(value);
+        if (entry === undefined) {
+            const encoded = this.encoder.encode(value);
+            const offset = encoded.length === 0 ? 0 : this.alloc(encoded.length, 1);
+            this.bytes.set(encoded, offset);
+            entry = [offset, encoded.length];
+            this.strings.set(value, entry);
+        }
+        return entry;
+    }
+
+    writeBytes(value) {
+        const offset = value.length === 0 ? 0 : this.alloc(value.length, 1);
+        this.bytes.set(value, offset);
+        return [offset, value.length];
+    }
+
+    // 写入一条消息记录，返回记录偏移
+    writeRecord(layout, value) {
+        const record = this.alloc(layout.size, 8);
+        this.writeFields(layout, record, value);
+        return record;
+    }
+
+    writeFields(layout, record, value) {
+        for (const field of layout.fields) {
+            const fieldValue = value[field.name];
+            if (fieldValue === undefined || fieldValue === null) {
+                continue;
+            }
+
+            const slot = record + field.offset;
+            if (field.oneof !== undefined) {
+                this.view.setUint32(record + field.oneof, field.number, true);
+            }
+            if (field.has !== undefined) {
+                const word = record + layout.presence + (field.has >>> 5) * 4;
+                this.view.setUint32(word, this.view.getUint32(word, true) | (1 << (field.has & 31)), true);
+            }
+
+            if (field.map !== undefined) {
+                this.writeMap(field, slot, fieldValue);
+            } else if (field.repeated) {
+                this.writeList(field, slot, fieldValue);
+            } else {
+                this.writeValue(field, slot, fieldValue);
+            }
+        }
+    }
+
+    writeList(field, slot, list) {
+        if (!Array.isArray(list)) {
+            throw new Error(`Expected array for repeated field '${field.name}', got ${typeof list}`);
+        }
+        if (list.length === 0) return;
+        const base = this.alloc(list.length * field.stride, 8);
+        for (let i = 0; i < list.length; i++) {
+            if (list[i] !== null && list[i] !== undefined) {
+                this.writeValue(field, base + i * field.stride, list[i]);
+            }
+        }
+        this.view.setUint32(slot, base, true);
+        this.view.setUint32(slot + 4, list.length, true);
+    }
+
+    writeMap(field, slot, map) {
+        const entries = map instanceof Map ? [...map] : Object.entries(map);
+        if (entries.length === 0) return;
+        const [keyField, valueField] = field.map;
+        const base = this.alloc(entries.length * field.stride, 8);
+        for (let i = 0; i < entries.length; i++) {
+            const [key, value] = entries[i];
+            const entry = base + i * field.stride;
+            // 对象的键总是字符串，按键类型还原
+            this.writeValue(keyField, entry + keyField.offset, keyField.type === 'TYPE_STRING' ? key :
+                keyField.type === 'TYPE_BOOL' ? key === true || key === 'true' : Number(key));
+            if (value !== null && value !== undefined) {
+                this.writeValue(valueField, entry + valueField.offset, value);
+            }
+        }
+        this.view.setUint32(slot, base, true);
+        this.view.setUint32(slot + 4, entries.length, true);
+    }
+
+    // 写入单个值到offset处（子消息、字符串等先分配再回填偏移）
+    writeValue(field, offset, value) {
+        if (field.wkt !== undefined) {
+            value = toStoredValue(field.wkt, value);
+        }
+        switch (field.type) {
+            case 'TYPE_BOOL':
+                this.view.setUint8(offset, value ? 1 : 0);
+                break;
+            case 'TYPE_UINT32':
+            case 'TYPE_FIXED32':
+                this.view.setUint32(offset, value, true);
+                break;
+            case 'TYPE_FLOAT':
+                this.view.setFloat32(offset, value, true);
+                break;
+            case 'TYPE_DOUBLE':
+                this.view.setFloat64(offset, value, true);
+                break;
+            case 'TYPE_INT64':
+            case 'TYPE_SINT64':
+            case 'TYPE_SFIXED64':
+                this.view.setBigInt64(offset, BigInt(value), true);
+                break;
+            case 'TYPE_UINT64':
+            case 'TYPE_FIXED64':
+                this.view.setBigUint64(offset, BigInt(value), true);
+                break;
+            case 'TYPE_STRING': {
+                const [position, length] = this.writeString(value);
+                this.view.setUint32(offset, position, true);
+                this.view.setUint32(offset + 4, length, true);
+                break;
+            }
+            case 'TYPE_BYTES': {
+                const [position, length] = this.writeBytes(value);
+                this.view.setUint32(offset, position, true);
+                this.view.setUint32(offset + 4, length, true);
+                break;
+            }
+            case 'TYPE_MESSAGE': {
+                const record = this.writeRecord(field.view.__layout, value);
+                this.view.setUint32(offset, record, true);
+                break;
+            }
+            default:
+                // int32/sint32/sfixed32/enum
+                this.view.setInt32(offset, value, true);
+                break;
+        }
+    }
+}
+
+/**
+ * 将消息打包为扁平二进制blob
+ * @param {Function} messageCls - 根消息类（flat模式生成，如TbPlayer）
+ * @param {Object|string} value - 消息实例、JSON对象或JSON字符串
+ * @returns {Uint8Array} blob数据
+ * @throws {Error} 如果消息类没有flat布局或数据与布局不匹配
+ */
+export function packFlat(messageCls, value) {
+    if (typeof messageCls !== 'function') {
+        throw new Error('messageCls must be a function (message class)');
+    }
+    if (value === undefined || value === null) {
+        throw new Error('value cannot be null or undefined');
+    }
+    if (metricsEnabled) {
+        return measureEncode(packFlatValue, messageCls, messageCls, value);
+    }
+    return packFlatValue(messageCls, value);
+}
+
+/**
+ * packFlat的实现（不记录指标）
+ * @private
+ */
+function packFlatValue(messageCls, value) {
+    if (typeof value === 'string') {
+        value = JSON.parse(value);
+    }
+
+    const layout = getLayout(messageCls);
+    const writer = new FlatWriter(FLAT_HEADER_SIZE + layout.size * 4);
+    writer.alloc(FLAT_HEADER_SIZE, 8);
+    const root = writer.writeRecord(layout, value);
+
+    writer.view.setUint32(0, FLAT_MAGIC, true);
+    writer.view.setUint32(4, layout.hash, true);
+    writer.view.setUint32(8, root, true);
+    writer.view.setUint32(12, writer.length, true);
+    return writer.bytes.slice(0, writer.length);
+}
+
+/**
+ * 打开扁平二进制blob，返回根消息的View
+ * @param {Function} messageCls - 根消息类（flat模式生成）
+ * @param {ArrayBuffer|SharedArrayBuffer|ArrayBufferView} buffer - blob数据
+ * @returns {Object} 根消息的View实例
+ * @throws {Error} 如果blob格式或布局哈希不匹配
+ */
+export function openFlat(messageCls, buffer) {
+    if (typeof messageCls?.View?.open !== 'function') {
+        throw new Error(`'${messageCls?.name}' has no flat view (generate with the 'flat' option)`);
+    }
+    return messageCls.View.open(buffer);
+}
+
+/**
+ * 将blob复制到SharedArrayBuffer，供多个Worker共享同一份只读数据
+ * @param {Uint8Array} bytes - blob数据
+ * @returns {SharedArrayBuffer} 共享缓冲区
+ */
+export function toSharedBuffer(bytes) {
+    const shared = new SharedArrayBuffer(bytes.byteLength);
+    new Uint8Array(shared).set(bytes);
+    return shared;
+}
@@ -0,0 +1,473 @@
+/**
+ * 帧格式的二进制消息流（framing模式）。
+ * 套接字上多条消息首尾相接，每帧为8字节头部（小端）加消息体：
+ *   uint32 消息体长度、uint16 模块ID、uint16 消息ID，消息体为UTF-8 JSON。
+ * 模块ID与消息ID来自proto中的(module_id)/(message_id)选项，由生成代码写入__descriptor。
+ * correlated模式的头部为12字节，在消息ID之后追加uint32关联ID，用于请求/响应配对（见proto-rpc.mjs）。
+ *
+ * FrameWriter把头部与消息体直接编码进同一块复用的缓冲区；
+ * FrameReader按块消费输入，跨块保留不完整的帧，完整的帧直接在输入块的subarray视图上解码，不复制。
+ */
+
+import { toJson, fromJson } from './proto.mjs';
+
+export const FRAME_HEADER_SIZE = 8;
+export const CORRELATED_FRAME_HEADER_SIZE = 12;
+
+const MAX_FRAME_ID = 0xffff;
+const DEFAULT_MAX_FRAME_SIZE = 16 * 1024 * 1024;
+
+const textEncoder = new TextEncoder();
+const textDecoder = new TextDecoder();
+
+/**
+ * 获取消息类的帧ID
+ * @private
+ * @param {Function} messageCls - 消息类
+ * @returns {{moduleId: number, messageId: number}} 帧ID
+ * @throws {Error} 如果消息类没有消息ID
+ */
+function getFrameIds(messageCls) {
+    const desc = messageCls?.__descriptor;
+    if (desc?.messageId === undefined) {
+        throw new Error(`'${messageCls?.name}' has no message id (generate with the 'framing' option)`);
+    }
+    return desc;
+}
+
+/**
+ * 帧ID组合为查找键
+ * @private
+ */
+function frameKey(moduleId, messageId) {
+    return moduleId * 0x10000 + messageId;
+}
+
+/**
+ * 默认的消息体解码：UTF-8 JSON
+ * @private
+ * @param {Function} messageCls - 消息类
+ * @param {Uint8Array} body - 消息体视图
+ * @returns {Object} 消息实例
+ */
+function decodeJsonBody(messageCls, body) {
+    return fromJson(messageCls, textDecoder.decode(body));
+}
+
+/**
+ * 帧ID到消息类的映射。不同模块的消息ID可以重复，按(模块ID, 消息ID)区分。
+ */
+export class FrameTypes {
+    /**
+     * @param {...(Function|Function[]|Object)} sources - 消息类、消息类数组或生成模块的命名空间
+     */
+    constructor(...sources) {
+        this.__types = new Map();
+        for (const source of sources) {
+            this.add(source);
+        }
+    }
+
+    /**
+     * 注册消息类；模块命名空间中没有消息ID的导出会被忽略
+     * @param {Function|Function[]|Object} source - 消息类、消息类数组或生成模块的命名空间
+     * @returns {FrameTypes} this
+     * @throws {Error} 如果帧ID越界或与已注册的其他消息类冲突
+     */
+    add(source) {
+        if (typeof source === 'function') {
+            const { moduleId, messageId } = getFrameIds(source);
+            if (!(moduleId >= 0 && moduleId <= MAX_FRAME_ID && messageId >= 0 && messageId <= MAX_FRAME_ID)) {
+                throw new Error(`Frame id ${moduleId}:${messageId} of '${source.name}' out of range`);
+            }
+            const key = frameKey(moduleId, messageId);
+            const existing = this.__types.get(key);
+            if (existing !== undefined && existing !== source) {
+                throw new Error(`Frame id ${moduleId}:${messageId} used by both '${existing.name}' and '${source.name}'`);
+            }
+            this.__types.set(key, source);
+        } else if (Array.isArray(source)) {
+            for (const messageCls of source) {
+                this.add(messageCls);
+            }
+        } else if (source !== null && typeof source === 'object') {
+            for (const value of Object.values(source)) {
+                if (typeof value === 'function' && value.__descriptor?.messageId !== undefined) {
+                    this.add(value);
+                }
+            }
+        }
+        return this;
+    }
+
+    /**
+     * 按帧ID查找消息类
+     * @param {number} moduleId - 模块ID
+     * @param {number} messageId - 消息ID
+     * @returns {Function|undefined} 消息类
+     */
+    get(moduleId, messageId) {
+        return this.__types.get(frameKey(moduleId, messageId));
+    }
+}
+
+/**
+ * 帧写入器：多条消息依次编码进同一块缓冲区，flush()一次取出。
+ * 取出的缓冲区用完（如套接字写入回调之后）交回release()，供之后的flush复用，避免逐帧分配。
+ */
+export class FrameWriter {
+    /**
+     * @param {Object} [options]
+     * @param {number} [options.initialSize=4096] - 缓冲区初始字节数
+     * @param {number} [options.poolSize=4] - 最多保留的空闲缓冲区数
+     * @param {boolean} [options.correlated=false] - 头部是否带关联ID
+     */
+    constructor(options = {}) {
+        this.__headerSize = options.correlated ? CORRELATED_FRAME_HEADER_SIZE : FRAME_HEADER_SIZE;
+        this.__initialSize = options.initialSize ?? 4096;
+        this.__poolSize = options.poolSize ?? 4;
+        this.__pool = [];
+        this.__bytes = new Uint8Array(this.__initialSize);
+        this.__view = new DataView(this.__bytes.buffer);
+        this.__length = 0;
+    }
+
+    /** @type {number} 尚未取出的字节数 */
+    get length() {
+        return this.__length;
+    }
+
+    /**
+     * 追加一帧。passthrough生成选项下，解码后未修改的消息直接写出其原始JSON文本
+     * @param {Object} message - 生成的消息实例（消息类须有消息ID）
+     * @param {number} [correlationId=0] - 关联ID（correlated模式）
+     * @returns {FrameWriter} this
+     * @throws {Error} 如果消息类没有消息ID
+     */
+    write(message, correlationId = 0) {
+        const { moduleId, messageId } = getFrameIds(message?.constructor);
+        const json = toJson(message);
+
+        // UTF-16码元最多编码为3个UTF-8字节
+        this.__reserve(this.__headerSize + json.length * 3);
+        const start = this.__length;
+        const { written } = textEncoder.encodeInto(json, this.__bytes.subarray(start + this.__headerSize));
+        this.__view.setUint32(start, written, true);
+        this.__view.setUint16(start + 4, moduleId, true);
+        this.__view.setUint16(start + 6, messageId, true);
+        if (this.__headerSize === CORRELATED_FRAME_HEADER_SIZE) {
+            this.__view.setUint32(start + 8, correlationId, true);
+        }
+        this.__length = start + this.__headerSize + written;
+        return this;
+    }
+
+    /**
+     * 取出已写入的全部帧，之后的写入使用另一块缓冲区
+     * @returns {Uint8Array} 帧数据（缓冲区视图），用完后可交回release()
+     */
+    flush() {
+        const frames = this.__bytes.subarray(0, this.__length);
+        const buffer = this.__pool.pop() ?? new ArrayBuffer(this.__bytes.byteLength);
+        this.__bytes = new Uint8Array(buffer);
+        this.__view = new DataView(buffer);
+        this.__length = 0;
+        return frames;
+    }
+
+    /**
+     * 交回flush()取出的帧数据，其缓冲区供之后复用
+     * @param {Uint8Array} frames - flush()的返回值，交回后不得再使用
+     */
+    release(frames) {
+        if (this.__pool.length < this.__poolSize && frames.buffer.byteLength === this.__bytes.byteLength) {
+            this.__pool.push(frames.buffer);
+        }
+    }
+
+    /**
+     * 确保缓冲区在当前位置之后还有size字节；扩容时丢弃大小不再匹配的空闲缓冲区
+     * @private
+     */
+    __reserve(size) {
+        const required = this.__length + size;
+        if (required <= this.__bytes.byteLength) return;
+
+        let capacity = this.__bytes.byteLength * 2;
+        while (capacity < required) capacity *= 2;
+        const bytes = new Uint8Array(capacity);
+        bytes.set(this.__bytes.subarray(0, this.__length));
+        this.__bytes = bytes;
+        this.__view = new DataView(bytes.buffer);
+        this.__pool.length = 0;
+    }
+}
+
+/**
+ * 帧读取器：按块消费字节流并解码完整的帧。
+ * 完全落在一个输入块内的帧直接在该块的subarray视图上解码；只有跨块的帧才复制到内部缓冲区。
+ * 解码在push()内同步完成，push返回后输入块可被复用。
+ * correlated模式下push返回{correlationId, message}条目而非消息本身。
+ */
+export class FrameReader {
+    /**
+     * @param {FrameTypes|Function[]|Object} types - 帧ID映射，或传给FrameTypes的消息类/模块
+     * @param {Object} [options]
+     * @param {number} [options.maxFrameSize=16777216] - 消息体长度上限，超出视为流损坏
+     * @param {function(Function, Uint8Array): Object} [options.decodeBody] - 消息体解码函数，默认UTF-8 JSON
+     * @param {function(number, number, Uint8Array, number): void} [options.onUnknown] - 未注册帧ID的处理函数（参数含关联ID），默认抛出异常
+     * @param {boolean} [options.correlated=false] - 头部是否带关联ID
+     */
+    constructor(types, options = {}) {
+        this.__types = types instanceof FrameTypes ? types : new FrameTypes(types);
+        this.__headerSize = options.correlated ? CORRELATED_FRAME_HEADER_SIZE : FRAME_HEADER_SIZE;
+        this.__maxFrameSize = options.maxFrameSize ?? DEFAULT_MAX_FRAME_SIZE;
+        this.__decodeBody = options.decodeBody ?? decodeJsonBody;
+        this.__onUnknown = options.onUnknown;
+        this.__pending = new Uint8Array(this.__headerSize);
+        this.__pendingLength = 0;
+    }
+
+    /** @type {number} 缓存的不完整帧字节数 */
+    get pendingLength() {
+        return this.__pendingLength;
+    }
+
+    /**
+     * 消费一块输入
+     * @param {Uint8Array} chunk - 输入字节
+     * @returns {Object[]} 本块补齐的所有帧解码出的消息（correlated模式为{correlationId, message}），按流中顺序
+     * @throws {Error} 如果帧ID未注册（未指定onUnknown）或消息体超过长度上限
+     */
+    push(chunk) {
+        const messages = [];
+        let offset = 0;
+
+        // 先补齐上一块留下的不完整帧
+        if (this.__pendingLength > 0) {
+            offset = this.__fillPending(chunk);
+            if (this.__pendingLength < this.__headerSize || this.__pendingLength < this.__pendingFrameSize()) {
+                return messages;
+            }
+            const frameSize = this.__pendingFrameSize();
+            this.__decodeFrame(this.__pending, 0, frameSize, messages);
+            this.__pendingLength = 0;
+        }
+
+        // 完整的帧直接在输入块上解码
+        const view = new DataView(chunk.buffer, chunk.byteOffset, chunk.byteLength);
+        while (chunk.length - offset >= this.__headerSize) {
+            const frameSize = this.__headerSize + this.__checkBodyLength(view.getUint32(offset, true));
+            if (chunk.length - offset < frameSize) break;
+            this.__decodeFrame(chunk, offset, frameSize, messages);
+            offset += frameSize;
+        }
+
+        // 剩余的不完整帧复制到内部缓冲区
+        if (offset < chunk.length) {
+            this.__fillPending(chunk.subarray(offset));
+        }
+        return messages;
+    }
+
+    /**
+     * 从chunk开头向不完整帧追加字节，返回消耗的字节数
+     * @private
+     */
+    __fillPending(chunk) {
+        let consumed = 0;
+        if (this.__pendingLength < this.__headerSize) {
+            consumed = Math.min(this.__headerSize - this.__pendingLength, chunk.length);
+            this.__pending.set(chunk.subarray(0, consumed), this.__pendingLength);
+            this.__pendingLength += consumed;
+            if (this.__pendingLength < this.__headerSize) return consumed;
+        }
+
+        const frameSize = this.__pendingFrameSize();
+        if (this.__pending.length < frameSize) {
+            const pending = new Uint8Array(frameSize);
+            pending.set(this.__pending.subarray(0, this.__pendingLength));
+            this.__pending = pending;
+        }
+        const count = Math.min(frameSize - this.__pendingLength, chunk.length - consumed);
+        this.__pending.set(chunk.subarray(consumed, consumed + count), this.__pendingLength);
+        this.__pendingLength += count;
+        return consumed + count;
+    }
+
+    /**
+     * 不完整帧的总字节数（头部已完整）
+     * @private
+     */
+    __pendingFrameSize() {
+        const bodyLength = (this.__pending[0] | (this.__pending[1] << 8) | (this.__pending[2] << 16)) + this.__pending[3] * 0x1000000;
+        return this.__headerSize + this.__checkBodyLength(bodyLength);
+    }
+
+    /**
+     * @private
+     */
+    __checkBodyLength(bodyLength) {
+        if (bodyLength > this.__maxFrameSize) {
+            throw new Error(`Frame body of ${bodyLength} bytes exceeds maxFrameSize ${this.__maxFrameSize}`);
+        }
+        return bodyLength;
+    }
+
+    /**
+     * 解码bytes[offset, offset + frameSize)处的一帧
+     * @private
+     */
+    __decodeFrame(bytes, offset, frameSize, messages) {
+        const moduleId = bytes[offset + 4] | (bytes[offset + 5] << 8);
+        const messageId = bytes[offset + 6] | (bytes[offset + 7] << 8);
+        const correlated = this.__headerSize === CORRELATED_FRAME_HEADER_SIZE;
+        const correlationId = correlated ?
+            (bytes[offset + 8] | (bytes[offset + 9] << 8) | (bytes[offset + 10] << 16)) + bytes[offset + 11] * 0x1000000 : 0;
+        const body = bytes.subarray(offset + this.__headerSize, offset + frameSize);
+        const messageCls = this.__types.get(moduleId, messageId);
+        if (messageCls === undefined) {
+            if (this.__onUnknown === undefined) {
+                throw new Error(`Unknown frame id ${moduleId}:${messageId}`);
+            }
+            this.__onUnknown(moduleId, messageId, body, correlationId);
+            return;
+        }
+        const message = this.__decodeBody(messageCls, body);
+        messages.push(correlated ? { correlationId, message } : message);
+    }
+}
+
+/**
+ * 从异步可迭代的字节流（如Node套接字、ReadableStream）读取消息。
+ * 拉取式背压：消费方处理完当前消息之前不会读取下一块输入。
+ * @param {AsyncIterable<Uint8Array>} source - 输入字节块
+ * @param {FrameTypes|Function[]|Object} types - 帧ID映射，或传给FrameTypes的消息类/模块
+ * @param {Object} [options] - FrameReader选项
+ * @yields {Object} 消息实例
+ * @throws {Error} 如果流在帧中间结束
+ */
+export async function* readFrames(source, types, options) {
+    const reader = new FrameReader(types, options);
+    for await (const chunk of source) {
+        yield* reader.push(chunk);
+    }
+    if (reader.pendingLength > 0) {
+        throw new Error(`Stream ended inside a frame (${reader.pendingLength} bytes pending)`);
+    }
+}
+
+/**
+ * 推送式帧队列，用于基于事件的输入（如WebSocket的message事件）。
+ * write()返回false表示已缓存的消息达到highWaterMark，应暂停输入直到drained()完成；
+ * 消费方通过for await读取消息。
+ */
+export class FrameQueue {
+    /**
+     * @param {FrameTypes|Function[]|Object} types - 帧ID映射，或传给FrameTypes的消息类/模块
+     * @param {Object} [options] - FrameReader选项，以及：
+     * @param {number} [options.highWaterMark=64] - 暂停输入前最多缓存的消息数
+     */
+    constructor(types, options = {}) {
+        this.__reader = new FrameReader(types, options);
+        this.__highWaterMark = options.highWaterMark ?? 64;
+        this.__messages = [];
+        this.__head = 0;
+        this.__ended = false;
+        this.__error = undefined;
+        this.__wakeReader = undefined;
+        this.__wakeWriters = [];
+    }
+
+    /** @type {number} 已缓存未读取的消息数 */
+    get size() {
+        return this.__messages.length - this.__head;
+    }
+
+    /**
+     * 写入一块输入
+     * @param {Uint8Array} chunk - 输入字节
+     * @returns {boolean} 缓存的消息是否仍低于highWaterMark
+     */
+    write(chunk) {
+        if (this.__ended) {
+            throw new Error('Cannot write to an ended FrameQueue');
+        }
+        try {
+            for (const message of this.__reader.push(chunk)) {
+                this.__messages.push(message);
+            }
+        } catch (error) {
+            this.end(error);
+            throw error;
+        }
+        this.__wake();
+        return this.size < this.__highWaterMark;
+    }
+
+    /**
+     * 结束输入；之后读完缓存的消息即结束迭代
+     * @param {Error} [error] - 输入出错时传入，读完缓存后抛给消费方
+     */
+    end(error) {
+        if (this.__ended) return;
+        this.__ended = true;
+        if (error === undefined && this.__reader.pendingLength > 0) {
+            error = new Error(`Stream ended inside a frame (${this.__reader.pendingLength} bytes pending)`);
+        }
+        this.__error = error;
+        this.__wake();
+        this.__wakeAllWriters();
+    }
+
+    /**
+     * 等待缓存的消息降到highWaterMark以下
+     * @returns {Promise<void>}
+     */
+    drained() {
+        if (this.size < this.__highWaterMark || this.__ended) {
+            return Promise.resolve();
+        }
+        return new Promise(resolve => this.__wakeWriters.push(resolve));
+    }
+
+    async *[Symbol.asyncIterator]() {
+        for (;;) {
+            if (this.__head < this.__messages.length) {
+                const message = this.__messages[this.__head];
+                this.__messages[this.__head++] = undefined;
+                if (this.__head === this.__messages.length) {
+                    this.__messages.length = 0;
+                    this.__head = 0;
+                }
+                if (this.size < this.__highWaterMark) {
+                    this.__wakeAllWriters();
+                }
+                yield message;
+            } else if (this.__ended) {
+                if (this.__error !== undefined) throw this.__error;
+                return;
+            } else {
+                await new Promise(resolve => { this.__wakeReader = resolve; });
+            }
+        }
+    }
+
+    /**
+     * @private
+     */
+    __wake() {
+        const wake = this.__wakeReader;
+        this.__wakeReader = undefined;
+        wake?.();
+    }
+
+    /**
+     * @private
+     */
+    __wakeAllWriters() {
+        const writers = this.__wakeWriters;
+        this.__wakeWriters = [];
+        for (const resolve of writers) resolve();
+    }
+}
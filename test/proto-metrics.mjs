@@ -0,0 +1,169 @@
+/**
+ * 编解码运行时指标。
+ * 开启后，toJson/fromJson/fromJsonValidated/packFlat等入口按消息类型累计消息数、负载大小、耗时，
+ * 并记录负载大小的直方图（按2的幂分桶）；可通过snapshot()读取，
+ * 或以performance.measure条目的形式交给Node perf_hooks的PerformanceObserver。
+ * 关闭时（默认），各入口只多一次对metricsEnabled的判断。
+ */
+
+/** 负载大小直方图的桶数：桶k统计大小在[2^(k-1), 2^k)之间的负载，桶0统计大小为0的负载 */
+const HISTOGRAM_BUCKETS = 33;
+
+/**
+ * 是否开启指标收集（只读的实时绑定，通过enableMetrics/disableMetrics修改）
+ * @type {boolean}
+ */
+export let metricsEnabled = false;
+
+/** @type {boolean} 是否同时产生performance.measure条目 */
+let measureEnabled = false;
+
+/** @type {Map<Function, TypeMetrics>} 消息类 -> 指标 */
+const typeMetrics = new Map();
+
+/**
+ * 单个方向（编码或解码）的计数器
+ * @private
+ */
+class CodecCounters {
+    count = 0;
+    bytes = 0;
+    time = 0;
+    histogram = new Uint32Array(HISTOGRAM_BUCKETS);
+
+    record(size, elapsed) {
+        this.count++;
+        this.bytes += size;
+        this.time += elapsed;
+        this.histogram[32 - Math.clz32(size)]++;
+    }
+
+    snapshot() {
+        const histogram = [];
+        for (let i = 0; i < HISTOGRAM_BUCKETS; i++) {
+            if (this.histogram[i] !== 0) {
+                // le: 桶内负载大小的上界（不含）
+                histogram.push({ le: i === 0 ? 1 : 2 ** i, count: this.histogram[i] });
+            }
+        }
+        return { count: this.count, bytes: this.bytes, time: this.time, histogram };
+    }
+}
+
+/**
+ * 单个消息类型的指标
+ * @private
+ */
+class TypeMetrics {
+    constructor(name) {
+        this.name = name;
+        this.encode = new CodecCounters();
+        this.decode = new CodecCounters();
+    }
+}
+
+/**
+ * 获取消息类的指标，首次使用时创建
+ * @private
+ */
+function getTypeMetrics(messageCls) {
+    let metrics = typeMetrics.get(messageCls);
+    if (metrics === undefined) {
+        metrics = new TypeMetrics(messageCls.__descriptor?.fullName ?? messageCls.name);
+        typeMetrics.set(messageCls, metrics);
+    }
+    return metrics;
+}
+
+/**
+ * 记录一次编码或解码
+ * @private
+ */
+function record(kind, messageCls, size, start) {
+    const end = performance.now();
+    const metrics = getTypeMetrics(messageCls);
+    metrics[kind].record(size, end - start);
+    if (measureEnabled) {
+        performance.measure(`protobuf.${kind} ${metrics.name}`, {
+            start,
+            end,
+            detail: { type: metrics.name, bytes: size },
+        });
+    }
+}
+
+/**
+ * 开启指标收集
+ * @param {Object} [options] - 选项
+ * @param {boolean} [options.measure=false] - 为每次编解码产生performance.measure条目
+ *     （名称为'protobuf.encode <全名>'或'protobuf.decode <全名>'，detail含type和bytes），
+ *     可用perf_hooks的PerformanceObserver({entryTypes: ['measure']})订阅
+ */
+export function enableMetrics(options) {
+    metricsEnabled = true;
+    measureEnabled = options?.measure === true;
+}
+
+/**
+ * 关闭指标收集（已收集的数据保留，可继续snapshot()）
+ */
+export function disableMetrics() {
+    metricsEnabled = false;
+    measureEnabled = false;
+}
+
+/**
+ * 清空已收集的指标
+ */
+export function resetMetrics() {
+    typeMetrics.clear();
+}
+
+/**
+ * 读取当前指标的副本
+ * @returns {Object<string, {encode: Object, decode: Object}>} 消息全名 -> 编码/解码指标，
+ *     每个方向为{count, bytes, time, histogram}，time为累计毫秒数，
+ *     histogram为非空桶的[{le, count}]，bytes和le的单位为负载大小（JSON为字符数，二进制为字节数）
+ */
+export function snapshot() {
+    const result = {};
+    for (const metrics of typeMetrics.values()) {
+        result[metrics.name] = {
+            encode: metrics.encode.snapshot(),
+            decode: metrics.decode.snapshot(),
+        };
+    }
+    return result;
+}
+
+/**
+ * 执行并记录一次编码，负载大小取结果的length（字符串为字符数，字节为字节数）
+ * @param {Function} encode - 编码函数，以(a, b)调用
+ * @param {Function} messageCls - 计入指标的消息类
+ * @param {any} a - 传给编码函数的参数
+ * @param {any} [b] - 传给编码函数的参数
+ * @returns {string|Uint8Array} 编码结果
+ */
+export function measureEncode(encode, messageCls, a, b) {
+    const start = performance.now();
+    const result = encode(a, b);
+    record('encode', messageCls, result.length, start);
+    return result;
+}
+
+/**
+ * 执行并记录一次解码，输入为字符串或字节时负载大小取其长度，已解析的对象记为0
+ * @param {Function} decode - 解码函数，以(messageCls, input, a, b)调用
+ * @param {Function} messageCls - 消息类
+ * @param {any} input - JSON字符串、字节或已解析的JSON对象
+ * @param {any} [a] - 传给解码函数的额外参数
+ * @param {any} [b] - 传给解码函数的额外参数
+ * @returns {Object} 消息实例
+ */
+export function measureDecode(decode, messageCls, input, a, b) {
+    const start = performance.now();
+    const result = decode(messageCls, input, a, b);
+    const size = typeof input === 'string' ? input.length : ArrayBuffer.isView(input) ? input.byteLength : 0;
+    record('decode', messageCls, size, start);
+    return result;
+}
@@ -0,0 +1,507 @@
+/**
+ * 运行时反射。
+ * 使用embed_descriptors选项生成的模块会导出__fileDescriptor（base64编码的FileDescriptorProto），
+ * 本模块按需解码这些描述符并建立类型索引，无需解析.proto源文本，也不读取任何文件。
+ * 描述符在第一次查找时才解码，未使用反射的程序不产生任何开销。
+ */
+
+const TYPE_NAMES = [
+    undefined, 'TYPE_DOUBLE', 'TYPE_FLOAT', 'TYPE_INT64', 'TYPE_UINT64', 'TYPE_INT32',
+    'TYPE_FIXED64', 'TYPE_FIXED32', 'TYPE_BOOL', 'TYPE_STRING', 'TYPE_GROUP', 'TYPE_MESSAGE',
+    'TYPE_BYTES', 'TYPE_UINT32', 'TYPE_ENUM', 'TYPE_SFIXED32', 'TYPE_SFIXED64', 'TYPE_SINT32',
+    'TYPE_SINT64',
+];
+
+const LABEL_NAMES = [undefined, 'LABEL_OPTIONAL', 'LABEL_REQUIRED', 'LABEL_REPEATED'];
+
+const textDecoder = new TextDecoder();
+
+/**
+ * 将base64文本解码为字节
+ * @private
+ * @param {string} data - base64文本
+ * @returns {Uint8Array} 字节数据
+ */
+function decodeBase64(data) {
+    if (typeof Buffer === 'function') {
+        const buffer = Buffer.from(data, 'base64');
+        return new Uint8Array(buffer.buffer, buffer.byteOffset, buffer.byteLength);
+    }
+    const text = atob(data);
+    const bytes = new Uint8Array(text.length);
+    for (let i = 0; i < text.length; i++) {
+        bytes[i] = text.charCodeAt(i);
+    }
+    return bytes;
+}
+
+/**
+ * 仅覆盖descriptor.proto所需子集的wire格式读取器
+ * @private
+ */
+class WireReader {
+    constructor(bytes, start = 0, end = bytes.length) {
+        this.bytes = bytes;
+        this.pos = start;
+        this.end = end;
+    }
+
+    // 读取varint的低32位（descriptor.proto中的整数字段都是int32/enum/bool）
+    int32() {
+        let value = 0;
+        let shift = 0;
+        let byte;
+        do {
+            if (this.pos >= this.end) {
+                throw new Error('Truncated varint in file descriptor');
+            }
+            byte = this.bytes[this.pos++];
+            if (shift < 32) value |= (byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        return value | 0;
+    }
+
+    // 读取长度前缀的子区间，返回[start, end]
+    span() {
+        const length = this.int32() >>> 0;
+        const start = this.pos;
+        this.pos += length;
+        if (this.pos > this.end) {
+            throw new Error('Truncated length-delimited field in file descriptor');
+        }
+        return [start, this.pos];
+    }
+
+    string() {
+        const [start, end] = this.span();
+        return textDecoder.decode(this.bytes.subarray(start, end));
+    }
+
+    // 以子读取器读取嵌套消息
+    message(decode) {
+        const [start, end] = this.span();
+        return decode(new WireReader(this.bytes, start, end));
+    }
+
+    skip(wireType) {
+        switch (wireType) {
+            case 0: this.int32(); break;
+            case 1: this.pos += 8; break;
+            case 2: this.span(); break;
+            case 5: this.pos += 4; break;
+            default:
+                throw new Error(`Unsupported wire type ${wireType} in file descriptor`);
+        }
+    }
+
+    // 读取选项等不解析的子消息，保留原始字节
+    raw() {
+        const [start, end] = this.span();
+        return this.bytes.subarray(start, end);
+    }
+}
+
+function decodeEnumValue(reader) {
+    const value = { name: '', number: 0 };
+    while (reader.pos < reader.end) {
+        const tag = reader.int32();
+        switch (tag >>> 3) {
+            case 1: value.name = reader.string(); break;
+            case 2: value.number = reader.int32(); break;
+            default: reader.skip(tag & 7); break;
+        }
+    }
+    return value;
+}
+
+function decodeEnum(reader) {
+    const enumType = { kind: 'enum', name: '', fullName: '', values: [], options: undefined };
+    while (reader.pos < reader.end) {
+        const tag = reader.int32();
+        switch (tag >>> 3) {
+            case 1: enumType.name = reader.string(); break;
+            case 2: enumType.values.push(reader.message(decodeEnumValue)); break;
+            case 3: enumType.options = reader.raw(); break;
+            default: reader.skip(tag & 7); break;
+        }
+    }
+    return enumType;
+}
+
+function decodeField(reader) {
+    const field = {
+        name: '',
+        number: 0,
+        label: 'LABEL_OPTIONAL',
+        type: undefined,
+        typeName: undefined,
+        extendee: undefined,
+        defaultValue: undefined,
+        oneofIndex: undefined,
+        jsonName: undefined,
+        proto3Optional: false,
+        options: undefined,
+    };
+    while (reader.pos < reader.end) {
+        const tag = reader.int32();
+        switch (tag >>> 3) {
+            case 1: field.name = reader.string(); break;
+            case 2: field.extendee = reader.string(); break;
+            case 3: field.number = reader.int32(); break;
+            case 4: field.label = LABEL_NAMES[reader.int32()]; break;
+            case 5: field.type = TYPE_NAMES[reader.int32()]; break;
+            case 6: field.typeName = reader.string(); break;
+            case 7: field.defaultValue = reader.string(); break;
+            case 8: field.options = reader.raw(); break;
+            case 9: field.oneofIndex = reader.int32(); break;
+            case 10: field.jsonName = reader.string(); break;
+            case 17: field.proto3Optional = reader.int32() !== 0; break;
+            default: reader.skip(tag & 7); break;
+        }
+    }
+    return field;
+}
+
+// MessageOptions中的map_entry（字段7）
+function isMapEntry(options) {
+    const reader = new WireReader(options);
+    let mapEntry = false;
+    while (reader.pos < reader.end) {
+        const tag = reader.int32();
+        if (tag === (7 << 3)) {
+            mapEntry = reader.int32() !== 0;
+        } else {
+            reader.skip(tag & 7);
+        }
+    }
+    return mapEntry;
+}
+
+function decodeOneof(reader) {
+    let name = '';
+    while (reader.pos < reader.end) {
+        const tag = reader.int32();
+        if ((tag >>> 3) === 1) {
+            name = reader.string();
+        } else {
+            reader.skip(tag & 7);
+        }
+    }
+    return name;
+}
+
+function decodeMessage(reader) {
+    const type = {
+        kind: 'message',
+        name: '',
+        fullName: '',
+        fields: [],
+        oneofs: [],
+        nestedTypes: [],
+        enumTypes: [],
+        extensions: [],
+        mapEntry: false,
+        options: undefined,
+    };
+    while (reader.pos < reader.end) {
+        const tag = reader.int32();
+        switch (tag >>> 3) {
+            case 1: type.name = reader.string(); break;
+            case 2: type.fields.push(reader.message(decodeField)); break;
+            case 3: type.nestedTypes.push(reader.message(decodeMessage)); break;
+            case 4: type.enumTypes.push(reader.message(decodeEnum)); break;
+            case 6: type.extensions.push(reader.message(decodeField)); break;
+            case 7:
+                type.options = reader.raw();
+                type.mapEntry = isMapEntry(type.options);
+                break;
+            case 8: type.oneofs.push(reader.message(decodeOneof)); break;
+            default: reader.skip(tag & 7); break;
+        }
+    }
+    return type;
+}
+
+/**
+ * 解码序列化的FileDescriptorProto
+ * @param {Uint8Array|string} data - 字节数据或其base64文本
+ * @returns {Object} 文件描述：{name, package, dependencies, syntax, messageTypes, enumTypes, extensions, options}
+ * @throws {Error} 如果数据不是合法的FileDescriptorProto
+ */
+export function decodeFileDescriptor(data) {
+    const bytes = typeof data === 'string' ? decodeBase64(data) : data;
+    const reader = new WireReader(bytes);
+    const file = {
+        name: '',
+        package: '',
+        dependencies: [],
+        syntax: 'proto2',
+        messageTypes: [],
+        enumTypes: [],
+        extensions: [],
+        options: undefined,
+    };
+    while (reader.pos < reader.end) {
+        const tag = reader.int32();
+        switch (tag >>> 3) {
+            case 1: file.name = reader.string(); break;
+            case 2: file.package = reader.string(); break;
+            case 3: file.dependencies.push(reader.string()); break;
+            case 4: file.messageTypes.push(reader.message(decodeMessage)); break;
+            case 5: file.enumTypes.push(reader.message(decodeEnum)); break;
+            case 7: file.extensions.push(reader.message(decodeField)); break;
+            case 8: file.options = reader.raw(); break;
+            case 12: file.syntax = reader.string(); break;
+            default: reader.skip(tag & 7); break;
+        }
+    }
+    return file;
+}
+
+/**
+ * 去掉全名开头的'.'
+ * @private
+ */
+function normalizeName(fullName) {
+    return fullName.charCodeAt(0) === 46 ? fullName.slice(1) : fullName;
+}
+
+/**
+ * 反射根：收集嵌入的文件描述符，并在第一次查找时解码和建立索引
+ */
+export class ReflectionRoot {
+    /** @type {Map<string, Object>} 文件名 -> 嵌入的描述符（尚未解码） */
+    #pending = new Map();
+    /** @type {Map<string, Object>} 文件名 -> 嵌入的描述符 */
+    #embedded = new Map();
+    /** @type {Map<string, Object>} 文件名 -> 解码后的文件描述 */
+    #files = new Map();
+    /** @type {Map<string, Object>} 全名 -> 消息/枚举描述 */
+    #types = new Map();
+    /** @type {WeakSet<Function>} 已收集过的消息类 */
+    #classes = new WeakSet();
+
+    /**
+     * 添加一个嵌入的文件描述符（生成模块导出的__fileDescriptor），仅登记不解码
+     * @param {{name: string, dependencies: string[], data: string}} fileDescriptor - 嵌入的描述符
+     * @returns {ReflectionRoot} this
+     */
+    add(fileDescriptor) {
+        if (typeof fileDescriptor?.name !== 'string' || typeof fileDescriptor.data !== 'string') {
+            throw new Error('Invalid embedded file descriptor (generate with the \'embed_descriptors\' option)');
+        }
+        if (!this.#embedded.has(fileDescriptor.name)) {
+            this.#embedded.set(fileDescriptor.name, fileDescriptor);
+            this.#pending.set(fileDescriptor.name, fileDescriptor);
+        }
+        return this;
+    }
+
+    /**
+     * 添加消息类及其字段引用到的所有类型所在文件的描述符
+     * @param {Function} messageCls - 消息类（embed_descriptors模式生成）
+     * @returns {ReflectionRoot} this
+     * @throws {Error} 如果类没有嵌入的描述符
+     */
+    addClass(messageCls) {
+        if (this.#classes.has(messageCls)) {
+            return this;
+        }
+        const stack = [messageCls];
+        while (stack.length > 0) {
+            const cls = stack.pop();
+            if (this.#classes.has(cls)) continue;
+            this.#classes.add(cls);
+
+            const descriptor = cls.__descriptor;
+            if (descriptor?.file === undefined) {
+                throw new Error(`'${descriptor?.fullName ?? cls.name}' has no embedded descriptor (generate with the 'embed_descriptors' option)`);
+            }
+            this.add(descriptor.file);
+            for (const field of descriptor.fields ?? []) {
+                const fieldType = field.clrType;
+                if (fieldType?.__descriptor !== undefined && !this.#classes.has(fieldType)) {
+                    stack.push(fieldType);
+                }
+            }
+        }
+        return this;
+    }
+
+    /**
+     * 解码所有已登记但尚未解码的文件并建立索引
+     * @private
+     */
+    #decodePending() {
+        for (const [name, embedded] of this.#pending) {
+            const file = decodeFileDescriptor(embedded.data);
+            const prefix = file.package ? `${file.package}.` : '';
+            for (const type of file.messageTypes) this.#index(type, prefix, name);
+            for (const type of file.enumTypes) this.#index(type, prefix, name);
+            this.#files.set(name, file);
+        }
+        this.#pending.clear();
+    }
+
+    #index(type, prefix, fileName) {
+        type.fullName = prefix + type.name;
+        type.file = fileName;
+        this.#types.set(type.fullName, type);
+        if (type.kind === 'message') {
+            const nestedPrefix = `${type.fullName}.`;
+            for (const nested of type.nestedTypes) this.#index(nested, nestedPrefix, fileName);
+            for (const nested of type.enumTypes) this.#index(nested, nestedPrefix, fileName);
+        }
+    }
+
+    /**
+     * 按全名查找类型，必要时先解码已登记的文件
+     * @private
+     */
+    #lookup(fullName) {
+        const name = normalizeName(fullName);
+        let type = this.#types.get(name);
+        if (type === undefined && this.#pending.size > 0) {
+            this.#decodePending();
+            type = this.#types.get(name);
+        }
+        return type;
+    }
+
+    /**
+     * 查找消息类型
+     * @param {string} fullName - 全名（如'pokeworld.actor.cfg.Player'，可带前导'.'）
+     * @returns {Object} 消息描述：{name, fullName, file, fields, oneofs, nestedTypes, enumTypes, mapEntry, options}
+     * @throws {Error} 如果类型不存在
+     */
+    lookupType(fullName) {
+        const type = this.#lookup(fullName);
+        if (type?.kind !== 'message') {
+            throw new Error(`Message type '${normalizeName(fullName)}' not found in reflection root`);
+        }
+        return type;
+    }
+
+    /**
+     * 查找枚举类型
+     * @param {string} fullName - 全名（可带前导'.'）
+     * @returns {Object} 枚举描述：{name, fullName, file, values, options}
+     * @throws {Error} 如果枚举不存在
+     */
+    lookupEnum(fullName) {
+        const type = this.#lookup(fullName);
+        if (type?.kind !== 'enum') {
+            throw new Error(`Enum type '${normalizeName(fullName)}' not found in reflection root`);
+        }
+        return type;
+    }
+
+    /**
+     * 解析消息或枚举字段引用的类型
+     * @param {Object} field - 字段描述（lookupType返回的fields元素）
+     * @returns {Object|undefined} 消息/枚举描述，标量字段返回undefined
+     * @throws {Error} 如果引用的类型所在文件未添加到反射根
+     */
+    resolveType(field) {
+        if (field.typeName === undefined) {
+            return undefined;
+        }
+        const type = this.#lookup(field.typeName);
+        if (type === undefined) {
+            throw new Error(`Type '${normalizeName(field.typeName)}' of field '${field.name}' not found (its file is not in the reflection root)`);
+        }
+        return type;
+    }
+
+    /**
+     * 获取解码后的文件描述
+     * @param {string} name - 文件名（如'pokeworld/actor/cfg_actor.proto'）
+     * @returns {Object|undefined} 文件描述
+     */
+    getFile(name) {
+        if (this.#pending.has(name)) {
+            this.#decodePending();
+        }
+        return this.#files.get(name);
+    }
+
+    /**
+     * 已添加的文件名（依赖在前）
+     * @returns {string[]} 文件名列表
+     */
+    get fileNames() {
+        const ordered = [];
+        const visited = new Set();
+        const visit = (name) => {
+            if (visited.has(name)) return;
+            visited.add(name);
+            const embedded = this.#embedded.get(name);
+            if (embedded === undefined) return;
+            for (const dependency of embedded.dependencies) visit(dependency);
+            ordered.push(name);
+        };
+        for (const name of this.#embedded.keys()) visit(name);
+        return ordered;
+    }
+
+    /**
+     * 将已添加的文件编码为FileDescriptorSet，可直接交给其他protobuf实现
+     * （如protobufjs的Root.fromDescriptor）
+     * @returns {Uint8Array} FileDescriptorSet的wire格式字节
+     */
+    toFileDescriptorSet() {
+        const files = this.fileNames.map(name => decodeBase64(this.#embedded.get(name).data));
+        let size = 0;
+        for (const bytes of files) {
+            size += 1 + varintSize(bytes.length) + bytes.length;
+        }
+        const out = new Uint8Array(size);
+        let pos = 0;
+        for (const bytes of files) {
+            // FileDescriptorSet.file = 1, wire type 2
+            out[pos++] = 0x0a;
+            let length = bytes.length;
+            while (length > 0x7f) {
+                out[pos++] = (length & 0x7f) | 0x80;
+                length >>>= 7;
+            }
+            out[pos++] = length;
+            out.set(bytes, pos);
+            pos += bytes.length;
+        }
+        return out;
+    }
+}
+
+function varintSize(value) {
+    let size = 1;
+    while (value > 0x7f) {
+        value >>>= 7;
+        size++;
+    }
+    return size;
+}
+
+const defaultRoot = new ReflectionRoot();
+
+/**
+ * 获取默认反射根
+ * @returns {ReflectionRoot} 默认反射根
+ */
+export function getDefaultReflectionRoot() {
+    return defaultRoot;
+}
+
+/**
+ * 获取消息类的反射描述（使用默认反射根，自动添加其引用的所有文件）
+ * @param {Function} messageCls - 消息类（embed_descriptors模式生成）
+ * @returns {Object} 消息描述
+ * @throws {Error} 如果类没有嵌入的描述符
+ */
+export function reflect(messageCls) {
+    if (typeof messageCls !== 'function') {
+        throw new Error('messageCls must be a function (message class)');
+    }
+    return defaultRoot.addClass(messageCls).lookupType(messageCls.__descriptor.fullName);
+}
@@ -0,0 +1,382 @@
+/**
+ * 基于帧格式的请求/响应通道（client模式）。
+ * 生成的*Client存根通过RpcChannel发起调用：每个调用分配一个关联ID，多个调用可同时在途（流水线），
+ * 同一tick内发出的请求合并为一次传输层写入。RpcServer按存根的__calls分派请求并原样带回关联ID。
+ * 关联ID为0的帧是单向消息（无响应的请求、服务端推送）。
+ *
+ * 传输层接口：{ send(bytes, done), onData(handler) }
+ *   send写出一块字节，写出完成后调用done()，之后该字节所在的缓冲区会被复用；
+ *   onData注册接收回调，每块输入调用一次handler(chunk)。
+ */
+
+import { FrameWriter, FrameReader } from './proto-frame.mjs';
+
+const MAX_CORRELATION_ID = 0xffffffff;
+
+/**
+ * 校验消息类带有消息ID
+ * @private
+ * @param {Object} message - 消息实例
+ * @throws {Error} 如果消息类没有消息ID
+ */
+function checkFrameType(message) {
+    if (message?.constructor?.__descriptor?.messageId === undefined) {
+        throw new Error(`'${message?.constructor?.name}' has no message id (generate with the 'framing' option)`);
+    }
+}
+
+/**
+ * 把同一tick内的写入合并为一次传输层写入
+ * @private
+ */
+class BatchedWriter {
+    constructor(transport) {
+        this.transport = transport;
+        this.frames = new FrameWriter({ correlated: true });
+        this.scheduled = false;
+        this.writes = 0;
+    }
+
+    /**
+     * 追加一帧，在本tick结束时写出
+     */
+    write(message, correlationId) {
+        this.frames.write(message, correlationId);
+        if (!this.scheduled) {
+            this.scheduled = true;
+            queueMicrotask(() => {
+                this.scheduled = false;
+                this.flush();
+            });
+        }
+    }
+
+    /**
+     * 立即写出已追加的帧
+     */
+    flush() {
+        if (this.frames.length === 0) return;
+        const bytes = this.frames.flush();
+        this.writes++;
+        this.transport.send(bytes, () => this.frames.release(bytes));
+    }
+}
+
+/**
+ * 客户端通道：关联请求与响应，并分发服务端推送
+ */
+export class RpcChannel {
+    /**
+     * @param {{send: function(Uint8Array, function()): void, onData: function(function(Uint8Array)): void}} transport - 传输层
+     * @param {FrameTypes|Function[]|Object} types - 可接收的消息类型（传给FrameReader）
+     * @param {Object} [options]
+     * @param {boolean} [options.pipelining=true] - 是否允许多个调用同时在途并合并写入；
+     *     关闭时一次只有一个调用在途，每个请求单独写出
+     * @param {number} [options.timeout=0] - 默认调用超时毫秒数，0表示不超时
+     */
+    constructor(transport, types, options = {}) {
+        this.__writer = new BatchedWriter(transport);
+        this.__reader = new FrameReader(types, { correlated: true });
+        this.__pipelining = options.pipelining ?? true;
+        this.__timeout = options.timeout ?? 0;
+        this.__nextId = 1;
+        this.__calls = new Map();    // 关联ID -> 调用
+        this.__queue = [];           // 非流水线模式下等待发出的关联ID
+        this.__inFlight = 0;
+        this.__listeners = new Map();
+        this.__closed = false;
+        transport.onData(chunk => this.__receive(chunk));
+    }
+
+    /** @type {number} 传输层写入次数 */
+    get writes() {
+        return this.__writer.writes;
+    }
+
+    /** @type {number} 未完成的调用数（含排队中的） */
+    get pendingCount() {
+        return this.__calls.size;
+    }
+
+    /**
+     * 发起调用
+     * @param {Object} request - 请求消息
+     * @param {Function} responseType - 响应消息类
+     * @param {{timeout?: number}} [options] - 调用选项
+     * @returns {Promise<Object>} 响应消息
+     */
+    call(request, responseType, options) {
+        return new Promise((resolve, reject) => {
+            if (this.__closed) {
+                throw new Error('RpcChannel is closed');
+            }
+            checkFrameType(request);
+
+            const id = this.__nextId;
+            this.__nextId = id === MAX_CORRELATION_ID ? 1 : id + 1;
+            const call = { request, responseType, resolve, reject, timer: undefined, sent: false };
+            const timeout = options?.timeout ?? this.__timeout;
+            if (timeout > 0) {
+                call.timer = setTimeout(() => {
+                    this.__complete(id, call);
+                    reject(new Error(`Call ${request.constructor.name} timed out after ${timeout} ms`));
+                }, timeout);
+            }
+            this.__calls.set(id, call);
+
+            if (this.__pipelining || this.__inFlight === 0) {
+                this.__dispatch(id, call);
+            } else {
+                this.__queue.push(id);
+            }
+        });
+    }
+
+    /**
+     * 发送单向消息（关联ID为0，不等待响应）
+     * @param {Object} message - 消息实例
+     */
+    send(message) {
+        if (this.__closed) {
+            throw new Error('RpcChannel is closed');
+        }
+        checkFrameType(message);
+        this.__writer.write(message, 0);
+    }
+
+    /**
+     * 订阅服务端推送的消息
+     * @param {Function} messageCls - 消息类
+     * @param {function(Object): void} handler - 处理函数
+     * @returns {function(): void} 取消订阅
+     */
+    on(messageCls, handler) {
+        let handlers = this.__listeners.get(messageCls);
+        if (handlers === undefined) {
+            handlers = new Set();
+            this.__listeners.set(messageCls, handlers);
+        }
+        handlers.add(handler);
+        return () => handlers.delete(handler);
+    }
+
+    /**
+     * 关闭通道，未完成的调用以error失败
+     * @param {Error} [error] - 失败原因
+     */
+    close(error = new Error('RpcChannel closed')) {
+        if (this.__closed) return;
+        this.__closed = true;
+        const calls = [...this.__calls.values()];
+        this.__calls.clear();
+        this.__queue.length = 0;
+        for (const call of calls) {
+            clearTimeout(call.timer);
+            call.reject(error);
+        }
+    }
+
+    /**
+     * 写出请求
+     * @private
+     */
+    __dispatch(id, call) {
+        call.sent = true;
+        this.__inFlight++;
+        this.__writer.write(call.request, id);
+        if (!this.__pipelining) {
+            this.__writer.flush();
+        }
+    }
+
+    /**
+     * 移除已完成（响应或超时）的调用，并发出排队中的下一个请求
+     * @private
+     */
+    __complete(id, call) {
+        this.__calls.delete(id);
+        clearTimeout(call.timer);
+        if (!call.sent) return;
+
+        this.__inFlight--;
+        while (this.__queue.length > 0 && (this.__pipelining || this.__inFlight === 0)) {
+            const nextId = this.__queue.shift();
+            const next = this.__calls.get(nextId);
+            if (next !== undefined) {
+                this.__dispatch(nextId, next);
+            }
+        }
+    }
+
+    /**
+     * @private
+     */
+    __receive(chunk) {
+        let entries;
+        try {
+            entries = this.__reader.push(chunk);
+        } catch (error) {
+            this.close(error);
+            return;
+        }
+
+        for (const { correlationId, message } of entries) {
+            if (correlationId === 0) {
+                const handlers = this.__listeners.get(message.constructor);
+                if (handlers !== undefined) {
+                    for (const handler of handlers) handler(message);
+                }
+                continue;
+            }
+
+            // 超时后到达的响应被丢弃
+            const call = this.__calls.get(correlationId);
+            if (call === undefined) continue;
+            this.__complete(correlationId, call);
+            if (message instanceof call.responseType) {
+                call.resolve(message);
+            } else {
+                call.reject(new Error(`Expected ${call.responseType.name} for ${call.request.constructor.name}, received ${message.constructor.name}`));
+            }
+        }
+    }
+}
+
+/**
+ * 服务端：按请求类型分派，响应带回请求的关联ID
+ */
+export class RpcServer {
+    /**
+     * @param {{send: function(Uint8Array, function()): void, onData: function(function(Uint8Array)): void}} transport - 传输层
+     * @param {FrameTypes|Function[]|Object} types - 可接收的消息类型（传给FrameReader）
+     * @param {Object} [options]
+     * @param {function(Error, Object): void} [options.onError] - 处理函数失败时调用；该请求不会得到响应
+     */
+    constructor(transport, types, options = {}) {
+        this.__writer = new BatchedWriter(transport);
+        this.__reader = new FrameReader(types, { correlated: true });
+        this.__handlers = new Map();
+        this.__onError = options.onError;
+        transport.onData(chunk => this.__receive(chunk));
+    }
+
+    /** @type {number} 传输层写入次数 */
+    get writes() {
+        return this.__writer.writes;
+    }
+
+    /**
+     * 注册请求处理函数
+     * @param {Function} requestType - 请求消息类
+     * @param {function(Object): (Object|Promise<Object>|undefined)} handler - 返回响应消息，单向请求返回undefined
+     * @returns {RpcServer} this
+     */
+    handle(requestType, handler) {
+        this.__handlers.set(requestType, handler);
+        return this;
+    }
+
+    /**
+     * 按生成的*Client存根注册实现对象中的同名方法
+     * @param {Function} clientCls - 生成的客户端存根类
+     * @param {Object} implementation - 方法名与存根一致的实现对象
+     * @returns {RpcServer} this
+     */
+    implement(clientCls, implementation) {
+        for (const call of clientCls.__calls) {
+            const method = implementation[call.name];
+            if (typeof method === 'function') {
+                this.handle(call.requestType, request => method.call(implementation, request));
+            }
+        }
+        return this;
+    }
+
+    /**
+     * 推送单向消息
+     * @param {Object} message - 消息实例
+     */
+    push(message) {
+        checkFrameType(message);
+        this.__writer.write(message, 0);
+    }
+
+    /**
+     * @private
+     */
+    __receive(chunk) {
+        for (const { correlationId, message } of this.__reader.push(chunk)) {
+            const handler = this.__handlers.get(message.constructor);
+            if (handler === undefined) continue;
+
+            let result;
+            try {
+                result = handler(message);
+            } catch (error) {
+                this.__onError?.(error, message);
+                continue;
+            }
+            if (result instanceof Promise) {
+                result.then(
+                    response => this.__respond(correlationId, response),
+                    error => this.__onError?.(error, message));
+            } else {
+                this.__respond(correlationId, result);
+            }
+        }
+    }
+
+    /**
+     * @private
+     */
+    __respond(correlationId, response) {
+        if (correlationId !== 0 && response !== undefined) {
+            this.__writer.write(response, correlationId);
+        }
+    }
+}
+
+/**
+ * 进程内回环传输层的一端
+ */
+class LoopbackTransport {
+    constructor(latency) {
+        this.peer = undefined;
+        this.handlers = [];
+        this.latency = latency;
+        this.bytes = 0;
+    }
+
+    send(bytes, done) {
+        this.bytes += bytes.length;
+        const deliver = () => {
+            for (const handler of this.peer.handlers) handler(bytes);
+            done?.();
+        };
+        if (this.latency > 0) {
+            setTimeout(deliver, this.latency);
+        } else if (typeof setImmediate === 'function') {
+            setImmediate(deliver);
+        } else {
+            setTimeout(deliver, 0);
+        }
+    }
+
+    onData(handler) {
+        this.handlers.push(handler);
+    }
+}
+
+/**
+ * 创建一对相连的进程内传输层，用于测试与基准；写入在下一个事件循环迭代（或latency毫秒后）送达对端
+ * @param {Object} [options]
+ * @param {number} [options.latency=0] - 单程延迟毫秒数
+ * @returns {[LoopbackTransport, LoopbackTransport]} [客户端一端, 服务端一端]
+ */
+export function createLoopback(options = {}) {
+    const client = new LoopbackTransport(options.latency ?? 0);
+    const server = new LoopbackTransport(options.latency ?? 0);
+    client.peer = server;
+    server.peer = client;
+    return [client, server];
+}
@@ -0,0 +1,593 @@
+/**
+ * 流式JSON解码器：按块读取JSON文本，单遍扫描直接构造生成的消息实例，
+ * 不经过JSON.parse生成的中间对象树。用于体积较大的Tb*表数据文件。
+ */
+
+import { decodeWellKnownType, decodeInt64, getDefaultInternTable } from './proto.mjs';
+
+// 词法单元类型
+const TOKEN_BEGIN_OBJECT = 1;
+const TOKEN_END_OBJECT = 2;
+const TOKEN_BEGIN_ARRAY = 3;
+const TOKEN_END_ARRAY = 4;
+const TOKEN_COLON = 5;
+const TOKEN_COMMA = 6;
+const TOKEN_VALUE = 7;
+
+// 栈帧状态
+const EXPECT_FIRST_KEY = 0;   // 对象开头：键或'}'
+const EXPECT_KEY = 1;         // 逗号之后：键
+const EXPECT_COLON = 2;
+const EXPECT_VALUE = 3;
+const EXPECT_NEXT = 4;        // 值之后：','或'}'/']'
+const EXPECT_FIRST_ITEM = 5;  // 数组开头：元素或']'
+const EXPECT_ITEM = 6;        // 逗号之后：元素
+
+const NUMBER_PATTERN = /-?(?:0|[1-9]\d*)(?:\.\d+)?(?:[eE][+-]?\d+)?/y;
+
+/**
+ * 判断字符是否可能属于JSON数字
+ * @private
+ * @param {number} c - 字符编码
+ * @returns {boolean}
+ */
+function isNumberChar(c) {
+    return (c >= 0x30 && c <= 0x39) || c === 0x2e || c === 0x65 || c === 0x45 || c === 0x2b || c === 0x2d;
+}
+
+/**
+ * 创建消息实例（pool模式下从对象池获取）
+ * @private
+ * @param {Function} messageCls - 消息类
+ * @returns {Object} 消息实例
+ */
+function createMessage(messageCls) {
+    return typeof messageCls.acquire === 'function' ? messageCls.acquire() : new messageCls();
+}
+
+/**
+ * 获取消息类的字段表（字段名 -> 字段描述符），按类缓存
+ * @private
+ * @param {Function} messageCls - 消息类
+ * @returns {Map<string, Object>} 字段表
+ */
+const fieldTables = new WeakMap();
+function getFieldTable(messageCls) {
+    let table = fieldTables.get(messageCls);
+    if (table === undefined) {
+        const desc = messageCls.__descriptor;
+        if (!desc) {
+            throw new Error(`Invalid message type '${messageCls.name}' (missing __descriptor)`);
+        }
+        table = new Map(desc.fields.map(field => [field.name, field]));
+        fieldTables.set(messageCls, table);
+    }
+    return table;
+}
+
+/**
+ * 增量JSON解码器：多次调用write()输入文本块，end()结束并返回根消息实例。
+ * 指定rowField时，根消息该重复字段的元素不会保存到根实例上，
+ * 而是在解析完成后放入待取队列，由takeRows()逐批取出。
+ */
+export class JsonStreamDecoder {
+    #messageCls;
+    #rowField;
+    #internTable;
+    #textDecoder = new TextDecoder('utf-8');
+    #text = '';
+    #offset = 0;
+    #stack = [];
+    #skipDepth = 0;
+    #root = undefined;
+    #rows = [];
+
+    /**
+     * @param {Function} messageCls - 根消息类
+     * @param {Object} [options]
+     * @param {string} [options.rowField] - 逐行产出的根消息重复字段名（如'dataList'）
+     * @param {InternTable|null} [options.internTable] - 字符串驻留表，默认使用全局驻留表，null表示不驻留
+     */
+    constructor(messageCls, options = {}) {
+        if (typeof messageCls !== 'function') {
+            throw new Error('messageCls must be a function (message class)');
+        }
+        const { rowField, internTable = getDefaultInternTable() } = options;
+        if (rowField !== undefined) {
+            const field = getFieldTable(messageCls).get(rowField);
+            if (!field || field.label !== 'LABEL_REPEATED' || field.type !== 'TYPE_MESSAGE' || field.wkt !== undefined) {
+                throw new Error(`'${rowField}' is not a repeated message field of '${messageCls.name}'`);
+            }
+        }
+        this.#messageCls = messageCls;
+        this.#rowField = rowField;
+        this.#internTable = internTable;
+    }
+
+    /**
+     * 输入一块数据
+     * @param {string|Uint8Array} chunk - 文本块或UTF-8字节块（多字节字符可跨块）
+     */
+    write(chunk) {
+        const text = typeof chunk === 'string' ? chunk : this.#textDecoder.decode(chunk, { stream: true });
+        this.#text = this.#text.length === 0 ? text : this.#text + text;
+        this.#scan(false);
+    }
+
+    /**
+     * 结束输入
+     * @returns {Object} 根消息实例
+     * @throws {Error} 如果JSON不完整或格式错误
+     */
+    end() {
+        this.#text += this.#textDecoder.decode();
+        this.#scan(true);
+        if (this.#root === undefined || this.#stack.length !== 0) {
+            throw new Error('Unexpected end of JSON input');
+        }
+        return this.#root;
+    }
+
+    /**
+     * 取出已解析完成的行
+     * @returns {Object[]} 行消息实例数组（可能为空）
+     */
+    takeRows() {
+        const rows = this.#rows;
+        if (rows.length !== 0) {
+            this.#rows = [];
+        }
+        return rows;
+    }
+
+    // 扫描缓冲区中的完整词法单元，末尾不完整的部分留到下一块
+    #scan(final) {
+        const text = this.#text;
+        const length = text.length;
+        let pos = 0;
+
+        while (pos < length) {
+            const c = text.charCodeAt(pos);
+            // 空白
+            if (c === 0x20 || c === 0x0a || c === 0x0d || c === 0x09) {
+                pos++;
+                continue;
+            }
+
+            const start = pos;
+            switch (c) {
+                case 0x7b: this.#token(TOKEN_BEGIN_OBJECT, undefined, start); pos++; continue;
+                case 0x7d: this.#token(TOKEN_END_OBJECT, undefined, start); pos++; continue;
+                case 0x5b: this.#token(TOKEN_BEGIN_ARRAY, undefined, start); pos++; continue;
+                case 0x5d: this.#token(TOKEN_END_ARRAY, undefined, start); pos++; continue;
+                case 0x3a: this.#token(TOKEN_COLON, undefined, start); pos++; continue;
+                case 0x2c: this.#token(TOKEN_COMMA, undefined, start); pos++; continue;
+            }
+
+            if (c === 0x22) {
+                // 字符串：查找未被转义的结束引号
+                let end = text.indexOf('"', pos + 1);
+                while (end !== -1) {
+                    let backslashes = 0;
+                    while (text.charCodeAt(end - 1 - backslashes) === 0x5c) backslashes++;
+                    if ((backslashes & 1) === 0) break;
+                    end = text.indexOf('"', end + 1);
+                }
+                if (end === -1) break;
+                const raw = text.slice(pos + 1, end);
+                const value = raw.includes('\\') ? this.#parseLiteral(text.slice(pos, end + 1), start) : raw;
+                this.#token(TOKEN_VALUE, value, start);
+                pos = end + 1;
+                continue;
+            }
+
+            if (c === 0x2d || (c >= 0x30 && c <= 0x39)) {
+                // 数字可能在块末尾被截断（如"1."或"1e"），先找到数字字符的结尾
+                let end = pos + 1;
+                while (end < length && isNumberChar(text.charCodeAt(end))) end++;
+                if (end === length && !final) break;
+                NUMBER_PATTERN.lastIndex = pos;
+                if (!NUMBER_PATTERN.test(text) || NUMBER_PATTERN.lastIndex !== end) {
+                    this.#syntaxError(start, text.slice(pos, end));
+                }
+                this.#token(TOKEN_VALUE, Number(text.slice(pos, end)), start);
+                pos = end;
+                continue;
+            }
+
+            const literal = c === 0x74 ? 'true' : c === 0x66 ? 'false' : c === 0x6e ? 'null' : undefined;
+            if (literal === undefined) {
+                this.#syntaxError(start, text[pos]);
+            }
+            if (text.startsWith(literal, pos)) {
+                this.#token(TOKEN_VALUE, literal === 'null' ? null : literal === 'true', start);
+                pos += literal.length;
+                continue;
+            }
+            if (!final && literal.startsWith(text.slice(pos))) break;
+            this.#syntaxError(start, text[pos]);
+        }
+
+        if (final && pos < length) {
+            throw new Error(`Unexpected end of JSON input at offset ${this.#offset + pos}`);
+        }
+        this.#text = pos === 0 ? text : text.slice(pos);
+        this.#offset += pos;
+    }
+
+    #parseLiteral(literal, start) {
+        try {
+            return JSON.parse(literal);
+        } catch (error) {
+            throw new Error(`Invalid JSON string at offset ${this.#offset + start}: ${error.message}`);
+        }
+    }
+
+    #syntaxError(start, text) {
+        throw new Error(`Unexpected token '${text}' in JSON at offset ${this.#offset + start}`);
+    }
+
+    // 处理一个词法单元
+    #token(type, value, start) {
+        // 跳过未知字段的值
+        if (this.#skipDepth > 0) {
+            if (type === TOKEN_BEGIN_OBJECT || type === TOKEN_BEGIN_ARRAY) {
+                this.#skipDepth++;
+            } else if (type === TOKEN_END_OBJECT || type === TOKEN_END_ARRAY) {
+                if (--this.#skipDepth === 0) {
+                    this.#stack[this.#stack.length - 1].state = EXPECT_NEXT;
+                }
+            }
+            return;
+        }
+
+        const stack = this.#stack;
+        const frame = stack[stack.length - 1];
+        if (frame === undefined) {
+            if (type !== TOKEN_BEGIN_OBJECT || this.#root !== undefined) {
+                this.#unexpected(type, start);
+            }
+            stack.push(this.#messageFrame(this.#messageCls));
+            return;
+        }
+        if (frame.plain !== undefined) {
+            this.#plainToken(frame, type, value, start);
+            return;
+        }
+
+        const state = frame.state;
+        switch (type) {
+            case TOKEN_BEGIN_OBJECT:
+                if (state === EXPECT_VALUE) {
+                    const field = frame.field;
+                    if (field === undefined) {
+                        this.#skipDepth = 1;
+                        return;
+                    }
+                    if (field.label === 'LABEL_REPEATED') {
+                        throw new Error(`Expected array for repeated field '${field.name}', got object`);
+                    }
+                    stack.push(field.wkt !== undefined ? this.#plainFrame(type, field) :
+                        this.#messageFrame(this.#messageClass(field)));
+                    return;
+                }
+                if (state === EXPECT_FIRST_ITEM || state === EXPECT_ITEM) {
+                    const field = frame.field;
+                    stack.push(field.wkt !== undefined ? this.#plainFrame(type, field) :
+                        this.#messageFrame(this.#messageClass(field)));
+                    return;
+                }
+                break;
+
+            case TOKEN_BEGIN_ARRAY:
+                if (state === EXPECT_VALUE) {
+                    const field = frame.field;
+                    if (field === undefined) {
+                        this.#skipDepth = 1;
+                        return;
+                    }
+                    // ListValue/Value/FieldMask等知名类型的值本身可以是数组
+                    if (field.wkt !== undefined && field.label !== 'LABEL_REPEATED') {
+                        stack.push(this.#plainFrame(type, field));
+                        return;
+                    }
+                    if (field.label !== 'LABEL_REPEATED') {
+                        throw new Error(`Unexpected array for field '${field.name}'`);
+                    }
+                    // 逐行产出的字段不保留元素；其余重复字段复用实例上已有的数组
+                    const rows = stack.length === 1 && field.name === this.#rowField;
+                    let list = null;
+                    if (!rows) {
+                        const existing = frame.instance[field.name];
+                        list = Array.isArray(existing) ? existing : [];
+                        list.length = 0;
+                    }
+                    stack.push({ state: EXPECT_FIRST_ITEM, field, list, rows });
+                    return;
+                }
+                if ((state === EXPECT_FIRST_ITEM || state === EXPECT_ITEM) && frame.field.wkt !== undefined) {
+                    stack.push(this.#plainFrame(type, frame.field));
+                    return;
+                }
+                break;
+
+            case TOKEN_END_OBJECT:
+                if (frame.instance !== undefined && (state === EXPECT_FIRST_KEY || state === EXPECT_NEXT)) {
+                    stack.pop();
+                    this.#complete(frame.instance);
+                    return;
+                }
+                break;
+
+            case TOKEN_END_ARRAY:
+                if (frame.instance === undefined && (state === EXPECT_FIRST_ITEM || state === EXPECT_NEXT)) {
+                    stack.pop();
+                    const parent = stack[stack.length - 1];
+                    if (!frame.rows) {
+                        parent.instance[frame.field.name] = frame.list;
+                    }
+                    parent.state = EXPECT_NEXT;
+                    return;
+                }
+                break;
+
+            case TOKEN_COLON:
+                if (state === EXPECT_COLON) {
+                    frame.state = EXPECT_VALUE;
+                    return;
+                }
+                break;
+
+            case TOKEN_COMMA:
+                if (state === EXPECT_NEXT) {
+                    frame.state = frame.instance !== undefined ? EXPECT_KEY : EXPECT_ITEM;
+                    return;
+                }
+                break;
+
+            case TOKEN_VALUE:
+                if (state === EXPECT_FIRST_KEY || state === EXPECT_KEY) {
+                    if (typeof value !== 'string') break;
+                    frame.field = frame.fields.get(value);
+                    frame.state = EXPECT_COLON;
+                    return;
+                }
+                if (state === EXPECT_VALUE) {
+                    this.#scalarField(frame, value);
+                    return;
+                }
+                if (state === EXPECT_FIRST_ITEM || state === EXPECT_ITEM) {
+                    value = this.#fieldValue(frame.field, value);
+                    if (frame.rows) {
+                        this.#rows.push(value);
+                    } else {
+                        frame.list.push(value);
+                    }
+                    frame.state = EXPECT_NEXT;
+                    return;
+                }
+                break;
+        }
+        this.#unexpected(type, start);
+    }
+
+    #messageFrame(messageCls) {
+        return { state: EXPECT_FIRST_KEY, instance: createMessage(messageCls), fields: getFieldTable(messageCls), field: undefined };
+    }
+
+    #messageClass(field) {
+        const { clrType, name } = field;
+        if (field.type !== 'TYPE_MESSAGE') {
+            throw new Error(`Unexpected object for field '${name}'`);
+        }
+        if (typeof clrType !== 'function') {
+            throw new Error(`Invalid clrType for message field '${name}' (expected function, got ${typeof clrType})`);
+        }
+        return clrType;
+    }
+
+    // 标量值（包括null）赋给消息字段
+    #scalarField(frame, value) {
+        const field = frame.field;
+        frame.state = EXPECT_NEXT;
+        if (field === undefined) {
+            return;
+        }
+        const { label, type, name } = field;
+        if (label === 'LABEL_REPEATED') {
+            if (value !== null) {
+                throw new Error(`Expected array for repeated field '${name}', got ${typeof value}`);
+            }
+            const existing = frame.instance[name];
+            const list = Array.isArray(existing) ? existing : [];
+            list.length = 0;
+            frame.instance[name] = list;
+            return;
+        }
+        frame.instance[name] = this.#fieldValue(field, value);
+    }
+
+    // 标量值转换为字段值：知名类型与64位整数解码，标记了intern的字符串驻留
+    #fieldValue(field, value) {
+        if (value === null) {
+            return null;
+        }
+        if (field.wkt !== undefined) {
+            return decodeWellKnownType(field, value);
+        }
+        if (field.int64 !== undefined) {
+            return decodeInt64(field, value);
+        }
+        if (field.type === 'TYPE_MESSAGE') {
+            throw new Error(`Expected object for message field '${field.name}', got ${typeof value}`);
+        }
+        return field.intern && this.#internTable !== null && typeof value === 'string' ? this.#internTable.intern(value) : value;
+    }
+
+    // 知名类型的普通JSON值（Struct/Value/ListValue/Any等）逐层构造，不经过生成的类
+    #plainToken(frame, type, value, start) {
+        const state = frame.state;
+        const isArray = Array.isArray(frame.plain);
+        const atValue = isArray ? state === EXPECT_FIRST_ITEM || state === EXPECT_ITEM : state === EXPECT_VALUE;
+        switch (type) {
+            case TOKEN_BEGIN_OBJECT:
+            case TOKEN_BEGIN_ARRAY:
+                if (atValue) {
+                    this.#stack.push(this.#plainFrame(type, undefined));
+                    return;
+                }
+                break;
+
+            case TOKEN_END_OBJECT:
+            case TOKEN_END_ARRAY:
+                if ((type === TOKEN_END_ARRAY) === isArray &&
+                    (state === EXPECT_NEXT || state === (isArray ? EXPECT_FIRST_ITEM : EXPECT_FIRST_KEY))) {
+                    this.#stack.pop();
+                    this.#plainComplete(frame);
+                    return;
+                }
+                break;
+
+            case TOKEN_COLON:
+                if (state === EXPECT_COLON) {
+                    frame.state = EXPECT_VALUE;
+                    return;
+                }
+                break;
+
+            case TOKEN_COMMA:
+                if (state === EXPECT_NEXT) {
+                    frame.state = isArray ? EXPECT_ITEM : EXPECT_KEY;
+                    return;
+                }
+                break;
+
+            case TOKEN_VALUE:
+                if (atValue) {
+                    this.#plainPut(frame, value);
+                    return;
+                }
+                if ((state === EXPECT_FIRST_KEY || state === EXPECT_KEY) && typeof value === 'string') {
+                    frame.key = value;
+                    frame.state = EXPECT_COLON;
+                    return;
+                }
+                break;
+        }
+        this.#unexpected(type, start);
+    }
+
+    // field只在知名类型值的最外层帧上设置
+    #plainFrame(type, field) {
+        return type === TOKEN_BEGIN_OBJECT ?
+            { state: EXPECT_FIRST_KEY, plain: {}, key: undefined, field } :
+            { state: EXPECT_FIRST_ITEM, plain: [], key: undefined, field };
+    }
+
+    #plainPut(frame, value) {
+        if (Array.isArray(frame.plain)) {
+            frame.plain.push(value);
+        } else if (frame.key === '__proto__') {
+            // 与JSON.parse一致，作为普通属性而不是原型
+            Object.defineProperty(frame.plain, '__proto__', { value, writable: true, enumerable: true, configurable: true });
+        } else {
+            frame.plain[frame.key] = value;
+        }
+        frame.state = EXPECT_NEXT;
+    }
+
+    // 普通JSON值构造完成：放入外层JSON值，或解码后赋给知名类型字段
+    #plainComplete(frame) {
+        const parent = this.#stack[this.#stack.length - 1];
+        if (frame.field === undefined) {
+            this.#plainPut(parent, frame.plain);
+            return;
+        }
+        const value = decodeWellKnownType(frame.field, frame.plain);
+        if (parent.instance !== undefined) {
+            parent.instance[frame.field.name] = value;
+        } else {
+            parent.list.push(value);
+        }
+        parent.state = EXPECT_NEXT;
+    }
+
+    // 子消息解析完成，交给父帧
+    #complete(instance) {
+        const stack = this.#stack;
+        const parent = stack[stack.length - 1];
+        if (parent === undefined) {
+            this.#root = instance;
+            return;
+        }
+        if (parent.instance !== undefined) {
+            parent.instance[parent.field.name] = instance;
+        } else if (parent.rows) {
+            this.#rows.push(instance);
+        } else {
+            parent.list.push(instance);
+        }
+        parent.state = EXPECT_NEXT;
+    }
+
+    #unexpected(type, start) {
+        const names = ['', '{', '}', '[', ']', ':', ',', 'value'];
+        throw new Error(`Unexpected ${names[type]} in JSON at offset ${this.#offset + start}`);
+    }
+}
+
+/**
+ * 将数据源统一转换为异步可迭代的块序列
+ * @private
+ * @param {AsyncIterable|Iterable|string|Uint8Array} source - Node可读流、异步迭代器、同步迭代器或完整文本
+ * @returns {AsyncIterable|Iterable} 块序列
+ */
+function toChunks(source) {
+    if (typeof source === 'string' || source instanceof Uint8Array) {
+        return [source];
+    }
+    if (source === null || source === undefined ||
+        (typeof source[Symbol.asyncIterator] !== 'function' && typeof source[Symbol.iterator] !== 'function')) {
+        throw new Error('source must be a stream, an iterable of chunks, a string or a Uint8Array');
+    }
+    return source;
+}
+
+/**
+ * 从流中逐行读取表数据：每解析完成一个rowField元素就产出一个消息实例，
+ * 根消息上不保留这些元素，可处理超出内存的表
+ * @param {Function} tableCls - 表消息类（如TbPlayer）
+ * @param {AsyncIterable|Iterable|string|Uint8Array} source - Node可读流、异步迭代器、同步迭代器或完整文本
+ * @param {string} [rowField='dataList'] - 逐行产出的重复字段名
+ * @param {Object} [options] - 解码选项
+ * @param {InternTable|null} [options.internTable] - 字符串驻留表，默认使用全局驻留表，null表示不驻留
+ * @returns {AsyncGenerator<Object>} 行消息实例
+ * @throws {Error} 如果JSON格式错误或与描述符不匹配
+ */
+export async function* streamRows(tableCls, source, rowField = 'dataList', options = {}) {
+    const decoder = new JsonStreamDecoder(tableCls, { ...options, rowField });
+    for await (const chunk of toChunks(source)) {
+        decoder.write(chunk);
+        yield* decoder.takeRows();
+    }
+    decoder.end();
+    yield* decoder.takeRows();
+}
+
+/**
+ * 从流中完整解码一个消息（与fromJson结果一致，但不构造中间对象树）
+ * @template T
+ * @param {new (...args: any[]) => T} messageCls - 消息类
+ * @param {AsyncIterable|Iterable|string|Uint8Array} source - Node可读流、异步迭代器、同步迭代器或完整文本
+ * @param {Object} [options] - 解码选项
+ * @param {InternTable|null} [options.internTable] - 字符串驻留表，默认使用全局驻留表，null表示不驻留
+ * @returns {Promise<T>} 消息实例
+ * @throws {Error} 如果JSON格式错误或与描述符不匹配
+ */
+export async function decodeStream(messageCls, source, options = {}) {
+    const decoder = new JsonStreamDecoder(messageCls, options);
+    for await (const chunk of toChunks(source)) {
+        decoder.write(chunk);
+    }
+    return decoder.end();
+}
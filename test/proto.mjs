@@ -1,3 +1,5 @@
+import { metricsEnabled, measureDecode, measureEncode } from './proto-metrics.mjs';
+
 /**
  * 将Protobuf消息实例序列化为JSON字符串
  * @param {Object} message - Protobuf消息实例
@@ -9,7 +11,21 @@ export function toJson(message, space) {
     if (message === null || message === undefined) {
         throw new Error('message cannot be null or undefined');
     }
+    if (metricsEnabled) {
+        return measureEncode(encodeJson, message.constructor, message, space);
+    }
+    return encodeJson(message, space);
+}
 
+/**
+ * toJson的实现（不记录指标）
+ * @private
+ */
+function encodeJson(message, space) {
+    // passthrough模式：未修改的消息直接返回解码时的源文本，不再序列化
+    if (space === undefined && message.__rawText !== undefined && message.__isPristine()) {
+        return message.__rawText;
+    }
     try {
         return JSON.stringify(message, null, space);
     } catch (error) {
@@ -22,10 +38,23 @@ export function toJson(message, space) {
  * @template T
  * @param {new (...args: any[]) => T} messageCls - Protobuf消息类的构造函数
  * @param {Object|string} json - JSON对象或JSON字符串
+ * @param {T} [target] - 可选，解码到已有实例（先调用clear()重置，复用其数组；pool模式下其子消息先交回对象池）
+ * @param {Object} [options] - 解码选项
+ * @param {InternTable|null} [options.internTable] - 本次解码会话使用的字符串驻留表，
+ *     默认使用全局驻留表，null表示不驻留
  * @returns {T} 消息实例
  * @throws {Error} 如果参数无效或JSON解析失败
+ *
+ * 以lazy选项生成的类中，子消息与重复子消息字段只保存对JSON节点的引用，首次访问时才解码，
+ * 其中的解码错误也在访问时抛出；解码后不要修改传入的JSON对象。
+ *
+ * 以passthrough选项生成的类保留解码时的JSON对象（json为字符串时还保留该文本）。
+ * 消息及其已解码的子消息未被修改时，toJson原样返回源文本，嵌套时写回源JSON对象；
+ * 修改后重新编码，源JSON中未知的键仍会写出。字段均生成为访问器，任何赋值都会被察觉；
+ * 数组与map按长度、键和元素与源JSON比较，但bytes与知名类型的元素只比较个数，
+ * 原地修改Date或Uint8Array的内容不会被察觉。
  */
-export function fromJson(messageCls, json) {
+export function fromJson(messageCls, json, target, options) {
     // 参数验证
     if (typeof messageCls !== 'function') {
         throw new Error('messageCls must be a function (message class)');
@@ -34,9 +63,22 @@ export function fromJson(messageCls, json) {
     if (json === undefined || json === null) {
         throw new Error('json cannot be null or undefined');
     }
+    if (metricsEnabled) {
+        return measureDecode(decodeJson, messageCls, json, target, options);
+    }
+    return decodeJson(messageCls, json, target, options);
+}
+
+/**
+ * fromJson的实现（不记录指标，嵌套消息也直接调用它，只有顶层调用计入指标）
+ * @private
+ */
+function decodeJson(messageCls, json, target, options) {
 
     // 如果json是字符串，解析它
+    let text;
     if (typeof json === 'string') {
+        text = json;
         try {
             json = JSON.parse(json);
         } catch (error) {
@@ -50,8 +92,19 @@ export function fromJson(messageCls, json) {
         throw new Error(`Invalid message type '${messageCls.name}' (missing __descriptor)`);
     }
 
-    // 创建消息实例（不调用构造函数，直接设置原型链）
-    const instance = Object.create(messageCls.prototype);
+    // 获取消息实例：复用目标实例，或从对象池获取（pool模式），否则通过构造函数创建
+    let instance;
+    if (target !== undefined) {
+        if (!(target instanceof messageCls)) {
+            throw new Error(`target must be an instance of '${messageCls.name}'`);
+        }
+        // pool模式：先把目标持有的子消息交回对象池，clear()只会丢弃它们
+        target.__releaseOwned?.();
+        target.clear();
+        instance = target;
+    } else {
+        instance = typeof messageCls.acquire === 'function' ? messageCls.acquire() : new messageCls();
+    }
 
     // 遍历字段并设置值
     for (const field of desc.fields) {
@@ -63,23 +116,85 @@ export function fromJson(messageCls, json) {
             continue;
         }
 
-        // 根据字段类型处理值
-        const processedValue = processFieldValue(field, jsonValue);
+        // lazy模式：子消息字段只保存JSON，首次访问时由生成的getter解码
+        if (field.lazy === true && isLazyJson(field, jsonValue) && typeof instance.__setLazy === 'function') {
+            instance.__setLazy(field.number, jsonValue, getLazyDecoder(options));
+            continue;
+        }
+
+        // 根据字段类型处理值（重复字段复用实例上已有的数组）
+        const processedValue = processFieldValue(field, jsonValue, instance[fieldName], options);
         instance[fieldName] = processedValue;
     }
 
+    // dirty_tracking模式：解码经由setter标记了字段，解码结果视为已提交状态
+    instance.__markCommitted?.();
+
+    // passthrough模式：所有字段设置完后保留源JSON，此后的修改才会使其失效
+    if (typeof instance.__retain === 'function') {
+        instance.__retain(json, text);
+    }
+
     return instance;
 }
 
+/**
+ * 判断字段的JSON值能否延迟解码；其他值（null、字符串形式的JSON等）立即解码，
+ * 以便类型错误仍在fromJson中抛出
+ * @private
+ * @param {Object} field - 字段描述符对象
+ * @param {any} value - 原始值（JSON格式）
+ * @returns {boolean}
+ */
+function isLazyJson(field, value) {
+    if (field.label === 'LABEL_REPEATED') {
+        return Array.isArray(value);
+    }
+    return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+/**
+ * 无解码选项时共享的延迟解码函数
+ * @private
+ */
+const defaultLazyDecoder = (field, value, existing) => processFieldValue(field, value, existing, undefined);
+
+/**
+ * 按解码选项缓存的延迟解码函数，同一options对象解码的消息共享一个
+ * @private
+ * @type {WeakMap<Object, Function>}
+ */
+const lazyDecoders = new WeakMap();
+
+/**
+ * 获取延迟解码函数：生成的getter以(字段描述符, JSON值, 已有值)调用它
+ * @private
+ * @param {Object} [options] - 解码选项（见fromJson）
+ * @returns {function(Object, any, any): any}
+ */
+function getLazyDecoder(options) {
+    if (options === undefined) {
+        return defaultLazyDecoder;
+    }
+    let decoder = lazyDecoders.get(options);
+    if (decoder === undefined) {
+        decoder = (field, value, existing) => processFieldValue(field, value, existing, options);
+        lazyDecoders.set(options, decoder);
+    }
+    return decoder;
+}
+
 /**
  * 处理Protobuf字段值，支持重复字段和嵌套消息
  * @private
  * @param {Object} field - 字段描述符对象
  * @param {any} value - 原始值（JSON格式）
+ * @param {any} [existing] - 实例上已有的字段值，重复字段时复用其数组
+ * @param {Object} [options] - 解码选项（见fromJson）
  * @returns {any} 处理后的值
  * @throws {Error} 如果字段类型不匹配或值无效
  */
-function processFieldValue(field, value) {
+function processFieldValue(field, value, existing, options) {
     // 参数验证
     if (field === null || field === undefined) {
         throw new Error('field cannot be null or undefined');
@@ -91,19 +206,25 @@ function processFieldValue(field, value) {
 
     // 处理重复字段（数组）
     if (label === 'LABEL_REPEATED') {
+        const result = Array.isArray(existing) ? existing : [];
+        result.length = 0;
+
         // 如果值为null，返回空数组
         if (value === null) {
-            return [];
+            return result;
         }
 
         if (!Array.isArray(value)) {
             throw new Error(`Expected array for repeated field '${name}', got ${typeof value}`);
         }
-        return value.map(item => processSingleFieldValue(field, item));
+        for (let i = 0; i < value.length; i++) {
+            result.push(processSingleFieldValue(field, value[i], options));
+        }
+        return result;
     }
 
     // 处理单个字段
-    return processSingleFieldValue(field, value);
+    return processSingleFieldValue(field, value, options);
 }
 
 /**
@@ -111,10 +232,11 @@ function processFieldValue(field, value) {
  * @private
  * @param {Object} field - 字段描述符对象
  * @param {any} value - 原始值（JSON格式）
+ * @param {Object} [options] - 解码选项（见fromJson）
  * @returns {any} 处理后的值
  * @throws {Error} 如果字段类型不匹配或值无效
  */
-function processSingleFieldValue(field, value) {
+function processSingleFieldValue(field, value, options) {
     // 参数验证
     if (field === null || field === undefined) {
         throw new Error('field cannot be null or undefined');
@@ -129,6 +251,16 @@ function processSingleFieldValue(field, value) {
         return null;
     }
 
+    // 知名类型（google.protobuf.*）解码为普通JavaScript值，没有对应的生成类
+    if (field.wkt !== undefined) {
+        return decodeWellKnownType(field, value);
+    }
+
+    // 64位整数按生成时的int64选项解码
+    if (field.int64 !== undefined) {
+        return decodeInt64(field, value);
+    }
+
     // 如果是消息类型，递归处理
     if (type === 'TYPE_MESSAGE') {
         if (!clrType) {
@@ -138,7 +270,13 @@ function processSingleFieldValue(field, value) {
             throw new Error(`Invalid clrType for message field '${name}' (expected function, got ${typeof clrType})`);
         }
         // 递归调用fromJson处理嵌套消息
-        return fromJson(clrType, value);
+        return decodeJson(clrType, value, undefined, options);
+    }
+
+    // 驻留低基数字符串字段（生成代码中标记了intern）
+    if (field.intern && typeof value === 'string') {
+        const internTable = options?.internTable === undefined ? defaultInternTable : options.internTable;
+        return internTable === null ? value : internTable.intern(value);
     }
 
     // 处理枚举类型（如果存在）
@@ -149,7 +287,344 @@ function processSingleFieldValue(field, value) {
     }
 
     // 基本类型直接返回（JSON解析已经处理了数字、布尔值等）
-    // 注意：对于大整数类型（如TYPE_UINT64），JSON可能无法精确表示
-    // 但在JavaScript中，数字类型可以处理2^53以内的整数
+    // 注意：int64=number时64位整数超过2^53会丢失精度，需要精确值时使用其他int64表示
+    return value;
+}
+
+// RFC 3339时间戳格式（Date.parse之前先校验，避免接受其它日期写法）
+const TIMESTAMP_PATTERN = /^\d{4}-\d{2}-\d{2}[Tt]\d{2}:\d{2}:\d{2}(\.\d{1,9})?([Zz]|[+-]\d{2}:\d{2})$/;
+const DURATION_PATTERN = /^(-?)(\d+)(?:\.(\d{1,9}))?s$/;
+
+/**
+ * 解析text中从start开始的count位十进制数字
+ * @private
+ * @returns {number} 数值，包含非数字字符时返回NaN
+ */
+function parseDigits(text, start, count) {
+    let value = 0;
+    for (let i = start; i < start + count; i++) {
+        const digit = text.charCodeAt(i) - 0x30;
+        if (digit < 0 || digit > 9) {
+            return NaN;
+        }
+        value = value * 10 + digit;
+    }
+    return value;
+}
+
+/**
+ * 将RFC 3339时间戳字符串解析为纪元毫秒数。
+ * 最常见的UTC写法（YYYY-MM-DDTHH:MM:SS[.fraction]Z）逐字符解析，带时区偏移的交给Date.parse
+ * @private
+ * @param {string} text - 时间戳字符串
+ * @returns {number} 纪元毫秒数，格式无效时返回NaN
+ */
+function parseTimestamp(text) {
+    const length = text.length;
+    if (length >= 20 && length <= 30 && (text.charCodeAt(length - 1) | 0x20) === 0x7a &&
+        text.charCodeAt(4) === 0x2d && text.charCodeAt(7) === 0x2d && (text.charCodeAt(10) | 0x20) === 0x74 &&
+        text.charCodeAt(13) === 0x3a && text.charCodeAt(16) === 0x3a &&
+        (length === 20 || (text.charCodeAt(19) === 0x2e && length > 21))) {
+        const year = parseDigits(text, 0, 4);
+        const month = parseDigits(text, 5, 2);
+        const day = parseDigits(text, 8, 2);
+        const hour = parseDigits(text, 11, 2);
+        const minute = parseDigits(text, 14, 2);
+        const second = parseDigits(text, 17, 2);
+        const fractionDigits = length - 21;
+        const fraction = fractionDigits > 0 ? Math.floor(parseDigits(text, 20, fractionDigits) / 10 ** (fractionDigits - 3)) : 0;
+        // 两位数年份会被Date.UTC当作19xx，交给Date.parse处理
+        if (year >= 100 && month >= 1 && month <= 12 && day >= 1 && day <= 31 &&
+            hour <= 23 && minute <= 59 && second <= 59 && !Number.isNaN(fraction)) {
+            return Date.UTC(year, month - 1, day, hour, minute, second) + fraction;
+        }
+    }
+    return TIMESTAMP_PATTERN.test(text) ? Date.parse(text) : NaN;
+}
+
+/**
+ * 解码google.protobuf.Timestamp的JSON形式
+ * @param {string|number|Date} value - RFC 3339字符串、纪元毫秒数或Date
+ * @param {boolean} [epochMillis=false] - 返回纪元毫秒数（以timestamp=number生成时），否则返回Date
+ * @returns {Date|number} 时间
+ * @throws {Error} 如果值不是有效的时间戳
+ */
+export function decodeTimestamp(value, epochMillis = false) {
+    const millis = typeof value === 'number' ? value :
+        typeof value === 'string' ? parseTimestamp(value) :
+        value instanceof Date ? value.getTime() : NaN;
+    if (!Number.isFinite(millis)) {
+        throw new Error(`Invalid google.protobuf.Timestamp: ${JSON.stringify(value)}`);
+    }
+    return epochMillis ? millis : new Date(millis);
+}
+
+/**
+ * 解码google.protobuf.Duration的JSON形式
+ * @param {string|number} value - 形如"1.5s"的字符串或毫秒数
+ * @returns {number} 毫秒数
+ * @throws {Error} 如果值不是有效的时长
+ */
+export function decodeDuration(value) {
+    if (typeof value === 'number' && Number.isFinite(value)) {
+        return value;
+    }
+    const match = typeof value === 'string' ? DURATION_PATTERN.exec(value) : null;
+    if (match === null) {
+        throw new Error(`Invalid google.protobuf.Duration: ${JSON.stringify(value)}`);
+    }
+    const millis = Number(match[2]) * 1000 + (match[3] === undefined ? 0 : Number(match[3].padEnd(9, '0')) / 1e6);
+    return match[1] === '-' ? -millis : millis;
+}
+
+/**
+ * 解码google.protobuf.FieldMask的JSON形式
+ * @param {string|string[]} value - 逗号分隔的路径字符串或路径数组
+ * @returns {string[]} 路径数组
+ * @throws {Error} 如果值不是有效的字段掩码
+ */
+export function decodeFieldMask(value) {
+    if (typeof value === 'string') {
+        return value === '' ? [] : value.split(',');
+    }
+    if (!Array.isArray(value) || !value.every(path => typeof path === 'string')) {
+        throw new Error(`Invalid google.protobuf.FieldMask: ${JSON.stringify(value)}`);
+    }
+    return value;
+}
+
+/**
+ * 按字段描述符的wkt解码知名类型的JSON值。
+ * Timestamp为Date（或纪元毫秒数），Duration为毫秒数，FieldMask为路径数组；
+ * 包装类型就是可空的基本类型值，Struct/Value/ListValue/Any/Empty就是普通JSON，原样返回
+ * @param {Object} field - 带wkt的字段描述符对象
+ * @param {any} value - JSON值（非null）
+ * @returns {any} 解码后的值
+ * @throws {Error} 如果值与知名类型不匹配
+ */
+export function decodeWellKnownType(field, value) {
+    switch (field.wkt) {
+        case 'Timestamp':
+            return decodeTimestamp(value, field.epochMillis === true);
+        case 'Duration':
+            return decodeDuration(value);
+        case 'FieldMask':
+            return decodeFieldMask(value);
+        default:
+            return value;
+    }
+}
+
+const MAX_SAFE_BIGINT = BigInt(Number.MAX_SAFE_INTEGER);
+const MIN_SAFE_BIGINT = -MAX_SAFE_BIGINT;
+
+/**
+ * 检查64位整数的字符串形式是十进制整数；BigInt()还会接受空串、空白和十六进制
+ * @private
+ * @param {string} value - JSON中的字符串值
+ * @returns {string} value
+ * @throws {Error} 如果不是十进制整数
+ */
+function checkInt64String(value) {
+    if (!/^-?\d+$/.test(value)) {
+        throw new Error(`Invalid 64-bit integer: ${JSON.stringify(value)}`);
+    }
     return value;
-}
\ No newline at end of file
+}
+
+/**
+ * 64位整数各表示的解码函数（与生成代码中的__decodeInt64一致）
+ * @private
+ */
+const int64Decoders = {
+    bigint: value => typeof value === 'bigint' ? value : BigInt(typeof value === 'string' ? checkInt64String(value) : value),
+    string: value => typeof value === 'string' ? checkInt64String(value) : String(BigInt(value)),
+    hybrid: value => {
+        if (typeof value === 'number') {
+            return Number.isSafeInteger(value) ? value : BigInt(value);
+        }
+        if (typeof value === 'string') {
+            // 不超过15位的十进制字符串一定是安全整数，不经过BigInt
+            if (/^-?\d{1,15}$/.test(value)) return Number(value);
+            checkInt64String(value);
+        }
+        const big = typeof value === 'bigint' ? value : BigInt(value);
+        return big >= MIN_SAFE_BIGINT && big <= MAX_SAFE_BIGINT ? Number(big) : big;
+    },
+};
+
+/**
+ * 按字段描述符的int64解码64位整数的JSON值（数字或十进制字符串）。
+ * bigint为BigInt，string为十进制字符串，hybrid在安全整数范围内为number、否则为BigInt；
+ * 没有int64标记的字段（int64=number，默认）原样返回
+ * @param {Object} field - 字段描述符对象
+ * @param {number|string|bigint} value - JSON值（非null）
+ * @returns {number|string|bigint} 解码后的值
+ * @throws {Error} 如果值不是整数
+ */
+export function decodeInt64(field, value) {
+    const decode = field.int64 === undefined ? undefined : int64Decoders[field.int64];
+    return decode === undefined ? value : decode(value);
+}
+
+/**
+ * 校验不可信的JSON数据（需要以validate选项生成代码）
+ * @param {Function} messageCls - Protobuf消息类
+ * @param {Object|string} json - JSON对象或JSON字符串
+ * @returns {Error|null} 校验通过返回null，否则返回带字段路径(error.path)的ValidationError
+ * @throws {Error} 如果消息类没有生成校验器或JSON字符串无法解析
+ */
+export function validateJson(messageCls, json) {
+    if (typeof messageCls?.validate !== 'function') {
+        throw new Error(`'${messageCls?.name}' has no validator (generate with the 'validate' option)`);
+    }
+    if (typeof json === 'string') {
+        try {
+            json = JSON.parse(json);
+        } catch (error) {
+            throw new Error(`Failed to parse JSON string: ${error.message}`);
+        }
+    }
+    return messageCls.validate(json);
+}
+
+/**
+ * 校验并反序列化不可信的JSON数据，校验与构造实例在同一次遍历中完成
+ * @template T
+ * @param {new (...args: any[]) => T} messageCls - Protobuf消息类（以validate选项生成）
+ * @param {Object|string} json - JSON对象或JSON字符串
+ * @returns {T} 消息实例
+ * @throws {Error} 校验失败时抛出带字段路径(error.path)的ValidationError
+ */
+export function fromJsonValidated(messageCls, json) {
+    if (typeof messageCls?.validateAndDecode !== 'function') {
+        throw new Error(`'${messageCls?.name}' has no validator (generate with the 'validate' option)`);
+    }
+    if (metricsEnabled) {
+        return measureDecode(decodeValidated, messageCls, json);
+    }
+    return decodeValidated(messageCls, json);
+}
+
+/**
+ * fromJsonValidated的实现（不记录指标）
+ * @private
+ */
+function decodeValidated(messageCls, json) {
+    if (typeof json === 'string') {
+        try {
+            json = JSON.parse(json);
+        } catch (error) {
+            throw new Error(`Failed to parse JSON string: ${error.message}`);
+        }
+    }
+    return messageCls.validateAndDecode(json);
+}
+
+/**
+ * 根据枚举数值查找枚举值描述（使用生成的反向查找表，无需线性查找）
+ * @param {Object} enumType - 生成的枚举对象
+ * @param {number} number - 枚举数值
+ * @returns {{name: string, originalName: string, number: number}|undefined} 枚举值描述，未定义时返回undefined
+ */
+export function getEnumValue(enumType, number) {
+    const desc = enumType.__descriptor;
+    if (!desc) {
+        throw new Error('Invalid enum type (missing __descriptor)');
+    }
+
+    const { valueIndex, values } = desc;
+    const index = valueIndex instanceof Map ? valueIndex.get(number) : valueIndex[number];
+    return index === undefined || index < 0 ? undefined : values[index];
+}
+
+/**
+ * 根据枚举数值获取枚举名称
+ * @param {Object} enumType - 生成的枚举对象
+ * @param {number} number - 枚举数值
+ * @param {boolean} [original=false] - 是否返回proto中的原始名称（用于enum-as-string JSON）
+ * @returns {string|undefined} 枚举名称，未定义时返回undefined
+ */
+export function getEnumName(enumType, number, original = false) {
+    const value = getEnumValue(enumType, number);
+    if (value === undefined) {
+        return undefined;
+    }
+    return original ? value.originalName : value.name;
+}
+
+/**
+ * 有界字符串驻留表：解码时让相同内容的字符串共享同一实例，减少重复字符串占用的内存。
+ * 表满时整体清空重新开始，保证内存有上限。
+ */
+export class InternTable {
+    /**
+     * @param {number} [capacity=4096] - 最多驻留的不同字符串数量
+     */
+    constructor(capacity = 4096) {
+        if (!Number.isInteger(capacity) || capacity <= 0) {
+            throw new Error('capacity must be a positive integer');
+        }
+        this.capacity = capacity;
+        this.strings = new Map();
+        this.resetStats();
+    }
+
+    /**
+     * 返回与value内容相同的驻留字符串
+     * @param {string} value - 字符串
+     * @returns {string} 驻留的字符串实例
+     */
+    intern(value) {
+        this.lookups++;
+        const existing = this.strings.get(value);
+        if (existing !== undefined) {
+            this.hits++;
+            // 估算：字符串对象头16字节 + UTF-16内容
+            this.bytesSaved += 16 + value.length * 2;
+            return existing;
+        }
+        if (this.strings.size >= this.capacity) {
+            this.strings.clear();
+            this.evictions++;
+        }
+        this.strings.set(value, value);
+        return value;
+    }
+
+    /**
+     * 获取统计信息
+     * @returns {{lookups: number, hits: number, hitRate: number, bytesSaved: number, size: number, evictions: number}}
+     */
+    stats() {
+        return {
+            lookups: this.lookups,
+            hits: this.hits,
+            hitRate: this.lookups === 0 ? 0 : this.hits / this.lookups,
+            bytesSaved: this.bytesSaved,
+            size: this.strings.size,
+            evictions: this.evictions,
+        };
+    }
+
+    /**
+     * 清零统计信息（不清空驻留的字符串）
+     */
+    resetStats() {
+        this.lookups = 0;
+        this.hits = 0;
+        this.bytesSaved = 0;
+        this.evictions = 0;
+    }
+}
+
+// 未指定驻留表时使用的全局驻留表
+const defaultInternTable = new InternTable();
+
+/**
+ * 获取全局字符串驻留表（用于查看统计信息）
+ * @returns {InternTable} 全局驻留表
+ */
+export function getDefaultInternTable() {
+    return defaultInternTable;
+}
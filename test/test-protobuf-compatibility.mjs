@@ -8,17 +8,11 @@
 import { toJson, fromJson } from './proto.mjs';
 import { Vector3, Vector2Int, Rect } from './gen/pokeworld/math/comm_math.mjs';
 import { Player, Actor, TbPlayer } from './gen/pokeworld/actor/cfg_actor.mjs';
-import { dirname, join } from 'path';
-import { fileURLToPath } from 'url';
-import { existsSync } from 'fs';
+import { ReflectionRoot } from './proto-reflect.mjs';
 
 // Load protobuf.js dynamically
 import protobuf from 'protobufjs';
-
-// Get current directory
-const __filename = fileURLToPath(import.meta.url);
-const __dirname = dirname(__filename);
-const protoRoot = join(__dirname, 'proto');
+import 'protobufjs/ext/descriptor/index.js';
 
 // Test helper functions
 function assert(condition, message) {
@@ -69,59 +63,14 @@ function snakeKeysToCamel(obj) {
 }
 
 async function loadProtobufMessages() {
-    const root = new protobuf.Root();
-
-    // Load proto files from test/proto directory using absolute paths
-    const protoFiles = [
-        join(protoRoot, 'pokeworld/math/comm_math.proto'),
-        join(protoRoot, 'pokeworld/actor/cfg_actor.proto'),
-        join(protoRoot, 'pokeworld/resource/cfg_resource.proto')
-    ];
-
-    // Verify files exist
-    for (const file of protoFiles) {
-        if (!existsSync(file)) {
-            console.error(`❌ Proto file not found: ${file}`);
-            process.exit(1);
-        }
-        console.log(`📁 Proto file: ${file}`);
-    }
+    // Build the protobuf.js root from the descriptors embedded in the generated
+    // modules instead of parsing .proto files from disk
+    const reflection = new ReflectionRoot().addClass(Actor).addClass(TbPlayer).addClass(Rect);
+    console.log(`📁 Embedded descriptors: ${reflection.fileNames.join(', ')}`);
 
-    // Set resolvePath on root before loading
-    root.resolvePath = (origin, target) => {
-        console.log(`root.resolvePath called: origin="${origin}", target="${target}"`);
-
-        // If target is already absolute, use it
-        if (target.startsWith('/') || /^[a-zA-Z]:\\/.test(target)) {
-            console.log(`  Target is absolute, returning: ${target}`);
-            return target;
-        }
-
-        // Strategy 1: If target starts with pokeworld/, resolve from protoRoot
-        // This is because imports like "pokeworld/resource/cfg_resource.proto" are relative to proto root
-        if (target.startsWith('pokeworld/')) {
-            const resolved = join(protoRoot, target);
-            console.log(`  Target starts with pokeworld/, resolving from protoRoot: ${resolved}`);
-            return resolved;
-        }
-
-        // Strategy 2: If origin is provided, try resolving relative to origin
-        if (origin) {
-            const originDir = dirname(origin);
-            const resolved = join(originDir, target);
-            console.log(`  Resolving relative to origin: ${originDir} + ${target} = ${resolved}`);
-            return resolved;
-        }
-
-        // Strategy 3: Default to resolving from protoRoot
-        const resolved = join(protoRoot, target);
-        console.log(`  Defaulting to protoRoot: ${resolved}`);
-        return resolved;
-    };
-
-    // Use async loading
     try {
-        await root.load(protoFiles, { keepCase: true });
+        // Root.fromDescriptor (protobufjs/ext/descriptor) decodes FileDescriptorSet bytes directly
+        const root = protobuf.Root.fromDescriptor(reflection.toFileDescriptorSet());
         console.log('✅ Protobuf.js messages loaded successfully');
         return root;
     } catch (error) {
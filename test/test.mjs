@@ -2,10 +2,32 @@
  * Test serialization functionality of proto.mjs
  */
 
-import { toJson, fromJson } from './proto.mjs';
-import { Vector3, Vector2Int, Rect } from './gen/pokeworld/math/comm_math.mjs';
+import { readFileSync, existsSync, mkdtempSync, mkdirSync, copyFileSync, rmSync } from 'fs';
+import { tmpdir } from 'os';
+import { join } from 'path';
+import { pathToFileURL } from 'url';
+import { createHash } from 'crypto';
+import { toJson, fromJson, getEnumName, getEnumValue, InternTable, validateJson, fromJsonValidated } from './proto.mjs';
+import { streamRows, decodeStream } from './proto-stream.mjs';
+import { packFlat, openFlat, toSharedBuffer } from './proto-flat.mjs';
+import { enableMetrics, disableMetrics, resetMetrics, snapshot, metricsEnabled } from './proto-metrics.mjs';
+import { reflect, ReflectionRoot, decodeFileDescriptor } from './proto-reflect.mjs';
+import { FrameTypes, FrameWriter, FrameReader, FrameQueue, readFrames, FRAME_HEADER_SIZE } from './proto-frame.mjs';
+import { RpcChannel, RpcServer, createLoopback } from './proto-rpc.mjs';
+import { findTypeSlot, hasType, getType, loadType, loadTypeByUrl, typeNames } from './gen/type_registry.mjs';
+import { Vector3, Vector2Int, Rect, RectInt, Segment } from './gen/pokeworld/math/comm_math.mjs';
 import { Player, Actor, TbPlayer } from './gen/pokeworld/actor/cfg_actor.mjs';
-import { ResourceId } from './gen/pokeworld/resource/cfg_resource.mjs';
+import { EntityInfo, EntityTransform } from './gen/pokeworld/entity/comm_entity.mjs';
+import { ResourceId, TbResource } from './gen/pokeworld/resource/cfg_resource.mjs';
+import { TerrainTileRuleType, TerrainFlags } from './gen/pokeworld/world/cfg_world.mjs';
+import { MessageId, EntitySync, EntitySyncNotify, PlayerSync, NpcSync, MoveRequest, __fileDescriptor as csWorldDescriptor } from './gen/pokeworld/world/cs_world.mjs';
+import { TbWorldData, WorldData, TerrainSection } from './gen/pokeworld/world/comm_world.mjs';
+import { BattleEvent, BattleLog } from './gen/pokeworld/battle/comm_battle.mjs';
+import { JoinGameRequest, GetPlayersRequest } from './gen/pokeworld/player/cs_player.mjs';
+import { Inventory, Slot } from './gen/pokeworld/inventory/comm_inventory.mjs';
+import { Evolution } from './gen/pokeworld/pokemon/comm_pokemon.mjs';
+import * as csUser from './gen/pokeworld/user/cs_user.mjs';
+import * as csWorld from './gen/pokeworld/world/cs_world.mjs';
 
 // Test helper functions
 function assert(condition, message) {
@@ -18,6 +40,9 @@ function assert(condition, message) {
 }
 
 function deepEqual(a, b) {
+    if (a !== null && typeof a === 'object' && typeof a.equals === 'function') {
+        return a.equals(b);
+    }
     return JSON.stringify(a) === JSON.stringify(b);
 }
 
@@ -98,6 +123,974 @@ function testNestedMessage() {
     console.log('✓ Nested message test passed');
 }
 
+// Test nested type layout and constructor defaults
+function testNestedTypes() {
+    console.log('\n=== Test Nested Types ===');
+
+    // Top-level and nested classes start with their field defaults
+    assert(new Rect().width === 0 && new Player().name === '', 'Top-level constructors set defaults');
+    assert(new Evolution.Stage.Condition().minLevel === 0, 'Nested constructors set defaults');
+
+    // Nested types are module-level definitions exposed as static members
+    const { Stage, Trigger } = Evolution;
+    assert(Stage.Condition.__descriptor.fullName === 'pokeworld.pokemon.comm.Evolution.Stage.Condition', 'Doubly nested message reachable from its parent');
+    assert(Object.isFrozen(Trigger) && Trigger.LEVEL_UP === 1 && Trigger.__descriptor.fullName === 'pokeworld.pokemon.comm.Evolution.Trigger',
+        'Nested enum is a frozen constant with a descriptor');
+
+    const evolution = new Evolution().withStages([
+        new Stage().withSpeciesId(25).withTrigger(Trigger.ITEM).withCondition(new Stage.Condition().withItemId(7)),
+    ]);
+    const stage = fromJson(Evolution, toJson(evolution)).stages[0];
+    assert(stage instanceof Stage && stage.trigger === Trigger.ITEM && stage.condition.itemId === 7, 'Nested types round trip');
+
+    console.log('✓ Nested types test passed');
+}
+
+// Test oneof discriminant and single storage slot
+function testOneofField() {
+    console.log('\n=== Test Oneof Field ===');
+
+    const sync = new EntitySync();
+    assert(sync.syncCase === EntitySync.SyncCase.NONE, 'Oneof starts unset');
+
+    const playerSync = new PlayerSync();
+    sync.withPlayer(playerSync);
+    assert(sync.syncCase === EntitySync.SyncCase.PLAYER, 'Setting player updates case');
+    assert(sync.player === playerSync, 'Player member readable');
+
+    // Setting another member clears the previous one
+    sync.withNpc(new NpcSync());
+    assert(sync.syncCase === EntitySync.SyncCase.NPC, 'Setting npc updates case');
+    assert(sync.player === undefined, 'Previous member cleared');
+
+    // Only the active member is serialized
+    const parsed = JSON.parse(toJson(sync));
+    assert(parsed.npc !== undefined && parsed.player === undefined, `Only active member serialized: ${toJson(sync)}`);
+
+    // Decoding sets the case
+    const restored = fromJson(EntitySync, { player: {} });
+    assert(restored.syncCase === EntitySync.SyncCase.PLAYER, 'Decoded case correct');
+    assert(restored.player instanceof PlayerSync, 'Decoded member type correct');
+
+    sync.clearSync();
+    assert(sync.syncCase === EntitySync.SyncCase.NONE && sync.npc === undefined, 'clearSync resets oneof');
+
+    console.log('✓ Oneof field test passed');
+}
+
+// Test presence tracking of message fields
+function testFieldPresence() {
+    console.log('\n=== Test Field Presence ===');
+
+    const playerSync = new PlayerSync();
+    assert(!playerSync.hasEntityInfo(), 'Message field starts unset');
+    assert(toJson(playerSync) === '{}', 'Unset message fields are not serialized');
+
+    playerSync.withEntityTransform(new EntityTransform().withPos(new Vector2Int().withX(1).withY(2)));
+    assert(playerSync.hasEntityTransform(), 'withXxx sets presence');
+    assert(!playerSync.hasEntityInfo(), 'Other fields stay unset');
+    assert(toJson(playerSync) === '{"entityTransform":{"pos":{"x":1,"y":2}}}', `Only set fields serialized: ${toJson(playerSync)}`);
+
+    playerSync.clearEntityTransform();
+    assert(!playerSync.hasEntityTransform() && playerSync.entityTransform === undefined, 'clearXxx resets presence');
+
+    // Decoding sets presence
+    const restored = fromJson(PlayerSync, { entityInfo: { id: 7 }, actorState: null });
+    assert(restored.hasEntityInfo() && restored.entityInfo.id === 7, 'Decoded field has presence');
+    assert(!restored.hasActorState(), 'Null field has no presence');
+
+    // Decoding into an existing instance resets it first, pooled or not
+    const rect = new Rect().withX(1).withY(2).withWidth(3).withHeight(4);
+    assert(fromJson(Rect, { x: 9 }, rect) === rect && toJson(rect) === '{"x":9}', 'Decoding into an instance drops its old fields');
+    restored.withEntityTransform(new EntityTransform());
+    fromJson(PlayerSync, { entityInfo: { id: 8 } }, restored);
+    assert(restored.entityInfo.id === 8 && !restored.hasActorState() && !restored.hasEntityTransform(), 'Decoding into an instance drops its old presence');
+
+    console.log('✓ Field presence test passed');
+}
+
+// Test clear(), object pool and decode into an existing instance
+function testMessagePool() {
+    console.log('\n=== Test Message Pool ===');
+
+    const notify = EntitySyncNotify.acquire();
+    fromJson(EntitySyncNotify, { syncs: [{ player: { entityInfo: { id: 1 } } }, { npc: {} }] }, notify);
+    assert(notify.syncs.length === 2 && notify.syncs[0].player.entityInfo.id === 1, 'Decoded into acquired instance');
+
+    // Decoding into an existing instance reuses it and its arrays, and returns
+    // the sub-messages it owned to their free lists
+    const syncs = notify.syncs;
+    const first = notify.syncs[0];
+    const firstPlayer = first.player;
+    const result = fromJson(EntitySyncNotify, { syncs: [{ npc: {} }] }, notify);
+    assert(result === notify && notify.syncs === syncs, 'Instance and array reused');
+    assert(notify.syncs.length === 1 && notify.syncs[0].syncCase === EntitySync.SyncCase.NPC, 'Previous content replaced');
+    assert(EntitySync.__pool.includes(first) && firstPlayer.constructor.__pool.includes(firstPlayer),
+        'Previous sub-messages returned to their free lists');
+
+    // Releasing an instance twice would hand it to two callers
+    let threw = false;
+    try {
+        EntitySync.release(first);
+    } catch (error) {
+        threw = error.message.includes('released twice');
+    }
+    assert(threw && EntitySync.__pool.filter(item => item === first).length === 1, 'Double release rejected');
+
+    // Release returns the message and owned sub-messages to their free lists
+    EntitySyncNotify.release(notify);
+    assert(notify.syncs.length === 0 && notify.syncs === syncs, 'clear() keeps arrays');
+    assert(EntitySyncNotify.acquire() === notify, 'Released instance is reused');
+    assert(EntitySync.acquire().syncCase === EntitySync.SyncCase.NONE, 'Pooled sub-message is cleared');
+
+    const player = new Player().withId(5).withName('x');
+    player.clear();
+    assert(player.id === 0 && player.name === '', 'clear() resets scalars to defaults');
+
+    console.log('✓ Message pool test passed');
+}
+
+// Test dirty tracking and delta encoding
+function testDeltaEncoding() {
+    console.log('\n=== Test Delta Encoding ===');
+
+    const makePlayer = id => new PlayerSync()
+        .withEntityInfo(new EntityInfo().withId(id))
+        .withEntityTransform(new EntityTransform().withPos(new Vector2Int().withX(0).withY(0)));
+    const sender = new EntitySyncNotify().withSyncs([
+        new EntitySync().withPlayer(makePlayer(1)),
+        new EntitySync().withPlayer(makePlayer(2)),
+    ]);
+
+    // Initial full state
+    const receiver = new EntitySyncNotify().applyDelta(JSON.parse(JSON.stringify(sender.encodeDelta())));
+    sender.commit();
+    assert(receiver.syncs.length === 2 && receiver.syncs[1].player.entityInfo.id === 2, 'Full state applied');
+    assert(sender.encodeDelta() === undefined, 'No delta after commit');
+
+    // Change one position only
+    sender.syncs[1].player.entityTransform.pos.withX(5);
+    const delta = sender.encodeDelta();
+    const wire = JSON.stringify(delta);
+    assert(wire === '{"d":{"syncs":{"1":{"d":{"player":{"d":{"entityTransform":{"d":{"pos":{"f":{"x":5}}}}}}}}}}}', `Delta holds only the change: ${wire}`);
+
+    receiver.applyDelta(JSON.parse(wire));
+    assert(receiver.syncs[1].player.entityTransform.pos.x === 5, 'Nested change applied');
+    assert(receiver.syncs[0].player.entityTransform.pos.x === 0, 'Other elements untouched');
+
+    // Replacing and clearing fields
+    sender.commit();
+    sender.syncs[0].withNpc(new NpcSync());
+    sender.syncs[1].player.clearEntityTransform();
+    receiver.applyDelta(JSON.parse(JSON.stringify(sender.encodeDelta())));
+    assert(receiver.syncs[0].syncCase === EntitySync.SyncCase.NPC, 'Oneof switch applied');
+    assert(!receiver.syncs[1].player.hasEntityTransform(), 'Cleared field applied');
+
+    // A delta applied in the same process copies the sender's sub-messages
+    const source = new EntitySyncNotify().withSyncs([new EntitySync().withPlayer(makePlayer(3))]);
+    const local = new EntitySyncNotify().applyDelta(source.encodeDelta());
+    assert(local.syncs !== source.syncs && local.syncs[0] !== source.syncs[0], 'Sub-messages copied, not adopted');
+    source.syncs[0].player.entityInfo.withId(99);
+    assert(local.syncs[0].player.entityInfo.id === 3, 'Later sender changes do not reach the receiver');
+    assert(receiver.encodeDelta() === undefined && local.encodeDelta() === undefined, 'Applied deltas leave the receiver committed');
+
+    // Decoded and cleared messages start committed, whichever setters decoding used
+    const decodedSync = fromJson(PlayerSync, { entityInfo: { id: 7 }, entityTransform: { pos: { x: 1 } } });
+    const decodedMove = fromJson(MoveRequest, { movement: 2, run: true });
+    assert(decodedSync.encodeDelta() === undefined && decodedMove.encodeDelta() === undefined, 'No delta right after decode');
+    assert(PlayerSync.validateAndDecode({ entityInfo: { id: 7 } }).encodeDelta() === undefined, 'No delta right after validated decode');
+    assert(decodedSync.clear().encodeDelta() === undefined, 'No delta right after clear()');
+    decodedMove.withRun(false);
+    assert(JSON.stringify(decodedMove.encodeDelta()) === '{"f":{"run":false}}', 'Changes after decode are tracked');
+
+    console.log('✓ Delta encoding test passed');
+}
+
+// Test generated clone, copyFrom, equals and hashCode
+function testValueMethods() {
+    console.log('\n=== Test Value Methods ===');
+
+    const a = new Vector2Int().withX(3).withY(4);
+    const b = new Vector2Int().withX(3).withY(4);
+    assert(a.equals(b) && a.hashCode() === b.hashCode(), 'Equal values have equal hashes');
+    assert(!a.equals(new Vector2Int().withX(4).withY(3)), 'Different values are not equal');
+    assert(new Vector2Int().withX(0).equals(new Vector2Int()), 'Unset implicit field equals default');
+
+    // Value types as keys of a hashed cache
+    const cache = new Map();
+    for (const rect of [new RectInt().withX(1).withWidth(2), new RectInt().withX(1).withWidth(2), new RectInt().withY(1)]) {
+        const bucket = cache.get(rect.hashCode()) ?? [];
+        if (!bucket.some(item => item.equals(rect))) bucket.push(rect);
+        cache.set(rect.hashCode(), bucket);
+    }
+    assert([...cache.values()].flat().length === 2, 'Hashed dedup cache keeps distinct rects');
+
+    // Deep copies of nested, repeated and oneof fields
+    const notify = new EntitySyncNotify().withSyncs([
+        new EntitySync().withPlayer(new PlayerSync().withEntityInfo(new EntityInfo().withId(9))),
+        new EntitySync().withNpc(new NpcSync()),
+    ]);
+    const copy = notify.clone();
+    assert(deepEqual(copy, notify), 'Clone equals original');
+    assert(copy.syncs !== notify.syncs && copy.syncs[0].player !== notify.syncs[0].player, 'Clone is deep');
+    copy.syncs[0].player.entityInfo.withId(10);
+    assert(!copy.equals(notify) && notify.syncs[0].player.entityInfo.id === 9, 'Mutating clone leaves original intact');
+    assert(new EntitySync().copyFrom(notify.syncs[1]).syncCase === EntitySync.SyncCase.NPC, 'copyFrom copies oneof case');
+
+    console.log('✓ Value methods test passed');
+}
+
+// Test streaming table decoder
+async function testStreamDecoder() {
+    console.log('\n=== Test Stream Decoder ===');
+
+    const table = new TbPlayer().withDataList([
+        new Player().withId(1).withName('小智').withWalkSpeed(1.5),
+        new Player().withId(2).withName('Say \\"hi\\"').withResourceId(1),
+        new Player().withId(3),
+    ]);
+    const json = toJson(table, 2).replace('{', '{"unknown": {"a": [1, {"b": null}]}, ');
+
+    // Feed 5-byte chunks so tokens and multi-byte characters straddle chunk boundaries
+    const bytes = Buffer.from(json);
+    async function* chunks() {
+        for (let i = 0; i < bytes.length; i += 5) yield bytes.subarray(i, i + 5);
+    }
+
+    const rows = [];
+    for await (const row of streamRows(TbPlayer, chunks())) {
+        assert(row instanceof Player, `Row ${rows.length} is a Player instance`);
+        rows.push(row);
+    }
+    assert(rows.length === 3 && rows.every((row, i) => row.equals(table.dataList[i])), 'Streamed rows match source');
+
+    const decoded = await decodeStream(TbPlayer, chunks());
+    assert(decoded.equals(fromJson(TbPlayer, json)), 'decodeStream matches fromJson');
+
+    let error;
+    try {
+        await decodeStream(TbPlayer, '{"dataList": [{"id": 1}');
+    } catch (e) {
+        error = e;
+    }
+    assert(error !== undefined, 'Truncated input is rejected');
+
+    console.log('✓ Stream decoder test passed');
+}
+
+// Test flat binary blob format
+function testFlatBlob() {
+    console.log('\n=== Test Flat Blob ===');
+
+    const table = new TbPlayer().withDataList([
+        new Player().withId(1).withName('小智').withWalkSpeed(1.5).withResourceId(3),
+        new Player().withId(2).withName('小智'),
+    ]);
+    const blob = packFlat(TbPlayer, table);
+    const view = openFlat(TbPlayer, blob);
+    assert(view.dataList.length === 2, 'Row count read from blob');
+    const first = view.dataList.get(0);
+    assert(first.id === 1 && first.name === '小智' && first.walkSpeed === 1.5 && first.resourceId === 3, 'Scalar fields read in place');
+    assert([...view.dataList].map(row => row.id).join() === '1,2', 'Rows are iterable');
+    assert(view.dataList.get(1).runSpeed === 0, 'Unset field reads as default');
+
+    // Workers can share a single copy
+    const shared = openFlat(TbPlayer, toSharedBuffer(blob));
+    assert(shared.dataList.get(1).name === '小智', 'View reads from SharedArrayBuffer');
+
+    // Nested messages, oneofs and maps packed from plain JSON
+    const world = packFlat(TbWorldData, {
+        dataList: [{
+            tileSize: 1,
+            startPosition: { x: 1, y: 2, z: 3 },
+            terrainDefinitionNodes: [{ name: 'grass', definition: { name: 'grass', type: 1 } }],
+            terrainSectionByName: { grass: { terrainName: 'grass', tiles: [{ coordinate: { x: 4 } }] } },
+        }],
+    });
+    const data = openFlat(TbWorldData, world).dataList.get(0);
+    assert(data.startPosition.z === 3 && data.hasStartPosition() && !data.hasBaseRange(), 'Sub-message offsets resolved');
+    const node = data.terrainDefinitionNodes.get(0);
+    assert(node.nodeCase === 3 && node.group === undefined && node.definition.type === 1, 'Oneof case read from blob');
+    assert(data.terrainSectionByName.grass.tiles.get(0).coordinate.x === 4, 'Map values read from blob');
+
+    let error;
+    try {
+        openFlat(TbWorldData, blob);
+    } catch (e) {
+        error = e;
+    }
+    assert(error !== undefined, 'Layout hash mismatch is rejected');
+
+    console.log('✓ Flat blob test passed');
+}
+
+// Test columnar tables
+function testColumnarTable() {
+    console.log('\n=== Test Columnar Table ===');
+
+    const rows = [
+        new Player().withId(1).withName('a').withWalkSpeed(1.5),
+        { id: 2, name: 'b', walkSpeed: 3 },
+        new Player().withId(3).withName('a').withWalkSpeed(4.5),
+    ];
+    const columns = Player.Columns.fromRows(rows);
+    assert(columns.columns.id instanceof Int32Array && columns.columns.walkSpeed instanceof Float32Array, 'Scalar fields stored as typed arrays');
+    assert(columns.dictionaries.name.length === 2 && columns.columns.name[2] === columns.columns.name[0], 'Strings dictionary encoded');
+    assert(columns.row(1).name === 'b' && columns.row(2).walkSpeed === 4.5, 'Row views read columns');
+
+    const fast = columns.where('walkSpeed', speed => speed > 2);
+    assert(fast.join() === '1,2', 'Numeric filter returns row indices');
+    const named = columns.where('name', name => name === 'a', fast);
+    assert(named.join() === '2', 'String filter narrows a selection');
+    assert(columns.sum('id') === 6 && columns.max('walkSpeed', fast) === 4.5 && columns.mean('id', fast) === 2.5, 'Aggregates over columns');
+    assert(JSON.stringify(columns.project(['id', 'name'], named)) === '[{"id":3,"name":"a"}]', 'Projection materializes selected fields');
+
+    // Fields named like the table's own members do not shadow them
+    const segments = Segment.Columns.fromRows([
+        { length: 2, dictionaries: 'x', row: 1 },
+        { length: 0.5, dictionaries: 'y', row: 2 },
+    ]);
+    assert(segments.length === 2 && segments.count() === 2, 'Field named length keeps the row count');
+    assert(segments.sum('length') === 2.5 && segments.where('length', length => length > 1).join() === '0', 'Column named length queried');
+    assert(segments.where('dictionaries', value => value === 'y').join() === '1', 'Column named dictionaries queried');
+    assert(segments.row(1).row === 2 && segments.max('row') === 2, 'Column named row queried');
+    let unknown;
+    try {
+        segments.where('constructor', () => true);
+    } catch (error) {
+        unknown = error;
+    }
+    assert(unknown?.message === "Unknown column 'constructor'", 'Inherited names are not columns');
+
+    console.log('✓ Columnar table test passed');
+}
+
+// Test string interning of fields marked (intern)
+async function testStringInterning() {
+    console.log('\n=== Test String Interning ===');
+
+    const row = { id: 1001, assetAddress: { packageName: 'UIPackage', location: 'Assets/UI' } };
+    const json = JSON.stringify({ dataList: [row, row, { ...row, assetAddress: { packageName: 'UIPackage', location: 'Assets/Scene' } }] });
+
+    const internTable = new InternTable();
+    const table = fromJson(TbResource, json, undefined, { internTable });
+    // Sub-messages of lazy builds are only decoded, and their strings interned, on access
+    table.dataList.forEach(item => item.assetAddress);
+    let stats = internTable.stats();
+    assert(table.dataList[2].assetAddress.location === 'Assets/Scene', 'Interned values decode unchanged');
+    assert(stats.lookups === 6 && stats.hits === 3 && stats.size === 3, 'Only marked fields looked up, repeats hit');
+    assert(stats.bytesSaved > 0 && Math.abs(stats.hitRate - 0.5) < 1e-9, 'Hit rate and bytes saved reported');
+
+    // The table is shared across a session, including streaming decodes
+    await decodeStream(TbResource, json, { internTable });
+    stats = internTable.stats();
+    assert(stats.lookups === 12 && stats.hits === 9, 'Session table reused by stream decoder');
+
+    // Bounded: the table restarts instead of growing past its capacity
+    const small = new InternTable(2);
+    ['a', 'b', 'c', 'a'].forEach(value => small.intern(value));
+    assert(small.stats().size <= 2 && small.stats().evictions === 1, 'Intern table stays bounded');
+
+    console.log('✓ String interning test passed');
+}
+
+// Test generated validators
+function testValidation() {
+    console.log('\n=== Test Validation ===');
+
+    const valid = {
+        tileSize: 1,
+        startPosition: { x: 1, y: 2, z: 3 },
+        terrainDefinitionNodes: [{ name: 'g', group: { nodes: [{ definition: { name: 'd', type: 1 } }] } }],
+        terrainSectionByName: { g: { terrainName: 'g', tiles: [{ ruleType: 0 }] } },
+    };
+    assert(validateJson(WorldData, valid) === null, 'Valid input accepted');
+    const decoded = WorldData.validateAndDecode(valid);
+    assert(decoded.terrainSectionByName.g.tiles[0] instanceof TerrainSection.Tile, 'Fused decode builds map values');
+    const { terrainSectionByName, ...withoutMap } = valid;
+    assert(WorldData.validateAndDecode(withoutMap).equals(fromJson(WorldData, withoutMap)), 'Fused decode matches fromJson');
+
+    // Maps in the codec's own form, arrays of entries, are accepted as well
+    const world = fromJson(WorldData, { terrainSectionByName: [{ key: 'g', value: { terrainName: 'g', tiles: [{ ruleType: 0 }] } }] });
+    const encoded = JSON.parse(toJson(world));
+    assert(validateJson(WorldData, encoded) === null, 'Encoded map validates');
+    assert(WorldData.validateAndDecode(encoded).equals(world), 'Fused decode of an encoded map matches fromJson');
+
+    const cases = [
+        [{ tileSize: 'big' }, 'tileSize', 'float'],
+        [{ baseRange: { x: 2 ** 31 } }, 'baseRange.x', 'int32'],
+        [{ terrainDefinitionNodes: {} }, 'terrainDefinitionNodes', 'array'],
+        [{ terrainDefinitionNodes: [{}, { group: { nodes: [{ definition: { type: 7 } }] } }] }, 'terrainDefinitionNodes[1].group.nodes[0].definition.type', 'enum TerrainType'],
+        [{ terrainDefinitionNodes: [{ group: {}, definition: {} }] }, 'terrainDefinitionNodes[0].node', 'a single oneof member'],
+        [{ terrainSectionByName: { g: { tiles: [null] } } }, 'terrainSectionByName[g].tiles[0]', 'object'],
+        [{ terrainSectionByName: [{ key: 'g', value: { tiles: [null] } }] }, 'terrainSectionByName[0].value.tiles[0]', 'object'],
+        [{ terrainSectionByName: 'g' }, 'terrainSectionByName', 'object or array of entries'],
+    ];
+    for (const [json, path, expected] of cases) {
+        const error = validateJson(WorldData, json);
+        assert(error !== null && error.path === path && error.expected === expected, `Rejected with path ${path}`);
+        let thrown;
+        try {
+            fromJsonValidated(WorldData, JSON.stringify(json));
+        } catch (e) {
+            thrown = e;
+        }
+        assert(thrown?.name === 'ValidationError' && thrown.path === path, `Fused decode rejects ${path}`);
+    }
+    assert(validateJson(Player, { id: 1.5 }).message === 'id: expected int32', 'Error message carries the path');
+
+    // Rejected input returns the pooled instances it took, decoded items included
+    EntitySyncNotify.release(new EntitySyncNotify());
+    EntitySync.release(new EntitySync());
+    const pooled = [EntitySyncNotify.__pool.length, EntitySync.__pool.length];
+    let rejected = false;
+    try {
+        EntitySyncNotify.validateAndDecode({ syncs: [{ npc: {} }, 7] });
+    } catch (error) {
+        rejected = error.path === 'syncs[1]';
+    }
+    assert(rejected && EntitySyncNotify.__pool.length === pooled[0] && EntitySync.__pool.length === pooled[1],
+        'Rejected input releases pooled instances');
+
+    console.log('✓ Validation test passed');
+}
+
+// Test google.protobuf well-known types
+async function testWellKnownTypes() {
+    console.log('\n=== Test Well-Known Types ===');
+
+    const json = {
+        battleId: 7,
+        occurredAt: '2024-05-01T12:30:15.250Z',
+        elapsed: '1.5s',
+        damage: 0,
+        moveName: 'Thunderbolt',
+        critical: null,
+        extra: { weather: 'rain', turns: [1, 2] },
+        payload: ['hit', { times: 2 }],
+        tags: ['boss'],
+        updateMask: 'damage,moveName',
+        detail: { '@type': 'type.googleapis.com/pokeworld.Detail', note: 'x' },
+        checkpoints: ['2024-05-01T12:30:00Z', '2024-05-01T14:30:00+02:00'],
+    };
+    const event = fromJson(BattleEvent, json);
+    assert(event.occurredAt instanceof Date && event.occurredAt.getTime() === Date.UTC(2024, 4, 1, 12, 30, 15, 250), 'Timestamp decoded to Date');
+    assert(event.elapsed === 1500 && event.checkpoints[1].getTime() === event.checkpoints[0].getTime(), 'Duration in milliseconds, offsets applied');
+    assert(event.damage === 0 && event.hasDamage() && !event.hasCritical(), 'Wrappers are nullable primitives');
+    assert(event.extra.turns[1] === 2 && event.payload[1].times === 2 && event.updateMask[1] === 'moveName', 'Struct/Value stay plain JSON, FieldMask split');
+    assert(!('Timestamp' in BattleEvent.__descriptor.fields[1]) && BattleEvent.__descriptor.fields[1].clrType === undefined, 'No generated class referenced');
+
+    // Value methods compare and copy the decoded values
+    const copy = event.clone();
+    assert(copy.equals(event) && copy.hashCode() === event.hashCode(), 'Clone equals original');
+    assert(copy.occurredAt !== event.occurredAt && copy.extra !== event.extra, 'Clone copies Date and JSON values');
+    copy.extra.turns.push(3);
+    assert(!copy.equals(event), 'JSON values compared structurally');
+
+    // JSON round trip, through fromJson and the fused validating decoder
+    const encoded = JSON.parse(toJson(event));
+    assert(encoded.occurredAt === '2024-05-01T12:30:15.250Z', 'Date serialized as RFC 3339');
+    assert(fromJson(BattleEvent, encoded).equals(event), 'fromJson round trip');
+    assert(BattleEvent.validateAndDecode({ ...json, cooldowns: { quickAttack: '0.25s' } }).cooldowns.quickAttack === 250, 'Fused decode handles map values');
+    assert(BattleEvent.validateAndDecode(json).equals(event), 'Fused decode matches fromJson');
+    assert(validateJson(BattleEvent, { occurredAt: 'yesterday' }).path === 'occurredAt', 'Malformed timestamp rejected');
+    assert(validateJson(BattleEvent, { damage: 'x' }).expected === 'google.protobuf.Int32Value', 'Wrapper checked as its primitive');
+
+    // Stream decoder builds plain JSON values in place
+    const log = await decodeStream(BattleLog, JSON.stringify({ events: [json, json] }));
+    assert(log.events.length === 2 && log.events[1].equals(event), 'Stream decoder matches fromJson');
+
+    // Flat blob stores timestamps and durations as numbers, JSON types as text
+    const view = openFlat(BattleEvent, packFlat(BattleEvent, { ...json, cooldowns: { quickAttack: 250 } }));
+    assert(view.occurredAt.getTime() === event.occurredAt.getTime() && view.elapsed === 1500, 'Timestamp/Duration read from blob');
+    assert(view.extra.weather === 'rain' && view.damage === 0 && view.critical === undefined, 'JSON and wrapper fields read from blob');
+    assert(view.checkpoints.get(1).getTime() === event.checkpoints[1].getTime() && view.cooldowns.quickAttack === 250, 'Repeated and map values read from blob');
+
+    console.log('✓ Well-known types test passed');
+}
+
+// Test runtime reflection over embedded file descriptors
+function testReflection() {
+    console.log('\n=== Test Reflection ===');
+
+    const player = reflect(Player);
+    assert(player.fullName === 'pokeworld.actor.cfg.Player' && player.file === 'pokeworld/actor/cfg_actor.proto', 'Type found by class');
+    assert(player.fields.map(f => f.number).join() === Player.__descriptor.fields.map(f => f.number).join(), 'Fields match generated descriptor');
+    assert(player.fields[0].name === 'id' && player.fields[0].type === 'TYPE_INT32' && player.fields[0].label === 'LABEL_OPTIONAL', 'Field name, type and label decoded');
+
+    // Referenced types resolve across files gathered from the class graph
+    const root = new ReflectionRoot().addClass(Actor);
+    const resourceId = root.resolveType(root.lookupType('pokeworld.actor.cfg.Player').fields[2]);
+    assert(resourceId.fullName === 'pokeworld.resource.cfg.ResourceId', 'Dependency resolved from another file');
+    assert(root.lookupType('.pokeworld.actor.cfg.Actor').oneofs[0] === 'value', 'Oneof declarations decoded');
+    assert(root.fileNames.indexOf('pokeworld/resource/cfg_resource.proto') < root.fileNames.indexOf('pokeworld/actor/cfg_actor.proto'), 'Dependencies ordered first');
+
+    // Descriptors are only decoded on first lookup
+    const lazy = new ReflectionRoot().add({ name: 'broken.proto', dependencies: [], data: '////' });
+    assert(lazy.fileNames[0] === 'broken.proto', 'Adding does not decode');
+    let failed = false;
+    try {
+        lazy.lookupType('broken.Missing');
+    } catch (e) {
+        failed = true;
+    }
+    assert(failed, 'Malformed descriptor reported on lookup');
+
+    // Enums, map entries and raw custom options
+    const world = new ReflectionRoot().add(csWorldDescriptor);
+    assert(world.lookupEnum('pokeworld.world.cs.MessageId').values.find(v => v.name === 'MESSAGE_ID_MOVE_REQUEST').number === 1001, 'Enum values decoded');
+    assert(world.lookupType(MoveRequest.__descriptor.fullName).options.length > 0, 'Custom options kept as raw bytes');
+    assert(world.getFile('pokeworld/world/cs_world.proto').dependencies.includes('google/protobuf/descriptor.proto'), 'File dependencies decoded');
+    let missing = false;
+    try {
+        world.resolveType(world.lookupType('pokeworld.world.cs.PlayerSync').fields[0]);
+    } catch (e) {
+        missing = e.message.includes('pokeworld.entity.comm.EntityInfo');
+    }
+    assert(missing, 'Missing dependency reported with type name');
+
+    // FileDescriptorSet bytes decode back into the same files
+    const set = root.toFileDescriptorSet();
+    assert(set[0] === 0x0a, 'FileDescriptorSet starts with file tag');
+    const length = set[1] < 0x80 ? set[1] : (set[1] & 0x7f) | (set[2] << 7);
+    const start = set[1] < 0x80 ? 2 : 3;
+    const first = decodeFileDescriptor(set.subarray(start, start + length));
+    assert(first.name === root.fileNames[0], 'FileDescriptorSet entries round trip');
+
+    console.log('✓ Reflection test passed');
+}
+
+// Test the generated type registry
+async function testTypeRegistry() {
+    console.log('\n=== Test Type Registry ===');
+
+    assert(typeNames.every((name, slot) => findTypeSlot(name) === slot), 'Every name hashes to its own slot');
+    assert(findTypeSlot('.pokeworld.actor.cfg.Player') === findTypeSlot('pokeworld.actor.cfg.Player'), 'Leading dot accepted');
+    assert(!hasType('pokeworld.actor.cfg.Missing') && !hasType('') && findTypeSlot('Player') === -1, 'Unknown names rejected');
+
+    // Modules are only imported on demand
+    assert(getType('pokeworld.actor.cfg.Player') === undefined, 'Nothing resolved before loading');
+    assert(await loadType('pokeworld.actor.cfg.Player') === Player, 'Class loaded by full name');
+    assert(getType('pokeworld.actor.cfg.Player') === Player, 'Loaded class available synchronously');
+    assert(await loadType('pokeworld.world.cs.MessageId') === MessageId, 'Enum loaded by full name');
+    assert(await loadTypeByUrl('type.googleapis.com/pokeworld.world.comm.WorldData') === WorldData, 'Any type URL resolved');
+    assert(await loadType('pokeworld.nowhere.Type') === undefined, 'Unknown name loads undefined');
+
+    // Nested types resolve through their parent class
+    const entry = await loadType('pokeworld.world.comm.WorldData.TerrainSectionByNameEntry');
+    assert(entry === WorldData.TerrainSectionByNameEntry, 'Nested class resolved by path');
+
+    for (const name of typeNames) {
+        const type = await loadType(name);
+        if (type?.__descriptor?.fullName !== name) {
+            assert(false, `Registry entry ${name} resolves to its type`);
+        }
+    }
+    console.log(`OK: ${typeNames.length} registered types resolve to their descriptors`);
+
+    // A failed import is retried by the next call instead of staying cached
+    const dir = mkdtempSync(join(tmpdir(), 'registry-'));
+    try {
+        copyFileSync(new URL('./gen/type_registry.mjs', import.meta.url), join(dir, 'type_registry.mjs'));
+        const registry = await import(pathToFileURL(join(dir, 'type_registry.mjs')).href);
+        let failed = false;
+        await registry.loadType('pokeworld.math.comm.Rect').catch(() => { failed = true; });
+        mkdirSync(join(dir, 'pokeworld', 'math'), { recursive: true });
+        copyFileSync(new URL('./gen/pokeworld/math/comm_math.mjs', import.meta.url), join(dir, 'pokeworld', 'math', 'comm_math.mjs'));
+        const rect = await registry.loadType('pokeworld.math.comm.Rect');
+        assert(failed && rect?.__descriptor.fullName === 'pokeworld.math.comm.Rect', 'Failed module import retried');
+    } finally {
+        rmSync(dir, { recursive: true, force: true });
+    }
+
+    console.log('✓ Type registry test passed');
+}
+
+// Test encode/decode metrics
+function testMetrics() {
+    console.log('\n=== Test Metrics ===');
+
+    const player = fromJson(Player, { id: 5, name: 'Red', walkSpeed: 2.5 });
+    assert(!metricsEnabled && Object.keys(snapshot()).length === 0, 'Metrics off by default');
+
+    enableMetrics({ measure: true });
+    try {
+        const json = toJson(player);
+        toJson(player);
+        fromJson(Player, json);
+        fromJson(Actor, { player: { id: 1, name: 'Blue' } });
+        fromJsonValidated(Player, json);
+        const blob = packFlat(Player, player);
+
+        const stats = snapshot();
+        const encode = stats['pokeworld.actor.cfg.Player'].encode;
+        const decode = stats['pokeworld.actor.cfg.Player'].decode;
+        assert(encode.count === 3 && encode.bytes === json.length * 2 + blob.length, 'Encodes counted with payload size');
+        assert(decode.count === 2 && decode.bytes === json.length * 2 && decode.time >= 0, 'Decodes counted, including the generated validating decoder');
+        assert(stats['pokeworld.actor.cfg.Actor'].decode.count === 1, 'Nested messages not counted separately');
+        assert(encode.histogram.reduce((sum, bucket) => sum + bucket.count, 0) === 3, 'Histogram covers every encode');
+        const bucket = decode.histogram[0];
+        assert(bucket.count === 2 && bucket.le > json.length && bucket.le / 2 <= json.length, 'Payload size bucketed by power of two');
+
+        const entries = performance.getEntriesByName('protobuf.encode pokeworld.actor.cfg.Player', 'measure');
+        assert(entries.length === 3 && entries[0].detail.bytes === json.length, 'Exported as performance measures');
+    } finally {
+        disableMetrics();
+        performance.clearMeasures();
+    }
+
+    toJson(player);
+    assert(snapshot()['pokeworld.actor.cfg.Player'].encode.count === 3, 'Nothing recorded once disabled');
+    resetMetrics();
+    assert(Object.keys(snapshot()).length === 0, 'Reset clears metrics');
+
+    console.log('✓ Metrics test passed');
+}
+
+// Test the generation manifest and depfile
+function testManifest() {
+    console.log('\n=== Test Manifest ===');
+
+    const genUrl = new URL('./gen/', import.meta.url);
+    const manifest = JSON.parse(readFileSync(new URL('manifest.json', genUrl), 'utf8'));
+    const names = manifest.files.map(file => file.name);
+    assert(names.includes('pokeworld/actor/cfg_actor.mjs') && names.includes('type_registry.mjs'), 'Every output listed');
+
+    for (const file of manifest.files) {
+        const content = readFileSync(new URL(file.name, genUrl));
+        const sha256 = createHash('sha256').update(content).digest('hex');
+        if (sha256 !== file.sha256 || content.length !== file.size) {
+            assert(false, `Hash and size of ${file.name} match the file`);
+        }
+    }
+    console.log(`OK: ${manifest.files.length} output hashes match the files`);
+
+    // Dependency closure follows transitive imports
+    const table = manifest.files.find(file => file.name === 'pokeworld/config/cfg_table.mjs');
+    assert(table.dependencies.includes('pokeworld/config/cfg_table.proto'), 'Closure includes the source');
+    assert(table.dependencies.includes('pokeworld/math/comm_math.proto'), 'Closure includes transitive imports');
+    assert(table.dependencies.every((name, i, list) => i === 0 || list[i - 1] < name), 'Dependencies sorted');
+    const registry = manifest.files.find(file => file.name === 'type_registry.mjs');
+    assert(registry.dependencies.length >= table.dependencies.length, 'Registry depends on every generated file');
+
+    // Targets and dependencies resolve from the directory protoc ran in (build.mjs)
+    const depfile = readFileSync(new URL(manifest.depfile, genUrl), 'utf8');
+    assert(depfile.startsWith(`gen/${names[0]}: \\\n`), 'Depfile rule per output');
+    assert(depfile.includes('  proto/pokeworld/config/cfg_table.proto'), 'Depfile lists dependencies');
+    const paths = depfile.split(/\s+/).filter(path => path !== '' && path !== '\\').map(path => path.replace(/:$/, ''));
+    const missing = paths.filter(path => !existsSync(new URL(path, import.meta.url)));
+    assert(paths.length > manifest.files.length && missing.length === 0, `Depfile paths exist from the build directory: ${missing}`);
+
+    console.log('✓ Manifest test passed');
+}
+
+// Test the framed binary message stream
+async function testFraming() {
+    console.log('\n=== Test Framing ===');
+
+    // Message ids repeat across modules, the module id tells them apart
+    const types = new FrameTypes(csUser, csWorld);
+    assert(MoveRequest.__descriptor.messageId === csUser.RegisterRequest.__descriptor.messageId, 'Message ids shared by modules');
+    assert(types.get(1010, 1001) === MoveRequest && types.get(1009, 1001) === csUser.RegisterRequest, 'Frame types keyed by module and message id');
+
+    const messages = [
+        fromJson(MoveRequest, { movement: 2, run: true }),
+        fromJson(csUser.RegisterRequest, { email: 'red@kanto.jp', userName: 'レッド', password: 'pikachu' }),
+        new csWorld.ExitRequest(),
+        fromJson(csWorld.ExitResponse, { success: true }),
+    ];
+    const writer = new FrameWriter({ initialSize: 16 });
+    for (const message of messages) writer.write(message);
+    const frames = writer.flush();
+    assert(writer.length === 0 && frames.length === messages.reduce((n, m) => n + FRAME_HEADER_SIZE + Buffer.byteLength(toJson(m)), 0), 'Frames packed back to back');
+    const view = new DataView(frames.buffer, frames.byteOffset);
+    assert(view.getUint16(4, true) === 1010 && view.getUint16(6, true) === 1001, 'Header carries module and message id');
+
+    // Whole chunk: bodies decoded in place
+    const bodies = [];
+    const reader = new FrameReader(types, {
+        decodeBody(messageCls, body) {
+            bodies.push(body);
+            return fromJson(messageCls, new TextDecoder().decode(body));
+        },
+    });
+    const decoded = reader.push(frames);
+    assert(decoded.length === messages.length && decoded.every((m, i) => m.constructor === messages[i].constructor && m.equals(messages[i])), 'Frames decoded in order');
+    assert(bodies.every(body => body.buffer === frames.buffer), 'Bodies decoded from views of the input chunk');
+    writer.release(frames);
+
+    // Every split point: partial frames kept across chunks
+    let splitsOk = true;
+    for (let split = 1; split < frames.length; split++) {
+        const chunkedReader = new FrameReader(types);
+        const result = [...chunkedReader.push(frames.slice(0, split)), ...chunkedReader.push(frames.slice(split))];
+        if (result.length !== messages.length || !result.every((m, i) => m.equals(messages[i])) || chunkedReader.pendingLength !== 0) {
+            splitsOk = false;
+        }
+    }
+    assert(splitsOk, 'Frames reassembled at every split point');
+
+    const byteReader = new FrameReader(types);
+    const byByte = [];
+    for (let i = 0; i < frames.length; i++) byByte.push(...byteReader.push(frames.subarray(i, i + 1)));
+    assert(byByte.length === messages.length && byByte[1].userName === 'レッド', 'Frames reassembled from single bytes');
+
+    assert((() => { try { new FrameReader(new FrameTypes(csWorld)).push(frames); return false; } catch (error) { return error.message.includes('1009:1001'); } })(), 'Unknown frame id rejected');
+    const unknown = [];
+    new FrameReader(new FrameTypes(csWorld), { onUnknown: (moduleId, messageId) => unknown.push(`${moduleId}:${messageId}`) }).push(frames);
+    assert(unknown.length === 1 && unknown[0] === '1009:1001', 'Unknown frames passed to onUnknown');
+
+    // Async iterator over a chunked source
+    async function* chunks() {
+        for (let i = 0; i < frames.length; i += 7) yield frames.slice(i, i + 7);
+    }
+    const streamed = [];
+    for await (const message of readFrames(chunks(), [csUser, csWorld])) streamed.push(message);
+    assert(streamed.length === messages.length && streamed[3].success === true, 'Messages streamed through readFrames');
+    let truncated = false;
+    try {
+        for await (const message of readFrames([frames.slice(0, frames.length - 1)], types)) void message;
+    } catch (error) {
+        truncated = error.message.includes('inside a frame');
+    }
+    assert(truncated, 'Stream ending inside a frame rejected');
+
+    // Push queue with backpressure
+    const queue = new FrameQueue(types, { highWaterMark: 2 });
+    assert(queue.write(frames) === false && queue.size === 4, 'Write reports backpressure above highWaterMark');
+    let drained = false;
+    queue.drained().then(() => { drained = true; });
+    const iterator = queue[Symbol.asyncIterator]();
+    await iterator.next();
+    await iterator.next();
+    await iterator.next();
+    assert(drained && queue.size === 1, 'Drained once the consumer catches up');
+    queue.end();
+    const last = await iterator.next();
+    assert(last.value.success === true && (await iterator.next()).done, 'Queue ends after buffered messages');
+
+    console.log('✓ Framing test passed');
+}
+
+// Test the generated client stubs over the loopback transport
+async function testRpcClient() {
+    console.log('\n=== Test RPC Client ===');
+
+    const { UserClient, LoginRequest, LoginResponse, RegisterRequest } = csUser;
+    const { WorldClient } = csWorld;
+    assert(UserClient.__calls.some(call => call.name === 'getCreatedPlayers' && call.responseType === csUser.GetCreatedPlayersResponse), 'Request paired with response by id name');
+    assert(WorldClient.__calls.some(call => call.name === 'move' && call.responseType === undefined), 'Request without response is one-way');
+
+    const [clientTransport, serverTransport] = createLoopback();
+    const moves = [];
+    const server = new RpcServer(serverTransport, [csUser, csWorld])
+        .implement(UserClient, {
+            async login(request) {
+                // Answer out of order: later requests resolve first
+                await new Promise(resolve => setTimeout(resolve, request.email === 'slow' ? 5 : 0));
+                return fromJson(LoginResponse, { success: request.password === 'pikachu' });
+            },
+        })
+        .implement(WorldClient, {
+            move(request) { moves.push(request.movement); },
+            exit() { return fromJson(csWorld.ExitResponse, { success: true }); },
+        });
+
+    const channel = new RpcChannel(clientTransport, [csUser, csWorld]);
+    const user = new UserClient(channel);
+    const world = new WorldClient(channel);
+
+    // Calls issued in one tick share one write and resolve by correlation id
+    const results = await Promise.all([
+        user.login(fromJson(LoginRequest, { email: 'slow', password: 'pikachu' })),
+        user.login(fromJson(LoginRequest, { email: 'fast', password: 'wrong' })),
+        world.exit(new csWorld.ExitRequest()),
+    ]);
+    assert(results[0] instanceof LoginResponse && results[0].success && !results[1].success, 'Out-of-order responses matched to their calls');
+    assert(results[2].success === true, 'Calls multiplexed across modules');
+    assert(channel.writes === 1 && channel.pendingCount === 0, 'Requests of one tick coalesced into one write');
+
+    world.move(fromJson(MoveRequest, { movement: 3 }));
+    world.move(fromJson(MoveRequest, { movement: 1 }));
+    await world.exit(new csWorld.ExitRequest());
+    assert(moves.join() === '3,1', 'One-way requests delivered in order');
+
+    // Server push on correlation id 0
+    const pushed = new Promise(resolve => channel.on(csWorld.ExitResponse, resolve));
+    server.push(fromJson(csWorld.ExitResponse, { success: true }));
+    assert((await pushed).success === true, 'Server push delivered to listeners');
+
+    // Unanswered calls time out; the channel keeps working
+    let timedOut = false;
+    try {
+        await user.register(fromJson(RegisterRequest, { email: 'nobody' }), { timeout: 10 });
+    } catch (error) {
+        timedOut = error.message.includes('timed out');
+    }
+    assert(timedOut && channel.pendingCount === 0, 'Unanswered call times out');
+
+    // Without pipelining one call is in flight at a time, one write each
+    const [serialClient, serialServer] = createLoopback();
+    new RpcServer(serialServer, [csUser]).implement(UserClient, { login: () => new LoginResponse() });
+    const serial = new RpcChannel(serialClient, [csUser], { pipelining: false });
+    const serialUser = new UserClient(serial);
+    await Promise.all(Array.from({ length: 5 }, () => serialUser.login(new LoginRequest())));
+    assert(serial.writes === 5, 'Pipelining off writes each request separately');
+
+    channel.close();
+    let rejected = false;
+    await user.login(new LoginRequest()).catch(() => { rejected = true; });
+    assert(rejected, 'Closed channel rejects calls');
+
+    console.log('✓ RPC client test passed');
+}
+
+// Test lazy decoding of sub-messages (requires gen/ built with the 'lazy' option)
+function testLazyDecoding() {
+    console.log('\n=== Test Lazy Decoding ===');
+
+    const json = {
+        dataList: [
+            { id: 1001, assetAddress: { packageName: 'UIPackage', location: 'Assets/UI' } },
+            { id: 1002, assetAddress: { packageName: 'ScenePackage', location: 'Assets/Scene' } },
+        ],
+    };
+    const table = fromJson(TbResource, json);
+    assert(table.__dataListRaw === json.dataList, 'Repeated sub-messages kept as JSON until accessed');
+
+    const first = table.dataList[0];
+    assert(table.__dataListRaw === undefined && table.dataList.length === 2, 'List decoded on first access');
+    assert(first.__assetAddressRaw === json.dataList[0].assetAddress && first.hasAssetAddress(), 'Nested sub-message still pending but present');
+    assert(first.assetAddress.location === 'Assets/UI' && first.__assetAddressRaw === undefined, 'Sub-message decoded on first access');
+
+    // Same result as the eager decoder, with later writes replacing pending JSON
+    const syncJson = { entityInfo: { id: 7 }, entityTransform: { pos: { x: 1, y: 2 } } };
+    assert(fromJson(PlayerSync, syncJson).equals(fromJsonValidated(PlayerSync, syncJson)), 'Lazy decode equals eager decode');
+    assert(JSON.stringify(table) === JSON.stringify(fromJsonValidated(TbResource, json)), 'Lazy message serializes like eager');
+    const pending = fromJson(PlayerSync, syncJson);
+    pending.entityInfo = undefined;
+    assert(pending.entityInfo === undefined && !pending.hasEntityInfo(), 'Setter discards pending JSON');
+
+    // Pooled instances drop pending JSON without decoding it
+    const pooled = fromJson(TbResource, json);
+    TbResource.release(pooled);
+    assert(pooled.__dataListRaw === undefined && pooled.dataList.length === 0, 'clear() drops pending JSON');
+
+    console.log('✓ Lazy decoding test passed');
+}
+
+// Test the hybrid 64-bit integer representation (requires gen/ built with int64=hybrid)
+async function testInt64() {
+    console.log('\n=== Test Int64 ===');
+
+    assert(JoinGameRequest.__descriptor.fields[0].int64 === 'hybrid', 'Descriptor records the int64 representation');
+
+    // Safe integers stay numbers, larger values become bigints without losing precision
+    const small = fromJson(JoinGameRequest, { entityId: '9007199254740991' });
+    const large = fromJson(JoinGameRequest, { entityId: '18446744073709551615' });
+    assert(small.entityId === 9007199254740991 && fromJson(JoinGameRequest, { entityId: 42 }).entityId === 42, 'Safe integers decode as numbers');
+    assert(large.entityId === 18446744073709551615n, 'Unsafe integers decode as exact bigints');
+    // Fresh instances, decoded ones may write back their source JSON (passthrough)
+    assert(toJson(new JoinGameRequest().withEntityId(large.entityId)) === '{"entityId":"18446744073709551615"}' &&
+        toJson(new JoinGameRequest().withEntityId(small.entityId)) === '{"entityId":9007199254740991}', 'Bigints serialize as decimal strings');
+
+    const json = { entityIds: ['1', '9007199254740993', 7] };
+    const request = fromJson(GetPlayersRequest, json);
+    assert(request.entityIds[0] === 1 && request.entityIds[1] === 9007199254740993n && request.entityIds[2] === 7, 'Repeated values decode per element');
+    const copy = fromJson(GetPlayersRequest, toJson(request));
+    assert(copy.equals(request) && copy.hashCode() === request.hashCode(), 'Round trip keeps equality and hash');
+    assert(GetPlayersRequest.validateAndDecode(json).equals(request), 'Validated decode matches fromJson');
+    assert((await decodeStream(GetPlayersRequest, toJson(request))).equals(request), 'Stream decode matches fromJson');
+
+    // Deltas stay JSON-safe
+    const tracked = new JoinGameRequest();
+    tracked.commit();
+    tracked.withEntityId(18446744073709551615n);
+    const delta = JSON.parse(JSON.stringify(tracked.encodeDelta()));
+    assert(new JoinGameRequest().applyDelta(delta).entityId === 18446744073709551615n, 'Delta carries bigints as strings');
+
+    // Malformed strings are rejected rather than decoded through Number() or BigInt()
+    const rejects = decode => {
+        try {
+            decode();
+            return false;
+        } catch (error) {
+            return error.message.startsWith('Invalid 64-bit integer');
+        }
+    };
+    for (const entityId of ['abc', '12abc', '', '1.5', '0x10', ' 12', '99999999999999999999x']) {
+        assert(rejects(() => fromJson(JoinGameRequest, { entityId })) &&
+            rejects(() => new JoinGameRequest().applyDelta({ f: { entityId } })), `Rejects ${JSON.stringify(entityId)}`);
+    }
+    assert(fromJson(JoinGameRequest, { entityId: '-123456789012345' }).entityId === -123456789012345, 'Negative 15-digit strings stay numbers');
+
+    // Flat views assemble safe values from 32-bit halves
+    const view = openFlat(GetPlayersRequest, packFlat(GetPlayersRequest, request));
+    assert([...view.entityIds].join() === '1,9007199254740993,7' && typeof view.entityIds.get(0) === 'number', 'Flat view reads hybrid values');
+    assert(openFlat(JoinGameRequest, packFlat(JoinGameRequest, large)).entityId === 18446744073709551615n, 'Flat view reads unsigned bigints');
+
+    console.log('✓ Int64 test passed');
+}
+
+// Test retained source JSON written back verbatim (requires gen/ built with the 'passthrough' option)
+function testPassthrough() {
+    console.log('\n=== Test Passthrough ===');
+
+    // Key order and an unknown key a fresh encode would not reproduce
+    const text = '{"entityTransform":{"pos":{"y":2,"x":1}},"entityInfo":{"id":7,"future":true},"extra":[1,2]}';
+    const sync = fromJson(PlayerSync, text);
+    assert(sync.__isPristine() && toJson(sync) === text, 'Unmodified message writes back its source text');
+    assert(sync.entityTransform.pos.x === 1 && toJson(sync) === text, 'Reading fields keeps it pristine');
+
+    // Changing a decoded sub-message re-encodes the path to it, siblings stay raw
+    sync.entityTransform.pos.withX(5);
+    const parsed = JSON.parse(toJson(sync));
+    assert(!sync.__isPristine() && parsed.entityTransform.pos.x === 5, 'Nested change invalidates the parent');
+    assert(parsed.entityInfo.future === true && parsed.extra.join() === '1,2', 'Unknown keys survive re-encoding');
+
+    const replaced = fromJson(PlayerSync, text).withEntityInfo(new EntityInfo().withId(8));
+    assert(JSON.parse(toJson(replaced)).entityInfo.id === 8, 'withXxx invalidates the retained JSON');
+    const copy = new PlayerSync().copyFrom(fromJson(PlayerSync, text));
+    assert(!copy.__isPristine() && copy.equals(fromJson(PlayerSync, text)), 'Copies are encoded from their fields');
+
+    // Plain field assignments and in-place array or map edits are not lost
+    const registered = fromJson(csUser.RegisterRequest, '{"email":"red@kanto.jp","userName":"red"}');
+    registered.email = 'changed';
+    assert(JSON.parse(toJson(registered)).email === 'changed', 'Assigning a plain field invalidates the retained JSON');
+    const ids = fromJson(GetPlayersRequest, '{"entityIds":["1","9007199254740993"]}');
+    assert(ids.__isPristine(), 'Decoded 64-bit ids compare equal to the retained JSON');
+    ids.entityIds.push(3);
+    assert(JSON.parse(toJson(ids)).entityIds.length === 3, 'Pushing to an array invalidates the retained JSON');
+    const swapped = fromJson(GetPlayersRequest, '{"entityIds":["1","2"]}');
+    swapped.entityIds[0] = 5;
+    assert(JSON.parse(toJson(swapped)).entityIds[0] == 5, 'Replacing an array element invalidates the retained JSON');
+    const inventory = fromJson(Inventory, '{"maxSlot":2,"slotMap":[{"key":1,"value":{"itemId":7}}]}');
+    assert(inventory.__isPristine(), 'Decoded maps compare equal to the retained JSON');
+    inventory.slotMap[0].value.withItemId(8);
+    assert(JSON.parse(toJson(inventory)).slotMap[0].value.itemId === 8, 'Changing a map entry invalidates the retained JSON');
+    const keyed = Inventory.validateAndDecode({ maxSlot: 2, slotMap: { 1: { itemId: 7 } } });
+    assert(keyed.__isPristine(), 'Keyed maps compare equal to the retained JSON');
+    keyed.slotMap[2] = new Slot().withItemId(8);
+    assert(!keyed.__isPristine(), 'Adding a map key invalidates the retained JSON');
+
+    // Forwarding a frame copies the decoded body bytes
+    const types = new FrameTypes(csUser);
+    const body = '{"password":"pikachu","email":"red@kanto.jp","client":"v2"}';
+    const inbound = new FrameWriter();
+    inbound.write(csUser.LoginRequest.validateAndDecode(JSON.parse(body)));
+    const [request] = new FrameReader(types).push(inbound.flush());
+    const outbound = new FrameWriter();
+    outbound.write(request);
+    assert(new TextDecoder().decode(outbound.flush().subarray(FRAME_HEADER_SIZE)) === body, 'Forwarded frame body is byte-identical');
+
+    // Pooled instances drop what they retained
+    const pooled = fromJson(PlayerSync, text);
+    PlayerSync.release(pooled);
+    assert(pooled.__raw === undefined && toJson(pooled) === '{}', 'clear() drops retained JSON');
+
+    console.log('✓ Passthrough test passed');
+}
+
 // Test repeated field (array)
 function testRepeatedField() {
     console.log('\n=== Test Repeated Field ===');
@@ -146,6 +1139,27 @@ function testEnumField() {
     console.log('✓ Enum field test passed');
 }
 
+// Test enum reverse lookup
+function testEnumLookup() {
+    console.log('\n=== Test Enum Lookup ===');
+
+    // Dense enum uses an array table
+    assert(Array.isArray(TerrainTileRuleType.__descriptor.valueIndex), 'Dense enum has array table');
+    assert(getEnumName(TerrainTileRuleType, TerrainTileRuleType.TOP_EDGE) === 'TOP_EDGE', 'Dense enum name lookup');
+    assert(getEnumName(TerrainTileRuleType, 2, true) === 'TERRAINTILERULETYPE_TOP_EDGE', 'Dense enum original name lookup');
+
+    // Sparse enums use a Map
+    assert(MessageId.__descriptor.valueIndex instanceof Map, 'Sparse enum has Map table');
+    assert(getEnumName(MessageId, 1004) === 'ENTITY_SYNC_NOTIFY', 'Sparse enum name lookup');
+    assert(getEnumName(TerrainFlags, 16) === 'SINGLE_WAY', 'Flags enum name lookup');
+
+    // Unknown numbers
+    assert(getEnumValue(MessageId, 42) === undefined, 'Unknown sparse value is undefined');
+    assert(getEnumValue(TerrainTileRuleType, 1000) === undefined, 'Unknown dense value is undefined');
+
+    console.log('✓ Enum lookup test passed');
+}
+
 // Test error handling
 function testErrorHandling() {
     console.log('\n=== Test Error Handling ===');
@@ -225,8 +1239,30 @@ async function runAllTests() {
         testBasicDeserialization();
         testRoundTrip();
         testNestedMessage();
+        testNestedTypes();
+        testOneofField();
+        testFieldPresence();
+        testMessagePool();
+        testDeltaEncoding();
+        testValueMethods();
+        await testStreamDecoder();
+        testFlatBlob();
+        testColumnarTable();
+        await testStringInterning();
+        testValidation();
+        await testWellKnownTypes();
+        testReflection();
+        await testTypeRegistry();
+        testMetrics();
+        testManifest();
+        await testFraming();
+        await testRpcClient();
+        testLazyDecoding();
+        await testInt64();
+        testPassthrough();
         testRepeatedField();
         testEnumField();
+        testEnumLookup();
         testOptionalFields();
         testErrorHandling();
 
@@ -248,8 +1284,30 @@ export {
     testBasicDeserialization,
     testRoundTrip,
     testNestedMessage,
+    testNestedTypes,
+    testOneofField,
+    testFieldPresence,
+    testMessagePool,
+    testDeltaEncoding,
+    testValueMethods,
+    testStreamDecoder,
+    testFlatBlob,
+    testColumnarTable,
+    testStringInterning,
+    testValidation,
+    testWellKnownTypes,
+    testReflection,
+    testTypeRegistry,
+    testMetrics,
+    testManifest,
+    testFraming,
+    testRpcClient,
+    testLazyDecoding,
+    testInt64,
+    testPassthrough,
     testRepeatedField,
     testEnumField,
+    testEnumLookup,
     testOptionalFields,
     testErrorHandling,
     runAllTests